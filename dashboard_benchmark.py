@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+"""
+Compare one Status tab refresh done the old way (one request per widget) with a single
+/api/dashboard request, against a running sensor or the webui dev server.
+
+Usage: python3 dashboard_benchmark.py <host[:port]> [refreshes]
+"""
+import json
+import statistics
+import sys
+import time
+import urllib.request
+from concurrent.futures import ThreadPoolExecutor
+
+# What the Status tab fetched on every refresh before /api/dashboard
+LEGACY_REQUESTS = [
+    "/sensor_status",
+    "/get_settings",
+    "/api/timeseries/movement",
+    "/api/timeseries/runout",
+    "/api/timeseries/connection",
+    "/api/timeseries/pause_attempts",
+    "/api/timeseries/pause_attempts/stats",
+]
+
+DASHBOARD_SECTIONS = "status,settings,series,pause"
+
+# Browsers open at most this many connections per host
+BROWSER_PARALLELISM = 6
+
+
+def fetch(base_url, path):
+    """GET path, returning (bytes received, seconds taken)"""
+    start = time.perf_counter()
+    with urllib.request.urlopen(base_url + path, timeout=10) as response:
+        body = response.read()
+    return body, time.perf_counter() - start
+
+
+def legacy_refresh(base_url, pool):
+    """Every widget fetches on its own, in parallel as a browser would"""
+    start = time.perf_counter()
+    results = list(pool.map(lambda path: fetch(base_url, path), LEGACY_REQUESTS))
+    return len(LEGACY_REQUESTS), sum(len(body) for body, _ in results), time.perf_counter() - start
+
+
+def dashboard_refresh(base_url, cursor):
+    """One request; series only carry points newer than the previous cursor"""
+    body, elapsed = fetch(base_url, f"/api/dashboard?sections={DASHBOARD_SECTIONS}&since={cursor}")
+    result = json.loads(body)
+    next_cursor = result.get("series", {}).get("cursor", cursor)
+    return 1, len(body), elapsed, next_cursor
+
+
+def summarize(name, requests, sizes, latencies):
+    latencies_ms = sorted(l * 1000 for l in latencies)
+    p95 = latencies_ms[min(len(latencies_ms) - 1, int(len(latencies_ms) * 0.95))]
+    print(f"{name}:")
+    print(f"  requests per refresh: {requests}")
+    print(f"  bytes per refresh:    {statistics.mean(sizes):.0f}")
+    print(f"  latency per refresh:  mean {statistics.mean(latencies_ms):.1f} ms, "
+          f"median {statistics.median(latencies_ms):.1f} ms, p95 {p95:.1f} ms")
+
+
+def main():
+    if len(sys.argv) < 2:
+        print(__doc__.strip())
+        sys.exit(1)
+
+    host = sys.argv[1]
+    refreshes = int(sys.argv[2]) if len(sys.argv) > 2 else 20
+    base_url = host if host.startswith("http") else f"http://{host}"
+
+    legacy_sizes, legacy_latencies = [], []
+    with ThreadPoolExecutor(max_workers=BROWSER_PARALLELISM) as pool:
+        for _ in range(refreshes):
+            legacy_requests, size, elapsed = legacy_refresh(base_url, pool)
+            legacy_sizes.append(size)
+            legacy_latencies.append(elapsed)
+
+    # The first dashboard request loads the whole window; later ones are incremental
+    _, initial_size, initial_latency, cursor = dashboard_refresh(base_url, 0)
+    dashboard_sizes, dashboard_latencies = [], []
+    for _ in range(refreshes):
+        dashboard_requests, size, elapsed, cursor = dashboard_refresh(base_url, cursor)
+        dashboard_sizes.append(size)
+        dashboard_latencies.append(elapsed)
+
+    print(f"{refreshes} refreshes against {base_url}\n")
+    summarize("Per-widget requests", legacy_requests, legacy_sizes, legacy_latencies)
+    print(f"Dashboard initial load: {initial_size} bytes in {initial_latency * 1000:.1f} ms")
+    summarize("Dashboard", dashboard_requests, dashboard_sizes, dashboard_latencies)
+    print(f"\nRequests removed per refresh: {legacy_requests - dashboard_requests}")
+    print(f"Median latency change: {(statistics.median(dashboard_latencies) - statistics.median(legacy_latencies)) * 1000:+.1f} ms")
+
+
+if __name__ == "__main__":
+    main()
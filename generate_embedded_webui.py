@@ -1,121 +1,188 @@
 #!/usr/bin/env python3
 """
 Standalone script to generate embedded WebUI files for ESP32 firmware
+
+Every file in webui/dist goes into src/EmbeddedWebUI.h with its path, MIME type, gzip
+flag and content hash, plus a perfect hash table that src/EmbeddedAssets.cpp uses to
+look paths up.
+
+Usage: python3 generate_embedded_webui.py [dist_dir]
 """
-import os
 import gzip
-import json
-
-def file_to_progmem(file_path, var_name, compress=True):
-    """Convert a file to C++ PROGMEM array"""
-    with open(file_path, 'rb') as f:
-        data = f.read()
-    
-    # Compress if requested and beneficial
-    if compress and len(data) > 100:
-        data = gzip.compress(data)
-        var_name += "_gz"
-    
-    # Convert to hex array
-    hex_data = ', '.join(f'0x{b:02x}' for b in data)
-    
-    # Generate C++ code
-    cpp_code = f"""
-// Auto-generated from {os.path.basename(file_path)}
-const uint8_t {var_name}[] PROGMEM = {{
+import hashlib
+import os
+import re
+import sys
+
+MIME_TYPES = {
+    ".html": "text/html",
+    ".htm": "text/html",
+    ".css": "text/css",
+    ".js": "application/javascript",
+    ".mjs": "application/javascript",
+    ".json": "application/json",
+    ".webmanifest": "application/manifest+json",
+    ".svg": "image/svg+xml",
+    ".ico": "image/x-icon",
+    ".png": "image/png",
+    ".jpg": "image/jpeg",
+    ".jpeg": "image/jpeg",
+    ".webp": "image/webp",
+    ".woff": "font/woff",
+    ".woff2": "font/woff2",
+    ".txt": "text/plain",
+}
+
+# Already compressed; gzip would only add its header
+PRECOMPRESSED = {".png", ".jpg", ".jpeg", ".webp", ".woff", ".woff2"}
+
+# Source maps would double the flash used and the firmware never needs them
+SKIPPED = {".map"}
+
+# Vite names bundled files name-<8 character content hash>.ext
+HASHED_NAME = re.compile(r"-[A-Za-z0-9_-]{8}\.[A-Za-z0-9]+$")
+
+FNV_PRIME = 16777619
+
+
+def asset_hash(path, seed):
+    """FNV-1a from seed; must match assetHash() in src/EmbeddedAssets.cpp"""
+    h = seed
+    for b in path.encode():
+        h ^= b
+        h = (h * FNV_PRIME) & 0xFFFFFFFF
+    return h
+
+
+def perfect_hash(paths):
+    """Find a seed and power of two table size that give every path its own slot"""
+    size = 1
+    while size < len(paths) * 2:
+        size *= 2
+    while True:
+        for seed in range(0x811C9DC5, 0x811C9DC5 + 100000):
+            slots = [-1] * size
+            for index, path in enumerate(paths):
+                slot = asset_hash(path, seed) & (size - 1)
+                if slots[slot] != -1:
+                    break
+                slots[slot] = index
+            else:
+                return seed, slots
+        size *= 2
+
+
+def load_asset(dist_dir, relative_path):
+    """Bytes to embed for one dist file, and how they're described in the table"""
+    with open(os.path.join(dist_dir, relative_path), "rb") as f:
+        raw = f.read()
+    extension = os.path.splitext(relative_path)[1].lower()
+
+    data, gzipped = raw, False
+    if len(raw) > 100 and extension not in PRECOMPRESSED:
+        # mtime 0 keeps the output identical between builds of the same files
+        compressed = gzip.compress(raw, compresslevel=9, mtime=0)
+        if len(compressed) < len(raw):
+            data, gzipped = compressed, True
+
+    path = "/" + relative_path.replace(os.sep, "/")
+    return {
+        "path": path,
+        "mime": MIME_TYPES.get(extension, "application/octet-stream"),
+        "data": data,
+        "raw_length": len(raw),
+        "gzipped": gzipped,
+        "immutable": path.startswith("/assets/") and bool(HASHED_NAME.search(path)),
+        "etag": hashlib.sha256(raw).hexdigest()[:16],
+    }
+
+
+def generate_header(dist_dir, header_path):
+    """Write header_path from every file in dist_dir; returns how many files were embedded"""
+    relative_paths = []
+    for root, _, files in os.walk(dist_dir):
+        for name in files:
+            if os.path.splitext(name)[1].lower() in SKIPPED:
+                continue
+            relative_paths.append(os.path.relpath(os.path.join(root, name), dist_dir))
+    relative_paths.sort()
+    if not relative_paths:
+        print(f"❌ Nothing to embed in {dist_dir}")
+        return 0
+
+    assets = []
+    for relative_path in relative_paths:
+        print(f"  📦 Embedding {relative_path}...")
+        assets.append(load_asset(dist_dir, relative_path))
+
+    seed, slots = perfect_hash([asset["path"] for asset in assets])
+    index_asset = next((i for i, asset in enumerate(assets) if asset["path"] == "/index.html"), -1)
+
+    header = """#ifndef EMBEDDED_WEBUI_H
+#define EMBEDDED_WEBUI_H
+
+// Generated by generate_embedded_webui.py from webui/dist; don't edit by hand.
+// Only src/EmbeddedAssets.cpp includes it.
+
+#include "EmbeddedAssets.h"
+"""
+    for i, asset in enumerate(assets):
+        hex_data = ", ".join(f"0x{b:02x}" for b in asset["data"])
+        size_note = f", {len(asset['data'])} gzipped" if asset["gzipped"] else ""
+        header += f"""
+// {asset['path']}, {asset['raw_length']} bytes{size_note}
+const uint8_t webui_asset_{i}[] PROGMEM = {{
     {hex_data}
 }};
-const size_t {var_name}_len = {len(data)};
 """
-    return cpp_code, compress
+
+    header += "\nconst embedded_asset_t WEBUI_ASSETS[] = {\n"
+    for i, asset in enumerate(assets):
+        header += (f'    {{"{asset["path"]}", "{asset["mime"]}", webui_asset_{i}, {len(asset["data"])}, '
+                   f'{"true" if asset["gzipped"] else "false"}, '
+                   f'{"true" if asset["immutable"] else "false"}, "\\"{asset["etag"]}\\""}},\n')
+    header += "};\n"
+
+    header += f"""
+#define WEBUI_ASSET_COUNT {len(assets)}
+#define WEBUI_INDEX_ASSET {index_asset}  // Entry for /index.html, -1 if there isn't one
+
+// Perfect hash: slot (hash & WEBUI_ASSET_SLOT_MASK) holds the only asset that can match
+#define WEBUI_ASSET_HASH_SEED 0x{seed:08x}u
+#define WEBUI_ASSET_SLOT_MASK {len(slots) - 1}
+const int16_t WEBUI_ASSET_SLOTS[{len(slots)}] = {{{", ".join(str(slot) for slot in slots)}}};
+
+#endif // EMBEDDED_WEBUI_H
+"""
+
+    with open(header_path, "w") as f:
+        f.write(header)
+    return len(assets)
+
 
 def main():
     print("=" * 50)
     print("Generating Embedded WebUI...")
     print("=" * 50)
-    
+
     # Get project directory
     project_dir = os.path.dirname(os.path.abspath(__file__))
-    webui_dir = os.path.join(project_dir, "webui")
-    dist_dir = os.path.join(webui_dir, "dist")
-    
+    dist_dir = sys.argv[1] if len(sys.argv) > 1 else os.path.join(project_dir, "webui", "dist")
+
     if not os.path.exists(dist_dir):
         print(f"❌ WebUI dist directory not found: {dist_dir}")
         print("Please run 'cd webui && npm run build' first")
         return False
-    
-    # Generate header content
-    header_content = """#ifndef EMBEDDED_WEBUI_H
-#define EMBEDDED_WEBUI_H
-
-#include <Arduino.h>
 
-"""
-    
-    # Files to embed - check what actually exists
-    files_to_check = [
-        ("index.html", "webui_index_html"),
-    ]
-    
-    # Find CSS and JS files dynamically
-    assets_dir = os.path.join(dist_dir, "assets")
-    if os.path.exists(assets_dir):
-        for file in os.listdir(assets_dir):
-            if file.endswith('.css'):
-                files_to_check.append((f"assets/{file}", "webui_css"))
-            elif file.endswith('.js'):
-                files_to_check.append((f"assets/{file}", "webui_js"))
-    
-    # Add favicon if it exists (might be in assets or root)
-    favicon_paths = ["favicon.ico", "assets/favicon.ico"]
-    for favicon_path in favicon_paths:
-        if os.path.exists(os.path.join(dist_dir, favicon_path)):
-            files_to_check.append((favicon_path, "webui_favicon"))
-            break
-    
-    # Process each file that exists
-    embedded_count = 0
-    for file_path, var_name in files_to_check:
-        full_path = os.path.join(dist_dir, file_path)
-        if os.path.exists(full_path):
-            print(f"  📦 Embedding {file_path}...")
-            try:
-                cpp_code, is_compressed = file_to_progmem(full_path, var_name)
-                header_content += cpp_code
-                
-                # Add MIME type info
-                if file_path.endswith('.html') or file_path.endswith('.htm'):
-                    mime_type = "text/html"
-                elif file_path.endswith('.css'):
-                    mime_type = "text/css"
-                elif file_path.endswith('.js'):
-                    mime_type = "application/javascript"
-                elif file_path.endswith('.ico'):
-                    mime_type = "image/x-icon"
-                else:
-                    mime_type = "application/octet-stream"
-                
-                header_content += f'const char {var_name}_mime[] = "{mime_type}";\n'
-                header_content += f'const bool {var_name}_compressed = {"true" if is_compressed else "false"};\n\n'
-                embedded_count += 1
-            except Exception as e:
-                print(f"  ❌ Failed to embed {file_path}: {e}")
-        else:
-            print(f"  ⚠️  File not found: {file_path}")
-    
-    header_content += """#endif // EMBEDDED_WEBUI_H
-"""
-    
-    # Write header file
     header_path = os.path.join(project_dir, "src", "EmbeddedWebUI.h")
-    with open(header_path, 'w') as f:
-        f.write(header_content)
-    
+    embedded_count = generate_header(dist_dir, header_path)
+
     print(f"✅ Generated {header_path} with {embedded_count} embedded files")
     print("=" * 50)
-    
+
     return embedded_count > 0
 
+
 if __name__ == "__main__":
     success = main()
     exit(0 if success else 1)
@@ -0,0 +1,89 @@
+#!/usr/bin/env python3
+"""
+Turn a capture from GET /api/profile (ENABLE_PROFILER builds) into folded stacks, one
+"task;outer;...;leaf count" line per distinct stack, for flamegraph.pl or speedscope.
+
+Usage: python3 profile_symbolize.py <profile.txt | host[:port]> <firmware.elf> [addr2line]
+
+addr2line defaults to xtensa-esp32s3-elf-addr2line, or xtensa-esp32-elf-addr2line when the
+S3 one isn't on PATH; PlatformIO keeps them under ~/.platformio/packages/toolchain-*/bin.
+Firmware built by `pio run` is at .pio/build/<env>/firmware.elf.
+"""
+import collections
+import shutil
+import subprocess
+import sys
+import urllib.request
+
+DEFAULT_ADDR2LINE = ["xtensa-esp32s3-elf-addr2line", "xtensa-esp32-elf-addr2line"]
+
+
+def read_profile(source):
+    """Capture text from a saved file, or fetched from a running sensor"""
+    if source.endswith(".txt"):
+        with open(source) as f:
+            return f.read()
+    base_url = source if source.startswith("http") else f"http://{source}"
+    with urllib.request.urlopen(base_url + "/api/profile", timeout=60) as response:
+        return response.read().decode()
+
+
+def parse_samples(text):
+    """Header comments, and (core, task, [pc, ...]) per sample, interrupted PC first"""
+    header, samples = [], []
+    for line in text.splitlines():
+        if line.startswith("#"):
+            header.append(line[1:].strip())
+            continue
+        # Task names can contain spaces ("Tmr Svc"), so only the core comes off the front
+        # and the PCs off the back
+        core, _, rest = line.partition(" ")
+        task, _, pcs = rest.rpartition(" ")
+        if not task or not pcs:
+            continue
+        samples.append((core, task, [int(pc, 16) for pc in pcs.split(",")]))
+    return header, samples
+
+
+def symbolize(addr2line, elf, addresses):
+    """Map each address to a function name with one addr2line run"""
+    addresses = sorted(addresses)
+    result = subprocess.run([addr2line, "-f", "-C", "-e", elf] + [f"0x{a:08x}" for a in addresses],
+                            capture_output=True, text=True, check=True)
+    lines = result.stdout.splitlines()
+    names = {}
+    # Two lines per address: function, then file:line
+    for i, address in enumerate(addresses):
+        function = lines[2 * i] if 2 * i < len(lines) else "??"
+        names[address] = function if function != "??" else f"0x{address:08x}"
+    return names
+
+
+def main():
+    if len(sys.argv) < 3:
+        print(__doc__.strip())
+        sys.exit(1)
+
+    source, elf = sys.argv[1], sys.argv[2]
+    addr2line = sys.argv[3] if len(sys.argv) > 3 else next(
+        (tool for tool in DEFAULT_ADDR2LINE if shutil.which(tool)), None)
+    if addr2line is None:
+        sys.exit("No xtensa addr2line on PATH; pass its path as the third argument")
+
+    header, samples = parse_samples(read_profile(source))
+    names = symbolize(addr2line, elf, {pc for _, _, pcs in samples for pc in pcs})
+
+    stacks = collections.Counter()
+    for _, task, pcs in samples:
+        # Folded stacks go root first; captures are leaf first
+        frames = [names[pc] for pc in reversed(pcs)]
+        stacks[";".join([task] + frames)] += 1
+
+    for line in header:
+        print(f"# {line}", file=sys.stderr)
+    for stack, count in stacks.most_common():
+        print(f"{stack} {count}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,106 @@
+#include "BootTimeline.h"
+
+#include <esp_system.h>
+#include <esp_timer.h>
+
+static const char *PHASE_NAMES[BOOT_PHASE_COUNT] = {
+    "setup",     "storage",  "settings",  "network",    "setup_done",
+    "wifi",      "printer",  "detection", "web_server", "history"};
+
+BootTimeline &BootTimeline::getInstance()
+{
+    static BootTimeline instance;
+    return instance;
+}
+
+BootTimeline::BootTimeline()
+{
+    memset(phaseUs, 0, sizeof(phaseUs));
+    timelineLock = portMUX_INITIALIZER_UNLOCKED;
+}
+
+void BootTimeline::mark(boot_phase_t phase)
+{
+    // Unlocked fast path: most calls are repeats from a loop
+    if (phase >= BOOT_PHASE_COUNT || phaseUs[phase] != 0)
+    {
+        return;
+    }
+    int64_t now = esp_timer_get_time();
+
+    portENTER_CRITICAL(&timelineLock);
+    if (phaseUs[phase] == 0)
+    {
+        phaseUs[phase] = now;
+    }
+    portEXIT_CRITICAL(&timelineLock);
+}
+
+bool BootTimeline::isMarked(boot_phase_t phase)
+{
+    return getPhaseUs(phase) != 0;
+}
+
+int64_t BootTimeline::getPhaseUs(boot_phase_t phase)
+{
+    if (phase >= BOOT_PHASE_COUNT)
+    {
+        return 0;
+    }
+    portENTER_CRITICAL(&timelineLock);
+    int64_t us = phaseUs[phase];
+    portEXIT_CRITICAL(&timelineLock);
+    return us;
+}
+
+const char *BootTimeline::getPhaseName(boot_phase_t phase)
+{
+    return phase < BOOT_PHASE_COUNT ? PHASE_NAMES[phase] : "unknown";
+}
+
+const char *BootTimeline::getResetReasonName()
+{
+    switch (esp_reset_reason())
+    {
+        case ESP_RST_POWERON:
+            return "power_on";
+        case ESP_RST_EXT:
+            return "external";
+        case ESP_RST_SW:
+            return "software";  // Includes restarts after an OTA update
+        case ESP_RST_PANIC:
+            return "panic";
+        case ESP_RST_INT_WDT:
+        case ESP_RST_TASK_WDT:
+        case ESP_RST_WDT:
+            return "watchdog";
+        case ESP_RST_DEEPSLEEP:
+            return "deep_sleep";
+        case ESP_RST_BROWNOUT:
+            return "brownout";
+        default:
+            return "unknown";
+    }
+}
+
+void BootTimeline::report(JsonObject out)
+{
+    out["reset_reason"] = getResetReasonName();
+
+    // Milliseconds since reset, for the phases reached so far
+    JsonObject phases = out.createNestedObject("phases_ms");
+    for (int i = 0; i < BOOT_PHASE_COUNT; i++)
+    {
+        int64_t us = getPhaseUs((boot_phase_t) i);
+        if (us != 0)
+        {
+            phases[PHASE_NAMES[i]] = (uint32_t) (us / 1000);
+        }
+    }
+
+    int64_t detectionUs = getPhaseUs(BOOT_PHASE_DETECTION);
+    if (detectionUs != 0)
+    {
+        out["time_to_detection_ms"] = (uint32_t) (detectionUs / 1000);
+    }
+}
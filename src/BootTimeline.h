@@ -0,0 +1,60 @@
+#ifndef BOOT_TIMELINE_H
+#define BOOT_TIMELINE_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+// Document size report() needs
+#define BOOT_TIMELINE_JSON_SIZE (JSON_OBJECT_SIZE(3) + JSON_OBJECT_SIZE(BOOT_PHASE_COUNT))
+
+// Milestones from reset to full operation, in the order they normally happen. Everything
+// up to BOOT_PHASE_DETECTION is the critical path; the rest is deferred until detection is
+// running (or a timeout passes without a printer).
+typedef enum
+{
+    BOOT_PHASE_SETUP = 0,          // setup() entered; ROM and bootloader time before it
+    BOOT_PHASE_STORAGE,            // LittleFS mounted
+    BOOT_PHASE_SETTINGS,           // Settings loaded
+    BOOT_PHASE_NETWORK,            // WiFi connection (or the AP) started
+    BOOT_PHASE_SETUP_DONE,         // setup() returned
+    BOOT_PHASE_WIFI_CONNECTED,     // Station got an IP
+    BOOT_PHASE_PRINTER_CONNECTED,  // Printer websocket open
+    BOOT_PHASE_DETECTION,          // First detection pass with the printer connected
+    BOOT_PHASE_WEB_SERVER,         // Web server and web UI up
+    BOOT_PHASE_HISTORY_LOADED,     // Every history store read from flash
+    BOOT_PHASE_COUNT
+} boot_phase_t;
+
+// When each boot phase was first reached, in microseconds since reset (esp_timer starts
+// counting before setup()). mark() may be called from any task; only the first call for a
+// phase counts, so callers don't need to know whether it's their first time.
+class BootTimeline
+{
+   private:
+    int64_t      phaseUs[BOOT_PHASE_COUNT];  // 0 until reached
+    portMUX_TYPE timelineLock;
+
+    BootTimeline();
+
+    // Delete copy constructor and assignment operator
+    BootTimeline(const BootTimeline &)            = delete;
+    BootTimeline &operator=(const BootTimeline &) = delete;
+
+   public:
+    // Singleton access method
+    static BootTimeline &getInstance();
+
+    void    mark(boot_phase_t phase);
+    bool    isMarked(boot_phase_t phase);
+    int64_t getPhaseUs(boot_phase_t phase);  // 0 if not reached yet
+
+    static const char *getPhaseName(boot_phase_t phase);
+    static const char *getResetReasonName();
+
+    void report(JsonObject out);
+};
+
+// Convenience macro for easier access
+#define bootTimeline BootTimeline::getInstance()
+
+#endif  // BOOT_TIMELINE_H
@@ -0,0 +1,365 @@
+#include "ConnectivityManager.h"
+
+#include <ESPmDNS.h>
+#include <esp_sntp.h>
+
+#include "BootTimeline.h"
+#include "Logger.h"
+#include "SettingsManager.h"
+#include "TimeBase.h"
+
+#define MDNS_TASK_STACK 4096
+
+static const char *STATE_NAMES[CONNECTIVITY_STATE_COUNT] = {
+    "idle", "ap", "settling", "connecting", "connected", "retry_wait"};
+
+// mDNS restarts requested by loop() and carried out by mdnsTask
+static portMUX_TYPE mdnsLock       = portMUX_INITIALIZER_UNLOCKED;
+static bool         mdnsWanted     = false;
+static uint32_t     mdnsGeneration = 0;
+
+ConnectivityManager &ConnectivityManager::getInstance()
+{
+    static ConnectivityManager instance;
+    return instance;
+}
+
+ConnectivityManager::ConnectivityManager()
+{
+    state            = CONNECTIVITY_IDLE;
+    stateSince       = 0;
+    timeoutMs        = 0;
+    newCredentials   = false;
+    connectCallback  = nullptr;
+    ntpStarted       = false;
+    eventLock        = portMUX_INITIALIZER_UNLOCKED;
+    gotIp            = false;
+    lostConnection   = false;
+    disconnectReason = 0;
+    timeSynced       = false;
+    mdnsBusy         = false;
+    connects         = 0;
+    disconnects      = 0;
+    ntpSyncs         = 0;
+    lastNtpSyncMs    = 0;
+}
+
+void ConnectivityManager::begin()
+{
+    WiFi.onEvent(onWifiEvent);
+    sntp_set_time_sync_notification_cb(onTimeSync);
+
+    if (settingsManager.isAPMode())
+    {
+        startAccessPoint();
+        logger.log("Wifi setup in AP mode");
+    }
+    else
+    {
+        startStation(CONNECTIVITY_CONNECT_TIMEOUT_MS);
+    }
+}
+
+void ConnectivityManager::onWifiEvent(arduino_event_id_t event, arduino_event_info_t info)
+{
+    ConnectivityManager &self = connectivityManager;
+
+    // Runs on the WiFi event task; loop() does the work
+    portENTER_CRITICAL(&self.eventLock);
+    if (event == ARDUINO_EVENT_WIFI_STA_GOT_IP)
+    {
+        self.gotIp = true;
+    }
+    else if (event == ARDUINO_EVENT_WIFI_STA_DISCONNECTED)
+    {
+        self.lostConnection   = true;
+        self.disconnectReason = info.wifi_sta_disconnected.reason;
+    }
+    portEXIT_CRITICAL(&self.eventLock);
+}
+
+void ConnectivityManager::onTimeSync(struct timeval *tv)
+{
+    // Runs on the lwIP task after SNTP has set the system clock
+    connectivityManager.timeSynced = true;
+}
+
+void ConnectivityManager::loop()
+{
+    portENTER_CRITICAL(&eventLock);
+    bool    ip     = gotIp;
+    bool    lost   = lostConnection;
+    uint8_t reason = disconnectReason;
+    gotIp          = false;
+    lostConnection = false;
+    portEXIT_CRITICAL(&eventLock);
+
+    if (timeSynced)
+    {
+        timeSynced = false;
+        // Pin the epoch offset so stamps taken before the sync map onto wall-clock time
+        timeBase.syncFromSystemClock();
+        ntpSyncs++;
+        lastNtpSyncMs = timeBase.nowMs();
+        logger.log("NTP time synchronization successful");
+    }
+
+    unsigned long elapsed = timeBase.nowMs() - stateSince;
+    switch (state)
+    {
+        case CONNECTIVITY_SETTLING:
+            if (elapsed < CONNECTIVITY_SETTLE_MS)
+            {
+                break;
+            }
+            if (settingsManager.isAPMode())
+            {
+                logger.log("Switching to AP mode");
+                startAccessPoint();
+                finishAttempt(false);
+            }
+            else
+            {
+                logger.log("Connecting to WiFi station mode with new credentials...");
+                startStation(CONNECTIVITY_CONNECT_TIMEOUT_MS);
+            }
+            break;
+
+        case CONNECTIVITY_CONNECTING:
+            // Disconnect events while connecting are failed association attempts; the
+            // driver keeps retrying until the timeout
+            if (ip)
+            {
+                handleConnected();
+            }
+            else if (elapsed >= timeoutMs)
+            {
+                handleConnectFailed();
+            }
+            break;
+
+        case CONNECTIVITY_CONNECTED:
+            if (lost || WiFi.status() != WL_CONNECTED)
+            {
+                disconnects++;
+                logger.logf("WiFi disconnected (reason %u), attempting to reconnect...", reason);
+                startStation(CONNECTIVITY_RECONNECT_TIMEOUT_MS);
+            }
+            break;
+
+        case CONNECTIVITY_RETRY_WAIT:
+            // The driver's auto-reconnect may get there before the next attempt
+            if (ip || WiFi.status() == WL_CONNECTED)
+            {
+                handleConnected();
+            }
+            else if (elapsed >= CONNECTIVITY_RETRY_INTERVAL_MS)
+            {
+                startStation(CONNECTIVITY_RECONNECT_TIMEOUT_MS);
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+void ConnectivityManager::enterState(connectivity_state_t next)
+{
+    state      = next;
+    stateSince = timeBase.nowMs();
+}
+
+void ConnectivityManager::startAccessPoint()
+{
+    logger.log("Starting AP mode");
+    WiFi.softAP(CONNECTIVITY_AP_SSID, CONNECTIVITY_AP_PASSWORD);
+    // mDNS isn't needed in AP mode
+    restartMdns(false);
+    enterState(CONNECTIVITY_AP);
+}
+
+void ConnectivityManager::startStation(unsigned long timeout)
+{
+    logger.logf("Connecting to WiFi: %s", settingsManager.getSSID().c_str());
+
+    // Drop events from before this attempt
+    portENTER_CRITICAL(&eventLock);
+    gotIp          = false;
+    lostConnection = false;
+    portEXIT_CRITICAL(&eventLock);
+
+    WiFi.begin(settingsManager.getSSID().c_str(), settingsManager.getPassword().c_str());
+    timeoutMs = timeout;
+    enterState(CONNECTIVITY_CONNECTING);
+}
+
+void ConnectivityManager::handleConnected()
+{
+    connects++;
+    logger.logf("WiFi Connected, IP %s", WiFi.localIP().toString().c_str());
+    enterState(CONNECTIVITY_CONNECTED);
+    bootTimeline.mark(BOOT_PHASE_WIFI_CONNECTED);
+
+    // Mark that WiFi has successfully connected at least once
+    if (!settingsManager.getHasConnected())
+    {
+        settingsManager.setHasConnected(true);
+        settingsManager.save();
+        logger.log("First successful WiFi connection recorded");
+    }
+
+    restartMdns(true);
+
+    // SNTP re-syncs on its own interval from here and reports through onTimeSync
+    if (!ntpStarted)
+    {
+        sntp_set_sync_interval(CONNECTIVITY_NTP_INTERVAL_MS);
+        configTime(0, 0, CONNECTIVITY_NTP_SERVER);
+        ntpStarted = true;
+        logger.log("NTP setup complete");
+    }
+
+    finishAttempt(true);
+}
+
+void ConnectivityManager::handleConnectFailed()
+{
+    if (newCredentials)
+    {
+        logger.log("Failed to connect with new WiFi credentials");
+    }
+    finishAttempt(false);
+
+    // Only revert to AP mode if WiFi has never successfully connected
+    if (!settingsManager.getHasConnected())
+    {
+        settingsManager.setAPMode(true);
+        if (settingsManager.save())
+        {
+            logger.log("Failed to connect to wifi, reverted to AP mode (first connection attempt)");
+        }
+        else
+        {
+            logger.log("Failed to update settings");
+        }
+        Serial.flush();
+        ESP.restart();
+    }
+
+    logger.log("WiFi connection failed, retrying in 30 seconds");
+    enterState(CONNECTIVITY_RETRY_WAIT);
+}
+
+void ConnectivityManager::finishAttempt(bool connected)
+{
+    newCredentials = false;
+    if (connectCallback)
+    {
+        // Cleared first in case the callback applies credentials again
+        ConnectCallback done = connectCallback;
+        connectCallback      = nullptr;
+        done(connected);
+    }
+}
+
+void ConnectivityManager::applyCredentials(ConnectCallback done)
+{
+    logger.log("Applying new WiFi credentials...");
+
+    // Whoever asked for the previous attempt won't get an answer from it now
+    finishAttempt(false);
+    connectCallback = done;
+    newCredentials  = true;
+
+    // Clean up any existing connections; loop() connects again once they've settled
+    WiFi.softAPdisconnect(true);
+    WiFi.disconnect(true);
+    restartMdns(false);
+    enterState(CONNECTIVITY_SETTLING);
+}
+
+void ConnectivityManager::restartMdns(bool enable)
+{
+    portENTER_CRITICAL(&mdnsLock);
+    mdnsWanted = enable;
+    mdnsGeneration++;
+    bool startTask = !mdnsBusy;
+    mdnsBusy       = true;
+    portEXIT_CRITICAL(&mdnsLock);
+
+    // A running task picks up the new generation before it exits
+    if (startTask && xTaskCreate(mdnsTask, "mdns_restart", MDNS_TASK_STACK, nullptr, 1,
+                                 nullptr) != pdPASS)
+    {
+        portENTER_CRITICAL(&mdnsLock);
+        mdnsBusy = false;
+        portEXIT_CRITICAL(&mdnsLock);
+        logger.log("Error setting up MDNS responder!");
+    }
+}
+
+void ConnectivityManager::mdnsTask(void *param)
+{
+    ConnectivityManager &self = connectivityManager;
+
+    while (true)
+    {
+        portENTER_CRITICAL(&mdnsLock);
+        uint32_t generation = mdnsGeneration;
+        bool     wanted     = mdnsWanted;
+        portEXIT_CRITICAL(&mdnsLock);
+
+        MDNS.end();
+        if (wanted && !MDNS.begin(CONNECTIVITY_HOSTNAME))
+        {
+            logger.log("Error setting up MDNS responder!");
+        }
+
+        portENTER_CRITICAL(&mdnsLock);
+        bool done = generation == mdnsGeneration;
+        if (done)
+        {
+            self.mdnsBusy = false;
+        }
+        portEXIT_CRITICAL(&mdnsLock);
+
+        if (done)
+        {
+            break;
+        }
+    }
+    vTaskDelete(nullptr);
+}
+
+bool ConnectivityManager::isConnected()
+{
+    return state == CONNECTIVITY_CONNECTED;
+}
+
+bool ConnectivityManager::isNtpStarted()
+{
+    return ntpStarted;
+}
+
+connectivity_state_t ConnectivityManager::getState()
+{
+    return state;
+}
+
+const char *ConnectivityManager::getStateName()
+{
+    return STATE_NAMES[state];
+}
+
+void ConnectivityManager::reportStats(JsonObject out)
+{
+    out["state"]       = getStateName();
+    out["connects"]    = connects;
+    out["disconnects"] = disconnects;
+    out["ntp_syncs"]   = ntpSyncs;
+    if (ntpSyncs > 0)
+    {
+        out["last_ntp_sync_s_ago"] = (timeBase.nowMs() - lastNtpSyncMs) / 1000;
+    }
+}
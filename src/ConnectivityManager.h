@@ -0,0 +1,106 @@
+#ifndef CONNECTIVITY_MANAGER_H
+#define CONNECTIVITY_MANAGER_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <WiFi.h>
+
+#include <functional>
+
+#define CONNECTIVITY_HOSTNAME "ccxsfs20"
+#define CONNECTIVITY_AP_SSID "ElegooXBTTSFS20"
+#define CONNECTIVITY_AP_PASSWORD "elegooccsfs20"
+#define CONNECTIVITY_NTP_SERVER "pool.ntp.org"
+
+#define CONNECTIVITY_CONNECT_TIMEOUT_MS 30000    // First connection after boot or new credentials
+#define CONNECTIVITY_RECONNECT_TIMEOUT_MS 10000  // After losing a working connection
+#define CONNECTIVITY_RETRY_INTERVAL_MS 30000     // Between failed reconnects
+#define CONNECTIVITY_SETTLE_MS 1000              // After tearing down before connecting again
+#define CONNECTIVITY_NTP_INTERVAL_MS 3600000     // SNTP re-sync period
+
+typedef enum
+{
+    CONNECTIVITY_IDLE = 0,
+    CONNECTIVITY_AP,          // Access point for onboarding
+    CONNECTIVITY_SETTLING,    // Old connections torn down, waiting before WiFi.begin()
+    CONNECTIVITY_CONNECTING,  // WiFi.begin() issued, waiting for an IP
+    CONNECTIVITY_CONNECTED,
+    CONNECTIVITY_RETRY_WAIT,  // Connection failed, next attempt after the retry interval
+    CONNECTIVITY_STATE_COUNT
+} connectivity_state_t;
+
+// Result of a connection attempt started by applyCredentials()
+typedef std::function<void(bool connected)> ConnectCallback;
+
+// WiFi, NTP and mDNS without blocking the main loop. WiFi and SNTP report through their
+// event callbacks, which only record what happened; loop() acts on it and checks the
+// deadlines of the current state, so each call returns in well under a millisecond.
+// mDNS is restarted from a short-lived task because MDNS.begin() waits on the network
+// stack.
+class ConnectivityManager
+{
+   private:
+    connectivity_state_t state;
+    unsigned long        stateSince;  // timeBase.nowMs() when the state was entered
+    unsigned long        timeoutMs;   // How long CONNECTING may take before it fails
+    bool                 newCredentials;
+    ConnectCallback      connectCallback;
+    bool                 ntpStarted;
+
+    // Set from the WiFi event and SNTP tasks, consumed by loop()
+    portMUX_TYPE  eventLock;
+    bool          gotIp;
+    bool          lostConnection;
+    uint8_t       disconnectReason;
+    volatile bool timeSynced;
+    volatile bool mdnsBusy;
+
+    uint32_t      connects;
+    uint32_t      disconnects;
+    uint32_t      ntpSyncs;
+    unsigned long lastNtpSyncMs;
+
+    ConnectivityManager();
+
+    // Delete copy constructor and assignment operator
+    ConnectivityManager(const ConnectivityManager &)            = delete;
+    ConnectivityManager &operator=(const ConnectivityManager &) = delete;
+
+    void enterState(connectivity_state_t next);
+    void startAccessPoint();
+    void startStation(unsigned long timeout);
+    void handleConnected();
+    void handleConnectFailed();
+    void finishAttempt(bool connected);
+    void restartMdns(bool enable);
+
+    static void onWifiEvent(arduino_event_id_t event, arduino_event_info_t info);
+    static void onTimeSync(struct timeval *tv);
+    static void mdnsTask(void *param);
+
+   public:
+    // Singleton access method
+    static ConnectivityManager &getInstance();
+
+    // Register the event handlers and start in AP or station mode per the settings
+    void begin();
+    // Act on events and deadlines; call from the main loop
+    void loop();
+
+    // Tear down and reconnect with the saved settings. done, if given, is called from
+    // loop() once the station connects or the attempt times out (false right away when
+    // switching to AP mode).
+    void applyCredentials(ConnectCallback done = nullptr);
+
+    bool                 isConnected();
+    bool                 isNtpStarted();
+    connectivity_state_t getState();
+    const char          *getStateName();
+
+    void reportStats(JsonObject out);
+};
+
+// Convenience macro for easier access
+#define connectivityManager ConnectivityManager::getInstance()
+
+#endif  // CONNECTIVITY_MANAGER_H
@@ -1,10 +1,17 @@
 #include "ElegooCC.h"
 
 #include <ArduinoJson.h>
+#include <esp_rom_crc.h>
+#include <esp_timer.h>
 
+#include "BootTimeline.h"
+#include "JobScheduler.h"
 #include "Logger.h"
 #include "SettingsManager.h"
 #include "PauseAttemptData.h"
+#include "PrintJobIndex.h"
+#include "TimeBase.h"
+#include "Trace.h"
 
 #define ACK_TIMEOUT_MS 5000
 
@@ -14,6 +21,47 @@ extern unsigned long getTime();
 // External pause attempt data (from main.cpp)
 extern PauseAttemptData* pauseAttemptData;
 
+#define RESUME_SNAPSHOT_MAGIC 0x43435231  // "CCR1"; change it when the layout changes
+
+// What detection and pause verification need to carry on after a software, watchdog or
+// panic reset. Times are timeBase.nowMs() values from the previous boot.
+typedef struct
+{
+    uint32_t magic;
+    uint32_t savedAtMs;  // When written; restored times keep their age relative to it
+    char     mainboardID[48];
+    int32_t  printStatus;
+    uint8_t  machineStatusMask;
+    bool     filamentStopped;
+    bool     pauseCommandSent;
+    bool     testMovementStopActive;
+    int32_t  lastMovementValue;
+    int32_t  pauseRetryCount;
+    float    currentZ;
+    uint32_t startedAt;
+    uint32_t lastChangeTime;
+    uint32_t pauseCommandSentTime;
+    uint32_t pauseSequenceStartTime;
+    uint32_t testMovementStopStartTime;
+    uint32_t crc;  // CRC32 of everything above
+} resume_snapshot_t;
+
+// Left alone by the startup code, so it survives every reset but a power cycle, which
+// leaves garbage that fails the CRC
+RTC_NOINIT_ATTR static resume_snapshot_t resumeSnapshot;
+
+static uint32_t snapshotCrc(const resume_snapshot_t &snapshot)
+{
+    return esp_rom_crc32_le(0, (const uint8_t *) &snapshot, offsetof(resume_snapshot_t, crc));
+}
+
+// A time from the previous boot, moved so that its age carries on from boot: now - result
+// is its age when the snapshot was written plus the time since boot. 0 stays "not set".
+static unsigned long shiftSnapshotTime(uint32_t time, uint32_t savedAtMs)
+{
+    return time == 0 ? 0 : (unsigned long) (time - savedAtMs);
+}
+
 ElegooCC &ElegooCC::getInstance()
 {
     static ElegooCC instance;
@@ -25,6 +73,9 @@ ElegooCC::ElegooCC()
     lastMovementValue = -1;
     lastChangeTime    = 0;
 
+    settingsManager.getSnapshot(settings);
+    settingsGeneration = settings.generation;
+
     mainboardID       = "";
     printStatus       = SDCP_PRINT_STATUS_IDLE;
     machineStatusMask = 0;  // No statuses active initially
@@ -36,21 +87,35 @@ ElegooCC::ElegooCC()
     PrintSpeedPct     = 0;
     filamentStopped   = false;
     filamentRunout    = false;
-    lastPing          = 0;
+    statusVersion     = 0;
+    statusFingerprint = 0;
 
     waitingForAck       = false;
     pendingAckCommand   = -1;
     pendingAckRequestId = "";
     ackWaitStartTime    = 0;
 
+    rttRequestId = "";
+    rttSentUs    = 0;
+    memset(&stats, 0, sizeof(stats));
+    webSocketWasConnected = false;
+    startedAt             = 0;
+    currentZ              = 0;
+
     pauseCommandSent     = false;
-    pauseCommandSentTime = 0;
-    pauseRetryCount      = 0;
+    pauseCommandSentTime   = 0;
+    pauseSequenceStartTime = 0;
+    pauseRetryCount        = 0;
 
     // Initialize test movement stop simulation
     testMovementStopActive = false;
     testMovementStopStartTime = 0;
 
+    resumePending     = false;
+    lastSnapshotCrc   = 0;
+    lastSnapshotMs    = 0;
+    restoreResumeSnapshot();
+
     // TODO: send a UDP broadcast, M99999 on Port 30000, maybe using AsyncUDP.h and listen for the
     // result. this will give us the printer IP address.
 
@@ -66,14 +131,37 @@ void ElegooCC::setup()
     {
         connect();
     }
+    jobScheduler.schedulePeriodic("printer_ping", CARBON_CENTAURI_PING_INTERVAL_MS,
+                                  JOB_PRIORITY_NORMAL, [this]() { sendPing(); },
+                                  CARBON_CENTAURI_PING_INTERVAL_MS);
+}
+
+void ElegooCC::sendPing()
+{
+    if (!webSocket.isConnected())
+    {
+        return;
+    }
+    logger.log("Sending Ping");
+    // For all who venture to this line of code wondering why I didn't use sendPing(), it's
+    // because for some reason that doesn't work. but this does!
+    webSocket.sendTXT("ping");
 }
 
 void ElegooCC::webSocketEvent(WStype_t type, uint8_t *payload, size_t length)
 {
+    TRACE_SPAN("webSocketEvent");
     switch (type)
     {
         case WStype_DISCONNECTED:
             logger.log("Disconnected from Carbon Centauri");
+            // The library reports every failed connection attempt as a disconnect too
+            if (webSocketWasConnected)
+            {
+                stats.disconnects++;
+                webSocketWasConnected = false;
+            }
+            rttRequestId = "";
             // Reset acknowledgment state on disconnect
             waitingForAck       = false;
             pendingAckCommand   = -1;
@@ -84,6 +172,9 @@ void ElegooCC::webSocketEvent(WStype_t type, uint8_t *payload, size_t length)
             break;
         case WStype_CONNECTED:
             logger.log("Connected to Carbon Centauri");
+            bootTimeline.mark(BOOT_PHASE_PRINTER_CONNECTED);
+            stats.connects++;
+            webSocketWasConnected = true;
             sendCommand(SDCP_COMMAND_STATUS);
 
             break;
@@ -140,6 +231,16 @@ void ElegooCC::handleCommandResponse(JsonDocument &doc)
         logger.logf("Command %d acknowledged (Ack: %d) for request %s", cmd, ack,
                     requestId.c_str());
 
+        if (!rttRequestId.isEmpty() && requestId == rttRequestId)
+        {
+            uint32_t rttUs  = (uint32_t) (esp_timer_get_time() - rttSentUs);
+            stats.lastRttUs = rttUs;
+            stats.rttSumUs += rttUs;
+            stats.rttMaxUs = max(stats.rttMaxUs, rttUs);
+            stats.responses++;
+            rttRequestId = "";
+        }
+
         // Check if this is the acknowledgment we're waiting for
         if (waitingForAck && cmd == pendingAckCommand && requestId == pendingAckRequestId)
         {
@@ -161,11 +262,17 @@ void ElegooCC::handleCommandResponse(JsonDocument &doc)
 
 void ElegooCC::handleStatus(JsonDocument &doc)
 {
+    TRACE_SPAN("handleStatus");
     JsonObject status      = doc["Status"];
     String     mainboardId = doc["MainboardID"];
 
     logger.log("Received status update:");
 
+    if (resumePending)
+    {
+        confirmResumeSnapshot(mainboardId);
+    }
+
     // Parse current status (which contains machine status array)
     if (status.containsKey("CurrentStatus"))
     {
@@ -206,7 +313,7 @@ void ElegooCC::handleStatus(JsonDocument &doc)
             if (newStatus == SDCP_PRINT_STATUS_PRINTING)
             {
                 logger.log("Print status changed to printing");
-                startedAt = millis();
+                startedAt = timeBase.nowMs();
                 // Reset pause state when print starts/resumes
                 resetPauseState();
             }
@@ -224,6 +331,20 @@ void ElegooCC::handleStatus(JsonDocument &doc)
         currentTicks  = printInfo["CurrentTicks"];
         totalTicks    = printInfo["TotalTicks"];
         PrintSpeedPct = printInfo["PrintSpeedPct"];
+
+        // Jobs follow whether the printer reports one in progress rather than the status edge,
+        // so a job restored from flash after a reboot carries on
+        bool jobStatus = isJobStatus(printStatus);
+        if (jobStatus && !printJobIndex.isJobActive())
+        {
+            printJobIndex.startJob(mainboardId.isEmpty() ? mainboardID : mainboardId, totalLayer,
+                                   totalTicks);
+        }
+        else if (!jobStatus && printJobIndex.isJobActive())
+        {
+            printJobIndex.endJob(printStatus);
+        }
+        printJobIndex.updateProgress(currentLayer, totalLayer, currentTicks, totalTicks);
     }
 
     // Store mainboard ID if we don't have it yet (I'm unsure if we actually need this)
@@ -236,6 +357,7 @@ void ElegooCC::handleStatus(JsonDocument &doc)
 
 void ElegooCC::pausePrint()
 {
+    TRACE_SPAN("pausePrint");
     // Check if printer is already in a paused or idle state
     if (printStatus == SDCP_PRINT_STATUS_PAUSED || 
         printStatus == SDCP_PRINT_STATUS_PAUSING ||
@@ -252,16 +374,21 @@ void ElegooCC::pausePrint()
     
     // Reset retry counter for new pause attempt
     pauseRetryCount = 0;
+    if (pauseSequenceStartTime == 0)
+    {
+        pauseSequenceStartTime = timeBase.nowMs();
+    }
     
     // Track initial pause attempt
     if (pauseAttemptData) {
         pauseAttemptData->addAttempt(PAUSE_ATTEMPT_INITIAL, pauseRetryCount, printStatus);
     }
+    printJobIndex.recordPauseAttempt(PAUSE_ATTEMPT_INITIAL, 0);
     
     sendCommand(SDCP_COMMAND_PAUSE_PRINT, true);
     // Set pause verification state
     pauseCommandSent = true;
-    pauseCommandSentTime = millis();
+    pauseCommandSentTime = timeBase.nowMs();
     logger.logf("Pause command sent, retry count reset to: %d", pauseRetryCount);
 }
 
@@ -272,6 +399,7 @@ void ElegooCC::continuePrint()
 
 void ElegooCC::sendCommand(int command, bool waitForAck)
 {
+    TRACE_SPAN("sendCommand");
     if (!webSocket.isConnected())
     {
         logger.logf("Can't send command, websocket not connected: %d", command);
@@ -311,11 +439,14 @@ void ElegooCC::sendCommand(int command, bool waitForAck)
         waitingForAck       = true;
         pendingAckCommand   = command;
         pendingAckRequestId = uuidStr;
-        ackWaitStartTime    = millis();
+        ackWaitStartTime    = timeBase.nowMs();
         logger.logf("Waiting for acknowledgment for command %d with request ID %s", command,
                     uuidStr.c_str());
     }
 
+    rttRequestId = uuidStr;
+    rttSentUs    = esp_timer_get_time();
+    stats.commandsSent++;
     webSocket.sendTXT(jsonPayload);
 }
 
@@ -326,17 +457,29 @@ void ElegooCC::connect()
         webSocket.disconnect();
     }
     webSocket.setReconnectInterval(3000);
-    ipAddress = settingsManager.getElegooIP();
+    refreshSettings();
+    ipAddress = settings.elegooip;
     logger.logf("Attempting connection to Elegoo CC @ %s", ipAddress.c_str());
     webSocket.begin(ipAddress, CARBON_CENTAURI_PORT, "/websocket");
 }
 
+void ElegooCC::refreshSettings()
+{
+    if (settingsManager.getGeneration() != settingsGeneration)
+    {
+        settingsManager.getSnapshot(settings);
+        settingsGeneration = settings.generation;
+    }
+}
+
 void ElegooCC::loop()
 {
-    unsigned long currentTime = millis();
+    unsigned long currentTime = timeBase.nowMs();
+
+    refreshSettings();
 
     // websocket IP changed, reconnect
-    if (ipAddress != settingsManager.getElegooIP())
+    if (ipAddress != settings.elegooip)
     {
         connect();  // this will reconnnect if already connected
     }
@@ -354,14 +497,6 @@ void ElegooCC::loop()
             pendingAckRequestId = "";
             ackWaitStartTime    = 0;
         }
-        else if (currentTime - lastPing > 29900)
-        {
-            logger.log("Sending Ping");
-            // For all who venture to this line of code wondering why I didn't use sendPing(), it's
-            // because for some reason that doesn't work. but this does!
-            this->webSocket.sendTXT("ping");
-            lastPing = currentTime;
-        }
     }
 
     // Before determining if we should pause, check if the filament is moving or it ran out
@@ -372,14 +507,21 @@ void ElegooCC::loop()
     checkPauseVerification(currentTime);
 
     // Check if we should pause the print (only when there's a pause condition)
-    bool pauseCondition = (filamentRunout && settingsManager.getPauseOnRunout()) || filamentStopped;
+    bool pauseCondition = (filamentRunout && settings.pause_on_runout) || filamentStopped;
     if (pauseCondition && shouldPausePrint(currentTime))
     {
         logger.log("Pausing print, detected filament runout or stopped");
         pausePrint();
     }
+    if (webSocket.isConnected())
+    {
+        // End of the boot critical path: sensors are being acted on
+        bootTimeline.mark(BOOT_PHASE_DETECTION);
+    }
 
     webSocket.loop();
+    updateStatusVersion();
+    saveResumeSnapshot(currentTime);
 }
 
 void ElegooCC::checkFilamentRunout(unsigned long currentTime)
@@ -389,12 +531,18 @@ void ElegooCC::checkFilamentRunout(unsigned long currentTime)
     if (newFilamentRunout != filamentRunout)
     {
         logger.log(filamentRunout ? "Filament has run out" : "Filament has been detected");
+        if (newFilamentRunout)
+        {
+            stats.runouts++;
+            printJobIndex.recordRunout();
+        }
     }
     filamentRunout = newFilamentRunout;
 }
 
 void ElegooCC::checkFilamentMovement(unsigned long currentTime)
 {
+    TRACE_SPAN("checkFilamentMovement");
     // Check if test movement stop is active (10 minutes = 600,000ms)
     if (testMovementStopActive)
     {
@@ -420,7 +568,7 @@ void ElegooCC::checkFilamentMovement(unsigned long currentTime)
     // CurrentLayer is unreliable when using Orcaslicer 2.3.0, because it is missing some g-code,so
     // we use Z instead. , assuming first layer is at Z offset <  0.1
     int movementTimeout =
-        currentZ < 0.1 ? settingsManager.getFirstLayerTimeout() : settingsManager.getTimeout();
+        currentZ < 0.1 ? settings.first_layer_timeout : settings.timeout;
 
     // Debug logging every movement timeout interval to help troubleshoot movement sensor
     static unsigned long lastDebugTime = 0;
@@ -437,7 +585,10 @@ void ElegooCC::checkFilamentMovement(unsigned long currentTime)
         if (filamentStopped)
         {
             logger.log("Filament movement started");
+            printJobIndex.recordStallEnd(currentTime);
         }
+        printJobIndex.recordMovementPulse();
+        stats.movementEdges++;
         // Value changed, reset timer and flag
         lastMovementValue = currentMovementValue;
         lastChangeTime    = currentTime;
@@ -451,6 +602,8 @@ void ElegooCC::checkFilamentMovement(unsigned long currentTime)
             logger.logf("Filament movement stopped, last movement detected %dms ago",
                         currentTime - lastChangeTime);
             filamentStopped = true;  // Prevent repeated printing
+            stats.stalls++;
+            printJobIndex.recordStallStart(currentTime);
         }
     }
 }
@@ -458,12 +611,18 @@ void ElegooCC::checkFilamentMovement(unsigned long currentTime)
 bool ElegooCC::shouldPausePrint(unsigned long currentTime)
 {
     // If pause function is completely disabled, always return false
-    if (!settingsManager.getEnabled())
+    if (!settings.enabled)
+    {
+        return false;
+    }
+
+    // Restored state from before a reset isn't acted on until the printer confirms it
+    if (resumePending)
     {
         return false;
     }
 
-    if (filamentRunout && !settingsManager.getPauseOnRunout())
+    if (filamentRunout && !settings.pause_on_runout)
     {
         // if pause on runout is disabled, and filament ran out, skip checking everything else
         // this should let the carbon take care of itself
@@ -481,7 +640,7 @@ bool ElegooCC::shouldPausePrint(unsigned long currentTime)
     // TODO: also add a buffer after pause because sometimes an ack comes before the update
     
     // Debug logging to identify why pause might be blocked
-    bool startTimeoutMet = (currentTime - startedAt) >= settingsManager.getStartPrintTimeout();
+    bool startTimeoutMet = (currentTime - startedAt) >= settings.start_print_timeout;
     bool websocketConnected = webSocket.isConnected();
     bool notWaitingForAck = !waitingForAck;
     bool printerIsPrinting = isPrinting();
@@ -499,7 +658,7 @@ bool ElegooCC::shouldPausePrint(unsigned long currentTime)
     // log why we paused...
     logger.logf("Pause condition: %d", pauseCondition);
     logger.logf("Filament runout: %d", filamentRunout);
-    logger.logf("Filament runout pause enabled: %d", settingsManager.getPauseOnRunout());
+    logger.logf("Filament runout pause enabled: %d", settings.pause_on_runout);
     logger.logf("Filament stopped: %d", filamentStopped);
     logger.logf("Time since print start %d", currentTime - startedAt);
     logger.logf("Is Machine status printing?: %d", hasMachineStatus(SDCP_MACHINE_STATUS_PRINTING));
@@ -511,7 +670,7 @@ bool ElegooCC::shouldPausePrint(unsigned long currentTime)
 void ElegooCC::triggerTestMovementStop()
 {
     testMovementStopActive = true;
-    testMovementStopStartTime = millis();
+    testMovementStopStartTime = timeBase.nowMs();
     logger.log("Test movement stop activated - simulating filament stopped for 10 minutes");
 }
 
@@ -530,6 +689,13 @@ bool ElegooCC::isPrinting()
     return isActivePrintStatus && hasMachineStatus(SDCP_MACHINE_STATUS_PRINTING);
 }
 
+bool ElegooCC::isJobStatus(sdcp_print_status_t status)
+{
+    // Anything but idle or a finished job belongs to a print job, including paused
+    return status != SDCP_PRINT_STATUS_IDLE && status != SDCP_PRINT_STATUS_STOPED &&
+           status != SDCP_PRINT_STATUS_COMPLETE;
+}
+
 // Helper methods for machine status bitmask
 bool ElegooCC::hasMachineStatus(sdcp_machine_status_t status)
 {
@@ -571,6 +737,55 @@ printer_info_t ElegooCC::getCurrentInformation()
     return info;
 }
 
+elegoo_stats_t ElegooCC::getStats()
+{
+    return stats;
+}
+
+static uint32_t fingerprint(uint32_t hash, const void *data, size_t length)
+{
+    // FNV-1a
+    const uint8_t *bytes = (const uint8_t *) data;
+    for (size_t i = 0; i < length; i++)
+    {
+        hash = (hash ^ bytes[i]) * 16777619UL;
+    }
+    return hash;
+}
+
+void ElegooCC::updateStatusVersion()
+{
+    // Hashing the fields is cheaper than tracking every place that assigns them
+    bool     connected = webSocket.isConnected();
+    bool     printing  = isPrinting();
+    uint32_t hash      = 2166136261UL;
+    hash = fingerprint(hash, mainboardID.c_str(), mainboardID.length());
+    hash = fingerprint(hash, &printStatus, sizeof(printStatus));
+    hash = fingerprint(hash, &filamentStopped, sizeof(filamentStopped));
+    hash = fingerprint(hash, &filamentRunout, sizeof(filamentRunout));
+    hash = fingerprint(hash, &currentLayer, sizeof(currentLayer));
+    hash = fingerprint(hash, &totalLayer, sizeof(totalLayer));
+    hash = fingerprint(hash, &progress, sizeof(progress));
+    hash = fingerprint(hash, &currentTicks, sizeof(currentTicks));
+    hash = fingerprint(hash, &totalTicks, sizeof(totalTicks));
+    hash = fingerprint(hash, &PrintSpeedPct, sizeof(PrintSpeedPct));
+    hash = fingerprint(hash, &currentZ, sizeof(currentZ));
+    hash = fingerprint(hash, &connected, sizeof(connected));
+    hash = fingerprint(hash, &printing, sizeof(printing));
+    hash = fingerprint(hash, &waitingForAck, sizeof(waitingForAck));
+
+    if (hash != statusFingerprint)
+    {
+        statusFingerprint = hash;
+        statusVersion++;
+    }
+}
+
+uint32_t ElegooCC::getStatusVersion()
+{
+    return statusVersion;
+}
+
 void ElegooCC::checkPauseVerification(unsigned long currentTime)
 {
     if (!pauseCommandSent)
@@ -578,6 +793,12 @@ void ElegooCC::checkPauseVerification(unsigned long currentTime)
         return; // No pause command pending verification
     }
 
+    // A restored pause is only verified against a status from the printer it was sent to
+    if (resumePending)
+    {
+        return;
+    }
+
     // Check if printer has successfully paused
     // Accept PAUSED, PAUSING, or IDLE as successful pause states
     if (printStatus == SDCP_PRINT_STATUS_PAUSED || 
@@ -590,20 +811,22 @@ void ElegooCC::checkPauseVerification(unsigned long currentTime)
         if (pauseAttemptData) {
             pauseAttemptData->addAttempt(PAUSE_ATTEMPT_SUCCESS, pauseRetryCount, printStatus);
         }
+        printJobIndex.recordPauseAttempt(PAUSE_ATTEMPT_SUCCESS,
+                                         currentTime - pauseSequenceStartTime);
         
         resetPauseState();
         return;
     }
 
     // Check if pause verification has timed out
-    if (currentTime - pauseCommandSentTime >= settingsManager.getPauseVerificationTimeoutMs())
+    if (currentTime - pauseCommandSentTime >= settings.pause_verification_timeout_ms)
     {
         logger.logf("Pause verification timeout - printer still in status: %d", printStatus);
         
-        if (pauseRetryCount < settingsManager.getMaxPauseRetries())
+        if (pauseRetryCount < settings.max_pause_retries)
         {
             pauseRetryCount++;
-            logger.logf("Retrying pause command (attempt %d/%d)", pauseRetryCount, settingsManager.getMaxPauseRetries());
+            logger.logf("Retrying pause command (attempt %d/%d)", pauseRetryCount, settings.max_pause_retries);
             
             // Track retry attempt
             if (pauseAttemptData) {
@@ -617,7 +840,7 @@ void ElegooCC::checkPauseVerification(unsigned long currentTime)
         }
         else
         {
-            logger.logf("Max pause retries (%d) exceeded, giving up", settingsManager.getMaxPauseRetries());
+            logger.logf("Max pause retries (%d) exceeded, giving up", settings.max_pause_retries);
             
             // Track max retries exceeded
             if (pauseAttemptData) {
@@ -633,6 +856,7 @@ void ElegooCC::resetPauseState()
 {
     pauseCommandSent = false;
     pauseCommandSentTime = 0;
+    pauseSequenceStartTime = 0;
     pauseRetryCount = 0;
     logger.log("Pause verification state reset");
 }
@@ -640,4 +864,99 @@ void ElegooCC::resetPauseState()
 bool ElegooCC::isPauseInProgress()
 {
     return pauseCommandSent;
-}
\ No newline at end of file
+}
+
+void ElegooCC::restoreResumeSnapshot()
+{
+    const resume_snapshot_t &snapshot = resumeSnapshot;
+    if (snapshot.magic != RESUME_SNAPSHOT_MAGIC || snapshot.crc != snapshotCrc(snapshot))
+    {
+        return;
+    }
+
+    uint32_t savedAtMs        = snapshot.savedAtMs;
+    mainboardID               = String(snapshot.mainboardID);
+    printStatus               = (sdcp_print_status_t) snapshot.printStatus;
+    machineStatusMask         = snapshot.machineStatusMask;
+    currentZ                  = snapshot.currentZ;
+    startedAt                 = shiftSnapshotTime(snapshot.startedAt, savedAtMs);
+    lastMovementValue         = snapshot.lastMovementValue;
+    // The sensor wasn't watched while the board was down, so that gap isn't a stall; the
+    // movement timeout starts over from boot
+    lastChangeTime            = timeBase.nowMs();
+    filamentStopped           = snapshot.filamentStopped;
+    pauseCommandSent          = snapshot.pauseCommandSent;
+    pauseRetryCount           = snapshot.pauseRetryCount;
+    pauseCommandSentTime      = shiftSnapshotTime(snapshot.pauseCommandSentTime, savedAtMs);
+    pauseSequenceStartTime    = shiftSnapshotTime(snapshot.pauseSequenceStartTime, savedAtMs);
+    testMovementStopActive    = snapshot.testMovementStopActive;
+    testMovementStopStartTime = shiftSnapshotTime(snapshot.testMovementStopStartTime, savedAtMs);
+    resumePending             = true;
+
+    logger.logf("Restored printer state from before reset (mainboard %s, status %d, %lus into print)",
+                mainboardID.c_str(), printStatus, (unsigned long) (savedAtMs - snapshot.startedAt) / 1000);
+}
+
+void ElegooCC::confirmResumeSnapshot(const String &frameMainboardID)
+{
+    resumePending = false;
+    if (!frameMainboardID.isEmpty() && frameMainboardID == mainboardID)
+    {
+        logger.log("Printer matches the restored state, resuming monitoring");
+        return;
+    }
+
+    // Another printer (or one that doesn't say): start from scratch as after a power cycle
+    logger.logf("Discarding restored state, mainboard is now %s", frameMainboardID.c_str());
+    mainboardID               = "";
+    printStatus               = SDCP_PRINT_STATUS_IDLE;
+    machineStatusMask         = 0;
+    currentZ                  = 0;
+    startedAt                 = 0;
+    lastMovementValue         = -1;
+    filamentStopped           = false;
+    testMovementStopActive    = false;
+    testMovementStopStartTime = 0;
+    resetPauseState();
+}
+
+void ElegooCC::saveResumeSnapshot(unsigned long currentTime)
+{
+    // The snapshot from before the reset stays until a status frame settles it
+    if (resumePending)
+    {
+        return;
+    }
+
+    resume_snapshot_t snapshot;
+    memset(&snapshot, 0, sizeof(snapshot));  // Padding included, for a stable CRC
+    snapshot.magic = RESUME_SNAPSHOT_MAGIC;
+    strlcpy(snapshot.mainboardID, mainboardID.c_str(), sizeof(snapshot.mainboardID));
+    snapshot.printStatus               = printStatus;
+    snapshot.machineStatusMask         = machineStatusMask;
+    snapshot.filamentStopped           = filamentStopped;
+    snapshot.pauseCommandSent          = pauseCommandSent;
+    snapshot.testMovementStopActive    = testMovementStopActive;
+    snapshot.lastMovementValue         = lastMovementValue;
+    snapshot.pauseRetryCount           = pauseRetryCount;
+    snapshot.currentZ                  = currentZ;
+    snapshot.startedAt                 = startedAt;
+    snapshot.lastChangeTime            = lastChangeTime;
+    snapshot.pauseCommandSentTime      = pauseCommandSentTime;
+    snapshot.pauseSequenceStartTime    = pauseSequenceStartTime;
+    snapshot.testMovementStopStartTime = testMovementStopStartTime;
+
+    // Written on every change, and refreshed while nothing changes so the ages restored
+    // after a reset are at most RESUME_SNAPSHOT_REFRESH_MS behind
+    uint32_t contentCrc = snapshotCrc(snapshot);
+    if (contentCrc == lastSnapshotCrc && currentTime - lastSnapshotMs < RESUME_SNAPSHOT_REFRESH_MS)
+    {
+        return;
+    }
+    lastSnapshotCrc = contentCrc;
+    lastSnapshotMs  = currentTime;
+
+    snapshot.savedAtMs = currentTime;
+    snapshot.crc       = snapshotCrc(snapshot);
+    resumeSnapshot     = snapshot;
+}
@@ -5,9 +5,12 @@
 #include <ArduinoJson.h>
 #include <WebSocketsClient.h>
 
+#include "SettingsManager.h"
 #include "UUID.h"
 
 #define CARBON_CENTAURI_PORT 3030
+#define CARBON_CENTAURI_PING_INTERVAL_MS 29900  // Under the printer's 30 s idle timeout
+#define RESUME_SNAPSHOT_REFRESH_MS 1000  // Unchanged snapshots are still rewritten this often
 
 // Pin definitions - can be overridden via build flags
 #ifndef FILAMENT_RUNOUT_PIN
@@ -91,6 +94,21 @@ typedef struct
     bool                waitingForAck;
 } printer_info_t;
 
+// Running totals since boot, for /metrics
+typedef struct
+{
+    uint32_t movementEdges;  // Movement sensor level changes
+    uint32_t stalls;         // Movement timeouts
+    uint32_t runouts;        // Runout switch going to "no filament"
+    uint32_t connects;
+    uint32_t disconnects;
+    uint32_t commandsSent;
+    uint32_t responses;  // Command responses matched to the request they answer
+    uint32_t lastRttUs;  // Command sent to its response arriving
+    uint64_t rttSumUs;
+    uint32_t rttMaxUs;
+} elegoo_stats_t;
+
 class ElegooCC
 {
    private:
@@ -99,7 +117,10 @@ class ElegooCC
 
     String ipAddress;
 
-    unsigned long lastPing;
+    // Settings as last published; re-fetched when the generation moves
+    settings_snapshot_t settings;
+    uint32_t            settingsGeneration;
+
     // Variables to track movement sensor state
     int           lastMovementValue;  // Initialize to invalid value
     unsigned long lastChangeTime;
@@ -118,6 +139,10 @@ class ElegooCC
     bool                filamentStopped;
     bool                filamentRunout;
 
+    // Bumped whenever anything getCurrentInformation() reports changes
+    uint32_t statusVersion;
+    uint32_t statusFingerprint;
+
     unsigned long startedAt;
 
     // Acknowledgment tracking
@@ -126,9 +151,24 @@ class ElegooCC
     String        pendingAckRequestId;
     unsigned long ackWaitStartTime;
 
+    // Round trip of the most recent command, matched on its request ID
+    String   rttRequestId;
+    uint64_t rttSentUs;
+
+    elegoo_stats_t stats;
+    bool           webSocketWasConnected;
+
+    // Detection and pause state carried across a reset in RTC memory. Restored state is
+    // only trusted once a status frame from the same mainboard arrives; until then no
+    // pause is sent.
+    bool          resumePending;
+    uint32_t      lastSnapshotCrc;  // Content last written, to skip unchanged writes
+    unsigned long lastSnapshotMs;
+
     // Pause verification tracking
     bool          pauseCommandSent;
     unsigned long pauseCommandSentTime;
+    unsigned long pauseSequenceStartTime;  // First attempt of the current pause, for latency
     int           pauseRetryCount;
 
     // Test movement stop simulation
@@ -143,6 +183,8 @@ class ElegooCC
 
     void webSocketEvent(WStype_t type, uint8_t *payload, size_t length);
     void connect();
+    void refreshSettings();
+    void sendPing();
     void handleCommandResponse(JsonDocument &doc);
     void handleStatus(JsonDocument &doc);
     void sendCommand(int command, bool waitForAck = false);
@@ -152,12 +194,17 @@ class ElegooCC
     bool hasMachineStatus(sdcp_machine_status_t status);
     void setMachineStatuses(const int *statusArray, int arraySize);
     bool isPrinting();
+    bool isJobStatus(sdcp_print_status_t status);
     bool shouldPausePrint(unsigned long currentTime);
     void checkFilamentMovement(unsigned long currentTime);
     void checkFilamentRunout(unsigned long currentTime);
     void checkPauseVerification(unsigned long currentTime);
     void resetPauseState();
     bool isPauseInProgress();
+    void updateStatusVersion();
+    void restoreResumeSnapshot();
+    void confirmResumeSnapshot(const String &frameMainboardID);
+    void saveResumeSnapshot(unsigned long currentTime);
 
    public:
     // Singleton access method
@@ -172,6 +219,8 @@ class ElegooCC
 
     // Get current printer information
     printer_info_t getCurrentInformation();
+    uint32_t       getStatusVersion();
+    elegoo_stats_t getStats();
 };
 
 // Convenience macro for easier access
@@ -0,0 +1,37 @@
+#include "EmbeddedAssets.h"
+
+#include "EmbeddedWebUI.h"
+
+// FNV-1a started from the seed the generator picked to give every embedded path its own
+// slot. Must match asset_hash() in generate_embedded_webui.py.
+static uint32_t assetHash(const char *path, size_t length)
+{
+    uint32_t hash = WEBUI_ASSET_HASH_SEED;
+    for (size_t i = 0; i < length; i++)
+    {
+        hash ^= (uint8_t) path[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+const embedded_asset_t *findEmbeddedAsset(const char *path, size_t length)
+{
+    int index = WEBUI_ASSET_SLOTS[assetHash(path, length) & WEBUI_ASSET_SLOT_MASK];
+    if (index < 0)
+    {
+        return nullptr;
+    }
+    // Paths that aren't embedded still hash to some slot
+    const embedded_asset_t &asset = WEBUI_ASSETS[index];
+    if (strncmp(asset.path, path, length) != 0 || asset.path[length] != '\0')
+    {
+        return nullptr;
+    }
+    return &asset;
+}
+
+const embedded_asset_t *getEmbeddedIndex()
+{
+    return WEBUI_INDEX_ASSET >= 0 ? &WEBUI_ASSETS[WEBUI_INDEX_ASSET] : nullptr;
+}
@@ -0,0 +1,26 @@
+#ifndef EMBEDDED_ASSETS_H
+#define EMBEDDED_ASSETS_H
+
+#include <Arduino.h>
+
+// One file of the built web UI, compiled into flash by generate_embedded_webui.py. Every
+// file in webui/dist gets an entry, so the UI can be split into chunks that load on demand.
+typedef struct
+{
+    const char    *path;  // As requested, e.g. "/assets/index-zntHLvnE.js"
+    const char    *mimeType;
+    const uint8_t *data;  // PROGMEM
+    size_t         length;
+    bool           gzipped;    // data is gzip; sent with Content-Encoding: gzip
+    bool           immutable;  // Name carries a content hash, so it can be cached forever
+    const char    *etag;       // Quoted content hash of the uncompressed file
+} embedded_asset_t;
+
+// Look path up through the generated perfect hash: one hash, one probe and one compare.
+// Returns nullptr for paths that aren't embedded.
+const embedded_asset_t *findEmbeddedAsset(const char *path, size_t length);
+
+// index.html, served for client-side routes; nullptr if the build had none
+const embedded_asset_t *getEmbeddedIndex();
+
+#endif  // EMBEDDED_ASSETS_H
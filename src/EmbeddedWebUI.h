@@ -1,33 +1,38 @@
 #ifndef EMBEDDED_WEBUI_H
 #define EMBEDDED_WEBUI_H
 
-#include <Arduino.h>
+// Generated by generate_embedded_webui.py from webui/dist; don't edit by hand.
+// Only src/EmbeddedAssets.cpp includes it.
 
+#include "EmbeddedAssets.h"
 
-// Auto-generated from index.html
-const uint8_t webui_index_html_gz[] PROGMEM = {
-    0x1f, 0x8b, 0x08, 0x00, 0x4e, 0x90, 0x12, 0x69, 0x02, 0xff, 0x5d, 0x91, 0xcb, 0x4e, 0x03, 0x31, 0x0c, 0x45, 0xf7, 0xfd, 0x0a, 0x93, 0x35, 0xf3, 0x80, 0x15, 0x8b, 0xc9, 0x48, 0x3c, 0x5a, 0x58, 0x20, 0x81, 0xd4, 0x41, 0x82, 0x65, 0x48, 0xcc, 0xc4, 0x25, 0x93, 0x54, 0x89, 0x99, 0xb6, 0x7c, 0x3d, 0x69, 0xa7, 0x88, 0xc7, 0x2a, 0xb6, 0x72, 0x72, 0xae, 0xe5, 0x34, 0x27, 0x37, 0x0f, 0xd7, 0xdd, 0xcb, 0xe3, 0x1c, 0x2c, 0x0f, 0xae, 0x9d, 0x35, 0xfb, 0x03, 0x9c, 0xf2, 0xbd, 0x14, 0xe8, 0x45, 0x3b, 0x03, 0x68, 0x2c, 0x2a, 0xb3, 0x2f, 0x72, 0x39, 0x20, 0x2b, 0xd0, 0x56, 0xc5, 0x84, 0x2c, 0xc5, 0x53, 0xb7, 0x28, 0x2e, 0x04, 0x54, 0xbf, 0x2f, 0xbd, 0x1a, 0x50, 0x8a, 0x91, 0x70, 0xb3, 0x0e, 0x91, 0x05, 0xe8, 0xe0, 0x19, 0x7d, 0x86, 0x37, 0x64, 0xd8, 0x4a, 0x83, 0x23, 0x69, 0x2c, 0x0e, 0xcd, 0x29, 0x90, 0x27, 0x26, 0xe5, 0x8a, 0xa4, 0x95, 0x43, 0x79, 0x56, 0xd6, 0x3f, 0x32, 0x26, 0x76, 0xd8, 0xce, 0x1d, 0xf6, 0x21, 0xc0, 0x33, 0x5c, 0x51, 0xdf, 0x45, 0xc4, 0x0e, 0xb5, 0x85, 0xe5, 0x62, 0x09, 0xe7, 0x65, 0xdd, 0x54, 0x13, 0x33, 0xf1, 0x49, 0x47, 0x5a, 0x33, 0xf0, 0x6e, 0x9d, 0xe3, 0x87, 0x60, 0x3e, 0x1c, 0xe6, 0xf0, 0x18, 0x52, 0x0a, 0x91, 0x7a, 0xf2, 0x90, 0xa2, 0x96, 0xa2, 0x52, 0x29, 0x4f, 0x9e, 0x2a, 0xf2, 0x06, 0xb7, 0xc5, 0xa7, 0xe7, 0xbb, 0xfb, 0xd1, 0xcf, 0xcb, 0x55, 0x12, 0x6d, 0x53, 0x4d, 0x8a, 0xa3, 0xcf, 0x91, 0x7f, 0x87, 0x88, 0x4e, 0x8a, 0xc4, 0x3b, 0x87, 0xc9, 0x22, 0xf2, 0x5f, 0xa1, 0x8d, 0xf8, 0xf6, 0xdf, 0x68, 0xb7, 0xee, 0xb2, 0xf6, 0xab, 0xdb, 0x52, 0xa7, 0x34, 0x2d, 0xaf, 0xfa, 0xde, 0x5e, 0xf3, 0x1a, 0xcc, 0xee, 0x28, 0x37, 0x34, 0x02, 0x19, 0x29, 0x62, 0x08, 0xbc, 0x4f, 0xce, 0xfd, 0x04, 0x4f, 0x4c, 0x7e, 0x74, 0xf8, 0x8c, 0x2f, 0xb7, 0x35, 0xad, 0x1f, 0x9d, 0x01, 0x00, 0x00
+// /assets/index-hxlA0njG.css, 58044 bytes, 9988 gzipped
+const uint8_t webui_asset_0[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xed, 0x7d, 0x5b, 0x92, 0xe3, 0x38, 0x92, 0xe0, 0xff, 0x9e, 0x82, 0x93, 0x65, 0x61, 0x11, 0xcc, 0x22, 0x19, 0x7c, 0xe8, 0x15, 0xd4, 0x64, 0x5a, 0xcf, 0x96, 0xcd, 0xd8, 0x8c, 0x59, 0x77, 0x8f, 0xd9, 0x76, 0xed, 0x9a, 0xcd, 0x66, 0xe7, 0x07, 0x25, 0x41, 0x12, 0x3b, 0x29, 0x52, 0x4b, 0x52, 0x19, 0x11, 0xa5, 0xd5, 0x15, 0xf6, 0x6b, 0x3f, 0xf7, 0x20, 0x73, 0x9e, 0xb9, 0xc0, 0x5c, 0x61, 0xdd, 0xf1, 0x20, 0x01, 0x12, 0xa4, 0xa8, 0x78, 0x64, 0x65, 0x75, 0x47, 0xb7, 0x55, 0x86, 0x08, 0x38, 0x1c, 0x0e, 0x07, 0xe0, 0x70, 0xb8, 0x3b, 0x80, 0xdb, 0xf7, 0x7f, 0x67, 0x94, 0x51, 0x9c, 0xdc, 0xc7, 0xe9, 0x6a, 0x59, 0x14, 0xc6, 0xd7, 0x91, 0xe3, 0x39, 0x9e, 0x6b, 0xfc, 0x6f, 0xe3, 0x0f, 0xff, 0xf2, 0xb3, 0xf1, 0xfb, 0x78, 0x49, 0xd2, 0x82, 0xc0, 0xd7, 0xb6, 0x2c, 0xf7, 0x45, 0x78, 0x7b, 0x2b, 0xc1, 0x3a, 0xcb, 0x6c, 0x67, 0xbc, 0xbf, 0xfd, 0x5d, 0x12, 0x3d, 0x92, 0xdc, 0xd8, 0xe7, 0xd9, 0x9e, 0xe4, 0x65, 0x4c, 0x8a, 0xe3, 0xef, 0x8a, 0xc3, 0x7e, 0x9f, 0xe5, 0x65, 0x61, 0xdc, 0xdc, 0xdc, 0xd8, 0xf7, 0x64, 0xf1, 0x25, 0x2e, 0xed, 0xed, 0xe3, 0x7e, 0x0b, 0xb8, 0xc2, 0x34, 0x4b, 0x89, 0x69, 0x1a, 0x51, 0xba, 0x32, 0x6e, 0xd2, 0xac, 0x34, 0x6e, 0x76, 0x51, 0xbe, 0x89, 0x53, 0xbb, 0xcc, 0xe3, 0x5d, 0x18, 0xa7, 0x49, 0x8c, 0xd9, 0xa6, 0x91, 0xe5, 0x50, 0xd8, 0xde, 0x65, 0xbf, 0xd8, 0x59, 0x1e, 0x93, 0xb4, 0x14, 0x59, 0x52, 0xc1, 0x65, 0x96, 0x64, 0x79, 0x98, 0x6f, 0x16, 0x37, 0xeb, 0x1c, 0x28, 0xc9, 0xc9, 0xca, 0xc8, 0x8d, 0x8d, 0xb1, 0x80, 0xe2, 0xe6, 0xf1, 0xbd, 0x15, 0x2e, 0xc8, 0x3a, 0xcb, 0x89, 0x15, 0x46, 0xeb, 0x92, 0xe4, 0x56, 0x18, 0x2e, 0xa2, 0xe5, 0x97, 0x15, 0x50, 0x79, 0xb4, 0xed, 0xf2, 0xde, 0x2e, 0xf6, 0xd1, 0x92, 0xd8, 0x8f, 0x76, 0x4e, 0xbe, 0x92, 0xbc, 0x20, 0xa1, 0x3b, 0xa7, 0xc9, 0x8b, 0x2c, 0x5f, 0x91, 0xdc, 0x2e, 0xca, 0xc7, 0x84, 0x84, 0x45, 0x96, 0xc4, 0x2b, 0x96, 0xbe, 0xce, 0xd2, 0x12, 0x9a, 0x12, 0x6f, 0xb6, 0x48, 0x4a, 0x5c, 0xc6, 0x51, 0xc2, 0x32, 0x8a, 0x6d, 0xb4, 0xca, 0xee, 0x43, 0xd7, 0x70, 0x8d, 0x1f, 0x5c, 0xf8, 0x9f, 0x9c, 0x6a, 0x33, 0x12, 0x35, 0xf0, 0x76, 0x94, 0xec, 0xb7, 0x51, 0xe8, 0xb9, 0xee, 0x15, 0x4b, 0x8e, 0x81, 0xcd, 0x65, 0x07, 0x32, 0x39, 0x4f, 0x87, 0x52, 0xc9, 0x6f, 0x22, 0xce, 0xe3, 0x74, 0xa3, 0x2b, 0x44, 0xd3, 0xfb, 0xea, 0xeb, 0x2a, 0x28, 0xe5, 0xea, 0x8b, 0xd3, 0x2c, 0x0a, 0xa5, 0xa9, 0x31, 0x5b, 0xaf, 0xb1, 0xf8, 0x7d, 0xbc, 0x2a, 0xb7, 0xa1, 0xbb, 0x7f, 0x68, 0x67, 0xb1, 0x2a, 0x7f, 0x58, 0xaf, 0xd7, 0xed, 0xbc, 0x66, 0x85, 0xa7, 0xd3, 0x89, 0x0f, 0xbf, 0x72, 0x4b, 0x76, 0xe4, 0x18, 0xe6, 0x59, 0x56, 0x5a, 0xe1, 0x36, 0x2b, 0x4a, 0xe8, 0x65, 0xda, 0x67, 0x45, 0x04, 0x83, 0xee, 0x10, 0xd3, 0xbf, 0x76, 0x41, 0xf2, 0x78, 0x6d, 0x15, 0x8f, 0x45, 0x49, 0x76, 0xf6, 0x21, 0xb6, 0xa4, 0xc4, 0x77, 0xff, 0xb0, 0xdf, 0x27, 0xc4, 0xf8, 0x09, 0x6b, 0x37, 0xfe, 0x71, 0x97, 0xfd, 0x25, 0x7e, 0x67, 0xbd, 0xfb, 0x13, 0xd9, 0x64, 0xc4, 0xf8, 0xef, 0xff, 0xd2, 0x4e, 0xf8, 0xd3, 0xe3, 0x6e, 0x91, 0x25, 0x90, 0xf2, 0xc7, 0xac, 0xcc, 0x94, 0x52, 0x73, 0x5e, 0xf1, 0x2e, 0x4b, 0x33, 0xac, 0x18, 0xff, 0xd2, 0xc1, 0x66, 0xfd, 0xe9, 0x9f, 0xfe, 0x00, 0xbf, 0xed, 0xff, 0x46, 0x36, 0x87, 0x24, 0xca, 0xad, 0x3f, 0x90, 0x34, 0xc9, 0x2c, 0x48, 0x8a, 0x96, 0x99, 0xf5, 0x53, 0x96, 0xc2, 0x68, 0x8b, 0x0a, 0xeb, 0xdd, 0xef, 0xe3, 0x05, 0xc9, 0xa3, 0x32, 0xce, 0x52, 0x03, 0xc1, 0xa1, 0x8a, 0x9f, 0xb2, 0x03, 0xcc, 0x81, 0xdc, 0xf8, 0x23, 0xb9, 0x7f, 0x67, 0x55, 0xe8, 0xa0, 0x1e, 0xca, 0x2a, 0x7b, 0x93, 0x13, 0x92, 0xda, 0x23, 0xd7, 0x0d, 0xb3, 0x2f, 0xc9, 0x72, 0x7b, 0x33, 0xbd, 0x73, 0xfc, 0x2b, 0xc3, 0xf1, 0xdd, 0x3b, 0xc3, 0x1b, 0x7b, 0xce, 0xd4, 0xf3, 0xcc, 0x06, 0xec, 0xb8, 0x86, 0xf5, 0x9d, 0x00, 0x61, 0x3d, 0x80, 0x1d, 0xdd, 0x39, 0xe3, 0xe9, 0x5d, 0x13, 0x76, 0x52, 0xc1, 0x4e, 0x7c, 0x67, 0x0a, 0xb0, 0xde, 0xdd, 0x88, 0xc2, 0xfa, 0xde, 0xa8, 0x09, 0x3b, 0xab, 0x60, 0x47, 0x23, 0x67, 0x86, 0xb0, 0x1e, 0xa3, 0x21, 0xf0, 0x67, 0x35, 0xec, 0x22, 0x39, 0x10, 0x89, 0x84, 0x89, 0x20, 0x61, 0x64, 0xf8, 0xe3, 0x3b, 0x67, 0xe6, 0x8d, 0x1b, 0xa0, 0x35, 0x05, 0xe3, 0x91, 0x33, 0x41, 0xd0, 0xd1, 0xd8, 0xf0, 0xa1, 0xd8, 0x6c, 0xa6, 0xb4, 0x2c, 0x7a, 0xb4, 0xfd, 0x0a, 0xf4, 0xce, 0xa7, 0x04, 0xb8, 0xee, 0x04, 0x40, 0x47, 0xce, 0x38, 0x68, 0x82, 0x06, 0x15, 0xe8, 0x6c, 0x4a, 0xf9, 0xe5, 0x7a, 0x50, 0xff, 0xcc, 0x09, 0x82, 0x59, 0x03, 0xb2, 0x26, 0x75, 0x3c, 0x76, 0x3c, 0x84, 0xf4, 0xa7, 0x14, 0x69, 0x30, 0x19, 0x35, 0x40, 0x27, 0x32, 0x03, 0x90, 0x54, 0x37, 0x00, 0xa4, 0x13, 0x67, 0xe6, 0xfa, 0x0d, 0xc8, 0x69, 0x05, 0x19, 0x4c, 0x69, 0xfb, 0xdd, 0x80, 0xb5, 0x7f, 0x1a, 0x04, 0x72, 0xfb, 0x41, 0x66, 0x85, 0x3f, 0xb0, 0xa9, 0xc5, 0x92, 0xee, 0xb7, 0x71, 0x49, 0xc4, 0xf4, 0xc0, 0x81, 0x00, 0xd3, 0x23, 0x74, 0xfc, 0x71, 0x4e, 0x76, 0x14, 0x26, 0x05, 0x09, 0x9d, 0x82, 0x04, 0x1b, 0x3f, 0x24, 0xe1, 0x64, 0xc4, 0x52, 0x4b, 0xf2, 0x50, 0xda, 0x0f, 0x45, 0xe8, 0x4c, 0xc7, 0x4a, 0x82, 0x6d, 0xa3, 0x4c, 0xb5, 0xb7, 0x4c, 0xac, 0x2d, 0xa3, 0x64, 0x79, 0xe3, 0xdd, 0x02, 0x90, 0x29, 0x40, 0x8a, 0x5d, 0xe8, 0xcc, 0x94, 0x42, 0xc5, 0x4e, 0x57, 0x08, 0xea, 0xbf, 0x45, 0xc0, 0xaa, 0xe0, 0x22, 0x02, 0x91, 0xea, 0x49, 0xe5, 0x30, 0x41, 0x2d, 0x69, 0x78, 0xce, 0xd8, 0x10, 0xd9, 0xc9, 0x26, 0x84, 0x65, 0xc7, 0x97, 0x6b, 0x4a, 0x36, 0xda, 0x9a, 0xa6, 0xe3, 0x5b, 0x0a, 0x59, 0x55, 0x05, 0xed, 0xf4, 0x1c, 0xa5, 0xe4, 0x43, 0xd2, 0x5d, 0x52, 0x2a, 0xe8, 0xd3, 0x92, 0x72, 0x41, 0x5f, 0x5b, 0xd2, 0x87, 0x62, 0xb4, 0x94, 0xb4, 0x06, 0xd8, 0x3b, 0xb2, 0x8a, 0x0f, 0xbb, 0x70, 0x4c, 0x7b, 0x46, 0xce, 0x28, 0xc8, 0x2e, 0x06, 0xc9, 0xb0, 0x0a, 0x27, 0xad, 0x2c, 0x9a, 0x3c, 0xa5, 0xc9, 0x79, 0x04, 0xc5, 0x0b, 0x6c, 0xb6, 0x20, 0x60, 0x45, 0xd6, 0xd1, 0x21, 0x29, 0x59, 0x81, 0x75, 0xb4, 0x8b, 0x93, 0xc7, 0xf0, 0x6b, 0x94, 0xdf, 0x48, 0x62, 0xcc, 0x94, 0xc0, 0x50, 0x0c, 0x74, 0xc1, 0x62, 0x9e, 0x59, 0x49, 0x46, 0xe4, 0x3c, 0x2e, 0x87, 0x7c, 0x19, 0x14, 0xab, 0x62, 0xbd, 0x1c, 0x2e, 0xb2, 0x07, 0xbb, 0x88, 0x7f, 0xc1, 0x71, 0xc4, 0x57, 0x3f, 0x48, 0x99, 0xb3, 0x9f, 0x20, 0x6a, 0xd9, 0x22, 0xc8, 0x56, 0x69, 0x58, 0x25, 0xf7, 0xd1, 0x6a, 0x85, 0xa0, 0xee, 0x29, 0x0c, 0xd7, 0x71, 0x42, 0xa0, 0xc1, 0x09, 0x59, 0x96, 0x38, 0x58, 0x0f, 0x65, 0x99, 0xa5, 0x4f, 0x46, 0xb7, 0x2d, 0x77, 0x89, 0x10, 0xdd, 0x5c, 0x67, 0x60, 0x23, 0x2e, 0xfe, 0x85, 0xd8, 0xd1, 0xea, 0x2f, 0x87, 0xa2, 0xe4, 0xcb, 0x1a, 0x6a, 0x05, 0x65, 0xb4, 0xa0, 0x39, 0xe1, 0x68, 0x2e, 0xfd, 0x94, 0xfb, 0x0e, 0x3a, 0x6d, 0xde, 0x66, 0x90, 0x86, 0xcd, 0xd6, 0xb7, 0x5c, 0x1d, 0x4c, 0x4e, 0x13, 0x89, 0xca, 0x43, 0x8e, 0xcc, 0x2b, 0x4b, 0x68, 0x7e, 0xa1, 0xa5, 0xae, 0x01, 0x63, 0xa5, 0x59, 0xbe, 0x8b, 0x12, 0x8e, 0x01, 0x0a, 0xc4, 0x74, 0x95, 0xe8, 0xc5, 0xd1, 0x86, 0xaa, 0xb0, 0x54, 0x4c, 0x8e, 0xf6, 0xf6, 0x16, 0x38, 0x96, 0xd0, 0x31, 0xca, 0x56, 0xdf, 0x32, 0x87, 0xa6, 0xef, 0xa3, 0x1c, 0x14, 0xaf, 0xd3, 0x36, 0x3f, 0x72, 0x8e, 0xba, 0x73, 0xa1, 0x0e, 0x6c, 0x81, 0x29, 0x25, 0xef, 0x53, 0xbb, 0xcc, 0xf6, 0x7c, 0x3d, 0xf7, 0xf6, 0x0f, 0xa7, 0x68, 0xb1, 0xc8, 0xc3, 0x7b, 0x00, 0x20, 0x37, 0x9f, 0xca, 0xb8, 0x4c, 0xc8, 0x67, 0x53, 0xed, 0xcf, 0x15, 0x59, 0x66, 0x6c, 0x7d, 0x0b, 0x0f, 0x29, 0x94, 0xc7, 0x3e, 0x33, 0x56, 0x59, 0x59, 0x92, 0xd5, 0xfc, 0x1c, 0xc0, 0x69, 0xeb, 0x59, 0x5b, 0xdf, 0xda, 0x06, 0xd6, 0x76, 0x64, 0x6d, 0xc7, 0xd6, 0x76, 0x72, 0x64, 0xb3, 0x03, 0xbb, 0x5f, 0x90, 0xa5, 0xaa, 0x6a, 0x34, 0xed, 0x14, 0x1d, 0x55, 0xd2, 0xbb, 0x28, 0x12, 0xf9, 0x1d, 0xe9, 0xa7, 0x85, 0x55, 0x94, 0x79, 0x96, 0x6e, 0x8e, 0x72, 0x25, 0x38, 0xaf, 0x49, 0x7e, 0x5a, 0x66, 0x2b, 0x62, 0x7d, 0x59, 0xac, 0x60, 0xdc, 0xec, 0xf6, 0xd6, 0x3e, 0x27, 0xc7, 0xee, 0xe1, 0xd7, 0x9c, 0xbe, 0xd6, 0x2b, 0x2a, 0x0a, 0xc3, 0x86, 0x9c, 0x44, 0xd1, 0xf3, 0xc6, 0x5d, 0x8d, 0xa8, 0x67, 0xf0, 0xd5, 0xbd, 0xe6, 0x91, 0xdd, 0xa9, 0x80, 0xb4, 0x44, 0xea, 0xc9, 0x99, 0x7b, 0x75, 0x2a, 0x0e, 0xc0, 0xeb, 0xc3, 0xfe, 0xf8, 0x15, 0x37, 0x15, 0x20, 0x87, 0x41, 0xb1, 0x8d, 0x37, 0x69, 0x88, 0xd2, 0x0c, 0x07, 0x84, 0x84, 0x61, 0x3a, 0xbe, 0x52, 0x26, 0x3e, 0x08, 0x95, 0xac, 0x88, 0x69, 0xb7, 0xe5, 0x24, 0x01, 0x02, 0xbe, 0x12, 0xc4, 0x06, 0x82, 0x09, 0xe4, 0xd3, 0x2e, 0xb4, 0x61, 0x0d, 0xc0, 0x3a, 0x01, 0x37, 0x8c, 0x5c, 0xf8, 0xc4, 0x2f, 0x90, 0x21, 0x09, 0x39, 0xd2, 0x5e, 0x87, 0xcd, 0x0d, 0xee, 0x37, 0x5c, 0x31, 0xbc, 0xb5, 0x63, 0x1e, 0x12, 0x93, 0x68, 0x0f, 0x6b, 0x9c, 0xf8, 0x71, 0x0a, 0xa9, 0x58, 0x5a, 0x67, 0xcb, 0x43, 0x81, 0x1a, 0xeb, 0x31, 0x3b, 0x94, 0x48, 0x54, 0x18, 0x1d, 0xca, 0xec, 0x04, 0x9b, 0x23, 0xd0, 0x90, 0x8a, 0xa2, 0xab, 0x35, 0x40, 0xcd, 0x0e, 0x44, 0xe2, 0xe3, 0x71, 0x15, 0x17, 0x7b, 0x10, 0xdb, 0x61, 0x12, 0x17, 0x40, 0x09, 0xc8, 0xa1, 0x53, 0x96, 0x58, 0x87, 0xc4, 0xda, 0x91, 0xf4, 0x70, 0xa4, 0x89, 0x6c, 0x67, 0x82, 0xbb, 0xa8, 0x53, 0xbc, 0xdb, 0x58, 0xc5, 0xd7, 0x8d, 0xf5, 0x35, 0x5e, 0x91, 0xcc, 0x5a, 0x46, 0xe9, 0x57, 0x18, 0x16, 0xd1, 0x61, 0x15, 0x67, 0x56, 0xbc, 0xce, 0xa3, 0x1d, 0xb1, 0xc8, 0x6e, 0x41, 0x56, 0x56, 0xb6, 0xf8, 0x0b, 0x48, 0xe8, 0x66, 0xdd, 0xbb, 0x78, 0xb5, 0x4a, 0xc8, 0x5c, 0xd4, 0xb8, 0x48, 0xb2, 0xe5, 0x17, 0x8a, 0x92, 0xa2, 0x3b, 0xee, 0xa2, 0x07, 0x31, 0xab, 0x51, 0xe8, 0x72, 0xde, 0xd2, 0xd6, 0x30, 0x41, 0x6f, 0xc5, 0xe9, 0xfe, 0x50, 0x5a, 0x4c, 0xfc, 0x5b, 0xd9, 0xbe, 0xdc, 0xe4, 0xd9, 0x61, 0x6f, 0x21, 0x0f, 0x41, 0x70, 0x44, 0xb4, 0x3b, 0xd5, 0x39, 0xd9, 0x1a, 0x81, 0x4a, 0xae, 0x66, 0x60, 0x89, 0xfc, 0x04, 0x12, 0x70, 0x53, 0xc6, 0xb5, 0x1d, 0x91, 0xac, 0xf6, 0x4c, 0x86, 0xb9, 0xe5, 0x63, 0xe8, 0xcd, 0x71, 0x65, 0x43, 0x62, 0xd2, 0x95, 0xd8, 0x4c, 0xd0, 0xcd, 0x09, 0xef, 0x3a, 0xb6, 0xf4, 0x76, 0xaf, 0x5f, 0xdf, 0x3f, 0xdd, 0x4c, 0xba, 0x32, 0xba, 0xc3, 0xb8, 0xb8, 0xf9, 0xb4, 0x83, 0x79, 0x17, 0xc3, 0xfa, 0xf4, 0xd9, 0xfa, 0x84, 0x33, 0xe2, 0x33, 0xee, 0x9f, 0x79, 0x7f, 0xe8, 0x04, 0xd5, 0x45, 0x08, 0xf0, 0x07, 0x34, 0xee, 0xc8, 0x17, 0x6a, 0x9b, 0xed, 0xc3, 0x61, 0x18, 0x46, 0x79, 0x19, 0xfa, 0xb0, 0x83, 0xeb, 0xe2, 0x23, 0xdf, 0xd7, 0x73, 0x78, 0x92, 0xae, 0xc2, 0x11, 0x05, 0x86, 0xd1, 0xb6, 0x24, 0x5b, 0x4a, 0xc9, 0xb1, 0x6a, 0xfb, 0x49, 0xb2, 0x19, 0xd0, 0xcd, 0x7d, 0x65, 0x37, 0x88, 0xf6, 0x7b, 0x12, 0xc1, 0x72, 0xb4, 0x24, 0x21, 0xfe, 0x86, 0x8a, 0xf6, 0xa0, 0x3e, 0xb3, 0x3a, 0x84, 0xa1, 0x80, 0x6b, 0xbd, 0x50, 0x57, 0x09, 0x73, 0xaf, 0x88, 0x97, 0x5c, 0xb4, 0xec, 0x1f, 0xcc, 0xa3, 0x5a, 0x21, 0xe3, 0xeb, 0xf2, 0x90, 0xe3, 0xd2, 0x46, 0xd7, 0x65, 0xb9, 0x66, 0x9e, 0x4b, 0xf5, 0xec, 0x5d, 0xfc, 0x70, 0x13, 0xa7, 0x46, 0x12, 0x2d, 0xac, 0x1c, 0xe6, 0x10, 0xfc, 0x67, 0x76, 0x20, 0x93, 0xc1, 0x41, 0xa5, 0x87, 0x02, 0x1c, 0x3f, 0xcd, 0x31, 0xc6, 0xee, 0x95, 0x25, 0xad, 0xa7, 0xa0, 0x98, 0x9d, 0xaa, 0x39, 0x02, 0x32, 0x01, 0x09, 0x15, 0x33, 0x13, 0xb8, 0x23, 0x9a, 0x5d, 0x40, 0xa3, 0x97, 0x5b, 0x69, 0x09, 0x3a, 0x6a, 0x18, 0x42, 0xa5, 0x40, 0x5d, 0x66, 0x15, 0x95, 0xa0, 0x29, 0xc1, 0xe8, 0x29, 0xe3, 0x1d, 0x81, 0x71, 0x09, 0x9b, 0xa7, 0xe3, 0x0e, 0xd8, 0x22, 0x14, 0xa2, 0x64, 0xcb, 0xd6, 0x35, 0x36, 0xff, 0xc5, 0x92, 0xa6, 0x96, 0xa7, 0x45, 0x41, 0xb7, 0x2d, 0x2b, 0x51, 0xc4, 0x3b, 0x70, 0x9d, 0x90, 0x87, 0x2e, 0x58, 0x7b, 0x1d, 0x93, 0x64, 0x55, 0xd8, 0xf7, 0x39, 0x12, 0x97, 0x1f, 0x65, 0x1d, 0x51, 0x8f, 0x5c, 0x8c, 0x26, 0x2a, 0x75, 0xba, 0xe1, 0xec, 0x47, 0x68, 0x2a, 0xc3, 0x3e, 0xb8, 0x08, 0xac, 0x3f, 0xe5, 0xf6, 0xc2, 0x32, 0x2b, 0x18, 0x52, 0x97, 0x95, 0xd8, 0xc2, 0x52, 0x7b, 0x29, 0x61, 0x71, 0x7a, 0x80, 0x0e, 0xba, 0xac, 0x50, 0x01, 0x03, 0x00, 0x7a, 0xf4, 0xd2, 0x9a, 0x12, 0x58, 0x2b, 0x9e, 0x54, 0x12, 0x86, 0xc4, 0x2a, 0x06, 0xf5, 0xb7, 0xa3, 0x18, 0x5d, 0xe4, 0x40, 0x57, 0x89, 0x61, 0xad, 0x01, 0x3d, 0x9e, 0x29, 0xfb, 0xcc, 0x28, 0x43, 0x07, 0xa3, 0xbc, 0x34, 0x54, 0x5a, 0xe0, 0xe3, 0x9e, 0x7c, 0x60, 0x19, 0x20, 0x5f, 0xe8, 0x17, 0x8c, 0x7b, 0x52, 0x8a, 0x0f, 0x58, 0x9b, 0x77, 0x71, 0x29, 0xa9, 0x89, 0xd2, 0x08, 0x67, 0xc5, 0x98, 0xca, 0xdf, 0x4e, 0x6e, 0xa5, 0x74, 0xc9, 0xa2, 0x17, 0xc1, 0x2c, 0x90, 0xc4, 0x69, 0x4a, 0x85, 0x3a, 0xcc, 0x2c, 0x8e, 0x5e, 0x5e, 0x1c, 0x6b, 0x38, 0xd0, 0x00, 0x7a, 0xe0, 0x3e, 0x6d, 0x61, 0xfd, 0x25, 0xe9, 0x67, 0xce, 0x25, 0x60, 0x5f, 0x79, 0xc3, 0xd3, 0x3e, 0x1c, 0xd2, 0x32, 0x4e, 0x40, 0x97, 0x80, 0x95, 0x00, 0x44, 0x71, 0x35, 0x13, 0x91, 0xc3, 0x7f, 0x17, 0xef, 0x50, 0x58, 0x45, 0xa0, 0x98, 0x8b, 0x92, 0x68, 0xf3, 0x32, 0x2d, 0xfa, 0x27, 0xdc, 0x46, 0xc5, 0x0d, 0x65, 0xbe, 0x43, 0x0d, 0x62, 0xd4, 0x1e, 0x90, 0x83, 0x8a, 0x42, 0xf2, 0x4f, 0x54, 0x1e, 0x7c, 0xa0, 0x5a, 0xfe, 0xe7, 0x70, 0xb9, 0x25, 0xcb, 0x2f, 0x20, 0xd2, 0xac, 0x4f, 0xd0, 0xff, 0x91, 0x4d, 0x81, 0x79, 0x1e, 0x13, 0x6b, 0x76, 0xb1, 0xc4, 0xb4, 0x90, 0xa6, 0xd5, 0xf6, 0x08, 0xdc, 0xc5, 0x7b, 0x95, 0xe9, 0x02, 0x35, 0x03, 0xc3, 0x35, 0x5c, 0x53, 0x05, 0x90, 0xac, 0x30, 0x33, 0x5d, 0x7e, 0x6d, 0x7a, 0xb9, 0x1b, 0xeb, 0xf2, 0x91, 0x68, 0x54, 0xc1, 0x18, 0x8c, 0xef, 0x09, 0x3b, 0xce, 0x6c, 0xec, 0xcc, 0x66, 0x92, 0x75, 0x68, 0x9f, 0xc7, 0xa8, 0x34, 0x09, 0x8b, 0xcb, 0x98, 0x9a, 0x86, 0x0c, 0x7f, 0x3a, 0x75, 0x5c, 0x3f, 0x68, 0x81, 0x35, 0xd0, 0xde, 0x55, 0x46, 0x97, 0xa9, 0xef, 0x4c, 0x67, 0x92, 0xd1, 0x87, 0x4d, 0x9c, 0x1a, 0xf1, 0x84, 0x21, 0xf6, 0x8c, 0x60, 0x3c, 0x72, 0x02, 0x57, 0x07, 0xd9, 0xc4, 0x3d, 0xa2, 0x56, 0xa2, 0x99, 0x11, 0x8c, 0x7c, 0xd0, 0x36, 0xa5, 0x12, 0xd1, 0x72, 0x59, 0x83, 0x4d, 0xa9, 0x39, 0x6d, 0xec, 0x1b, 0xde, 0xcc, 0x73, 0xee, 0x3c, 0xbf, 0x09, 0xd6, 0xc0, 0x1a, 0x50, 0x83, 0xd6, 0x24, 0x00, 0xf0, 0x99, 0x33, 0xf2, 0x26, 0x35, 0x78, 0x4a, 0x0e, 0xb0, 0xc2, 0x24, 0xa2, 0x57, 0x68, 0xed, 0xee, 0x98, 0x31, 0x4c, 0xe6, 0x04, 0x87, 0x6b, 0x52, 0x4b, 0xad, 0x5f, 0x2e, 0x70, 0x62, 0x36, 0x71, 0x02, 0x89, 0x8a, 0x38, 0x5d, 0x67, 0x82, 0x54, 0xc4, 0xe9, 0x41, 0x1f, 0x04, 0xbe, 0x33, 0x99, 0x78, 0x2a, 0x4c, 0xb3, 0xc3, 0xee, 0x28, 0x9d, 0x00, 0x3c, 0x0a, 0xa0, 0x79, 0x53, 0x89, 0x5f, 0x07, 0x68, 0x57, 0x51, 0x08, 0x9c, 0x68, 0x20, 0xf3, 0xa6, 0x53, 0xc3, 0x9b, 0x04, 0x8e, 0x2f, 0xd3, 0xc9, 0xe1, 0x9a, 0xed, 0x47, 0x76, 0xb9, 0x14, 0x7e, 0xe6, 0xdc, 0x49, 0xa6, 0xb7, 0xfb, 0x28, 0x4f, 0x71, 0xb9, 0xe1, 0xe6, 0x3c, 0x6c, 0x8e, 0x37, 0xbb, 0x33, 0x66, 0x23, 0x67, 0xe4, 0xdf, 0xb5, 0xc0, 0x1a, 0x58, 0x47, 0x1e, 0xb5, 0x53, 0xfa, 0xc6, 0x68, 0xec, 0xdc, 0xb9, 0x12, 0x56, 0x92, 0xe7, 0xb0, 0xba, 0x73, 0x52, 0x3d, 0x61, 0xf8, 0x0c, 0x00, 0xe7, 0xac, 0x01, 0xd4, 0x6c, 0x3f, 0xed, 0x56, 0xe0, 0xbf, 0xe7, 0x3b, 0x2e, 0xa3, 0x93, 0x9b, 0x7b, 0x84, 0x58, 0xaa, 0x8c, 0x3e, 0x3c, 0x9d, 0x0a, 0xdb, 0xda, 0x88, 0xc7, 0x53, 0x41, 0xb6, 0x56, 0x80, 0xd4, 0x08, 0x52, 0x17, 0xf7, 0xe5, 0xe4, 0x46, 0x69, 0x6e, 0x69, 0xf1, 0xa8, 0x6d, 0x7d, 0x45, 0xf6, 0xa8, 0xc1, 0xc3, 0xaf, 0x34, 0x8b, 0xd1, 0xcb, 0x71, 0xfa, 0x1d, 0x5a, 0xae, 0x22, 0xe3, 0x06, 0xf6, 0xa7, 0x6b, 0x92, 0x17, 0xb6, 0x32, 0xdb, 0x61, 0x2c, 0x7f, 0x31, 0x99, 0x15, 0xfd, 0xd8, 0xca, 0xe8, 0x92, 0x02, 0xfe, 0xd8, 0x09, 0xe8, 0x64, 0xc2, 0xf1, 0x31, 0xf6, 0x81, 0x41, 0x9d, 0xf2, 0xc0, 0x87, 0x8e, 0xa6, 0x66, 0x51, 0x6a, 0xec, 0x85, 0xd1, 0xd1, 0x29, 0x19, 0x7c, 0x0f, 0x86, 0x0e, 0x85, 0xf4, 0x01, 0x72, 0x04, 0x8c, 0xec, 0x15, 0x12, 0x77, 0x53, 0x67, 0xe6, 0xd2, 0xf1, 0xe1, 0xdf, 0x31, 0x8b, 0xeb, 0x68, 0xda, 0x25, 0x28, 0xc6, 0x38, 0x8f, 0xfc, 0x20, 0xa0, 0x92, 0xc2, 0xf3, 0xa6, 0x67, 0x25, 0x05, 0xa3, 0x78, 0x46, 0x25, 0x45, 0x20, 0x5b, 0xbd, 0xdf, 0x24, 0xc5, 0x9b, 0xa4, 0xf8, 0xeb, 0x95, 0x14, 0xa7, 0x37, 0x95, 0xe2, 0x4d, 0xa5, 0x78, 0x13, 0x14, 0x6f, 0x82, 0xe2, 0x9c, 0xa0, 0x18, 0x28, 0x27, 0x50, 0x87, 0xe8, 0x10, 0x13, 0x34, 0xeb, 0x4d, 0xe3, 0x78, 0xd3, 0x38, 0xde, 0x04, 0xc9, 0xdf, 0xf4, 0xde, 0x84, 0x07, 0x91, 0x3d, 0x1a, 0xac, 0xa2, 0x28, 0xa9, 0x1c, 0x27, 0xc5, 0x63, 0x5a, 0x46, 0x0f, 0xa1, 0xf1, 0xee, 0xef, 0x01, 0x00, 0x07, 0x60, 0xb4, 0x21, 0x1f, 0xdf, 0xcd, 0x0d, 0x6e, 0xc5, 0x2c, 0x42, 0xa3, 0xcc, 0x0f, 0x04, 0xbf, 0x69, 0xc4, 0x11, 0xb3, 0x7e, 0x86, 0x86, 0x7b, 0x35, 0x67, 0xe2, 0x09, 0xc3, 0x81, 0x1e, 0x78, 0x45, 0x87, 0x3c, 0xb9, 0x79, 0x87, 0xd2, 0x27, 0x84, 0xc9, 0xb7, 0x21, 0xb7, 0xc5, 0xd7, 0xcd, 0x8f, 0x0f, 0xbb, 0xc4, 0xba, 0x0a, 0x7e, 0x82, 0x9f, 0x06, 0xfc, 0x4c, 0x8b, 0x0f, 0xd7, 0x18, 0xf1, 0x16, 0xde, 0xde, 0xde, 0xdf, 0xdf, 0x3b, 0xf7, 0x81, 0x93, 0xe5, 0x9b, 0x5b, 0x90, 0x2a, 0x2e, 0x02, 0x5f, 0x5f, 0x05, 0xff, 0x08, 0xb0, 0xeb, 0x38, 0x29, 0x49, 0x6e, 0xc4, 0xab, 0x0f, 0xd7, 0x91, 0x48, 0x22, 0x3f, 0x1f, 0xf2, 0xc5, 0x21, 0x21, 0xe9, 0x92, 0x18, 0xd4, 0xb8, 0x75, 0xbd, 0xce, 0xa3, 0x65, 0x19, 0x25, 0x7f, 0xc4, 0x9a, 0xaf, 0xa9, 0x33, 0xfe, 0x9f, 0x72, 0xf2, 0xbf, 0x0e, 0x00, 0xf1, 0xf8, 0xe1, 0xda, 0x73, 0x82, 0xd1, 0xb5, 0x91, 0x1e, 0x76, 0xff, 0x0a, 0x30, 0x5f, 0x09, 0xd4, 0x0a, 0x9f, 0x45, 0x19, 0x97, 0xcb, 0xed, 0xcf, 0x71, 0x82, 0xdf, 0xec, 0x83, 0xa3, 0xbf, 0x95, 0xf1, 0x8b, 0x24, 0x4a, 0x05, 0xfb, 0xc8, 0xa1, 0x0b, 0x0c, 0xea, 0xb4, 0x01, 0xd4, 0xa0, 0x48, 0xf9, 0xe3, 0x6b, 0x83, 0xd9, 0x9c, 0xea, 0x6f, 0x06, 0xff, 0xe1, 0x1a, 0x99, 0x70, 0xe5, 0x07, 0x91, 0x79, 0x6d, 0x70, 0x2b, 0xfc, 0x87, 0x6b, 0xd7, 0xf1, 0x45, 0x4d, 0x88, 0x8a, 0xff, 0x84, 0x16, 0xc3, 0xaf, 0x77, 0xa6, 0x24, 0xe7, 0x9d, 0x5d, 0xb6, 0x02, 0x26, 0x43, 0x67, 0xa5, 0x16, 0xfb, 0xfd, 0x09, 0x7f, 0x7f, 0xe6, 0x1f, 0x61, 0x19, 0xe5, 0x1b, 0x52, 0xf2, 0x2f, 0xbb, 0xcc, 0x36, 0x9b, 0x84, 0x08, 0xc9, 0x6f, 0x39, 0xab, 0x3c, 0xba, 0x87, 0x51, 0x40, 0x2d, 0x5e, 0xcb, 0x24, 0x2a, 0x8a, 0xf7, 0x1f, 0x58, 0x12, 0x45, 0xf8, 0xd9, 0xfc, 0xc8, 0x21, 0x1a, 0x05, 0xcd, 0x63, 0xf6, 0x95, 0xe4, 0xeb, 0x24, 0xbb, 0x0f, 0x99, 0x9d, 0x4c, 0xb1, 0x80, 0xbd, 0x2c, 0x5d, 0x8e, 0x44, 0x50, 0x27, 0x3d, 0xe6, 0xb1, 0x58, 0xe2, 0x0a, 0xb7, 0x88, 0x72, 0x7b, 0x73, 0x40, 0x57, 0x4f, 0x58, 0x50, 0x47, 0xa2, 0xec, 0xc9, 0xa1, 0x43, 0x2c, 0x44, 0x13, 0x7a, 0x44, 0x43, 0x7f, 0x56, 0x18, 0xcd, 0x78, 0xc3, 0x5c, 0xa6, 0xea, 0xe2, 0x66, 0x5a, 0xda, 0x54, 0x3a, 0x47, 0xa1, 0x81, 0xf6, 0x62, 0x13, 0x6a, 0x01, 0x2e, 0xf3, 0x60, 0xfc, 0xda, 0x2c, 0xab, 0x1b, 0xa3, 0x50, 0x59, 0xe4, 0x9b, 0x85, 0xbe, 0xfd, 0x16, 0x93, 0x5c, 0x7c, 0x5b, 0x60, 0x8c, 0xdc, 0x2b, 0xf3, 0x24, 0x7a, 0x5e, 0x43, 0xb0, 0xdc, 0x92, 0x46, 0xed, 0x3f, 0xb2, 0x54, 0x93, 0x91, 0xcb, 0x20, 0xa8, 0x1f, 0x4b, 0x80, 0x93, 0x74, 0xd5, 0xd9, 0xa7, 0x6c, 0xf4, 0xcb, 0x5a, 0xcb, 0xe7, 0x63, 0xcb, 0x61, 0xc7, 0x1a, 0xc0, 0x1b, 0xd8, 0xd5, 0x9d, 0x32, 0x68, 0x5b, 0xbd, 0xa8, 0x03, 0x77, 0x96, 0xd9, 0x6e, 0x9f, 0xa5, 0x90, 0x54, 0xcc, 0x79, 0xca, 0xa1, 0x8c, 0x93, 0x98, 0x86, 0xd8, 0x3a, 0x40, 0xd3, 0x71, 0x79, 0xc8, 0x0b, 0xc0, 0xb4, 0xcf, 0x62, 0x28, 0x99, 0xcf, 0x3b, 0x1c, 0x44, 0x2d, 0x13, 0x37, 0x4d, 0x6c, 0x7e, 0x4b, 0x8e, 0x21, 0x94, 0xae, 0x80, 0x8e, 0x63, 0x3b, 0x14, 0x68, 0xc4, 0x66, 0xae, 0x42, 0x86, 0xae, 0x2b, 0xa3, 0x95, 0x80, 0x2e, 0x23, 0xea, 0x13, 0x0a, 0xf1, 0x9f, 0x39, 0x46, 0xf0, 0xc4, 0xeb, 0x5a, 0x1f, 0xe1, 0xf5, 0xd0, 0x4a, 0xa9, 0xaf, 0xbb, 0x10, 0x49, 0x1a, 0xd7, 0x93, 0xc6, 0xa7, 0x2f, 0x2c, 0x59, 0x5b, 0x14, 0x0b, 0x21, 0xfd, 0xd7, 0xa4, 0x8c, 0x61, 0xbf, 0x8f, 0x67, 0xf9, 0x4c, 0x99, 0x68, 0xd3, 0x50, 0xa2, 0x7d, 0x15, 0xac, 0x06, 0x1f, 0x5d, 0x13, 0x4d, 0x64, 0xcb, 0x71, 0x01, 0x2d, 0xc0, 0xa0, 0x06, 0x14, 0x2b, 0x6b, 0xc1, 0x82, 0x8b, 0xa5, 0x14, 0xd2, 0x4c, 0x21, 0x2d, 0x18, 0x52, 0xc3, 0xf0, 0xd0, 0x29, 0x35, 0x7f, 0x17, 0xa7, 0x2c, 0x3c, 0x8d, 0x05, 0xf5, 0x19, 0xb6, 0xc1, 0x48, 0x61, 0xd4, 0xc1, 0x30, 0x63, 0xa5, 0x58, 0x62, 0x85, 0xc5, 0x14, 0x8e, 0xfc, 0x3a, 0x9d, 0x25, 0x98, 0x6a, 0xb8, 0x03, 0xf3, 0x3c, 0x6b, 0x7d, 0xbe, 0x75, 0xc9, 0xbd, 0xd9, 0x84, 0x40, 0x2f, 0xaf, 0x92, 0x5f, 0x47, 0x69, 0xf0, 0x38, 0x42, 0xca, 0x74, 0xf4, 0x39, 0xd3, 0xad, 0x02, 0xf7, 0x06, 0x41, 0x8b, 0xb2, 0xcf, 0x26, 0xf5, 0x55, 0xb2, 0x90, 0x83, 0x75, 0x5c, 0x29, 0x98, 0x3d, 0x05, 0x58, 0x48, 0xdb, 0x51, 0x8c, 0xa7, 0xa8, 0x2c, 0xf3, 0x1b, 0x74, 0xc6, 0xdb, 0x20, 0xf2, 0x48, 0x62, 0x56, 0x25, 0xd9, 0xe7, 0xb1, 0x3d, 0x82, 0x54, 0x00, 0x83, 0xd6, 0xf0, 0xa2, 0xb3, 0x4a, 0xf8, 0xb7, 0xa5, 0x90, 0x94, 0x68, 0x51, 0x64, 0xc9, 0xa1, 0x84, 0x19, 0x97, 0xed, 0x21, 0x3d, 0xe7, 0x21, 0x2b, 0x3c, 0x38, 0xc5, 0x9d, 0x27, 0x64, 0x5d, 0xe2, 0x9e, 0x0a, 0xc8, 0xa2, 0xe4, 0x55, 0xa2, 0x56, 0xa6, 0x95, 0x4a, 0xee, 0x5a, 0xa8, 0x56, 0x99, 0xf8, 0x17, 0x14, 0x74, 0x6c, 0x9c, 0xf5, 0x89, 0xb2, 0x82, 0xcd, 0x47, 0xb2, 0xfa, 0x80, 0xea, 0xd1, 0x67, 0xd3, 0xfc, 0x91, 0x82, 0x70, 0x96, 0x1d, 0x95, 0x00, 0x49, 0xb4, 0xbc, 0x88, 0x51, 0x24, 0x0d, 0x0c, 0xe3, 0xc7, 0xe6, 0xc8, 0x52, 0x43, 0x46, 0x68, 0xdd, 0x28, 0x51, 0x2b, 0x52, 0x35, 0x24, 0x5a, 0x6c, 0x4e, 0x5a, 0x67, 0x09, 0x3c, 0x3b, 0x6b, 0x2f, 0x59, 0xec, 0x5e, 0x85, 0x34, 0x8d, 0xbf, 0xbf, 0x93, 0xda, 0xb6, 0xef, 0xbf, 0x22, 0x89, 0x0e, 0x36, 0x33, 0x24, 0xbb, 0x7d, 0xf9, 0x28, 0xc6, 0x1c, 0x0f, 0xa1, 0x62, 0x82, 0x13, 0x16, 0x96, 0xfb, 0xd0, 0x63, 0x05, 0x68, 0x58, 0x11, 0x3b, 0xb7, 0xc0, 0xe3, 0x8a, 0xa4, 0x38, 0xa0, 0x79, 0x3b, 0xa9, 0x92, 0x8d, 0xeb, 0x0c, 0x94, 0x65, 0xbe, 0x3a, 0x15, 0x21, 0x6b, 0x1d, 0xe7, 0x0b, 0xc3, 0x29, 0xca, 0xb2, 0x00, 0xfb, 0xd0, 0x07, 0xcd, 0x5c, 0x44, 0x2e, 0xc1, 0x6f, 0x16, 0xad, 0x29, 0x62, 0xed, 0xeb, 0x62, 0xf6, 0xd7, 0xb8, 0x88, 0x61, 0x51, 0xec, 0x19, 0x95, 0x2a, 0x20, 0x74, 0x46, 0xa3, 0x26, 0x7b, 0xac, 0xab, 0x8a, 0xd6, 0xf1, 0x09, 0x06, 0x18, 0x2e, 0xb9, 0xab, 0xcf, 0x47, 0x3e, 0x0b, 0x6d, 0xf2, 0x15, 0xd7, 0x41, 0x75, 0x52, 0x39, 0xa3, 0x4a, 0x0d, 0x58, 0x94, 0xa9, 0x79, 0x64, 0xa2, 0xe3, 0x80, 0x07, 0x0f, 0x4e, 0x98, 0xd2, 0x9c, 0xc9, 0xed, 0x25, 0x4e, 0x1f, 0x11, 0xa5, 0x61, 0xc9, 0xf3, 0xd7, 0x42, 0x55, 0x50, 0xf2, 0xf1, 0x0d, 0x44, 0xa2, 0x90, 0x94, 0x87, 0x3c, 0x26, 0xad, 0x37, 0x26, 0x3b, 0xfa, 0x00, 0xbb, 0x1f, 0x18, 0x4c, 0x50, 0xe0, 0x4b, 0xd1, 0xc8, 0x56, 0xa4, 0x38, 0xca, 0x57, 0x59, 0xd4, 0xd6, 0xa1, 0xc0, 0xf8, 0x69, 0x71, 0xc9, 0x6b, 0x56, 0x0d, 0x6b, 0xd6, 0x47, 0xbf, 0xbb, 0x07, 0xb1, 0x39, 0xef, 0xd0, 0x73, 0xb0, 0xec, 0x62, 0xa3, 0x64, 0xd3, 0xfa, 0xd1, 0xbf, 0x6d, 0x51, 0x99, 0xc2, 0xe0, 0xe8, 0xae, 0xcb, 0x7c, 0x8f, 0x02, 0xc6, 0x6c, 0xab, 0xc6, 0xc8, 0x1e, 0xab, 0x46, 0xc8, 0x80, 0xc5, 0x6a, 0xc4, 0xfa, 0x54, 0x91, 0x3f, 0x73, 0xcd, 0x11, 0x1d, 0xcd, 0x92, 0x4c, 0x89, 0xe3, 0x25, 0x58, 0x1c, 0xb1, 0x38, 0x3b, 0xe2, 0xc0, 0xc8, 0x33, 0x54, 0x6b, 0xf3, 0xad, 0x44, 0x2d, 0xdd, 0x96, 0x9a, 0xef, 0x1d, 0x6f, 0x0c, 0x2d, 0x2f, 0xb3, 0xc3, 0x72, 0x4b, 0xa5, 0x02, 0x88, 0xee, 0x5d, 0x94, 0xc6, 0xfb, 0x43, 0x42, 0xc3, 0x71, 0xe6, 0x52, 0xe4, 0x03, 0x47, 0x39, 0x14, 0xf3, 0xe4, 0xca, 0xc4, 0xb5, 0x06, 0xc6, 0x96, 0xd4, 0x6c, 0x86, 0xca, 0xe4, 0xfb, 0xe6, 0x50, 0x2a, 0x55, 0xef, 0xa3, 0x2d, 0xb6, 0x8f, 0x46, 0x4e, 0x22, 0x20, 0x63, 0xff, 0xf9, 0x7e, 0xf4, 0xf9, 0x26, 0x82, 0x8d, 0x9d, 0x6e, 0xd1, 0xca, 0x41, 0x2a, 0x55, 0xa8, 0xe6, 0x60, 0xb3, 0xbf, 0x45, 0x07, 0x80, 0x3a, 0xc0, 0xff, 0xe5, 0xc1, 0x69, 0x0c, 0xee, 0x2f, 0x30, 0xe1, 0x40, 0xeb, 0xe1, 0x94, 0xc8, 0x76, 0x04, 0xb3, 0x51, 0x18, 0xf4, 0x05, 0x5d, 0x51, 0xd2, 0x5b, 0x14, 0x0b, 0xe9, 0x0b, 0x92, 0xf3, 0x05, 0xbb, 0xc8, 0x25, 0x1d, 0xe4, 0xd6, 0x3a, 0x6c, 0x9a, 0x51, 0x2d, 0x96, 0x26, 0x14, 0xdb, 0x1c, 0x26, 0x25, 0xac, 0xd6, 0xc3, 0x75, 0xda, 0x0d, 0xa0, 0x70, 0x02, 0x76, 0x96, 0x42, 0x8e, 0xc9, 0xc3, 0x63, 0x02, 0x74, 0x89, 0xa0, 0xea, 0x81, 0x2d, 0x2c, 0x20, 0x6c, 0x99, 0xb1, 0x9a, 0x33, 0xcf, 0x92, 0x47, 0xba, 0x55, 0x8f, 0x41, 0x19, 0xc5, 0xea, 0xc0, 0x83, 0x96, 0x1d, 0xbf, 0x90, 0xd3, 0xcb, 0x78, 0x87, 0x12, 0x68, 0x7d, 0x48, 0xd9, 0x70, 0x5e, 0x1e, 0x16, 0xf1, 0xd2, 0x5e, 0x90, 0x5f, 0x62, 0x92, 0xdf, 0xb8, 0x96, 0x0b, 0xc3, 0xcb, 0xf2, 0x4c, 0x9d, 0xf2, 0x7d, 0xd9, 0xa2, 0x8b, 0xa2, 0x57, 0x19, 0x3d, 0x9d, 0x2b, 0x26, 0x1f, 0x50, 0x16, 0xae, 0x2f, 0x46, 0x7b, 0xa2, 0x8c, 0x61, 0xa2, 0x9c, 0x4e, 0x12, 0xbe, 0x6a, 0xbe, 0x05, 0x30, 0xcf, 0x70, 0xcd, 0xb0, 0xf1, 0x1f, 0x15, 0x97, 0x6b, 0x8c, 0x20, 0x2d, 0xd0, 0x66, 0x3e, 0xb5, 0x1d, 0xfa, 0x7a, 0xcf, 0x35, 0xab, 0xdd, 0xa0, 0x00, 0x04, 0x20, 0x6d, 0xac, 0xdb, 0xa2, 0xf3, 0x59, 0xc8, 0x14, 0x26, 0x31, 0x1b, 0x17, 0x5f, 0x03, 0xb8, 0xc9, 0x0b, 0x74, 0x61, 0xba, 0x96, 0x18, 0x14, 0xae, 0x11, 0xdc, 0x4e, 0x4f, 0xbc, 0xa8, 0x6a, 0x83, 0xba, 0xa5, 0x82, 0x32, 0x7c, 0x4b, 0x75, 0xa1, 0xd0, 0xb9, 0x98, 0xdf, 0xcd, 0x6a, 0x7a, 0xb9, 0xd2, 0x57, 0x33, 0x1b, 0x52, 0x53, 0x34, 0x15, 0x50, 0xde, 0xa8, 0xda, 0xc8, 0x31, 0xc6, 0x10, 0x7a, 0x16, 0xd8, 0x4f, 0x7f, 0xd5, 0x8b, 0x3e, 0x5b, 0x70, 0x24, 0x35, 0x48, 0x5e, 0x67, 0x18, 0x2a, 0xa6, 0x45, 0x31, 0x23, 0x02, 0xd2, 0x21, 0xb4, 0xaa, 0x4b, 0x25, 0x32, 0x9d, 0x9a, 0x58, 0x39, 0x5f, 0x40, 0x2e, 0xe7, 0xd6, 0x59, 0x4a, 0x9e, 0xc9, 0xbf, 0xf1, 0x15, 0x1f, 0x5a, 0xe7, 0x6a, 0x6a, 0xae, 0x12, 0x2f, 0x3b, 0x28, 0x06, 0x55, 0xfe, 0x12, 0x43, 0x65, 0x40, 0x6d, 0xd2, 0x09, 0x54, 0xfc, 0xbf, 0x6c, 0x9b, 0xba, 0xa5, 0xb3, 0x5a, 0x9b, 0xce, 0x30, 0x83, 0x9e, 0x1c, 0x0a, 0xd5, 0xd6, 0xaa, 0x95, 0x5c, 0x8b, 0x56, 0x23, 0x3e, 0xcd, 0xba, 0x66, 0x54, 0xfc, 0x58, 0xe6, 0x06, 0x8f, 0x45, 0x99, 0x5d, 0xf6, 0xa6, 0x67, 0x6f, 0x93, 0x5e, 0x87, 0xb8, 0x4b, 0x36, 0x4a, 0x5e, 0x7b, 0xa3, 0xf4, 0x32, 0x44, 0x35, 0xe2, 0x53, 0x2f, 0xc0, 0xaa, 0xdd, 0x7b, 0x28, 0x43, 0x4e, 0x9c, 0x79, 0xae, 0xa5, 0xae, 0x04, 0xd3, 0xa7, 0x69, 0xbd, 0x56, 0xef, 0x1c, 0xab, 0xaa, 0x9b, 0xbc, 0x5f, 0x6e, 0xbb, 0x79, 0xef, 0x03, 0xef, 0xc5, 0x3a, 0xd2, 0xbd, 0x00, 0x0c, 0xec, 0x0a, 0x26, 0xc0, 0x75, 0xac, 0xeb, 0x1d, 0xbc, 0xdc, 0xfb, 0xf7, 0x7a, 0xe3, 0x96, 0xd1, 0x75, 0xe9, 0x18, 0x15, 0x64, 0xf9, 0xcf, 0x1a, 0x9e, 0xca, 0xa2, 0xd6, 0x1e, 0x3a, 0xbf, 0xc6, 0x48, 0x51, 0x68, 0x7a, 0xc6, 0x78, 0xa9, 0xf8, 0x20, 0x59, 0xe7, 0xa8, 0x01, 0x00, 0x26, 0xde, 0x67, 0x4b, 0x63, 0xe3, 0x7b, 0x8e, 0x39, 0xed, 0xd2, 0xca, 0xce, 0xda, 0x07, 0x11, 0x1d, 0xb3, 0x20, 0xb0, 0x80, 0x75, 0x61, 0xba, 0xa0, 0xf2, 0x84, 0xbb, 0xf7, 0xa8, 0x6d, 0x41, 0xcc, 0xac, 0xf6, 0xc0, 0xe5, 0x0e, 0xfc, 0x8e, 0xfd, 0x55, 0xc3, 0xbd, 0x6f, 0xce, 0x5b, 0x8a, 0xc7, 0xc9, 0x49, 0xb2, 0x08, 0x2d, 0x03, 0xda, 0x39, 0x13, 0x15, 0x7b, 0xb2, 0xc4, 0xed, 0x0a, 0x14, 0x09, 0xbd, 0x0e, 0x7b, 0x05, 0x53, 0x59, 0x9a, 0x3b, 0x46, 0xe1, 0x90, 0xad, 0x36, 0x8d, 0x13, 0xcd, 0x3e, 0x5e, 0x3e, 0x08, 0xd3, 0x54, 0xfc, 0xa9, 0x75, 0xaf, 0xb2, 0x70, 0xec, 0xa2, 0xe2, 0x0b, 0xdf, 0xb0, 0x9f, 0x71, 0x9f, 0x72, 0xff, 0xa3, 0x3f, 0xaa, 0x7d, 0x8f, 0x3e, 0xf5, 0x6a, 0xe6, 0xd9, 0x17, 0xf2, 0xe1, 0x9a, 0x1e, 0x69, 0xbf, 0x36, 0xbe, 0xc6, 0xe4, 0xfe, 0xbf, 0x66, 0x0f, 0x1f, 0xae, 0x71, 0xb5, 0xc4, 0x10, 0x2b, 0x00, 0x19, 0xea, 0x78, 0xdd, 0x18, 0x74, 0x2e, 0xae, 0xb3, 0x7c, 0x87, 0xb7, 0x83, 0x6c, 0xe2, 0xf4, 0xc3, 0x35, 0xdb, 0x65, 0x71, 0x80, 0x65, 0x9c, 0x2f, 0x13, 0x62, 0x2c, 0x01, 0xbd, 0xe7, 0x5f, 0x1b, 0xd4, 0xd3, 0x0a, 0x7f, 0xf3, 0x0f, 0xd7, 0x77, 0x0e, 0x73, 0x81, 0x26, 0x1f, 0xae, 0x91, 0xc1, 0x82, 0x2c, 0x9b, 0x13, 0x1d, 0x54, 0x09, 0xc8, 0x82, 0x65, 0xb4, 0xff, 0x70, 0x4d, 0xd9, 0xc5, 0xf1, 0xc2, 0xfe, 0x7f, 0x07, 0x7d, 0xf6, 0xb3, 0xa8, 0xdd, 0xc0, 0x21, 0x15, 0x2f, 0x0e, 0x25, 0xf9, 0x63, 0xb4, 0x83, 0xb6, 0x55, 0x64, 0x5d, 0x73, 0xe7, 0x6f, 0x9e, 0x95, 0x00, 0x0f, 0x35, 0xe6, 0xd9, 0x0e, 0x9b, 0xea, 0xf9, 0x06, 0x12, 0x52, 0x66, 0x50, 0xd5, 0xa4, 0xfa, 0x84, 0x0d, 0x1b, 0xf0, 0xa8, 0x00, 0x02, 0x09, 0x8c, 0x77, 0xe8, 0x8d, 0x43, 0x0a, 0x4c, 0xc3, 0x73, 0x88, 0x6b, 0x74, 0x67, 0x93, 0xeb, 0x5b, 0xa5, 0xfa, 0x66, 0xad, 0x9c, 0xe2, 0x55, 0x04, 0x0b, 0x5d, 0x9e, 0x47, 0x8f, 0xc0, 0x5c, 0x74, 0x7e, 0x03, 0x27, 0x5d, 0xcb, 0x1b, 0xbb, 0xf3, 0x91, 0x2f, 0xfd, 0xb9, 0x36, 0xbe, 0x90, 0xc7, 0x9f, 0xe3, 0x1d, 0xcd, 0x9e, 0xbb, 0xce, 0x68, 0x3a, 0x9e, 0x7b, 0x9c, 0x04, 0xcf, 0x19, 0xbf, 0x04, 0x11, 0xcc, 0x6e, 0x26, 0x51, 0x31, 0xb7, 0xbd, 0xc9, 0xdc, 0x1e, 0xdf, 0x3d, 0xbb, 0xee, 0x5b, 0xd6, 0xb1, 0xfc, 0x63, 0xd3, 0xf0, 0x4f, 0xcf, 0xdf, 0xc6, 0xe8, 0xdb, 0x18, 0xfd, 0xde, 0xc7, 0xa8, 0x22, 0x4f, 0x2b, 0xa7, 0xd0, 0xd8, 0xbd, 0x9a, 0xb7, 0x53, 0x14, 0x58, 0x76, 0xa2, 0xd1, 0x15, 0x80, 0xf5, 0xa7, 0x02, 0xc5, 0x88, 0x83, 0xc5, 0x83, 0xff, 0x9a, 0x6b, 0x53, 0xa9, 0x95, 0xbd, 0x80, 0xf1, 0xb3, 0x2e, 0x99, 0xff, 0xb3, 0xb0, 0xa5, 0xa3, 0x49, 0x73, 0x9e, 0xb4, 0x8a, 0x31, 0x08, 0x84, 0x3a, 0xcc, 0xb2, 0x7b, 0xa9, 0xc8, 0x47, 0xc9, 0x6f, 0x5a, 0x5d, 0xeb, 0xe0, 0xaa, 0x4e, 0x22, 0xb7, 0xe5, 0x02, 0xdd, 0xc5, 0xe9, 0x8d, 0xc6, 0xc2, 0x66, 0xd5, 0xfe, 0xa6, 0xda, 0xb1, 0x69, 0x9a, 0x2d, 0x7f, 0xe9, 0x73, 0x8a, 0xf7, 0x3a, 0x57, 0xb9, 0x61, 0xbe, 0x50, 0x8d, 0xcc, 0xb2, 0x13, 0xd3, 0x35, 0x14, 0x97, 0x66, 0xdb, 0x09, 0x5c, 0x30, 0x75, 0x8e, 0xb9, 0x49, 0x24, 0x60, 0x19, 0xc6, 0xac, 0x2e, 0x48, 0xa2, 0xee, 0xb7, 0x3c, 0xad, 0x8c, 0xdb, 0x46, 0xed, 0x7d, 0xfb, 0xd1, 0xb8, 0xac, 0x99, 0xef, 0x7d, 0xd3, 0x50, 0x51, 0xf2, 0x6e, 0x7c, 0x12, 0xb7, 0x38, 0x8a, 0x6a, 0x08, 0x96, 0xd9, 0xde, 0x40, 0x6f, 0xa4, 0x85, 0x3f, 0xa8, 0x9f, 0x52, 0x67, 0x95, 0xaf, 0x1b, 0x5a, 0x79, 0x83, 0x65, 0x17, 0x30, 0xe7, 0xae, 0xa9, 0x33, 0xd1, 0xb7, 0xf8, 0x78, 0xde, 0xb4, 0xac, 0x8c, 0xa9, 0x73, 0xc6, 0x64, 0x65, 0x04, 0xf5, 0x9b, 0x8f, 0x95, 0xb1, 0x71, 0xce, 0x60, 0xac, 0x0c, 0x2d, 0xb3, 0x39, 0x33, 0x06, 0xf9, 0x61, 0x99, 0x8a, 0x89, 0x50, 0x1a, 0x5d, 0x9d, 0xf9, 0x73, 0x1b, 0x28, 0x15, 0x0d, 0x55, 0xe7, 0xc7, 0x34, 0xd5, 0x29, 0xa9, 0x19, 0xce, 0x62, 0x6e, 0xaa, 0x53, 0x55, 0x3b, 0xa0, 0x3b, 0x06, 0x71, 0xdf, 0xd8, 0xee, 0x1a, 0xf8, 0xcd, 0x79, 0xa6, 0x58, 0x7a, 0xd9, 0x9c, 0x6a, 0x05, 0x2f, 0x28, 0x5f, 0xe7, 0xc1, 0x79, 0x15, 0xec, 0xce, 0x31, 0x14, 0x61, 0x06, 0xfd, 0xc7, 0x35, 0x6a, 0x71, 0x46, 0x43, 0xaf, 0x98, 0x92, 0x3c, 0xb9, 0xbb, 0xd2, 0x61, 0x10, 0x23, 0x85, 0x06, 0x39, 0xb0, 0xe8, 0xc3, 0x3a, 0x5e, 0x8b, 0xaf, 0xd6, 0x51, 0x69, 0x54, 0xb3, 0xa2, 0xd9, 0x68, 0x84, 0x95, 0x67, 0x98, 0xc2, 0x84, 0x46, 0x1b, 0x28, 0x2c, 0x4c, 0x77, 0xd0, 0xcd, 0xf7, 0x0f, 0x97, 0x16, 0x52, 0x29, 0x97, 0x0b, 0x6f, 0x06, 0x15, 0xa9, 0xea, 0x95, 0x5a, 0x8d, 0x81, 0x1b, 0xfd, 0x6d, 0xa6, 0x02, 0xe0, 0xaf, 0xa2, 0xd1, 0x1d, 0x86, 0x08, 0x8e, 0xac, 0x8a, 0xbc, 0xf8, 0x1e, 0xa6, 0xb4, 0xc9, 0xaf, 0x6b, 0x3a, 0xfe, 0x42, 0xaf, 0x25, 0x79, 0x80, 0x3d, 0xa0, 0xd8, 0xcd, 0xbe, 0x7b, 0x37, 0x6f, 0x8a, 0x61, 0x79, 0x59, 0xd1, 0x04, 0xfa, 0x28, 0x4b, 0x84, 0xc2, 0x86, 0x4a, 0xe4, 0xb7, 0x80, 0x45, 0x8e, 0xc6, 0x6f, 0xab, 0xac, 0x2f, 0x74, 0xd6, 0x98, 0xaa, 0x0b, 0x0d, 0xa3, 0xe9, 0x5a, 0xbe, 0xe1, 0xcb, 0x56, 0xa6, 0x0b, 0xd7, 0x31, 0x26, 0x00, 0xea, 0x4c, 0xfa, 0xad, 0xd0, 0xd0, 0xd2, 0x8f, 0x94, 0x58, 0x96, 0x76, 0x94, 0xce, 0x77, 0x36, 0x1a, 0xd6, 0x71, 0x5e, 0x94, 0xf6, 0x72, 0x1b, 0x27, 0x2b, 0x31, 0x32, 0x1a, 0x82, 0x8b, 0xda, 0x49, 0xa0, 0xa6, 0xfc, 0x43, 0x5e, 0x26, 0x9f, 0x8d, 0xef, 0x9e, 0xfc, 0x6a, 0x3b, 0x12, 0xb2, 0x7d, 0xc8, 0xbf, 0xdd, 0x78, 0x33, 0x77, 0x45, 0xbe, 0xbb, 0x79, 0x98, 0x44, 0x9d, 0x8c, 0x47, 0xd9, 0xf9, 0x5d, 0xb3, 0xbd, 0x4d, 0x7b, 0x37, 0xd7, 0xeb, 0x2a, 0x58, 0x74, 0xb0, 0x14, 0x2d, 0x66, 0xb2, 0x4a, 0xe5, 0x4e, 0xac, 0xc8, 0xed, 0x8d, 0x9b, 0x7a, 0x65, 0x05, 0x43, 0xa2, 0xd9, 0x50, 0xa2, 0xdb, 0x28, 0x2c, 0xff, 0xb0, 0xf9, 0x8d, 0x73, 0x74, 0xad, 0xb0, 0xbd, 0xf7, 0xea, 0x7a, 0x42, 0x9d, 0x36, 0x73, 0x05, 0xbe, 0x15, 0xbc, 0xd9, 0xcc, 0x68, 0x48, 0xc0, 0x45, 0xf6, 0x60, 0x6a, 0x01, 0x49, 0x31, 0x14, 0x50, 0x83, 0xb1, 0x31, 0x0b, 0x0c, 0x25, 0x1c, 0x90, 0xa7, 0xe9, 0x62, 0xda, 0xe4, 0x22, 0x97, 0xc7, 0x05, 0xca, 0x7d, 0x6c, 0xfd, 0x3a, 0x14, 0xe0, 0x1d, 0x2e, 0xb4, 0xfe, 0x9b, 0xf4, 0xc7, 0xc0, 0x3c, 0x76, 0x74, 0x4d, 0x9b, 0x5f, 0x8e, 0x12, 0xc4, 0x89, 0x9e, 0xee, 0xb9, 0x4e, 0x21, 0x96, 0xe2, 0xda, 0x9e, 0x17, 0xe1, 0x79, 0xde, 0x25, 0x47, 0x23, 0x87, 0x3b, 0x2c, 0xb7, 0x78, 0x97, 0x27, 0xbb, 0x89, 0x58, 0x84, 0x97, 0x70, 0x63, 0x6e, 0x12, 0xed, 0xf6, 0x37, 0x41, 0x4e, 0x76, 0x96, 0xef, 0xe2, 0xbf, 0x2c, 0x76, 0x4a, 0x13, 0xf5, 0xd5, 0x17, 0xa0, 0xd4, 0xda, 0x70, 0x51, 0xde, 0x08, 0xb5, 0x5c, 0x09, 0x60, 0xf2, 0xaa, 0x50, 0x09, 0x19, 0x86, 0x47, 0x29, 0xb9, 0x86, 0xed, 0x0d, 0x0b, 0x99, 0x12, 0x81, 0x4d, 0x7f, 0x7b, 0x21, 0x42, 0x3c, 0x22, 0xc8, 0xeb, 0x0c, 0xfd, 0xa1, 0x81, 0x3f, 0x8d, 0x28, 0x40, 0x47, 0x0a, 0x07, 0x92, 0x83, 0xa4, 0x87, 0x06, 0xc0, 0x5f, 0xe2, 0x1b, 0x62, 0xf3, 0xa2, 0xd5, 0xe9, 0x9d, 0x0e, 0x30, 0x79, 0x1c, 0xb4, 0xbb, 0xda, 0xab, 0x83, 0x4f, 0x9e, 0x3c, 0x48, 0x4e, 0x62, 0xb2, 0x5e, 0x10, 0xf3, 0x26, 0x51, 0xf5, 0x52, 0x4e, 0x33, 0x41, 0x83, 0x8c, 0xfa, 0x12, 0xd7, 0xb5, 0xec, 0x0e, 0x73, 0xe4, 0x8b, 0x8f, 0x58, 0x84, 0xaf, 0xf6, 0x1e, 0x2d, 0x06, 0x67, 0xa8, 0x80, 0x2f, 0x2b, 0x87, 0xe4, 0xbb, 0xe3, 0x18, 0x48, 0xfb, 0x36, 0x3f, 0xfa, 0x7b, 0x28, 0x7d, 0x2c, 0x84, 0xc6, 0xea, 0xce, 0x82, 0x8d, 0x47, 0xb9, 0x8d, 0xd3, 0x17, 0x0c, 0x53, 0x7e, 0x0e, 0x15, 0x17, 0x05, 0x36, 0xb7, 0xb1, 0x31, 0x47, 0xe2, 0x21, 0x4f, 0x50, 0xed, 0xea, 0xca, 0x26, 0xbb, 0x28, 0x06, 0x80, 0x63, 0x6d, 0x29, 0x4d, 0xca, 0xbc, 0x1b, 0x1b, 0x5e, 0xb5, 0xf5, 0xb9, 0x35, 0x20, 0x78, 0x14, 0x3d, 0x1b, 0x39, 0x72, 0xeb, 0x9a, 0x5c, 0x1d, 0x34, 0xf6, 0x87, 0x88, 0xf5, 0x27, 0xcc, 0x8f, 0x1e, 0xc2, 0x5e, 0x41, 0xa4, 0x9c, 0xce, 0xb3, 0xa3, 0xdd, 0x97, 0x9a, 0x25, 0x4e, 0x33, 0x06, 0xda, 0x91, 0x5f, 0xd5, 0xd6, 0x5a, 0x54, 0x8a, 0x7a, 0xcc, 0x47, 0xd6, 0x6d, 0xb2, 0xee, 0xcd, 0x32, 0x3b, 0xdc, 0xeb, 0xa6, 0xd0, 0x38, 0x40, 0x23, 0x86, 0x35, 0x3e, 0xc9, 0xee, 0x89, 0x36, 0x2a, 0xb9, 0x11, 0x7c, 0x34, 0x40, 0x7d, 0xa0, 0x60, 0x2f, 0x2f, 0xf0, 0x9e, 0xda, 0xca, 0x8b, 0xc5, 0xe3, 0xa8, 0x15, 0x3a, 0x41, 0xd5, 0xc1, 0x67, 0x10, 0x61, 0xea, 0x6e, 0x61, 0x7c, 0x19, 0xde, 0xbc, 0x0a, 0x69, 0x97, 0x2e, 0x26, 0x8d, 0x40, 0x93, 0xe7, 0x74, 0x57, 0x2b, 0xfc, 0xa9, 0x07, 0x59, 0x33, 0x41, 0x33, 0xa2, 0x45, 0xf9, 0xde, 0x1b, 0x27, 0x35, 0x57, 0x4c, 0x3a, 0x92, 0x10, 0x4c, 0x0f, 0xbb, 0x05, 0xc9, 0x3f, 0xf7, 0x5d, 0xa7, 0xc7, 0x6f, 0x0e, 0x65, 0x97, 0x0e, 0xda, 0x5c, 0x49, 0x6a, 0x5f, 0x27, 0xca, 0x73, 0x5a, 0x44, 0x81, 0x68, 0x21, 0x78, 0xf3, 0x81, 0xbd, 0x8f, 0x61, 0x2b, 0x82, 0xd7, 0x00, 0xac, 0x40, 0xf5, 0x2e, 0xb3, 0xfc, 0xd8, 0x3e, 0x84, 0xc5, 0x1e, 0xb3, 0x90, 0x90, 0x02, 0x4e, 0x44, 0x09, 0x5d, 0xb0, 0x21, 0xcf, 0x5b, 0x91, 0xbb, 0xca, 0xda, 0x14, 0xb7, 0x5d, 0x6e, 0x81, 0x11, 0x9d, 0xe7, 0x0c, 0x25, 0x18, 0xbd, 0x72, 0xa4, 0x0b, 0xef, 0x10, 0xc5, 0xc4, 0xa1, 0x79, 0x35, 0xbc, 0x43, 0xe4, 0xa2, 0x67, 0x99, 0x9e, 0xba, 0xe7, 0xc0, 0xf2, 0xd9, 0x7e, 0x4c, 0xc0, 0xb0, 0xd1, 0xa7, 0xde, 0x8f, 0x2a, 0xf8, 0x26, 0xa1, 0xea, 0xbc, 0x1d, 0x95, 0xdd, 0x8a, 0xee, 0xc9, 0xda, 0x13, 0x2b, 0xdd, 0x38, 0xb6, 0xa3, 0xdf, 0x3a, 0xb5, 0xee, 0x2d, 0x80, 0x0d, 0xfe, 0x83, 0xcc, 0xa5, 0x46, 0x76, 0x6d, 0x10, 0x1e, 0x9c, 0x61, 0x36, 0x6e, 0xde, 0xed, 0x47, 0x2e, 0x9b, 0x2a, 0x29, 0x5f, 0x1b, 0xd6, 0x50, 0x99, 0x4e, 0x13, 0x70, 0x0f, 0xdf, 0xe8, 0x35, 0xc7, 0x82, 0x39, 0x44, 0xd9, 0x6b, 0x1e, 0x95, 0xaf, 0x6d, 0x53, 0x8d, 0x3e, 0x82, 0xf4, 0xd0, 0xf6, 0x38, 0xef, 0xd5, 0x43, 0x61, 0x5c, 0x66, 0x48, 0x39, 0x55, 0x00, 0xf5, 0x10, 0xed, 0x4a, 0x94, 0xac, 0xef, 0xb4, 0x85, 0x44, 0x64, 0xe7, 0x21, 0x4d, 0x51, 0xc4, 0xd8, 0x20, 0xe8, 0x96, 0x5f, 0x3a, 0x0f, 0x51, 0xf3, 0x11, 0xd4, 0xec, 0x05, 0x7d, 0x07, 0x68, 0x94, 0x5b, 0xa5, 0xbb, 0x1a, 0x1c, 0x7c, 0xef, 0x8c, 0xcd, 0x73, 0xca, 0xe7, 0x30, 0xe2, 0xab, 0x0b, 0x2d, 0x9a, 0x6d, 0x46, 0x11, 0xc1, 0xeb, 0xd5, 0x43, 0x76, 0xb1, 0x87, 0x92, 0xd9, 0xfb, 0x8a, 0xc2, 0xeb, 0x0c, 0xc8, 0x33, 0x63, 0x4e, 0x76, 0x36, 0x68, 0x46, 0xa4, 0x6c, 0x63, 0x11, 0xf5, 0xf1, 0xe7, 0x93, 0x5e, 0x41, 0x88, 0xb6, 0x07, 0x8a, 0x90, 0x79, 0x0d, 0x05, 0x58, 0xda, 0x93, 0x0e, 0xd8, 0x91, 0xc2, 0x26, 0x76, 0x46, 0x0f, 0x72, 0xd9, 0xa3, 0xcb, 0xb6, 0xb2, 0x16, 0xd7, 0x7c, 0x25, 0xc9, 0xc6, 0x43, 0xc1, 0x7d, 0x3c, 0x9b, 0xdd, 0xe2, 0x9a, 0x28, 0x46, 0x71, 0x2a, 0xbd, 0x04, 0xd3, 0xd1, 0xf2, 0xcc, 0xf7, 0xb8, 0x0e, 0xa0, 0x58, 0x37, 0x6c, 0x43, 0x97, 0xdd, 0xd1, 0x0d, 0xb7, 0x3e, 0x10, 0x84, 0xb5, 0x8a, 0x90, 0x02, 0x40, 0xa1, 0xc0, 0xa2, 0xec, 0x37, 0xcf, 0xc5, 0x01, 0xb6, 0x0c, 0x0d, 0xf4, 0xa8, 0x32, 0x06, 0xa4, 0xd4, 0x66, 0xe3, 0xea, 0xec, 0xc2, 0xbf, 0xdd, 0xd8, 0x63, 0xbc, 0x91, 0xe1, 0xf2, 0x55, 0xa2, 0x6f, 0xe0, 0xff, 0x4a, 0xdd, 0x77, 0x66, 0xad, 0xea, 0xdd, 0xb3, 0x7c, 0xc7, 0xfd, 0x7d, 0xea, 0x91, 0x4a, 0xbf, 0x96, 0xf0, 0xd5, 0x51, 0xf4, 0x57, 0x26, 0xf8, 0xde, 0x84, 0xd4, 0xaf, 0x21, 0xa4, 0x9e, 0x26, 0x89, 0xb4, 0xa3, 0xf0, 0x4d, 0x0a, 0xbd, 0x8a, 0x14, 0x12, 0x3b, 0x4c, 0x9d, 0xc9, 0xa4, 0x3a, 0xdb, 0x1f, 0x9c, 0x1c, 0x36, 0x4f, 0x8f, 0xdf, 0xb1, 0xfb, 0xe6, 0xc5, 0x7c, 0x35, 0x74, 0xcf, 0x5c, 0xa9, 0xec, 0x24, 0x49, 0xe2, 0x7d, 0x11, 0x17, 0xaf, 0xec, 0xa2, 0x39, 0x77, 0x47, 0xd5, 0x68, 0xbc, 0x22, 0x1b, 0x1e, 0xf1, 0x83, 0x17, 0x59, 0x28, 0xa3, 0x10, 0x17, 0x7d, 0xab, 0x59, 0xc2, 0x0b, 0x68, 0x91, 0x26, 0x60, 0x8d, 0x43, 0x1f, 0x75, 0x22, 0x5f, 0x3f, 0x82, 0x2f, 0x8a, 0x98, 0x7c, 0x24, 0x41, 0x83, 0x7e, 0x64, 0x15, 0xc9, 0x10, 0xde, 0xc4, 0xf1, 0x34, 0x30, 0xbd, 0x51, 0x1e, 0xcd, 0x28, 0x14, 0x9c, 0x99, 0xf0, 0x9f, 0xc5, 0xff, 0xbe, 0xb9, 0xab, 0xba, 0x4e, 0xaa, 0x37, 0x1c, 0x56, 0x78, 0x33, 0x80, 0xe1, 0x7d, 0x4b, 0xb7, 0x55, 0x25, 0x04, 0xbe, 0x2b, 0xbf, 0x95, 0x22, 0x9a, 0xba, 0x5d, 0xac, 0xaf, 0xe2, 0xaf, 0xe2, 0x75, 0xbf, 0x90, 0xc3, 0xaa, 0xc2, 0x36, 0xcc, 0x05, 0x27, 0xdb, 0x11, 0x04, 0x13, 0x34, 0x33, 0xda, 0xa3, 0x47, 0xda, 0x1b, 0x93, 0xd8, 0x9b, 0xb4, 0x13, 0x05, 0x01, 0x86, 0xa0, 0xe3, 0x65, 0x84, 0x79, 0xf3, 0xb9, 0x2e, 0x3e, 0x3b, 0x1a, 0xa9, 0x92, 0x6f, 0x4a, 0x3a, 0x43, 0xc5, 0x23, 0xb1, 0x7d, 0x87, 0xdf, 0x9a, 0xa2, 0xb9, 0x23, 0x09, 0x5a, 0x67, 0xaa, 0x06, 0xc9, 0xd0, 0xa6, 0x53, 0xc3, 0x16, 0x73, 0xa3, 0x67, 0xde, 0x34, 0x9a, 0x2c, 0x7c, 0x1c, 0x9a, 0xc4, 0x97, 0x77, 0xa8, 0x5d, 0x5a, 0xf3, 0x45, 0x4e, 0x34, 0x15, 0x0f, 0xbd, 0x76, 0xa9, 0x8e, 0x3c, 0x52, 0xce, 0x07, 0xd7, 0x17, 0xbf, 0xe8, 0xcc, 0xba, 0x1e, 0x17, 0x3e, 0x02, 0xa3, 0x4a, 0xe7, 0x77, 0xe2, 0x15, 0x3b, 0x4f, 0xda, 0xeb, 0xf8, 0xc5, 0xce, 0xd7, 0xfb, 0x2a, 0x9e, 0x31, 0x5e, 0x11, 0x75, 0x1c, 0xb0, 0xdf, 0x8a, 0x1b, 0xa2, 0x7e, 0x4a, 0xec, 0xb7, 0xee, 0x1c, 0x7b, 0x6e, 0x43, 0x5f, 0xca, 0x3f, 0xf6, 0x3c, 0x3a, 0x5e, 0xdb, 0x45, 0xf6, 0x0a, 0xd4, 0x3d, 0xd3, 0x4b, 0xd6, 0x4b, 0x51, 0x2b, 0x45, 0xeb, 0xdb, 0x5a, 0x46, 0xf9, 0xea, 0xd8, 0x63, 0xef, 0xa0, 0x81, 0x7b, 0x3d, 0x12, 0xd1, 0x95, 0xe5, 0x21, 0x53, 0xb3, 0xea, 0xc0, 0x00, 0x68, 0xc5, 0x61, 0x97, 0x4a, 0xd7, 0xf1, 0x84, 0xbc, 0x98, 0xe1, 0xf8, 0x85, 0x41, 0xb0, 0x75, 0x20, 0x06, 0x21, 0xad, 0x52, 0xa2, 0x3a, 0xb4, 0x27, 0x4a, 0xe6, 0x8b, 0x5f, 0x08, 0x27, 0x21, 0xbd, 0x48, 0xe6, 0xd7, 0xe5, 0x5a, 0xae, 0x01, 0xcd, 0x53, 0x7b, 0x14, 0x5c, 0x04, 0x46, 0xac, 0xe3, 0xcd, 0x21, 0x27, 0x72, 0xa8, 0xa1, 0x79, 0xec, 0xd6, 0xc3, 0x5b, 0x4b, 0x77, 0x43, 0xd9, 0x6e, 0xe4, 0x37, 0x34, 0xea, 0x83, 0x1c, 0x94, 0xd6, 0x52, 0x9a, 0x59, 0x6e, 0xd3, 0x63, 0xa2, 0x23, 0x56, 0x59, 0xcf, 0x3a, 0x69, 0x3d, 0xb4, 0x43, 0xe0, 0xfa, 0x68, 0xe9, 0x6f, 0x85, 0x96, 0x0b, 0x5a, 0x5a, 0xc5, 0x65, 0x78, 0xf8, 0x5b, 0x6c, 0x94, 0x7b, 0x76, 0xcf, 0x5a, 0x61, 0xaa, 0xc1, 0x84, 0xc7, 0x25, 0xf5, 0x78, 0x30, 0x87, 0xf4, 0x22, 0x72, 0xe8, 0x4a, 0x6f, 0xaf, 0x0f, 0x49, 0x52, 0x85, 0xbd, 0x6c, 0xf2, 0x78, 0xd5, 0xca, 0xfd, 0xf8, 0xfe, 0x88, 0xe9, 0x76, 0x9e, 0xdd, 0xf3, 0x40, 0x76, 0x6f, 0x4e, 0x13, 0xd8, 0xbc, 0x11, 0x69, 0xed, 0x72, 0xa2, 0xb5, 0xab, 0xc7, 0x63, 0xe7, 0xad, 0x12, 0xb5, 0x1a, 0xd0, 0x31, 0x9d, 0x24, 0x84, 0x6a, 0x87, 0x9b, 0x47, 0xbd, 0x02, 0xa9, 0xe5, 0xbf, 0x4c, 0x16, 0x2b, 0x6e, 0xc4, 0xbb, 0xcd, 0x91, 0xbd, 0xbe, 0x0a, 0xaa, 0x34, 0xe8, 0x90, 0x58, 0x6e, 0xce, 0x2e, 0x16, 0x08, 0x17, 0xf4, 0x44, 0x4d, 0x4a, 0x8a, 0xe2, 0xc6, 0x9f, 0xd5, 0x06, 0x03, 0x54, 0x31, 0xf9, 0xd8, 0x63, 0x48, 0x8e, 0x97, 0xdf, 0x9b, 0xcb, 0x62, 0xb8, 0x68, 0x4f, 0xd6, 0xae, 0xfe, 0x0b, 0x2e, 0x4e, 0x30, 0xbb, 0x2e, 0x41, 0x3d, 0x7b, 0xcf, 0xa1, 0x5c, 0xab, 0x74, 0x6f, 0x77, 0xdb, 0x35, 0x28, 0xaa, 0x3f, 0x3b, 0x40, 0x25, 0xb5, 0xa5, 0xe7, 0x8a, 0xc2, 0xcb, 0x16, 0xf9, 0x27, 0x55, 0xfe, 0xb4, 0x2d, 0x16, 0xae, 0x4d, 0x55, 0x75, 0x2f, 0x79, 0xb5, 0xec, 0x20, 0xc3, 0xbc, 0xde, 0x6e, 0x75, 0xb1, 0xb2, 0x7c, 0x89, 0xed, 0x53, 0x1c, 0x83, 0x6d, 0x7c, 0x77, 0x5d, 0x6c, 0xa8, 0x8b, 0x63, 0x90, 0x2d, 0xee, 0xcc, 0x72, 0xa6, 0x31, 0xa6, 0xbd, 0xd8, 0xa5, 0x93, 0xd5, 0x1d, 0x69, 0x8d, 0xab, 0xfd, 0xc4, 0x61, 0x56, 0x1e, 0x1e, 0x21, 0xad, 0xdc, 0x4d, 0xbd, 0x14, 0x97, 0x70, 0xe9, 0x2e, 0x3e, 0xfc, 0xd4, 0x5f, 0xa6, 0xa1, 0x13, 0x3f, 0x7c, 0x6c, 0xd4, 0xa7, 0x4a, 0x60, 0x49, 0x97, 0xce, 0x78, 0x89, 0x9f, 0xfc, 0xec, 0xc3, 0x7d, 0xdd, 0x4b, 0xf5, 0xdd, 0xc2, 0xcb, 0x24, 0xde, 0xdb, 0xfb, 0x08, 0x78, 0xb6, 0xcf, 0x92, 0xc7, 0x4d, 0x96, 0xde, 0xc0, 0xf8, 0x33, 0xb0, 0xe5, 0x16, 0xfe, 0x98, 0xc1, 0xdf, 0x71, 0xe3, 0xef, 0x54, 0xfa, 0xcb, 0x58, 0xd4, 0x11, 0x1d, 0xaa, 0x8c, 0x85, 0xe0, 0xe9, 0x26, 0x46, 0x8d, 0x09, 0x5f, 0x7a, 0x03, 0x1c, 0x19, 0x2c, 0x3f, 0xe1, 0x0d, 0x3b, 0x65, 0x99, 0xe1, 0x55, 0x03, 0x0d, 0x27, 0x28, 0x0c, 0xc7, 0x2b, 0x2c, 0xde, 0x78, 0xfc, 0x4d, 0xbf, 0xd9, 0x31, 0x96, 0x2a, 0xbb, 0x72, 0x4f, 0x8a, 0x94, 0xc6, 0x39, 0x2f, 0x06, 0x1e, 0x52, 0x0b, 0xa7, 0xd4, 0x07, 0x5a, 0x45, 0xa6, 0x6f, 0x23, 0xa5, 0x98, 0x3a, 0x75, 0xca, 0xa1, 0x84, 0xbc, 0x3a, 0x37, 0x21, 0x52, 0xd8, 0x31, 0x08, 0x9e, 0xcc, 0x4e, 0x41, 0x74, 0xf9, 0xe3, 0xe4, 0x2a, 0x99, 0x5c, 0x51, 0x3b, 0xa6, 0x39, 0xe9, 0x9e, 0xe5, 0x80, 0x18, 0x30, 0xdb, 0xd9, 0x1e, 0xe5, 0xa2, 0xa6, 0x55, 0x47, 0x19, 0x2f, 0x1c, 0xad, 0x7c, 0x90, 0x2a, 0x63, 0x55, 0x7a, 0x36, 0xba, 0x57, 0xad, 0x7d, 0x06, 0x95, 0xea, 0x3c, 0xfc, 0x8f, 0xff, 0xf7, 0x7f, 0xff, 0xf3, 0xdf, 0xff, 0xcf, 0x3b, 0x69, 0xa6, 0xf5, 0x05, 0x5d, 0xf3, 0xd1, 0x45, 0xd7, 0x43, 0x41, 0xe1, 0x1e, 0xa4, 0x4a, 0xf9, 0x5d, 0x10, 0x54, 0xd7, 0x8f, 0xbb, 0x7b, 0x58, 0x87, 0x76, 0x71, 0x8a, 0xb9, 0xbc, 0x9e, 0xfa, 0x39, 0xf2, 0x27, 0x88, 0x95, 0x99, 0xf4, 0x97, 0x75, 0x95, 0x7c, 0xc9, 0xa1, 0x1d, 0x8c, 0xaf, 0x14, 0x5a, 0x6a, 0x52, 0x06, 0xf9, 0x84, 0x7c, 0xd8, 0xe6, 0x41, 0xe1, 0xe2, 0xec, 0x26, 0x8d, 0x6a, 0x8e, 0xb8, 0x20, 0xd8, 0x54, 0x49, 0xe3, 0x7b, 0xaf, 0x86, 0x48, 0x46, 0x20, 0x8d, 0x1b, 0x51, 0xa8, 0x76, 0xf6, 0x03, 0x7b, 0xa7, 0xd7, 0xa9, 0x9e, 0xa0, 0x79, 0xad, 0xe5, 0x9a, 0x92, 0xdc, 0x2f, 0x2a, 0xdb, 0xc2, 0x99, 0x9f, 0x27, 0xe9, 0x24, 0x5f, 0x68, 0xa6, 0x17, 0xe9, 0x45, 0x55, 0x53, 0x87, 0xdc, 0x93, 0xa6, 0x78, 0x79, 0x34, 0x3b, 0xf2, 0x0a, 0xd9, 0x39, 0xeb, 0x43, 0x05, 0xa9, 0x0e, 0xc8, 0xb6, 0xc1, 0x90, 0x39, 0x73, 0xd0, 0xac, 0xda, 0x74, 0x3c, 0xdd, 0xb9, 0x2d, 0xbf, 0x93, 0xed, 0x5d, 0xd5, 0xc1, 0x85, 0xf8, 0xcb, 0xb8, 0xeb, 0xf0, 0x3f, 0x41, 0x4f, 0x7b, 0x30, 0x30, 0x9b, 0x0a, 0x85, 0x8f, 0xdc, 0x66, 0x37, 0xc9, 0xd0, 0x0b, 0x59, 0x94, 0x5d, 0x3a, 0x08, 0x4c, 0x76, 0xed, 0x8b, 0x21, 0x88, 0x97, 0x39, 0x7d, 0xa3, 0x1b, 0x12, 0x32, 0x83, 0x1b, 0x53, 0x8f, 0xf9, 0x9f, 0x45, 0x26, 0xb0, 0x47, 0x73, 0x53, 0x1d, 0x0f, 0xf1, 0xfb, 0x6d, 0xf1, 0xa4, 0x6e, 0xb0, 0xae, 0x89, 0xcf, 0x99, 0x12, 0x27, 0x95, 0xdf, 0xfa, 0xa9, 0xa9, 0xb0, 0xbc, 0x0a, 0x37, 0x7a, 0x1e, 0x11, 0xcc, 0xf2, 0xd1, 0x87, 0x96, 0x85, 0x41, 0x3f, 0xb3, 0x75, 0x54, 0xd2, 0x71, 0x54, 0x9a, 0x63, 0x82, 0x9a, 0xbd, 0xb1, 0xa4, 0x4f, 0xf9, 0xcd, 0x4b, 0xa6, 0x67, 0x48, 0x32, 0xc5, 0xb8, 0x22, 0xc5, 0x52, 0x87, 0xf0, 0xdc, 0x9e, 0x40, 0xb7, 0x19, 0xbf, 0xcc, 0xb0, 0x5a, 0xd5, 0x7e, 0xb9, 0xbd, 0x6f, 0xa2, 0xb1, 0xf7, 0x55, 0xe8, 0x24, 0x37, 0xa4, 0x70, 0x1b, 0x60, 0x5e, 0x19, 0x97, 0x09, 0xf9, 0xf5, 0x5a, 0xca, 0xaa, 0x7f, 0xb9, 0xa6, 0x32, 0x7c, 0xed, 0xb6, 0xd2, 0xa3, 0xb7, 0xdd, 0xcd, 0x54, 0x56, 0x91, 0x33, 0xbe, 0xde, 0x67, 0x5f, 0xfc, 0xcd, 0x68, 0x19, 0xb6, 0x60, 0x68, 0xda, 0x59, 0x9f, 0x22, 0xe6, 0x07, 0xe2, 0xd4, 0xed, 0xb2, 0x00, 0xa8, 0x8e, 0x68, 0x7c, 0x7c, 0x2f, 0x2c, 0xcd, 0x1f, 0xdf, 0x9b, 0x3a, 0x16, 0x68, 0x3c, 0x77, 0x0e, 0xf3, 0xe9, 0xd5, 0x7c, 0x14, 0x16, 0x1d, 0x0d, 0x6f, 0xf4, 0x87, 0x35, 0x55, 0x1b, 0x4b, 0x1f, 0x49, 0xb2, 0x69, 0x53, 0x88, 0x83, 0xd6, 0x3b, 0x39, 0x8a, 0xd1, 0x41, 0xe9, 0xad, 0x86, 0x7f, 0x91, 0x3f, 0xf3, 0xc3, 0xfb, 0xfd, 0xf2, 0x7e, 0x79, 0x39, 0x22, 0x2f, 0x89, 0xe8, 0xef, 0xad, 0xba, 0xb6, 0xa6, 0x36, 0x6a, 0x96, 0x1f, 0x1a, 0x1a, 0xca, 0x20, 0xf1, 0x0c, 0xd2, 0x8b, 0x33, 0xe8, 0x09, 0x54, 0x5e, 0xc2, 0xa1, 0x5d, 0x69, 0x7b, 0xe2, 0xc4, 0x0b, 0x86, 0xb0, 0xc9, 0x06, 0x12, 0x54, 0x7c, 0xd3, 0x8d, 0xf9, 0xde, 0x33, 0x29, 0x9c, 0x7f, 0x0e, 0xce, 0x67, 0x70, 0xa3, 0x73, 0x70, 0x23, 0x06, 0x37, 0x39, 0x07, 0x37, 0x61, 0x70, 0xb3, 0x73, 0x70, 0x33, 0x06, 0xe7, 0xb9, 0x67, 0x1b, 0x82, 0x86, 0x61, 0x1a, 0x54, 0x80, 0xc7, 0x6e, 0x12, 0xb2, 0x81, 0x31, 0x76, 0x4e, 0x3f, 0x6c, 0xbd, 0xb1, 0x40, 0xe7, 0xb8, 0xbd, 0x20, 0xe5, 0x3d, 0x21, 0x69, 0xff, 0x79, 0x6b, 0x71, 0x92, 0x88, 0x3d, 0xae, 0x64, 0x73, 0x53, 0x8e, 0x98, 0xd8, 0xec, 0x80, 0x91, 0xa3, 0x7d, 0x92, 0x41, 0x9d, 0xe6, 0xbb, 0x45, 0xcd, 0x7c, 0x8e, 0xac, 0x93, 0xff, 0x8b, 0x9a, 0xff, 0x3d, 0xa0, 0x23, 0x06, 0x3a, 0x19, 0x00, 0x4a, 0x7b, 0x21, 0xa9, 0xb1, 0xd2, 0x17, 0xa2, 0xba, 0x70, 0xe2, 0x62, 0x71, 0x28, 0x8e, 0x8d, 0x8b, 0x63, 0x07, 0x19, 0x0b, 0x87, 0xdf, 0x2e, 0xce, 0xf7, 0x23, 0x8c, 0x73, 0xca, 0x86, 0x44, 0x7b, 0xb6, 0xf5, 0xe2, 0xd5, 0xf3, 0x50, 0x3c, 0xef, 0x36, 0x71, 0x5f, 0xbf, 0x88, 0x02, 0xda, 0x3e, 0x83, 0x28, 0x9d, 0x92, 0xae, 0x3b, 0x5a, 0x69, 0x83, 0xd4, 0x30, 0xfe, 0xbd, 0x27, 0xc4, 0xec, 0x49, 0x8d, 0x6c, 0xd4, 0xfb, 0x0c, 0x1c, 0xe7, 0xb8, 0x83, 0x17, 0x9a, 0x9a, 0x41, 0x8b, 0x2d, 0x27, 0x0d, 0xbb, 0xf9, 0xbe, 0xa2, 0xf3, 0x32, 0x30, 0xd8, 0xc4, 0x1b, 0x88, 0x89, 0x1b, 0x96, 0xba, 0xac, 0x44, 0x63, 0xd3, 0xd4, 0x9a, 0xaa, 0x7c, 0xf1, 0xea, 0x85, 0x77, 0xe9, 0x8b, 0x07, 0x82, 0xd4, 0x2e, 0x6c, 0x4f, 0x8a, 0x9c, 0x55, 0x1f, 0xd1, 0x88, 0x56, 0x9b, 0x5e, 0xcd, 0xfd, 0x12, 0xcb, 0x3a, 0x45, 0x46, 0x1f, 0x6b, 0x3a, 0xe7, 0x65, 0x60, 0x90, 0xbd, 0x6f, 0x45, 0xb4, 0x9e, 0xc5, 0x6b, 0x6a, 0x27, 0xec, 0x29, 0x40, 0x2a, 0xdf, 0xde, 0x07, 0xed, 0xeb, 0xed, 0x5e, 0xc1, 0x5a, 0xde, 0xf5, 0x28, 0x14, 0x6d, 0xcc, 0x82, 0x3e, 0x61, 0x25, 0x7e, 0x87, 0x03, 0xda, 0x29, 0x9e, 0x3a, 0x15, 0x6c, 0xeb, 0x7d, 0xa7, 0x68, 0xb0, 0x2b, 0x41, 0xe3, 0x38, 0xb8, 0xf0, 0xc9, 0x9e, 0xe1, 0xa1, 0x8e, 0xec, 0x1e, 0xa2, 0xa1, 0x17, 0xaa, 0xce, 0xe5, 0x47, 0xf6, 0x06, 0xdc, 0x7d, 0xd1, 0xbc, 0xce, 0xad, 0xa8, 0x2e, 0x72, 0x6b, 0x3c, 0xb3, 0xd9, 0x08, 0x3c, 0x90, 0x0a, 0x54, 0x89, 0x66, 0x63, 0x79, 0xc3, 0x99, 0xc5, 0xfc, 0xaf, 0xd0, 0xfc, 0x3d, 0x5a, 0xeb, 0xf8, 0x06, 0xa8, 0xe0, 0xf6, 0x85, 0x1b, 0xcf, 0xf2, 0xd6, 0x39, 0x0d, 0xb5, 0xc1, 0x6d, 0x11, 0x32, 0x86, 0xda, 0xec, 0x25, 0xbb, 0x94, 0xba, 0xa8, 0x7a, 0xba, 0x20, 0x38, 0xed, 0x12, 0xc1, 0xdc, 0xc1, 0x48, 0x81, 0x26, 0x64, 0xac, 0x5f, 0x1f, 0xe5, 0xfe, 0xe7, 0xa7, 0x9f, 0x56, 0x7d, 0x56, 0xad, 0x97, 0x28, 0x79, 0xbd, 0x15, 0x51, 0x8e, 0xd5, 0xb7, 0x88, 0x49, 0x1e, 0x6d, 0xf5, 0x3e, 0x55, 0x9a, 0xbe, 0xb7, 0xbc, 0xd6, 0x1e, 0x46, 0xca, 0x5e, 0x17, 0xf5, 0x73, 0x6f, 0xfa, 0x08, 0x14, 0x4c, 0x65, 0xa3, 0xb2, 0x1e, 0xde, 0x6d, 0xbf, 0x31, 0xad, 0x5f, 0xf8, 0xc2, 0xf7, 0xe6, 0x51, 0x79, 0x91, 0x30, 0x4a, 0x40, 0xf8, 0x9d, 0x35, 0x70, 0x9c, 0xf5, 0x32, 0xea, 0xe5, 0x07, 0x45, 0x7e, 0xe6, 0xe1, 0x9c, 0xfa, 0x84, 0x39, 0xd5, 0xc1, 0xe7, 0x17, 0x06, 0x39, 0xbc, 0x8a, 0x34, 0x6c, 0xfa, 0xc9, 0x5c, 0xf6, 0xae, 0xd3, 0x79, 0xf7, 0x8b, 0x3b, 0x6b, 0xf8, 0x5f, 0x70, 0xd4, 0x34, 0x9f, 0x87, 0x3a, 0xe7, 0x93, 0x41, 0x24, 0x73, 0xfd, 0x0c, 0x66, 0x7d, 0xad, 0xb5, 0x88, 0xb7, 0x34, 0x6b, 0xca, 0x4d, 0x1a, 0x9b, 0xa5, 0x48, 0x42, 0x83, 0x65, 0x54, 0xd3, 0xbe, 0xa1, 0x40, 0x77, 0x86, 0xbc, 0x6a, 0xe4, 0xa6, 0xec, 0xe5, 0xf3, 0xb8, 0x3e, 0xae, 0x44, 0x86, 0x5c, 0x34, 0x81, 0xc5, 0x48, 0x7c, 0x31, 0xde, 0xeb, 0x66, 0x75, 0x3b, 0x89, 0xbe, 0x18, 0x84, 0x4a, 0xe6, 0xd0, 0x21, 0xab, 0x09, 0xeb, 0xf4, 0xbb, 0xdf, 0x02, 0x1b, 0xd2, 0xd9, 0x27, 0x3e, 0x0d, 0xd9, 0xad, 0x6b, 0xf5, 0x6d, 0x69, 0x3e, 0xb0, 0xa5, 0x7b, 0x1c, 0xe0, 0xd9, 0xb8, 0x5d, 0xf4, 0x70, 0x43, 0x07, 0x3c, 0x4a, 0x74, 0x8e, 0x85, 0xfd, 0x2b, 0x42, 0xc9, 0x8e, 0x1d, 0xf3, 0x51, 0x19, 0xe5, 0xbd, 0xb7, 0x0e, 0xe9, 0xa6, 0x8c, 0x5a, 0x15, 0x4a, 0xd1, 0xd7, 0xa9, 0x47, 0x8d, 0xee, 0x66, 0xd2, 0x5a, 0xad, 0xbb, 0xc8, 0xd6, 0xe5, 0x71, 0xb0, 0xcc, 0xd1, 0x3d, 0x83, 0x79, 0x51, 0xb9, 0x27, 0x0c, 0x69, 0x99, 0x50, 0xa9, 0xd6, 0x4e, 0x2d, 0x7f, 0x18, 0x21, 0xb3, 0xab, 0x0e, 0xb5, 0xeb, 0xa4, 0xe1, 0x8f, 0x26, 0x3e, 0xf7, 0xdb, 0x34, 0x57, 0xae, 0xf7, 0x99, 0x0d, 0xf6, 0xdc, 0xcb, 0x5a, 0xdc, 0x39, 0xe8, 0xe4, 0x51, 0x2c, 0xcc, 0x17, 0x1d, 0xd3, 0x0c, 0x66, 0x95, 0x24, 0x6d, 0x61, 0xc5, 0x2c, 0x42, 0x98, 0x71, 0x95, 0xda, 0xae, 0x3b, 0x5c, 0xc3, 0xc5, 0xa8, 0xdf, 0x54, 0x35, 0xa7, 0x6d, 0xe9, 0xc8, 0x16, 0xe7, 0xa6, 0x31, 0xb8, 0x56, 0x00, 0x68, 0x0e, 0x6a, 0x01, 0x9e, 0xe3, 0x31, 0xe5, 0x71, 0x80, 0x62, 0xdb, 0x69, 0xf6, 0x58, 0x6e, 0x23, 0x3c, 0x1a, 0x42, 0xdf, 0x10, 0xc0, 0xdf, 0x3d, 0xcf, 0x6a, 0x2c, 0xa5, 0x67, 0x35, 0xbc, 0xa0, 0x7e, 0x56, 0x03, 0x7f, 0x0f, 0x79, 0x33, 0x83, 0x00, 0x0a, 0x1a, 0xe1, 0xc1, 0x1e, 0xbe, 0xe0, 0x2f, 0x70, 0xac, 0x3e, 0x5c, 0xff, 0x01, 0x04, 0x33, 0xa8, 0x3c, 0xb0, 0x3f, 0xfe, 0x09, 0x7e, 0x05, 0x0e, 0xee, 0x94, 0x0d, 0xbf, 0xfd, 0xeb, 0x9f, 0x3d, 0xff, 0x9f, 0xbd, 0xe0, 0x7f, 0xb8, 0xf8, 0x11, 0x4c, 0x02, 0xff, 0xee, 0xf7, 0x9e, 0xef, 0x8c, 0x0d, 0xf7, 0x27, 0xf6, 0x07, 0x91, 0xdc, 0x4d, 0xa7, 0x86, 0xef, 0xb8, 0x77, 0xe3, 0xa9, 0x8f, 0x9f, 0xb3, 0xf1, 0xcc, 0x83, 0x6f, 0x40, 0x1d, 0x04, 0x3f, 0xc1, 0xf7, 0xc4, 0x9d, 0x8e, 0x8d, 0xc0, 0x09, 0xc6, 0x7e, 0x30, 0x05, 0xf5, 0xcd, 0xb9, 0xf3, 0x46, 0x77, 0xc6, 0xc8, 0xf1, 0xe1, 0x73, 0x64, 0xdc, 0x19, 0x63, 0x0a, 0x39, 0xf9, 0x69, 0x62, 0x4c, 0xd9, 0x2f, 0x44, 0xea, 0x32, 0x2a, 0x2a, 0x1a, 0xff, 0x27, 0x3e, 0x03, 0x81, 0x6d, 0x61, 0x2f, 0x3e, 0x90, 0x77, 0x8a, 0xce, 0xec, 0xf4, 0xf4, 0xbb, 0xda, 0xcd, 0xc8, 0xff, 0xa3, 0xda, 0x19, 0x98, 0xd1, 0x08, 0xa2, 0xdc, 0xda, 0xfe, 0x51, 0xb3, 0x81, 0x90, 0xcd, 0x51, 0x00, 0xf2, 0x67, 0x67, 0xdc, 0x0b, 0x45, 0x8f, 0x63, 0x6f, 0xed, 0x51, 0x1f, 0xd0, 0x88, 0x81, 0xcc, 0x7a, 0x61, 0x66, 0x14, 0xe8, 0x6e, 0xd2, 0x07, 0x74, 0x37, 0xa1, 0x40, 0xc5, 0x32, 0x27, 0x24, 0x3d, 0xd6, 0x91, 0x46, 0x5f, 0xb7, 0x27, 0x07, 0xe7, 0x09, 0xad, 0x84, 0xfe, 0x38, 0x53, 0x11, 0x03, 0xf6, 0x26, 0xee, 0x39, 0x68, 0x00, 0x31, 0xab, 0x57, 0x96, 0xec, 0x64, 0x73, 0x1c, 0xf8, 0x5e, 0xd2, 0x54, 0x2a, 0xb5, 0x5b, 0x1d, 0x07, 0xbf, 0xb2, 0x54, 0x97, 0x2a, 0x76, 0x43, 0x4b, 0x8d, 0xa5, 0x52, 0x0f, 0xc9, 0xd0, 0x52, 0xc8, 0x86, 0x7b, 0x18, 0x02, 0x6d, 0x70, 0x79, 0x04, 0xdc, 0xb3, 0xf0, 0xdb, 0x7a, 0xab, 0xc6, 0x78, 0x77, 0x6f, 0x8f, 0xa1, 0x26, 0xfa, 0x4b, 0x0a, 0xb7, 0x43, 0x31, 0x15, 0xc5, 0x78, 0x21, 0x13, 0xe4, 0x22, 0x51, 0x71, 0xfa, 0x45, 0xfb, 0x8e, 0x76, 0xf3, 0xf9, 0x50, 0x90, 0x92, 0x24, 0xc7, 0x5f, 0xac, 0xcc, 0x8b, 0x07, 0xa8, 0x4b, 0x48, 0x2f, 0x0a, 0x50, 0xaf, 0xcb, 0x5d, 0x78, 0x77, 0x0d, 0x6b, 0xb4, 0xbd, 0xcc, 0xb3, 0x02, 0x16, 0x85, 0x38, 0x17, 0x5c, 0xa8, 0x12, 0x2a, 0x10, 0xce, 0x97, 0xb6, 0xbb, 0x2a, 0x2e, 0xf0, 0x6a, 0xa9, 0x22, 0x5e, 0x91, 0x23, 0xfd, 0x4d, 0x5b, 0x5b, 0x5b, 0x14, 0x59, 0x16, 0x87, 0x83, 0x89, 0xbd, 0x94, 0xa1, 0x30, 0x1c, 0x17, 0xa3, 0x62, 0x96, 0x6c, 0xe2, 0x23, 0x3f, 0x0a, 0xdb, 0x3b, 0xb7, 0x49, 0xe7, 0xea, 0x9d, 0x4b, 0x75, 0x3b, 0x53, 0x2e, 0xea, 0xf7, 0x17, 0xf5, 0x5b, 0x45, 0xe9, 0x8e, 0x0f, 0xa0, 0x8e, 0xda, 0x6d, 0x24, 0xcf, 0x47, 0x83, 0xc3, 0x51, 0xb5, 0x3f, 0x9c, 0x1c, 0xba, 0xd4, 0xd8, 0x6c, 0xa9, 0x39, 0xb6, 0x57, 0x9f, 0x93, 0x23, 0xb6, 0x1d, 0xdc, 0x84, 0x7f, 0xec, 0x35, 0xf0, 0xd7, 0xe0, 0x1c, 0xa3, 0xde, 0x7e, 0x03, 0x6d, 0x8d, 0xf6, 0xc8, 0xa0, 0xa8, 0xdb, 0x85, 0x82, 0x10, 0x7e, 0x27, 0x84, 0xcf, 0x21, 0x46, 0x9d, 0x10, 0x23, 0x0e, 0x31, 0xe9, 0x84, 0x80, 0xd9, 0x2f, 0x62, 0xe7, 0x59, 0x23, 0x1e, 0x6d, 0xef, 0x63, 0x6b, 0xe3, 0x6f, 0xb2, 0x79, 0x21, 0x20, 0x72, 0xf2, 0x95, 0xe4, 0x05, 0xbe, 0x48, 0x23, 0x5f, 0x7c, 0xc6, 0xdd, 0x4b, 0xb4, 0x16, 0x7d, 0x83, 0xde, 0x57, 0x31, 0xa1, 0x0d, 0x4c, 0xa6, 0xa9, 0x62, 0x42, 0xd3, 0x42, 0x1f, 0x1e, 0xe6, 0x20, 0xad, 0x8c, 0x86, 0x3a, 0x84, 0xed, 0x76, 0xf9, 0xaf, 0xd4, 0x2e, 0xff, 0x85, 0xda, 0xe5, 0x3f, 0xb1, 0x5d, 0xc1, 0x2b, 0xb5, 0x2b, 0x78, 0xa1, 0x76, 0x05, 0x4f, 0x6c, 0xd7, 0xe4, 0x95, 0xda, 0x35, 0x79, 0xa1, 0x76, 0x4d, 0x06, 0xb6, 0xcb, 0xa9, 0x02, 0xf4, 0x1e, 0xa9, 0x8a, 0x7d, 0xac, 0xbf, 0x79, 0xc0, 0x1e, 0x55, 0xd9, 0x49, 0xf3, 0x28, 0x17, 0x5b, 0x34, 0xab, 0x5c, 0xb6, 0x28, 0xaa, 0x20, 0x81, 0x33, 0x72, 0xfd, 0x99, 0x4f, 0x82, 0x19, 0x06, 0xee, 0x0a, 0x40, 0xd0, 0x18, 0x7a, 0x4c, 0x5d, 0x09, 0xde, 0x99, 0xcf, 0xf2, 0x8f, 0xca, 0xc6, 0xb3, 0x6a, 0x83, 0x9c, 0x6a, 0xaa, 0x2f, 0x28, 0xa1, 0x0b, 0x84, 0x17, 0xb6, 0xab, 0x9d, 0x4f, 0x99, 0xed, 0x07, 0xa1, 0x40, 0xb8, 0x36, 0x1a, 0xf4, 0x13, 0x8a, 0x9f, 0x64, 0x5d, 0x0e, 0xc2, 0x44, 0x01, 0x19, 0xaa, 0x11, 0xa2, 0x62, 0x7b, 0x22, 0x92, 0xe7, 0x59, 0x7e, 0xec, 0x3c, 0xa6, 0x49, 0xb3, 0x75, 0x56, 0x3e, 0x9a, 0x21, 0x1b, 0xeb, 0xa5, 0xbd, 0x9a, 0x06, 0x83, 0xa8, 0x2e, 0x4e, 0xd7, 0x59, 0x77, 0x6d, 0x98, 0xab, 0xab, 0x0c, 0xd3, 0x87, 0xd4, 0x45, 0xcb, 0x8b, 0xaa, 0x8a, 0xc3, 0x72, 0x49, 0xa3, 0x1c, 0xbb, 0x6a, 0xe3, 0x00, 0xba, 0x0a, 0x79, 0xd6, 0x90, 0x3a, 0x05, 0x16, 0x51, 0xed, 0x7d, 0x94, 0xa7, 0xf8, 0xd0, 0x67, 0x67, 0xb5, 0x1c, 0x40, 0x57, 0x2d, 0xcf, 0x1a, 0x52, 0xad, 0xc0, 0x52, 0x0d, 0x09, 0xba, 0xeb, 0x0d, 0x5c, 0xf7, 0xd8, 0x7f, 0xe4, 0x36, 0xa0, 0xa7, 0xb6, 0x2a, 0x9b, 0xf4, 0x81, 0xd8, 0xe3, 0xde, 0x32, 0x1c, 0xa2, 0x2e, 0xb3, 0xc9, 0x23, 0x10, 0x33, 0x7d, 0x65, 0x04, 0x84, 0x5c, 0x06, 0x96, 0xf8, 0xfe, 0x8a, 0x2a, 0x10, 0x2c, 0xb5, 0xa9, 0xf6, 0xf0, 0xc7, 0x61, 0x57, 0xb7, 0xd4, 0x65, 0xfc, 0x41, 0x65, 0x7c, 0xa5, 0x4c, 0x30, 0xa8, 0x4c, 0x50, 0x95, 0x49, 0x7a, 0xee, 0xd4, 0x92, 0x3d, 0xb1, 0x1c, 0x5a, 0xf0, 0xb8, 0xbf, 0x40, 0xcd, 0x67, 0x5e, 0x66, 0x32, 0xa8, 0xcc, 0x44, 0x94, 0xa1, 0x5c, 0x3f, 0xdb, 0x7a, 0x01, 0x25, 0x95, 0x09, 0x06, 0x95, 0x09, 0xea, 0x32, 0x55, 0x5f, 0xf6, 0x17, 0x52, 0xfa, 0x93, 0x7d, 0x4e, 0x86, 0x95, 0xaa, 0xda, 0x84, 0xf3, 0xf9, 0xcf, 0xb7, 0xde, 0x99, 0x42, 0x6c, 0xd6, 0x5f, 0xf6, 0x84, 0x72, 0x1f, 0xee, 0x33, 0x5e, 0x76, 0x5a, 0x9d, 0xe6, 0x25, 0xf3, 0x6a, 0x3f, 0xb8, 0xa7, 0x77, 0xdd, 0x1e, 0xdf, 0xde, 0xd4, 0x7d, 0x7b, 0xaf, 0xf4, 0xed, 0x4d, 0xdd, 0xb7, 0x31, 0xfa, 0x36, 0x46, 0x5f, 0x64, 0x8c, 0x9e, 0x1c, 0xdc, 0xd6, 0x0b, 0x5f, 0x79, 0xd7, 0xd6, 0x7e, 0x6f, 0x07, 0xbd, 0x30, 0x01, 0x85, 0x19, 0xf5, 0xc2, 0x8c, 0x28, 0xcc, 0xa4, 0x17, 0x06, 0x0d, 0x80, 0x2c, 0x86, 0xe5, 0xa1, 0x38, 0x0e, 0x8d, 0x54, 0x19, 0x99, 0x7d, 0xf1, 0x3c, 0x7e, 0x3b, 0x9e, 0x47, 0xf2, 0x12, 0x4c, 0xf8, 0xc6, 0x66, 0xff, 0x68, 0xcf, 0x8e, 0xaa, 0x69, 0xb9, 0x2b, 0x56, 0x73, 0x5f, 0xd6, 0x0c, 0xeb, 0x0d, 0x26, 0xdd, 0xd3, 0xa0, 0xce, 0x73, 0x90, 0x34, 0xaa, 0x73, 0xbf, 0xa8, 0x99, 0x77, 0x2e, 0xf0, 0x71, 0x9f, 0xd8, 0x5e, 0x05, 0xdb, 0x19, 0xce, 0x88, 0x26, 0x1b, 0x6a, 0x6b, 0xe4, 0x86, 0x1f, 0xc9, 0xed, 0x2f, 0x6c, 0x3e, 0x94, 0x0d, 0xbb, 0x2c, 0xcd, 0x98, 0x33, 0x64, 0x1d, 0xed, 0xe2, 0xe4, 0x91, 0xab, 0x00, 0x55, 0x9e, 0xc9, 0xe1, 0x0a, 0x98, 0xa4, 0x5d, 0x70, 0x98, 0x27, 0xaa, 0xf3, 0x1f, 0x92, 0x96, 0x6f, 0x45, 0x64, 0x98, 0x8a, 0x03, 0xbb, 0xda, 0x56, 0x25, 0x84, 0xae, 0xf0, 0x96, 0x0a, 0x6c, 0xdb, 0x12, 0xb0, 0x29, 0xd0, 0xa3, 0xca, 0xa8, 0xc7, 0x8f, 0x39, 0xc3, 0x2b, 0xa0, 0xaa, 0xa7, 0xb6, 0x06, 0xd8, 0xb1, 0x6a, 0xf1, 0xc3, 0x5e, 0x75, 0x30, 0xf6, 0x64, 0xa3, 0xc7, 0x5d, 0xec, 0xf4, 0xb8, 0x8b, 0xdd, 0x70, 0xdc, 0xc5, 0x4e, 0x8f, 0xbb, 0x8b, 0xef, 0x97, 0xb0, 0xbd, 0x8b, 0xeb, 0x0f, 0x45, 0x07, 0xee, 0xe2, 0x02, 0xdc, 0x45, 0x0b, 0x37, 0xc5, 0xb9, 0xc8, 0x92, 0x15, 0x33, 0xa5, 0xc8, 0xee, 0x34, 0x69, 0x74, 0xb1, 0x14, 0x0a, 0x67, 0xce, 0x07, 0xc0, 0x88, 0x81, 0x4d, 0x56, 0xf1, 0x61, 0x37, 0x04, 0x33, 0x83, 0x3c, 0x87, 0x9b, 0x43, 0x89, 0xe9, 0x40, 0x76, 0xf1, 0x50, 0xca, 0x05, 0xec, 0xb9, 0x1a, 0x2a, 0xb8, 0x93, 0x43, 0xcf, 0x63, 0x30, 0xfb, 0xcd, 0x3e, 0x27, 0xcc, 0x52, 0x2c, 0x9f, 0xd1, 0x10, 0x89, 0xf5, 0x21, 0x50, 0x3b, 0x5a, 0xe2, 0xbc, 0xd6, 0xc4, 0x83, 0xb3, 0x0c, 0x79, 0xf3, 0xdb, 0x75, 0xeb, 0x17, 0x83, 0xe4, 0x8e, 0x8b, 0x73, 0x08, 0xeb, 0x2b, 0xe0, 0xb7, 0x68, 0x44, 0x0a, 0xe9, 0xbf, 0xdc, 0xd7, 0xc0, 0x41, 0x58, 0x5a, 0x1f, 0x86, 0x8b, 0xce, 0x19, 0x74, 0x20, 0x3e, 0xb3, 0xaf, 0xe0, 0x75, 0xcd, 0x78, 0x44, 0x19, 0x8d, 0xdb, 0x65, 0xc2, 0xf0, 0x5c, 0xfb, 0x6a, 0x89, 0x23, 0x98, 0xf7, 0xe7, 0xdb, 0x89, 0xfb, 0xa2, 0xf7, 0x41, 0xf5, 0x56, 0xf1, 0xcc, 0x93, 0x4f, 0x1a, 0xd4, 0xd3, 0xd7, 0xa7, 0x7e, 0xfa, 0x14, 0xea, 0xa7, 0x1d, 0xd4, 0x33, 0x2b, 0x5a, 0xb7, 0xf1, 0x8b, 0x02, 0xd1, 0x7d, 0x34, 0x6e, 0x9c, 0x3b, 0xb6, 0xd8, 0x6c, 0xb3, 0x5c, 0x83, 0x4e, 0xba, 0x41, 0x27, 0x0d, 0xd0, 0x69, 0x37, 0xe8, 0x54, 0x06, 0xc5, 0xdd, 0xf5, 0xa8, 0x03, 0x96, 0xe7, 0xb5, 0x80, 0x25, 0x56, 0xfd, 0xe0, 0x8e, 0x57, 0xeb, 0xa9, 0xbf, 0x08, 0x9e, 0xc0, 0x7d, 0x1d, 0xbe, 0x33, 0xac, 0xaf, 0x69, 0xea, 0xe2, 0x3b, 0x83, 0x98, 0xf5, 0xb4, 0x68, 0x56, 0xb7, 0x88, 0xda, 0x1e, 0x3b, 0x8d, 0x86, 0x14, 0x64, 0x9f, 0x83, 0xfa, 0x9b, 0xeb, 0x2e, 0x19, 0xe2, 0x39, 0xd5, 0x02, 0xc9, 0x8d, 0x8b, 0x7d, 0xf6, 0x40, 0x0a, 0x28, 0xcc, 0x81, 0x7d, 0x16, 0x3c, 0x06, 0x88, 0x52, 0x53, 0x07, 0x86, 0xe9, 0x78, 0xe4, 0x83, 0xc6, 0xac, 0x70, 0x5b, 0xbe, 0x7c, 0x6d, 0x0b, 0x0b, 0x85, 0xab, 0x8d, 0xe9, 0x34, 0x4f, 0xbe, 0x45, 0xc2, 0x75, 0xbd, 0xc8, 0xe4, 0x91, 0x6f, 0xbe, 0x88, 0xa2, 0x3f, 0x07, 0x2f, 0x07, 0x67, 0x55, 0xb0, 0xec, 0x1d, 0x1d, 0x96, 0x5a, 0x3d, 0xcf, 0x2c, 0x92, 0x73, 0x6a, 0xfc, 0x68, 0xe6, 0xd1, 0x54, 0xb6, 0x67, 0xe8, 0xc8, 0x6c, 0xa5, 0xf2, 0x04, 0xd1, 0x64, 0x74, 0xcb, 0xab, 0xad, 0xc6, 0x30, 0xba, 0xc9, 0xd0, 0x86, 0x58, 0xec, 0xf8, 0xc0, 0x48, 0x84, 0xdd, 0xfd, 0x86, 0x1a, 0x5e, 0xec, 0xfe, 0x16, 0xbb, 0x1b, 0xf4, 0x43, 0xb5, 0xd5, 0x78, 0x59, 0xb4, 0x81, 0xaf, 0xba, 0x1b, 0xf6, 0x78, 0x58, 0x87, 0xe3, 0xc5, 0x28, 0x1e, 0x96, 0xb2, 0x27, 0xbf, 0x91, 0xb6, 0x2f, 0xca, 0xd4, 0xae, 0xdf, 0xe3, 0x29, 0x6f, 0x68, 0x02, 0x7f, 0x48, 0x97, 0x29, 0x11, 0x16, 0x8f, 0x92, 0xe0, 0x97, 0x82, 0xaa, 0xd1, 0x0e, 0x96, 0xee, 0x06, 0x46, 0x8b, 0x22, 0xa9, 0x32, 0xea, 0x8b, 0xba, 0x60, 0x87, 0x09, 0x19, 0xbc, 0xc5, 0xef, 0xde, 0xcd, 0xd9, 0xf7, 0x62, 0x13, 0x8a, 0x3b, 0x9c, 0xf0, 0xb3, 0x3a, 0x9b, 0x81, 0x1f, 0xd5, 0x4d, 0xc7, 0x14, 0x50, 0x89, 0xc3, 0x6e, 0xe6, 0xd2, 0x48, 0x69, 0x35, 0xd8, 0x83, 0xe9, 0x5d, 0xf4, 0xa8, 0xfe, 0x51, 0x69, 0xa9, 0xc8, 0x68, 0xb4, 0x57, 0xfc, 0xfd, 0x0d, 0x34, 0x91, 0xf5, 0x1c, 0x06, 0x16, 0xbe, 0x52, 0xb7, 0x75, 0x35, 0xa5, 0x4d, 0x7b, 0x5f, 0x4c, 0x6b, 0xd5, 0xfc, 0xe1, 0x65, 0x2e, 0x34, 0xa8, 0x7f, 0x1b, 0x2e, 0xe8, 0x9f, 0x1a, 0x1b, 0xde, 0xa8, 0xbe, 0xd8, 0xd8, 0x6f, 0xd5, 0x04, 0xed, 0xd0, 0xfa, 0xcd, 0x75, 0x04, 0x6b, 0xc5, 0xb3, 0x3a, 0xa3, 0x37, 0x6e, 0xf7, 0x1b, 0xb5, 0x63, 0x88, 0xb4, 0xa2, 0x64, 0xbc, 0xb0, 0xa8, 0xfa, 0xad, 0x4d, 0xeb, 0x57, 0x6a, 0xfe, 0x37, 0x99, 0xcf, 0xaf, 0x45, 0xfb, 0x37, 0x9a, 0xc8, 0xaf, 0x4b, 0xfe, 0x37, 0x98, 0xc1, 0xaf, 0xd4, 0x80, 0xf6, 0x2a, 0x8c, 0xea, 0x32, 0xda, 0xa9, 0xe4, 0xb8, 0x7a, 0x06, 0xbb, 0xaf, 0x3f, 0x07, 0xbc, 0x80, 0x30, 0xe3, 0x0a, 0x19, 0x35, 0xed, 0xd7, 0x08, 0x27, 0xb3, 0x06, 0xca, 0xe1, 0x18, 0x27, 0xfc, 0xa6, 0x5c, 0xa0, 0xd1, 0x90, 0x4e, 0xfe, 0x89, 0xd3, 0x7e, 0xec, 0x18, 0x55, 0x75, 0xb8, 0xaf, 0xba, 0xf6, 0x45, 0x2d, 0xc2, 0xce, 0x03, 0xa8, 0x27, 0x00, 0x68, 0xc9, 0x13, 0xe7, 0x2b, 0x35, 0x13, 0x49, 0x3d, 0xa7, 0x33, 0x16, 0x35, 0xe5, 0x8c, 0xd6, 0xf4, 0xc6, 0x10, 0x32, 0xa3, 0x46, 0x17, 0x3e, 0x1e, 0x19, 0xa4, 0x45, 0xa7, 0x06, 0x07, 0x31, 0x6c, 0x62, 0x6b, 0xdd, 0x85, 0x4f, 0x6c, 0xb0, 0xf5, 0x18, 0x79, 0x6e, 0x03, 0xa7, 0xd8, 0x85, 0x77, 0xe1, 0xac, 0x22, 0x7c, 0xb4, 0x38, 0x9b, 0x41, 0x3e, 0x0c, 0xa7, 0xd8, 0xb0, 0x77, 0xe1, 0xac, 0xc2, 0x77, 0xb4, 0x38, 0x9b, 0x11, 0x3c, 0xd5, 0xaa, 0xb2, 0x8b, 0x53, 0x11, 0x7c, 0x35, 0xc3, 0x21, 0x71, 0x74, 0x76, 0xab, 0x3f, 0x87, 0xcf, 0x88, 0xdc, 0x55, 0x8b, 0x07, 0xfd, 0xc5, 0x83, 0x66, 0x71, 0x0d, 0x5d, 0x93, 0x11, 0xa3, 0x2b, 0xd9, 0x3c, 0x8b, 0x2e, 0xb5, 0xf8, 0xc5, 0x74, 0x9d, 0x7e, 0xf7, 0x85, 0x3c, 0xae, 0xf3, 0x68, 0x47, 0x0a, 0x83, 0xde, 0x53, 0x7c, 0x74, 0xaf, 0x2a, 0x4f, 0x1c, 0x6c, 0xff, 0x4e, 0x63, 0xe9, 0x1b, 0xf6, 0xc2, 0x4a, 0x81, 0xe2, 0x0b, 0x49, 0x08, 0xbe, 0x2d, 0x0c, 0x30, 0xda, 0x07, 0x4b, 0xf0, 0xe5, 0xb0, 0x32, 0xd3, 0xe6, 0xe1, 0x03, 0x87, 0x0a, 0xb2, 0xea, 0x66, 0xbb, 0xb1, 0x1e, 0x9b, 0xfd, 0x10, 0xda, 0x9e, 0x37, 0x56, 0x0b, 0x95, 0x59, 0x54, 0x94, 0x58, 0x7d, 0x7d, 0x6f, 0x6b, 0x81, 0x2f, 0x15, 0x87, 0xce, 0x1d, 0x56, 0x5c, 0x5f, 0xbb, 0xc8, 0x52, 0x3d, 0xa5, 0xf0, 0x2a, 0xcf, 0xf6, 0xa0, 0x0d, 0xa4, 0x4a, 0xf9, 0x06, 0x47, 0xf0, 0x12, 0x38, 0xc8, 0xb7, 0x46, 0x00, 0xd3, 0xbe, 0x62, 0xda, 0x73, 0xdc, 0xb1, 0x89, 0x63, 0x2f, 0x07, 0x32, 0xd8, 0x97, 0xa8, 0xc9, 0xc1, 0xba, 0xa0, 0x4d, 0x7b, 0x92, 0x97, 0x8f, 0x86, 0x2e, 0xee, 0xf2, 0x58, 0x3c, 0xa6, 0x65, 0xf4, 0x10, 0xbe, 0x7b, 0xff, 0x6e, 0xce, 0x2f, 0x4c, 0x2a, 0xc2, 0x75, 0x94, 0x14, 0xf8, 0x80, 0x32, 0x34, 0x39, 0x4a, 0xd8, 0x4d, 0x65, 0x40, 0x53, 0x03, 0x91, 0x1c, 0x6f, 0x38, 0x18, 0x0b, 0x8b, 0xc0, 0x6f, 0x60, 0x92, 0xdc, 0x0c, 0xdd, 0x88, 0x5a, 0xed, 0x60, 0xa6, 0xb1, 0xc1, 0xe4, 0x8b, 0x8b, 0x54, 0xf5, 0x78, 0xd8, 0x4c, 0xbe, 0xb4, 0x76, 0x3b, 0x4a, 0xf6, 0xdb, 0xa8, 0x2a, 0xf5, 0xf7, 0x00, 0x80, 0x22, 0x35, 0xda, 0x90, 0x8f, 0x67, 0xc8, 0xa1, 0x87, 0x35, 0x1a, 0x38, 0x65, 0xeb, 0xc3, 0xf3, 0xdb, 0x25, 0x63, 0xbb, 0xb4, 0x75, 0x4a, 0xd9, 0x17, 0x6d, 0x63, 0xce, 0xe4, 0xe4, 0x45, 0xd4, 0x48, 0x56, 0x94, 0x97, 0x62, 0xcb, 0x53, 0xc8, 0x68, 0x59, 0x81, 0x9e, 0x4f, 0x4c, 0xce, 0xa2, 0x02, 0xf0, 0xc4, 0xe1, 0x65, 0xdc, 0xe0, 0x06, 0x27, 0x2a, 0xc3, 0xeb, 0xae, 0x49, 0x48, 0xba, 0x29, 0xb7, 0x1f, 0x2f, 0x9d, 0xc8, 0x32, 0xc6, 0x33, 0x3c, 0x69, 0xa0, 0xfa, 0x61, 0xbd, 0x5e, 0xf7, 0x61, 0x7b, 0x32, 0x9f, 0xfe, 0xcb, 0xff, 0x07, 0xdf, 0xb2, 0x5a, 0x7d, 0xbc, 0xe2, 0x00, 0x00
 };
-const size_t webui_index_html_gz_len = 285;
-const char webui_index_html_mime[] = "text/html";
-const bool webui_index_html_compressed = true;
 
-
-// Auto-generated from index-hxlA0njG.css
-const uint8_t webui_css_gz[] PROGMEM = {
-    0x1f, 0x8b, 0x08, 0x00, 0x4e, 0x90, 0x12, 0x69, 0x02, 0xff, 0xed, 0x7d, 0x5b, 0x92, 0xe3, 0x38, 0x92, 0xe0, 0xff, 0x9e, 0x82, 0x93, 0x65, 0x61, 0x11, 0xcc, 0x22, 0x19, 0x7c, 0xe8, 0x15, 0xd4, 0x64, 0x5a, 0xcf, 0x96, 0xcd, 0xd8, 0x8c, 0x59, 0x77, 0x8f, 0xd9, 0x76, 0xed, 0x9a, 0xcd, 0x66, 0xe7, 0x07, 0x25, 0x41, 0x12, 0x3b, 0x29, 0x52, 0x4b, 0x52, 0x19, 0x11, 0xa5, 0xd5, 0x15, 0xf6, 0x6b, 0x3f, 0xf7, 0x20, 0x73, 0x9e, 0xb9, 0xc0, 0x5c, 0x61, 0xdd, 0xf1, 0x20, 0x01, 0x12, 0xa4, 0xa8, 0x78, 0x64, 0x65, 0x75, 0x47, 0xb7, 0x55, 0x86, 0x08, 0x38, 0x1c, 0x0e, 0x07, 0xe0, 0x70, 0xb8, 0x3b, 0x80, 0xdb, 0xf7, 0x7f, 0x67, 0x94, 0x51, 0x9c, 0xdc, 0xc7, 0xe9, 0x6a, 0x59, 0x14, 0xc6, 0xd7, 0x91, 0xe3, 0x39, 0x9e, 0x6b, 0xfc, 0x6f, 0xe3, 0x0f, 0xff, 0xf2, 0xb3, 0xf1, 0xfb, 0x78, 0x49, 0xd2, 0x82, 0xc0, 0xd7, 0xb6, 0x2c, 0xf7, 0x45, 0x78, 0x7b, 0x2b, 0xc1, 0x3a, 0xcb, 0x6c, 0x67, 0xbc, 0xbf, 0xfd, 0x5d, 0x12, 0x3d, 0x92, 0xdc, 0xd8, 0xe7, 0xd9, 0x9e, 0xe4, 0x65, 0x4c, 0x8a, 0xe3, 0xef, 0x8a, 0xc3, 0x7e, 0x9f, 0xe5, 0x65, 0x61, 0xdc, 0xdc, 0xdc, 0xd8, 0xf7, 0x64, 0xf1, 0x25, 0x2e, 0xed, 0xed, 0xe3, 0x7e, 0x0b, 0xb8, 0xc2, 0x34, 0x4b, 0x89, 0x69, 0x1a, 0x51, 0xba, 0x32, 0x6e, 0xd2, 0xac, 0x34, 0x6e, 0x76, 0x51, 0xbe, 0x89, 0x53, 0xbb, 0xcc, 0xe3, 0x5d, 0x18, 0xa7, 0x49, 0x8c, 0xd9, 0xa6, 0x91, 0xe5, 0x50, 0xd8, 0xde, 0x65, 0xbf, 0xd8, 0x59, 0x1e, 0x93, 0xb4, 0x14, 0x59, 0x52, 0xc1, 0x65, 0x96, 0x64, 0x79, 0x98, 0x6f, 0x16, 0x37, 0xeb, 0x1c, 0x28, 0xc9, 0xc9, 0xca, 0xc8, 0x8d, 0x8d, 0xb1, 0x80, 0xe2, 0xe6, 0xf1, 0xbd, 0x15, 0x2e, 0xc8, 0x3a, 0xcb, 0x89, 0x15, 0x46, 0xeb, 0x92, 0xe4, 0x56, 0x18, 0x2e, 0xa2, 0xe5, 0x97, 0x15, 0x50, 0x79, 0xb4, 0xed, 0xf2, 0xde, 0x2e, 0xf6, 0xd1, 0x92, 0xd8, 0x8f, 0x76, 0x4e, 0xbe, 0x92, 0xbc, 0x20, 0xa1, 0x3b, 0xa7, 0xc9, 0x8b, 0x2c, 0x5f, 0x91, 0xdc, 0x2e, 0xca, 0xc7, 0x84, 0x84, 0x45, 0x96, 0xc4, 0x2b, 0x96, 0xbe, 0xce, 0xd2, 0x12, 0x9a, 0x12, 0x6f, 0xb6, 0x48, 0x4a, 0x5c, 0xc6, 0x51, 0xc2, 0x32, 0x8a, 0x6d, 0xb4, 0xca, 0xee, 0x43, 0xd7, 0x70, 0x8d, 0x1f, 0x5c, 0xf8, 0x9f, 0x9c, 0x6a, 0x33, 0x12, 0x35, 0xf0, 0x76, 0x94, 0xec, 0xb7, 0x51, 0xe8, 0xb9, 0xee, 0x15, 0x4b, 0x8e, 0x81, 0xcd, 0x65, 0x07, 0x32, 0x39, 0x4f, 0x87, 0x52, 0xc9, 0x6f, 0x22, 0xce, 0xe3, 0x74, 0xa3, 0x2b, 0x44, 0xd3, 0xfb, 0xea, 0xeb, 0x2a, 0x28, 0xe5, 0xea, 0x8b, 0xd3, 0x2c, 0x0a, 0xa5, 0xa9, 0x31, 0x5b, 0xaf, 0xb1, 0xf8, 0x7d, 0xbc, 0x2a, 0xb7, 0xa1, 0xbb, 0x7f, 0x68, 0x67, 0xb1, 0x2a, 0x7f, 0x58, 0xaf, 0xd7, 0xed, 0xbc, 0x66, 0x85, 0xa7, 0xd3, 0x89, 0x0f, 0xbf, 0x72, 0x4b, 0x76, 0xe4, 0x18, 0xe6, 0x59, 0x56, 0x5a, 0xe1, 0x36, 0x2b, 0x4a, 0xe8, 0x65, 0xda, 0x67, 0x45, 0x04, 0x83, 0xee, 0x10, 0xd3, 0xbf, 0x76, 0x41, 0xf2, 0x78, 0x6d, 0x15, 0x8f, 0x45, 0x49, 0x76, 0xf6, 0x21, 0xb6, 0xa4, 0xc4, 0x77, 0xff, 0xb0, 0xdf, 0x27, 0xc4, 0xf8, 0x09, 0x6b, 0x37, 0xfe, 0x71, 0x97, 0xfd, 0x25, 0x7e, 0x67, 0xbd, 0xfb, 0x13, 0xd9, 0x64, 0xc4, 0xf8, 0xef, 0xff, 0xd2, 0x4e, 0xf8, 0xd3, 0xe3, 0x6e, 0x91, 0x25, 0x90, 0xf2, 0xc7, 0xac, 0xcc, 0x94, 0x52, 0x73, 0x5e, 0xf1, 0x2e, 0x4b, 0x33, 0xac, 0x18, 0xff, 0xd2, 0xc1, 0x66, 0xfd, 0xe9, 0x9f, 0xfe, 0x00, 0xbf, 0xed, 0xff, 0x46, 0x36, 0x87, 0x24, 0xca, 0xad, 0x3f, 0x90, 0x34, 0xc9, 0x2c, 0x48, 0x8a, 0x96, 0x99, 0xf5, 0x53, 0x96, 0xc2, 0x68, 0x8b, 0x0a, 0xeb, 0xdd, 0xef, 0xe3, 0x05, 0xc9, 0xa3, 0x32, 0xce, 0x52, 0x03, 0xc1, 0xa1, 0x8a, 0x9f, 0xb2, 0x03, 0xcc, 0x81, 0xdc, 0xf8, 0x23, 0xb9, 0x7f, 0x67, 0x55, 0xe8, 0xa0, 0x1e, 0xca, 0x2a, 0x7b, 0x93, 0x13, 0x92, 0xda, 0x23, 0xd7, 0x0d, 0xb3, 0x2f, 0xc9, 0x72, 0x7b, 0x33, 0xbd, 0x73, 0xfc, 0x2b, 0xc3, 0xf1, 0xdd, 0x3b, 0xc3, 0x1b, 0x7b, 0xce, 0xd4, 0xf3, 0xcc, 0x06, 0xec, 0xb8, 0x86, 0xf5, 0x9d, 0x00, 0x61, 0x3d, 0x80, 0x1d, 0xdd, 0x39, 0xe3, 0xe9, 0x5d, 0x13, 0x76, 0x52, 0xc1, 0x4e, 0x7c, 0x67, 0x0a, 0xb0, 0xde, 0xdd, 0x88, 0xc2, 0xfa, 0xde, 0xa8, 0x09, 0x3b, 0xab, 0x60, 0x47, 0x23, 0x67, 0x86, 0xb0, 0x1e, 0xa3, 0x21, 0xf0, 0x67, 0x35, 0xec, 0x22, 0x39, 0x10, 0x89, 0x84, 0x89, 0x20, 0x61, 0x64, 0xf8, 0xe3, 0x3b, 0x67, 0xe6, 0x8d, 0x1b, 0xa0, 0x35, 0x05, 0xe3, 0x91, 0x33, 0x41, 0xd0, 0xd1, 0xd8, 0xf0, 0xa1, 0xd8, 0x6c, 0xa6, 0xb4, 0x2c, 0x7a, 0xb4, 0xfd, 0x0a, 0xf4, 0xce, 0xa7, 0x04, 0xb8, 0xee, 0x04, 0x40, 0x47, 0xce, 0x38, 0x68, 0x82, 0x06, 0x15, 0xe8, 0x6c, 0x4a, 0xf9, 0xe5, 0x7a, 0x50, 0xff, 0xcc, 0x09, 0x82, 0x59, 0x03, 0xb2, 0x26, 0x75, 0x3c, 0x76, 0x3c, 0x84, 0xf4, 0xa7, 0x14, 0x69, 0x30, 0x19, 0x35, 0x40, 0x27, 0x32, 0x03, 0x90, 0x54, 0x37, 0x00, 0xa4, 0x13, 0x67, 0xe6, 0xfa, 0x0d, 0xc8, 0x69, 0x05, 0x19, 0x4c, 0x69, 0xfb, 0xdd, 0x80, 0xb5, 0x7f, 0x1a, 0x04, 0x72, 0xfb, 0x41, 0x66, 0x85, 0x3f, 0xb0, 0xa9, 0xc5, 0x92, 0xee, 0xb7, 0x71, 0x49, 0xc4, 0xf4, 0xc0, 0x81, 0x00, 0xd3, 0x23, 0x74, 0xfc, 0x71, 0x4e, 0x76, 0x14, 0x26, 0x05, 0x09, 0x9d, 0x82, 0x04, 0x1b, 0x3f, 0x24, 0xe1, 0x64, 0xc4, 0x52, 0x4b, 0xf2, 0x50, 0xda, 0x0f, 0x45, 0xe8, 0x4c, 0xc7, 0x4a, 0x82, 0x6d, 0xa3, 0x4c, 0xb5, 0xb7, 0x4c, 0xac, 0x2d, 0xa3, 0x64, 0x79, 0xe3, 0xdd, 0x02, 0x90, 0x29, 0x40, 0x8a, 0x5d, 0xe8, 0xcc, 0x94, 0x42, 0xc5, 0x4e, 0x57, 0x08, 0xea, 0xbf, 0x45, 0xc0, 0xaa, 0xe0, 0x22, 0x02, 0x91, 0xea, 0x49, 0xe5, 0x30, 0x41, 0x2d, 0x69, 0x78, 0xce, 0xd8, 0x10, 0xd9, 0xc9, 0x26, 0x84, 0x65, 0xc7, 0x97, 0x6b, 0x4a, 0x36, 0xda, 0x9a, 0xa6, 0xe3, 0x5b, 0x0a, 0x59, 0x55, 0x05, 0xed, 0xf4, 0x1c, 0xa5, 0xe4, 0x43, 0xd2, 0x5d, 0x52, 0x2a, 0xe8, 0xd3, 0x92, 0x72, 0x41, 0x5f, 0x5b, 0xd2, 0x87, 0x62, 0xb4, 0x94, 0xb4, 0x06, 0xd8, 0x3b, 0xb2, 0x8a, 0x0f, 0xbb, 0x70, 0x4c, 0x7b, 0x46, 0xce, 0x28, 0xc8, 0x2e, 0x06, 0xc9, 0xb0, 0x0a, 0x27, 0xad, 0x2c, 0x9a, 0x3c, 0xa5, 0xc9, 0x79, 0x04, 0xc5, 0x0b, 0x6c, 0xb6, 0x20, 0x60, 0x45, 0xd6, 0xd1, 0x21, 0x29, 0x59, 0x81, 0x75, 0xb4, 0x8b, 0x93, 0xc7, 0xf0, 0x6b, 0x94, 0xdf, 0x48, 0x62, 0xcc, 0x94, 0xc0, 0x50, 0x0c, 0x74, 0xc1, 0x62, 0x9e, 0x59, 0x49, 0x46, 0xe4, 0x3c, 0x2e, 0x87, 0x7c, 0x19, 0x14, 0xab, 0x62, 0xbd, 0x1c, 0x2e, 0xb2, 0x07, 0xbb, 0x88, 0x7f, 0xc1, 0x71, 0xc4, 0x57, 0x3f, 0x48, 0x99, 0xb3, 0x9f, 0x20, 0x6a, 0xd9, 0x22, 0xc8, 0x56, 0x69, 0x58, 0x25, 0xf7, 0xd1, 0x6a, 0x85, 0xa0, 0xee, 0x29, 0x0c, 0xd7, 0x71, 0x42, 0xa0, 0xc1, 0x09, 0x59, 0x96, 0x38, 0x58, 0x0f, 0x65, 0x99, 0xa5, 0x4f, 0x46, 0xb7, 0x2d, 0x77, 0x89, 0x10, 0xdd, 0x5c, 0x67, 0x60, 0x23, 0x2e, 0xfe, 0x85, 0xd8, 0xd1, 0xea, 0x2f, 0x87, 0xa2, 0xe4, 0xcb, 0x1a, 0x6a, 0x05, 0x65, 0xb4, 0xa0, 0x39, 0xe1, 0x68, 0x2e, 0xfd, 0x94, 0xfb, 0x0e, 0x3a, 0x6d, 0xde, 0x66, 0x90, 0x86, 0xcd, 0xd6, 0xb7, 0x5c, 0x1d, 0x4c, 0x4e, 0x13, 0x89, 0xca, 0x43, 0x8e, 0xcc, 0x2b, 0x4b, 0x68, 0x7e, 0xa1, 0xa5, 0xae, 0x01, 0x63, 0xa5, 0x59, 0xbe, 0x8b, 0x12, 0x8e, 0x01, 0x0a, 0xc4, 0x74, 0x95, 0xe8, 0xc5, 0xd1, 0x86, 0xaa, 0xb0, 0x54, 0x4c, 0x8e, 0xf6, 0xf6, 0x16, 0x38, 0x96, 0xd0, 0x31, 0xca, 0x56, 0xdf, 0x32, 0x87, 0xa6, 0xef, 0xa3, 0x1c, 0x14, 0xaf, 0xd3, 0x36, 0x3f, 0x72, 0x8e, 0xba, 0x73, 0xa1, 0x0e, 0x6c, 0x81, 0x29, 0x25, 0xef, 0x53, 0xbb, 0xcc, 0xf6, 0x7c, 0x3d, 0xf7, 0xf6, 0x0f, 0xa7, 0x68, 0xb1, 0xc8, 0xc3, 0x7b, 0x00, 0x20, 0x37, 0x9f, 0xca, 0xb8, 0x4c, 0xc8, 0x67, 0x53, 0xed, 0xcf, 0x15, 0x59, 0x66, 0x6c, 0x7d, 0x0b, 0x0f, 0x29, 0x94, 0xc7, 0x3e, 0x33, 0x56, 0x59, 0x59, 0x92, 0xd5, 0xfc, 0x1c, 0xc0, 0x69, 0xeb, 0x59, 0x5b, 0xdf, 0xda, 0x06, 0xd6, 0x76, 0x64, 0x6d, 0xc7, 0xd6, 0x76, 0x72, 0x64, 0xb3, 0x03, 0xbb, 0x5f, 0x90, 0xa5, 0xaa, 0x6a, 0x34, 0xed, 0x14, 0x1d, 0x55, 0xd2, 0xbb, 0x28, 0x12, 0xf9, 0x1d, 0xe9, 0xa7, 0x85, 0x55, 0x94, 0x79, 0x96, 0x6e, 0x8e, 0x72, 0x25, 0x38, 0xaf, 0x49, 0x7e, 0x5a, 0x66, 0x2b, 0x62, 0x7d, 0x59, 0xac, 0x60, 0xdc, 0xec, 0xf6, 0xd6, 0x3e, 0x27, 0xc7, 0xee, 0xe1, 0xd7, 0x9c, 0xbe, 0xd6, 0x2b, 0x2a, 0x0a, 0xc3, 0x86, 0x9c, 0x44, 0xd1, 0xf3, 0xc6, 0x5d, 0x8d, 0xa8, 0x67, 0xf0, 0xd5, 0xbd, 0xe6, 0x91, 0xdd, 0xa9, 0x80, 0xb4, 0x44, 0xea, 0xc9, 0x99, 0x7b, 0x75, 0x2a, 0x0e, 0xc0, 0xeb, 0xc3, 0xfe, 0xf8, 0x15, 0x37, 0x15, 0x20, 0x87, 0x41, 0xb1, 0x8d, 0x37, 0x69, 0x88, 0xd2, 0x0c, 0x07, 0x84, 0x84, 0x61, 0x3a, 0xbe, 0x52, 0x26, 0x3e, 0x08, 0x95, 0xac, 0x88, 0x69, 0xb7, 0xe5, 0x24, 0x01, 0x02, 0xbe, 0x12, 0xc4, 0x06, 0x82, 0x09, 0xe4, 0xd3, 0x2e, 0xb4, 0x61, 0x0d, 0xc0, 0x3a, 0x01, 0x37, 0x8c, 0x5c, 0xf8, 0xc4, 0x2f, 0x90, 0x21, 0x09, 0x39, 0xd2, 0x5e, 0x87, 0xcd, 0x0d, 0xee, 0x37, 0x5c, 0x31, 0xbc, 0xb5, 0x63, 0x1e, 0x12, 0x93, 0x68, 0x0f, 0x6b, 0x9c, 0xf8, 0x71, 0x0a, 0xa9, 0x58, 0x5a, 0x67, 0xcb, 0x43, 0x81, 0x1a, 0xeb, 0x31, 0x3b, 0x94, 0x48, 0x54, 0x18, 0x1d, 0xca, 0xec, 0x04, 0x9b, 0x23, 0xd0, 0x90, 0x8a, 0xa2, 0xab, 0x35, 0x40, 0xcd, 0x0e, 0x44, 0xe2, 0xe3, 0x71, 0x15, 0x17, 0x7b, 0x10, 0xdb, 0x61, 0x12, 0x17, 0x40, 0x09, 0xc8, 0xa1, 0x53, 0x96, 0x58, 0x87, 0xc4, 0xda, 0x91, 0xf4, 0x70, 0xa4, 0x89, 0x6c, 0x67, 0x82, 0xbb, 0xa8, 0x53, 0xbc, 0xdb, 0x58, 0xc5, 0xd7, 0x8d, 0xf5, 0x35, 0x5e, 0x91, 0xcc, 0x5a, 0x46, 0xe9, 0x57, 0x18, 0x16, 0xd1, 0x61, 0x15, 0x67, 0x56, 0xbc, 0xce, 0xa3, 0x1d, 0xb1, 0xc8, 0x6e, 0x41, 0x56, 0x56, 0xb6, 0xf8, 0x0b, 0x48, 0xe8, 0x66, 0xdd, 0xbb, 0x78, 0xb5, 0x4a, 0xc8, 0x5c, 0xd4, 0xb8, 0x48, 0xb2, 0xe5, 0x17, 0x8a, 0x92, 0xa2, 0x3b, 0xee, 0xa2, 0x07, 0x31, 0xab, 0x51, 0xe8, 0x72, 0xde, 0xd2, 0xd6, 0x30, 0x41, 0x6f, 0xc5, 0xe9, 0xfe, 0x50, 0x5a, 0x4c, 0xfc, 0x5b, 0xd9, 0xbe, 0xdc, 0xe4, 0xd9, 0x61, 0x6f, 0x21, 0x0f, 0x41, 0x70, 0x44, 0xb4, 0x3b, 0xd5, 0x39, 0xd9, 0x1a, 0x81, 0x4a, 0xae, 0x66, 0x60, 0x89, 0xfc, 0x04, 0x12, 0x70, 0x53, 0xc6, 0xb5, 0x1d, 0x91, 0xac, 0xf6, 0x4c, 0x86, 0xb9, 0xe5, 0x63, 0xe8, 0xcd, 0x71, 0x65, 0x43, 0x62, 0xd2, 0x95, 0xd8, 0x4c, 0xd0, 0xcd, 0x09, 0xef, 0x3a, 0xb6, 0xf4, 0x76, 0xaf, 0x5f, 0xdf, 0x3f, 0xdd, 0x4c, 0xba, 0x32, 0xba, 0xc3, 0xb8, 0xb8, 0xf9, 0xb4, 0x83, 0x79, 0x17, 0xc3, 0xfa, 0xf4, 0xd9, 0xfa, 0x84, 0x33, 0xe2, 0x33, 0xee, 0x9f, 0x79, 0x7f, 0xe8, 0x04, 0xd5, 0x45, 0x08, 0xf0, 0x07, 0x34, 0xee, 0xc8, 0x17, 0x6a, 0x9b, 0xed, 0xc3, 0x61, 0x18, 0x46, 0x79, 0x19, 0xfa, 0xb0, 0x83, 0xeb, 0xe2, 0x23, 0xdf, 0xd7, 0x73, 0x78, 0x92, 0xae, 0xc2, 0x11, 0x05, 0x86, 0xd1, 0xb6, 0x24, 0x5b, 0x4a, 0xc9, 0xb1, 0x6a, 0xfb, 0x49, 0xb2, 0x19, 0xd0, 0xcd, 0x7d, 0x65, 0x37, 0x88, 0xf6, 0x7b, 0x12, 0xc1, 0x72, 0xb4, 0x24, 0x21, 0xfe, 0x86, 0x8a, 0xf6, 0xa0, 0x3e, 0xb3, 0x3a, 0x84, 0xa1, 0x80, 0x6b, 0xbd, 0x50, 0x57, 0x09, 0x73, 0xaf, 0x88, 0x97, 0x5c, 0xb4, 0xec, 0x1f, 0xcc, 0xa3, 0x5a, 0x21, 0xe3, 0xeb, 0xf2, 0x90, 0xe3, 0xd2, 0x46, 0xd7, 0x65, 0xb9, 0x66, 0x9e, 0x4b, 0xf5, 0xec, 0x5d, 0xfc, 0x70, 0x13, 0xa7, 0x46, 0x12, 0x2d, 0xac, 0x1c, 0xe6, 0x10, 0xfc, 0x67, 0x76, 0x20, 0x93, 0xc1, 0x41, 0xa5, 0x87, 0x02, 0x1c, 0x3f, 0xcd, 0x31, 0xc6, 0xee, 0x95, 0x25, 0xad, 0xa7, 0xa0, 0x98, 0x9d, 0xaa, 0x39, 0x02, 0x32, 0x01, 0x09, 0x15, 0x33, 0x13, 0xb8, 0x23, 0x9a, 0x5d, 0x40, 0xa3, 0x97, 0x5b, 0x69, 0x09, 0x3a, 0x6a, 0x18, 0x42, 0xa5, 0x40, 0x5d, 0x66, 0x15, 0x95, 0xa0, 0x29, 0xc1, 0xe8, 0x29, 0xe3, 0x1d, 0x81, 0x71, 0x09, 0x9b, 0xa7, 0xe3, 0x0e, 0xd8, 0x22, 0x14, 0xa2, 0x64, 0xcb, 0xd6, 0x35, 0x36, 0xff, 0xc5, 0x92, 0xa6, 0x96, 0xa7, 0x45, 0x41, 0xb7, 0x2d, 0x2b, 0x51, 0xc4, 0x3b, 0x70, 0x9d, 0x90, 0x87, 0x2e, 0x58, 0x7b, 0x1d, 0x93, 0x64, 0x55, 0xd8, 0xf7, 0x39, 0x12, 0x97, 0x1f, 0x65, 0x1d, 0x51, 0x8f, 0x5c, 0x8c, 0x26, 0x2a, 0x75, 0xba, 0xe1, 0xec, 0x47, 0x68, 0x2a, 0xc3, 0x3e, 0xb8, 0x08, 0xac, 0x3f, 0xe5, 0xf6, 0xc2, 0x32, 0x2b, 0x18, 0x52, 0x97, 0x95, 0xd8, 0xc2, 0x52, 0x7b, 0x29, 0x61, 0x71, 0x7a, 0x80, 0x0e, 0xba, 0xac, 0x50, 0x01, 0x03, 0x00, 0x7a, 0xf4, 0xd2, 0x9a, 0x12, 0x58, 0x2b, 0x9e, 0x54, 0x12, 0x86, 0xc4, 0x2a, 0x06, 0xf5, 0xb7, 0xa3, 0x18, 0x5d, 0xe4, 0x40, 0x57, 0x89, 0x61, 0xad, 0x01, 0x3d, 0x9e, 0x29, 0xfb, 0xcc, 0x28, 0x43, 0x07, 0xa3, 0xbc, 0x34, 0x54, 0x5a, 0xe0, 0xe3, 0x9e, 0x7c, 0x60, 0x19, 0x20, 0x5f, 0xe8, 0x17, 0x8c, 0x7b, 0x52, 0x8a, 0x0f, 0x58, 0x9b, 0x77, 0x71, 0x29, 0xa9, 0x89, 0xd2, 0x08, 0x67, 0xc5, 0x98, 0xca, 0xdf, 0x4e, 0x6e, 0xa5, 0x74, 0xc9, 0xa2, 0x17, 0xc1, 0x2c, 0x90, 0xc4, 0x69, 0x4a, 0x85, 0x3a, 0xcc, 0x2c, 0x8e, 0x5e, 0x5e, 0x1c, 0x6b, 0x38, 0xd0, 0x00, 0x7a, 0xe0, 0x3e, 0x6d, 0x61, 0xfd, 0x25, 0xe9, 0x67, 0xce, 0x25, 0x60, 0x5f, 0x79, 0xc3, 0xd3, 0x3e, 0x1c, 0xd2, 0x32, 0x4e, 0x40, 0x97, 0x80, 0x95, 0x00, 0x44, 0x71, 0x35, 0x13, 0x91, 0xc3, 0x7f, 0x17, 0xef, 0x50, 0x58, 0x45, 0xa0, 0x98, 0x8b, 0x92, 0x68, 0xf3, 0x32, 0x2d, 0xfa, 0x27, 0xdc, 0x46, 0xc5, 0x0d, 0x65, 0xbe, 0x43, 0x0d, 0x62, 0xd4, 0x1e, 0x90, 0x83, 0x8a, 0x42, 0xf2, 0x4f, 0x54, 0x1e, 0x7c, 0xa0, 0x5a, 0xfe, 0xe7, 0x70, 0xb9, 0x25, 0xcb, 0x2f, 0x20, 0xd2, 0xac, 0x4f, 0xd0, 0xff, 0x91, 0x4d, 0x81, 0x79, 0x1e, 0x13, 0x6b, 0x76, 0xb1, 0xc4, 0xb4, 0x90, 0xa6, 0xd5, 0xf6, 0x08, 0xdc, 0xc5, 0x7b, 0x95, 0xe9, 0x02, 0x35, 0x03, 0xc3, 0x35, 0x5c, 0x53, 0x05, 0x90, 0xac, 0x30, 0x33, 0x5d, 0x7e, 0x6d, 0x7a, 0xb9, 0x1b, 0xeb, 0xf2, 0x91, 0x68, 0x54, 0xc1, 0x18, 0x8c, 0xef, 0x09, 0x3b, 0xce, 0x6c, 0xec, 0xcc, 0x66, 0x92, 0x75, 0x68, 0x9f, 0xc7, 0xa8, 0x34, 0x09, 0x8b, 0xcb, 0x98, 0x9a, 0x86, 0x0c, 0x7f, 0x3a, 0x75, 0x5c, 0x3f, 0x68, 0x81, 0x35, 0xd0, 0xde, 0x55, 0x46, 0x97, 0xa9, 0xef, 0x4c, 0x67, 0x92, 0xd1, 0x87, 0x4d, 0x9c, 0x1a, 0xf1, 0x84, 0x21, 0xf6, 0x8c, 0x60, 0x3c, 0x72, 0x02, 0x57, 0x07, 0xd9, 0xc4, 0x3d, 0xa2, 0x56, 0xa2, 0x99, 0x11, 0x8c, 0x7c, 0xd0, 0x36, 0xa5, 0x12, 0xd1, 0x72, 0x59, 0x83, 0x4d, 0xa9, 0x39, 0x6d, 0xec, 0x1b, 0xde, 0xcc, 0x73, 0xee, 0x3c, 0xbf, 0x09, 0xd6, 0xc0, 0x1a, 0x50, 0x83, 0xd6, 0x24, 0x00, 0xf0, 0x99, 0x33, 0xf2, 0x26, 0x35, 0x78, 0x4a, 0x0e, 0xb0, 0xc2, 0x24, 0xa2, 0x57, 0x68, 0xed, 0xee, 0x98, 0x31, 0x4c, 0xe6, 0x04, 0x87, 0x6b, 0x52, 0x4b, 0xad, 0x5f, 0x2e, 0x70, 0x62, 0x36, 0x71, 0x02, 0x89, 0x8a, 0x38, 0x5d, 0x67, 0x82, 0x54, 0xc4, 0xe9, 0x41, 0x1f, 0x04, 0xbe, 0x33, 0x99, 0x78, 0x2a, 0x4c, 0xb3, 0xc3, 0xee, 0x28, 0x9d, 0x00, 0x3c, 0x0a, 0xa0, 0x79, 0x53, 0x89, 0x5f, 0x07, 0x68, 0x57, 0x51, 0x08, 0x9c, 0x68, 0x20, 0xf3, 0xa6, 0x53, 0xc3, 0x9b, 0x04, 0x8e, 0x2f, 0xd3, 0xc9, 0xe1, 0x9a, 0xed, 0x47, 0x76, 0xb9, 0x14, 0x7e, 0xe6, 0xdc, 0x49, 0xa6, 0xb7, 0xfb, 0x28, 0x4f, 0x71, 0xb9, 0xe1, 0xe6, 0x3c, 0x6c, 0x8e, 0x37, 0xbb, 0x33, 0x66, 0x23, 0x67, 0xe4, 0xdf, 0xb5, 0xc0, 0x1a, 0x58, 0x47, 0x1e, 0xb5, 0x53, 0xfa, 0xc6, 0x68, 0xec, 0xdc, 0xb9, 0x12, 0x56, 0x92, 0xe7, 0xb0, 0xba, 0x73, 0x52, 0x3d, 0x61, 0xf8, 0x0c, 0x00, 0xe7, 0xac, 0x01, 0xd4, 0x6c, 0x3f, 0xed, 0x56, 0xe0, 0xbf, 0xe7, 0x3b, 0x2e, 0xa3, 0x93, 0x9b, 0x7b, 0x84, 0x58, 0xaa, 0x8c, 0x3e, 0x3c, 0x9d, 0x0a, 0xdb, 0xda, 0x88, 0xc7, 0x53, 0x41, 0xb6, 0x56, 0x80, 0xd4, 0x08, 0x52, 0x17, 0xf7, 0xe5, 0xe4, 0x46, 0x69, 0x6e, 0x69, 0xf1, 0xa8, 0x6d, 0x7d, 0x45, 0xf6, 0xa8, 0xc1, 0xc3, 0xaf, 0x34, 0x8b, 0xd1, 0xcb, 0x71, 0xfa, 0x1d, 0x5a, 0xae, 0x22, 0xe3, 0x06, 0xf6, 0xa7, 0x6b, 0x92, 0x17, 0xb6, 0x32, 0xdb, 0x61, 0x2c, 0x7f, 0x31, 0x99, 0x15, 0xfd, 0xd8, 0xca, 0xe8, 0x92, 0x02, 0xfe, 0xd8, 0x09, 0xe8, 0x64, 0xc2, 0xf1, 0x31, 0xf6, 0x81, 0x41, 0x9d, 0xf2, 0xc0, 0x87, 0x8e, 0xa6, 0x66, 0x51, 0x6a, 0xec, 0x85, 0xd1, 0xd1, 0x29, 0x19, 0x7c, 0x0f, 0x86, 0x0e, 0x85, 0xf4, 0x01, 0x72, 0x04, 0x8c, 0xec, 0x15, 0x12, 0x77, 0x53, 0x67, 0xe6, 0xd2, 0xf1, 0xe1, 0xdf, 0x31, 0x8b, 0xeb, 0x68, 0xda, 0x25, 0x28, 0xc6, 0x38, 0x8f, 0xfc, 0x20, 0xa0, 0x92, 0xc2, 0xf3, 0xa6, 0x67, 0x25, 0x05, 0xa3, 0x78, 0x46, 0x25, 0x45, 0x20, 0x5b, 0xbd, 0xdf, 0x24, 0xc5, 0x9b, 0xa4, 0xf8, 0xeb, 0x95, 0x14, 0xa7, 0x37, 0x95, 0xe2, 0x4d, 0xa5, 0x78, 0x13, 0x14, 0x6f, 0x82, 0xe2, 0x9c, 0xa0, 0x18, 0x28, 0x27, 0x50, 0x87, 0xe8, 0x10, 0x13, 0x34, 0xeb, 0x4d, 0xe3, 0x78, 0xd3, 0x38, 0xde, 0x04, 0xc9, 0xdf, 0xf4, 0xde, 0x84, 0x07, 0x91, 0x3d, 0x1a, 0xac, 0xa2, 0x28, 0xa9, 0x1c, 0x27, 0xc5, 0x63, 0x5a, 0x46, 0x0f, 0xa1, 0xf1, 0xee, 0xef, 0x01, 0x00, 0x07, 0x60, 0xb4, 0x21, 0x1f, 0xdf, 0xcd, 0x0d, 0x6e, 0xc5, 0x2c, 0x42, 0xa3, 0xcc, 0x0f, 0x04, 0xbf, 0x69, 0xc4, 0x11, 0xb3, 0x7e, 0x86, 0x86, 0x7b, 0x35, 0x67, 0xe2, 0x09, 0xc3, 0x81, 0x1e, 0x78, 0x45, 0x87, 0x3c, 0xb9, 0x79, 0x87, 0xd2, 0x27, 0x84, 0xc9, 0xb7, 0x21, 0xb7, 0xc5, 0xd7, 0xcd, 0x8f, 0x0f, 0xbb, 0xc4, 0xba, 0x0a, 0x7e, 0x82, 0x9f, 0x06, 0xfc, 0x4c, 0x8b, 0x0f, 0xd7, 0x18, 0xf1, 0x16, 0xde, 0xde, 0xde, 0xdf, 0xdf, 0x3b, 0xf7, 0x81, 0x93, 0xe5, 0x9b, 0x5b, 0x90, 0x2a, 0x2e, 0x02, 0x5f, 0x5f, 0x05, 0xff, 0x08, 0xb0, 0xeb, 0x38, 0x29, 0x49, 0x6e, 0xc4, 0xab, 0x0f, 0xd7, 0x91, 0x48, 0x22, 0x3f, 0x1f, 0xf2, 0xc5, 0x21, 0x21, 0xe9, 0x92, 0x18, 0xd4, 0xb8, 0x75, 0xbd, 0xce, 0xa3, 0x65, 0x19, 0x25, 0x7f, 0xc4, 0x9a, 0xaf, 0xa9, 0x33, 0xfe, 0x9f, 0x72, 0xf2, 0xbf, 0x0e, 0x00, 0xf1, 0xf8, 0xe1, 0xda, 0x73, 0x82, 0xd1, 0xb5, 0x91, 0x1e, 0x76, 0xff, 0x0a, 0x30, 0x5f, 0x09, 0xd4, 0x0a, 0x9f, 0x45, 0x19, 0x97, 0xcb, 0xed, 0xcf, 0x71, 0x82, 0xdf, 0xec, 0x83, 0xa3, 0xbf, 0x95, 0xf1, 0x8b, 0x24, 0x4a, 0x05, 0xfb, 0xc8, 0xa1, 0x0b, 0x0c, 0xea, 0xb4, 0x01, 0xd4, 0xa0, 0x48, 0xf9, 0xe3, 0x6b, 0x83, 0xd9, 0x9c, 0xea, 0x6f, 0x06, 0xff, 0xe1, 0x1a, 0x99, 0x70, 0xe5, 0x07, 0x91, 0x79, 0x6d, 0x70, 0x2b, 0xfc, 0x87, 0x6b, 0xd7, 0xf1, 0x45, 0x4d, 0x88, 0x8a, 0xff, 0x84, 0x16, 0xc3, 0xaf, 0x77, 0xa6, 0x24, 0xe7, 0x9d, 0x5d, 0xb6, 0x02, 0x26, 0x43, 0x67, 0xa5, 0x16, 0xfb, 0xfd, 0x09, 0x7f, 0x7f, 0xe6, 0x1f, 0x61, 0x19, 0xe5, 0x1b, 0x52, 0xf2, 0x2f, 0xbb, 0xcc, 0x36, 0x9b, 0x84, 0x08, 0xc9, 0x6f, 0x39, 0xab, 0x3c, 0xba, 0x87, 0x51, 0x40, 0x2d, 0x5e, 0xcb, 0x24, 0x2a, 0x8a, 0xf7, 0x1f, 0x58, 0x12, 0x45, 0xf8, 0xd9, 0xfc, 0xc8, 0x21, 0x1a, 0x05, 0xcd, 0x63, 0xf6, 0x95, 0xe4, 0xeb, 0x24, 0xbb, 0x0f, 0x99, 0x9d, 0x4c, 0xb1, 0x80, 0xbd, 0x2c, 0x5d, 0x8e, 0x44, 0x50, 0x27, 0x3d, 0xe6, 0xb1, 0x58, 0xe2, 0x0a, 0xb7, 0x88, 0x72, 0x7b, 0x73, 0x40, 0x57, 0x4f, 0x58, 0x50, 0x47, 0xa2, 0xec, 0xc9, 0xa1, 0x43, 0x2c, 0x44, 0x13, 0x7a, 0x44, 0x43, 0x7f, 0x56, 0x18, 0xcd, 0x78, 0xc3, 0x5c, 0xa6, 0xea, 0xe2, 0x66, 0x5a, 0xda, 0x54, 0x3a, 0x47, 0xa1, 0x81, 0xf6, 0x62, 0x13, 0x6a, 0x01, 0x2e, 0xf3, 0x60, 0xfc, 0xda, 0x2c, 0xab, 0x1b, 0xa3, 0x50, 0x59, 0xe4, 0x9b, 0x85, 0xbe, 0xfd, 0x16, 0x93, 0x5c, 0x7c, 0x5b, 0x60, 0x8c, 0xdc, 0x2b, 0xf3, 0x24, 0x7a, 0x5e, 0x43, 0xb0, 0xdc, 0x92, 0x46, 0xed, 0x3f, 0xb2, 0x54, 0x93, 0x91, 0xcb, 0x20, 0xa8, 0x1f, 0x4b, 0x80, 0x93, 0x74, 0xd5, 0xd9, 0xa7, 0x6c, 0xf4, 0xcb, 0x5a, 0xcb, 0xe7, 0x63, 0xcb, 0x61, 0xc7, 0x1a, 0xc0, 0x1b, 0xd8, 0xd5, 0x9d, 0x32, 0x68, 0x5b, 0xbd, 0xa8, 0x03, 0x77, 0x96, 0xd9, 0x6e, 0x9f, 0xa5, 0x90, 0x54, 0xcc, 0x79, 0xca, 0xa1, 0x8c, 0x93, 0x98, 0x86, 0xd8, 0x3a, 0x40, 0xd3, 0x71, 0x79, 0xc8, 0x0b, 0xc0, 0xb4, 0xcf, 0x62, 0x28, 0x99, 0xcf, 0x3b, 0x1c, 0x44, 0x2d, 0x13, 0x37, 0x4d, 0x6c, 0x7e, 0x4b, 0x8e, 0x21, 0x94, 0xae, 0x80, 0x8e, 0x63, 0x3b, 0x14, 0x68, 0xc4, 0x66, 0xae, 0x42, 0x86, 0xae, 0x2b, 0xa3, 0x95, 0x80, 0x2e, 0x23, 0xea, 0x13, 0x0a, 0xf1, 0x9f, 0x39, 0x46, 0xf0, 0xc4, 0xeb, 0x5a, 0x1f, 0xe1, 0xf5, 0xd0, 0x4a, 0xa9, 0xaf, 0xbb, 0x10, 0x49, 0x1a, 0xd7, 0x93, 0xc6, 0xa7, 0x2f, 0x2c, 0x59, 0x5b, 0x14, 0x0b, 0x21, 0xfd, 0xd7, 0xa4, 0x8c, 0x61, 0xbf, 0x8f, 0x67, 0xf9, 0x4c, 0x99, 0x68, 0xd3, 0x50, 0xa2, 0x7d, 0x15, 0xac, 0x06, 0x1f, 0x5d, 0x13, 0x4d, 0x64, 0xcb, 0x71, 0x01, 0x2d, 0xc0, 0xa0, 0x06, 0x14, 0x2b, 0x6b, 0xc1, 0x82, 0x8b, 0xa5, 0x14, 0xd2, 0x4c, 0x21, 0x2d, 0x18, 0x52, 0xc3, 0xf0, 0xd0, 0x29, 0x35, 0x7f, 0x17, 0xa7, 0x2c, 0x3c, 0x8d, 0x05, 0xf5, 0x19, 0xb6, 0xc1, 0x48, 0x61, 0xd4, 0xc1, 0x30, 0x63, 0xa5, 0x58, 0x62, 0x85, 0xc5, 0x14, 0x8e, 0xfc, 0x3a, 0x9d, 0x25, 0x98, 0x6a, 0xb8, 0x03, 0xf3, 0x3c, 0x6b, 0x7d, 0xbe, 0x75, 0xc9, 0xbd, 0xd9, 0x84, 0x40, 0x2f, 0xaf, 0x92, 0x5f, 0x47, 0x69, 0xf0, 0x38, 0x42, 0xca, 0x74, 0xf4, 0x39, 0xd3, 0xad, 0x02, 0xf7, 0x06, 0x41, 0x8b, 0xb2, 0xcf, 0x26, 0xf5, 0x55, 0xb2, 0x90, 0x83, 0x75, 0x5c, 0x29, 0x98, 0x3d, 0x05, 0x58, 0x48, 0xdb, 0x51, 0x8c, 0xa7, 0xa8, 0x2c, 0xf3, 0x1b, 0x74, 0xc6, 0xdb, 0x20, 0xf2, 0x48, 0x62, 0x56, 0x25, 0xd9, 0xe7, 0xb1, 0x3d, 0x82, 0x54, 0x00, 0x83, 0xd6, 0xf0, 0xa2, 0xb3, 0x4a, 0xf8, 0xb7, 0xa5, 0x90, 0x94, 0x68, 0x51, 0x64, 0xc9, 0xa1, 0x84, 0x19, 0x97, 0xed, 0x21, 0x3d, 0xe7, 0x21, 0x2b, 0x3c, 0x38, 0xc5, 0x9d, 0x27, 0x64, 0x5d, 0xe2, 0x9e, 0x0a, 0xc8, 0xa2, 0xe4, 0x55, 0xa2, 0x56, 0xa6, 0x95, 0x4a, 0xee, 0x5a, 0xa8, 0x56, 0x99, 0xf8, 0x17, 0x14, 0x74, 0x6c, 0x9c, 0xf5, 0x89, 0xb2, 0x82, 0xcd, 0x47, 0xb2, 0xfa, 0x80, 0xea, 0xd1, 0x67, 0xd3, 0xfc, 0x91, 0x82, 0x70, 0x96, 0x1d, 0x95, 0x00, 0x49, 0xb4, 0xbc, 0x88, 0x51, 0x24, 0x0d, 0x0c, 0xe3, 0xc7, 0xe6, 0xc8, 0x52, 0x43, 0x46, 0x68, 0xdd, 0x28, 0x51, 0x2b, 0x52, 0x35, 0x24, 0x5a, 0x6c, 0x4e, 0x5a, 0x67, 0x09, 0x3c, 0x3b, 0x6b, 0x2f, 0x59, 0xec, 0x5e, 0x85, 0x34, 0x8d, 0xbf, 0xbf, 0x93, 0xda, 0xb6, 0xef, 0xbf, 0x22, 0x89, 0x0e, 0x36, 0x33, 0x24, 0xbb, 0x7d, 0xf9, 0x28, 0xc6, 0x1c, 0x0f, 0xa1, 0x62, 0x82, 0x13, 0x16, 0x96, 0xfb, 0xd0, 0x63, 0x05, 0x68, 0x58, 0x11, 0x3b, 0xb7, 0xc0, 0xe3, 0x8a, 0xa4, 0x38, 0xa0, 0x79, 0x3b, 0xa9, 0x92, 0x8d, 0xeb, 0x0c, 0x94, 0x65, 0xbe, 0x3a, 0x15, 0x21, 0x6b, 0x1d, 0xe7, 0x0b, 0xc3, 0x29, 0xca, 0xb2, 0x00, 0xfb, 0xd0, 0x07, 0xcd, 0x5c, 0x44, 0x2e, 0xc1, 0x6f, 0x16, 0xad, 0x29, 0x62, 0xed, 0xeb, 0x62, 0xf6, 0xd7, 0xb8, 0x88, 0x61, 0x51, 0xec, 0x19, 0x95, 0x2a, 0x20, 0x74, 0x46, 0xa3, 0x26, 0x7b, 0xac, 0xab, 0x8a, 0xd6, 0xf1, 0x09, 0x06, 0x18, 0x2e, 0xb9, 0xab, 0xcf, 0x47, 0x3e, 0x0b, 0x6d, 0xf2, 0x15, 0xd7, 0x41, 0x75, 0x52, 0x39, 0xa3, 0x4a, 0x0d, 0x58, 0x94, 0xa9, 0x79, 0x64, 0xa2, 0xe3, 0x80, 0x07, 0x0f, 0x4e, 0x98, 0xd2, 0x9c, 0xc9, 0xed, 0x25, 0x4e, 0x1f, 0x11, 0xa5, 0x61, 0xc9, 0xf3, 0xd7, 0x42, 0x55, 0x50, 0xf2, 0xf1, 0x0d, 0x44, 0xa2, 0x90, 0x94, 0x87, 0x3c, 0x26, 0xad, 0x37, 0x26, 0x3b, 0xfa, 0x00, 0xbb, 0x1f, 0x18, 0x4c, 0x50, 0xe0, 0x4b, 0xd1, 0xc8, 0x56, 0xa4, 0x38, 0xca, 0x57, 0x59, 0xd4, 0xd6, 0xa1, 0xc0, 0xf8, 0x69, 0x71, 0xc9, 0x6b, 0x56, 0x0d, 0x6b, 0xd6, 0x47, 0xbf, 0xbb, 0x07, 0xb1, 0x39, 0xef, 0xd0, 0x73, 0xb0, 0xec, 0x62, 0xa3, 0x64, 0xd3, 0xfa, 0xd1, 0xbf, 0x6d, 0x51, 0x99, 0xc2, 0xe0, 0xe8, 0xae, 0xcb, 0x7c, 0x8f, 0x02, 0xc6, 0x6c, 0xab, 0xc6, 0xc8, 0x1e, 0xab, 0x46, 0xc8, 0x80, 0xc5, 0x6a, 0xc4, 0xfa, 0x54, 0x91, 0x3f, 0x73, 0xcd, 0x11, 0x1d, 0xcd, 0x92, 0x4c, 0x89, 0xe3, 0x25, 0x58, 0x1c, 0xb1, 0x38, 0x3b, 0xe2, 0xc0, 0xc8, 0x33, 0x54, 0x6b, 0xf3, 0xad, 0x44, 0x2d, 0xdd, 0x96, 0x9a, 0xef, 0x1d, 0x6f, 0x0c, 0x2d, 0x2f, 0xb3, 0xc3, 0x72, 0x4b, 0xa5, 0x02, 0x88, 0xee, 0x5d, 0x94, 0xc6, 0xfb, 0x43, 0x42, 0xc3, 0x71, 0xe6, 0x52, 0xe4, 0x03, 0x47, 0x39, 0x14, 0xf3, 0xe4, 0xca, 0xc4, 0xb5, 0x06, 0xc6, 0x96, 0xd4, 0x6c, 0x86, 0xca, 0xe4, 0xfb, 0xe6, 0x50, 0x2a, 0x55, 0xef, 0xa3, 0x2d, 0xb6, 0x8f, 0x46, 0x4e, 0x22, 0x20, 0x63, 0xff, 0xf9, 0x7e, 0xf4, 0xf9, 0x26, 0x82, 0x8d, 0x9d, 0x6e, 0xd1, 0xca, 0x41, 0x2a, 0x55, 0xa8, 0xe6, 0x60, 0xb3, 0xbf, 0x45, 0x07, 0x80, 0x3a, 0xc0, 0xff, 0xe5, 0xc1, 0x69, 0x0c, 0xee, 0x2f, 0x30, 0xe1, 0x40, 0xeb, 0xe1, 0x94, 0xc8, 0x76, 0x04, 0xb3, 0x51, 0x18, 0xf4, 0x05, 0x5d, 0x51, 0xd2, 0x5b, 0x14, 0x0b, 0xe9, 0x0b, 0x92, 0xf3, 0x05, 0xbb, 0xc8, 0x25, 0x1d, 0xe4, 0xd6, 0x3a, 0x6c, 0x9a, 0x51, 0x2d, 0x96, 0x26, 0x14, 0xdb, 0x1c, 0x26, 0x25, 0xac, 0xd6, 0xc3, 0x75, 0xda, 0x0d, 0xa0, 0x70, 0x02, 0x76, 0x96, 0x42, 0x8e, 0xc9, 0xc3, 0x63, 0x02, 0x74, 0x89, 0xa0, 0xea, 0x81, 0x2d, 0x2c, 0x20, 0x6c, 0x99, 0xb1, 0x9a, 0x33, 0xcf, 0x92, 0x47, 0xba, 0x55, 0x8f, 0x41, 0x19, 0xc5, 0xea, 0xc0, 0x83, 0x96, 0x1d, 0xbf, 0x90, 0xd3, 0xcb, 0x78, 0x87, 0x12, 0x68, 0x7d, 0x48, 0xd9, 0x70, 0x5e, 0x1e, 0x16, 0xf1, 0xd2, 0x5e, 0x90, 0x5f, 0x62, 0x92, 0xdf, 0xb8, 0x96, 0x0b, 0xc3, 0xcb, 0xf2, 0x4c, 0x9d, 0xf2, 0x7d, 0xd9, 0xa2, 0x8b, 0xa2, 0x57, 0x19, 0x3d, 0x9d, 0x2b, 0x26, 0x1f, 0x50, 0x16, 0xae, 0x2f, 0x46, 0x7b, 0xa2, 0x8c, 0x61, 0xa2, 0x9c, 0x4e, 0x12, 0xbe, 0x6a, 0xbe, 0x05, 0x30, 0xcf, 0x70, 0xcd, 0xb0, 0xf1, 0x1f, 0x15, 0x97, 0x6b, 0x8c, 0x20, 0x2d, 0xd0, 0x66, 0x3e, 0xb5, 0x1d, 0xfa, 0x7a, 0xcf, 0x35, 0xab, 0xdd, 0xa0, 0x00, 0x04, 0x20, 0x6d, 0xac, 0xdb, 0xa2, 0xf3, 0x59, 0xc8, 0x14, 0x26, 0x31, 0x1b, 0x17, 0x5f, 0x03, 0xb8, 0xc9, 0x0b, 0x74, 0x61, 0xba, 0x96, 0x18, 0x14, 0xae, 0x11, 0xdc, 0x4e, 0x4f, 0xbc, 0xa8, 0x6a, 0x83, 0xba, 0xa5, 0x82, 0x32, 0x7c, 0x4b, 0x75, 0xa1, 0xd0, 0xb9, 0x98, 0xdf, 0xcd, 0x6a, 0x7a, 0xb9, 0xd2, 0x57, 0x33, 0x1b, 0x52, 0x53, 0x34, 0x15, 0x50, 0xde, 0xa8, 0xda, 0xc8, 0x31, 0xc6, 0x10, 0x7a, 0x16, 0xd8, 0x4f, 0x7f, 0xd5, 0x8b, 0x3e, 0x5b, 0x70, 0x24, 0x35, 0x48, 0x5e, 0x67, 0x18, 0x2a, 0xa6, 0x45, 0x31, 0x23, 0x02, 0xd2, 0x21, 0xb4, 0xaa, 0x4b, 0x25, 0x32, 0x9d, 0x9a, 0x58, 0x39, 0x5f, 0x40, 0x2e, 0xe7, 0xd6, 0x59, 0x4a, 0x9e, 0xc9, 0xbf, 0xf1, 0x15, 0x1f, 0x5a, 0xe7, 0x6a, 0x6a, 0xae, 0x12, 0x2f, 0x3b, 0x28, 0x06, 0x55, 0xfe, 0x12, 0x43, 0x65, 0x40, 0x6d, 0xd2, 0x09, 0x54, 0xfc, 0xbf, 0x6c, 0x9b, 0xba, 0xa5, 0xb3, 0x5a, 0x9b, 0xce, 0x30, 0x83, 0x9e, 0x1c, 0x0a, 0xd5, 0xd6, 0xaa, 0x95, 0x5c, 0x8b, 0x56, 0x23, 0x3e, 0xcd, 0xba, 0x66, 0x54, 0xfc, 0x58, 0xe6, 0x06, 0x8f, 0x45, 0x99, 0x5d, 0xf6, 0xa6, 0x67, 0x6f, 0x93, 0x5e, 0x87, 0xb8, 0x4b, 0x36, 0x4a, 0x5e, 0x7b, 0xa3, 0xf4, 0x32, 0x44, 0x35, 0xe2, 0x53, 0x2f, 0xc0, 0xaa, 0xdd, 0x7b, 0x28, 0x43, 0x4e, 0x9c, 0x79, 0xae, 0xa5, 0xae, 0x04, 0xd3, 0xa7, 0x69, 0xbd, 0x56, 0xef, 0x1c, 0xab, 0xaa, 0x9b, 0xbc, 0x5f, 0x6e, 0xbb, 0x79, 0xef, 0x03, 0xef, 0xc5, 0x3a, 0xd2, 0xbd, 0x00, 0x0c, 0xec, 0x0a, 0x26, 0xc0, 0x75, 0xac, 0xeb, 0x1d, 0xbc, 0xdc, 0xfb, 0xf7, 0x7a, 0xe3, 0x96, 0xd1, 0x75, 0xe9, 0x18, 0x15, 0x64, 0xf9, 0xcf, 0x1a, 0x9e, 0xca, 0xa2, 0xd6, 0x1e, 0x3a, 0xbf, 0xc6, 0x48, 0x51, 0x68, 0x7a, 0xc6, 0x78, 0xa9, 0xf8, 0x20, 0x59, 0xe7, 0xa8, 0x01, 0x00, 0x26, 0xde, 0x67, 0x4b, 0x63, 0xe3, 0x7b, 0x8e, 0x39, 0xed, 0xd2, 0xca, 0xce, 0xda, 0x07, 0x11, 0x1d, 0xb3, 0x20, 0xb0, 0x80, 0x75, 0x61, 0xba, 0xa0, 0xf2, 0x84, 0xbb, 0xf7, 0xa8, 0x6d, 0x41, 0xcc, 0xac, 0xf6, 0xc0, 0xe5, 0x0e, 0xfc, 0x8e, 0xfd, 0x55, 0xc3, 0xbd, 0x6f, 0xce, 0x5b, 0x8a, 0xc7, 0xc9, 0x49, 0xb2, 0x08, 0x2d, 0x03, 0xda, 0x39, 0x13, 0x15, 0x7b, 0xb2, 0xc4, 0xed, 0x0a, 0x14, 0x09, 0xbd, 0x0e, 0x7b, 0x05, 0x53, 0x59, 0x9a, 0x3b, 0x46, 0xe1, 0x90, 0xad, 0x36, 0x8d, 0x13, 0xcd, 0x3e, 0x5e, 0x3e, 0x08, 0xd3, 0x54, 0xfc, 0xa9, 0x75, 0xaf, 0xb2, 0x70, 0xec, 0xa2, 0xe2, 0x0b, 0xdf, 0xb0, 0x9f, 0x71, 0x9f, 0x72, 0xff, 0xa3, 0x3f, 0xaa, 0x7d, 0x8f, 0x3e, 0xf5, 0x6a, 0xe6, 0xd9, 0x17, 0xf2, 0xe1, 0x9a, 0x1e, 0x69, 0xbf, 0x36, 0xbe, 0xc6, 0xe4, 0xfe, 0xbf, 0x66, 0x0f, 0x1f, 0xae, 0x71, 0xb5, 0xc4, 0x10, 0x2b, 0x00, 0x19, 0xea, 0x78, 0xdd, 0x18, 0x74, 0x2e, 0xae, 0xb3, 0x7c, 0x87, 0xb7, 0x83, 0x6c, 0xe2, 0xf4, 0xc3, 0x35, 0xdb, 0x65, 0x71, 0x80, 0x65, 0x9c, 0x2f, 0x13, 0x62, 0x2c, 0x01, 0xbd, 0xe7, 0x5f, 0x1b, 0xd4, 0xd3, 0x0a, 0x7f, 0xf3, 0x0f, 0xd7, 0x77, 0x0e, 0x73, 0x81, 0x26, 0x1f, 0xae, 0x91, 0xc1, 0x82, 0x2c, 0x9b, 0x13, 0x1d, 0x54, 0x09, 0xc8, 0x82, 0x65, 0xb4, 0xff, 0x70, 0x4d, 0xd9, 0xc5, 0xf1, 0xc2, 0xfe, 0x7f, 0x07, 0x7d, 0xf6, 0xb3, 0xa8, 0xdd, 0xc0, 0x21, 0x15, 0x2f, 0x0e, 0x25, 0xf9, 0x63, 0xb4, 0x83, 0xb6, 0x55, 0x64, 0x5d, 0x73, 0xe7, 0x6f, 0x9e, 0x95, 0x00, 0x0f, 0x35, 0xe6, 0xd9, 0x0e, 0x9b, 0xea, 0xf9, 0x06, 0x12, 0x52, 0x66, 0x50, 0xd5, 0xa4, 0xfa, 0x84, 0x0d, 0x1b, 0xf0, 0xa8, 0x00, 0x02, 0x09, 0x8c, 0x77, 0xe8, 0x8d, 0x43, 0x0a, 0x4c, 0xc3, 0x73, 0x88, 0x6b, 0x74, 0x67, 0x93, 0xeb, 0x5b, 0xa5, 0xfa, 0x66, 0xad, 0x9c, 0xe2, 0x55, 0x04, 0x0b, 0x5d, 0x9e, 0x47, 0x8f, 0xc0, 0x5c, 0x74, 0x7e, 0x03, 0x27, 0x5d, 0xcb, 0x1b, 0xbb, 0xf3, 0x91, 0x2f, 0xfd, 0xb9, 0x36, 0xbe, 0x90, 0xc7, 0x9f, 0xe3, 0x1d, 0xcd, 0x9e, 0xbb, 0xce, 0x68, 0x3a, 0x9e, 0x7b, 0x9c, 0x04, 0xcf, 0x19, 0xbf, 0x04, 0x11, 0xcc, 0x6e, 0x26, 0x51, 0x31, 0xb7, 0xbd, 0xc9, 0xdc, 0x1e, 0xdf, 0x3d, 0xbb, 0xee, 0x5b, 0xd6, 0xb1, 0xfc, 0x63, 0xd3, 0xf0, 0x4f, 0xcf, 0xdf, 0xc6, 0xe8, 0xdb, 0x18, 0xfd, 0xde, 0xc7, 0xa8, 0x22, 0x4f, 0x2b, 0xa7, 0xd0, 0xd8, 0xbd, 0x9a, 0xb7, 0x53, 0x14, 0x58, 0x76, 0xa2, 0xd1, 0x15, 0x80, 0xf5, 0xa7, 0x02, 0xc5, 0x88, 0x83, 0xc5, 0x83, 0xff, 0x9a, 0x6b, 0x53, 0xa9, 0x95, 0xbd, 0x80, 0xf1, 0xb3, 0x2e, 0x99, 0xff, 0xb3, 0xb0, 0xa5, 0xa3, 0x49, 0x73, 0x9e, 0xb4, 0x8a, 0x31, 0x08, 0x84, 0x3a, 0xcc, 0xb2, 0x7b, 0xa9, 0xc8, 0x47, 0xc9, 0x6f, 0x5a, 0x5d, 0xeb, 0xe0, 0xaa, 0x4e, 0x22, 0xb7, 0xe5, 0x02, 0xdd, 0xc5, 0xe9, 0x8d, 0xc6, 0xc2, 0x66, 0xd5, 0xfe, 0xa6, 0xda, 0xb1, 0x69, 0x9a, 0x2d, 0x7f, 0xe9, 0x73, 0x8a, 0xf7, 0x3a, 0x57, 0xb9, 0x61, 0xbe, 0x50, 0x8d, 0xcc, 0xb2, 0x13, 0xd3, 0x35, 0x14, 0x97, 0x66, 0xdb, 0x09, 0x5c, 0x30, 0x75, 0x8e, 0xb9, 0x49, 0x24, 0x60, 0x19, 0xc6, 0xac, 0x2e, 0x48, 0xa2, 0xee, 0xb7, 0x3c, 0xad, 0x8c, 0xdb, 0x46, 0xed, 0x7d, 0xfb, 0xd1, 0xb8, 0xac, 0x99, 0xef, 0x7d, 0xd3, 0x50, 0x51, 0xf2, 0x6e, 0x7c, 0x12, 0xb7, 0x38, 0x8a, 0x6a, 0x08, 0x96, 0xd9, 0xde, 0x40, 0x6f, 0xa4, 0x85, 0x3f, 0xa8, 0x9f, 0x52, 0x67, 0x95, 0xaf, 0x1b, 0x5a, 0x79, 0x83, 0x65, 0x17, 0x30, 0xe7, 0xae, 0xa9, 0x33, 0xd1, 0xb7, 0xf8, 0x78, 0xde, 0xb4, 0xac, 0x8c, 0xa9, 0x73, 0xc6, 0x64, 0x65, 0x04, 0xf5, 0x9b, 0x8f, 0x95, 0xb1, 0x71, 0xce, 0x60, 0xac, 0x0c, 0x2d, 0xb3, 0x39, 0x33, 0x06, 0xf9, 0x61, 0x99, 0x8a, 0x89, 0x50, 0x1a, 0x5d, 0x9d, 0xf9, 0x73, 0x1b, 0x28, 0x15, 0x0d, 0x55, 0xe7, 0xc7, 0x34, 0xd5, 0x29, 0xa9, 0x19, 0xce, 0x62, 0x6e, 0xaa, 0x53, 0x55, 0x3b, 0xa0, 0x3b, 0x06, 0x71, 0xdf, 0xd8, 0xee, 0x1a, 0xf8, 0xcd, 0x79, 0xa6, 0x58, 0x7a, 0xd9, 0x9c, 0x6a, 0x05, 0x2f, 0x28, 0x5f, 0xe7, 0xc1, 0x79, 0x15, 0xec, 0xce, 0x31, 0x14, 0x61, 0x06, 0xfd, 0xc7, 0x35, 0x6a, 0x71, 0x46, 0x43, 0xaf, 0x98, 0x92, 0x3c, 0xb9, 0xbb, 0xd2, 0x61, 0x10, 0x23, 0x85, 0x06, 0x39, 0xb0, 0xe8, 0xc3, 0x3a, 0x5e, 0x8b, 0xaf, 0xd6, 0x51, 0x69, 0x54, 0xb3, 0xa2, 0xd9, 0x68, 0x84, 0x95, 0x67, 0x98, 0xc2, 0x84, 0x46, 0x1b, 0x28, 0x2c, 0x4c, 0x77, 0xd0, 0xcd, 0xf7, 0x0f, 0x97, 0x16, 0x52, 0x29, 0x97, 0x0b, 0x6f, 0x06, 0x15, 0xa9, 0xea, 0x95, 0x5a, 0x8d, 0x81, 0x1b, 0xfd, 0x6d, 0xa6, 0x02, 0xe0, 0xaf, 0xa2, 0xd1, 0x1d, 0x86, 0x08, 0x8e, 0xac, 0x8a, 0xbc, 0xf8, 0x1e, 0xa6, 0xb4, 0xc9, 0xaf, 0x6b, 0x3a, 0xfe, 0x42, 0xaf, 0x25, 0x79, 0x80, 0x3d, 0xa0, 0xd8, 0xcd, 0xbe, 0x7b, 0x37, 0x6f, 0x8a, 0x61, 0x79, 0x59, 0xd1, 0x04, 0xfa, 0x28, 0x4b, 0x84, 0xc2, 0x86, 0x4a, 0xe4, 0xb7, 0x80, 0x45, 0x8e, 0xc6, 0x6f, 0xab, 0xac, 0x2f, 0x74, 0xd6, 0x98, 0xaa, 0x0b, 0x0d, 0xa3, 0xe9, 0x5a, 0xbe, 0xe1, 0xcb, 0x56, 0xa6, 0x0b, 0xd7, 0x31, 0x26, 0x00, 0xea, 0x4c, 0xfa, 0xad, 0xd0, 0xd0, 0xd2, 0x8f, 0x94, 0x58, 0x96, 0x76, 0x94, 0xce, 0x77, 0x36, 0x1a, 0xd6, 0x71, 0x5e, 0x94, 0xf6, 0x72, 0x1b, 0x27, 0x2b, 0x31, 0x32, 0x1a, 0x82, 0x8b, 0xda, 0x49, 0xa0, 0xa6, 0xfc, 0x43, 0x5e, 0x26, 0x9f, 0x8d, 0xef, 0x9e, 0xfc, 0x6a, 0x3b, 0x12, 0xb2, 0x7d, 0xc8, 0xbf, 0xdd, 0x78, 0x33, 0x77, 0x45, 0xbe, 0xbb, 0x79, 0x98, 0x44, 0x9d, 0x8c, 0x47, 0xd9, 0xf9, 0x5d, 0xb3, 0xbd, 0x4d, 0x7b, 0x37, 0xd7, 0xeb, 0x2a, 0x58, 0x74, 0xb0, 0x14, 0x2d, 0x66, 0xb2, 0x4a, 0xe5, 0x4e, 0xac, 0xc8, 0xed, 0x8d, 0x9b, 0x7a, 0x65, 0x05, 0x43, 0xa2, 0xd9, 0x50, 0xa2, 0xdb, 0x28, 0x2c, 0xff, 0xb0, 0xf9, 0x8d, 0x73, 0x74, 0xad, 0xb0, 0xbd, 0xf7, 0xea, 0x7a, 0x42, 0x9d, 0x36, 0x73, 0x05, 0xbe, 0x15, 0xbc, 0xd9, 0xcc, 0x68, 0x48, 0xc0, 0x45, 0xf6, 0x60, 0x6a, 0x01, 0x49, 0x31, 0x14, 0x50, 0x83, 0xb1, 0x31, 0x0b, 0x0c, 0x25, 0x1c, 0x90, 0xa7, 0xe9, 0x62, 0xda, 0xe4, 0x22, 0x97, 0xc7, 0x05, 0xca, 0x7d, 0x6c, 0xfd, 0x3a, 0x14, 0xe0, 0x1d, 0x2e, 0xb4, 0xfe, 0x9b, 0xf4, 0xc7, 0xc0, 0x3c, 0x76, 0x74, 0x4d, 0x9b, 0x5f, 0x8e, 0x12, 0xc4, 0x89, 0x9e, 0xee, 0xb9, 0x4e, 0x21, 0x96, 0xe2, 0xda, 0x9e, 0x17, 0xe1, 0x79, 0xde, 0x25, 0x47, 0x23, 0x87, 0x3b, 0x2c, 0xb7, 0x78, 0x97, 0x27, 0xbb, 0x89, 0x58, 0x84, 0x97, 0x70, 0x63, 0x6e, 0x12, 0xed, 0xf6, 0x37, 0x41, 0x4e, 0x76, 0x96, 0xef, 0xe2, 0xbf, 0x2c, 0x76, 0x4a, 0x13, 0xf5, 0xd5, 0x17, 0xa0, 0xd4, 0xda, 0x70, 0x51, 0xde, 0x08, 0xb5, 0x5c, 0x09, 0x60, 0xf2, 0xaa, 0x50, 0x09, 0x19, 0x86, 0x47, 0x29, 0xb9, 0x86, 0xed, 0x0d, 0x0b, 0x99, 0x12, 0x81, 0x4d, 0x7f, 0x7b, 0x21, 0x42, 0x3c, 0x22, 0xc8, 0xeb, 0x0c, 0xfd, 0xa1, 0x81, 0x3f, 0x8d, 0x28, 0x40, 0x47, 0x0a, 0x07, 0x92, 0x83, 0xa4, 0x87, 0x06, 0xc0, 0x5f, 0xe2, 0x1b, 0x62, 0xf3, 0xa2, 0xd5, 0xe9, 0x9d, 0x0e, 0x30, 0x79, 0x1c, 0xb4, 0xbb, 0xda, 0xab, 0x83, 0x4f, 0x9e, 0x3c, 0x48, 0x4e, 0x62, 0xb2, 0x5e, 0x10, 0xf3, 0x26, 0x51, 0xf5, 0x52, 0x4e, 0x33, 0x41, 0x83, 0x8c, 0xfa, 0x12, 0xd7, 0xb5, 0xec, 0x0e, 0x73, 0xe4, 0x8b, 0x8f, 0x58, 0x84, 0xaf, 0xf6, 0x1e, 0x2d, 0x06, 0x67, 0xa8, 0x80, 0x2f, 0x2b, 0x87, 0xe4, 0xbb, 0xe3, 0x18, 0x48, 0xfb, 0x36, 0x3f, 0xfa, 0x7b, 0x28, 0x7d, 0x2c, 0x84, 0xc6, 0xea, 0xce, 0x82, 0x8d, 0x47, 0xb9, 0x8d, 0xd3, 0x17, 0x0c, 0x53, 0x7e, 0x0e, 0x15, 0x17, 0x05, 0x36, 0xb7, 0xb1, 0x31, 0x47, 0xe2, 0x21, 0x4f, 0x50, 0xed, 0xea, 0xca, 0x26, 0xbb, 0x28, 0x06, 0x80, 0x63, 0x6d, 0x29, 0x4d, 0xca, 0xbc, 0x1b, 0x1b, 0x5e, 0xb5, 0xf5, 0xb9, 0x35, 0x20, 0x78, 0x14, 0x3d, 0x1b, 0x39, 0x72, 0xeb, 0x9a, 0x5c, 0x1d, 0x34, 0xf6, 0x87, 0x88, 0xf5, 0x27, 0xcc, 0x8f, 0x1e, 0xc2, 0x5e, 0x41, 0xa4, 0x9c, 0xce, 0xb3, 0xa3, 0xdd, 0x97, 0x9a, 0x25, 0x4e, 0x33, 0x06, 0xda, 0x91, 0x5f, 0xd5, 0xd6, 0x5a, 0x54, 0x8a, 0x7a, 0xcc, 0x47, 0xd6, 0x6d, 0xb2, 0xee, 0xcd, 0x32, 0x3b, 0xdc, 0xeb, 0xa6, 0xd0, 0x38, 0x40, 0x23, 0x86, 0x35, 0x3e, 0xc9, 0xee, 0x89, 0x36, 0x2a, 0xb9, 0x11, 0x7c, 0x34, 0x40, 0x7d, 0xa0, 0x60, 0x2f, 0x2f, 0xf0, 0x9e, 0xda, 0xca, 0x8b, 0xc5, 0xe3, 0xa8, 0x15, 0x3a, 0x41, 0xd5, 0xc1, 0x67, 0x10, 0x61, 0xea, 0x6e, 0x61, 0x7c, 0x19, 0xde, 0xbc, 0x0a, 0x69, 0x97, 0x2e, 0x26, 0x8d, 0x40, 0x93, 0xe7, 0x74, 0x57, 0x2b, 0xfc, 0xa9, 0x07, 0x59, 0x33, 0x41, 0x33, 0xa2, 0x45, 0xf9, 0xde, 0x1b, 0x27, 0x35, 0x57, 0x4c, 0x3a, 0x92, 0x10, 0x4c, 0x0f, 0xbb, 0x05, 0xc9, 0x3f, 0xf7, 0x5d, 0xa7, 0xc7, 0x6f, 0x0e, 0x65, 0x97, 0x0e, 0xda, 0x5c, 0x49, 0x6a, 0x5f, 0x27, 0xca, 0x73, 0x5a, 0x44, 0x81, 0x68, 0x21, 0x78, 0xf3, 0x81, 0xbd, 0x8f, 0x61, 0x2b, 0x82, 0xd7, 0x00, 0xac, 0x40, 0xf5, 0x2e, 0xb3, 0xfc, 0xd8, 0x3e, 0x84, 0xc5, 0x1e, 0xb3, 0x90, 0x90, 0x02, 0x4e, 0x44, 0x09, 0x5d, 0xb0, 0x21, 0xcf, 0x5b, 0x91, 0xbb, 0xca, 0xda, 0x14, 0xb7, 0x5d, 0x6e, 0x81, 0x11, 0x9d, 0xe7, 0x0c, 0x25, 0x18, 0xbd, 0x72, 0xa4, 0x0b, 0xef, 0x10, 0xc5, 0xc4, 0xa1, 0x79, 0x35, 0xbc, 0x43, 0xe4, 0xa2, 0x67, 0x99, 0x9e, 0xba, 0xe7, 0xc0, 0xf2, 0xd9, 0x7e, 0x4c, 0xc0, 0xb0, 0xd1, 0xa7, 0xde, 0x8f, 0x2a, 0xf8, 0x26, 0xa1, 0xea, 0xbc, 0x1d, 0x95, 0xdd, 0x8a, 0xee, 0xc9, 0xda, 0x13, 0x2b, 0xdd, 0x38, 0xb6, 0xa3, 0xdf, 0x3a, 0xb5, 0xee, 0x2d, 0x80, 0x0d, 0xfe, 0x83, 0xcc, 0xa5, 0x46, 0x76, 0x6d, 0x10, 0x1e, 0x9c, 0x61, 0x36, 0x6e, 0xde, 0xed, 0x47, 0x2e, 0x9b, 0x2a, 0x29, 0x5f, 0x1b, 0xd6, 0x50, 0x99, 0x4e, 0x13, 0x70, 0x0f, 0xdf, 0xe8, 0x35, 0xc7, 0x82, 0x39, 0x44, 0xd9, 0x6b, 0x1e, 0x95, 0xaf, 0x6d, 0x53, 0x8d, 0x3e, 0x82, 0xf4, 0xd0, 0xf6, 0x38, 0xef, 0xd5, 0x43, 0x61, 0x5c, 0x66, 0x48, 0x39, 0x55, 0x00, 0xf5, 0x10, 0xed, 0x4a, 0x94, 0xac, 0xef, 0xb4, 0x85, 0x44, 0x64, 0xe7, 0x21, 0x4d, 0x51, 0xc4, 0xd8, 0x20, 0xe8, 0x96, 0x5f, 0x3a, 0x0f, 0x51, 0xf3, 0x11, 0xd4, 0xec, 0x05, 0x7d, 0x07, 0x68, 0x94, 0x5b, 0xa5, 0xbb, 0x1a, 0x1c, 0x7c, 0xef, 0x8c, 0xcd, 0x73, 0xca, 0xe7, 0x30, 0xe2, 0xab, 0x0b, 0x2d, 0x9a, 0x6d, 0x46, 0x11, 0xc1, 0xeb, 0xd5, 0x43, 0x76, 0xb1, 0x87, 0x92, 0xd9, 0xfb, 0x8a, 0xc2, 0xeb, 0x0c, 0xc8, 0x33, 0x63, 0x4e, 0x76, 0x36, 0x68, 0x46, 0xa4, 0x6c, 0x63, 0x11, 0xf5, 0xf1, 0xe7, 0x93, 0x5e, 0x41, 0x88, 0xb6, 0x07, 0x8a, 0x90, 0x79, 0x0d, 0x05, 0x58, 0xda, 0x93, 0x0e, 0xd8, 0x91, 0xc2, 0x26, 0x76, 0x46, 0x0f, 0x72, 0xd9, 0xa3, 0xcb, 0xb6, 0xb2, 0x16, 0xd7, 0x7c, 0x25, 0xc9, 0xc6, 0x43, 0xc1, 0x7d, 0x3c, 0x9b, 0xdd, 0xe2, 0x9a, 0x28, 0x46, 0x71, 0x2a, 0xbd, 0x04, 0xd3, 0xd1, 0xf2, 0xcc, 0xf7, 0xb8, 0x0e, 0xa0, 0x58, 0x37, 0x6c, 0x43, 0x97, 0xdd, 0xd1, 0x0d, 0xb7, 0x3e, 0x10, 0x84, 0xb5, 0x8a, 0x90, 0x02, 0x40, 0xa1, 0xc0, 0xa2, 0xec, 0x37, 0xcf, 0xc5, 0x01, 0xb6, 0x0c, 0x0d, 0xf4, 0xa8, 0x32, 0x06, 0xa4, 0xd4, 0x66, 0xe3, 0xea, 0xec, 0xc2, 0xbf, 0xdd, 0xd8, 0x63, 0xbc, 0x91, 0xe1, 0xf2, 0x55, 0xa2, 0x6f, 0xe0, 0xff, 0x4a, 0xdd, 0x77, 0x66, 0xad, 0xea, 0xdd, 0xb3, 0x7c, 0xc7, 0xfd, 0x7d, 0xea, 0x91, 0x4a, 0xbf, 0x96, 0xf0, 0xd5, 0x51, 0xf4, 0x57, 0x26, 0xf8, 0xde, 0x84, 0xd4, 0xaf, 0x21, 0xa4, 0x9e, 0x26, 0x89, 0xb4, 0xa3, 0xf0, 0x4d, 0x0a, 0xbd, 0x8a, 0x14, 0x12, 0x3b, 0x4c, 0x9d, 0xc9, 0xa4, 0x3a, 0xdb, 0x1f, 0x9c, 0x1c, 0x36, 0x4f, 0x8f, 0xdf, 0xb1, 0xfb, 0xe6, 0xc5, 0x7c, 0x35, 0x74, 0xcf, 0x5c, 0xa9, 0xec, 0x24, 0x49, 0xe2, 0x7d, 0x11, 0x17, 0xaf, 0xec, 0xa2, 0x39, 0x77, 0x47, 0xd5, 0x68, 0xbc, 0x22, 0x1b, 0x1e, 0xf1, 0x83, 0x17, 0x59, 0x28, 0xa3, 0x10, 0x17, 0x7d, 0xab, 0x59, 0xc2, 0x0b, 0x68, 0x91, 0x26, 0x60, 0x8d, 0x43, 0x1f, 0x75, 0x22, 0x5f, 0x3f, 0x82, 0x2f, 0x8a, 0x98, 0x7c, 0x24, 0x41, 0x83, 0x7e, 0x64, 0x15, 0xc9, 0x10, 0xde, 0xc4, 0xf1, 0x34, 0x30, 0xbd, 0x51, 0x1e, 0xcd, 0x28, 0x14, 0x9c, 0x99, 0xf0, 0x9f, 0xc5, 0xff, 0xbe, 0xb9, 0xab, 0xba, 0x4e, 0xaa, 0x37, 0x1c, 0x56, 0x78, 0x33, 0x80, 0xe1, 0x7d, 0x4b, 0xb7, 0x55, 0x25, 0x04, 0xbe, 0x2b, 0xbf, 0x95, 0x22, 0x9a, 0xba, 0x5d, 0xac, 0xaf, 0xe2, 0xaf, 0xe2, 0x75, 0xbf, 0x90, 0xc3, 0xaa, 0xc2, 0x36, 0xcc, 0x05, 0x27, 0xdb, 0x11, 0x04, 0x13, 0x34, 0x33, 0xda, 0xa3, 0x47, 0xda, 0x1b, 0x93, 0xd8, 0x9b, 0xb4, 0x13, 0x05, 0x01, 0x86, 0xa0, 0xe3, 0x65, 0x84, 0x79, 0xf3, 0xb9, 0x2e, 0x3e, 0x3b, 0x1a, 0xa9, 0x92, 0x6f, 0x4a, 0x3a, 0x43, 0xc5, 0x23, 0xb1, 0x7d, 0x87, 0xdf, 0x9a, 0xa2, 0xb9, 0x23, 0x09, 0x5a, 0x67, 0xaa, 0x06, 0xc9, 0xd0, 0xa6, 0x53, 0xc3, 0x16, 0x73, 0xa3, 0x67, 0xde, 0x34, 0x9a, 0x2c, 0x7c, 0x1c, 0x9a, 0xc4, 0x97, 0x77, 0xa8, 0x5d, 0x5a, 0xf3, 0x45, 0x4e, 0x34, 0x15, 0x0f, 0xbd, 0x76, 0xa9, 0x8e, 0x3c, 0x52, 0xce, 0x07, 0xd7, 0x17, 0xbf, 0xe8, 0xcc, 0xba, 0x1e, 0x17, 0x3e, 0x02, 0xa3, 0x4a, 0xe7, 0x77, 0xe2, 0x15, 0x3b, 0x4f, 0xda, 0xeb, 0xf8, 0xc5, 0xce, 0xd7, 0xfb, 0x2a, 0x9e, 0x31, 0x5e, 0x11, 0x75, 0x1c, 0xb0, 0xdf, 0x8a, 0x1b, 0xa2, 0x7e, 0x4a, 0xec, 0xb7, 0xee, 0x1c, 0x7b, 0x6e, 0x43, 0x5f, 0xca, 0x3f, 0xf6, 0x3c, 0x3a, 0x5e, 0xdb, 0x45, 0xf6, 0x0a, 0xd4, 0x3d, 0xd3, 0x4b, 0xd6, 0x4b, 0x51, 0x2b, 0x45, 0xeb, 0xdb, 0x5a, 0x46, 0xf9, 0xea, 0xd8, 0x63, 0xef, 0xa0, 0x81, 0x7b, 0x3d, 0x12, 0xd1, 0x95, 0xe5, 0x21, 0x53, 0xb3, 0xea, 0xc0, 0x00, 0x68, 0xc5, 0x61, 0x97, 0x4a, 0xd7, 0xf1, 0x84, 0xbc, 0x98, 0xe1, 0xf8, 0x85, 0x41, 0xb0, 0x75, 0x20, 0x06, 0x21, 0xad, 0x52, 0xa2, 0x3a, 0xb4, 0x27, 0x4a, 0xe6, 0x8b, 0x5f, 0x08, 0x27, 0x21, 0xbd, 0x48, 0xe6, 0xd7, 0xe5, 0x5a, 0xae, 0x01, 0xcd, 0x53, 0x7b, 0x14, 0x5c, 0x04, 0x46, 0xac, 0xe3, 0xcd, 0x21, 0x27, 0x72, 0xa8, 0xa1, 0x79, 0xec, 0xd6, 0xc3, 0x5b, 0x4b, 0x77, 0x43, 0xd9, 0x6e, 0xe4, 0x37, 0x34, 0xea, 0x83, 0x1c, 0x94, 0xd6, 0x52, 0x9a, 0x59, 0x6e, 0xd3, 0x63, 0xa2, 0x23, 0x56, 0x59, 0xcf, 0x3a, 0x69, 0x3d, 0xb4, 0x43, 0xe0, 0xfa, 0x68, 0xe9, 0x6f, 0x85, 0x96, 0x0b, 0x5a, 0x5a, 0xc5, 0x65, 0x78, 0xf8, 0x5b, 0x6c, 0x94, 0x7b, 0x76, 0xcf, 0x5a, 0x61, 0xaa, 0xc1, 0x84, 0xc7, 0x25, 0xf5, 0x78, 0x30, 0x87, 0xf4, 0x22, 0x72, 0xe8, 0x4a, 0x6f, 0xaf, 0x0f, 0x49, 0x52, 0x85, 0xbd, 0x6c, 0xf2, 0x78, 0xd5, 0xca, 0xfd, 0xf8, 0xfe, 0x88, 0xe9, 0x76, 0x9e, 0xdd, 0xf3, 0x40, 0x76, 0x6f, 0x4e, 0x13, 0xd8, 0xbc, 0x11, 0x69, 0xed, 0x72, 0xa2, 0xb5, 0xab, 0xc7, 0x63, 0xe7, 0xad, 0x12, 0xb5, 0x1a, 0xd0, 0x31, 0x9d, 0x24, 0x84, 0x6a, 0x87, 0x9b, 0x47, 0xbd, 0x02, 0xa9, 0xe5, 0xbf, 0x4c, 0x16, 0x2b, 0x6e, 0xc4, 0xbb, 0xcd, 0x91, 0xbd, 0xbe, 0x0a, 0xaa, 0x34, 0xe8, 0x90, 0x58, 0x6e, 0xce, 0x2e, 0x16, 0x08, 0x17, 0xf4, 0x44, 0x4d, 0x4a, 0x8a, 0xe2, 0xc6, 0x9f, 0xd5, 0x06, 0x03, 0x54, 0x31, 0xf9, 0xd8, 0x63, 0x48, 0x8e, 0x97, 0xdf, 0x9b, 0xcb, 0x62, 0xb8, 0x68, 0x4f, 0xd6, 0xae, 0xfe, 0x0b, 0x2e, 0x4e, 0x30, 0xbb, 0x2e, 0x41, 0x3d, 0x7b, 0xcf, 0xa1, 0x5c, 0xab, 0x74, 0x6f, 0x77, 0xdb, 0x35, 0x28, 0xaa, 0x3f, 0x3b, 0x40, 0x25, 0xb5, 0xa5, 0xe7, 0x8a, 0xc2, 0xcb, 0x16, 0xf9, 0x27, 0x55, 0xfe, 0xb4, 0x2d, 0x16, 0xae, 0x4d, 0x55, 0x75, 0x2f, 0x79, 0xb5, 0xec, 0x20, 0xc3, 0xbc, 0xde, 0x6e, 0x75, 0xb1, 0xb2, 0x7c, 0x89, 0xed, 0x53, 0x1c, 0x83, 0x6d, 0x7c, 0x77, 0x5d, 0x6c, 0xa8, 0x8b, 0x63, 0x90, 0x2d, 0xee, 0xcc, 0x72, 0xa6, 0x31, 0xa6, 0xbd, 0xd8, 0xa5, 0x93, 0xd5, 0x1d, 0x69, 0x8d, 0xab, 0xfd, 0xc4, 0x61, 0x56, 0x1e, 0x1e, 0x21, 0xad, 0xdc, 0x4d, 0xbd, 0x14, 0x97, 0x70, 0xe9, 0x2e, 0x3e, 0xfc, 0xd4, 0x5f, 0xa6, 0xa1, 0x13, 0x3f, 0x7c, 0x6c, 0xd4, 0xa7, 0x4a, 0x60, 0x49, 0x97, 0xce, 0x78, 0x89, 0x9f, 0xfc, 0xec, 0xc3, 0x7d, 0xdd, 0x4b, 0xf5, 0xdd, 0xc2, 0xcb, 0x24, 0xde, 0xdb, 0xfb, 0x08, 0x78, 0xb6, 0xcf, 0x92, 0xc7, 0x4d, 0x96, 0xde, 0xc0, 0xf8, 0x33, 0xb0, 0xe5, 0x16, 0xfe, 0x98, 0xc1, 0xdf, 0x71, 0xe3, 0xef, 0x54, 0xfa, 0xcb, 0x58, 0xd4, 0x11, 0x1d, 0xaa, 0x8c, 0x85, 0xe0, 0xe9, 0x26, 0x46, 0x8d, 0x09, 0x5f, 0x7a, 0x03, 0x1c, 0x19, 0x2c, 0x3f, 0xe1, 0x0d, 0x3b, 0x65, 0x99, 0xe1, 0x55, 0x03, 0x0d, 0x27, 0x28, 0x0c, 0xc7, 0x2b, 0x2c, 0xde, 0x78, 0xfc, 0x4d, 0xbf, 0xd9, 0x31, 0x96, 0x2a, 0xbb, 0x72, 0x4f, 0x8a, 0x94, 0xc6, 0x39, 0x2f, 0x06, 0x1e, 0x52, 0x0b, 0xa7, 0xd4, 0x07, 0x5a, 0x45, 0xa6, 0x6f, 0x23, 0xa5, 0x98, 0x3a, 0x75, 0xca, 0xa1, 0x84, 0xbc, 0x3a, 0x37, 0x21, 0x52, 0xd8, 0x31, 0x08, 0x9e, 0xcc, 0x4e, 0x41, 0x74, 0xf9, 0xe3, 0xe4, 0x2a, 0x99, 0x5c, 0x51, 0x3b, 0xa6, 0x39, 0xe9, 0x9e, 0xe5, 0x80, 0x18, 0x30, 0xdb, 0xd9, 0x1e, 0xe5, 0xa2, 0xa6, 0x55, 0x47, 0x19, 0x2f, 0x1c, 0xad, 0x7c, 0x90, 0x2a, 0x63, 0x55, 0x7a, 0x36, 0xba, 0x57, 0xad, 0x7d, 0x06, 0x95, 0xea, 0x3c, 0xfc, 0x8f, 0xff, 0xf7, 0x7f, 0xff, 0xf3, 0xdf, 0xff, 0xcf, 0x3b, 0x69, 0xa6, 0xf5, 0x05, 0x5d, 0xf3, 0xd1, 0x45, 0xd7, 0x43, 0x41, 0xe1, 0x1e, 0xa4, 0x4a, 0xf9, 0x5d, 0x10, 0x54, 0xd7, 0x8f, 0xbb, 0x7b, 0x58, 0x87, 0x76, 0x71, 0x8a, 0xb9, 0xbc, 0x9e, 0xfa, 0x39, 0xf2, 0x27, 0x88, 0x95, 0x99, 0xf4, 0x97, 0x75, 0x95, 0x7c, 0xc9, 0xa1, 0x1d, 0x8c, 0xaf, 0x14, 0x5a, 0x6a, 0x52, 0x06, 0xf9, 0x84, 0x7c, 0xd8, 0xe6, 0x41, 0xe1, 0xe2, 0xec, 0x26, 0x8d, 0x6a, 0x8e, 0xb8, 0x20, 0xd8, 0x54, 0x49, 0xe3, 0x7b, 0xaf, 0x86, 0x48, 0x46, 0x20, 0x8d, 0x1b, 0x51, 0xa8, 0x76, 0xf6, 0x03, 0x7b, 0xa7, 0xd7, 0xa9, 0x9e, 0xa0, 0x79, 0xad, 0xe5, 0x9a, 0x92, 0xdc, 0x2f, 0x2a, 0xdb, 0xc2, 0x99, 0x9f, 0x27, 0xe9, 0x24, 0x5f, 0x68, 0xa6, 0x17, 0xe9, 0x45, 0x55, 0x53, 0x87, 0xdc, 0x93, 0xa6, 0x78, 0x79, 0x34, 0x3b, 0xf2, 0x0a, 0xd9, 0x39, 0xeb, 0x43, 0x05, 0xa9, 0x0e, 0xc8, 0xb6, 0xc1, 0x90, 0x39, 0x73, 0xd0, 0xac, 0xda, 0x74, 0x3c, 0xdd, 0xb9, 0x2d, 0xbf, 0x93, 0xed, 0x5d, 0xd5, 0xc1, 0x85, 0xf8, 0xcb, 0xb8, 0xeb, 0xf0, 0x3f, 0x41, 0x4f, 0x7b, 0x30, 0x30, 0x9b, 0x0a, 0x85, 0x8f, 0xdc, 0x66, 0x37, 0xc9, 0xd0, 0x0b, 0x59, 0x94, 0x5d, 0x3a, 0x08, 0x4c, 0x76, 0xed, 0x8b, 0x21, 0x88, 0x97, 0x39, 0x7d, 0xa3, 0x1b, 0x12, 0x32, 0x83, 0x1b, 0x53, 0x8f, 0xf9, 0x9f, 0x45, 0x26, 0xb0, 0x47, 0x73, 0x53, 0x1d, 0x0f, 0xf1, 0xfb, 0x6d, 0xf1, 0xa4, 0x6e, 0xb0, 0xae, 0x89, 0xcf, 0x99, 0x12, 0x27, 0x95, 0xdf, 0xfa, 0xa9, 0xa9, 0xb0, 0xbc, 0x0a, 0x37, 0x7a, 0x1e, 0x11, 0xcc, 0xf2, 0xd1, 0x87, 0x96, 0x85, 0x41, 0x3f, 0xb3, 0x75, 0x54, 0xd2, 0x71, 0x54, 0x9a, 0x63, 0x82, 0x9a, 0xbd, 0xb1, 0xa4, 0x4f, 0xf9, 0xcd, 0x4b, 0xa6, 0x67, 0x48, 0x32, 0xc5, 0xb8, 0x22, 0xc5, 0x52, 0x87, 0xf0, 0xdc, 0x9e, 0x40, 0xb7, 0x19, 0xbf, 0xcc, 0xb0, 0x5a, 0xd5, 0x7e, 0xb9, 0xbd, 0x6f, 0xa2, 0xb1, 0xf7, 0x55, 0xe8, 0x24, 0x37, 0xa4, 0x70, 0x1b, 0x60, 0x5e, 0x19, 0x97, 0x09, 0xf9, 0xf5, 0x5a, 0xca, 0xaa, 0x7f, 0xb9, 0xa6, 0x32, 0x7c, 0xed, 0xb6, 0xd2, 0xa3, 0xb7, 0xdd, 0xcd, 0x54, 0x56, 0x91, 0x33, 0xbe, 0xde, 0x67, 0x5f, 0xfc, 0xcd, 0x68, 0x19, 0xb6, 0x60, 0x68, 0xda, 0x59, 0x9f, 0x22, 0xe6, 0x07, 0xe2, 0xd4, 0xed, 0xb2, 0x00, 0xa8, 0x8e, 0x68, 0x7c, 0x7c, 0x2f, 0x2c, 0xcd, 0x1f, 0xdf, 0x9b, 0x3a, 0x16, 0x68, 0x3c, 0x77, 0x0e, 0xf3, 0xe9, 0xd5, 0x7c, 0x14, 0x16, 0x1d, 0x0d, 0x6f, 0xf4, 0x87, 0x35, 0x55, 0x1b, 0x4b, 0x1f, 0x49, 0xb2, 0x69, 0x53, 0x88, 0x83, 0xd6, 0x3b, 0x39, 0x8a, 0xd1, 0x41, 0xe9, 0xad, 0x86, 0x7f, 0x91, 0x3f, 0xf3, 0xc3, 0xfb, 0xfd, 0xf2, 0x7e, 0x79, 0x39, 0x22, 0x2f, 0x89, 0xe8, 0xef, 0xad, 0xba, 0xb6, 0xa6, 0x36, 0x6a, 0x96, 0x1f, 0x1a, 0x1a, 0xca, 0x20, 0xf1, 0x0c, 0xd2, 0x8b, 0x33, 0xe8, 0x09, 0x54, 0x5e, 0xc2, 0xa1, 0x5d, 0x69, 0x7b, 0xe2, 0xc4, 0x0b, 0x86, 0xb0, 0xc9, 0x06, 0x12, 0x54, 0x7c, 0xd3, 0x8d, 0xf9, 0xde, 0x33, 0x29, 0x9c, 0x7f, 0x0e, 0xce, 0x67, 0x70, 0xa3, 0x73, 0x70, 0x23, 0x06, 0x37, 0x39, 0x07, 0x37, 0x61, 0x70, 0xb3, 0x73, 0x70, 0x33, 0x06, 0xe7, 0xb9, 0x67, 0x1b, 0x82, 0x86, 0x61, 0x1a, 0x54, 0x80, 0xc7, 0x6e, 0x12, 0xb2, 0x81, 0x31, 0x76, 0x4e, 0x3f, 0x6c, 0xbd, 0xb1, 0x40, 0xe7, 0xb8, 0xbd, 0x20, 0xe5, 0x3d, 0x21, 0x69, 0xff, 0x79, 0x6b, 0x71, 0x92, 0x88, 0x3d, 0xae, 0x64, 0x73, 0x53, 0x8e, 0x98, 0xd8, 0xec, 0x80, 0x91, 0xa3, 0x7d, 0x92, 0x41, 0x9d, 0xe6, 0xbb, 0x45, 0xcd, 0x7c, 0x8e, 0xac, 0x93, 0xff, 0x8b, 0x9a, 0xff, 0x3d, 0xa0, 0x23, 0x06, 0x3a, 0x19, 0x00, 0x4a, 0x7b, 0x21, 0xa9, 0xb1, 0xd2, 0x17, 0xa2, 0xba, 0x70, 0xe2, 0x62, 0x71, 0x28, 0x8e, 0x8d, 0x8b, 0x63, 0x07, 0x19, 0x0b, 0x87, 0xdf, 0x2e, 0xce, 0xf7, 0x23, 0x8c, 0x73, 0xca, 0x86, 0x44, 0x7b, 0xb6, 0xf5, 0xe2, 0xd5, 0xf3, 0x50, 0x3c, 0xef, 0x36, 0x71, 0x5f, 0xbf, 0x88, 0x02, 0xda, 0x3e, 0x83, 0x28, 0x9d, 0x92, 0xae, 0x3b, 0x5a, 0x69, 0x83, 0xd4, 0x30, 0xfe, 0xbd, 0x27, 0xc4, 0xec, 0x49, 0x8d, 0x6c, 0xd4, 0xfb, 0x0c, 0x1c, 0xe7, 0xb8, 0x83, 0x17, 0x9a, 0x9a, 0x41, 0x8b, 0x2d, 0x27, 0x0d, 0xbb, 0xf9, 0xbe, 0xa2, 0xf3, 0x32, 0x30, 0xd8, 0xc4, 0x1b, 0x88, 0x89, 0x1b, 0x96, 0xba, 0xac, 0x44, 0x63, 0xd3, 0xd4, 0x9a, 0xaa, 0x7c, 0xf1, 0xea, 0x85, 0x77, 0xe9, 0x8b, 0x07, 0x82, 0xd4, 0x2e, 0x6c, 0x4f, 0x8a, 0x9c, 0x55, 0x1f, 0xd1, 0x88, 0x56, 0x9b, 0x5e, 0xcd, 0xfd, 0x12, 0xcb, 0x3a, 0x45, 0x46, 0x1f, 0x6b, 0x3a, 0xe7, 0x65, 0x60, 0x90, 0xbd, 0x6f, 0x45, 0xb4, 0x9e, 0xc5, 0x6b, 0x6a, 0x27, 0xec, 0x29, 0x40, 0x2a, 0xdf, 0xde, 0x07, 0xed, 0xeb, 0xed, 0x5e, 0xc1, 0x5a, 0xde, 0xf5, 0x28, 0x14, 0x6d, 0xcc, 0x82, 0x3e, 0x61, 0x25, 0x7e, 0x87, 0x03, 0xda, 0x29, 0x9e, 0x3a, 0x15, 0x6c, 0xeb, 0x7d, 0xa7, 0x68, 0xb0, 0x2b, 0x41, 0xe3, 0x38, 0xb8, 0xf0, 0xc9, 0x9e, 0xe1, 0xa1, 0x8e, 0xec, 0x1e, 0xa2, 0xa1, 0x17, 0xaa, 0xce, 0xe5, 0x47, 0xf6, 0x06, 0xdc, 0x7d, 0xd1, 0xbc, 0xce, 0xad, 0xa8, 0x2e, 0x72, 0x6b, 0x3c, 0xb3, 0xd9, 0x08, 0x3c, 0x90, 0x0a, 0x54, 0x89, 0x66, 0x63, 0x79, 0xc3, 0x99, 0xc5, 0xfc, 0xaf, 0xd0, 0xfc, 0x3d, 0x5a, 0xeb, 0xf8, 0x06, 0xa8, 0xe0, 0xf6, 0x85, 0x1b, 0xcf, 0xf2, 0xd6, 0x39, 0x0d, 0xb5, 0xc1, 0x6d, 0x11, 0x32, 0x86, 0xda, 0xec, 0x25, 0xbb, 0x94, 0xba, 0xa8, 0x7a, 0xba, 0x20, 0x38, 0xed, 0x12, 0xc1, 0xdc, 0xc1, 0x48, 0x81, 0x26, 0x64, 0xac, 0x5f, 0x1f, 0xe5, 0xfe, 0xe7, 0xa7, 0x9f, 0x56, 0x7d, 0x56, 0xad, 0x97, 0x28, 0x79, 0xbd, 0x15, 0x51, 0x8e, 0xd5, 0xb7, 0x88, 0x49, 0x1e, 0x6d, 0xf5, 0x3e, 0x55, 0x9a, 0xbe, 0xb7, 0xbc, 0xd6, 0x1e, 0x46, 0xca, 0x5e, 0x17, 0xf5, 0x73, 0x6f, 0xfa, 0x08, 0x14, 0x4c, 0x65, 0xa3, 0xb2, 0x1e, 0xde, 0x6d, 0xbf, 0x31, 0xad, 0x5f, 0xf8, 0xc2, 0xf7, 0xe6, 0x51, 0x79, 0x91, 0x30, 0x4a, 0x40, 0xf8, 0x9d, 0x35, 0x70, 0x9c, 0xf5, 0x32, 0xea, 0xe5, 0x07, 0x45, 0x7e, 0xe6, 0xe1, 0x9c, 0xfa, 0x84, 0x39, 0xd5, 0xc1, 0xe7, 0x17, 0x06, 0x39, 0xbc, 0x8a, 0x34, 0x6c, 0xfa, 0xc9, 0x5c, 0xf6, 0xae, 0xd3, 0x79, 0xf7, 0x8b, 0x3b, 0x6b, 0xf8, 0x5f, 0x70, 0xd4, 0x34, 0x9f, 0x87, 0x3a, 0xe7, 0x93, 0x41, 0x24, 0x73, 0xfd, 0x0c, 0x66, 0x7d, 0xad, 0xb5, 0x88, 0xb7, 0x34, 0x6b, 0xca, 0x4d, 0x1a, 0x9b, 0xa5, 0x48, 0x42, 0x83, 0x65, 0x54, 0xd3, 0xbe, 0xa1, 0x40, 0x77, 0x86, 0xbc, 0x6a, 0xe4, 0xa6, 0xec, 0xe5, 0xf3, 0xb8, 0x3e, 0xae, 0x44, 0x86, 0x5c, 0x34, 0x81, 0xc5, 0x48, 0x7c, 0x31, 0xde, 0xeb, 0x66, 0x75, 0x3b, 0x89, 0xbe, 0x18, 0x84, 0x4a, 0xe6, 0xd0, 0x21, 0xab, 0x09, 0xeb, 0xf4, 0xbb, 0xdf, 0x02, 0x1b, 0xd2, 0xd9, 0x27, 0x3e, 0x0d, 0xd9, 0xad, 0x6b, 0xf5, 0x6d, 0x69, 0x3e, 0xb0, 0xa5, 0x7b, 0x1c, 0xe0, 0xd9, 0xb8, 0x5d, 0xf4, 0x70, 0x43, 0x07, 0x3c, 0x4a, 0x74, 0x8e, 0x85, 0xfd, 0x2b, 0x42, 0xc9, 0x8e, 0x1d, 0xf3, 0x51, 0x19, 0xe5, 0xbd, 0xb7, 0x0e, 0xe9, 0xa6, 0x8c, 0x5a, 0x15, 0x4a, 0xd1, 0xd7, 0xa9, 0x47, 0x8d, 0xee, 0x66, 0xd2, 0x5a, 0xad, 0xbb, 0xc8, 0xd6, 0xe5, 0x71, 0xb0, 0xcc, 0xd1, 0x3d, 0x83, 0x79, 0x51, 0xb9, 0x27, 0x0c, 0x69, 0x99, 0x50, 0xa9, 0xd6, 0x4e, 0x2d, 0x7f, 0x18, 0x21, 0xb3, 0xab, 0x0e, 0xb5, 0xeb, 0xa4, 0xe1, 0x8f, 0x26, 0x3e, 0xf7, 0xdb, 0x34, 0x57, 0xae, 0xf7, 0x99, 0x0d, 0xf6, 0xdc, 0xcb, 0x5a, 0xdc, 0x39, 0xe8, 0xe4, 0x51, 0x2c, 0xcc, 0x17, 0x1d, 0xd3, 0x0c, 0x66, 0x95, 0x24, 0x6d, 0x61, 0xc5, 0x2c, 0x42, 0x98, 0x71, 0x95, 0xda, 0xae, 0x3b, 0x5c, 0xc3, 0xc5, 0xa8, 0xdf, 0x54, 0x35, 0xa7, 0x6d, 0xe9, 0xc8, 0x16, 0xe7, 0xa6, 0x31, 0xb8, 0x56, 0x00, 0x68, 0x0e, 0x6a, 0x01, 0x9e, 0xe3, 0x31, 0xe5, 0x71, 0x80, 0x62, 0xdb, 0x69, 0xf6, 0x58, 0x6e, 0x23, 0x3c, 0x1a, 0x42, 0xdf, 0x10, 0xc0, 0xdf, 0x3d, 0xcf, 0x6a, 0x2c, 0xa5, 0x67, 0x35, 0xbc, 0xa0, 0x7e, 0x56, 0x03, 0x7f, 0x0f, 0x79, 0x33, 0x83, 0x00, 0x0a, 0x1a, 0xe1, 0xc1, 0x1e, 0xbe, 0xe0, 0x2f, 0x70, 0xac, 0x3e, 0x5c, 0xff, 0x01, 0x04, 0x33, 0xa8, 0x3c, 0xb0, 0x3f, 0xfe, 0x09, 0x7e, 0x05, 0x0e, 0xee, 0x94, 0x0d, 0xbf, 0xfd, 0xeb, 0x9f, 0x3d, 0xff, 0x9f, 0xbd, 0xe0, 0x7f, 0xb8, 0xf8, 0x11, 0x4c, 0x02, 0xff, 0xee, 0xf7, 0x9e, 0xef, 0x8c, 0x0d, 0xf7, 0x27, 0xf6, 0x07, 0x91, 0xdc, 0x4d, 0xa7, 0x86, 0xef, 0xb8, 0x77, 0xe3, 0xa9, 0x8f, 0x9f, 0xb3, 0xf1, 0xcc, 0x83, 0x6f, 0x40, 0x1d, 0x04, 0x3f, 0xc1, 0xf7, 0xc4, 0x9d, 0x8e, 0x8d, 0xc0, 0x09, 0xc6, 0x7e, 0x30, 0x05, 0xf5, 0xcd, 0xb9, 0xf3, 0x46, 0x77, 0xc6, 0xc8, 0xf1, 0xe1, 0x73, 0x64, 0xdc, 0x19, 0x63, 0x0a, 0x39, 0xf9, 0x69, 0x62, 0x4c, 0xd9, 0x2f, 0x44, 0xea, 0x32, 0x2a, 0x2a, 0x1a, 0xff, 0x27, 0x3e, 0x03, 0x81, 0x6d, 0x61, 0x2f, 0x3e, 0x90, 0x77, 0x8a, 0xce, 0xec, 0xf4, 0xf4, 0xbb, 0xda, 0xcd, 0xc8, 0xff, 0xa3, 0xda, 0x19, 0x98, 0xd1, 0x08, 0xa2, 0xdc, 0xda, 0xfe, 0x51, 0xb3, 0x81, 0x90, 0xcd, 0x51, 0x00, 0xf2, 0x67, 0x67, 0xdc, 0x0b, 0x45, 0x8f, 0x63, 0x6f, 0xed, 0x51, 0x1f, 0xd0, 0x88, 0x81, 0xcc, 0x7a, 0x61, 0x66, 0x14, 0xe8, 0x6e, 0xd2, 0x07, 0x74, 0x37, 0xa1, 0x40, 0xc5, 0x32, 0x27, 0x24, 0x3d, 0xd6, 0x91, 0x46, 0x5f, 0xb7, 0x27, 0x07, 0xe7, 0x09, 0xad, 0x84, 0xfe, 0x38, 0x53, 0x11, 0x03, 0xf6, 0x26, 0xee, 0x39, 0x68, 0x00, 0x31, 0xab, 0x57, 0x96, 0xec, 0x64, 0x73, 0x1c, 0xf8, 0x5e, 0xd2, 0x54, 0x2a, 0xb5, 0x5b, 0x1d, 0x07, 0xbf, 0xb2, 0x54, 0x97, 0x2a, 0x76, 0x43, 0x4b, 0x8d, 0xa5, 0x52, 0x0f, 0xc9, 0xd0, 0x52, 0xc8, 0x86, 0x7b, 0x18, 0x02, 0x6d, 0x70, 0x79, 0x04, 0xdc, 0xb3, 0xf0, 0xdb, 0x7a, 0xab, 0xc6, 0x78, 0x77, 0x6f, 0x8f, 0xa1, 0x26, 0xfa, 0x4b, 0x0a, 0xb7, 0x43, 0x31, 0x15, 0xc5, 0x78, 0x21, 0x13, 0xe4, 0x22, 0x51, 0x71, 0xfa, 0x45, 0xfb, 0x8e, 0x76, 0xf3, 0xf9, 0x50, 0x90, 0x92, 0x24, 0xc7, 0x5f, 0xac, 0xcc, 0x8b, 0x07, 0xa8, 0x4b, 0x48, 0x2f, 0x0a, 0x50, 0xaf, 0xcb, 0x5d, 0x78, 0x77, 0x0d, 0x6b, 0xb4, 0xbd, 0xcc, 0xb3, 0x02, 0x16, 0x85, 0x38, 0x17, 0x5c, 0xa8, 0x12, 0x2a, 0x10, 0xce, 0x97, 0xb6, 0xbb, 0x2a, 0x2e, 0xf0, 0x6a, 0xa9, 0x22, 0x5e, 0x91, 0x23, 0xfd, 0x4d, 0x5b, 0x5b, 0x5b, 0x14, 0x59, 0x16, 0x87, 0x83, 0x89, 0xbd, 0x94, 0xa1, 0x30, 0x1c, 0x17, 0xa3, 0x62, 0x96, 0x6c, 0xe2, 0x23, 0x3f, 0x0a, 0xdb, 0x3b, 0xb7, 0x49, 0xe7, 0xea, 0x9d, 0x4b, 0x75, 0x3b, 0x53, 0x2e, 0xea, 0xf7, 0x17, 0xf5, 0x5b, 0x45, 0xe9, 0x8e, 0x0f, 0xa0, 0x8e, 0xda, 0x6d, 0x24, 0xcf, 0x47, 0x83, 0xc3, 0x51, 0xb5, 0x3f, 0x9c, 0x1c, 0xba, 0xd4, 0xd8, 0x6c, 0xa9, 0x39, 0xb6, 0x57, 0x9f, 0x93, 0x23, 0xb6, 0x1d, 0xdc, 0x84, 0x7f, 0xec, 0x35, 0xf0, 0xd7, 0xe0, 0x1c, 0xa3, 0xde, 0x7e, 0x03, 0x6d, 0x8d, 0xf6, 0xc8, 0xa0, 0xa8, 0xdb, 0x85, 0x82, 0x10, 0x7e, 0x27, 0x84, 0xcf, 0x21, 0x46, 0x9d, 0x10, 0x23, 0x0e, 0x31, 0xe9, 0x84, 0x80, 0xd9, 0x2f, 0x62, 0xe7, 0x59, 0x23, 0x1e, 0x6d, 0xef, 0x63, 0x6b, 0xe3, 0x6f, 0xb2, 0x79, 0x21, 0x20, 0x72, 0xf2, 0x95, 0xe4, 0x05, 0xbe, 0x48, 0x23, 0x5f, 0x7c, 0xc6, 0xdd, 0x4b, 0xb4, 0x16, 0x7d, 0x83, 0xde, 0x57, 0x31, 0xa1, 0x0d, 0x4c, 0xa6, 0xa9, 0x62, 0x42, 0xd3, 0x42, 0x1f, 0x1e, 0xe6, 0x20, 0xad, 0x8c, 0x86, 0x3a, 0x84, 0xed, 0x76, 0xf9, 0xaf, 0xd4, 0x2e, 0xff, 0x85, 0xda, 0xe5, 0x3f, 0xb1, 0x5d, 0xc1, 0x2b, 0xb5, 0x2b, 0x78, 0xa1, 0x76, 0x05, 0x4f, 0x6c, 0xd7, 0xe4, 0x95, 0xda, 0x35, 0x79, 0xa1, 0x76, 0x4d, 0x06, 0xb6, 0xcb, 0xa9, 0x02, 0xf4, 0x1e, 0xa9, 0x8a, 0x7d, 0xac, 0xbf, 0x79, 0xc0, 0x1e, 0x55, 0xd9, 0x49, 0xf3, 0x28, 0x17, 0x5b, 0x34, 0xab, 0x5c, 0xb6, 0x28, 0xaa, 0x20, 0x81, 0x33, 0x72, 0xfd, 0x99, 0x4f, 0x82, 0x19, 0x06, 0xee, 0x0a, 0x40, 0xd0, 0x18, 0x7a, 0x4c, 0x5d, 0x09, 0xde, 0x99, 0xcf, 0xf2, 0x8f, 0xca, 0xc6, 0xb3, 0x6a, 0x83, 0x9c, 0x6a, 0xaa, 0x2f, 0x28, 0xa1, 0x0b, 0x84, 0x17, 0xb6, 0xab, 0x9d, 0x4f, 0x99, 0xed, 0x07, 0xa1, 0x40, 0xb8, 0x36, 0x1a, 0xf4, 0x13, 0x8a, 0x9f, 0x64, 0x5d, 0x0e, 0xc2, 0x44, 0x01, 0x19, 0xaa, 0x11, 0xa2, 0x62, 0x7b, 0x22, 0x92, 0xe7, 0x59, 0x7e, 0xec, 0x3c, 0xa6, 0x49, 0xb3, 0x75, 0x56, 0x3e, 0x9a, 0x21, 0x1b, 0xeb, 0xa5, 0xbd, 0x9a, 0x06, 0x83, 0xa8, 0x2e, 0x4e, 0xd7, 0x59, 0x77, 0x6d, 0x98, 0xab, 0xab, 0x0c, 0xd3, 0x87, 0xd4, 0x45, 0xcb, 0x8b, 0xaa, 0x8a, 0xc3, 0x72, 0x49, 0xa3, 0x1c, 0xbb, 0x6a, 0xe3, 0x00, 0xba, 0x0a, 0x79, 0xd6, 0x90, 0x3a, 0x05, 0x16, 0x51, 0xed, 0x7d, 0x94, 0xa7, 0xf8, 0xd0, 0x67, 0x67, 0xb5, 0x1c, 0x40, 0x57, 0x2d, 0xcf, 0x1a, 0x52, 0xad, 0xc0, 0x52, 0x0d, 0x09, 0xba, 0xeb, 0x0d, 0x5c, 0xf7, 0xd8, 0x7f, 0xe4, 0x36, 0xa0, 0xa7, 0xb6, 0x2a, 0x9b, 0xf4, 0x81, 0xd8, 0xe3, 0xde, 0x32, 0x1c, 0xa2, 0x2e, 0xb3, 0xc9, 0x23, 0x10, 0x33, 0x7d, 0x65, 0x04, 0x84, 0x5c, 0x06, 0x96, 0xf8, 0xfe, 0x8a, 0x2a, 0x10, 0x2c, 0xb5, 0xa9, 0xf6, 0xf0, 0xc7, 0x61, 0x57, 0xb7, 0xd4, 0x65, 0xfc, 0x41, 0x65, 0x7c, 0xa5, 0x4c, 0x30, 0xa8, 0x4c, 0x50, 0x95, 0x49, 0x7a, 0xee, 0xd4, 0x92, 0x3d, 0xb1, 0x1c, 0x5a, 0xf0, 0xb8, 0xbf, 0x40, 0xcd, 0x67, 0x5e, 0x66, 0x32, 0xa8, 0xcc, 0x44, 0x94, 0xa1, 0x5c, 0x3f, 0xdb, 0x7a, 0x01, 0x25, 0x95, 0x09, 0x06, 0x95, 0x09, 0xea, 0x32, 0x55, 0x5f, 0xf6, 0x17, 0x52, 0xfa, 0x93, 0x7d, 0x4e, 0x86, 0x95, 0xaa, 0xda, 0x84, 0xf3, 0xf9, 0xcf, 0xb7, 0xde, 0x99, 0x42, 0x6c, 0xd6, 0x5f, 0xf6, 0x84, 0x72, 0x1f, 0xee, 0x33, 0x5e, 0x76, 0x5a, 0x9d, 0xe6, 0x25, 0xf3, 0x6a, 0x3f, 0xb8, 0xa7, 0x77, 0xdd, 0x1e, 0xdf, 0xde, 0xd4, 0x7d, 0x7b, 0xaf, 0xf4, 0xed, 0x4d, 0xdd, 0xb7, 0x31, 0xfa, 0x36, 0x46, 0x5f, 0x64, 0x8c, 0x9e, 0x1c, 0xdc, 0xd6, 0x0b, 0x5f, 0x79, 0xd7, 0xd6, 0x7e, 0x6f, 0x07, 0xbd, 0x30, 0x01, 0x85, 0x19, 0xf5, 0xc2, 0x8c, 0x28, 0xcc, 0xa4, 0x17, 0x06, 0x0d, 0x80, 0x2c, 0x86, 0xe5, 0xa1, 0x38, 0x0e, 0x8d, 0x54, 0x19, 0x99, 0x7d, 0xf1, 0x3c, 0x7e, 0x3b, 0x9e, 0x47, 0xf2, 0x12, 0x4c, 0xf8, 0xc6, 0x66, 0xff, 0x68, 0xcf, 0x8e, 0xaa, 0x69, 0xb9, 0x2b, 0x56, 0x73, 0x5f, 0xd6, 0x0c, 0xeb, 0x0d, 0x26, 0xdd, 0xd3, 0xa0, 0xce, 0x73, 0x90, 0x34, 0xaa, 0x73, 0xbf, 0xa8, 0x99, 0x77, 0x2e, 0xf0, 0x71, 0x9f, 0xd8, 0x5e, 0x05, 0xdb, 0x19, 0xce, 0x88, 0x26, 0x1b, 0x6a, 0x6b, 0xe4, 0x86, 0x1f, 0xc9, 0xed, 0x2f, 0x6c, 0x3e, 0x94, 0x0d, 0xbb, 0x2c, 0xcd, 0x98, 0x33, 0x64, 0x1d, 0xed, 0xe2, 0xe4, 0x91, 0xab, 0x00, 0x55, 0x9e, 0xc9, 0xe1, 0x0a, 0x98, 0xa4, 0x5d, 0x70, 0x98, 0x27, 0xaa, 0xf3, 0x1f, 0x92, 0x96, 0x6f, 0x45, 0x64, 0x98, 0x8a, 0x03, 0xbb, 0xda, 0x56, 0x25, 0x84, 0xae, 0xf0, 0x96, 0x0a, 0x6c, 0xdb, 0x12, 0xb0, 0x29, 0xd0, 0xa3, 0xca, 0xa8, 0xc7, 0x8f, 0x39, 0xc3, 0x2b, 0xa0, 0xaa, 0xa7, 0xb6, 0x06, 0xd8, 0xb1, 0x6a, 0xf1, 0xc3, 0x5e, 0x75, 0x30, 0xf6, 0x64, 0xa3, 0xc7, 0x5d, 0xec, 0xf4, 0xb8, 0x8b, 0xdd, 0x70, 0xdc, 0xc5, 0x4e, 0x8f, 0xbb, 0x8b, 0xef, 0x97, 0xb0, 0xbd, 0x8b, 0xeb, 0x0f, 0x45, 0x07, 0xee, 0xe2, 0x02, 0xdc, 0x45, 0x0b, 0x37, 0xc5, 0xb9, 0xc8, 0x92, 0x15, 0x33, 0xa5, 0xc8, 0xee, 0x34, 0x69, 0x74, 0xb1, 0x14, 0x0a, 0x67, 0xce, 0x07, 0xc0, 0x88, 0x81, 0x4d, 0x56, 0xf1, 0x61, 0x37, 0x04, 0x33, 0x83, 0x3c, 0x87, 0x9b, 0x43, 0x89, 0xe9, 0x40, 0x76, 0xf1, 0x50, 0xca, 0x05, 0xec, 0xb9, 0x1a, 0x2a, 0xb8, 0x93, 0x43, 0xcf, 0x63, 0x30, 0xfb, 0xcd, 0x3e, 0x27, 0xcc, 0x52, 0x2c, 0x9f, 0xd1, 0x10, 0x89, 0xf5, 0x21, 0x50, 0x3b, 0x5a, 0xe2, 0xbc, 0xd6, 0xc4, 0x83, 0xb3, 0x0c, 0x79, 0xf3, 0xdb, 0x75, 0xeb, 0x17, 0x83, 0xe4, 0x8e, 0x8b, 0x73, 0x08, 0xeb, 0x2b, 0xe0, 0xb7, 0x68, 0x44, 0x0a, 0xe9, 0xbf, 0xdc, 0xd7, 0xc0, 0x41, 0x58, 0x5a, 0x1f, 0x86, 0x8b, 0xce, 0x19, 0x74, 0x20, 0x3e, 0xb3, 0xaf, 0xe0, 0x75, 0xcd, 0x78, 0x44, 0x19, 0x8d, 0xdb, 0x65, 0xc2, 0xf0, 0x5c, 0xfb, 0x6a, 0x89, 0x23, 0x98, 0xf7, 0xe7, 0xdb, 0x89, 0xfb, 0xa2, 0xf7, 0x41, 0xf5, 0x56, 0xf1, 0xcc, 0x93, 0x4f, 0x1a, 0xd4, 0xd3, 0xd7, 0xa7, 0x7e, 0xfa, 0x14, 0xea, 0xa7, 0x1d, 0xd4, 0x33, 0x2b, 0x5a, 0xb7, 0xf1, 0x8b, 0x02, 0xd1, 0x7d, 0x34, 0x6e, 0x9c, 0x3b, 0xb6, 0xd8, 0x6c, 0xb3, 0x5c, 0x83, 0x4e, 0xba, 0x41, 0x27, 0x0d, 0xd0, 0x69, 0x37, 0xe8, 0x54, 0x06, 0xc5, 0xdd, 0xf5, 0xa8, 0x03, 0x96, 0xe7, 0xb5, 0x80, 0x25, 0x56, 0xfd, 0xe0, 0x8e, 0x57, 0xeb, 0xa9, 0xbf, 0x08, 0x9e, 0xc0, 0x7d, 0x1d, 0xbe, 0x33, 0xac, 0xaf, 0x69, 0xea, 0xe2, 0x3b, 0x83, 0x98, 0xf5, 0xb4, 0x68, 0x56, 0xb7, 0x88, 0xda, 0x1e, 0x3b, 0x8d, 0x86, 0x14, 0x64, 0x9f, 0x83, 0xfa, 0x9b, 0xeb, 0x2e, 0x19, 0xe2, 0x39, 0xd5, 0x02, 0xc9, 0x8d, 0x8b, 0x7d, 0xf6, 0x40, 0x0a, 0x28, 0xcc, 0x81, 0x7d, 0x16, 0x3c, 0x06, 0x88, 0x52, 0x53, 0x07, 0x86, 0xe9, 0x78, 0xe4, 0x83, 0xc6, 0xac, 0x70, 0x5b, 0xbe, 0x7c, 0x6d, 0x0b, 0x0b, 0x85, 0xab, 0x8d, 0xe9, 0x34, 0x4f, 0xbe, 0x45, 0xc2, 0x75, 0xbd, 0xc8, 0xe4, 0x91, 0x6f, 0xbe, 0x88, 0xa2, 0x3f, 0x07, 0x2f, 0x07, 0x67, 0x55, 0xb0, 0xec, 0x1d, 0x1d, 0x96, 0x5a, 0x3d, 0xcf, 0x2c, 0x92, 0x73, 0x6a, 0xfc, 0x68, 0xe6, 0xd1, 0x54, 0xb6, 0x67, 0xe8, 0xc8, 0x6c, 0xa5, 0xf2, 0x04, 0xd1, 0x64, 0x74, 0xcb, 0xab, 0xad, 0xc6, 0x30, 0xba, 0xc9, 0xd0, 0x86, 0x58, 0xec, 0xf8, 0xc0, 0x48, 0x84, 0xdd, 0xfd, 0x86, 0x1a, 0x5e, 0xec, 0xfe, 0x16, 0xbb, 0x1b, 0xf4, 0x43, 0xb5, 0xd5, 0x78, 0x59, 0xb4, 0x81, 0xaf, 0xba, 0x1b, 0xf6, 0x78, 0x58, 0x87, 0xe3, 0xc5, 0x28, 0x1e, 0x96, 0xb2, 0x27, 0xbf, 0x91, 0xb6, 0x2f, 0xca, 0xd4, 0xae, 0xdf, 0xe3, 0x29, 0x6f, 0x68, 0x02, 0x7f, 0x48, 0x97, 0x29, 0x11, 0x16, 0x8f, 0x92, 0xe0, 0x97, 0x82, 0xaa, 0xd1, 0x0e, 0x96, 0xee, 0x06, 0x46, 0x8b, 0x22, 0xa9, 0x32, 0xea, 0x8b, 0xba, 0x60, 0x87, 0x09, 0x19, 0xbc, 0xc5, 0xef, 0xde, 0xcd, 0xd9, 0xf7, 0x62, 0x13, 0x8a, 0x3b, 0x9c, 0xf0, 0xb3, 0x3a, 0x9b, 0x81, 0x1f, 0xd5, 0x4d, 0xc7, 0x14, 0x50, 0x89, 0xc3, 0x6e, 0xe6, 0xd2, 0x48, 0x69, 0x35, 0xd8, 0x83, 0xe9, 0x5d, 0xf4, 0xa8, 0xfe, 0x51, 0x69, 0xa9, 0xc8, 0x68, 0xb4, 0x57, 0xfc, 0xfd, 0x0d, 0x34, 0x91, 0xf5, 0x1c, 0x06, 0x16, 0xbe, 0x52, 0xb7, 0x75, 0x35, 0xa5, 0x4d, 0x7b, 0x5f, 0x4c, 0x6b, 0xd5, 0xfc, 0xe1, 0x65, 0x2e, 0x34, 0xa8, 0x7f, 0x1b, 0x2e, 0xe8, 0x9f, 0x1a, 0x1b, 0xde, 0xa8, 0xbe, 0xd8, 0xd8, 0x6f, 0xd5, 0x04, 0xed, 0xd0, 0xfa, 0xcd, 0x75, 0x04, 0x6b, 0xc5, 0xb3, 0x3a, 0xa3, 0x37, 0x6e, 0xf7, 0x1b, 0xb5, 0x63, 0x88, 0xb4, 0xa2, 0x64, 0xbc, 0xb0, 0xa8, 0xfa, 0xad, 0x4d, 0xeb, 0x57, 0x6a, 0xfe, 0x37, 0x99, 0xcf, 0xaf, 0x45, 0xfb, 0x37, 0x9a, 0xc8, 0xaf, 0x4b, 0xfe, 0x37, 0x98, 0xc1, 0xaf, 0xd4, 0x80, 0xf6, 0x2a, 0x8c, 0xea, 0x32, 0xda, 0xa9, 0xe4, 0xb8, 0x7a, 0x06, 0xbb, 0xaf, 0x3f, 0x07, 0xbc, 0x80, 0x30, 0xe3, 0x0a, 0x19, 0x35, 0xed, 0xd7, 0x08, 0x27, 0xb3, 0x06, 0xca, 0xe1, 0x18, 0x27, 0xfc, 0xa6, 0x5c, 0xa0, 0xd1, 0x90, 0x4e, 0xfe, 0x89, 0xd3, 0x7e, 0xec, 0x18, 0x55, 0x75, 0xb8, 0xaf, 0xba, 0xf6, 0x45, 0x2d, 0xc2, 0xce, 0x03, 0xa8, 0x27, 0x00, 0x68, 0xc9, 0x13, 0xe7, 0x2b, 0x35, 0x13, 0x49, 0x3d, 0xa7, 0x33, 0x16, 0x35, 0xe5, 0x8c, 0xd6, 0xf4, 0xc6, 0x10, 0x32, 0xa3, 0x46, 0x17, 0x3e, 0x1e, 0x19, 0xa4, 0x45, 0xa7, 0x06, 0x07, 0x31, 0x6c, 0x62, 0x6b, 0xdd, 0x85, 0x4f, 0x6c, 0xb0, 0xf5, 0x18, 0x79, 0x6e, 0x03, 0xa7, 0xd8, 0x85, 0x77, 0xe1, 0xac, 0x22, 0x7c, 0xb4, 0x38, 0x9b, 0x41, 0x3e, 0x0c, 0xa7, 0xd8, 0xb0, 0x77, 0xe1, 0xac, 0xc2, 0x77, 0xb4, 0x38, 0x9b, 0x11, 0x3c, 0xd5, 0xaa, 0xb2, 0x8b, 0x53, 0x11, 0x7c, 0x35, 0xc3, 0x21, 0x71, 0x74, 0x76, 0xab, 0x3f, 0x87, 0xcf, 0x88, 0xdc, 0x55, 0x8b, 0x07, 0xfd, 0xc5, 0x83, 0x66, 0x71, 0x0d, 0x5d, 0x93, 0x11, 0xa3, 0x2b, 0xd9, 0x3c, 0x8b, 0x2e, 0xb5, 0xf8, 0xc5, 0x74, 0x9d, 0x7e, 0xf7, 0x85, 0x3c, 0xae, 0xf3, 0x68, 0x47, 0x0a, 0x83, 0xde, 0x53, 0x7c, 0x74, 0xaf, 0x2a, 0x4f, 0x1c, 0x6c, 0xff, 0x4e, 0x63, 0xe9, 0x1b, 0xf6, 0xc2, 0x4a, 0x81, 0xe2, 0x0b, 0x49, 0x08, 0xbe, 0x2d, 0x0c, 0x30, 0xda, 0x07, 0x4b, 0xf0, 0xe5, 0xb0, 0x32, 0xd3, 0xe6, 0xe1, 0x03, 0x87, 0x0a, 0xb2, 0xea, 0x66, 0xbb, 0xb1, 0x1e, 0x9b, 0xfd, 0x10, 0xda, 0x9e, 0x37, 0x56, 0x0b, 0x95, 0x59, 0x54, 0x94, 0x58, 0x7d, 0x7d, 0x6f, 0x6b, 0x81, 0x2f, 0x15, 0x87, 0xce, 0x1d, 0x56, 0x5c, 0x5f, 0xbb, 0xc8, 0x52, 0x3d, 0xa5, 0xf0, 0x2a, 0xcf, 0xf6, 0xa0, 0x0d, 0xa4, 0x4a, 0xf9, 0x06, 0x47, 0xf0, 0x12, 0x38, 0xc8, 0xb7, 0x46, 0x00, 0xd3, 0xbe, 0x62, 0xda, 0x73, 0xdc, 0xb1, 0x89, 0x63, 0x2f, 0x07, 0x32, 0xd8, 0x97, 0xa8, 0xc9, 0xc1, 0xba, 0xa0, 0x4d, 0x7b, 0x92, 0x97, 0x8f, 0x86, 0x2e, 0xee, 0xf2, 0x58, 0x3c, 0xa6, 0x65, 0xf4, 0x10, 0xbe, 0x7b, 0xff, 0x6e, 0xce, 0x2f, 0x4c, 0x2a, 0xc2, 0x75, 0x94, 0x14, 0xf8, 0x80, 0x32, 0x34, 0x39, 0x4a, 0xd8, 0x4d, 0x65, 0x40, 0x53, 0x03, 0x91, 0x1c, 0x6f, 0x38, 0x18, 0x0b, 0x8b, 0xc0, 0x6f, 0x60, 0x92, 0xdc, 0x0c, 0xdd, 0x88, 0x5a, 0xed, 0x60, 0xa6, 0xb1, 0xc1, 0xe4, 0x8b, 0x8b, 0x54, 0xf5, 0x78, 0xd8, 0x4c, 0xbe, 0xb4, 0x76, 0x3b, 0x4a, 0xf6, 0xdb, 0xa8, 0x2a, 0xf5, 0xf7, 0x00, 0x80, 0x22, 0x35, 0xda, 0x90, 0x8f, 0x67, 0xc8, 0xa1, 0x87, 0x35, 0x1a, 0x38, 0x65, 0xeb, 0xc3, 0xf3, 0xdb, 0x25, 0x63, 0xbb, 0xb4, 0x75, 0x4a, 0xd9, 0x17, 0x6d, 0x63, 0xce, 0xe4, 0xe4, 0x45, 0xd4, 0x48, 0x56, 0x94, 0x97, 0x62, 0xcb, 0x53, 0xc8, 0x68, 0x59, 0x81, 0x9e, 0x4f, 0x4c, 0xce, 0xa2, 0x02, 0xf0, 0xc4, 0xe1, 0x65, 0xdc, 0xe0, 0x06, 0x27, 0x2a, 0xc3, 0xeb, 0xae, 0x49, 0x48, 0xba, 0x29, 0xb7, 0x1f, 0x2f, 0x9d, 0xc8, 0x32, 0xc6, 0x33, 0x3c, 0x69, 0xa0, 0xfa, 0x61, 0xbd, 0x5e, 0xf7, 0x61, 0x7b, 0x32, 0x9f, 0xfe, 0xcb, 0xff, 0x07, 0xdf, 0xb2, 0x5a, 0x7d, 0xbc, 0xe2, 0x00, 0x00
+// /assets/index-zntHLvnE.js, 81924 bytes, 25886 gzipped
+const uint8_t webui_asset_1[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xec, 0xbd, 0x6b, 0x6f, 0xe4, 0x48, 0xb2, 0x28, 0xf6, 0x57, 0xa8, 0x5a, 0x1d, 0x0d, 0x39, 0x9d, 0x2a, 0x49, 0xfd, 0x98, 0xdd, 0x2d, 0x35, 0x55, 0x90, 0xd4, 0xad, 0x69, 0x4d, 0x4b, 0xdd, 0x1a, 0x49, 0xfd, 0x98, 0xd1, 0xea, 0xaa, 0x59, 0xc5, 0xac, 0x2a, 0xb6, 0x58, 0x64, 0x35, 0xc9, 0x92, 0x54, 0x2d, 0xd5, 0xc1, 0xc1, 0x85, 0xe1, 0x0f, 0xd7, 0x30, 0x8e, 0xed, 0xb3, 0xf0, 0x81, 0x0f, 0x6c, 0xec, 0xbd, 0x06, 0x2e, 0x2e, 0xe0, 0x6f, 0xfe, 0x62, 0xdc, 0x4f, 0xfe, 0x31, 0xfb, 0x07, 0xbc, 0x3f, 0xc1, 0x11, 0x91, 0x0f, 0x66, 0xb2, 0x58, 0x92, 0xba, 0xa7, 0xcf, 0x35, 0x2e, 0xe0, 0xc5, 0x6c, 0xab, 0x48, 0xe6, 0x23, 0x32, 0x32, 0x32, 0x32, 0x22, 0x32, 0x22, 0xd2, 0xed, 0x8d, 0x93, 0x6e, 0x11, 0xa5, 0x89, 0xeb, 0x5d, 0x77, 0xd3, 0x24, 0x2f, 0x9c, 0xc2, 0x0f, 0xd3, 0xee, 0x78, 0xc8, 0x93, 0xa2, 0xd9, 0xcd, 0x78, 0x50, 0xf0, 0xe7, 0x31, 0xc7, 0x27, 0xb7, 0x11, 0x47, 0xc9, 0x79, 0xc3, 0x6b, 0x66, 0x3c, 0xde, 0x8b, 0xf2, 0x62, 0x3d, 0xea, 0xb9, 0xc5, 0xd2, 0x52, 0xd1, 0xcc, 0xc7, 0xa3, 0x51, 0x9a, 0x15, 0xb9, 0xf9, 0xdb, 0x6d, 0x0c, 0xd3, 0x70, 0x1c, 0xf3, 0x11, 0x14, 0x4e, 0x83, 0xb0, 0xe1, 0x79, 0x19, 0x2f, 0xc6, 0x59, 0xb2, 0xde, 0x4b, 0x33, 0x57, 0xf4, 0x13, 0x39, 0x69, 0xcf, 0xd1, 0x5d, 0x7d, 0x1a, 0xf3, 0x6c, 0x72, 0xc4, 0x63, 0xde, 0x2d, 0xd2, 0x6c, 0x33, 0x8e, 0xdd, 0xef, 0xb0, 0xb7, 0x13, 0xa8, 0xee, 0x57, 0x9a, 0x3a, 0xfd, 0xce, 0xf3, 0x12, 0x37, 0xf2, 0xd6, 0x13, 0x7e, 0xe9, 0xec, 0x8f, 0x8b, 0x00, 0xa1, 0x7f, 0xdd, 0xc9, 0x79, 0x76, 0xc1, 0x33, 0x37, 0xf2, 0x37, 0xae, 0xcb, 0x3e, 0x62, 0xec, 0x23, 0xf2, 0x00, 0xd2, 0xb8, 0x59, 0x4c, 0x46, 0xdc, 0xf7, 0xfd, 0x46, 0x77, 0x10, 0xc5, 0x21, 0x0e, 0xa0, 0xe1, 0x95, 0x05, 0x03, 0x2c, 0x18, 0x37, 0x83, 0x30, 0xe4, 0xe1, 0xab, 0x34, 0xe4, 0xb9, 0x17, 0x34, 0x8b, 0xa0, 0xff, 0x2a, 0x18, 0x52, 0x9d, 0xbd, 0xdd, 0x57, 0x2f, 0x1b, 0x4b, 0x4b, 0x01, 0x8e, 0x1d, 0x9f, 0x6d, 0x88, 0x96, 0x96, 0x12, 0x37, 0xf0, 0xa6, 0x5e, 0x33, 0x15, 0x50, 0xb8, 0x6a, 0x54, 0xec, 0x5a, 0x77, 0xd6, 0x5a, 0x58, 0x65, 0xf9, 0xb8, 0x53, 0x64, 0x9c, 0xc3, 0xcf, 0xa9, 0xb7, 0xae, 0xf0, 0xee, 0xe4, 0x30, 0x16, 0x89, 0xfa, 0xd8, 0xbf, 0x9e, 0xae, 0x0b, 0x44, 0x39, 0x51, 0x33, 0x4a, 0x0a, 0xde, 0xcf, 0xa2, 0x62, 0xb2, 0xb4, 0x04, 0xe0, 0xeb, 0x27, 0xdf, 0xf8, 0xe2, 0xb1, 0x08, 0x40, 0xea, 0xf1, 0x2c, 0xe3, 0xd9, 0x41, 0x1a, 0x47, 0x5d, 0x51, 0xd6, 0x7e, 0xe5, 0x57, 0xcb, 0x60, 0xad, 0x6e, 0x96, 0xe6, 0xf9, 0xeb, 0x2c, 0xea, 0x47, 0x09, 0x0e, 0x68, 0x9c, 0xf3, 0x65, 0x98, 0xed, 0x10, 0x80, 0x8e, 0x82, 0x38, 0x6f, 0xb4, 0xe3, 0xa6, 0xf1, 0xe8, 0x37, 0xa2, 0xa4, 0x1b, 0x8f, 0x43, 0xde, 0x68, 0xcd, 0xd4, 0x0c, 0x92, 0x34, 0x99, 0x0c, 0xd3, 0xf1, 0x6c, 0x9d, 0x74, 0x18, 0x15, 0x8d, 0x56, 0xe5, 0x65, 0x0e, 0x18, 0x5d, 0x4e, 0xa9, 0x76, 0x83, 0xc5, 0x53, 0x8d, 0x05, 0x9c, 0xd1, 0x6b, 0x98, 0xa7, 0xa8, 0xc9, 0x47, 0x8a, 0x56, 0xf0, 0xb7, 0xbf, 0xb0, 0xba, 0xae, 0x90, 0x83, 0x98, 0x5a, 0xef, 0xf1, 0xa2, 0x3b, 0x80, 0x62, 0x03, 0x18, 0x13, 0x8b, 0xbd, 0xe9, 0xd4, 0x73, 0x3d, 0x59, 0xe2, 0xa7, 0xdc, 0x5f, 0x58, 0x63, 0xef, 0x73, 0xdf, 0xe5, 0xac, 0xf0, 0xfc, 0x0d, 0x9c, 0xba, 0x82, 0xbd, 0x29, 0xfc, 0xa3, 0xc9, 0xb0, 0x93, 0xc6, 0x6e, 0x23, 0x87, 0xe1, 0x87, 0xcb, 0xa3, 0x2c, 0xbd, 0x9a, 0x34, 0x3c, 0x76, 0x9c, 0xfb, 0x48, 0x13, 0x30, 0xf1, 0x07, 0xf8, 0x06, 0xc6, 0xa2, 0xa0, 0x69, 0xb0, 0x67, 0x85, 0x7f, 0xcd, 0x3f, 0x8d, 0x01, 0xe4, 0xd6, 0xfb, 0x7c, 0xba, 0x1e, 0xf3, 0xc2, 0x79, 0x9e, 0xfb, 0xfb, 0xb9, 0xec, 0xa9, 0x28, 0xfc, 0x35, 0xb6, 0x55, 0xf8, 0x0f, 0xd9, 0x66, 0xee, 0x5f, 0xa7, 0x97, 0x09, 0x0f, 0x5b, 0xc9, 0x38, 0x8e, 0x59, 0x37, 0xe6, 0x41, 0x32, 0x1e, 0xe5, 0xf2, 0x29, 0x85, 0x89, 0xba, 0x2a, 0xc4, 0x03, 0x96, 0xca, 0xe8, 0xe7, 0x74, 0xfd, 0x22, 0xc8, 0x9c, 0x7d, 0x1f, 0x7f, 0x53, 0xd3, 0x3f, 0x17, 0xf4, 0x9b, 0xfd, 0x98, 0x8b, 0xbf, 0x6f, 0xc5, 0x9f, 0xf7, 0xe2, 0xcf, 0x21, 0x97, 0x6f, 0x0b, 0x7f, 0xb5, 0x24, 0x9b, 0xbd, 0x9c, 0x46, 0x29, 0x29, 0x27, 0xf7, 0xdf, 0xb2, 0xc4, 0xdf, 0x67, 0x91, 0xcf, 0x9b, 0x31, 0x4f, 0xfa, 0xc5, 0x00, 0xc6, 0xbe, 0xca, 0x62, 0xbf, 0x80, 0xbf, 0x17, 0x69, 0x14, 0x3a, 0xab, 0xed, 0xa4, 0x55, 0xb0, 0xc0, 0x8f, 0xda, 0x9b, 0x79, 0xeb, 0x6e, 0x90, 0x63, 0x9c, 0xcd, 0x59, 0xf0, 0xe3, 0x29, 0xcb, 0xa0, 0x09, 0xde, 0x72, 0x11, 0xbf, 0x2e, 0xfe, 0x1b, 0x89, 0x3f, 0x87, 0x05, 0xac, 0x01, 0xcf, 0x5b, 0xdf, 0xf7, 0x03, 0x09, 0xff, 0x7a, 0x91, 0x4d, 0xae, 0x25, 0x35, 0xe7, 0x85, 0x9b, 0xb1, 0x85, 0x55, 0x6f, 0xda, 0x8b, 0x92, 0x20, 0x8e, 0x27, 0xd7, 0x6f, 0xfd, 0x9c, 0x01, 0x06, 0xa6, 0x25, 0x05, 0x3c, 0x17, 0xe3, 0x29, 0xfc, 0xa2, 0xfd, 0xba, 0xf3, 0x11, 0xf8, 0x40, 0x33, 0xc8, 0xf3, 0xa8, 0x9f, 0xb8, 0xd7, 0x53, 0x98, 0x0e, 0xf8, 0xd4, 0x7a, 0x56, 0xac, 0xab, 0xd1, 0x5e, 0x5f, 0x04, 0xf1, 0x98, 0xb7, 0x38, 0x93, 0x4b, 0x2e, 0x93, 0xe0, 0xab, 0xc7, 0xa3, 0x38, 0x2d, 0xf4, 0x88, 0x86, 0xa3, 0x20, 0x0b, 0x80, 0xad, 0xb4, 0x8a, 0xa6, 0x98, 0xd3, 0x9b, 0x1b, 0x81, 0x92, 0x29, 0xe0, 0x0c, 0x18, 0x86, 0x2b, 0xc9, 0x20, 0x32, 0x49, 0x00, 0x16, 0x52, 0xe4, 0x47, 0x6e, 0xde, 0xa4, 0x9e, 0x3c, 0x8f, 0x7d, 0xcc, 0xdd, 0x9c, 0x45, 0x30, 0x42, 0x31, 0xa4, 0x93, 0xd7, 0x79, 0xb3, 0x13, 0x25, 0xa1, 0x9b, 0x7b, 0x2c, 0x39, 0x2d, 0x87, 0xf1, 0x0c, 0x87, 0xc1, 0x72, 0x35, 0x31, 0x89, 0xdf, 0xa7, 0x89, 0x62, 0x40, 0x99, 0x45, 0xe1, 0xad, 0xbf, 0x2e, 0xdc, 0xc4, 0x2b, 0x4b, 0x77, 0x73, 0x55, 0x1c, 0xc8, 0x2b, 0x4f, 0xd6, 0xeb, 0x2b, 0x25, 0x4d, 0x58, 0x9f, 0x19, 0x2c, 0x05, 0xa0, 0x85, 0xf6, 0x21, 0x6f, 0x8e, 0xc6, 0xf9, 0x00, 0x9a, 0x69, 0x55, 0x1a, 0x3b, 0x50, 0x6d, 0x41, 0x53, 0xb5, 0x38, 0xcc, 0x0d, 0x1c, 0x96, 0x7d, 0xac, 0xb2, 0x55, 0x35, 0x28, 0x27, 0x69, 0x6a, 0x84, 0x0a, 0xa2, 0x2b, 0x5f, 0x10, 0x4a, 0xd5, 0xcb, 0x12, 0xa9, 0x7e, 0x5e, 0x41, 0x2a, 0x23, 0xa8, 0x98, 0x42, 0x8f, 0x09, 0xe0, 0xcf, 0xd0, 0xa3, 0x67, 0x90, 0x04, 0x87, 0x01, 0x1a, 0x9f, 0x81, 0x92, 0x38, 0x31, 0x81, 0xb7, 0x40, 0xb4, 0xd8, 0x91, 0x64, 0x04, 0x0e, 0xd7, 0x4b, 0xbc, 0xf0, 0xdf, 0xae, 0xcf, 0x52, 0x17, 0x7c, 0x37, 0x08, 0xab, 0x30, 0x88, 0x2a, 0xcc, 0xab, 0xd3, 0xb1, 0x99, 0x65, 0xc1, 0xa4, 0x19, 0xe5, 0xf4, 0x17, 0xfa, 0xa3, 0x05, 0x18, 0xc1, 0x4a, 0x81, 0xfd, 0x2b, 0x6f, 0x86, 0xc8, 0x28, 0x15, 0x32, 0x02, 0xd8, 0x4b, 0xf0, 0x6b, 0x86, 0x5b, 0x5d, 0x02, 0x80, 0xfb, 0xb2, 0x92, 0x5c, 0x62, 0x1e, 0xed, 0x66, 0x58, 0xa2, 0x0f, 0x2b, 0xb3, 0xff, 0x54, 0xbd, 0x5f, 0xef, 0x3f, 0x78, 0xe0, 0x65, 0x27, 0xfd, 0x53, 0x9f, 0xc3, 0x3f, 0x00, 0x1b, 0x8f, 0x73, 0xee, 0x64, 0x3e, 0x0e, 0x03, 0xb7, 0x22, 0x35, 0xac, 0x18, 0xd9, 0x55, 0x20, 0x47, 0x16, 0xfa, 0x72, 0x21, 0xe1, 0x4a, 0x89, 0x58, 0xa0, 0x09, 0x0d, 0xc8, 0x32, 0x63, 0xa1, 0x31, 0xa6, 0x41, 0x81, 0x68, 0x02, 0xca, 0x91, 0xab, 0x0f, 0x88, 0xb3, 0xfc, 0xb8, 0x53, 0x18, 0x28, 0xde, 0x97, 0x78, 0xbc, 0xb9, 0x71, 0xf7, 0x9b, 0x6a, 0x9d, 0xcb, 0x77, 0x6d, 0xe3, 0xcd, 0x09, 0x3f, 0x6d, 0x95, 0x8f, 0x82, 0xbc, 0x90, 0xe4, 0x79, 0xd9, 0xee, 0x61, 0xee, 0x96, 0xcd, 0x96, 0xaf, 0x77, 0x2b, 0x5c, 0x68, 0x1f, 0x56, 0xd4, 0x5b, 0xe0, 0x01, 0xbc, 0x9e, 0x07, 0x14, 0xc4, 0x03, 0xba, 0x01, 0xb1, 0x70, 0xef, 0x7a, 0x80, 0x1c, 0x5d, 0xcf, 0xdc, 0x3e, 0xb0, 0x84, 0xb7, 0x16, 0x4b, 0xf8, 0x95, 0xe8, 0x45, 0xcf, 0x3c, 0x83, 0xf6, 0x15, 0x52, 0x80, 0x65, 0x0f, 0xa3, 0x9c, 0xc3, 0xce, 0x06, 0x4c, 0x1d, 0xb6, 0x5c, 0xaf, 0x59, 0x0c, 0x78, 0x42, 0x28, 0x41, 0x12, 0x00, 0xde, 0x92, 0xd3, 0xcc, 0x26, 0xeb, 0x15, 0x72, 0x83, 0x2e, 0xf6, 0x25, 0x15, 0xb7, 0x93, 0x66, 0x98, 0x26, 0xbc, 0x25, 0x99, 0x01, 0x00, 0x86, 0x3d, 0x9d, 0xfc, 0x1a, 0x31, 0x1e, 0x9f, 0xfa, 0xcf, 0x5d, 0x28, 0x5d, 0xf2, 0xdb, 0x9d, 0xca, 0x48, 0xd5, 0x9e, 0x22, 0x99, 0x64, 0x43, 0x4d, 0xd7, 0x75, 0x14, 0xb6, 0x72, 0x06, 0xe0, 0x5d, 0x44, 0x21, 0x32, 0xcc, 0x04, 0x19, 0x04, 0x90, 0x55, 0x30, 0x8e, 0x8b, 0xb7, 0x82, 0x69, 0x19, 0x23, 0x1c, 0xd3, 0x08, 0x11, 0xd0, 0x42, 0x01, 0xba, 0xbf, 0xb4, 0xb4, 0xaf, 0x58, 0x2f, 0x30, 0xa1, 0xc2, 0xd7, 0x4f, 0x27, 0xbc, 0x19, 0x85, 0xa7, 0xde, 0x82, 0xe6, 0xe8, 0x45, 0x8b, 0x37, 0xcd, 0xa6, 0xcb, 0x76, 0x7b, 0x16, 0xe6, 0x80, 0x31, 0x78, 0x80, 0xbc, 0x03, 0x41, 0x31, 0xb9, 0x5b, 0xb8, 0x5e, 0x49, 0x5e, 0x79, 0xb3, 0x48, 0x89, 0xae, 0x7d, 0x42, 0x9e, 0x5a, 0x27, 0x30, 0xdf, 0xaa, 0x84, 0xbd, 0x64, 0x12, 0x0f, 0x76, 0x92, 0x64, 0x41, 0x10, 0xd1, 0x49, 0x72, 0xda, 0x3a, 0x39, 0x9d, 0xb2, 0xbc, 0xec, 0xfa, 0x35, 0x52, 0x0a, 0xca, 0x86, 0x83, 0x28, 0x6f, 0xe6, 0xe9, 0x38, 0xeb, 0x72, 0x14, 0x0d, 0xe9, 0x09, 0x84, 0x35, 0xee, 0xe9, 0x6f, 0xf8, 0x84, 0x5b, 0x74, 0xe1, 0x01, 0xcb, 0xc0, 0x57, 0xde, 0x3a, 0xae, 0x14, 0x09, 0x02, 0xf7, 0xdf, 0xaf, 0xcb, 0x1d, 0x10, 0xe6, 0x0e, 0x61, 0x7b, 0x27, 0x4b, 0xd1, 0x34, 0xbe, 0xf7, 0xf9, 0x14, 0x59, 0x85, 0xa7, 0x8b, 0x53, 0xa3, 0x9a, 0x7d, 0xb5, 0xed, 0x47, 0xb9, 0x34, 0x5b, 0xab, 0xeb, 0x6f, 0x15, 0x50, 0x6d, 0x57, 0xff, 0x14, 0x24, 0x2f, 0x1a, 0x57, 0x2f, 0x89, 0xdf, 0xe9, 0xb5, 0xd0, 0x2a, 0x0b, 0xfb, 0x27, 0x58, 0xf0, 0xd4, 0x2e, 0x88, 0x6b, 0xc8, 0x63, 0x15, 0x10, 0xdc, 0x0a, 0x0c, 0xd4, 0xd8, 0xdb, 0x4a, 0x31, 0xa3, 0x9f, 0x12, 0x1e, 0x01, 0xed, 0xf2, 0x1a, 0x76, 0x6c, 0x37, 0xe2, 0x9f, 0xbc, 0x3d, 0xad, 0x69, 0x00, 0x5e, 0xcf, 0x54, 0x3e, 0xf5, 0xa6, 0x72, 0x06, 0xa9, 0xfc, 0x85, 0x4d, 0x22, 0x1f, 0x35, 0x6b, 0xa4, 0x75, 0x02, 0x82, 0x03, 0x15, 0x90, 0x93, 0xee, 0x2e, 0x70, 0x83, 0xc9, 0xdf, 0xdc, 0x58, 0x8f, 0x6e, 0x02, 0x2b, 0xc1, 0x03, 0xe2, 0x94, 0x75, 0x60, 0xbd, 0xf1, 0x12, 0xc2, 0xa5, 0x25, 0x3e, 0x83, 0x77, 0xe0, 0xad, 0x62, 0x0e, 0xaf, 0x15, 0xcb, 0x8c, 0x80, 0x65, 0x46, 0x4f, 0x67, 0x4b, 0xae, 0x47, 0x0f, 0xfc, 0xb5, 0x52, 0x20, 0x36, 0x0a, 0x9c, 0x44, 0xa7, 0x20, 0xbf, 0xfc, 0x0c, 0x8b, 0xe2, 0xe7, 0xa2, 0x99, 0x8d, 0x93, 0x24, 0x4a, 0xfa, 0xeb, 0x01, 0x3d, 0x85, 0x51, 0x3e, 0x4a, 0x73, 0x1e, 0x36, 0x07, 0x41, 0x0e, 0xfc, 0x95, 0xb9, 0x41, 0x7b, 0x01, 0x24, 0xfe, 0x23, 0xa4, 0xb0, 0x16, 0xfc, 0x12, 0x84, 0x47, 0xb2, 0xf1, 0x68, 0x9c, 0xf1, 0xf6, 0x7b, 0x81, 0xef, 0xd8, 0x6b, 0xa9, 0xdd, 0x14, 0x2a, 0xc5, 0xe6, 0x10, 0xde, 0x60, 0x3b, 0x1e, 0x0b, 0x80, 0x75, 0xca, 0xea, 0x48, 0xa7, 0x48, 0x71, 0xef, 0x25, 0xa0, 0x1b, 0x6b, 0xfc, 0x07, 0xaf, 0x18, 0x64, 0xe9, 0xa5, 0xf3, 0xde, 0x3f, 0x39, 0x65, 0xa8, 0x8e, 0x3c, 0xcf, 0xb2, 0x34, 0x9b, 0x22, 0x7d, 0xc2, 0x24, 0x1b, 0x4b, 0xa2, 0x90, 0x1b, 0x1b, 0x60, 0xb1, 0x97, 0x28, 0xf1, 0xf6, 0x10, 0xdf, 0x96, 0xfb, 0x5a, 0xb1, 0x0e, 0xfc, 0x8b, 0x33, 0x89, 0x52, 0x40, 0x70, 0x59, 0x9f, 0x3e, 0x94, 0x53, 0x25, 0xeb, 0x44, 0xc0, 0x6d, 0x63, 0xda, 0x0f, 0x81, 0xdf, 0x12, 0xa3, 0xc5, 0x49, 0xec, 0x25, 0x6e, 0xa1, 0x58, 0x6c, 0xa0, 0x59, 0x36, 0xa7, 0x71, 0xd3, 0x8c, 0xa9, 0xc1, 0xe0, 0x94, 0xa1, 0x14, 0x48, 0xd3, 0x85, 0x3f, 0x9a, 0x30, 0x35, 0xcf, 0x03, 0xa8, 0x76, 0x58, 0x78, 0xea, 0xa3, 0xd8, 0x86, 0xe1, 0x69, 0x3c, 0x0a, 0xa1, 0x5a, 0xb8, 0x59, 0xf8, 0xf9, 0x83, 0x35, 0x06, 0x8c, 0x3b, 0x30, 0xb7, 0xdc, 0x18, 0xf8, 0x6d, 0x34, 0xc5, 0xe1, 0xe9, 0x72, 0x37, 0x37, 0xc6, 0xc3, 0x53, 0x3f, 0x17, 0xe4, 0xa2, 0xdf, 0x08, 0xfe, 0xb1, 0xb4, 0xd4, 0xd0, 0x38, 0x07, 0x1d, 0xc3, 0xe1, 0x6d, 0xa2, 0x4a, 0x10, 0x6d, 0x14, 0x65, 0x25, 0x76, 0xdf, 0x06, 0x52, 0xa4, 0xf8, 0x92, 0xc3, 0x8e, 0x03, 0x83, 0x31, 0x75, 0xa8, 0x5e, 0x02, 0x82, 0x21, 0x0d, 0xb3, 0x95, 0x30, 0x5d, 0xb9, 0x14, 0x63, 0xa5, 0xe0, 0x2b, 0x97, 0x8b, 0xf9, 0x60, 0x8a, 0x8d, 0x96, 0x58, 0x2c, 0xc4, 0xcd, 0x42, 0x4a, 0xc1, 0xfb, 0x5a, 0x4c, 0xde, 0x6f, 0xef, 0xdb, 0x62, 0x32, 0xa2, 0xb9, 0x95, 0x6b, 0x2d, 0xae, 0xdc, 0x81, 0xf7, 0x81, 0x6d, 0x6f, 0x02, 0x61, 0xc1, 0x4e, 0x4c, 0x30, 0xb4, 0xe5, 0x5f, 0x4d, 0x89, 0xf2, 0xd9, 0x3f, 0x89, 0x81, 0x91, 0x18, 0x9a, 0xd1, 0x2b, 0x45, 0x3c, 0x5c, 0x73, 0xcc, 0x55, 0xad, 0x21, 0x99, 0x6f, 0xb7, 0x0a, 0x25, 0x58, 0xbc, 0x23, 0xca, 0x12, 0x1f, 0xc7, 0xf9, 0x88, 0x27, 0x39, 0x4c, 0x3d, 0x4a, 0x0a, 0xfa, 0x11, 0x54, 0xc8, 0x1d, 0x98, 0xbb, 0x4e, 0xd0, 0x3d, 0xf7, 0xb4, 0x94, 0x55, 0x7e, 0xe5, 0xbd, 0x1e, 0x08, 0x8f, 0x9a, 0xfb, 0x69, 0x22, 0x05, 0x26, 0x47, 0x32, 0xcf, 0xba, 0xcb, 0x7d, 0x41, 0x21, 0x19, 0xce, 0xeb, 0xfc, 0x79, 0x7f, 0x0b, 0xd2, 0xab, 0x27, 0x41, 0x44, 0xfb, 0x80, 0x6a, 0x50, 0x71, 0x01, 0x50, 0xc1, 0x34, 0xbb, 0x5a, 0xcf, 0x37, 0x80, 0x27, 0xe4, 0xcb, 0xcb, 0xb8, 0x43, 0x00, 0x85, 0x9e, 0x00, 0x8f, 0xe5, 0x95, 0x5d, 0x82, 0x8b, 0x2d, 0xc2, 0xa9, 0x0e, 0x5c, 0x6f, 0x5b, 0x35, 0x7b, 0x06, 0x50, 0xc9, 0xc9, 0xea, 0xa9, 0xda, 0x35, 0x4c, 0xf9, 0x82, 0x64, 0x82, 0x82, 0x90, 0xfb, 0xde, 0x94, 0x35, 0x05, 0x64, 0x0b, 0x6b, 0xeb, 0x30, 0x1a, 0x17, 0x17, 0xb7, 0x87, 0x82, 0x37, 0xbc, 0x59, 0x05, 0x7e, 0x81, 0x6b, 0xfd, 0x6d, 0xf1, 0xe0, 0x01, 0xad, 0x38, 0xd5, 0x2d, 0x2f, 0x77, 0xcb, 0x82, 0x76, 0xfc, 0x44, 0x2e, 0x41, 0x10, 0x1b, 0x41, 0x32, 0x76, 0xa5, 0x0e, 0xe7, 0x29, 0x9d, 0x0e, 0x16, 0x10, 0x08, 0xc6, 0x25, 0x24, 0x50, 0x49, 0x4c, 0xf2, 0x7b, 0xa4, 0x90, 0x1c, 0xc0, 0x91, 0x25, 0x61, 0xed, 0xa9, 0xc9, 0x56, 0x93, 0x70, 0xc8, 0xd7, 0x95, 0x4a, 0x58, 0x54, 0xd9, 0xeb, 0x73, 0xd8, 0xdc, 0x3d, 0x5b, 0xaa, 0xde, 0x27, 0x51, 0x40, 0x21, 0x1c, 0x75, 0xc8, 0xa2, 0x94, 0x54, 0x61, 0x1c, 0x1e, 0x12, 0xd8, 0x49, 0x71, 0x6a, 0x54, 0xc9, 0x13, 0x2d, 0x95, 0x80, 0xd8, 0xb0, 0x4a, 0xb3, 0x55, 0x53, 0xb1, 0x1c, 0x3d, 0x54, 0x97, 0x4a, 0x4a, 0x9b, 0x9f, 0xe4, 0x0f, 0x1e, 0x9c, 0xfa, 0x49, 0xeb, 0x95, 0x50, 0x4e, 0x74, 0xd5, 0x7c, 0x4e, 0x67, 0xef, 0xe4, 0x24, 0xa8, 0xf9, 0x5c, 0x35, 0x88, 0x03, 0xc8, 0x01, 0xba, 0xb4, 0xf7, 0xb5, 0xf5, 0xdc, 0xd8, 0x20, 0x90, 0xe3, 0xc9, 0xcf, 0x40, 0x2e, 0x24, 0xa7, 0xab, 0x67, 0x55, 0x24, 0xf2, 0x13, 0xd1, 0xf2, 0x7a, 0x44, 0x64, 0xd4, 0x06, 0xd9, 0xc5, 0x47, 0xc9, 0x6a, 0x21, 0x31, 0xa9, 0x36, 0xb1, 0xa9, 0x76, 0x69, 0x89, 0xe0, 0x6f, 0x45, 0x44, 0x5f, 0x4b, 0x4b, 0x00, 0x25, 0x6e, 0x7a, 0x53, 0x63, 0xce, 0xde, 0xd4, 0x22, 0x76, 0x66, 0x3f, 0x2b, 0x0c, 0x70, 0x73, 0x6b, 0x3f, 0x03, 0xa4, 0x49, 0x29, 0x08, 0x28, 0x44, 0xc9, 0x43, 0x5b, 0x80, 0x72, 0x6b, 0x93, 0xca, 0xcb, 0x4d, 0x0a, 0xe8, 0x2a, 0xaf, 0x6c, 0x52, 0xb9, 0x67, 0x92, 0x11, 0x6d, 0x29, 0x52, 0x9c, 0x14, 0x4b, 0x44, 0xe2, 0x82, 0x16, 0xed, 0x0c, 0x26, 0x4d, 0xb0, 0xb4, 0x24, 0x94, 0x8e, 0x5c, 0x20, 0x5f, 0xfd, 0x46, 0x8a, 0x27, 0xf4, 0x36, 0xf2, 0x8d, 0xee, 0xb1, 0x83, 0x08, 0xd8, 0x8a, 0x52, 0x86, 0x34, 0xff, 0x8d, 0x64, 0xe9, 0xc0, 0x9f, 0x11, 0x72, 0xf0, 0xfd, 0x7a, 0xf2, 0x34, 0xd2, 0x64, 0x8b, 0x9b, 0x6b, 0xd9, 0xcd, 0x49, 0x00, 0x84, 0xc3, 0x22, 0x10, 0x2a, 0x61, 0x47, 0xa9, 0x54, 0xc6, 0x97, 0xb0, 0xe7, 0x4c, 0x69, 0x58, 0xc5, 0x6b, 0x64, 0x95, 0x02, 0xf9, 0x85, 0xaf, 0x9e, 0x4b, 0x4e, 0x52, 0x20, 0x27, 0x29, 0x80, 0x93, 0x20, 0x42, 0xe4, 0x57, 0xa4, 0xba, 0xf5, 0x90, 0x03, 0x72, 0xb8, 0xa3, 0xde, 0x89, 0xd6, 0x52, 0xbb, 0xb1, 0xf4, 0xb6, 0xb6, 0x52, 0xdd, 0x94, 0xb9, 0x43, 0x8a, 0x76, 0xd4, 0x96, 0x51, 0x36, 0xa5, 0x55, 0xaa, 0xd9, 0xd6, 0xca, 0x8f, 0xd0, 0x9a, 0x8b, 0xcd, 0x69, 0x75, 0x8c, 0x5a, 0xd4, 0xcb, 0xc1, 0xb0, 0x91, 0x25, 0x86, 0x6e, 0x07, 0x3c, 0x10, 0xd0, 0x1d, 0x24, 0x5d, 0xb4, 0x5c, 0x90, 0xdc, 0xd1, 0x86, 0xed, 0x4e, 0xc9, 0x20, 0xca, 0xa4, 0x01, 0xec, 0xb1, 0x91, 0x17, 0x19, 0x48, 0x4a, 0x0d, 0xf8, 0xdc, 0x78, 0x93, 0x9c, 0x27, 0x00, 0xb5, 0xc3, 0xb1, 0x4c, 0x83, 0x5d, 0x77, 0x03, 0x58, 0xb3, 0xa0, 0x90, 0x18, 0xcb, 0x71, 0x40, 0xdb, 0xaa, 0xbf, 0xef, 0x5d, 0x0b, 0xd9, 0x86, 0x3a, 0x35, 0x74, 0xf4, 0x5c, 0x32, 0x2a, 0xa3, 0x03, 0xc3, 0x66, 0xb2, 0xa0, 0x75, 0x63, 0xa5, 0xbc, 0x42, 0x79, 0xd0, 0x36, 0x90, 0x58, 0xaa, 0x9a, 0x77, 0xa9, 0x9f, 0x9c, 0x9c, 0xce, 0xac, 0x79, 0xbd, 0xd6, 0x0d, 0x36, 0x83, 0x6d, 0xc1, 0x2a, 0xf7, 0xd6, 0x67, 0x14, 0x12, 0xb1, 0xb1, 0x34, 0x83, 0xd1, 0x28, 0x9e, 0x80, 0x92, 0x09, 0xeb, 0xb6, 0x50, 0x46, 0x12, 0x2d, 0x02, 0xab, 0x1f, 0x86, 0x08, 0x1c, 0x27, 0x82, 0xf5, 0xc8, 0x2f, 0xda, 0x14, 0x9e, 0x88, 0x35, 0x14, 0x29, 0x96, 0xfe, 0x4c, 0x28, 0x4e, 0x4a, 0x43, 0x77, 0xf5, 0x9e, 0xef, 0x5f, 0x37, 0x9b, 0x4d, 0xfd, 0xc4, 0x50, 0x8f, 0x4e, 0xa4, 0x9c, 0xcd, 0x7a, 0x42, 0x41, 0x4f, 0x9a, 0x64, 0x03, 0xce, 0x78, 0x02, 0x3a, 0x17, 0x13, 0x8a, 0x1b, 0xac, 0x24, 0x63, 0xd1, 0xbe, 0xb0, 0x80, 0x90, 0x7d, 0x70, 0x17, 0x78, 0xd2, 0xf5, 0xd4, 0x54, 0xed, 0x3f, 0x16, 0x5a, 0x05, 0x5f, 0x58, 0x9d, 0xca, 0xd5, 0x96, 0xfb, 0xd7, 0x7d, 0x5e, 0x28, 0xf1, 0x50, 0x8d, 0x15, 0x98, 0xd6, 0x9b, 0xa2, 0x9d, 0x83, 0x14, 0x85, 0x1f, 0x81, 0x6d, 0x31, 0x14, 0x8c, 0xcd, 0x6e, 0x64, 0x11, 0xd8, 0xd1, 0x38, 0x09, 0xcd, 0x58, 0x26, 0xe7, 0x45, 0xeb, 0x63, 0xc1, 0xc4, 0x1a, 0x01, 0x0d, 0x76, 0xc4, 0xb3, 0x62, 0x82, 0x6f, 0xa0, 0x11, 0x58, 0x2e, 0xea, 0xcd, 0x33, 0x9e, 0x77, 0xb3, 0x68, 0x84, 0x7a, 0x80, 0xd1, 0x22, 0xce, 0x52, 0x2f, 0xea, 0x8f, 0xb3, 0xa0, 0x13, 0xa3, 0x89, 0x9b, 0xf1, 0x64, 0x3c, 0xe4, 0xfa, 0x09, 0xe1, 0x30, 0xa4, 0x51, 0x05, 0xd6, 0xbc, 0x2e, 0xa7, 0x53, 0x14, 0xb5, 0x5e, 0xf2, 0x89, 0x69, 0x31, 0xe2, 0xcd, 0x73, 0x7c, 0x01, 0x4c, 0xa0, 0x54, 0xcb, 0x7f, 0x35, 0xec, 0x1d, 0x28, 0x34, 0xd4, 0x50, 0x65, 0x1b, 0x08, 0xb0, 0xc5, 0x3d, 0xa0, 0xff, 0x6b, 0x03, 0xeb, 0x19, 0x9e, 0x78, 0x28, 0xaa, 0x83, 0x65, 0x06, 0x34, 0x4f, 0x5a, 0x92, 0x24, 0x3c, 0xfe, 0xb4, 0x58, 0x7f, 0xf0, 0x80, 0x97, 0x1c, 0x12, 0x3f, 0xc2, 0xfc, 0x0a, 0x13, 0x4e, 0xae, 0x75, 0x70, 0x45, 0xe7, 0xb9, 0xd9, 0x74, 0xee, 0x02, 0x59, 0x28, 0x46, 0x8c, 0x72, 0x84, 0xea, 0x27, 0x00, 0xea, 0x0e, 0x4a, 0xea, 0x0e, 0x4a, 0xea, 0xce, 0x60, 0x13, 0x0d, 0x4e, 0xd7, 0x01, 0x08, 0xd0, 0xb5, 0x16, 0x32, 0xe0, 0xed, 0x40, 0x7f, 0xd0, 0x14, 0xc3, 0xd7, 0x6a, 0x58, 0x99, 0x35, 0x2c, 0xe0, 0x30, 0x80, 0xd8, 0x03, 0x37, 0x03, 0x25, 0x31, 0x43, 0x0e, 0x74, 0x8c, 0x7a, 0xb6, 0x02, 0x08, 0x59, 0x01, 0xd9, 0xb5, 0x5d, 0x22, 0x90, 0xa0, 0x1c, 0x6c, 0xa6, 0x6d, 0xc4, 0xc0, 0x8f, 0x32, 0xe4, 0x47, 0x19, 0xf0, 0xa3, 0x6b, 0x65, 0x86, 0x42, 0x8c, 0x9e, 0x64, 0xa7, 0x1e, 0x82, 0x03, 0x8d, 0x86, 0x33, 0x43, 0x0d, 0xa7, 0x82, 0x9c, 0xee, 0x6c, 0x12, 0x6a, 0x07, 0x38, 0x08, 0xd5, 0xa2, 0xa7, 0x88, 0x57, 0xae, 0xab, 0x85, 0xb5, 0x29, 0x13, 0x33, 0x2a, 0x3b, 0x0f, 0x4c, 0x4e, 0x90, 0x61, 0x2b, 0x25, 0xae, 0x32, 0xc0, 0x55, 0x20, 0x16, 0x35, 0x20, 0x57, 0x5a, 0x37, 0xa9, 0xb6, 0x6e, 0x5e, 0x9b, 0x66, 0xa1, 0x00, 0x0e, 0xff, 0x88, 0xc6, 0x7d, 0x0a, 0xe0, 0xc6, 0xb9, 0x57, 0x9a, 0x8e, 0xd1, 0xea, 0x2b, 0xeb, 0x8b, 0x03, 0x2e, 0x97, 0x04, 0x2d, 0x63, 0x92, 0x8c, 0xc1, 0x04, 0x38, 0x98, 0xa0, 0xc4, 0x8f, 0x9c, 0x27, 0xd4, 0xe5, 0x32, 0x0f, 0xd7, 0x7d, 0x94, 0x80, 0xce, 0xac, 0x70, 0x27, 0x9b, 0xb5, 0xd7, 0x0b, 0x1e, 0x22, 0xe5, 0x30, 0x4b, 0x86, 0xb5, 0xd0, 0xd8, 0x5e, 0xfa, 0xd8, 0x41, 0xbf, 0xec, 0xa0, 0xe7, 0x87, 0x27, 0x7d, 0xea, 0xa0, 0x87, 0xc7, 0x2b, 0x67, 0x67, 0xa3, 0x2c, 0x2d, 0xd2, 0xb3, 0xb3, 0xc6, 0xcd, 0x0d, 0xbd, 0xa0, 0x52, 0xd9, 0x18, 0x8f, 0xc9, 0x1a, 0x55, 0x00, 0x46, 0xf5, 0x00, 0x18, 0x0b, 0x36, 0x63, 0x3d, 0x22, 0xe0, 0x85, 0xe4, 0xa4, 0x77, 0xea, 0xe1, 0x3f, 0xfe, 0x08, 0x4b, 0xb7, 0xaf, 0xed, 0xe5, 0x5a, 0x5d, 0xcc, 0x50, 0xa4, 0x95, 0x25, 0xd2, 0xe0, 0x8d, 0xb5, 0x4e, 0xa8, 0x9a, 0x78, 0x91, 0x79, 0x20, 0xcf, 0xb5, 0x46, 0x82, 0xf1, 0x95, 0xd6, 0xa9, 0x91, 0x34, 0xac, 0x99, 0x46, 0x9d, 0xa1, 0x8f, 0xb5, 0xd7, 0x87, 0xb0, 0xf3, 0x8b, 0x7e, 0x87, 0x62, 0x4a, 0xad, 0xd6, 0xbc, 0x99, 0xb6, 0x96, 0x96, 0x64, 0x39, 0x64, 0x8d, 0x23, 0x65, 0x92, 0x07, 0x61, 0x4c, 0x89, 0x78, 0x30, 0xa9, 0xb1, 0x6f, 0x12, 0x45, 0x62, 0xce, 0x67, 0x7c, 0xdb, 0x7c, 0xc6, 0x30, 0x9f, 0x0c, 0xb6, 0x71, 0x20, 0xa1, 0x75, 0x50, 0x86, 0x43, 0x02, 0x4b, 0x36, 0x15, 0x72, 0xd0, 0x71, 0x35, 0x5f, 0x72, 0x23, 0x96, 0xb1, 0x10, 0x64, 0x42, 0x28, 0xea, 0x87, 0xed, 0x50, 0xc0, 0xa1, 0xcc, 0x87, 0x8a, 0x7f, 0x97, 0x7c, 0x20, 0xc0, 0xed, 0x05, 0x68, 0x51, 0x68, 0x18, 0xb8, 0x3a, 0xc5, 0xa2, 0xe6, 0x86, 0x68, 0x2a, 0xc9, 0xb4, 0xd0, 0x46, 0x05, 0xd8, 0xcb, 0x7a, 0x71, 0x00, 0xcc, 0xb2, 0x25, 0xb4, 0x96, 0x18, 0x34, 0xa4, 0x61, 0x30, 0x72, 0x03, 0xd8, 0x4a, 0xec, 0x25, 0x9d, 0x69, 0xc6, 0x18, 0x34, 0xe5, 0xf9, 0x1c, 0x92, 0x59, 0x1b, 0x17, 0x83, 0x02, 0x8a, 0x16, 0xea, 0x9c, 0x82, 0x4b, 0x4b, 0x19, 0x41, 0xa3, 0x17, 0xa1, 0x2e, 0xd4, 0x8b, 0xe2, 0x82, 0x03, 0xb1, 0xf8, 0x1b, 0xa2, 0x84, 0x27, 0x96, 0x90, 0x56, 0x71, 0x62, 0xb9, 0xb9, 0xce, 0xb0, 0x18, 0x7d, 0x76, 0x29, 0xf8, 0x43, 0x5b, 0x40, 0xd1, 0xc2, 0x25, 0xa3, 0x79, 0x46, 0xb5, 0xcc, 0xc2, 0x5a, 0x2b, 0xa8, 0x85, 0xc3, 0x9c, 0x4e, 0xee, 0x29, 0xa0, 0x00, 0x0f, 0x0b, 0xaa, 0xae, 0x82, 0x0b, 0xd4, 0x65, 0x6b, 0x75, 0x0b, 0x8c, 0xd1, 0x56, 0x8d, 0x5b, 0x68, 0xf5, 0xd0, 0xf9, 0x96, 0x55, 0x5a, 0x4a, 0x25, 0xf1, 0x9d, 0x6b, 0x89, 0xb3, 0x08, 0x85, 0xdc, 0x85, 0x18, 0x8b, 0x80, 0xe8, 0x03, 0xa2, 0x2c, 0xfe, 0x8d, 0x9b, 0xe5, 0x52, 0xc2, 0xa7, 0xcb, 0x2c, 0x2a, 0xd4, 0x6f, 0x73, 0x59, 0xad, 0x0b, 0x26, 0xb7, 0xb0, 0x06, 0xc4, 0xb7, 0x6a, 0x80, 0xd8, 0x47, 0x10, 0x0b, 0xaf, 0x5f, 0x4e, 0x55, 0x84, 0x3a, 0x36, 0x1d, 0xff, 0x04, 0xed, 0xe4, 0x24, 0x3c, 0x3d, 0x89, 0x40, 0x3e, 0x96, 0xc4, 0x57, 0x4f, 0xa8, 0x58, 0x8a, 0x45, 0x0c, 0x2d, 0x58, 0x0f, 0x1e, 0x84, 0xeb, 0x19, 0xe8, 0x17, 0x41, 0x3b, 0xbf, 0xbb, 0x5e, 0x2e, 0x2a, 0x4d, 0x0d, 0x3e, 0xca, 0xf2, 0x53, 0x89, 0xdc, 0x14, 0x94, 0x02, 0x7f, 0xe3, 0xc3, 0x51, 0x11, 0xc4, 0xdc, 0x01, 0xc6, 0x19, 0x3a, 0xbd, 0x2c, 0x1d, 0x3a, 0x4f, 0x17, 0xaf, 0xf9, 0x74, 0xa3, 0xf9, 0xa1, 0xdc, 0x93, 0x9f, 0x59, 0xc6, 0x67, 0xda, 0xb5, 0x79, 0xa8, 0xed, 0xcf, 0xbc, 0x79, 0x39, 0xe0, 0x89, 0x94, 0x84, 0xb4, 0x40, 0x04, 0x93, 0x06, 0xf2, 0xca, 0x01, 0x40, 0x20, 0x3f, 0xa8, 0xe3, 0x57, 0x17, 0x21, 0xc2, 0x39, 0xf7, 0x01, 0xd3, 0x53, 0x4d, 0x82, 0xa2, 0xad, 0x72, 0x1d, 0x89, 0x7d, 0x39, 0x32, 0x0d, 0x87, 0x4a, 0xee, 0xd2, 0x8a, 0xb9, 0xd8, 0x44, 0x63, 0x5b, 0x62, 0x55, 0xbc, 0x61, 0x63, 0xb5, 0x2d, 0x45, 0xaf, 0xd8, 0x2d, 0xda, 0x11, 0x1d, 0x70, 0x92, 0xc9, 0x0e, 0xde, 0x82, 0xe8, 0x26, 0x84, 0x61, 0x90, 0x0d, 0x1b, 0x47, 0x83, 0xf4, 0xb2, 0x51, 0x5a, 0xcf, 0x41, 0x1c, 0x01, 0x86, 0x15, 0x6b, 0xe9, 0xb2, 0xd9, 0x93, 0x76, 0x95, 0x69, 0x65, 0x88, 0x12, 0x8b, 0xdd, 0xc4, 0x3f, 0x69, 0x40, 0x91, 0xf4, 0xb2, 0x07, 0xbb, 0x0e, 0x10, 0x13, 0xe7, 0x49, 0x83, 0x35, 0x82, 0x7c, 0x92, 0x74, 0xf1, 0xef, 0xb8, 0x48, 0x7b, 0x69, 0x77, 0x9c, 0xcb, 0xdf, 0xa3, 0x38, 0x98, 0xc0, 0xcf, 0xee, 0x80, 0x77, 0xcf, 0x79, 0x88, 0xbf, 0x80, 0xe5, 0x67, 0x69, 0x8c, 0xdf, 0xa5, 0xe9, 0x1f, 0x7f, 0x45, 0x39, 0x92, 0x14, 0x7e, 0x07, 0x42, 0x1a, 0x26, 0x29, 0x4c, 0x72, 0x84, 0xda, 0x2c, 0xbc, 0x18, 0x44, 0x61, 0x48, 0x5d, 0x00, 0x73, 0x05, 0x21, 0x2b, 0x1b, 0x46, 0x89, 0xf8, 0x00, 0x13, 0x9f, 0x61, 0xe5, 0x28, 0x87, 0xd5, 0x02, 0x7f, 0xe3, 0x34, 0xc5, 0x3f, 0x43, 0x68, 0x32, 0x1a, 0xc5, 0x9c, 0x7e, 0x16, 0xd4, 0x66, 0x92, 0x0a, 0x87, 0x07, 0xfa, 0x69, 0x34, 0x0d, 0x54, 0x83, 0x0d, 0x23, 0x8c, 0x79, 0x94, 0xc4, 0xd0, 0x20, 0x3c, 0x21, 0x65, 0xa4, 0x49, 0x3c, 0xa1, 0x9f, 0x9f, 0xc6, 0x51, 0x46, 0x4d, 0x64, 0x1c, 0x75, 0x46, 0xfa, 0x99, 0xf3, 0x60, 0x18, 0xf3, 0x3c, 0xa7, 0x9f, 0xe8, 0xf0, 0x01, 0x6f, 0x81, 0x03, 0x27, 0x9a, 0x19, 0x9e, 0x34, 0xba, 0x71, 0x90, 0xe7, 0xb8, 0x22, 0xa1, 0x0c, 0xd1, 0xab, 0x6c, 0xf7, 0xb5, 0x68, 0x17, 0xc7, 0xf8, 0x2a, 0x7d, 0x5b, 0x02, 0x12, 0xe5, 0xfb, 0x34, 0x84, 0x24, 0xdd, 0x57, 0x80, 0x12, 0x50, 0xbb, 0x12, 0x28, 0x20, 0xe4, 0x6e, 0x02, 0xcc, 0x74, 0x6c, 0x76, 0x12, 0x25, 0x80, 0x80, 0x17, 0xc7, 0xfb, 0x7b, 0x50, 0x1a, 0xc5, 0xf7, 0x6d, 0x94, 0xe2, 0x13, 0xc2, 0x08, 0x7e, 0x39, 0xc6, 0x53, 0x1d, 0xd6, 0x50, 0x54, 0xd4, 0x80, 0xea, 0x3d, 0x2d, 0x38, 0xc8, 0x63, 0xd5, 0x1a, 0x31, 0x02, 0x94, 0x2a, 0x05, 0x7c, 0x4b, 0x8c, 0xa3, 0xc1, 0x06, 0xc5, 0x30, 0xde, 0x49, 0xb3, 0x16, 0x02, 0xde, 0x98, 0x7a, 0xac, 0x7f, 0xff, 0x76, 0x5a, 0x26, 0x2e, 0xec, 0xb9, 0x6d, 0x5d, 0x2f, 0xb6, 0x66, 0x50, 0xb1, 0xf5, 0xe6, 0xf8, 0xf8, 0xf5, 0xab, 0xd6, 0x1a, 0xdb, 0x7d, 0x75, 0xf0, 0xe6, 0xb8, 0x05, 0x12, 0x16, 0x4d, 0x2f, 0x95, 0x95, 0x58, 0xda, 0xdd, 0xff, 0x11, 0xdf, 0xab, 0x49, 0xa5, 0x4f, 0x25, 0xe2, 0x8e, 0xb6, 0x0f, 0x77, 0x0f, 0xa8, 0xa2, 0x31, 0xad, 0x54, 0xc6, 0xc2, 0xe8, 0xdb, 0xdd, 0x67, 0xcf, 0x5f, 0x63, 0x29, 0x35, 0xdd, 0x54, 0xa4, 0x9c, 0x23, 0xd9, 0x3d, 0x3b, 0x7e, 0xfe, 0xfe, 0x78, 0xf3, 0xf0, 0xf9, 0x26, 0x14, 0x35, 0x9d, 0x5e, 0x06, 0x89, 0x7d, 0x9a, 0xd6, 0x4f, 0xd0, 0xb4, 0x68, 0x2f, 0xd4, 0x1c, 0x16, 0x6a, 0x4a, 0x88, 0x69, 0xb4, 0x51, 0x49, 0x6e, 0xe7, 0xcd, 0x45, 0xb9, 0xaf, 0xb5, 0x72, 0xb9, 0x9a, 0x86, 0xe6, 0x84, 0x76, 0x38, 0x60, 0x83, 0x47, 0xc9, 0x68, 0x4c, 0x13, 0x17, 0x47, 0xdd, 0x73, 0x5c, 0x1b, 0x9d, 0x58, 0xfd, 0x94, 0x7a, 0xda, 0x10, 0x18, 0x34, 0x51, 0x11, 0x2c, 0x33, 0x74, 0x43, 0x11, 0xbf, 0xd2, 0xb1, 0x98, 0x7a, 0x51, 0x1b, 0x78, 0x56, 0x08, 0x1a, 0x88, 0xf8, 0x35, 0xa6, 0x75, 0x91, 0x82, 0xae, 0x2c, 0xdf, 0xd1, 0xef, 0x61, 0x7a, 0xc1, 0xd5, 0x6f, 0x51, 0x59, 0xfc, 0x04, 0x42, 0x57, 0xbf, 0xa9, 0xe2, 0x28, 0x45, 0x7f, 0x9d, 0x4c, 0x56, 0x95, 0x4f, 0xb2, 0xb2, 0x7c, 0x12, 0xd5, 0xd5, 0x83, 0x68, 0x40, 0x3e, 0x51, 0x13, 0x45, 0x3a, 0x06, 0x0e, 0x90, 0x84, 0xea, 0xa7, 0xac, 0x4d, 0xbf, 0xf3, 0x22, 0x80, 0x65, 0x7c, 0x6a, 0x20, 0xb7, 0x63, 0x1f, 0x17, 0xf8, 0x4a, 0xa9, 0x61, 0x91, 0xb6, 0xb6, 0x82, 0x58, 0x91, 0xc0, 0xde, 0xb5, 0xca, 0x40, 0xca, 0x86, 0xfd, 0xa7, 0x38, 0x89, 0x96, 0xd7, 0x4e, 0x41, 0x68, 0xbe, 0x2a, 0x8e, 0xa2, 0x0e, 0xcc, 0x70, 0x9f, 0xf5, 0xc5, 0xf9, 0x2d, 0x19, 0x8e, 0x82, 0xa7, 0xd1, 0xcd, 0x4d, 0xf6, 0x34, 0x5e, 0x17, 0x9a, 0x3f, 0x6a, 0x24, 0x3e, 0x08, 0x72, 0x20, 0x73, 0x5f, 0x83, 0x0a, 0xc3, 0x40, 0x34, 0x5f, 0x57, 0x92, 0x28, 0x19, 0xfc, 0xd6, 0x45, 0x7b, 0x54, 0x28, 0x86, 0x1f, 0xeb, 0x5e, 0xb4, 0xbc, 0xcc, 0xe2, 0xe5, 0x65, 0xe2, 0xd1, 0xf0, 0x3a, 0x28, 0xa5, 0xdd, 0xf8, 0x69, 0xd2, 0xce, 0x60, 0x7e, 0xb3, 0x0a, 0x00, 0x2d, 0xac, 0x0a, 0x82, 0x4c, 0x28, 0x40, 0xa0, 0xde, 0xd1, 0x6c, 0x9d, 0x03, 0xd3, 0xda, 0xa2, 0x89, 0x06, 0x41, 0x14, 0x7a, 0x3e, 0x05, 0x89, 0x76, 0xaa, 0x6c, 0xc2, 0xe8, 0x9c, 0x95, 0x79, 0x0a, 0xe6, 0x75, 0xcf, 0x5d, 0xe8, 0x83, 0x3a, 0xd5, 0x17, 0x1a, 0x2e, 0x80, 0x8d, 0x87, 0x56, 0xf8, 0xb7, 0x99, 0xd1, 0xec, 0xa1, 0x91, 0x0a, 0x60, 0x57, 0xb5, 0xf5, 0xc0, 0x10, 0xe6, 0xa5, 0x25, 0x1c, 0x20, 0x5a, 0x0c, 0x69, 0x2c, 0x25, 0xc0, 0xc5, 0xc9, 0xf2, 0x72, 0x64, 0x81, 0xba, 0x5e, 0x0f, 0x17, 0x34, 0x07, 0x7f, 0xcc, 0x82, 0x78, 0x90, 0x52, 0x29, 0xb9, 0xbc, 0x1c, 0xe3, 0x08, 0xa0, 0x30, 0x6c, 0xce, 0xd0, 0xf3, 0x29, 0x8d, 0x85, 0x36, 0x9e, 0xbe, 0x77, 0xdd, 0x27, 0xea, 0x86, 0x55, 0x4b, 0xc2, 0xc2, 0xc8, 0xcf, 0x04, 0x32, 0x46, 0x88, 0x8c, 0x3e, 0x8a, 0x1b, 0xd0, 0xc2, 0xe8, 0x94, 0x8d, 0x40, 0x37, 0x9a, 0x2a, 0xf8, 0xfa, 0x42, 0xb9, 0xc6, 0xd1, 0x92, 0x16, 0x21, 0x4e, 0x5a, 0x50, 0x19, 0xcb, 0x9e, 0xf6, 0x96, 0x96, 0x7a, 0x4f, 0x63, 0x41, 0x17, 0x23, 0x3f, 0x60, 0x43, 0x7f, 0x8d, 0x1d, 0x89, 0x36, 0x1f, 0x3c, 0x18, 0x3d, 0x8d, 0x96, 0x96, 0xa0, 0x69, 0x10, 0x65, 0x5c, 0xf7, 0x48, 0xb7, 0x33, 0x02, 0xac, 0xa9, 0x43, 0x8c, 0x23, 0x90, 0xc8, 0x7b, 0x0f, 0x86, 0xde, 0xba, 0x37, 0x04, 0xbc, 0x41, 0x93, 0xc3, 0x8d, 0xde, 0x72, 0xa6, 0x70, 0xd3, 0xf5, 0xb1, 0x57, 0x35, 0x5f, 0xbd, 0x79, 0xf3, 0xd5, 0x95, 0xf3, 0x85, 0x87, 0xf7, 0xc0, 0x53, 0xba, 0x7c, 0x1b, 0x59, 0xac, 0x8d, 0x35, 0x59, 0x44, 0xcf, 0x8e, 0xc4, 0xa5, 0x9a, 0x36, 0x2d, 0xf9, 0x9f, 0xe5, 0xa0, 0x22, 0x2d, 0x3e, 0x7b, 0x7f, 0xf6, 0xec, 0xf9, 0xde, 0xf3, 0x1f, 0x37, 0x8f, 0x9f, 0x37, 0xca, 0x65, 0x30, 0x4a, 0xf4, 0x01, 0x11, 0x48, 0x81, 0xb6, 0x45, 0x67, 0x2f, 0x07, 0x5a, 0x81, 0xfd, 0xdd, 0x8f, 0x19, 0x5a, 0x42, 0x94, 0xc3, 0x1e, 0x99, 0x0a, 0x52, 0xb7, 0x60, 0x48, 0x1a, 0x20, 0x88, 0x47, 0x59, 0x5e, 0x10, 0x74, 0x6d, 0x1c, 0xbf, 0x64, 0x3e, 0xb0, 0xb0, 0xa6, 0xe8, 0x17, 0x43, 0xa7, 0x1f, 0x4c, 0xc8, 0x09, 0x54, 0xdc, 0xd8, 0x44, 0xfc, 0x46, 0xc3, 0x30, 0x08, 0x1c, 0x2b, 0x40, 0x14, 0x14, 0x4a, 0x48, 0x31, 0x64, 0x98, 0x6c, 0xae, 0xdb, 0x65, 0xc1, 0x87, 0x80, 0x26, 0x60, 0xee, 0x5a, 0xe8, 0xc8, 0x9a, 0x7a, 0xef, 0xf2, 0x39, 0xcb, 0x84, 0xfd, 0x29, 0x31, 0xe1, 0x9d, 0xc2, 0xe2, 0x26, 0xf9, 0x17, 0x16, 0x2e, 0xac, 0xb8, 0x18, 0x0f, 0xfc, 0x9b, 0xdd, 0x38, 0x4d, 0x38, 0x7a, 0x37, 0xba, 0x0b, 0xa5, 0xc7, 0x4f, 0x50, 0xbe, 0x06, 0x82, 0x08, 0x4a, 0xa0, 0x87, 0x64, 0x55, 0xf2, 0x2f, 0x41, 0x6c, 0x48, 0x2f, 0x9b, 0x0a, 0x38, 0xc3, 0x20, 0x72, 0x72, 0x96, 0x9f, 0x42, 0xeb, 0xf4, 0x57, 0x71, 0xe1, 0x52, 0xeb, 0x4a, 0x80, 0xb1, 0x94, 0xde, 0x68, 0x68, 0xf4, 0x5d, 0x4f, 0x4a, 0x73, 0x07, 0xc8, 0x67, 0x27, 0x09, 0x9a, 0xbf, 0xc5, 0x81, 0x2d, 0xd9, 0xbf, 0x83, 0x30, 0xc4, 0x63, 0xd8, 0x02, 0x7f, 0x3c, 0xbf, 0x80, 0xbe, 0xd0, 0x6f, 0x92, 0xc3, 0x38, 0xdd, 0x98, 0x5d, 0x26, 0x96, 0x9d, 0xfb, 0x65, 0x51, 0xba, 0x3a, 0x09, 0x47, 0x04, 0x2e, 0x69, 0x63, 0xb3, 0x28, 0xb2, 0xa8, 0x03, 0x72, 0x8b, 0x5b, 0xe0, 0x21, 0x22, 0x2c, 0x11, 0xe3, 0x0d, 0x33, 0xcf, 0x0f, 0x2f, 0x34, 0x97, 0xcc, 0xdb, 0x33, 0x05, 0x1b, 0x0d, 0xac, 0x3d, 0xdb, 0x64, 0x59, 0x7d, 0xaf, 0x50, 0xfe, 0x6a, 0xf3, 0x00, 0x90, 0xbb, 0x3f, 0x36, 0xa4, 0xf7, 0x70, 0xdf, 0x38, 0x15, 0x3e, 0x4b, 0x4a, 0xb2, 0x20, 0x07, 0x23, 0xdb, 0xac, 0x99, 0x7b, 0x6d, 0x97, 0x9f, 0x7c, 0x58, 0x5c, 0x5c, 0xbc, 0x2e, 0xa6, 0x1f, 0x90, 0x39, 0xac, 0x9e, 0x32, 0xfd, 0xe2, 0x59, 0x50, 0x04, 0xf4, 0x12, 0x58, 0x53, 0xcb, 0x2a, 0xa6, 0xd9, 0x59, 0xb5, 0xb9, 0x52, 0xeb, 0xc4, 0xa6, 0x80, 0x69, 0xcd, 0xe0, 0x19, 0x80, 0x81, 0x2f, 0x3e, 0xac, 0x8c, 0xa8, 0xd9, 0x05, 0x19, 0x15, 0xe0, 0xc3, 0x0e, 0x48, 0x25, 0x90, 0x4b, 0xb6, 0xae, 0x0e, 0x53, 0x1b, 0xf6, 0x82, 0x25, 0x59, 0x9b, 0xc8, 0x5e, 0x94, 0x63, 0xa5, 0x95, 0xa8, 0xec, 0xb9, 0xa6, 0x82, 0x27, 0xac, 0x9d, 0x40, 0x31, 0xe6, 0xcb, 0x5c, 0x1c, 0xc5, 0xc5, 0x2c, 0x10, 0x64, 0x05, 0x24, 0x15, 0xf8, 0xea, 0xf0, 0x60, 0x3d, 0x7e, 0x1a, 0xac, 0xc7, 0xa6, 0x05, 0x2d, 0x02, 0xf6, 0xb9, 0xbe, 0x00, 0xca, 0x4e, 0x46, 0x2e, 0xad, 0x89, 0x50, 0x6e, 0xc2, 0xc6, 0xcd, 0x4d, 0x01, 0xac, 0x1c, 0x68, 0x6c, 0x11, 0x6d, 0xa0, 0x19, 0x1d, 0x04, 0xca, 0x83, 0x00, 0xda, 0xc4, 0xa6, 0x65, 0xe3, 0xc9, 0xdc, 0xc6, 0x13, 0x68, 0x1c, 0x76, 0xca, 0x85, 0x05, 0x6c, 0xab, 0xbe, 0x17, 0xb9, 0x61, 0x84, 0xb0, 0xe5, 0x84, 0x46, 0x6f, 0xa0, 0xdd, 0xd0, 0x97, 0x50, 0xdb, 0xa2, 0x0d, 0x6f, 0x99, 0x3d, 0xae, 0xa8, 0x10, 0x59, 0xbe, 0xb6, 0xde, 0xe5, 0x6d, 0x22, 0xf1, 0x46, 0x5e, 0x4c, 0x40, 0x28, 0xf3, 0x5a, 0xa5, 0xd7, 0x1e, 0x9e, 0x0b, 0xc0, 0xbb, 0xf5, 0xd2, 0x04, 0x5f, 0x94, 0x36, 0x7e, 0x6d, 0xfc, 0x6b, 0x76, 0xf3, 0x1c, 0x05, 0x58, 0xbf, 0x58, 0x37, 0xa4, 0x29, 0x59, 0x0a, 0xb4, 0xc9, 0xb2, 0x40, 0xae, 0xac, 0x7b, 0x0c, 0xcf, 0x29, 0x69, 0x82, 0x18, 0x1e, 0x7b, 0x16, 0xf8, 0x4b, 0x39, 0xc7, 0x09, 0xf4, 0xa3, 0x96, 0x9e, 0x7b, 0x05, 0x20, 0xc2, 0x97, 0xa7, 0xf7, 0x89, 0x24, 0x7a, 0xad, 0x40, 0xc6, 0x06, 0x66, 0xe3, 0xd3, 0xb2, 0x5a, 0xe1, 0x81, 0xec, 0x81, 0x18, 0x8c, 0x16, 0x68, 0x83, 0x3d, 0x25, 0x18, 0x60, 0xd1, 0x95, 0x35, 0x51, 0x9b, 0xc6, 0x2f, 0x7e, 0x54, 0x2a, 0x57, 0x25, 0x9e, 0xae, 0x88, 0x80, 0x50, 0xbd, 0xa7, 0xf5, 0x52, 0xda, 0x7d, 0x2a, 0x36, 0x7a, 0xad, 0xf5, 0xf9, 0xbb, 0xb4, 0x40, 0xf5, 0x33, 0x8b, 0x0c, 0x43, 0x3c, 0x13, 0xa5, 0x15, 0x02, 0xd1, 0x3f, 0xda, 0xd6, 0x0a, 0x87, 0x40, 0x91, 0xf8, 0x96, 0x71, 0x5d, 0x78, 0xa2, 0x96, 0x2b, 0xe8, 0xe1, 0x11, 0xce, 0x2a, 0x5a, 0xf1, 0x4b, 0x6e, 0x99, 0x57, 0x6c, 0xf0, 0xa5, 0x1d, 0x9f, 0xe5, 0xa6, 0x15, 0x3f, 0xb5, 0x16, 0x7d, 0x6e, 0x98, 0xb8, 0x16, 0x12, 0x44, 0x0a, 0x9d, 0x36, 0x2b, 0xc0, 0xcc, 0x05, 0xa5, 0xe6, 0x56, 0x8c, 0x8b, 0x81, 0x62, 0xee, 0xad, 0x3f, 0x43, 0x7f, 0x77, 0xf1, 0x02, 0x8f, 0xe7, 0x18, 0x1e, 0x3c, 0x1b, 0x7d, 0x69, 0x90, 0x61, 0xf4, 0xc2, 0x44, 0x06, 0xa4, 0x7f, 0x5d, 0xce, 0xae, 0xe9, 0xff, 0x0e, 0x93, 0x44, 0x8e, 0xf2, 0x0b, 0xc2, 0x66, 0x5b, 0x78, 0x04, 0x5f, 0xa0, 0x3d, 0xe6, 0x51, 0x05, 0x2a, 0xed, 0x8d, 0x11, 0x8a, 0x4a, 0x57, 0x38, 0xe6, 0x80, 0xd1, 0x49, 0x34, 0xbe, 0x80, 0x8e, 0x62, 0xf2, 0x5b, 0xb1, 0x9b, 0x2d, 0x6e, 0x6d, 0x49, 0xad, 0x2f, 0x12, 0x1d, 0xcc, 0x66, 0x33, 0xab, 0xcd, 0x72, 0x50, 0x47, 0xd6, 0x29, 0x58, 0xb3, 0x48, 0xf7, 0xd2, 0x4b, 0x9e, 0x6d, 0x07, 0x39, 0x3a, 0x01, 0x4a, 0x89, 0xc2, 0x5d, 0x59, 0x76, 0x4f, 0x82, 0xe5, 0xcf, 0xa7, 0xde, 0x4a, 0x9f, 0xd1, 0x0c, 0xf8, 0x1b, 0xe8, 0xe7, 0xf6, 0x66, 0x34, 0x52, 0x45, 0x4d, 0xe6, 0x34, 0xe3, 0x24, 0x0a, 0x7b, 0x79, 0x16, 0x0d, 0xa1, 0xbd, 0x7c, 0x14, 0x47, 0x85, 0xbb, 0xf2, 0xa7, 0xfc, 0xc1, 0x4a, 0xb9, 0xb5, 0x45, 0xe4, 0x59, 0xad, 0x59, 0x45, 0x04, 0xd2, 0x58, 0x04, 0xac, 0x42, 0xb2, 0x79, 0xe4, 0x8c, 0xd0, 0x55, 0xbf, 0x1f, 0x83, 0x26, 0x87, 0x3e, 0x4b, 0x26, 0x1f, 0xbc, 0xca, 0xcb, 0x19, 0x81, 0x81, 0x05, 0x42, 0x20, 0xc8, 0x58, 0xc8, 0xfa, 0xac, 0xc7, 0x46, 0xb4, 0xaa, 0x7d, 0x5a, 0xa9, 0xb4, 0xee, 0x95, 0xb4, 0x82, 0x4c, 0x02, 0x49, 0x46, 0x7f, 0xd7, 0x3d, 0xe9, 0x32, 0xc4, 0x61, 0x55, 0x19, 0x72, 0xf2, 0xd4, 0xcc, 0x40, 0xd7, 0x02, 0x82, 0x6e, 0x78, 0x20, 0xc6, 0xe5, 0xa6, 0x1f, 0x45, 0xd1, 0xcc, 0x41, 0x3d, 0xe2, 0xee, 0x2a, 0x7b, 0xe4, 0x61, 0xa1, 0x34, 0x69, 0x35, 0x3c, 0x6d, 0xae, 0x55, 0x5f, 0x1f, 0x79, 0xeb, 0x09, 0x7a, 0x0a, 0x89, 0xf5, 0x6e, 0x6f, 0x01, 0x43, 0x18, 0x8d, 0xa4, 0xd8, 0xc4, 0xde, 0x02, 0x12, 0x58, 0xd2, 0x58, 0x6b, 0x66, 0xd7, 0x18, 0xde, 0xb6, 0x6b, 0xcc, 0x42, 0xb6, 0xb6, 0x2a, 0x41, 0xeb, 0x06, 0xa3, 0x02, 0x3d, 0x6c, 0x6a, 0x20, 0x84, 0x32, 0xb7, 0x83, 0x48, 0x8c, 0x78, 0x2e, 0x34, 0xe8, 0x98, 0x3a, 0xdb, 0xf1, 0x43, 0xd9, 0x6f, 0x4d, 0x7f, 0x0f, 0x3d, 0x9b, 0xf6, 0xd8, 0x91, 0x3f, 0x4c, 0x48, 0x9e, 0x19, 0x0a, 0x13, 0xfb, 0x11, 0x8e, 0x5f, 0x8b, 0xc6, 0xb3, 0x4e, 0x94, 0xb0, 0xd5, 0xb6, 0x92, 0xf5, 0x79, 0xf0, 0x82, 0x94, 0xec, 0x1e, 0xc1, 0x54, 0xa1, 0xed, 0x8f, 0x24, 0x05, 0x04, 0xf2, 0x08, 0x7a, 0x01, 0xe6, 0x04, 0xca, 0xee, 0xf0, 0x54, 0xed, 0xc9, 0x25, 0xb0, 0x4f, 0x08, 0xd8, 0x00, 0x04, 0x90, 0x56, 0x43, 0xec, 0x1f, 0xea, 0xdb, 0x13, 0x0f, 0x7d, 0xbf, 0xab, 0x25, 0x3b, 0x69, 0x1a, 0x43, 0x49, 0x21, 0x08, 0x59, 0x25, 0xdd, 0x91, 0x5f, 0x2d, 0x3c, 0x02, 0x46, 0x0d, 0x68, 0x07, 0xde, 0xd1, 0xf7, 0xc7, 0x89, 0x3c, 0x33, 0xc4, 0xc7, 0x9e, 0x0f, 0xca, 0x3c, 0x7a, 0x93, 0xc9, 0x78, 0x19, 0x7a, 0x19, 0xfa, 0xa1, 0x59, 0x06, 0xcf, 0x87, 0x12, 0x90, 0x30, 0xf1, 0x7b, 0x69, 0xd7, 0x6c, 0x2c, 0x63, 0x7b, 0x8d, 0x88, 0x5c, 0xbf, 0x02, 0x10, 0x77, 0x46, 0xe4, 0xef, 0x6a, 0x80, 0x02, 0xfb, 0x2d, 0x4c, 0x5a, 0x49, 0xf1, 0xb8, 0x95, 0xeb, 0x07, 0xb2, 0x89, 0xb4, 0x49, 0x0e, 0x03, 0x90, 0x33, 0x60, 0xa0, 0x21, 0xfc, 0xbf, 0xdf, 0xe6, 0x27, 0x47, 0xe8, 0x03, 0x07, 0xa2, 0x10, 0x08, 0x46, 0x3d, 0xa8, 0x01, 0xbf, 0xbc, 0x16, 0xe1, 0xa3, 0x97, 0x9c, 0x14, 0x20, 0x08, 0xe0, 0x5a, 0xaf, 0xd9, 0x63, 0x2e, 0x4b, 0xb7, 0x17, 0xf4, 0x29, 0x08, 0x32, 0x50, 0x80, 0xf4, 0xb1, 0x11, 0x49, 0x58, 0x9c, 0xa2, 0x88, 0xa6, 0x1f, 0xc8, 0x3f, 0x42, 0x14, 0x20, 0x21, 0xb7, 0x3b, 0xce, 0x80, 0xab, 0x15, 0xc7, 0xe2, 0x4d, 0xec, 0x87, 0xfe, 0x46, 0xbd, 0x81, 0x15, 0xb6, 0x74, 0x51, 0x0d, 0x0f, 0xdf, 0x2b, 0x67, 0x2c, 0xc2, 0x30, 0x1b, 0x4e, 0x3d, 0x29, 0xbb, 0xeb, 0x13, 0xb9, 0x42, 0xba, 0xb6, 0xe0, 0xf0, 0xc8, 0xd7, 0x91, 0x6c, 0x7d, 0x8a, 0xb4, 0xfa, 0xf0, 0xfd, 0xc3, 0xe2, 0x75, 0x2e, 0x45, 0x42, 0x2c, 0xd8, 0x2f, 0x0f, 0x61, 0x42, 0x21, 0xc8, 0x15, 0xc0, 0x5f, 0xb8, 0xd7, 0xd2, 0x4f, 0x1c, 0x55, 0xd1, 0x2e, 0x7a, 0x0f, 0xc4, 0x5b, 0xe3, 0x0e, 0x34, 0x27, 0x99, 0x85, 0x3e, 0x2d, 0x6f, 0x0e, 0xd2, 0x1c, 0xa3, 0xbb, 0xd4, 0x0e, 0x89, 0x8f, 0x0b, 0x86, 0x04, 0xb1, 0x20, 0x5e, 0x35, 0xcf, 0x16, 0x65, 0x41, 0x52, 0x42, 0x02, 0xd0, 0xf7, 0x5c, 0x85, 0x19, 0xa0, 0x5c, 0xe8, 0x8a, 0x8a, 0x79, 0xb0, 0xbc, 0x30, 0x72, 0x44, 0x7b, 0x80, 0xae, 0x07, 0xae, 0x27, 0x27, 0x5b, 0xb4, 0x00, 0x93, 0xd2, 0x1c, 0x05, 0x88, 0x44, 0xd4, 0x44, 0xf0, 0x89, 0xea, 0xad, 0x7b, 0xeb, 0x53, 0x1c, 0xd1, 0x5c, 0x6c, 0x5a, 0x98, 0xaf, 0x41, 0xaa, 0x75, 0xee, 0x0c, 0xbd, 0x28, 0x3d, 0x66, 0x3a, 0x25, 0x0c, 0xa4, 0x43, 0xf2, 0x1b, 0x3d, 0x08, 0x4a, 0x07, 0x96, 0xd0, 0xb7, 0xdf, 0xa3, 0x3f, 0x98, 0x1b, 0xe2, 0x59, 0x4c, 0xc5, 0xdd, 0x5f, 0x1f, 0xe2, 0x3d, 0xa4, 0x91, 0xe0, 0xb1, 0x1d, 0x5b, 0x58, 0x08, 0xd0, 0xdb, 0x01, 0x03, 0x00, 0xc8, 0x54, 0x22, 0x47, 0x47, 0x61, 0x2d, 0xf2, 0x37, 0xcb, 0xa0, 0xc5, 0x0e, 0xa8, 0x78, 0xe7, 0x53, 0x2a, 0x51, 0x8e, 0x1a, 0x28, 0x3b, 0xf2, 0xc4, 0x17, 0x19, 0x32, 0x40, 0x7d, 0x9b, 0x3b, 0xba, 0xdc, 0xfc, 0x69, 0xff, 0x10, 0xc7, 0xaf, 0xa6, 0x7c, 0xa7, 0xd9, 0xe8, 0xba, 0x97, 0x93, 0x03, 0xb7, 0x64, 0xfc, 0xb9, 0x16, 0x2b, 0xb5, 0xe6, 0xa9, 0x26, 0x16, 0x65, 0x5e, 0x4d, 0x2d, 0xe4, 0x33, 0xe4, 0x07, 0x68, 0xfa, 0x58, 0x3d, 0x15, 0xff, 0x5a, 0x93, 0xc2, 0x59, 0xec, 0x97, 0x62, 0xe4, 0xcd, 0x0d, 0x3d, 0x25, 0xe3, 0x61, 0x87, 0x67, 0x0d, 0x1a, 0xaf, 0xf9, 0x42, 0x4e, 0x6f, 0x91, 0x1e, 0x51, 0x71, 0x57, 0xac, 0xe3, 0xdc, 0x2b, 0x61, 0x41, 0xa9, 0x40, 0x6e, 0x80, 0x42, 0x25, 0x81, 0x35, 0x9c, 0x11, 0x9f, 0x38, 0x16, 0xb1, 0x7a, 0x8f, 0xda, 0x59, 0x33, 0x04, 0xaa, 0x96, 0x0e, 0x5b, 0xe2, 0xc1, 0x07, 0xc5, 0x6e, 0x46, 0x59, 0x46, 0x51, 0x96, 0x34, 0xdb, 0x02, 0x1d, 0xdd, 0xb7, 0x0b, 0xb1, 0x17, 0xb2, 0x4c, 0xf2, 0x48, 0x14, 0xb3, 0x1a, 0x0d, 0x4d, 0xce, 0x86, 0x2c, 0xdc, 0x46, 0xdf, 0xa7, 0x52, 0x6f, 0x96, 0x3d, 0xb4, 0xf0, 0xad, 0xa9, 0xce, 0x17, 0xe5, 0xde, 0xa0, 0x6c, 0x21, 0xb1, 0x62, 0xa1, 0x3c, 0x80, 0xed, 0xa1, 0xec, 0x54, 0x3a, 0xb1, 0x2b, 0x6c, 0xcc, 0xc8, 0x6f, 0x42, 0x9a, 0x94, 0xc3, 0x06, 0xe2, 0x5c, 0x37, 0x67, 0x31, 0xb3, 0x67, 0x31, 0xf3, 0x91, 0x04, 0x72, 0x21, 0xcb, 0x66, 0xd4, 0xfa, 0x54, 0x98, 0x1c, 0xf2, 0x59, 0x8f, 0x9a, 0xc2, 0x2b, 0xb5, 0x95, 0x13, 0xd4, 0x55, 0x60, 0xb3, 0xab, 0xea, 0x80, 0x84, 0xf3, 0xdc, 0xcd, 0x88, 0x86, 0x22, 0xcf, 0x86, 0xc9, 0xec, 0x47, 0x08, 0xb8, 0xba, 0xa7, 0xcc, 0x88, 0x2a, 0x13, 0x82, 0x6b, 0x39, 0x5e, 0x90, 0x62, 0x34, 0x2f, 0x25, 0x2c, 0x85, 0xed, 0xdc, 0x28, 0xde, 0x9e, 0x08, 0x3d, 0x28, 0xf1, 0x5a, 0x1d, 0x21, 0xa3, 0x64, 0xb0, 0xc1, 0x00, 0x6c, 0xd8, 0x80, 0xc7, 0xc4, 0x57, 0x0f, 0x47, 0x99, 0x19, 0x1b, 0xb0, 0xa2, 0x02, 0xea, 0x6c, 0x56, 0x93, 0x25, 0xd2, 0x51, 0xbd, 0x96, 0xf3, 0x0d, 0x0c, 0x43, 0xfd, 0x26, 0xf7, 0x48, 0x35, 0xfd, 0x6a, 0xce, 0x50, 0x2e, 0x6a, 0x34, 0xc8, 0x9b, 0xdd, 0xb0, 0xed, 0x70, 0x74, 0x1c, 0xe2, 0x49, 0x28, 0xec, 0x50, 0x85, 0xd0, 0xfc, 0x0d, 0xcb, 0x14, 0x6e, 0x6e, 0x65, 0x71, 0x84, 0x14, 0xd8, 0xc7, 0xec, 0xf6, 0x11, 0xe4, 0x15, 0x33, 0x8f, 0xe9, 0xf9, 0x21, 0xd4, 0xcb, 0x62, 0x46, 0xbd, 0x94, 0x64, 0x20, 0x94, 0x4b, 0x0c, 0x41, 0x3a, 0x51, 0x26, 0x93, 0x53, 0xd6, 0x27, 0x31, 0x02, 0x36, 0x4f, 0x09, 0x3d, 0x2a, 0x9c, 0x0b, 0xab, 0xf2, 0xef, 0x9a, 0x87, 0xd2, 0x3a, 0x6c, 0xc6, 0x8a, 0x72, 0xbc, 0xd2, 0x5c, 0x6e, 0x2e, 0x23, 0x4f, 0xfa, 0x0e, 0x66, 0xde, 0x1c, 0xc3, 0x00, 0xe0, 0x3e, 0xf2, 0x03, 0x31, 0x47, 0x21, 0xec, 0xc7, 0x91, 0x2e, 0xd7, 0xb7, 0xe9, 0x57, 0x04, 0x41, 0xdd, 0x49, 0xad, 0xb2, 0xb1, 0x6a, 0x27, 0xed, 0xac, 0x05, 0x4a, 0x70, 0xe5, 0x75, 0xe8, 0xb5, 0xc3, 0xd6, 0x49, 0x78, 0x8a, 0xdd, 0x2a, 0x0b, 0x83, 0x84, 0x16, 0xf6, 0xd5, 0x05, 0xcb, 0x75, 0xa0, 0xe7, 0x4b, 0x46, 0x02, 0x23, 0xa1, 0x73, 0x7a, 0x93, 0x51, 0xe0, 0x33, 0x2d, 0x5d, 0xdf, 0xef, 0xb5, 0x65, 0x1b, 0x21, 0x4e, 0xa4, 0xf8, 0x35, 0x87, 0x59, 0xf4, 0xd0, 0xa8, 0x34, 0x7b, 0x6e, 0x3f, 0x91, 0x13, 0x29, 0x0c, 0xa7, 0xd7, 0xb6, 0x45, 0xab, 0xa8, 0x5a, 0xb4, 0x2a, 0x46, 0xce, 0xe2, 0x24, 0xb1, 0x45, 0xfe, 0xed, 0xc2, 0xd6, 0xf8, 0xfc, 0xaa, 0x3f, 0x0d, 0xaf, 0x18, 0x0e, 0xb5, 0x7b, 0x7f, 0x52, 0x6e, 0x57, 0x55, 0xc8, 0x1b, 0x0d, 0xc1, 0xdc, 0xb5, 0xf3, 0xa5, 0xa0, 0x31, 0xcb, 0xd5, 0xa8, 0xb8, 0xcd, 0xeb, 0xa1, 0x90, 0x5e, 0x2c, 0xa8, 0x8f, 0x67, 0xe5, 0xd6, 0x97, 0xd9, 0xdb, 0x11, 0x5f, 0x5f, 0x40, 0x73, 0x70, 0xd0, 0x0e, 0xdb, 0x95, 0x35, 0x11, 0xe1, 0x2a, 0xae, 0x0c, 0x1d, 0xf5, 0xcf, 0x56, 0x88, 0xc4, 0xa7, 0xed, 0xb4, 0x34, 0xa7, 0x00, 0xd7, 0xea, 0x54, 0x4d, 0xef, 0x4c, 0x0d, 0xe5, 0xb4, 0x13, 0xa9, 0x73, 0xe6, 0xed, 0x84, 0xc6, 0xa1, 0xf0, 0xb7, 0x85, 0x2e, 0x01, 0xc2, 0x49, 0x4b, 0x1a, 0x19, 0xcb, 0x6f, 0x05, 0x9e, 0xf8, 0x6a, 0x34, 0xa2, 0x01, 0x31, 0x12, 0x4c, 0x0b, 0xe3, 0xa2, 0xd0, 0x0c, 0x81, 0xf1, 0x65, 0xda, 0x9b, 0xdb, 0x0c, 0x36, 0x66, 0xb1, 0x98, 0x0d, 0xe5, 0x93, 0xe4, 0x62, 0x09, 0xe5, 0x24, 0x14, 0xf8, 0xd7, 0x45, 0xda, 0x8a, 0x58, 0x3a, 0xc2, 0xe2, 0x79, 0x2b, 0x56, 0x01, 0x5c, 0x07, 0x78, 0x8c, 0x09, 0xf3, 0x14, 0xb6, 0x16, 0xd6, 0xd8, 0x48, 0x3c, 0x3c, 0x13, 0x9f, 0xe8, 0xc0, 0x38, 0x68, 0x56, 0x0b, 0xe2, 0xd0, 0x0d, 0x3d, 0x3b, 0xc3, 0xc3, 0x7d, 0x10, 0xb6, 0x9a, 0xb1, 0x92, 0xf4, 0xd1, 0x83, 0x30, 0x60, 0x78, 0x92, 0xde, 0x82, 0xb7, 0x69, 0x97, 0xc2, 0xd9, 0x19, 0x40, 0x95, 0x4d, 0x5a, 0x20, 0x46, 0x5e, 0x03, 0x3e, 0x11, 0x36, 0x10, 0x83, 0x61, 0x4d, 0x07, 0x17, 0x51, 0x1f, 0x4f, 0x08, 0x23, 0x86, 0xd5, 0x62, 0x26, 0xa3, 0xdf, 0x00, 0x9a, 0x29, 0x46, 0x42, 0x2b, 0xbf, 0xaa, 0x59, 0x30, 0x24, 0x95, 0x5f, 0xe7, 0xe3, 0x0e, 0xfa, 0x2f, 0x74, 0x30, 0x96, 0x81, 0x44, 0xa5, 0x6c, 0xd8, 0x4a, 0xa6, 0x84, 0xa2, 0x34, 0x37, 0x4e, 0x90, 0x10, 0xe7, 0xee, 0x82, 0xb4, 0xfd, 0x0e, 0x00, 0xd6, 0x34, 0x9b, 0x28, 0x57, 0xe5, 0xba, 0xb7, 0xcd, 0xb3, 0x90, 0x8f, 0x90, 0xdf, 0xd3, 0x92, 0x59, 0x5a, 0xaa, 0x94, 0x91, 0xa4, 0x43, 0xf1, 0x38, 0x34, 0xe2, 0xba, 0x36, 0x98, 0x68, 0xa3, 0x55, 0xf9, 0xa6, 0x88, 0x78, 0x8a, 0x46, 0x59, 0x96, 0xe6, 0xfe, 0x2d, 0xfd, 0x4f, 0x11, 0xf0, 0x72, 0x18, 0x07, 0x86, 0xa9, 0x00, 0x7b, 0x9d, 0xd7, 0x85, 0x0c, 0x4f, 0xb8, 0xad, 0xe1, 0x72, 0x3d, 0x9f, 0xcb, 0xa3, 0x4b, 0x4d, 0x56, 0xd2, 0xf9, 0xd0, 0x0c, 0x9e, 0x03, 0x5c, 0x12, 0x24, 0x7a, 0x25, 0x4b, 0x23, 0x31, 0x9d, 0x22, 0xa4, 0xf9, 0x32, 0xa9, 0xe4, 0x64, 0xbd, 0xd6, 0xf5, 0xa7, 0x11, 0x88, 0x27, 0x40, 0xae, 0x6d, 0x9a, 0x6d, 0x56, 0x81, 0xa5, 0x9f, 0xba, 0xcb, 0xb0, 0x5d, 0xb7, 0xe8, 0xec, 0x43, 0xb4, 0x7a, 0x9c, 0xf8, 0x2b, 0xff, 0xc6, 0x6d, 0xb7, 0xd0, 0xce, 0xb1, 0xba, 0xfc, 0xc7, 0xd3, 0x07, 0x2d, 0xaf, 0xfd, 0xa7, 0x95, 0x3f, 0xad, 0xac, 0x44, 0xec, 0x39, 0x7e, 0xfa, 0xd3, 0xca, 0x83, 0x1b, 0xf7, 0x4f, 0x2b, 0x1e, 0xfc, 0x5d, 0x5c, 0xe9, 0xb3, 0x57, 0xb9, 0xdf, 0x18, 0x14, 0xc5, 0xa8, 0xb5, 0xb2, 0x92, 0x67, 0xc6, 0x29, 0x49, 0x5f, 0x98, 0xf9, 0x17, 0x2c, 0x1f, 0x75, 0x65, 0x46, 0x79, 0x9e, 0xb0, 0xc6, 0xe2, 0x9a, 0xe1, 0xed, 0xd0, 0x06, 0x11, 0x7a, 0xe5, 0xdf, 0x9c, 0xb4, 0x7f, 0x77, 0xba, 0x02, 0x5c, 0x2b, 0x2f, 0xd0, 0x4a, 0x9d, 0xb7, 0x1a, 0x2b, 0x8d, 0x07, 0xf0, 0x6f, 0xc3, 0x08, 0x3a, 0x28, 0x0c, 0xb3, 0xe6, 0x71, 0x22, 0xca, 0x16, 0x9e, 0x1d, 0xca, 0x90, 0xf8, 0x7d, 0x12, 0x01, 0x22, 0xdc, 0xf8, 0xfa, 0x85, 0x36, 0xf7, 0x22, 0x0f, 0x94, 0x94, 0x1c, 0xa1, 0x26, 0x40, 0x27, 0x9c, 0xf9, 0xbb, 0x08, 0x64, 0x71, 0xe8, 0xc9, 0x6b, 0xc7, 0x7e, 0xd2, 0x8a, 0x2a, 0x86, 0x1f, 0x74, 0x6e, 0xb8, 0x7a, 0x8d, 0xee, 0xff, 0xd6, 0x7b, 0x0c, 0x96, 0x5c, 0xc5, 0x0a, 0x0f, 0xa2, 0x56, 0xec, 0x47, 0xcc, 0x85, 0x6d, 0x14, 0xdb, 0x78, 0xd0, 0xa7, 0x60, 0xd4, 0xd8, 0xe0, 0xd3, 0x9b, 0x89, 0x0e, 0x06, 0xe1, 0x92, 0x8e, 0xa5, 0x07, 0x74, 0xe9, 0x54, 0xad, 0x11, 0x61, 0x38, 0x11, 0xef, 0xd9, 0x4e, 0xc4, 0x34, 0xa4, 0xd2, 0x0e, 0xf5, 0xa7, 0x95, 0xef, 0xdd, 0x3f, 0x7d, 0xdf, 0xfc, 0xde, 0x6b, 0xe3, 0x24, 0x34, 0x64, 0xcf, 0x66, 0xf8, 0x83, 0xe5, 0x2c, 0x53, 0xda, 0x33, 0xf1, 0x48, 0x22, 0xc8, 0xba, 0x83, 0x83, 0x20, 0x0b, 0x86, 0xb9, 0x8e, 0xcd, 0x72, 0x71, 0x1f, 0x01, 0x4a, 0x4b, 0xc8, 0xb2, 0xd6, 0xae, 0x48, 0x80, 0xb0, 0xf7, 0x78, 0x6d, 0xfc, 0x57, 0x87, 0x0e, 0xe0, 0x83, 0x7f, 0x22, 0x36, 0xa5, 0x53, 0xf1, 0x94, 0x4f, 0xad, 0xe0, 0xb4, 0xc3, 0xc4, 0xb2, 0x7e, 0x9d, 0x80, 0x66, 0x71, 0x8a, 0x56, 0x66, 0xb2, 0x7c, 0x35, 0x56, 0xbe, 0x6f, 0xb0, 0x87, 0x1e, 0x99, 0xbb, 0xd4, 0x9b, 0x86, 0xf6, 0xc5, 0xda, 0x12, 0xd2, 0x2f, 0x2a, 0xac, 0xb1, 0xf6, 0xd3, 0x94, 0x47, 0x54, 0x86, 0xfe, 0x9a, 0xdd, 0x56, 0xd5, 0x70, 0x86, 0x0c, 0x48, 0x77, 0x7d, 0x0a, 0x12, 0x4e, 0x7f, 0x63, 0x75, 0x69, 0x29, 0xf2, 0x0d, 0xdb, 0x68, 0xe9, 0xd7, 0x8a, 0xa7, 0xd2, 0x4a, 0x22, 0xb8, 0x1e, 0x81, 0x82, 0xd6, 0x0a, 0xda, 0x8d, 0x06, 0xd2, 0x20, 0x1b, 0x11, 0xae, 0xd0, 0xcd, 0x97, 0x8d, 0xfc, 0x21, 0x0a, 0xb4, 0x5a, 0x0f, 0x56, 0x7e, 0x03, 0x27, 0xc3, 0xd2, 0xc3, 0x74, 0x08, 0x9b, 0xe2, 0x10, 0x04, 0xb1, 0x61, 0x69, 0xe7, 0x3f, 0xf2, 0x63, 0x28, 0xc1, 0xba, 0xfe, 0x11, 0x1e, 0x84, 0x80, 0x78, 0xd3, 0x6a, 0xb0, 0x8e, 0xdf, 0x6d, 0x87, 0xf0, 0xb6, 0x85, 0xff, 0x54, 0x6c, 0x3e, 0x67, 0xf0, 0xed, 0x48, 0x19, 0xa0, 0xbc, 0xd6, 0x91, 0xfd, 0x19, 0xc7, 0xd3, 0x5d, 0x5a, 0xe2, 0xb9, 0xdb, 0x61, 0x23, 0xf7, 0xcc, 0xf3, 0xbc, 0x5e, 0x53, 0xc0, 0x78, 0x72, 0x76, 0xea, 0x77, 0xb4, 0xa0, 0xd5, 0x45, 0x89, 0x14, 0x0b, 0x9d, 0x79, 0xd6, 0x30, 0xb1, 0x74, 0x31, 0x78, 0xe0, 0x7f, 0x58, 0x59, 0xbc, 0xee, 0x4c, 0x3f, 0x4c, 0x4d, 0x0f, 0xa7, 0xa1, 0xdf, 0x07, 0xe5, 0x5e, 0xf4, 0xbc, 0xdc, 0xf7, 0x9a, 0x1f, 0xd3, 0x28, 0x21, 0x0c, 0xc3, 0x3a, 0x24, 0x3d, 0x2e, 0x77, 0x87, 0xd0, 0x69, 0x64, 0x76, 0x0a, 0x13, 0x3b, 0x14, 0x9d, 0x1a, 0xbd, 0x28, 0x01, 0xa8, 0x67, 0xf0, 0x38, 0x5e, 0x09, 0x76, 0x4e, 0xfc, 0x8d, 0x84, 0xc4, 0x01, 0xc3, 0x7b, 0x5c, 0x22, 0x76, 0x61, 0xb5, 0x35, 0x7b, 0x0e, 0xd1, 0x46, 0xc3, 0x8f, 0xf9, 0xbe, 0xf4, 0x5a, 0xc6, 0xe5, 0xd1, 0xaa, 0x2a, 0x2e, 0x6d, 0x58, 0xe4, 0xe9, 0x90, 0x13, 0xc1, 0x9a, 0x71, 0x0d, 0x87, 0xbc, 0xff, 0xfc, 0x6a, 0xd4, 0x2e, 0x04, 0xff, 0x80, 0x8a, 0xb0, 0xd1, 0x95, 0xba, 0x70, 0xa2, 0x57, 0xce, 0x09, 0xd0, 0x2f, 0x12, 0x2d, 0xa0, 0x0b, 0x88, 0x2b, 0xa9, 0x10, 0x2f, 0xda, 0x73, 0xe7, 0x53, 0x60, 0x99, 0xfa, 0x20, 0xe3, 0xe1, 0x18, 0xb0, 0x29, 0x3d, 0xce, 0xa2, 0x07, 0x22, 0xf2, 0x53, 0xb3, 0x9e, 0x16, 0xb0, 0x9e, 0x87, 0xad, 0x47, 0xd0, 0x9e, 0x22, 0x58, 0x43, 0x98, 0x6b, 0xaf, 0xb6, 0xd6, 0x4c, 0x9b, 0xf2, 0x4b, 0x6b, 0x59, 0xcb, 0x53, 0x7c, 0x10, 0x29, 0x0f, 0x8d, 0xb8, 0x6a, 0xc3, 0x7f, 0x72, 0xca, 0xc8, 0x85, 0x92, 0xb4, 0xfa, 0xd2, 0x04, 0x13, 0xa0, 0xef, 0xdf, 0xcd, 0xcd, 0x2e, 0x66, 0x9e, 0xa0, 0xf3, 0x0a, 0x3a, 0xf2, 0x8f, 0x98, 0x74, 0xa4, 0x73, 0x3d, 0x98, 0x51, 0x8c, 0x2a, 0x20, 0x27, 0x45, 0x28, 0x0a, 0x9b, 0xc3, 0x7c, 0x5f, 0x7d, 0xbd, 0x11, 0xde, 0xea, 0xe9, 0x6b, 0x38, 0xde, 0x6b, 0x48, 0x0e, 0x79, 0x0f, 0xdd, 0xb4, 0x9a, 0xda, 0x23, 0x1f, 0xad, 0xe7, 0x66, 0xcc, 0xc8, 0xdb, 0x32, 0x8a, 0xdd, 0x5f, 0x81, 0x3d, 0xa7, 0xfd, 0xa7, 0xd6, 0x09, 0xec, 0x3f, 0xa7, 0x0f, 0xbc, 0x3f, 0xb5, 0x57, 0x9a, 0xfc, 0x8a, 0x77, 0x65, 0x3c, 0xa2, 0x5e, 0xc6, 0xe8, 0xed, 0x23, 0x36, 0x50, 0xae, 0xed, 0x8c, 0x85, 0x60, 0xe2, 0x32, 0xf8, 0x88, 0x5e, 0xca, 0x57, 0x0f, 0xd0, 0x15, 0x56, 0x27, 0x5d, 0x50, 0x9b, 0xea, 0x49, 0xce, 0xf2, 0x07, 0x20, 0xc8, 0xae, 0x9d, 0x4a, 0x9f, 0x83, 0x02, 0x37, 0x44, 0xd8, 0x02, 0x67, 0x3a, 0x87, 0x49, 0xf6, 0x22, 0xc9, 0x12, 0x45, 0x0d, 0xec, 0x24, 0x51, 0x9d, 0x98, 0x8d, 0xcb, 0x21, 0xbf, 0x45, 0x0f, 0x62, 0x4d, 0x10, 0x68, 0xa8, 0xf7, 0x37, 0x4e, 0x48, 0xe4, 0x82, 0x7f, 0x22, 0x72, 0x2f, 0x45, 0xef, 0xd8, 0x07, 0x81, 0x77, 0xca, 0x4e, 0x4e, 0x95, 0xf3, 0xc5, 0x4e, 0xe2, 0xaf, 0xad, 0xae, 0xb2, 0x17, 0xb9, 0xbf, 0x03, 0xe8, 0x63, 0x23, 0xf9, 0xf7, 0x22, 0x27, 0xc3, 0x17, 0x6c, 0x30, 0xe3, 0xdc, 0x7d, 0x91, 0x7b, 0xac, 0xf1, 0x74, 0x73, 0xc3, 0x09, 0x92, 0xd0, 0xf9, 0x6e, 0x9c, 0xf3, 0xef, 0x1c, 0x74, 0xff, 0xe1, 0x99, 0x33, 0xca, 0xa2, 0x61, 0x54, 0x44, 0x17, 0x3c, 0x77, 0xba, 0x01, 0xc8, 0x60, 0xdc, 0x41, 0xbf, 0x2a, 0x07, 0xbd, 0x8e, 0x70, 0x4d, 0x44, 0x21, 0x77, 0x02, 0xe7, 0x10, 0xcb, 0x36, 0x41, 0x10, 0x7a, 0x9d, 0x50, 0xa3, 0xd0, 0xe2, 0x28, 0x07, 0x1a, 0xb9, 0x80, 0x8e, 0x9a, 0x1d, 0xe0, 0x3a, 0xec, 0x23, 0xb9, 0x69, 0x6a, 0xd2, 0x7b, 0x9d, 0xb8, 0x15, 0xa7, 0xc9, 0x42, 0x25, 0x4d, 0x20, 0xeb, 0x16, 0x4e, 0x26, 0x90, 0xcd, 0xbe, 0x5d, 0xeb, 0x22, 0x77, 0xeb, 0x5d, 0x2d, 0x73, 0x33, 0xd4, 0x31, 0x37, 0x52, 0x11, 0x40, 0xa3, 0x30, 0x55, 0x19, 0xb5, 0x09, 0xcb, 0x18, 0x36, 0x99, 0x29, 0xfb, 0x24, 0x06, 0x4e, 0xb0, 0x29, 0xd1, 0xb6, 0x94, 0x3c, 0xde, 0x88, 0x23, 0xbd, 0x86, 0xb2, 0xad, 0x5f, 0x93, 0xd5, 0x2d, 0x01, 0x79, 0xb5, 0x95, 0x33, 0x99, 0x5b, 0xa9, 0x95, 0x30, 0xfa, 0x13, 0x31, 0x75, 0x74, 0x04, 0xc2, 0x78, 0x94, 0xf4, 0xd2, 0x56, 0x30, 0x45, 0xd7, 0x07, 0x7f, 0x01, 0x36, 0x74, 0x9b, 0x9b, 0xa0, 0xf8, 0xb9, 0xa0, 0xb6, 0x23, 0x50, 0xaa, 0xaf, 0xcf, 0xf9, 0xa4, 0xc5, 0x59, 0x6d, 0xe3, 0xa0, 0x76, 0xaa, 0xd6, 0xd4, 0x98, 0x3e, 0xa3, 0x01, 0x13, 0xd9, 0x6e, 0x39, 0xfd, 0x7d, 0xd6, 0xf3, 0xac, 0xb4, 0x52, 0x23, 0x94, 0xe2, 0x81, 0x44, 0x7a, 0x5e, 0xc9, 0x8d, 0xf7, 0xd0, 0x08, 0x3e, 0x12, 0x12, 0xcc, 0x91, 0x9f, 0xb5, 0x87, 0xad, 0xa1, 0xc9, 0x86, 0xd6, 0x3c, 0x34, 0x70, 0x1d, 0xf9, 0x47, 0x26, 0x27, 0x42, 0x32, 0xea, 0xfa, 0x1b, 0xdd, 0x2a, 0x9b, 0xb9, 0xb9, 0xb1, 0x5f, 0x7d, 0x0f, 0x9c, 0xa7, 0xdb, 0xe2, 0x49, 0x17, 0xb4, 0xb2, 0x37, 0x87, 0xbb, 0xdb, 0x6a, 0x28, 0x6e, 0xd7, 0x33, 0x18, 0x3f, 0xeb, 0x0b, 0x12, 0x47, 0x49, 0x37, 0x64, 0x22, 0xc7, 0x52, 0x10, 0xe3, 0x84, 0xb4, 0x7a, 0x4c, 0x72, 0xc6, 0xd6, 0x11, 0x1b, 0x62, 0x5c, 0x2a, 0xcf, 0x5a, 0xb0, 0xef, 0x1f, 0xb1, 0x85, 0x8c, 0xf1, 0x26, 0xbd, 0xd9, 0x21, 0xae, 0x08, 0x8a, 0xab, 0x3e, 0xa5, 0xee, 0x4f, 0x89, 0xb4, 0x4b, 0xb7, 0x5e, 0x31, 0x5f, 0xab, 0x9a, 0x91, 0x10, 0xdd, 0xe6, 0x18, 0x6b, 0xdd, 0x05, 0x65, 0xae, 0x85, 0xfc, 0xf8, 0x84, 0x1b, 0xd9, 0x07, 0xbe, 0x5f, 0xe3, 0x8f, 0x97, 0x0b, 0xd5, 0xa1, 0x6b, 0x9c, 0xaf, 0x19, 0x61, 0x1e, 0x91, 0x19, 0x6d, 0x11, 0xa1, 0x9e, 0x1a, 0x95, 0x7a, 0x2a, 0xba, 0x89, 0x50, 0xd4, 0x7f, 0xdc, 0x2c, 0x5b, 0x21, 0x46, 0x12, 0x58, 0x1b, 0x65, 0xd2, 0x1c, 0x27, 0xf9, 0x20, 0xea, 0x15, 0x52, 0x9d, 0x22, 0xc8, 0x5a, 0x71, 0x39, 0x96, 0xc4, 0x0c, 0xdc, 0xfc, 0x6c, 0x06, 0x15, 0x55, 0xa3, 0xd2, 0xda, 0xbc, 0x05, 0xcc, 0xa9, 0x2c, 0xfc, 0x4b, 0x2e, 0xa9, 0x14, 0x98, 0x37, 0x46, 0xf9, 0xe3, 0xf9, 0xac, 0x3e, 0x7e, 0xa6, 0x96, 0x2a, 0x36, 0x9e, 0x3b, 0xfc, 0x13, 0xd0, 0x98, 0xa6, 0x0d, 0x91, 0x59, 0x69, 0xb3, 0x01, 0x80, 0x90, 0xe1, 0x1b, 0xbc, 0xdb, 0x6d, 0x20, 0x19, 0xd2, 0x91, 0x4b, 0x46, 0x14, 0x89, 0x4b, 0x45, 0x87, 0x9a, 0xc0, 0xea, 0xc9, 0x58, 0xe1, 0x55, 0x1d, 0xc7, 0x43, 0x50, 0x2a, 0x04, 0x19, 0xf4, 0x3d, 0x2d, 0x26, 0x55, 0x6c, 0x31, 0xe5, 0x41, 0x38, 0xea, 0xea, 0xea, 0xc1, 0x30, 0xd9, 0x09, 0x8b, 0x9f, 0xfa, 0x00, 0xcb, 0xa9, 0xe7, 0x01, 0x1a, 0xca, 0x37, 0x48, 0x69, 0x82, 0x9e, 0x0c, 0x83, 0xa7, 0x0a, 0x41, 0x01, 0x32, 0x41, 0x4e, 0x99, 0x9f, 0xea, 0x7d, 0x12, 0x13, 0x18, 0x89, 0x28, 0x0f, 0x6f, 0x2a, 0x83, 0x40, 0xa7, 0xa5, 0x01, 0x4d, 0x16, 0xc2, 0xa4, 0x22, 0x20, 0x04, 0x64, 0x85, 0x62, 0xb7, 0x41, 0x93, 0xc8, 0x6a, 0x39, 0x16, 0x7f, 0x0d, 0x42, 0x2c, 0xa4, 0x74, 0x62, 0xc4, 0x0c, 0xd2, 0x9e, 0xa1, 0x62, 0x06, 0x9f, 0x26, 0x66, 0xdc, 0x20, 0x10, 0xd8, 0x49, 0x7e, 0xaa, 0xe9, 0xa7, 0x90, 0x8e, 0xe2, 0xda, 0xec, 0x23, 0x37, 0x24, 0x63, 0xca, 0xb7, 0x92, 0xea, 0x79, 0x30, 0xee, 0xd4, 0x6f, 0x0e, 0xf7, 0xdc, 0x57, 0x39, 0x6a, 0x2b, 0x07, 0x6e, 0x4f, 0xf3, 0xc3, 0x11, 0xf1, 0x43, 0x23, 0xcb, 0x8d, 0x2a, 0x3a, 0x42, 0x5b, 0x2d, 0xc5, 0x80, 0xab, 0x2f, 0x58, 0x01, 0x44, 0x8e, 0x26, 0x05, 0x5f, 0xba, 0x1f, 0x76, 0x13, 0x72, 0xe4, 0x75, 0x70, 0x66, 0x9d, 0xc5, 0xeb, 0xd1, 0xf4, 0x83, 0xc7, 0x40, 0x06, 0x63, 0x49, 0xe9, 0xfa, 0x0e, 0xcb, 0x16, 0x10, 0xd1, 0xa3, 0x5c, 0x67, 0x30, 0x2f, 0x23, 0xfa, 0x31, 0x45, 0x69, 0x5c, 0xa6, 0x72, 0x01, 0xbe, 0x8a, 0xd5, 0x13, 0x3c, 0x76, 0x03, 0xd2, 0x2b, 0xdf, 0x0a, 0xdd, 0x81, 0x8e, 0x3c, 0x33, 0xe3, 0x35, 0x10, 0xd8, 0x00, 0x4f, 0xd5, 0xf0, 0x19, 0x28, 0x1a, 0x64, 0xef, 0xdc, 0x0d, 0x48, 0xb4, 0x00, 0x35, 0x24, 0x32, 0xb2, 0xc2, 0xa0, 0x34, 0xe2, 0xa8, 0xa6, 0x4b, 0x49, 0x20, 0x96, 0x12, 0x86, 0x23, 0xda, 0x37, 0x62, 0x46, 0xd4, 0x07, 0xec, 0xa1, 0x7c, 0x9d, 0xe9, 0xf2, 0xa4, 0xf9, 0x97, 0xb2, 0x8d, 0x7a, 0x0f, 0xbc, 0xb9, 0x7c, 0x1b, 0xe2, 0x5b, 0x4a, 0x04, 0xd8, 0xca, 0x41, 0x82, 0xec, 0x7b, 0xad, 0x97, 0xf8, 0xaf, 0x30, 0x4f, 0xf4, 0x0c, 0xb3, 0xcf, 0xab, 0xa4, 0xac, 0xd4, 0x33, 0x54, 0x99, 0x77, 0xb6, 0xc7, 0x9f, 0xd8, 0x55, 0xd0, 0xc1, 0x3a, 0x88, 0x5b, 0x27, 0x20, 0xd5, 0x9d, 0xb2, 0x71, 0x11, 0x01, 0x62, 0x03, 0xf8, 0x2c, 0xb6, 0x8f, 0x00, 0x45, 0xe3, 0x9c, 0x76, 0x42, 0x58, 0x66, 0x17, 0xb0, 0x57, 0x21, 0x7a, 0x02, 0x63, 0x33, 0xd3, 0xaf, 0xfb, 0xf0, 0x5a, 0x78, 0x18, 0xef, 0xf1, 0xe0, 0x82, 0xdf, 0xdc, 0xa0, 0x61, 0x8a, 0xf5, 0x7c, 0x50, 0x75, 0x01, 0x95, 0x09, 0x6d, 0xbe, 0xa0, 0x5c, 0x0a, 0xc3, 0x5c, 0xaf, 0xb4, 0xf2, 0x55, 0x95, 0xc8, 0x0f, 0x8b, 0xd7, 0xbd, 0xa9, 0x13, 0xe5, 0x4e, 0x92, 0xa2, 0x83, 0x84, 0x20, 0x02, 0xac, 0x4c, 0xf8, 0xfe, 0x00, 0x2b, 0x1a, 0x16, 0x1c, 0x4e, 0x16, 0x9d, 0x07, 0xe2, 0x19, 0x9a, 0x4c, 0x76, 0xd6, 0x63, 0x52, 0xab, 0xa4, 0x5c, 0x82, 0xdd, 0x2c, 0x8d, 0x63, 0x32, 0xfc, 0x88, 0x65, 0x7e, 0x32, 0x62, 0x43, 0x95, 0xb4, 0x88, 0xf6, 0xa0, 0x75, 0x75, 0xf2, 0xec, 0x5e, 0xb0, 0x73, 0xdc, 0xbf, 0xce, 0x65, 0x4a, 0x0d, 0xdf, 0xef, 0xe0, 0xe1, 0xdb, 0xb9, 0xce, 0x9f, 0x00, 0x13, 0x06, 0xa3, 0x3c, 0x32, 0xd4, 0xad, 0x21, 0x7a, 0x08, 0xb2, 0x1e, 0xc8, 0x01, 0xec, 0xc8, 0x3f, 0x67, 0xbf, 0x8a, 0x50, 0xd6, 0x6b, 0x2c, 0x72, 0x8e, 0xe7, 0xd1, 0xee, 0x91, 0x8c, 0xc1, 0x62, 0x63, 0xf8, 0x29, 0xb2, 0xab, 0xb0, 0x4b, 0x90, 0xab, 0xdc, 0x8f, 0xfe, 0xc6, 0x47, 0x25, 0x61, 0x5f, 0xf9, 0x1b, 0x57, 0x4d, 0x34, 0xac, 0xa3, 0xeb, 0xab, 0x87, 0x09, 0x12, 0x65, 0xc6, 0x10, 0xab, 0xb5, 0x9f, 0x65, 0xe3, 0xd8, 0x9b, 0x0c, 0x98, 0xa0, 0x53, 0x24, 0x69, 0xeb, 0x6a, 0x2c, 0x2d, 0xed, 0xba, 0x47, 0x1e, 0x1b, 0xe2, 0xc8, 0x00, 0x1a, 0x9d, 0xac, 0x09, 0xa5, 0x96, 0x13, 0x50, 0x99, 0x70, 0xd0, 0x1a, 0x5d, 0x1e, 0x3b, 0x19, 0xb0, 0xb1, 0x7a, 0x25, 0x01, 0x5b, 0xf4, 0x61, 0x45, 0x77, 0xd8, 0x80, 0x05, 0x22, 0xcd, 0xe4, 0xbb, 0x0c, 0xed, 0xfd, 0x99, 0xc7, 0x26, 0xc8, 0xd1, 0x2f, 0xa1, 0x30, 0xfa, 0xdc, 0x6c, 0xca, 0x75, 0xa2, 0x3c, 0x19, 0x9a, 0x45, 0x16, 0x24, 0x39, 0xfa, 0xd7, 0xbf, 0xc9, 0x62, 0x5b, 0x85, 0xa1, 0x0c, 0x4a, 0xcc, 0x2e, 0xe1, 0x2e, 0x96, 0x4b, 0x11, 0xb4, 0x18, 0x51, 0xc4, 0x7c, 0xc7, 0x0e, 0xcd, 0x53, 0xdd, 0x0b, 0x7f, 0x13, 0xbe, 0x9f, 0xa3, 0xc2, 0xaf, 0xd8, 0xd8, 0x47, 0x60, 0xbc, 0x1f, 0x9f, 0x5e, 0x28, 0x36, 0xf6, 0x11, 0x58, 0x98, 0x1d, 0x25, 0x70, 0xce, 0x2e, 0x4e, 0x3e, 0x9e, 0x4a, 0x65, 0x4e, 0x0b, 0x61, 0xe7, 0x53, 0xb6, 0x27, 0xe8, 0x18, 0xde, 0xca, 0xa1, 0xb5, 0x2b, 0xcf, 0xee, 0x21, 0xe6, 0xcf, 0x83, 0xd5, 0x74, 0xe8, 0xb1, 0x2d, 0xd2, 0x9a, 0x49, 0x18, 0x20, 0xb1, 0x60, 0x40, 0x96, 0xcb, 0x1e, 0x83, 0x2d, 0x13, 0xa0, 0xa0, 0x07, 0x3a, 0x3c, 0x31, 0x85, 0xc4, 0x8b, 0x32, 0xf7, 0x57, 0x01, 0x5c, 0xe9, 0x02, 0x43, 0x70, 0xf5, 0xd1, 0x11, 0xf0, 0x90, 0x08, 0xe6, 0x6c, 0xa3, 0xeb, 0xc2, 0xa4, 0xa1, 0xfc, 0xda, 0x80, 0x02, 0xec, 0x9a, 0x52, 0xa9, 0x51, 0xae, 0x4b, 0x78, 0x40, 0xfa, 0x6e, 0x6d, 0x31, 0x25, 0x04, 0xb6, 0x16, 0x95, 0xae, 0xbe, 0xc7, 0xa2, 0x1c, 0x65, 0x5a, 0xf4, 0xf8, 0x1e, 0xb1, 0x72, 0xd9, 0xb5, 0x42, 0xa6, 0x57, 0x66, 0x2b, 0x63, 0x92, 0x1a, 0xd2, 0x6c, 0x27, 0xc0, 0xc8, 0xc7, 0x49, 0x6b, 0x47, 0x8a, 0x15, 0x79, 0x6b, 0x93, 0x19, 0xab, 0xb2, 0xd5, 0x57, 0xc2, 0x1d, 0x09, 0xca, 0xad, 0x6d, 0x96, 0x43, 0xcb, 0x31, 0xdf, 0x89, 0xa3, 0xfe, 0xa0, 0xc0, 0x1d, 0xc6, 0x78, 0xb4, 0x94, 0x58, 0xfb, 0x13, 0xe6, 0xea, 0x1c, 0x46, 0x80, 0x76, 0x34, 0xff, 0x5e, 0x1a, 0xf1, 0xc6, 0xaf, 0x70, 0x35, 0xb1, 0x8f, 0xde, 0xb5, 0xf4, 0xef, 0x32, 0x42, 0xe1, 0xcf, 0xcd, 0xc3, 0x50, 0x5c, 0x26, 0x41, 0xb3, 0x9f, 0xb6, 0xf1, 0x1f, 0xf7, 0xdc, 0x6b, 0x29, 0xee, 0x7f, 0x19, 0x64, 0x20, 0xae, 0x1d, 0x0a, 0x91, 0x5f, 0x24, 0xf2, 0x0c, 0x44, 0xaa, 0xba, 0x94, 0x0b, 0x9e, 0x20, 0x73, 0xa8, 0x82, 0x8e, 0x1e, 0x13, 0x3a, 0x49, 0x3f, 0x20, 0xef, 0x3e, 0x35, 0xe7, 0x52, 0xdd, 0xb8, 0xf2, 0x17, 0xce, 0x6f, 0x6e, 0xce, 0xa5, 0xa5, 0xa2, 0xdd, 0x60, 0xd7, 0x8a, 0x41, 0xbc, 0xd6, 0x96, 0xe1, 0x77, 0x8a, 0x53, 0x7c, 0x92, 0x19, 0x71, 0x3e, 0x4f, 0x7d, 0x5d, 0x6c, 0x61, 0xad, 0xb4, 0x20, 0x5f, 0x69, 0x96, 0xb2, 0x8a, 0x3a, 0xce, 0xc7, 0x29, 0xfb, 0xc5, 0x7f, 0xd7, 0xbe, 0xb0, 0x74, 0x05, 0x18, 0x06, 0xcc, 0xff, 0xd5, 0xd2, 0x52, 0x49, 0xd7, 0xc8, 0xf1, 0x80, 0xbd, 0x20, 0xcf, 0xfb, 0xe5, 0x16, 0x9e, 0x87, 0xd5, 0x9d, 0xef, 0x16, 0xaf, 0xcf, 0xa7, 0xdf, 0x95, 0xac, 0x0f, 0xc7, 0x85, 0x6a, 0xa7, 0x62, 0x7c, 0xd0, 0x86, 0x32, 0xf7, 0x6e, 0xf8, 0x3b, 0xc9, 0x4c, 0x2b, 0x8d, 0xe3, 0x34, 0x75, 0x86, 0x41, 0x32, 0x01, 0xd4, 0x84, 0x51, 0x86, 0x19, 0x6a, 0xb4, 0x40, 0xf4, 0x23, 0x32, 0xb5, 0x75, 0xf7, 0x17, 0xd0, 0x48, 0x7e, 0xbc, 0xb9, 0xf9, 0xbc, 0x40, 0x5c, 0x0d, 0x5d, 0x0c, 0xb6, 0x41, 0xc8, 0xef, 0x37, 0xa5, 0xad, 0xdb, 0xfd, 0x05, 0xa6, 0x0e, 0x5e, 0x4e, 0xa4, 0xa4, 0x2c, 0x18, 0xeb, 0x8f, 0xac, 0xc4, 0x5b, 0x05, 0x5b, 0x03, 0x0c, 0xef, 0x62, 0x44, 0xd9, 0x92, 0x1d, 0x31, 0x59, 0xe9, 0x17, 0x8d, 0x4f, 0x62, 0x6d, 0x46, 0x06, 0x3e, 0x63, 0xb5, 0x5c, 0xf8, 0x17, 0x37, 0x37, 0x4a, 0x45, 0xdb, 0x62, 0x2e, 0x52, 0x8e, 0xbf, 0xa1, 0x68, 0xc8, 0x30, 0x65, 0x60, 0x1d, 0x31, 0x90, 0x73, 0x7f, 0x82, 0x9a, 0x02, 0xd2, 0x4f, 0x4c, 0xd2, 0xec, 0x85, 0x86, 0xee, 0x5c, 0x99, 0x15, 0x15, 0x94, 0xc0, 0xc2, 0xe9, 0x07, 0x80, 0xa8, 0x10, 0xe7, 0xaf, 0x9a, 0x47, 0x4f, 0xc4, 0xfa, 0x65, 0xc3, 0x1f, 0x7d, 0xc9, 0x94, 0x2e, 0x0c, 0x99, 0xe1, 0xca, 0xc7, 0x7d, 0xb5, 0x40, 0xf7, 0x1e, 0x91, 0xcb, 0x56, 0x73, 0xa3, 0xd7, 0x68, 0x60, 0xfc, 0xa8, 0x36, 0x51, 0x21, 0x50, 0xbf, 0x53, 0xab, 0xf6, 0xd3, 0xd4, 0xff, 0x78, 0xf2, 0xfa, 0x74, 0xfd, 0x5d, 0x53, 0xab, 0x55, 0x4b, 0x4b, 0xc6, 0x43, 0x53, 0x36, 0x57, 0xfb, 0x52, 0xd9, 0xc5, 0xaf, 0x95, 0x1a, 0x06, 0x24, 0xf9, 0x0e, 0x07, 0xfc, 0x19, 0x58, 0x7d, 0xee, 0xe2, 0xae, 0x8a, 0x2b, 0xeb, 0xb3, 0x7b, 0xad, 0x7a, 0x2b, 0xf9, 0xc6, 0xb5, 0x02, 0xbd, 0x55, 0x8e, 0x82, 0x09, 0x61, 0x04, 0xde, 0x48, 0xa9, 0x07, 0x65, 0x10, 0x78, 0xc2, 0x3f, 0x52, 0x9c, 0x00, 0xe9, 0x06, 0x58, 0x92, 0x4c, 0x09, 0x85, 0xcc, 0x0d, 0x75, 0xc2, 0x46, 0x63, 0xca, 0x22, 0x3a, 0x74, 0x6b, 0xe9, 0xe1, 0x53, 0xc2, 0x85, 0xc2, 0xbf, 0x32, 0x7d, 0xcd, 0x0d, 0x37, 0x6d, 0x01, 0x37, 0x31, 0xb3, 0xa8, 0x04, 0x2a, 0x56, 0x68, 0x21, 0x9d, 0x54, 0x73, 0xd7, 0xcc, 0xd0, 0x39, 0x43, 0xad, 0x73, 0xf6, 0xa7, 0x18, 0xac, 0xd8, 0x24, 0x84, 0x82, 0xf4, 0x20, 0xf6, 0x9c, 0x44, 0x0a, 0x72, 0xf2, 0x64, 0x53, 0x63, 0x2f, 0xac, 0xe2, 0x0c, 0xe4, 0xcd, 0x7e, 0xbb, 0xaf, 0x31, 0x13, 0x98, 0x40, 0xc8, 0xb1, 0xf4, 0x0a, 0xf4, 0xa9, 0x4a, 0x22, 0x4c, 0xb8, 0x0b, 0xe3, 0x51, 0x41, 0xd8, 0x52, 0xae, 0x13, 0xc7, 0x7b, 0xad, 0x82, 0x95, 0x50, 0x8e, 0x84, 0x86, 0x68, 0xf0, 0xff, 0xb0, 0xfd, 0xc2, 0x0d, 0x59, 0x6d, 0x27, 0x78, 0xc8, 0x0a, 0x8c, 0x1a, 0x65, 0x37, 0xa5, 0x0d, 0x94, 0xb2, 0x18, 0xe5, 0x66, 0x00, 0xdd, 0x1f, 0x66, 0xd0, 0x64, 0x1b, 0x47, 0xe6, 0xee, 0x11, 0xd1, 0x40, 0xd1, 0x5d, 0x8e, 0xf5, 0x5c, 0x23, 0x86, 0xfb, 0x2d, 0x19, 0x20, 0x0a, 0xb5, 0x41, 0x0a, 0x24, 0xe7, 0x53, 0xbf, 0x00, 0x61, 0x4e, 0xa6, 0xd2, 0x28, 0x9d, 0x79, 0x85, 0x14, 0x8e, 0xef, 0x40, 0x2f, 0x49, 0x28, 0xf8, 0x42, 0x8b, 0x5f, 0xf2, 0x10, 0x41, 0x1f, 0xe5, 0x91, 0x50, 0x18, 0x11, 0x49, 0xc5, 0x72, 0x23, 0xca, 0xed, 0x5d, 0xa1, 0xb0, 0x59, 0xbf, 0xb9, 0xab, 0xb7, 0x0a, 0x6b, 0x93, 0x2f, 0xe3, 0x4f, 0xb9, 0x3c, 0x91, 0x45, 0x7f, 0x42, 0x19, 0xb6, 0x17, 0x78, 0xec, 0x85, 0xfb, 0x22, 0x6f, 0xaa, 0xdc, 0x8f, 0x8a, 0x53, 0x04, 0x73, 0xb0, 0x05, 0x85, 0x41, 0xd6, 0x17, 0xc6, 0x1f, 0x91, 0xa9, 0x4e, 0x94, 0xcc, 0xd2, 0xd4, 0xf4, 0x59, 0x6a, 0xe2, 0xb3, 0x90, 0x96, 0x35, 0x31, 0xd8, 0x1f, 0x0f, 0xc4, 0x6b, 0x3c, 0x2a, 0xc1, 0xc7, 0x3d, 0xf8, 0x3d, 0xad, 0xef, 0xf3, 0x44, 0x20, 0xcd, 0x8d, 0xc9, 0x0e, 0x09, 0x9c, 0x50, 0x84, 0x1a, 0xbe, 0x70, 0x3f, 0xd5, 0x42, 0xd2, 0x81, 0xa1, 0xe3, 0x1e, 0x5b, 0x76, 0x18, 0xd1, 0x0c, 0x9f, 0x4e, 0xe9, 0xb8, 0xd1, 0xd8, 0x16, 0x5f, 0x24, 0x76, 0xc8, 0xaf, 0xd1, 0x56, 0x79, 0xa8, 0x99, 0x57, 0x3e, 0x08, 0xfa, 0x82, 0xf9, 0x55, 0x81, 0xc1, 0x9a, 0xee, 0xd5, 0xe6, 0xaa, 0x5f, 0x69, 0x8a, 0xcf, 0x4b, 0x62, 0x2c, 0x14, 0xc5, 0xa3, 0x3a, 0x60, 0xd1, 0xfc, 0xb4, 0x0c, 0x55, 0x7f, 0xe1, 0x3e, 0xcb, 0xc9, 0xb6, 0xea, 0x60, 0xd4, 0xb1, 0x99, 0x82, 0x44, 0xa0, 0x95, 0x62, 0x93, 0xa5, 0xa3, 0x98, 0xa3, 0x42, 0x77, 0xcd, 0x62, 0x0a, 0x87, 0xd3, 0xd2, 0x02, 0x15, 0xf9, 0x1b, 0x2f, 0xf0, 0x08, 0xb6, 0x0e, 0x24, 0x6c, 0x06, 0xd7, 0x48, 0xd9, 0x44, 0xa2, 0x74, 0x9d, 0x59, 0x0a, 0x30, 0x5a, 0x9f, 0x5a, 0x7b, 0xc8, 0x27, 0x0b, 0x9d, 0x27, 0xd2, 0x56, 0xaa, 0x8f, 0xcd, 0x0e, 0x50, 0xe6, 0xb2, 0x71, 0x29, 0xa5, 0x21, 0xe6, 0x0a, 0xb7, 0x62, 0xed, 0x60, 0x14, 0x97, 0x19, 0x9a, 0x60, 0x7b, 0xd6, 0xa7, 0x34, 0xca, 0x8a, 0x60, 0x18, 0x62, 0xfa, 0xa0, 0x45, 0xf7, 0x4a, 0xeb, 0x45, 0xff, 0x69, 0x4f, 0xb8, 0xb1, 0x29, 0xbe, 0x03, 0x2d, 0xc5, 0xe8, 0xe2, 0x36, 0xf4, 0x23, 0x4c, 0x50, 0x11, 0x2c, 0x2d, 0x8d, 0x30, 0x2d, 0x03, 0x01, 0x81, 0xe1, 0x1a, 0xa4, 0xa0, 0xea, 0xa7, 0x36, 0xba, 0xc3, 0xf9, 0x01, 0xfc, 0xd3, 0x72, 0x29, 0xc8, 0xbd, 0x80, 0x9f, 0x18, 0x7c, 0x87, 0x09, 0x71, 0xd9, 0x5e, 0x0e, 0xea, 0xc6, 0xc6, 0x35, 0x3e, 0xf9, 0x47, 0x8c, 0x8a, 0x22, 0x9b, 0x35, 0x47, 0x84, 0x6f, 0x97, 0xd7, 0x4e, 0x31, 0x9d, 0x9c, 0x39, 0x4e, 0x32, 0x71, 0x1e, 0xe5, 0x8a, 0x6b, 0x9e, 0xf4, 0x1f, 0xa0, 0x31, 0x57, 0x90, 0x4f, 0x0d, 0x3e, 0xb0, 0xc4, 0x29, 0xe9, 0x0a, 0x7a, 0xc5, 0xa0, 0xfd, 0xad, 0xcb, 0x5d, 0x9d, 0xb7, 0x4a, 0x1f, 0xad, 0xf5, 0xfd, 0x8d, 0xbe, 0x8b, 0x39, 0x1f, 0x97, 0x96, 0x40, 0x80, 0x6e, 0xb9, 0xb9, 0x8f, 0x5e, 0x7f, 0x2c, 0x34, 0xc9, 0xa9, 0xec, 0x19, 0x3d, 0x95, 0x5d, 0x65, 0xf8, 0x3d, 0xca, 0x91, 0x79, 0xe1, 0x97, 0xb9, 0xf4, 0x86, 0x54, 0xa0, 0x89, 0x4d, 0x93, 0x52, 0x81, 0x35, 0x46, 0xb3, 0x3c, 0xa3, 0x98, 0x43, 0x31, 0x45, 0x53, 0xb0, 0x69, 0x5a, 0x86, 0xb0, 0xed, 0x8f, 0x0b, 0xcb, 0x6c, 0x2b, 0x19, 0x65, 0x49, 0x57, 0x65, 0xc8, 0x18, 0xda, 0x4c, 0xae, 0xe7, 0x34, 0xea, 0x56, 0x56, 0xf3, 0xe7, 0xc4, 0x3d, 0x81, 0x3d, 0xef, 0x54, 0x6c, 0x7a, 0xca, 0x62, 0xcf, 0x92, 0x76, 0x84, 0xe9, 0x89, 0x31, 0x55, 0x3b, 0x68, 0x38, 0xa6, 0x8d, 0xcc, 0x70, 0x9c, 0x5d, 0x58, 0xd3, 0x2e, 0xb3, 0x91, 0x56, 0xa6, 0x22, 0xe3, 0x68, 0x48, 0x8e, 0x30, 0x9a, 0xc2, 0x16, 0x9a, 0xf8, 0xd0, 0xd5, 0x73, 0x17, 0x89, 0x99, 0x1c, 0x35, 0xbd, 0x6a, 0xd8, 0x7f, 0xa4, 0x75, 0xd6, 0x58, 0xe9, 0xc3, 0x91, 0xd6, 0x5b, 0x65, 0x62, 0xce, 0xa9, 0x4a, 0xab, 0xc4, 0x30, 0x97, 0xf7, 0x42, 0x81, 0x2c, 0x99, 0xce, 0x49, 0x3c, 0x23, 0x5d, 0x37, 0x79, 0x9e, 0x44, 0xf0, 0x0d, 0x13, 0x24, 0xd3, 0x4f, 0xd7, 0x45, 0xd3, 0xa3, 0xe8, 0x16, 0x69, 0x11, 0x4f, 0xdd, 0x13, 0x54, 0x61, 0xf1, 0xd0, 0xc5, 0xa3, 0x23, 0x71, 0x54, 0x5d, 0xde, 0x26, 0xae, 0x32, 0x21, 0x24, 0x4c, 0x70, 0xfa, 0x96, 0x62, 0xf9, 0xd2, 0x9c, 0xc0, 0x9b, 0xf4, 0xd7, 0x5c, 0xc0, 0x3f, 0x25, 0x95, 0x70, 0x90, 0xfa, 0xc8, 0x29, 0x4d, 0xb9, 0x35, 0x2e, 0xe0, 0x76, 0xb4, 0xda, 0xfb, 0x4a, 0xc0, 0x34, 0x20, 0x42, 0xfb, 0x06, 0xc1, 0x18, 0x64, 0xb0, 0xe0, 0xd6, 0x64, 0x37, 0x44, 0x8b, 0x64, 0xde, 0xce, 0xa5, 0x68, 0xb8, 0x9b, 0x14, 0xe9, 0xdb, 0x88, 0x5f, 0x62, 0x3e, 0x11, 0xed, 0xe1, 0x20, 0x3e, 0x1d, 0xa7, 0x2e, 0xa6, 0xfe, 0x96, 0x24, 0xfc, 0x63, 0xa2, 0x63, 0x4d, 0xcb, 0x7c, 0xdd, 0x98, 0x52, 0x69, 0x61, 0x95, 0x70, 0x01, 0xdc, 0xbb, 0xb1, 0x72, 0x26, 0x12, 0xb2, 0x35, 0x4a, 0xb2, 0x70, 0x22, 0x4d, 0x7e, 0x98, 0xf9, 0x0d, 0x97, 0xa7, 0xda, 0xe0, 0xd1, 0x14, 0x5a, 0xd5, 0xdb, 0x5c, 0x51, 0x44, 0xec, 0xd1, 0x19, 0x0b, 0x0d, 0x3f, 0x04, 0xb7, 0xa3, 0xdb, 0xec, 0x34, 0x51, 0xae, 0xcb, 0x47, 0x20, 0xea, 0xbe, 0x39, 0xdc, 0x45, 0xe5, 0x46, 0x7a, 0x2e, 0x5c, 0x5e, 0x5e, 0x36, 0x2f, 0x1f, 0x35, 0xd3, 0xac, 0xbf, 0xf2, 0x70, 0x75, 0x75, 0x75, 0x25, 0xbf, 0xe8, 0x1b, 0x4e, 0x07, 0x3d, 0x6c, 0x02, 0x94, 0x88, 0xce, 0x8c, 0xfb, 0xcb, 0xcd, 0x4d, 0xa7, 0xd9, 0x19, 0x17, 0x45, 0x8a, 0xbe, 0xae, 0xab, 0xf8, 0x34, 0xe4, 0x45, 0xf0, 0x92, 0x4f, 0xf0, 0x67, 0x10, 0x17, 0xf2, 0x57, 0xb7, 0xc8, 0x62, 0xf9, 0x93, 0xac, 0xc9, 0xf0, 0xdb, 0xf6, 0x58, 0x38, 0xf3, 0x3b, 0x15, 0xdf, 0x60, 0x34, 0x69, 0x84, 0xee, 0xa6, 0xbf, 0xb1, 0x69, 0x9e, 0x5b, 0xa2, 0xfb, 0xd4, 0xd2, 0xd2, 0x66, 0xe9, 0xf3, 0x6e, 0x85, 0x9e, 0xe0, 0x80, 0x36, 0x85, 0x9d, 0x68, 0xe1, 0x0c, 0x76, 0xed, 0xa5, 0xa5, 0x85, 0x33, 0x94, 0x56, 0x8d, 0xd0, 0x41, 0x71, 0xd5, 0x86, 0xdd, 0xf9, 0xc0, 0xef, 0xbb, 0x67, 0xb0, 0xe4, 0xfd, 0x41, 0xfb, 0x8c, 0x2c, 0x81, 0x84, 0xca, 0xb7, 0x40, 0x98, 0xe2, 0x11, 0xdb, 0x73, 0xf1, 0x9b, 0x70, 0xbf, 0x36, 0xbe, 0x4a, 0x7f, 0xec, 0x9b, 0x9b, 0x85, 0x71, 0x4d, 0x5f, 0xb4, 0x88, 0xaa, 0x9d, 0x4d, 0x7c, 0xf7, 0x0c, 0x09, 0xcb, 0x28, 0x07, 0x3b, 0x31, 0xf9, 0xeb, 0x37, 0x2a, 0x61, 0x31, 0xd0, 0x6d, 0xb5, 0x49, 0x8c, 0x75, 0x17, 0xf7, 0x7e, 0xdc, 0xdc, 0x4c, 0x96, 0x96, 0x26, 0x86, 0xcf, 0x3f, 0xbf, 0x42, 0xb1, 0x13, 0xb6, 0xe9, 0x4a, 0x87, 0x97, 0x30, 0x2c, 0x65, 0x3b, 0x1d, 0x33, 0x4d, 0xdb, 0x38, 0x08, 0xa0, 0x01, 0xaf, 0xa5, 0xbf, 0x09, 0xbc, 0xb9, 0x97, 0x4d, 0x71, 0xc2, 0x01, 0x13, 0x2a, 0xa9, 0x5a, 0xed, 0xc2, 0xf2, 0xc3, 0xcd, 0x0d, 0xec, 0x58, 0x97, 0x5a, 0x4b, 0x80, 0x81, 0x97, 0x0f, 0x15, 0xe7, 0x11, 0xe3, 0xac, 0x25, 0xae, 0xf8, 0x8f, 0x28, 0x28, 0x4f, 0xce, 0xd8, 0xa5, 0xc1, 0xf1, 0x46, 0x48, 0x6a, 0x8a, 0x26, 0x90, 0xee, 0xc4, 0x64, 0x5a, 0x43, 0x12, 0x96, 0xa8, 0x33, 0xb6, 0x88, 0x19, 0x11, 0x95, 0x2d, 0xc3, 0x1d, 0x6b, 0x20, 0x1e, 0x8c, 0xa5, 0xc2, 0x02, 0x3f, 0x84, 0x61, 0x76, 0xe2, 0x0f, 0x2a, 0x38, 0x97, 0x73, 0xb3, 0xde, 0x69, 0xda, 0xde, 0x66, 0xb8, 0xbc, 0xdc, 0x45, 0x54, 0xf8, 0x95, 0x03, 0x98, 0xd6, 0x12, 0x07, 0x95, 0xb9, 0x90, 0xef, 0x1b, 0x9e, 0x56, 0xf0, 0xab, 0x25, 0x92, 0x54, 0x7c, 0x69, 0x28, 0x15, 0x69, 0xd2, 0xfe, 0xe9, 0xe8, 0xf5, 0x2b, 0x01, 0xb4, 0x3b, 0xf1, 0xca, 0x04, 0xe9, 0x65, 0xb8, 0xdb, 0xfd, 0xc7, 0x8f, 0x41, 0x39, 0xc6, 0xa8, 0x41, 0xfb, 0x19, 0x9b, 0x56, 0xb1, 0xa8, 0x69, 0x1a, 0x6c, 0x60, 0xea, 0xab, 0x28, 0xd0, 0x57, 0xc8, 0xa0, 0x0f, 0x37, 0x48, 0x68, 0x39, 0x0c, 0xc5, 0x88, 0x06, 0x23, 0x40, 0x62, 0xc0, 0xe3, 0x71, 0x34, 0xc4, 0x34, 0x0c, 0xe8, 0x1e, 0x3a, 0x17, 0x30, 0x47, 0xa4, 0x6b, 0xb4, 0xe1, 0xc3, 0x0c, 0x67, 0x98, 0x8a, 0xf2, 0x76, 0x38, 0x33, 0x1f, 0xf6, 0x14, 0xd5, 0x87, 0xb0, 0xfc, 0x7c, 0x0d, 0xe4, 0x2c, 0xf4, 0x07, 0x53, 0xf6, 0x70, 0xd5, 0xf4, 0x15, 0xe8, 0xce, 0xe5, 0x5b, 0x0a, 0x9f, 0xc8, 0x2d, 0x91, 0xf7, 0x90, 0x55, 0x0a, 0xf5, 0xb6, 0xa5, 0x25, 0xe3, 0xa1, 0x32, 0x9d, 0xa8, 0xab, 0x04, 0xd2, 0x67, 0xb7, 0x6d, 0x16, 0xb3, 0xa1, 0x33, 0x8b, 0xb5, 0x3a, 0x8a, 0x69, 0xd8, 0x65, 0xd4, 0x77, 0x7b, 0x76, 0xe9, 0xc1, 0x3a, 0xa0, 0x44, 0xf6, 0x9c, 0x03, 0x7f, 0x16, 0xe5, 0x57, 0x1a, 0xfa, 0x5c, 0x74, 0xac, 0x8f, 0x4e, 0xce, 0xd8, 0x2b, 0x71, 0x74, 0x77, 0x76, 0xd7, 0x72, 0xf0, 0x98, 0xdd, 0xba, 0x0e, 0x19, 0x98, 0x12, 0x8e, 0x24, 0xa0, 0xc0, 0xc0, 0x07, 0x69, 0x68, 0x33, 0x56, 0xc4, 0xf3, 0xc1, 0xeb, 0xa3, 0xe3, 0xc6, 0xac, 0xe9, 0x08, 0xb3, 0x92, 0x38, 0xf8, 0xcd, 0xc1, 0x71, 0xe7, 0x0e, 0xa8, 0xc1, 0xca, 0xd0, 0xc6, 0x43, 0x7c, 0xe7, 0x6c, 0x12, 0xec, 0xa5, 0x45, 0x69, 0xe0, 0xff, 0x98, 0x90, 0x78, 0x70, 0x46, 0x60, 0x0f, 0xbc, 0xeb, 0xd9, 0x45, 0xb8, 0x6e, 0x8e, 0x72, 0x07, 0x1a, 0xc6, 0x18, 0x1c, 0x0d, 0x23, 0x33, 0x90, 0xef, 0xad, 0x0f, 0x44, 0xec, 0xcd, 0x75, 0x06, 0x72, 0x4f, 0x4f, 0x23, 0x7c, 0xca, 0xf4, 0x88, 0x38, 0x90, 0x83, 0xbc, 0xa3, 0x48, 0xe4, 0xe0, 0x01, 0x0c, 0xac, 0x20, 0xb4, 0xcb, 0xa8, 0x50, 0x34, 0xda, 0x63, 0xc5, 0x03, 0x8f, 0x0c, 0xc7, 0x30, 0xe0, 0x87, 0x20, 0xbc, 0x0d, 0x45, 0xd2, 0x1c, 0x91, 0xe5, 0x44, 0xf4, 0x89, 0xf9, 0x6a, 0x34, 0x17, 0x9d, 0x91, 0x3d, 0x54, 0xe1, 0x91, 0xc7, 0x30, 0x2b, 0xf8, 0x2d, 0x05, 0x8d, 0x54, 0x27, 0x47, 0xa8, 0xf2, 0xe4, 0x79, 0x74, 0x21, 0xae, 0x30, 0xba, 0xad, 0x79, 0x9d, 0x5b, 0x65, 0x78, 0xff, 0x3a, 0x46, 0x36, 0x93, 0x6a, 0xb5, 0x5b, 0xeb, 0xc9, 0xf1, 0xb2, 0xae, 0xc7, 0x76, 0xe4, 0xd2, 0xd4, 0xa5, 0xeb, 0x04, 0xab, 0x79, 0x63, 0xaf, 0x2d, 0x6b, 0x0e, 0xdf, 0x80, 0xa2, 0xb6, 0x6c, 0x39, 0xe8, 0xbb, 0x4a, 0x5a, 0x43, 0xf5, 0xee, 0x2a, 0x5d, 0x0e, 0x70, 0x6a, 0x06, 0xc2, 0xfe, 0x6a, 0x29, 0x89, 0x96, 0xff, 0x69, 0x75, 0x47, 0xd4, 0xfb, 0x9e, 0xf6, 0x4b, 0x44, 0xf7, 0xd0, 0x15, 0x46, 0xae, 0x90, 0xd5, 0xc2, 0xd2, 0x8a, 0x16, 0xf9, 0x5f, 0xec, 0x25, 0xbb, 0xb4, 0x64, 0x46, 0xef, 0xd7, 0x15, 0xf4, 0x4a, 0x5d, 0x74, 0x4d, 0xf9, 0xe4, 0xd5, 0x95, 0x53, 0xe6, 0x2a, 0xa1, 0x2b, 0x24, 0x33, 0x30, 0x92, 0x6d, 0x4f, 0x6c, 0x56, 0xd1, 0x74, 0x0a, 0xb2, 0xe9, 0x96, 0xe1, 0xb0, 0x02, 0xea, 0x08, 0x6a, 0x3a, 0xa0, 0x44, 0xa1, 0x1a, 0xa0, 0xda, 0xd0, 0x1b, 0x64, 0xa4, 0x36, 0xc2, 0x58, 0xb6, 0x10, 0x4c, 0x81, 0xfd, 0xb6, 0x6f, 0x73, 0x59, 0x3e, 0xc0, 0x0b, 0xbe, 0x18, 0x1e, 0xf3, 0x79, 0x55, 0x70, 0xd1, 0x90, 0x2c, 0x0a, 0x05, 0xa2, 0x00, 0x03, 0x51, 0x3d, 0xe4, 0x33, 0xae, 0x1a, 0x75, 0x23, 0xd0, 0x8e, 0x83, 0x1e, 0x28, 0x3b, 0x0c, 0x3d, 0x86, 0xd1, 0x22, 0x19, 0x15, 0xad, 0xc4, 0xdf, 0x00, 0x0d, 0x42, 0x54, 0xc1, 0x4c, 0x40, 0x23, 0x21, 0x07, 0xb0, 0xf3, 0x04, 0x5d, 0xc4, 0xc4, 0xa9, 0x03, 0xe6, 0x5e, 0x7e, 0xaa, 0x82, 0x08, 0x16, 0x72, 0x6d, 0xe2, 0x8e, 0xbc, 0x75, 0x2d, 0x90, 0x17, 0x1a, 0x29, 0x46, 0x01, 0xa9, 0x49, 0xb1, 0x6b, 0x31, 0x7a, 0xad, 0x45, 0x4d, 0x71, 0x9d, 0x49, 0x0d, 0x07, 0x25, 0x7f, 0xb5, 0xbd, 0x31, 0xde, 0xe4, 0x57, 0xa8, 0x34, 0x47, 0x40, 0x93, 0xc9, 0x79, 0x0e, 0xcf, 0x82, 0xcf, 0x6f, 0xa1, 0x2e, 0xce, 0x2d, 0x03, 0x99, 0x27, 0x55, 0xa2, 0xeb, 0x7e, 0x8a, 0x83, 0x98, 0xf5, 0x62, 0x06, 0xfc, 0x98, 0xc7, 0x35, 0x39, 0xde, 0xdf, 0xc5, 0xbd, 0x29, 0x5e, 0x88, 0xc5, 0x23, 0xff, 0xd8, 0x6d, 0x3c, 0x0d, 0x36, 0x1a, 0xa6, 0x0b, 0x37, 0xe5, 0x77, 0xe5, 0x3e, 0xe8, 0xaf, 0xd7, 0x51, 0x82, 0xfd, 0x5e, 0xf0, 0x6d, 0x91, 0x18, 0x4b, 0x3d, 0x36, 0x98, 0xf5, 0x5a, 0xbe, 0x9c, 0x32, 0x95, 0xb7, 0xfe, 0x04, 0x34, 0x59, 0x9f, 0x72, 0x31, 0x9e, 0x34, 0x50, 0x4e, 0x46, 0x16, 0x29, 0xd0, 0xa9, 0xf2, 0x73, 0x35, 0x8c, 0x06, 0x28, 0x07, 0x94, 0xfd, 0x8c, 0x89, 0x97, 0x4e, 0x31, 0xae, 0xec, 0x63, 0x22, 0xd5, 0x6b, 0x6c, 0x06, 0x5d, 0xc8, 0xf6, 0x29, 0xd7, 0x7b, 0xe4, 0x7f, 0x42, 0x93, 0xa7, 0x3a, 0x95, 0xd7, 0xc9, 0x4c, 0x65, 0x04, 0x5e, 0x50, 0x8d, 0xf8, 0x38, 0x01, 0x69, 0x6d, 0x61, 0xed, 0x54, 0x87, 0xbe, 0xf7, 0x0b, 0x37, 0x50, 0x22, 0x35, 0xb9, 0x56, 0x0b, 0x6f, 0xa1, 0x6a, 0x7c, 0x71, 0xe8, 0x6b, 0xb2, 0x72, 0xfb, 0xca, 0x90, 0x4a, 0xd2, 0x49, 0x45, 0x66, 0x55, 0x11, 0x15, 0x30, 0x6f, 0x49, 0xd8, 0xc6, 0x68, 0xa1, 0xb0, 0x15, 0x9a, 0x3b, 0x6a, 0xf6, 0x00, 0x17, 0xfe, 0xcd, 0x4d, 0x88, 0xe9, 0x92, 0x18, 0x15, 0x38, 0xd5, 0xa6, 0x4d, 0x31, 0x06, 0x9c, 0x90, 0xc0, 0xe7, 0x51, 0xb9, 0xaa, 0xae, 0x60, 0x0d, 0x30, 0x98, 0x86, 0x42, 0x98, 0x11, 0x10, 0x05, 0x96, 0x91, 0x0b, 0x2d, 0x35, 0xe4, 0x9f, 0x50, 0x77, 0xe0, 0x4f, 0xf2, 0xa4, 0xb0, 0x00, 0x44, 0xbd, 0x89, 0xca, 0xdd, 0xaf, 0x0c, 0x63, 0x2a, 0x98, 0xdd, 0xb5, 0x9c, 0xf5, 0x45, 0x38, 0xfd, 0xd2, 0xd2, 0xf5, 0x89, 0xfc, 0x79, 0x8a, 0x7b, 0x01, 0xc3, 0x5b, 0x70, 0xcc, 0x09, 0x82, 0xb7, 0xb1, 0x8b, 0xf8, 0xc2, 0x2f, 0xd6, 0x7b, 0xf9, 0x1a, 0x33, 0x70, 0x96, 0xa1, 0xf9, 0x98, 0x32, 0x12, 0xa8, 0xb8, 0x85, 0xee, 0x0f, 0xbc, 0x68, 0x04, 0x59, 0x14, 0x2c, 0xcb, 0x20, 0xd2, 0x86, 0xe5, 0xe8, 0x70, 0xb2, 0x76, 0xda, 0x6e, 0x8c, 0x82, 0x3e, 0x6f, 0x28, 0xf9, 0x77, 0x2a, 0xee, 0x10, 0x08, 0xf0, 0xca, 0x39, 0xa2, 0xd8, 0x02, 0x29, 0xf6, 0xbb, 0xa7, 0x61, 0x74, 0x21, 0xc6, 0x00, 0x52, 0x5e, 0xcc, 0xaf, 0x1c, 0xfc, 0x67, 0xb9, 0x9b, 0xc6, 0x4e, 0x54, 0xf0, 0x61, 0xbe, 0xdc, 0x45, 0x51, 0x2e, 0x73, 0x06, 0xcb, 0x22, 0xd9, 0x9f, 0x33, 0x2a, 0x96, 0xd7, 0x56, 0x9d, 0x4e, 0x7f, 0x19, 0x75, 0x9b, 0x65, 0xd0, 0x63, 0x9d, 0xc6, 0xc6, 0xd3, 0xc1, 0x9a, 0x6a, 0x02, 0x83, 0x81, 0x96, 0xaf, 0x62, 0x90, 0x49, 0x92, 0x62, 0xb9, 0x93, 0xc6, 0xa1, 0x73, 0xb9, 0x8c, 0xa9, 0x02, 0x9d, 0x61, 0x70, 0xb5, 0x7c, 0xb9, 0xfc, 0x04, 0x3e, 0x8d, 0xe2, 0xe5, 0x35, 0x67, 0xd4, 0x59, 0x7e, 0xdc, 0xd8, 0x00, 0xc5, 0xbf, 0x9f, 0xa6, 0xce, 0x36, 0xf4, 0x11, 0x8c, 0xb3, 0xc8, 0xd9, 0x0e, 0xb2, 0x0e, 0x2c, 0x9b, 0xa7, 0xa0, 0x3c, 0x27, 0xb2, 0x45, 0x6a, 0x30, 0xe8, 0x22, 0x18, 0x1b, 0xef, 0x9f, 0xae, 0xe0, 0x97, 0x0d, 0x67, 0x2b, 0xea, 0x1f, 0x03, 0x34, 0xc7, 0xbc, 0x3b, 0x70, 0x8e, 0x76, 0x8e, 0x9c, 0x87, 0xcd, 0x55, 0xab, 0x92, 0x00, 0x23, 0x1f, 0x3a, 0xf4, 0x97, 0x20, 0x95, 0x59, 0x86, 0x56, 0x7e, 0xbf, 0xda, 0xd8, 0xe8, 0xf6, 0x2e, 0x9d, 0xb5, 0xe6, 0x6a, 0x73, 0x4d, 0xb6, 0xf7, 0x74, 0x65, 0xb0, 0xb6, 0x61, 0x22, 0xa2, 0x08, 0x3a, 0xb9, 0x83, 0xff, 0x2c, 0xc7, 0xa0, 0x48, 0xcf, 0x0c, 0x01, 0x46, 0xbc, 0x02, 0xa5, 0xad, 0x2a, 0x33, 0xc3, 0x54, 0x28, 0x5a, 0x03, 0x14, 0x75, 0xd2, 0x2c, 0xe4, 0x99, 0x78, 0x7e, 0x04, 0xcf, 0xa3, 0xe5, 0x1f, 0x1a, 0x1b, 0xdf, 0x99, 0xd7, 0x28, 0x46, 0xe6, 0x6e, 0x48, 0x0b, 0x92, 0xfc, 0x96, 0xb5, 0x17, 0x50, 0xa1, 0xd7, 0x8b, 0xf6, 0xbf, 0x45, 0x51, 0x6b, 0xa5, 0x71, 0x73, 0x23, 0x7e, 0x20, 0x49, 0xe2, 0x35, 0x86, 0x91, 0x7a, 0x1d, 0x99, 0xaf, 0xe9, 0x26, 0x80, 0x64, 0x3a, 0xb3, 0x48, 0x12, 0xbf, 0x88, 0x28, 0x35, 0x7e, 0x62, 0xc4, 0x08, 0x32, 0xb4, 0x85, 0x98, 0xd9, 0xd4, 0xd0, 0x83, 0xcd, 0xcc, 0x18, 0x26, 0x21, 0x48, 0xdd, 0x98, 0xbd, 0x70, 0x0f, 0x60, 0x49, 0xe1, 0xca, 0x69, 0xe9, 0xce, 0xca, 0x65, 0xa1, 0x49, 0xf2, 0x03, 0x20, 0xd3, 0x59, 0xbc, 0x06, 0x0d, 0x5a, 0x15, 0xf2, 0xda, 0x88, 0xe5, 0x65, 0xc9, 0xef, 0xf0, 0x38, 0xeb, 0x83, 0x61, 0xa4, 0x6e, 0x1c, 0x89, 0x52, 0x40, 0xb4, 0xc2, 0xc8, 0x3f, 0xdb, 0x17, 0x2f, 0xf0, 0x58, 0xf9, 0xce, 0xde, 0x54, 0xb1, 0xbb, 0xfa, 0x53, 0xe5, 0xe6, 0xf7, 0x18, 0xa7, 0x77, 0xf6, 0x46, 0x45, 0xee, 0xe8, 0x69, 0x2f, 0xbd, 0xb5, 0x97, 0x7c, 0x92, 0x0f, 0x78, 0x10, 0x17, 0x83, 0xbb, 0x06, 0xa6, 0xcb, 0xdd, 0x35, 0xb2, 0x49, 0xee, 0xbc, 0x10, 0x25, 0xe7, 0xf7, 0x2a, 0x6e, 0x8f, 0xb8, 0xa3, 0x4b, 0x59, 0xe8, 0x8e, 0xfe, 0xde, 0x88, 0x52, 0xf3, 0xfb, 0x0a, 0x3a, 0x94, 0x30, 0xf0, 0xd6, 0xae, 0x44, 0x99, 0x3b, 0x7a, 0xda, 0xa4, 0x42, 0x46, 0x47, 0x01, 0xab, 0xd8, 0x8f, 0x59, 0xa2, 0xb9, 0x5d, 0x22, 0xf6, 0xe7, 0x72, 0xc5, 0x76, 0x83, 0x2c, 0x84, 0xcd, 0x9a, 0x45, 0x82, 0x0d, 0x8e, 0x36, 0xf0, 0xe4, 0x09, 0x48, 0xc0, 0x51, 0x24, 0xd3, 0x6c, 0xda, 0x3c, 0x25, 0x96, 0xdf, 0xe5, 0xdf, 0xe5, 0x7c, 0x44, 0x79, 0xcc, 0xf4, 0xb3, 0xe0, 0x0b, 0xc4, 0x50, 0x9a, 0xdf, 0xc1, 0x86, 0x8a, 0xed, 0x7e, 0x78, 0x4a, 0x7c, 0x62, 0xf0, 0xd0, 0x62, 0x4c, 0x71, 0xdf, 0xe0, 0x8f, 0x43, 0xe2, 0x84, 0xef, 0xa2, 0x5e, 0xe4, 0x28, 0x22, 0x04, 0x7e, 0xf4, 0xf0, 0xee, 0x4a, 0xce, 0x10, 0x59, 0x71, 0x63, 0xe3, 0x19, 0xbf, 0x00, 0x39, 0xac, 0x52, 0xb9, 0x17, 0xf1, 0x38, 0xcc, 0x15, 0x8a, 0x7d, 0xf5, 0xb8, 0xf1, 0x14, 0x38, 0x2e, 0xec, 0xab, 0x95, 0xd7, 0xcb, 0xe2, 0xed, 0x3c, 0x7e, 0xbc, 0x7b, 0xe0, 0x6c, 0x86, 0x80, 0xd0, 0x1c, 0x1a, 0x97, 0x25, 0x9f, 0x52, 0xaa, 0x49, 0x4a, 0x76, 0x49, 0x2c, 0xda, 0x89, 0x42, 0x9f, 0x53, 0xed, 0x68, 0xe4, 0x90, 0xec, 0x39, 0x00, 0x38, 0x79, 0xe6, 0x5f, 0x5d, 0x5d, 0x35, 0x8d, 0xff, 0xcb, 0x8e, 0xa9, 0x36, 0x60, 0xab, 0x84, 0xeb, 0xeb, 0x00, 0xde, 0x4f, 0x2f, 0x50, 0xf3, 0x80, 0xc1, 0x27, 0x39, 0x68, 0xc1, 0xd2, 0xc2, 0x51, 0x0b, 0xa5, 0x70, 0x6e, 0x41, 0x38, 0x0b, 0x51, 0xca, 0x19, 0x46, 0xe4, 0xf1, 0x8e, 0x3c, 0xdb, 0x07, 0xae, 0x0c, 0xbf, 0x40, 0x67, 0x19, 0xd1, 0x2b, 0x0b, 0xca, 0x91, 0x7c, 0x8c, 0x83, 0x0e, 0x8f, 0x37, 0xe8, 0xae, 0x3a, 0x74, 0x2f, 0x18, 0x46, 0x71, 0x1c, 0xe5, 0x20, 0xd4, 0x24, 0x61, 0xee, 0x74, 0x78, 0x71, 0x89, 0xdb, 0x23, 0xe6, 0x10, 0x45, 0x22, 0xa1, 0xe4, 0xc2, 0xc5, 0x80, 0x3b, 0xa8, 0x11, 0x11, 0x88, 0xb9, 0x00, 0xd1, 0x7d, 0xba, 0xb0, 0x91, 0x7b, 0x4f, 0x57, 0x46, 0xdf, 0x60, 0xf4, 0x3b, 0xc8, 0xb2, 0x9d, 0xbd, 0x60, 0xc2, 0xef, 0x3b, 0x74, 0x62, 0xf2, 0x54, 0xe1, 0xb8, 0x06, 0x09, 0x3f, 0xdc, 0x1b, 0x09, 0xaa, 0x76, 0x15, 0x0d, 0x68, 0x8a, 0xa0, 0x3e, 0x9c, 0x98, 0xa0, 0xfa, 0x96, 0xa3, 0x3d, 0x42, 0x11, 0xd0, 0x39, 0x00, 0x29, 0xac, 0xb8, 0xe7, 0x68, 0x49, 0x68, 0xa4, 0x0a, 0x95, 0xd1, 0xd6, 0x0d, 0xf7, 0xce, 0xf1, 0xce, 0x0c, 0xb6, 0x48, 0x9d, 0xcb, 0x20, 0x02, 0x59, 0xb9, 0x27, 0x03, 0x20, 0x12, 0x92, 0x1c, 0x41, 0x4e, 0x75, 0x84, 0x96, 0xe0, 0x50, 0xa6, 0x64, 0x24, 0x87, 0x11, 0x5e, 0x55, 0xe2, 0xa0, 0x95, 0x3f, 0x8a, 0x03, 0x22, 0x87, 0x6c, 0x9c, 0x20, 0x40, 0xdf, 0x12, 0x41, 0x07, 0xaa, 0x93, 0x43, 0x6a, 0xbb, 0x44, 0x0e, 0x8d, 0x41, 0xb3, 0x31, 0xf1, 0x30, 0xce, 0x80, 0x1a, 0x97, 0x65, 0x9a, 0xd6, 0x86, 0x85, 0x40, 0x4a, 0xd7, 0xdc, 0x49, 0xaf, 0x10, 0x85, 0x04, 0xf8, 0xeb, 0x44, 0xb4, 0xa8, 0x9a, 0xd0, 0x05, 0xd4, 0x0f, 0x29, 0xa0, 0x41, 0x33, 0x06, 0xc3, 0xa4, 0x8e, 0x96, 0x91, 0x39, 0x48, 0xc8, 0x08, 0x43, 0x88, 0x0d, 0x3c, 0x5c, 0xb4, 0x30, 0x91, 0x3b, 0xd0, 0x3a, 0x73, 0x32, 0x10, 0x71, 0x00, 0x93, 0xc5, 0x00, 0xda, 0x88, 0x05, 0x3b, 0xa3, 0x35, 0x34, 0x87, 0x2d, 0x41, 0xb1, 0x30, 0xe6, 0x54, 0x22, 0x93, 0x23, 0x96, 0xe2, 0x9c, 0x98, 0xb4, 0xdf, 0x8e, 0xd1, 0xe7, 0x09, 0x25, 0xab, 0xf9, 0x26, 0x98, 0xe4, 0xa2, 0xad, 0xaf, 0xc6, 0xe1, 0x3b, 0x44, 0xda, 0x38, 0x91, 0xb9, 0xb4, 0x19, 0x88, 0xe7, 0xce, 0x25, 0x50, 0xa3, 0x83, 0x27, 0x3a, 0x18, 0x2c, 0x1e, 0x4f, 0x1c, 0x99, 0x5c, 0x87, 0xa8, 0x0d, 0xe5, 0x36, 0x8c, 0xbe, 0x01, 0xa9, 0x94, 0x56, 0x25, 0x21, 0x3f, 0x87, 0x2a, 0xc5, 0xc0, 0x89, 0xb2, 0x14, 0xaf, 0x1f, 0xbc, 0x05, 0x5d, 0xf7, 0xdd, 0x7b, 0xc4, 0xc4, 0xbe, 0xe5, 0x19, 0x6c, 0x5f, 0xc2, 0x34, 0x50, 0xd9, 0x87, 0x70, 0xbf, 0xcd, 0xd2, 0x98, 0xfb, 0x41, 0xcc, 0x33, 0x4d, 0x40, 0xd0, 0xc4, 0x0f, 0x8e, 0x78, 0x43, 0xff, 0x2e, 0x63, 0x18, 0x8b, 0xfc, 0x99, 0xa7, 0x3d, 0x44, 0x82, 0xd8, 0x37, 0x1f, 0xa9, 0x89, 0x51, 0xbd, 0x03, 0x1a, 0x26, 0xce, 0x6c, 0xaf, 0x6d, 0xe8, 0xed, 0x51, 0xb9, 0x68, 0x01, 0xba, 0x87, 0x1b, 0xc7, 0x40, 0x17, 0x2a, 0x8e, 0x04, 0x99, 0xd2, 0xf0, 0x12, 0xcd, 0xa6, 0x83, 0x20, 0x74, 0x02, 0xa7, 0x9b, 0x45, 0x05, 0x54, 0x05, 0x25, 0x27, 0xcf, 0xc7, 0xbc, 0x45, 0xc8, 0x4c, 0xc7, 0x30, 0x38, 0x0a, 0x5a, 0xd2, 0xab, 0x15, 0x49, 0xeb, 0x29, 0x28, 0x7e, 0x69, 0xd2, 0xdf, 0x20, 0xb6, 0x06, 0x28, 0x13, 0x4f, 0x33, 0x0b, 0x19, 0xb3, 0x93, 0x93, 0x2c, 0xdf, 0x74, 0x76, 0x7b, 0x54, 0x91, 0x30, 0x0e, 0xe4, 0x1c, 0x46, 0x61, 0xf2, 0x1d, 0x0c, 0xb4, 0x5b, 0x8c, 0xd1, 0x7d, 0x58, 0xb6, 0xee, 0x86, 0xb0, 0x8b, 0x00, 0x07, 0x49, 0x60, 0xe3, 0x48, 0xb3, 0x73, 0x01, 0x48, 0xce, 0x40, 0x2b, 0x1b, 0x12, 0xc3, 0xc8, 0x52, 0x98, 0xc9, 0x21, 0xbc, 0x50, 0x73, 0x07, 0x2d, 0x75, 0x38, 0x7e, 0xea, 0x8c, 0xf3, 0x89, 0xc7, 0x1c, 0x0c, 0x86, 0xe7, 0x9f, 0xc6, 0x08, 0x42, 0x05, 0x96, 0x5c, 0x8e, 0xa5, 0x03, 0x2c, 0xab, 0x9f, 0x00, 0x1f, 0x0a, 0x9b, 0xc4, 0x60, 0x2a, 0xd8, 0x89, 0x72, 0x87, 0x27, 0x03, 0x3c, 0xf3, 0x0b, 0x4b, 0xf4, 0x04, 0x21, 0x30, 0x36, 0x35, 0x64, 0x01, 0xe9, 0x85, 0x81, 0xe7, 0x72, 0xfc, 0xcb, 0x92, 0xed, 0xe5, 0xc2, 0x43, 0x1a, 0x70, 0x2a, 0x4a, 0x03, 0x39, 0x0e, 0x61, 0x5d, 0x12, 0x7d, 0x0e, 0x81, 0xcc, 0x8a, 0x34, 0xcb, 0x4d, 0x74, 0x7c, 0x97, 0x3b, 0x42, 0x03, 0xc0, 0xc1, 0x4b, 0xa3, 0x0e, 0x96, 0xb5, 0xd1, 0x13, 0xce, 0x62, 0x31, 0xe5, 0x39, 0xa2, 0x51, 0xf4, 0x82, 0x64, 0x1c, 0x89, 0xf9, 0x51, 0xbb, 0xf9, 0x08, 0xc0, 0x4c, 0x8d, 0x75, 0x81, 0xf9, 0xe7, 0x87, 0x01, 0xcd, 0x72, 0x8c, 0x3e, 0x97, 0x45, 0x36, 0x71, 0xc6, 0x23, 0xec, 0x15, 0x6b, 0xa9, 0xc0, 0x41, 0x18, 0xbb, 0xdc, 0x2f, 0x30, 0xd6, 0x13, 0x9a, 0xca, 0x6b, 0x70, 0xa5, 0xf0, 0xf1, 0x22, 0xbd, 0x14, 0x94, 0x92, 0x9d, 0xe7, 0x2d, 0x8d, 0x0a, 0x2a, 0x3f, 0x2e, 0xb9, 0x02, 0xa8, 0xe9, 0xcb, 0xb0, 0x12, 0xbb, 0x0e, 0xfd, 0x92, 0xb1, 0x6f, 0xb8, 0x5e, 0x9c, 0x61, 0x8c, 0xa2, 0xde, 0xd3, 0x38, 0xda, 0x38, 0x42, 0x9e, 0x63, 0x21, 0x0c, 0x01, 0x93, 0x63, 0x85, 0x05, 0x19, 0x51, 0xa9, 0x7d, 0x81, 0x3f, 0x8d, 0x03, 0x89, 0x38, 0x5c, 0xce, 0x8d, 0x83, 0xcd, 0x37, 0x47, 0xcf, 0x9f, 0x35, 0x1c, 0xf5, 0x7b, 0xf7, 0xd5, 0x8f, 0x0d, 0x61, 0xb7, 0xd0, 0xd5, 0x77, 0x7b, 0x1a, 0x39, 0xfc, 0x6a, 0x14, 0x81, 0xfc, 0x46, 0x78, 0xc3, 0xe7, 0x7c, 0x0c, 0xcc, 0x26, 0xcf, 0x91, 0x39, 0x10, 0x14, 0x4c, 0x22, 0x48, 0xa0, 0x86, 0x00, 0xd2, 0xcd, 0x6c, 0xcb, 0x64, 0x87, 0xc0, 0x7c, 0x8a, 0x88, 0x34, 0x5c, 0x2a, 0x1c, 0x41, 0x73, 0x20, 0xed, 0x00, 0x3f, 0x0a, 0x89, 0x46, 0xe5, 0x60, 0x68, 0x42, 0xb9, 0xac, 0xbd, 0x32, 0x8e, 0xeb, 0xc9, 0x2e, 0x1f, 0x67, 0x54, 0x3d, 0x8e, 0x88, 0x61, 0x55, 0x17, 0x13, 0x71, 0x76, 0xa4, 0x2a, 0x8c, 0xe6, 0x05, 0xfa, 0x9b, 0x38, 0x69, 0x57, 0x98, 0x39, 0xba, 0x00, 0x2a, 0xfa, 0xdf, 0x7e, 0x1c, 0xa3, 0xa6, 0x3c, 0xe0, 0x52, 0xda, 0x48, 0x13, 0x2e, 0xe6, 0x4d, 0xe8, 0xe5, 0xe2, 0xdf, 0xdf, 0xb2, 0x8b, 0x5a, 0x2c, 0xed, 0x7e, 0xd2, 0x06, 0x61, 0xc0, 0xac, 0x67, 0x0a, 0x1d, 0x4f, 0xbe, 0xb5, 0xd0, 0xd1, 0xd3, 0x38, 0x37, 0xd7, 0xa7, 0x12, 0x3c, 0xc4, 0x6c, 0x7e, 0x4b, 0xe1, 0x62, 0x3f, 0xb8, 0x8a, 0x86, 0xe3, 0xa1, 0xe4, 0xbd, 0x87, 0x82, 0x00, 0xee, 0xc0, 0x08, 0x8c, 0x97, 0x8a, 0xcb, 0xd2, 0x42, 0xfa, 0x22, 0x2c, 0xac, 0x29, 0x14, 0xdc, 0x36, 0xfe, 0x57, 0xf6, 0xc2, 0xc4, 0xa1, 0x8b, 0x71, 0xd9, 0x0b, 0x27, 0xea, 0xd9, 0x28, 0xe8, 0x05, 0x51, 0x9c, 0x57, 0x07, 0x2d, 0xfc, 0x27, 0xd4, 0x1a, 0xed, 0x14, 0x80, 0xa9, 0x22, 0x91, 0x5b, 0x2e, 0xfd, 0xc4, 0x6d, 0x47, 0xed, 0x6a, 0x47, 0xc1, 0x45, 0xa9, 0x4f, 0x7d, 0xf0, 0x58, 0x56, 0x5a, 0xca, 0x6a, 0xf7, 0xb2, 0xc7, 0xd6, 0x5e, 0x26, 0xae, 0xa7, 0xdb, 0x00, 0x15, 0x30, 0xf8, 0xa2, 0x7a, 0x72, 0x4d, 0x42, 0xf7, 0xb2, 0x67, 0x27, 0x07, 0x38, 0x42, 0x63, 0xad, 0xc6, 0x93, 0x05, 0x68, 0x35, 0xd5, 0xad, 0xce, 0xcc, 0x65, 0x43, 0x3f, 0x37, 0xee, 0x12, 0xa6, 0x8f, 0x76, 0x9f, 0xdd, 0xaa, 0xcc, 0xe5, 0x39, 0x46, 0x77, 0x19, 0x8a, 0x5c, 0xe3, 0x39, 0xf1, 0xa0, 0x77, 0xd1, 0x4e, 0xa4, 0x37, 0x2d, 0x3a, 0x95, 0x69, 0x36, 0x1b, 0xdf, 0x56, 0xa9, 0x3b, 0x80, 0x97, 0xd0, 0x7c, 0x58, 0x0b, 0xdf, 0x48, 0x7e, 0x14, 0x2b, 0x4e, 0xfe, 0x9e, 0x07, 0xa7, 0x2a, 0x70, 0x1b, 0x8c, 0x73, 0x66, 0xa7, 0xa8, 0xcc, 0xce, 0xac, 0x84, 0x42, 0xc2, 0xd3, 0xab, 0xb4, 0x00, 0xf1, 0x41, 0x6c, 0x85, 0x5d, 0x60, 0x5b, 0x7d, 0x25, 0xb3, 0x5e, 0xa2, 0x42, 0xaf, 0xf0, 0x34, 0x49, 0xc7, 0x40, 0xf6, 0x13, 0x78, 0xe6, 0xc4, 0xe8, 0x85, 0x4d, 0x35, 0xa0, 0x23, 0x5e, 0x50, 0xae, 0x03, 0xa1, 0x5c, 0xe3, 0x17, 0xb4, 0x8a, 0xd0, 0x16, 0x05, 0x6c, 0x32, 0x24, 0xc5, 0x5e, 0xef, 0x84, 0xd4, 0x22, 0x30, 0x81, 0x84, 0x77, 0x4b, 0x3a, 0x67, 0xf4, 0x49, 0x94, 0x14, 0xfb, 0x1e, 0xdd, 0x55, 0x42, 0x8d, 0x6c, 0x1e, 0xc0, 0x0e, 0x8c, 0x71, 0xd7, 0x80, 0x69, 0x84, 0x00, 0xe3, 0xb2, 0x33, 0x2e, 0x5b, 0x70, 0x3a, 0x13, 0xdd, 0x18, 0x82, 0x2c, 0xb6, 0xc5, 0x77, 0x26, 0xd4, 0x38, 0xbb, 0xa1, 0x14, 0xbe, 0xdf, 0x6f, 0x1d, 0x1f, 0x1f, 0xed, 0x1c, 0x3d, 0x5c, 0x25, 0x70, 0xa0, 0xb5, 0x4c, 0x17, 0x93, 0x07, 0xd1, 0xb9, 0xb3, 0xff, 0xec, 0xd5, 0x11, 0xca, 0xa0, 0xdd, 0x94, 0x58, 0xb6, 0xea, 0x32, 0x88, 0xf3, 0xd4, 0x41, 0x47, 0x23, 0x73, 0x54, 0x4e, 0x50, 0x38, 0x4f, 0x83, 0x72, 0xcf, 0x4c, 0xce, 0x1d, 0xfc, 0x47, 0x09, 0xc1, 0x14, 0x33, 0x28, 0xdd, 0xa6, 0xba, 0xdd, 0xab, 0xbc, 0x97, 0x43, 0xcf, 0x78, 0xfa, 0x14, 0x6f, 0xd8, 0x8f, 0xb0, 0x1e, 0xba, 0xc2, 0xb2, 0x63, 0xad, 0x70, 0x58, 0xd1, 0x1b, 0xdb, 0x38, 0x1d, 0xf6, 0x90, 0xcc, 0xb3, 0x99, 0x30, 0x52, 0x37, 0xb7, 0x91, 0xb7, 0xa0, 0xff, 0x1c, 0xd3, 0x52, 0xb1, 0x93, 0x9c, 0x25, 0xfa, 0x37, 0x06, 0xdd, 0xa9, 0xdf, 0x01, 0xcb, 0xf0, 0xf7, 0x43, 0xfe, 0x08, 0x1e, 0x42, 0xd6, 0xc7, 0x87, 0xc7, 0xf4, 0xd0, 0x63, 0x23, 0x7c, 0x58, 0xe3, 0x8f, 0xe1, 0x61, 0xc8, 0x8e, 0x28, 0x8e, 0x6d, 0x15, 0x7e, 0x77, 0x59, 0x47, 0x57, 0x3f, 0x63, 0x03, 0x19, 0xdf, 0xc6, 0x4e, 0xc6, 0x6c, 0x11, 0x7f, 0x0b, 0xab, 0xd5, 0xc9, 0x84, 0x5d, 0xea, 0x1a, 0x9b, 0xec, 0x50, 0xff, 0xde, 0x63, 0x5b, 0xd4, 0xec, 0x13, 0xea, 0xe4, 0x15, 0xdb, 0xc1, 0xa7, 0x47, 0xde, 0xfa, 0xa0, 0x70, 0xe9, 0xba, 0x1d, 0xb2, 0xe1, 0x62, 0xe8, 0xe6, 0x11, 0x25, 0xc4, 0x97, 0xd9, 0xa7, 0xfc, 0x40, 0xec, 0x0e, 0x1c, 0xaf, 0xef, 0x6d, 0xac, 0x00, 0x39, 0x9d, 0x95, 0x26, 0x50, 0xf2, 0x7d, 0xd8, 0x6e, 0xa6, 0xe7, 0xb3, 0x21, 0x2e, 0x3b, 0x40, 0x4c, 0x82, 0x36, 0xd1, 0x9c, 0xa5, 0x6d, 0x60, 0x2d, 0x67, 0xf1, 0x7a, 0xbb, 0x29, 0xe4, 0x8e, 0xa9, 0xf1, 0x1b, 0x53, 0x79, 0x4d, 0x3f, 0xa8, 0x5e, 0x2f, 0x64, 0xaf, 0xdb, 0xcd, 0x8f, 0x79, 0x8a, 0x11, 0xfb, 0x85, 0x7b, 0xd1, 0x44, 0x06, 0x42, 0xfe, 0x56, 0x2c, 0x21, 0x14, 0xc4, 0xf0, 0x4e, 0x59, 0x88, 0xc4, 0xfb, 0x0c, 0xde, 0x48, 0x01, 0xe5, 0xe6, 0x86, 0x10, 0xdb, 0x87, 0x37, 0xb4, 0xa1, 0x9f, 0x91, 0xf9, 0xe0, 0x4c, 0x7f, 0x25, 0x4c, 0x8f, 0xb0, 0x55, 0xd4, 0xaf, 0xcf, 0x48, 0x20, 0x2a, 0xbf, 0x12, 0xea, 0x17, 0xe1, 0x6b, 0x30, 0x3a, 0x1b, 0x52, 0xae, 0x47, 0x81, 0xdb, 0x4b, 0x17, 0xe3, 0x2c, 0x60, 0xaf, 0x38, 0x4b, 0x93, 0x33, 0x21, 0x5a, 0x94, 0x31, 0xff, 0x33, 0x9f, 0x5a, 0x88, 0xf6, 0x43, 0x84, 0x52, 0x68, 0x6a, 0x66, 0x51, 0xf9, 0x8a, 0x8a, 0x6c, 0xe9, 0x56, 0xcd, 0x6d, 0x47, 0x41, 0x73, 0x36, 0xcc, 0x01, 0x20, 0x9a, 0xb4, 0x1d, 0x28, 0x08, 0x9b, 0xdd, 0x99, 0x28, 0x2c, 0x65, 0xa6, 0x9b, 0x1b, 0x68, 0xa2, 0x83, 0x18, 0x91, 0x77, 0x2c, 0x6f, 0x7b, 0xd7, 0x1d, 0xf7, 0x03, 0x4d, 0x83, 0x32, 0x25, 0x56, 0xd0, 0x0f, 0x7b, 0x5f, 0x1e, 0xf4, 0x31, 0x3e, 0xc0, 0xbe, 0x01, 0x15, 0x63, 0x6e, 0xed, 0xb0, 0xdc, 0xc6, 0xbc, 0x69, 0x6c, 0xb0, 0xed, 0xf2, 0xc6, 0xf3, 0x23, 0x24, 0xc3, 0xa9, 0x0a, 0xbd, 0x74, 0x76, 0x7d, 0x9b, 0x9e, 0x06, 0x44, 0xa5, 0x04, 0xa2, 0xa6, 0xaa, 0x6b, 0x9c, 0x4d, 0xcc, 0xdf, 0xc4, 0x88, 0xa5, 0x86, 0x14, 0x25, 0x21, 0xb1, 0x8d, 0xee, 0x5b, 0x6a, 0x62, 0x5b, 0x74, 0x97, 0x84, 0xc0, 0x44, 0x2b, 0xc0, 0x08, 0xd3, 0xd9, 0xd9, 0x6c, 0x85, 0xd4, 0x8c, 0x8d, 0xfb, 0x89, 0x4b, 0xee, 0x5b, 0xd5, 0xb9, 0x6d, 0xf5, 0xe0, 0xbd, 0x42, 0xfe, 0xa6, 0xae, 0x37, 0x07, 0xf1, 0xad, 0x3d, 0x28, 0x31, 0x83, 0xf1, 0xd6, 0x2b, 0x3c, 0x99, 0xbe, 0xa8, 0xac, 0x0c, 0x61, 0xcc, 0x2e, 0x17, 0x07, 0xbb, 0x16, 0x3e, 0x39, 0x2d, 0xe1, 0x83, 0xc3, 0x06, 0x3c, 0x80, 0xdd, 0x24, 0x6f, 0x5d, 0x37, 0x64, 0x6e, 0xbb, 0x65, 0xcc, 0xd6, 0xd7, 0x68, 0x35, 0xf0, 0x9a, 0x56, 0xd9, 0xf5, 0x0a, 0x92, 0x7b, 0x63, 0xca, 0x3a, 0x69, 0x38, 0x69, 0x55, 0x0e, 0x09, 0x01, 0xdf, 0x62, 0xbd, 0x5d, 0xdc, 0xb1, 0xde, 0x70, 0x93, 0xb7, 0x26, 0xfc, 0xc2, 0x58, 0x6f, 0x17, 0x35, 0xeb, 0x0d, 0xa7, 0x3b, 0x4e, 0xfb, 0x6e, 0xe3, 0x16, 0x39, 0x01, 0x26, 0x5c, 0x4c, 0xd9, 0x36, 0xad, 0xc3, 0x72, 0x7e, 0xb6, 0xf5, 0x1a, 0xd4, 0xd3, 0xb4, 0xad, 0x16, 0x61, 0xed, 0x64, 0x6d, 0xd7, 0x2d, 0xc8, 0xda, 0xa9, 0xda, 0xae, 0x5b, 0x9c, 0x33, 0x13, 0xbd, 0x5d, 0x5d, 0x76, 0x7a, 0x7a, 0xb7, 0xd5, 0x2a, 0xbb, 0x63, 0x92, 0xb7, 0x6f, 0x5f, 0x7d, 0x35, 0x04, 0xb0, 0x3d, 0xbb, 0x0c, 0x35, 0xf1, 0x6e, 0x2b, 0xa6, 0x31, 0xf5, 0xd8, 0x80, 0x38, 0x6f, 0xc5, 0x53, 0x4e, 0x2c, 0x87, 0x47, 0xb0, 0xa0, 0x6b, 0x16, 0x2c, 0x60, 0xfe, 0x1b, 0xad, 0x57, 0x9b, 0x0c, 0x68, 0xbd, 0xce, 0x1e, 0xd7, 0x6d, 0xfb, 0x89, 0x71, 0xa6, 0x9d, 0xba, 0xdb, 0xac, 0xfc, 0x76, 0x21, 0x0f, 0xf0, 0x17, 0x16, 0x86, 0xe5, 0x29, 0x3a, 0x25, 0x30, 0x71, 0xbd, 0x76, 0x04, 0xd5, 0x5a, 0x65, 0xd9, 0x73, 0x3f, 0xc6, 0x85, 0xfa, 0xd1, 0x3f, 0x37, 0x8f, 0xfd, 0xae, 0xfc, 0x8f, 0xd6, 0xb1, 0xdf, 0x6b, 0xff, 0xca, 0x7a, 0x7e, 0xe7, 0xbf, 0x36, 0x8b, 0x7f, 0xf2, 0xdf, 0x59, 0x9f, 0x3f, 0xc3, 0x67, 0xf3, 0xf9, 0x17, 0xff, 0xb3, 0x59, 0xfc, 0x47, 0xff, 0x17, 0xeb, 0x73, 0xc1, 0xfd, 0x1f, 0xad, 0x17, 0x03, 0x14, 0x3e, 0xcd, 0x1a, 0x43, 0xee, 0x0f, 0xb8, 0x75, 0xf0, 0x38, 0xb4, 0x1f, 0x71, 0x28, 0x1d, 0x0e, 0xdd, 0x98, 0xcd, 0xec, 0x72, 0xbf, 0x63, 0x35, 0x93, 0x73, 0x7f, 0xd7, 0xaa, 0xc7, 0x76, 0xb8, 0x9f, 0xdb, 0x6f, 0x40, 0xb0, 0xdc, 0xb1, 0x2a, 0x5d, 0x80, 0xa4, 0x59, 0xe9, 0x6c, 0xb6, 0xef, 0x98, 0xba, 0xb2, 0x50, 0xc6, 0xfd, 0xd8, 0x6a, 0xe7, 0x8c, 0xfb, 0xaf, 0xed, 0x22, 0x1f, 0xb9, 0x7f, 0x66, 0xbf, 0xd9, 0xe7, 0xfe, 0x47, 0xab, 0x52, 0xc6, 0xfd, 0x7d, 0x5e, 0x39, 0x71, 0x9d, 0xe9, 0xfc, 0x0d, 0x75, 0x65, 0xb6, 0xf3, 0x8c, 0xfb, 0x6f, 0xac, 0x76, 0xb6, 0xb8, 0xff, 0xcc, 0x2e, 0x12, 0x70, 0x7f, 0xcb, 0x2a, 0xb2, 0x48, 0x75, 0xcc, 0x22, 0x57, 0xdc, 0x5f, 0xb4, 0x8a, 0x4c, 0xb8, 0x7f, 0x65, 0x17, 0x49, 0xb8, 0x3f, 0xb1, 0x8a, 0xbc, 0xa2, 0x3a, 0x66, 0x91, 0x23, 0xee, 0xbf, 0xb2, 0xdf, 0xbc, 0xe3, 0xfe, 0x91, 0xfd, 0xe6, 0x25, 0xf7, 0xdf, 0x59, 0xcd, 0x5c, 0x72, 0xff, 0xa5, 0x5d, 0x24, 0xe5, 0xfe, 0x65, 0xa5, 0xef, 0xc2, 0x4f, 0xad, 0x4a, 0x5d, 0xd0, 0x38, 0x0b, 0x0b, 0x3b, 0xdd, 0x59, 0x64, 0x6d, 0x53, 0x57, 0x66, 0x3b, 0x6f, 0xb9, 0xbf, 0x6d, 0xb5, 0x13, 0x72, 0xff, 0xad, 0x5d, 0xe4, 0x05, 0x15, 0xa9, 0x3d, 0xf8, 0x3e, 0x37, 0x16, 0xde, 0x1b, 0xbd, 0xf0, 0xba, 0xf6, 0xc2, 0x7b, 0x43, 0x59, 0xc2, 0x75, 0xb9, 0x5f, 0xfd, 0xcc, 0x5a, 0xbc, 0xbf, 0xa2, 0xcf, 0xdf, 0xaf, 0x74, 0x40, 0xe9, 0xe1, 0x62, 0xc4, 0x13, 0xcc, 0xfa, 0x76, 0xcf, 0x6a, 0xda, 0x0d, 0xa2, 0xbb, 0xeb, 0x8d, 0xef, 0x80, 0x27, 0x45, 0x26, 0x70, 0xc0, 0xfd, 0x5f, 0x4d, 0x3c, 0x9c, 0x73, 0xff, 0xc0, 0x42, 0xcc, 0x98, 0xfb, 0xe7, 0x36, 0x62, 0x3e, 0x51, 0x11, 0xf3, 0x4d, 0x8f, 0xfb, 0x9f, 0xac, 0x4a, 0x9f, 0xb9, 0xdf, 0xab, 0xc5, 0xdd, 0x98, 0x37, 0x17, 0x17, 0x49, 0x0b, 0xf3, 0x39, 0x86, 0x4c, 0xba, 0x5c, 0x65, 0x5c, 0x57, 0x39, 0x10, 0x3e, 0xdb, 0x25, 0x92, 0xd9, 0x12, 0x22, 0xe1, 0x33, 0xb4, 0x24, 0xc2, 0x6b, 0xd0, 0x6b, 0x48, 0xbe, 0xfb, 0xac, 0xde, 0x61, 0x80, 0xa0, 0x81, 0xdc, 0xab, 0xb9, 0x48, 0xba, 0x0b, 0x47, 0x5d, 0x63, 0xce, 0x7e, 0x05, 0xc0, 0xc8, 0xfd, 0x92, 0xfc, 0x15, 0x17, 0x69, 0xb7, 0xb0, 0xfa, 0xf8, 0xa4, 0x21, 0x7f, 0x83, 0x37, 0x71, 0xbe, 0xa9, 0xc0, 0xfd, 0xa3, 0xf9, 0x39, 0x73, 0xc9, 0x8f, 0x78, 0x37, 0x29, 0xaa, 0xe5, 0x6e, 0x6e, 0x30, 0x0d, 0x3b, 0x00, 0x5c, 0x70, 0x3a, 0xd0, 0x76, 0xe1, 0x71, 0x65, 0x0d, 0x36, 0xa0, 0x66, 0x91, 0xee, 0x44, 0x57, 0x3c, 0x74, 0x61, 0x43, 0xc2, 0xf8, 0xe7, 0x9c, 0x9b, 0x0d, 0xf6, 0x6f, 0x69, 0x30, 0x14, 0x0d, 0xee, 0xc8, 0x06, 0xc3, 0x9a, 0x06, 0x2f, 0xa0, 0xc1, 0x33, 0xab, 0xc1, 0xd1, 0x2d, 0x0d, 0xf6, 0x44, 0x83, 0x1f, 0x65, 0x83, 0xbd, 0x9a, 0x06, 0x33, 0xcc, 0xea, 0xc2, 0xeb, 0xbc, 0x77, 0x49, 0x31, 0x6b, 0x30, 0xe8, 0xe2, 0xb2, 0x6c, 0x59, 0x1e, 0x6c, 0x40, 0xb3, 0xc9, 0x1d, 0x95, 0x0e, 0xeb, 0x2a, 0x5d, 0x5a, 0xa0, 0x6f, 0xdd, 0x02, 0xfa, 0x9e, 0x00, 0x3d, 0x95, 0xa0, 0xef, 0xd5, 0x80, 0xde, 0xe5, 0x78, 0x13, 0x90, 0xd9, 0xe0, 0xce, 0x2d, 0x0d, 0xbe, 0xc2, 0x06, 0x5f, 0x70, 0x4d, 0x1c, 0xbb, 0x92, 0x18, 0x3f, 0x49, 0x5a, 0x8c, 0x4a, 0xfa, 0xfc, 0x51, 0xbe, 0x0a, 0xca, 0x57, 0xb9, 0x22, 0xd9, 0xb0, 0x7c, 0x77, 0xa6, 0xde, 0xf5, 0xca, 0x77, 0x01, 0x57, 0xa3, 0xf5, 0x27, 0xe5, 0xdb, 0xa4, 0x7c, 0xbb, 0x59, 0xbe, 0xbd, 0x54, 0xf5, 0xf7, 0xca, 0x77, 0xa1, 0x7a, 0x47, 0xe0, 0x9e, 0x2b, 0xb2, 0xf5, 0xd8, 0x36, 0xfd, 0x1c, 0x8a, 0x4b, 0x45, 0xcd, 0xdb, 0x27, 0x4f, 0x3d, 0xe2, 0x9d, 0xe3, 0x19, 0x3f, 0x31, 0x74, 0x9d, 0xb0, 0xfc, 0x9b, 0xf2, 0x41, 0x10, 0xa6, 0x97, 0xcb, 0xf9, 0xb0, 0xb1, 0x51, 0x2d, 0xb7, 0x8c, 0xc2, 0xb1, 0x33, 0x22, 0xc3, 0x77, 0xd5, 0xd5, 0x0c, 0x8d, 0xb8, 0x20, 0x2b, 0x2f, 0xab, 0xc3, 0x73, 0xcb, 0xe3, 0x6c, 0xd8, 0x59, 0x7e, 0xd8, 0x30, 0x8e, 0x80, 0x44, 0x6b, 0x45, 0x54, 0xe0, 0x91, 0x9f, 0x38, 0x94, 0x42, 0x7f, 0x0b, 0x3c, 0xf6, 0xa9, 0xb6, 0xdb, 0x0f, 0x46, 0x54, 0xb7, 0xde, 0xe8, 0x77, 0x95, 0xd3, 0x1f, 0x0c, 0x45, 0xc4, 0xcb, 0x40, 0x37, 0xfe, 0xf6, 0x97, 0x3f, 0xff, 0xf7, 0x0f, 0x9e, 0xae, 0x88, 0xc2, 0x5f, 0x52, 0x69, 0xf9, 0x4b, 0x2b, 0x1d, 0x72, 0x10, 0xf0, 0xca, 0x4a, 0xa6, 0xad, 0xda, 0x74, 0x3e, 0x23, 0x17, 0xba, 0xbc, 0xc6, 0x77, 0xed, 0x87, 0x55, 0xb4, 0x50, 0xc2, 0xc8, 0xd0, 0x51, 0xdf, 0xa1, 0x13, 0xc7, 0xdc, 0xe9, 0xa6, 0xb1, 0xb8, 0x86, 0x56, 0x5a, 0xca, 0x1f, 0x3a, 0xca, 0x54, 0xfc, 0xd7, 0x7f, 0xf8, 0xdf, 0x9d, 0xed, 0x01, 0x1e, 0x9a, 0x0b, 0x65, 0x27, 0xaf, 0x2d, 0x81, 0x37, 0x02, 0x93, 0x5b, 0x4b, 0x00, 0x9a, 0xde, 0xd3, 0x85, 0x0d, 0xb4, 0xd2, 0x62, 0x66, 0x34, 0x51, 0x1d, 0x09, 0x81, 0xc4, 0x53, 0xba, 0xeb, 0x56, 0xf6, 0xf9, 0x1d, 0xea, 0x75, 0xb5, 0xce, 0x83, 0x6a, 0x46, 0xe5, 0x1c, 0x56, 0x5c, 0x08, 0x1f, 0xff, 0xc1, 0x3e, 0xdd, 0xbc, 0xd3, 0xa5, 0x66, 0x18, 0x92, 0x1d, 0xb5, 0x6f, 0x58, 0x3c, 0xbb, 0x41, 0x72, 0x11, 0xe0, 0x41, 0x46, 0x58, 0x0c, 0xd0, 0x98, 0x5e, 0xf1, 0xbf, 0x13, 0x9e, 0x76, 0x33, 0x0e, 0x77, 0x59, 0x8a, 0x57, 0x9d, 0x85, 0xea, 0xb0, 0xb6, 0x9b, 0xa5, 0x39, 0xd0, 0x6c, 0x24, 0xcc, 0xb4, 0x83, 0x99, 0xb1, 0x20, 0x96, 0x81, 0x66, 0x1f, 0x5a, 0x7e, 0x8e, 0xaa, 0x0d, 0xe9, 0x5b, 0xd8, 0xd0, 0xc7, 0x42, 0x47, 0xf2, 0x1e, 0x60, 0xe7, 0x00, 0xb1, 0x53, 0x1e, 0x0c, 0x39, 0xe4, 0x2a, 0xd2, 0x42, 0xa4, 0x32, 0x3a, 0x43, 0x68, 0x39, 0x96, 0xcf, 0x5f, 0x5e, 0xc9, 0x00, 0x2a, 0x32, 0xf9, 0x88, 0x14, 0xb6, 0xd2, 0x08, 0x14, 0xb3, 0x00, 0x7f, 0x5f, 0x7f, 0x4e, 0xd3, 0xe1, 0x1e, 0xcc, 0x5e, 0xdc, 0x5a, 0x23, 0xbd, 0xed, 0x10, 0x99, 0x61, 0xeb, 0x87, 0x55, 0xa6, 0xee, 0x20, 0x16, 0x5d, 0x53, 0x46, 0x54, 0x19, 0x9e, 0xa8, 0xa3, 0xa4, 0x6d, 0xed, 0x5e, 0xbc, 0xed, 0x08, 0x6d, 0xd8, 0x35, 0x75, 0x62, 0x72, 0xb8, 0xa5, 0x09, 0xc6, 0xbc, 0x7c, 0xc2, 0x90, 0xd3, 0xa1, 0xbc, 0xf4, 0x4b, 0x4b, 0xb9, 0x2b, 0x7e, 0x29, 0x1d, 0xa8, 0x2b, 0x00, 0xaf, 0xd5, 0x64, 0xa8, 0x35, 0x34, 0x86, 0x66, 0x22, 0x98, 0xbc, 0x45, 0xbe, 0xff, 0xca, 0xf8, 0x10, 0x09, 0xe3, 0x03, 0xeb, 0xfb, 0x5d, 0x79, 0x45, 0x75, 0x76, 0x73, 0x53, 0xb8, 0x9e, 0x79, 0x45, 0x83, 0x15, 0x5a, 0xd7, 0xf1, 0x29, 0xf6, 0x67, 0x0b, 0xb1, 0x0f, 0x34, 0x01, 0x14, 0x09, 0xe4, 0x74, 0x08, 0x83, 0x16, 0x09, 0x6c, 0x9b, 0x5d, 0x7a, 0xf1, 0x7e, 0xb9, 0x03, 0x2d, 0xf4, 0x0a, 0x36, 0xd0, 0xaf, 0x7e, 0x81, 0x57, 0x45, 0x3a, 0x62, 0x63, 0xff, 0xf1, 0x2a, 0x5b, 0x84, 0x56, 0x88, 0x66, 0x96, 0x1f, 0x7e, 0x3f, 0x66, 0x13, 0x78, 0x1a, 0x70, 0xcc, 0x97, 0x80, 0x8f, 0x14, 0xd7, 0xf3, 0x74, 0x7c, 0x73, 0x73, 0xb6, 0x31, 0x7e, 0xb0, 0x78, 0x73, 0x33, 0xc0, 0xdf, 0x03, 0xf8, 0x3d, 0xa9, 0x06, 0xf9, 0x61, 0x9f, 0x9b, 0xfe, 0x7e, 0x50, 0x0c, 0x9a, 0xb0, 0x4a, 0x5c, 0x4c, 0x05, 0x4e, 0x69, 0x10, 0x77, 0xfd, 0x8d, 0xdd, 0x66, 0x41, 0x59, 0x92, 0xc4, 0xc7, 0xe0, 0xaa, 0xe6, 0xe3, 0x9e, 0xef, 0x9e, 0x2d, 0x8f, 0xbd, 0x95, 0x45, 0xb6, 0xe5, 0x6f, 0x3e, 0x70, 0x0f, 0x97, 0x37, 0xbd, 0xef, 0xf7, 0x68, 0xb2, 0x5e, 0xf9, 0x97, 0xe8, 0xeb, 0xbb, 0x23, 0x6a, 0x07, 0x9d, 0xdc, 0x7d, 0xd5, 0x2c, 0x96, 0xb7, 0xbc, 0xf5, 0x4b, 0x1d, 0xdf, 0xbd, 0xab, 0x9d, 0x41, 0xb7, 0xcb, 0x52, 0xbb, 0xa2, 0xd4, 0xf6, 0xd3, 0x1d, 0x10, 0x5a, 0x76, 0xfc, 0x6d, 0xf6, 0xca, 0xdf, 0xc5, 0xc0, 0xea, 0x00, 0x8b, 0x53, 0xfe, 0x95, 0xdd, 0x0a, 0x85, 0xbc, 0xa2, 0xcc, 0x53, 0x3d, 0x11, 0x70, 0x11, 0x60, 0xfe, 0x46, 0x2a, 0xd6, 0x35, 0xa8, 0x4a, 0x8f, 0x60, 0x6d, 0x95, 0x75, 0x9b, 0xfa, 0xfd, 0xca, 0x43, 0x10, 0xcd, 0x34, 0x19, 0x76, 0x9b, 0xfa, 0xf7, 0xf7, 0x0f, 0xa9, 0xcd, 0xd1, 0xdd, 0x6d, 0x02, 0xca, 0xd6, 0x1e, 0x3f, 0xb6, 0x5a, 0xfd, 0x7e, 0x5e, 0xab, 0x2b, 0xa2, 0xd5, 0xa1, 0x6a, 0xf5, 0xcb, 0x96, 0xc0, 0x94, 0x1d, 0xf9, 0xfa, 0x0e, 0xf4, 0x3b, 0x08, 0xac, 0x2b, 0x08, 0x6c, 0x5b, 0x5c, 0xaf, 0xec, 0x36, 0x1e, 0x86, 0xd2, 0x52, 0xda, 0x9d, 0x25, 0x44, 0x22, 0x21, 0x20, 0x3b, 0x45, 0x3e, 0x40, 0x6e, 0x8f, 0x57, 0xd7, 0x91, 0xe2, 0x78, 0x90, 0x11, 0x51, 0xae, 0xb2, 0x55, 0x86, 0xa9, 0x90, 0x75, 0x70, 0x15, 0x6c, 0x63, 0xdf, 0x0f, 0x80, 0xfe, 0xce, 0xf0, 0x2f, 0x14, 0xed, 0x45, 0x71, 0x7c, 0x84, 0x17, 0xa4, 0xf9, 0x8d, 0xdf, 0xf5, 0xfe, 0xd0, 0xfb, 0x63, 0x2f, 0x80, 0xf5, 0x41, 0x6f, 0xa9, 0xfe, 0x80, 0x0d, 0xd8, 0x98, 0x2d, 0x82, 0x0c, 0x82, 0xc6, 0xa4, 0xf4, 0x9c, 0xab, 0xb2, 0xfc, 0x8f, 0xbc, 0x8b, 0xee, 0xff, 0xdd, 0x26, 0x6e, 0x26, 0xef, 0x88, 0xff, 0x95, 0x17, 0x26, 0x5c, 0xf9, 0xab, 0xeb, 0x57, 0x4f, 0xfd, 0x35, 0xf8, 0xb7, 0x4c, 0x7b, 0xf0, 0xda, 0x1f, 0x3c, 0xb8, 0xfa, 0x7e, 0xbc, 0xb2, 0x86, 0x20, 0x76, 0x78, 0x3f, 0x4a, 0x44, 0xd8, 0x2f, 0xb4, 0x81, 0x6e, 0x69, 0xc7, 0xa9, 0xfb, 0x9a, 0x0d, 0x3c, 0xd9, 0xa2, 0x78, 0x7a, 0x60, 0xf4, 0xec, 0xca, 0xbb, 0x25, 0xcb, 0xe6, 0x9f, 0xcc, 0xb6, 0xbe, 0xb8, 0xf2, 0x64, 0x5e, 0xe3, 0x03, 0xf6, 0xda, 0x68, 0x7c, 0xf0, 0x60, 0x2c, 0x9e, 0x75, 0xe3, 0x2a, 0x56, 0xb7, 0x70, 0xad, 0xec, 0x49, 0x4f, 0x1f, 0xda, 0x78, 0xdf, 0xf4, 0x9f, 0x61, 0x90, 0x4e, 0x92, 0x5e, 0x0a, 0x49, 0x6d, 0x39, 0x86, 0xc9, 0x2c, 0x09, 0x08, 0x28, 0xe0, 0xd0, 0x9f, 0x58, 0x59, 0xdb, 0x8a, 0x0d, 0x7f, 0x93, 0x9a, 0x3c, 0x9c, 0xd3, 0xe4, 0x9e, 0xb5, 0x86, 0x0f, 0x69, 0x99, 0x8a, 0x9a, 0x1e, 0xa6, 0x18, 0x33, 0xd7, 0x70, 0xe5, 0xe3, 0xab, 0x79, 0x35, 0x2f, 0xe0, 0xe3, 0xce, 0xbc, 0x9a, 0xf8, 0x71, 0xd7, 0xdf, 0x59, 0x7e, 0x75, 0x73, 0xb3, 0xc6, 0xb6, 0xfd, 0x57, 0xcb, 0xbb, 0xdf, 0x37, 0xd7, 0xd8, 0x85, 0xbf, 0xf3, 0x00, 0x7f, 0xac, 0xdb, 0x53, 0x8d, 0x17, 0x38, 0xc5, 0x29, 0x10, 0x6d, 0xe3, 0x77, 0xab, 0xab, 0xbf, 0xef, 0xf4, 0x2a, 0x73, 0xfe, 0x90, 0xd9, 0xe8, 0x3e, 0x2c, 0xb3, 0xab, 0x5f, 0x01, 0x82, 0x35, 0x9b, 0x78, 0x07, 0xd3, 0xe3, 0x02, 0xd0, 0xcb, 0x7b, 0xde, 0x8a, 0xbb, 0x05, 0xff, 0x02, 0xdf, 0xfb, 0x04, 0xef, 0x16, 0x97, 0xe1, 0xed, 0xc5, 0xf2, 0x36, 0xbc, 0xc5, 0x7f, 0xbf, 0x5f, 0x5c, 0x7f, 0x4d, 0x17, 0xdd, 0xe8, 0x69, 0x7b, 0xc7, 0x3e, 0x79, 0x2d, 0x3d, 0x6d, 0xf8, 0x34, 0x35, 0xa7, 0x8d, 0x99, 0x24, 0x5c, 0x03, 0x6b, 0x09, 0xcf, 0x95, 0x86, 0xe5, 0x75, 0x0d, 0x2c, 0xef, 0x6a, 0x61, 0xa9, 0x92, 0x52, 0x90, 0x75, 0x81, 0x2c, 0xdf, 0xb1, 0x47, 0xb0, 0xac, 0x1e, 0x7e, 0x4f, 0xe8, 0x3d, 0xd8, 0x55, 0x30, 0xa0, 0x04, 0xbb, 0xae, 0x12, 0x4f, 0xc5, 0x94, 0x38, 0xd2, 0x60, 0x05, 0x48, 0x00, 0xe7, 0x4b, 0x4b, 0x87, 0x22, 0x39, 0xb7, 0x98, 0x41, 0x4c, 0xda, 0xd7, 0x2c, 0xaf, 0x1a, 0xba, 0x42, 0xb8, 0xce, 0x6d, 0xb8, 0x5e, 0x0b, 0xb8, 0xce, 0xab, 0x70, 0xd9, 0xab, 0xb1, 0xd7, 0xc3, 0x73, 0x7c, 0x7b, 0x66, 0x1e, 0xb1, 0x3a, 0xe8, 0x61, 0x52, 0xd8, 0x0f, 0x55, 0xe8, 0x6b, 0x91, 0x89, 0xad, 0xe2, 0xff, 0x1a, 0x73, 0xdb, 0x79, 0x3c, 0x07, 0x0b, 0x76, 0x2b, 0x3f, 0xfc, 0xf0, 0x03, 0xb1, 0x94, 0x14, 0x2f, 0x64, 0x59, 0x7b, 0x38, 0xba, 0x72, 0x36, 0x33, 0x4c, 0x2d, 0x83, 0x7c, 0x17, 0x38, 0xdc, 0x66, 0x1c, 0xf5, 0x13, 0x10, 0xa7, 0x49, 0x2a, 0x6b, 0x30, 0xde, 0x9c, 0xec, 0xe1, 0x71, 0x3b, 0xec, 0x20, 0x00, 0x57, 0x70, 0x21, 0xa0, 0xa2, 0xb0, 0x28, 0xbc, 0xb7, 0xd9, 0x5d, 0x7b, 0x82, 0x5c, 0x01, 0xb9, 0x7f, 0xb7, 0x99, 0xa5, 0x14, 0x18, 0xb3, 0x2c, 0x21, 0x10, 0x2f, 0xb1, 0x6b, 0xb4, 0x4f, 0xbb, 0xaa, 0x25, 0x86, 0x89, 0x19, 0xb0, 0x34, 0xc7, 0xc0, 0x29, 0xd2, 0xce, 0xad, 0x9e, 0x33, 0xe4, 0x9c, 0x8d, 0xf5, 0xdb, 0x79, 0xcb, 0xf6, 0x03, 0x81, 0x7a, 0x77, 0x6d, 0xf9, 0x6a, 0xe5, 0x89, 0x47, 0xe4, 0xa2, 0xb8, 0x8d, 0xee, 0xf1, 0xb5, 0xa9, 0xb4, 0x0d, 0x96, 0x9f, 0xb0, 0x77, 0x0f, 0x1e, 0x23, 0x36, 0x66, 0x87, 0xb9, 0xae, 0xd2, 0x88, 0xd9, 0xbc, 0xe4, 0x0e, 0x20, 0xf6, 0x1e, 0x08, 0xaa, 0x70, 0x0d, 0x10, 0xc6, 0x2b, 0x4f, 0x60, 0x1d, 0x11, 0x06, 0x48, 0x22, 0x74, 0xdd, 0x8f, 0xcb, 0xaf, 0x3d, 0x90, 0xcd, 0x3d, 0x13, 0xb2, 0x0f, 0x8b, 0xd7, 0x9f, 0xa6, 0x43, 0x27, 0xe8, 0xa7, 0x1f, 0x80, 0x7a, 0xcf, 0x96, 0x9f, 0x18, 0x49, 0x07, 0x07, 0x2a, 0xce, 0x53, 0x87, 0xe0, 0x76, 0x31, 0x3c, 0x7b, 0x17, 0x01, 0x05, 0x15, 0xcd, 0x0d, 0x19, 0x1e, 0x86, 0x19, 0x46, 0x09, 0xda, 0x5d, 0xf4, 0xe7, 0x2e, 0xad, 0x47, 0x99, 0x77, 0x92, 0x42, 0x97, 0x8e, 0x28, 0xcf, 0x5b, 0x69, 0xb5, 0xe8, 0xfa, 0x63, 0xb4, 0xec, 0x74, 0xfc, 0xae, 0x65, 0x8a, 0xf4, 0x3b, 0xe6, 0xe3, 0xc0, 0x3f, 0xb3, 0xac, 0x3c, 0xfe, 0xc0, 0xb2, 0xe8, 0x2c, 0xfa, 0x63, 0xcb, 0x08, 0xe8, 0x2f, 0x5a, 0x9f, 0x2f, 0x81, 0xe5, 0x9a, 0xcf, 0x9b, 0xd0, 0x9a, 0xf9, 0x7c, 0xe8, 0x6f, 0x9a, 0xd5, 0xf7, 0xfc, 0xc3, 0x3a, 0x63, 0xd0, 0x9e, 0x6d, 0xec, 0x83, 0x1d, 0x43, 0x38, 0xf0, 0x93, 0x96, 0x87, 0x09, 0x28, 0x95, 0x4a, 0xdd, 0x63, 0x13, 0xfd, 0x7b, 0xc4, 0x2e, 0xf5, 0xef, 0x21, 0x54, 0xea, 0x18, 0x23, 0xdf, 0xd2, 0xb6, 0xaf, 0xc4, 0xb6, 0xeb, 0x6c, 0xb9, 0x5e, 0xbb, 0x67, 0x1b, 0xc1, 0x5f, 0xf9, 0x7d, 0xc4, 0xd2, 0x8e, 0xff, 0xca, 0x80, 0x74, 0x7d, 0x47, 0xb7, 0x2d, 0x2c, 0x87, 0xbb, 0x7e, 0xa6, 0xef, 0x0d, 0x10, 0xe9, 0x60, 0x76, 0xad, 0x74, 0x9a, 0x43, 0x90, 0xc2, 0xd8, 0x0e, 0x5e, 0xea, 0xb6, 0x03, 0xb0, 0xbc, 0x62, 0xa6, 0xb1, 0x5e, 0xc1, 0x32, 0xc3, 0x9a, 0x4c, 0xc8, 0xb6, 0x6d, 0x8b, 0xd3, 0x85, 0x3f, 0x88, 0x28, 0xb7, 0xe6, 0x85, 0x89, 0x3f, 0xb4, 0xd4, 0x5b, 0x46, 0x5a, 0xdb, 0x54, 0xaf, 0xa3, 0xdc, 0x2a, 0xf8, 0xbc, 0x10, 0x89, 0xc3, 0xaa, 0xdd, 0x37, 0x2f, 0x84, 0x41, 0x4c, 0x7c, 0xc6, 0x53, 0x29, 0x5c, 0x15, 0xee, 0x6c, 0xb9, 0xe2, 0x7b, 0x69, 0x19, 0xd9, 0xc3, 0xb3, 0x76, 0xae, 0xef, 0xc2, 0x13, 0xc7, 0xab, 0x17, 0xda, 0xf4, 0x25, 0x9e, 0x85, 0x9d, 0xe1, 0x65, 0xe1, 0xee, 0xb0, 0x86, 0x10, 0x8f, 0x90, 0xbb, 0x88, 0x5f, 0x37, 0x37, 0xa0, 0x42, 0xe1, 0xfe, 0xa9, 0xeb, 0x6c, 0x22, 0x04, 0x9b, 0x1a, 0x40, 0xbd, 0xa1, 0xb3, 0x3d, 0xa0, 0xee, 0xd2, 0x24, 0x61, 0x99, 0x22, 0x86, 0xf7, 0x36, 0x45, 0x50, 0x30, 0x86, 0x1d, 0xec, 0x41, 0x96, 0x88, 0xbb, 0x0c, 0x0a, 0xa0, 0x0e, 0x76, 0xee, 0xa5, 0xda, 0x8e, 0x26, 0xcb, 0x5f, 0xaa, 0xcd, 0xca, 0xf6, 0x47, 0x33, 0xed, 0xd7, 0x78, 0x0f, 0x09, 0xef, 0x12, 0x3a, 0x64, 0x42, 0xad, 0x91, 0x5d, 0x18, 0x2a, 0xb0, 0xa9, 0xa8, 0x06, 0x57, 0xcb, 0xa8, 0x57, 0x3b, 0xe8, 0x72, 0xd1, 0x8b, 0x61, 0xe0, 0x93, 0x65, 0x74, 0x7c, 0x44, 0xc3, 0xc9, 0x63, 0x0d, 0x3e, 0x3a, 0xcf, 0xe6, 0x7c, 0x18, 0x29, 0xf7, 0xdd, 0x87, 0x68, 0x8a, 0x20, 0xcf, 0x27, 0xe1, 0xcd, 0xb5, 0x59, 0x80, 0x9e, 0x3e, 0x2a, 0xd0, 0x65, 0xf7, 0x71, 0x8d, 0x41, 0x82, 0x7c, 0x61, 0x46, 0xa8, 0x12, 0x4b, 0xb5, 0xba, 0xa8, 0xb1, 0xe5, 0x50, 0xd8, 0xe0, 0x65, 0x16, 0x8c, 0x84, 0xf5, 0xc5, 0x91, 0x56, 0x0c, 0x1a, 0xf1, 0xd9, 0xcc, 0x88, 0xfb, 0x59, 0x14, 0x3a, 0xf8, 0x0f, 0x46, 0x1a, 0xe6, 0x50, 0x7c, 0x18, 0xb6, 0xca, 0xc7, 0x47, 0xb2, 0x0d, 0x72, 0x91, 0x2a, 0xd5, 0x6d, 0xa3, 0x3e, 0x9e, 0x8a, 0x92, 0xb7, 0xe3, 0x32, 0xba, 0x3f, 0x07, 0xdd, 0x62, 0xf6, 0xb3, 0x39, 0xb3, 0x08, 0xc7, 0x31, 0xec, 0x5d, 0xf1, 0xec, 0xe0, 0xa8, 0x28, 0x19, 0xc6, 0x8c, 0x9e, 0xe6, 0x58, 0x66, 0xbe, 0xa2, 0xd7, 0x23, 0x71, 0x28, 0x7b, 0x9f, 0x7e, 0xe5, 0x5f, 0xe5, 0x05, 0xf6, 0x0d, 0x81, 0xd0, 0xde, 0x7a, 0xf7, 0x05, 0x02, 0xd3, 0xbc, 0x62, 0xba, 0xab, 0x6f, 0x09, 0xc4, 0x7e, 0x70, 0xe5, 0x3c, 0xbf, 0xea, 0x72, 0x1e, 0xa2, 0x77, 0xe8, 0x7d, 0x21, 0x51, 0xcb, 0xe1, 0x1b, 0xce, 0x08, 0xc8, 0x24, 0x41, 0x9f, 0xdf, 0x8f, 0x12, 0xfe, 0xee, 0x5b, 0x76, 0x1c, 0x7d, 0xbe, 0x67, 0xaf, 0x2f, 0xb7, 0x60, 0xd1, 0x2c, 0xca, 0xb8, 0x34, 0xcb, 0x2c, 0xd8, 0xcf, 0x82, 0xc9, 0xf2, 0x13, 0x60, 0x73, 0xba, 0xec, 0xab, 0x54, 0xba, 0x43, 0x06, 0x72, 0x11, 0x93, 0x8b, 0x17, 0x2c, 0xd3, 0x10, 0xda, 0xb8, 0xaa, 0x06, 0xbd, 0x51, 0x56, 0x2a, 0xe0, 0x11, 0x6b, 0x18, 0xf9, 0x36, 0xa9, 0x67, 0x74, 0x96, 0xd1, 0xae, 0x6a, 0xa2, 0xc5, 0x65, 0x69, 0x19, 0xc2, 0x70, 0x64, 0xb7, 0x37, 0xa1, 0xac, 0xb1, 0x56, 0xb0, 0xec, 0x43, 0x67, 0x50, 0xb6, 0x44, 0xa6, 0x3b, 0x3d, 0xc9, 0x06, 0x4b, 0x25, 0xce, 0x35, 0xe4, 0x61, 0x34, 0x1e, 0x6e, 0xe8, 0x68, 0x85, 0x6a, 0xa1, 0x12, 0x31, 0x3f, 0xac, 0xae, 0x22, 0xbb, 0x39, 0x12, 0xe3, 0x32, 0x59, 0x73, 0x27, 0x08, 0xfb, 0xdc, 0xa1, 0x7f, 0xf5, 0x8a, 0x98, 0x38, 0xbf, 0x83, 0xc2, 0x97, 0xf7, 0x40, 0x02, 0x8e, 0x60, 0xed, 0x0b, 0x47, 0x80, 0xe1, 0xbd, 0xd2, 0x6c, 0x94, 0xfb, 0xd7, 0xab, 0xad, 0xc6, 0xae, 0x4c, 0xf0, 0xc8, 0xd6, 0x5a, 0x0d, 0xea, 0xbe, 0xc1, 0x1e, 0xb6, 0x1a, 0x92, 0x3f, 0x34, 0xd8, 0xa3, 0x56, 0xc3, 0x5c, 0x21, 0x0d, 0xf6, 0xb8, 0xd5, 0xd8, 0x8c, 0x31, 0x9c, 0x4c, 0xc6, 0x3b, 0x84, 0x8d, 0x29, 0x4b, 0x44, 0x53, 0xbf, 0x7b, 0xd4, 0xf9, 0xc3, 0xc3, 0xde, 0x0f, 0xd4, 0xd4, 0xef, 0x7a, 0x4f, 0xfe, 0xc8, 0x57, 0x3b, 0xd4, 0xd8, 0xef, 0xd6, 0x56, 0x3b, 0x7f, 0xfc, 0xc3, 0x1a, 0x35, 0xf6, 0x3b, 0xde, 0x7b, 0x0c, 0xff, 0xa3, 0x76, 0x7e, 0xf7, 0x43, 0xe7, 0xf7, 0x0f, 0xff, 0xb0, 0xda, 0x30, 0x92, 0xe4, 0x6d, 0x47, 0xb7, 0x1a, 0x1f, 0xa5, 0x6f, 0x9a, 0x34, 0x3f, 0x92, 0x29, 0x32, 0x63, 0x61, 0xf9, 0xa5, 0x5f, 0xb1, 0x2a, 0x86, 0xe2, 0xbd, 0x4e, 0xf3, 0x3a, 0xc7, 0xae, 0x88, 0x2a, 0xd9, 0x08, 0xfd, 0x61, 0xf4, 0x85, 0x55, 0xa2, 0xe0, 0x48, 0xd9, 0x1b, 0x73, 0xf7, 0x88, 0xec, 0x8c, 0x37, 0x37, 0xe5, 0xbd, 0x34, 0xc3, 0x4a, 0x6b, 0xb8, 0x62, 0xf2, 0xe7, 0x66, 0x93, 0xc3, 0x9a, 0x26, 0x87, 0xaa, 0xc9, 0xc8, 0x3d, 0xc2, 0x5b, 0xe7, 0xc8, 0x6c, 0x39, 0xf2, 0x00, 0xd2, 0x91, 0x99, 0xeb, 0x8c, 0x76, 0xd8, 0xf6, 0x48, 0xf9, 0x6c, 0xb4, 0x66, 0xec, 0x98, 0x94, 0xbd, 0xa6, 0x34, 0x5f, 0x06, 0xc2, 0x7c, 0xb9, 0xae, 0x64, 0xf8, 0xbe, 0x91, 0xdb, 0xd6, 0x94, 0xe1, 0xfb, 0xec, 0x11, 0x7f, 0xec, 0xad, 0xab, 0x94, 0x2e, 0xb6, 0x04, 0x3f, 0xc2, 0x54, 0x28, 0xe5, 0x05, 0x17, 0x23, 0x43, 0x06, 0x1b, 0xd9, 0x12, 0x17, 0x5a, 0x8d, 0x95, 0xd4, 0x35, 0xe3, 0x0d, 0x32, 0xf2, 0x87, 0x28, 0x2a, 0x0e, 0xfd, 0x91, 0x29, 0x2a, 0x1e, 0xf9, 0x43, 0x53, 0x9e, 0xd5, 0xc7, 0xcd, 0x47, 0xb6, 0x6c, 0x9d, 0xba, 0x43, 0x4b, 0x63, 0x30, 0x64, 0x55, 0x4b, 0xf5, 0x40, 0xe9, 0xb4, 0x13, 0x59, 0x72, 0xde, 0xbc, 0xaa, 0x59, 0x4d, 0xd5, 0xb2, 0x5c, 0xc7, 0x1f, 0x45, 0x64, 0xb2, 0xed, 0xd4, 0x80, 0x67, 0xa9, 0x22, 0xa9, 0x7b, 0x86, 0x37, 0xee, 0x52, 0x5f, 0x9d, 0x8a, 0x8c, 0x39, 0xa7, 0xef, 0x18, 0xfb, 0xba, 0x13, 0x80, 0x8b, 0x1a, 0x00, 0xcc, 0x9e, 0x49, 0xc6, 0x1c, 0x54, 0x34, 0x19, 0x54, 0x8c, 0xea, 0xf0, 0x69, 0xaa, 0x1d, 0x8b, 0xf3, 0xd4, 0x8e, 0x45, 0x1b, 0x84, 0x89, 0x7f, 0x86, 0x20, 0x5c, 0x92, 0xbd, 0x4a, 0x8f, 0x77, 0xd3, 0xbf, 0x34, 0x1f, 0x51, 0x75, 0x32, 0x01, 0xd8, 0x83, 0xcf, 0xe6, 0xf3, 0x96, 0xbf, 0x67, 0xf9, 0x5e, 0xf8, 0x5b, 0xb6, 0x73, 0x8b, 0x6f, 0x6b, 0x55, 0xbb, 0xfe, 0x8e, 0x59, 0x7c, 0xdb, 0xdf, 0xb5, 0x3e, 0x5f, 0xc0, 0x67, 0xf3, 0xf9, 0x4e, 0xc5, 0xe3, 0x62, 0xc6, 0x47, 0xc8, 0x28, 0xfe, 0xae, 0xe2, 0x03, 0x84, 0x3e, 0x42, 0xa6, 0x57, 0x40, 0xc5, 0xa3, 0xe8, 0x3e, 0x2e, 0x42, 0x75, 0xb8, 0x3f, 0x64, 0x2a, 0xef, 0x74, 0x81, 0x52, 0x9d, 0x92, 0x5f, 0x3d, 0xa1, 0x81, 0xc9, 0x4f, 0xa5, 0x3f, 0x1c, 0xf1, 0x4f, 0xfa, 0xba, 0xad, 0xbf, 0x52, 0x24, 0x81, 0x59, 0xf1, 0xa3, 0xfe, 0x04, 0x42, 0xb5, 0x62, 0xc3, 0xf8, 0xe1, 0x1d, 0x7d, 0x30, 0x14, 0x7e, 0x2c, 0x83, 0x6c, 0x01, 0x37, 0xf4, 0x15, 0x59, 0xe1, 0x99, 0x7c, 0xfe, 0x1e, 0x74, 0x10, 0x8f, 0x7d, 0xc2, 0x7a, 0x3f, 0xde, 0x5a, 0x6f, 0x6d, 0xf5, 0xe1, 0x63, 0x8f, 0xe1, 0x05, 0x0f, 0x13, 0x4d, 0xe2, 0x67, 0x1e, 0xd1, 0xfe, 0x2c, 0x5d, 0x55, 0xcc, 0xd7, 0x36, 0x81, 0xb5, 0x17, 0x6d, 0xbd, 0x76, 0xe2, 0x5f, 0x59, 0x7e, 0x26, 0x13, 0xa6, 0x9a, 0x90, 0xf7, 0xed, 0xad, 0xad, 0xe2, 0xf0, 0x41, 0x61, 0xa0, 0xf4, 0x81, 0x68, 0xa4, 0xbc, 0xf4, 0x37, 0xca, 0xfa, 0x9b, 0xfe, 0x04, 0x89, 0xb4, 0x46, 0x83, 0x37, 0x5d, 0x8b, 0x2a, 0x54, 0xf6, 0xaa, 0x5e, 0xc1, 0x4f, 0xdd, 0x2d, 0xea, 0xfd, 0x32, 0x3f, 0xb9, 0x6c, 0xa2, 0xfe, 0x7c, 0x8a, 0x43, 0x3c, 0x34, 0x86, 0xb8, 0x23, 0x87, 0x78, 0x29, 0x66, 0x64, 0x1b, 0x30, 0x55, 0x6c, 0x58, 0x43, 0xdc, 0xb1, 0xd7, 0xd0, 0xae, 0x7f, 0x64, 0x0c, 0x6f, 0xd7, 0x66, 0x1c, 0xbb, 0xac, 0xda, 0x96, 0xe4, 0x1b, 0xbb, 0x33, 0x7c, 0x44, 0x10, 0x4a, 0xcf, 0xbd, 0x24, 0xd5, 0x13, 0x36, 0x84, 0xe1, 0x88, 0xce, 0xca, 0x77, 0x74, 0x3f, 0x1f, 0x30, 0x9b, 0x72, 0x9f, 0xe6, 0x6e, 0x99, 0xcc, 0x9c, 0xe8, 0xde, 0x97, 0xe8, 0x91, 0x4c, 0x1f, 0xae, 0x7e, 0x80, 0xe5, 0x74, 0x57, 0xa9, 0x0f, 0x0a, 0xd4, 0x9d, 0x26, 0xf7, 0xf7, 0x38, 0xa8, 0xbc, 0xbb, 0x0c, 0x7e, 0x7a, 0xf0, 0x4f, 0x81, 0xcf, 0x7b, 0x6c, 0x1b, 0x7f, 0xc2, 0xf3, 0x94, 0x5d, 0x73, 0x99, 0xad, 0x85, 0x15, 0x3a, 0x6d, 0x21, 0xdb, 0xa4, 0x63, 0x7a, 0x93, 0x4e, 0xd4, 0x10, 0xc6, 0x34, 0x04, 0x99, 0xb5, 0x0a, 0x44, 0x15, 0x14, 0xf2, 0xdd, 0xcb, 0x5c, 0xcc, 0xa9, 0x7b, 0xb2, 0xc8, 0x26, 0xa7, 0x9e, 0x39, 0xb3, 0x97, 0xfe, 0x65, 0x44, 0x27, 0x58, 0xb7, 0xf1, 0x1b, 0x73, 0x95, 0x4d, 0x10, 0x21, 0x7b, 0xfe, 0x06, 0x81, 0x3d, 0x6f, 0xa0, 0xda, 0x31, 0x62, 0xd1, 0x83, 0xd1, 0x82, 0xfa, 0x0e, 0x0c, 0x4e, 0x82, 0x5c, 0xe5, 0xde, 0x23, 0x9d, 0x8e, 0xe1, 0x40, 0x4b, 0xa6, 0x28, 0x89, 0x9e, 0xab, 0x1c, 0x0c, 0x5f, 0x9c, 0x70, 0x01, 0x24, 0xb8, 0xe3, 0x7a, 0xd5, 0x98, 0xc4, 0x04, 0x95, 0xba, 0x45, 0x58, 0x05, 0xcc, 0xe3, 0x5c, 0x4b, 0x9c, 0xc3, 0xb2, 0xd5, 0x67, 0x21, 0xbe, 0x6f, 0x1c, 0xc8, 0xd8, 0xbb, 0x6d, 0x11, 0x2b, 0x61, 0xea, 0x2e, 0x1b, 0xce, 0x1c, 0xed, 0xe0, 0x96, 0xe6, 0x64, 0xb2, 0x86, 0x37, 0x23, 0x24, 0xba, 0xbb, 0xb5, 0x01, 0x8a, 0x3a, 0x31, 0xbc, 0x1d, 0x6a, 0x3a, 0x5a, 0x0e, 0x79, 0xde, 0x05, 0xe5, 0x02, 0xe4, 0x19, 0xe7, 0xd5, 0xf1, 0x81, 0x83, 0x72, 0x99, 0x05, 0xd7, 0x4c, 0x27, 0x64, 0x33, 0x51, 0xf9, 0x6a, 0x8a, 0xe5, 0x3f, 0x58, 0xa7, 0xdc, 0x64, 0x14, 0x01, 0xed, 0xab, 0xde, 0xa5, 0xc3, 0xb4, 0xa3, 0x3c, 0x34, 0xdf, 0x89, 0xd1, 0xed, 0x63, 0xec, 0xd9, 0x6e, 0x42, 0xc9, 0x19, 0x45, 0xb8, 0xa8, 0x8a, 0x01, 0xae, 0xe4, 0xe5, 0xd1, 0x6e, 0x1a, 0x8f, 0x4b, 0xc3, 0xc1, 0x2d, 0x41, 0xbf, 0xfb, 0x41, 0x94, 0x74, 0x52, 0x04, 0x1b, 0xa3, 0x96, 0x28, 0xd2, 0x77, 0xc3, 0x08, 0xf7, 0x9b, 0x57, 0x6d, 0x5b, 0x64, 0x46, 0xc2, 0xdc, 0x89, 0x32, 0xf4, 0xfc, 0x0b, 0x2a, 0x8b, 0x44, 0x03, 0x22, 0x0f, 0xcd, 0x97, 0xf7, 0x29, 0xb2, 0x32, 0x7c, 0x41, 0x3d, 0x32, 0x4f, 0x7c, 0x71, 0xad, 0x83, 0x2c, 0xed, 0x8b, 0xbc, 0x1c, 0x5f, 0x0c, 0xe0, 0x71, 0xd4, 0x3d, 0xcf, 0xbf, 0x18, 0xc0, 0x2f, 0xad, 0x25, 0xb1, 0x38, 0xe2, 0xb8, 0x70, 0x66, 0x6a, 0xdd, 0x4a, 0xa6, 0x44, 0x9a, 0x4a, 0x61, 0xfd, 0xa1, 0x31, 0x13, 0x94, 0xfe, 0xd0, 0x4a, 0x33, 0x45, 0xaf, 0x4a, 0xd7, 0xa1, 0x1f, 0xd0, 0x45, 0xe7, 0x9f, 0xfe, 0x9d, 0xf3, 0x82, 0x92, 0xb7, 0x51, 0xa8, 0x37, 0x6e, 0xd1, 0x33, 0x04, 0x59, 0x31, 0x44, 0xad, 0x39, 0x71, 0xbf, 0x65, 0xda, 0xa5, 0x90, 0x46, 0x7f, 0xa8, 0xcb, 0xf7, 0xf4, 0x65, 0x15, 0xab, 0xd5, 0x71, 0x6c, 0x5f, 0x3c, 0xa0, 0xbf, 0xfe, 0xcb, 0xff, 0xf2, 0xff, 0xfc, 0xe7, 0x7f, 0x74, 0xd4, 0x04, 0x1e, 0x4d, 0x72, 0x90, 0x5e, 0x6a, 0xe2, 0xed, 0x6b, 0x96, 0xb9, 0xb9, 0xc2, 0xef, 0x5c, 0xd9, 0xb7, 0x8d, 0xd2, 0xb2, 0xd3, 0x3d, 0xb4, 0x07, 0xfd, 0x48, 0xae, 0xe8, 0x3a, 0x8b, 0x9d, 0x9a, 0xc7, 0x87, 0xa6, 0x01, 0xb6, 0x32, 0x58, 0xbc, 0x42, 0x34, 0x00, 0xbd, 0x18, 0x67, 0xee, 0x3f, 0x38, 0xaf, 0x44, 0xc8, 0x96, 0xf6, 0xf0, 0x9a, 0x35, 0x0c, 0x28, 0x93, 0xe6, 0x06, 0xc5, 0xfa, 0x61, 0x44, 0x63, 0x4b, 0x19, 0x09, 0x46, 0x35, 0xd9, 0xc3, 0xaa, 0xd4, 0x3a, 0xb7, 0x39, 0x99, 0x6e, 0x62, 0xf7, 0xe0, 0xdb, 0x34, 0xb7, 0x79, 0xe0, 0xec, 0x63, 0xa4, 0xc1, 0x3d, 0x1b, 0x9b, 0xe1, 0xf1, 0x5f, 0x82, 0xb9, 0xbf, 0xfe, 0xe3, 0xff, 0x89, 0x24, 0x22, 0xe3, 0x17, 0xf2, 0xfb, 0x20, 0x6f, 0x5f, 0x25, 0xa8, 0x11, 0x39, 0x74, 0x6e, 0x05, 0x73, 0x98, 0x5b, 0x31, 0xc5, 0xf7, 0x18, 0xbc, 0x91, 0xa2, 0xe6, 0x1b, 0xb7, 0x6c, 0xa4, 0x83, 0xf9, 0xe2, 0x96, 0x7f, 0x13, 0x8e, 0xff, 0xf6, 0x97, 0x3f, 0xff, 0x27, 0x95, 0x70, 0x68, 0x49, 0xd8, 0x66, 0xee, 0x83, 0xe7, 0x4a, 0x76, 0x96, 0x6f, 0x43, 0x5b, 0x12, 0x0c, 0x99, 0xa7, 0xe4, 0xdb, 0xb4, 0x39, 0x1b, 0x00, 0xff, 0x8d, 0x67, 0x0e, 0xed, 0x5c, 0x56, 0x18, 0xf9, 0x4c, 0xfb, 0x0d, 0xa3, 0x83, 0x92, 0x25, 0x36, 0xe6, 0x6d, 0x1d, 0xd5, 0xb3, 0x8a, 0xf9, 0x1e, 0x94, 0xbf, 0x5f, 0x35, 0xf9, 0xaa, 0x11, 0x6a, 0x1d, 0x50, 0xd0, 0x7c, 0x0f, 0xf6, 0xd2, 0x81, 0xf6, 0xa4, 0xc4, 0x20, 0x75, 0xe1, 0x28, 0x79, 0x8f, 0xed, 0xea, 0xab, 0x38, 0xfa, 0xdf, 0xfe, 0xf2, 0x9f, 0xfe, 0x0f, 0xe7, 0x18, 0x94, 0x0f, 0x21, 0x9a, 0x7c, 0x23, 0xfe, 0xad, 0x49, 0xd8, 0x90, 0xcc, 0xb0, 0x13, 0x89, 0xf4, 0x1d, 0x69, 0x03, 0xb4, 0x53, 0xa6, 0x68, 0xd1, 0x4c, 0xe4, 0x23, 0xa3, 0xf2, 0x94, 0x7f, 0x83, 0xea, 0x28, 0xbb, 0x61, 0x10, 0x47, 0xc5, 0x44, 0x67, 0x91, 0x18, 0x06, 0x89, 0xc8, 0xd9, 0x01, 0x7b, 0xec, 0x68, 0x44, 0x69, 0xaf, 0x64, 0x22, 0x87, 0xa6, 0xf3, 0x26, 0xe7, 0x22, 0xef, 0x47, 0x0e, 0x2f, 0xea, 0x32, 0x15, 0x60, 0x54, 0xb2, 0x08, 0xe7, 0x8f, 0xd3, 0x7e, 0xd4, 0x75, 0x02, 0x51, 0x5c, 0xe4, 0x01, 0x29, 0x33, 0x42, 0x88, 0xb4, 0x59, 0x22, 0xb9, 0x43, 0x9d, 0x9f, 0xaf, 0x2d, 0x40, 0xd6, 0xfb, 0xe1, 0x1a, 0xc7, 0x19, 0xb7, 0x3b, 0xec, 0xea, 0xd3, 0x06, 0xdb, 0x45, 0xf7, 0x4b, 0xe8, 0xab, 0x41, 0x22, 0x8e, 0xf4, 0x00, 0x2d, 0xb1, 0x6e, 0x78, 0x85, 0x3e, 0xa3, 0xcb, 0xdf, 0x10, 0x6b, 0x1c, 0x7d, 0x70, 0xe7, 0x67, 0x01, 0x19, 0xcd, 0x34, 0x55, 0xf2, 0x6a, 0x40, 0xb8, 0xd1, 0xe4, 0x51, 0x34, 0x1c, 0xc7, 0xe4, 0xe1, 0x5b, 0xe2, 0x0d, 0xa7, 0x04, 0x48, 0x79, 0x98, 0x52, 0x84, 0x1a, 0xa6, 0x8b, 0x00, 0x7a, 0x96, 0xbe, 0xbd, 0xcc, 0x81, 0x75, 0xd7, 0xef, 0xf3, 0x8c, 0x32, 0xb7, 0xa8, 0x44, 0x29, 0x12, 0x14, 0x9a, 0x0e, 0xd0, 0xab, 0x9e, 0xcf, 0x1c, 0x1e, 0xcc, 0x57, 0x6b, 0x76, 0x54, 0xb7, 0x47, 0xa2, 0x5b, 0x53, 0x49, 0x02, 0xfd, 0x6e, 0xf3, 0x6b, 0x9a, 0x52, 0x59, 0xac, 0xac, 0x96, 0xb6, 0xf3, 0xaf, 0x4b, 0xc5, 0x70, 0x90, 0xcf, 0x9c, 0x09, 0xdc, 0xa5, 0x5e, 0xe2, 0x02, 0xd3, 0x46, 0xfc, 0xbd, 0x48, 0x18, 0xf1, 0xc3, 0x98, 0x93, 0xd9, 0xfd, 0x45, 0x8a, 0x69, 0x7a, 0xc8, 0xea, 0xfe, 0x2c, 0x13, 0xc4, 0x4f, 0x66, 0xf7, 0xe7, 0x57, 0xa3, 0x34, 0xa7, 0x87, 0xc7, 0xad, 0xc6, 0x5e, 0xd4, 0xa3, 0xab, 0x0f, 0xd9, 0x93, 0x56, 0xe3, 0x40, 0xe4, 0x64, 0x6a, 0xb0, 0x1f, 0xc4, 0x6f, 0x34, 0xf1, 0xff, 0x1e, 0xf3, 0x5c, 0xaa, 0xca, 0x7f, 0x90, 0x0f, 0xf8, 0xe1, 0x8f, 0xad, 0xc6, 0xb6, 0x4c, 0xeb, 0x04, 0xbd, 0x41, 0xbf, 0x80, 0x14, 0xee, 0x6c, 0xa3, 0xa3, 0x3f, 0x95, 0x5d, 0x83, 0x9e, 0x94, 0x4a, 0x03, 0x4f, 0xd0, 0xbc, 0x8c, 0x34, 0x6c, 0x39, 0x6b, 0x4f, 0xe0, 0x05, 0xf4, 0xf1, 0x82, 0x07, 0xf2, 0xeb, 0x1f, 0xcc, 0xaf, 0x7f, 0x80, 0x17, 0x7f, 0x34, 0x5f, 0xfc, 0x11, 0xc6, 0x00, 0x1d, 0x6c, 0x01, 0xa9, 0x90, 0x77, 0xa5, 0x18, 0xd5, 0x9a, 0x51, 0xe4, 0xe1, 0x9a, 0x79, 0x70, 0x70, 0x9e, 0x57, 0xc3, 0xe6, 0xe9, 0x74, 0x40, 0x86, 0xcd, 0x53, 0x7c, 0x7b, 0x4d, 0xd8, 0x3c, 0xbd, 0x97, 0x51, 0xf3, 0xf4, 0x5e, 0x06, 0xcd, 0x5f, 0x4b, 0x32, 0xc5, 0x18, 0x62, 0x45, 0xba, 0x72, 0x7f, 0xd4, 0x51, 0xc5, 0xad, 0xeb, 0xa1, 0x52, 0xff, 0x40, 0xc2, 0x6b, 0x34, 0x18, 0x2d, 0x10, 0xa1, 0x98, 0xb5, 0x56, 0x59, 0x94, 0x2b, 0x4c, 0x60, 0x15, 0x99, 0x0c, 0x57, 0x08, 0x1c, 0xab, 0x8c, 0xcc, 0x83, 0xea, 0x61, 0x24, 0x95, 0x25, 0xf8, 0x29, 0x8b, 0x91, 0x36, 0xa3, 0x8a, 0xa9, 0x07, 0x6a, 0x8e, 0x34, 0x96, 0x83, 0x6e, 0x41, 0x1d, 0xbc, 0xe3, 0x9d, 0x3c, 0xed, 0x9e, 0x93, 0x8f, 0xa8, 0x30, 0x02, 0xe0, 0xd5, 0xb5, 0x6c, 0x4c, 0x4a, 0x7c, 0xeb, 0x5a, 0x6e, 0x12, 0x50, 0x54, 0x28, 0xbe, 0xf8, 0xbd, 0xf1, 0x2a, 0x95, 0xc9, 0xe0, 0xf0, 0xe0, 0x66, 0x5a, 0x66, 0x06, 0x10, 0x61, 0xb9, 0x30, 0x0a, 0x1d, 0x92, 0x0b, 0xbf, 0x55, 0x08, 0xed, 0x6a, 0x6d, 0x08, 0xee, 0x6a, 0x6d, 0xb8, 0xed, 0xea, 0x4c, 0x68, 0x2d, 0x62, 0x4c, 0xc5, 0xa9, 0xaf, 0xdd, 0x11, 0x44, 0xbb, 0x5a, 0x13, 0x26, 0xbb, 0x6a, 0x44, 0x74, 0xa3, 0x8b, 0x91, 0x71, 0xc6, 0x23, 0x16, 0xc1, 0x62, 0x8d, 0xd7, 0x38, 0xa6, 0x58, 0x45, 0x0e, 0x7d, 0xa6, 0xf2, 0xba, 0x6a, 0xdf, 0xf1, 0x91, 0xbb, 0xe8, 0xb1, 0x82, 0xce, 0x4b, 0x58, 0xa7, 0xd6, 0x0b, 0x7d, 0x7c, 0x67, 0xb6, 0x82, 0xb1, 0x71, 0xb2, 0x23, 0x7b, 0x77, 0xc6, 0xaa, 0x83, 0x23, 0xe8, 0x40, 0x9d, 0xec, 0x8c, 0xef, 0x74, 0x48, 0x37, 0x62, 0x6b, 0xc7, 0xe8, 0x80, 0x7e, 0x56, 0x01, 0x29, 0x21, 0x42, 0x8e, 0x8d, 0xb0, 0xf7, 0x2a, 0x78, 0xc0, 0x38, 0x0b, 0x81, 0xb2, 0x6a, 0xb4, 0xb8, 0x0c, 0xf5, 0x1e, 0xdf, 0x15, 0xea, 0x8d, 0x39, 0x4f, 0xb0, 0x15, 0xc1, 0x69, 0xd1, 0x7e, 0x36, 0x36, 0x82, 0xbd, 0xc7, 0xb7, 0x05, 0x7b, 0x1f, 0xeb, 0x6a, 0x7a, 0xaf, 0xc8, 0x89, 0xcf, 0x1b, 0x51, 0xdf, 0x3a, 0xa7, 0x00, 0x60, 0x23, 0xd6, 0x21, 0xca, 0x32, 0x41, 0x57, 0xb5, 0xdf, 0xaf, 0x8b, 0x52, 0xae, 0x8c, 0x80, 0x70, 0xa9, 0xce, 0xc6, 0x12, 0xe9, 0xda, 0x3f, 0xa8, 0x60, 0x36, 0x23, 0xcc, 0xf6, 0xef, 0xc2, 0xac, 0xca, 0x94, 0x79, 0x86, 0x3c, 0xe1, 0x2b, 0x31, 0x2c, 0xb7, 0x35, 0x01, 0x62, 0x99, 0x7a, 0x13, 0x77, 0xcb, 0x2f, 0x46, 0xb6, 0x55, 0x5d, 0xb5, 0x5c, 0x89, 0xb3, 0x77, 0x96, 0x45, 0xd2, 0x95, 0x5c, 0x6e, 0xc0, 0x7a, 0xdb, 0xd5, 0xfb, 0xb0, 0xbd, 0xf1, 0x9a, 0x33, 0xd4, 0x57, 0x33, 0x64, 0xec, 0xc5, 0xf3, 0xe0, 0xfe, 0xaa, 0xc9, 0xba, 0x05, 0x19, 0xd6, 0xbc, 0x65, 0xf2, 0x4c, 0xb3, 0x74, 0x4f, 0x34, 0xe6, 0x8f, 0xe6, 0x4e, 0xcc, 0xd6, 0x41, 0x06, 0x9b, 0x5e, 0xce, 0x9b, 0x78, 0x11, 0xc8, 0x49, 0x17, 0x1d, 0x0c, 0x5d, 0xef, 0xb4, 0x9c, 0x52, 0xf3, 0xf8, 0xb3, 0xcb, 0x1e, 0x3e, 0xc1, 0x83, 0x90, 0x45, 0xeb, 0x6d, 0x87, 0xad, 0xcd, 0x3f, 0x14, 0x1d, 0xc3, 0x48, 0xac, 0x17, 0x8b, 0x74, 0x4a, 0x6a, 0x1c, 0x15, 0x8c, 0xfd, 0x03, 0xeb, 0x60, 0x63, 0x5c, 0x7b, 0x02, 0xc7, 0x67, 0x4e, 0xe0, 0xda, 0xe7, 0xd5, 0x03, 0x92, 0xe3, 0xfb, 0x9d, 0xc2, 0xdd, 0xe2, 0xc0, 0xb8, 0x57, 0x3d, 0x36, 0xdc, 0xaa, 0x9c, 0xda, 0xe1, 0xb1, 0x9c, 0x51, 0x1f, 0xbd, 0x0c, 0xed, 0x53, 0x39, 0xfb, 0x50, 0x0f, 0x8f, 0xe5, 0xcc, 0xf0, 0x73, 0x7f, 0xdb, 0x8a, 0xc9, 0xad, 0x9c, 0xba, 0xd5, 0x04, 0xee, 0x1b, 0x8f, 0xb3, 0x71, 0xfb, 0x1f, 0x6f, 0x3f, 0x94, 0xfb, 0x54, 0x39, 0x94, 0xb3, 0xe3, 0xfa, 0xf1, 0x54, 0xce, 0x28, 0x5e, 0x17, 0xb7, 0x6f, 0x1f, 0xdb, 0x89, 0xb8, 0x7d, 0xa3, 0x4a, 0x87, 0xfb, 0x76, 0xe4, 0x3e, 0x06, 0xe9, 0xdb, 0xa1, 0xfd, 0x32, 0x4a, 0xdf, 0xc4, 0x58, 0x5d, 0x90, 0x7e, 0x25, 0x90, 0x5f, 0x44, 0xe9, 0x9b, 0x99, 0xcb, 0xb9, 0x7f, 0x31, 0x13, 0x91, 0x6f, 0x07, 0xf2, 0xcb, 0x90, 0x7c, 0xf3, 0x8c, 0xb3, 0x2e, 0x22, 0xbf, 0x12, 0xb5, 0x2f, 0x42, 0xf2, 0x8d, 0x4a, 0x6f, 0xb8, 0x9f, 0xcd, 0x84, 0xdf, 0xdb, 0x51, 0xfb, 0x32, 0xfe, 0xde, 0xa8, 0x24, 0xc2, 0xef, 0x2d, 0x37, 0x5b, 0x5e, 0x39, 0x8f, 0xbd, 0x77, 0xf8, 0xbd, 0x45, 0x6c, 0x73, 0xe2, 0xef, 0xcd, 0x93, 0xd9, 0xfb, 0x86, 0xdf, 0x9b, 0xe7, 0x69, 0x14, 0x7d, 0x6f, 0xbc, 0xb8, 0x3b, 0xf8, 0x9e, 0x6d, 0x73, 0xbf, 0x6b, 0x15, 0x79, 0x5b, 0x8d, 0xa2, 0xc7, 0x48, 0xfb, 0xee, 0x4c, 0xa4, 0x7d, 0x68, 0x63, 0xd7, 0x7f, 0x61, 0x97, 0xf8, 0x15, 0x0b, 0x98, 0x2f, 0xea, 0xc3, 0xd6, 0xad, 0x83, 0x7b, 0x8e, 0xc0, 0x56, 0xe2, 0xd6, 0xc7, 0x56, 0x37, 0x22, 0x6c, 0xdd, 0x4a, 0x62, 0x41, 0x71, 0xeb, 0x46, 0x11, 0xce, 0xfd, 0xcf, 0x76, 0x91, 0x5f, 0xb8, 0xcf, 0xad, 0x22, 0x51, 0xe1, 0xff, 0x62, 0xc7, 0xba, 0x47, 0xc5, 0x4c, 0x06, 0x82, 0xe3, 0x6a, 0x40, 0x3c, 0x8b, 0x0b, 0xff, 0xd8, 0x6a, 0xe7, 0x27, 0xee, 0xc7, 0x36, 0x32, 0x9f, 0x73, 0xff, 0x27, 0xab, 0xc8, 0x7b, 0xee, 0x3f, 0xb7, 0xbb, 0x7a, 0x5f, 0x93, 0x12, 0x83, 0x1a, 0xb6, 0x56, 0x4e, 0xe1, 0x77, 0x0a, 0x8b, 0xd9, 0xc1, 0xaa, 0xb0, 0xbb, 0xba, 0x28, 0xfc, 0x4d, 0xab, 0xab, 0x1f, 0x61, 0x29, 0xd9, 0xc3, 0xf8, 0x71, 0xb6, 0xab, 0xb3, 0x02, 0x31, 0x6a, 0xf9, 0x0f, 0x14, 0xfe, 0x99, 0xd5, 0xd5, 0x62, 0xe1, 0x9f, 0xdb, 0x5d, 0x1d, 0x17, 0xfe, 0xa2, 0x55, 0xe4, 0x0a, 0x00, 0xb6, 0x8b, 0x64, 0x54, 0xc4, 0x7c, 0x33, 0x29, 0xfc, 0xcc, 0xaa, 0x14, 0x14, 0xfe, 0xc4, 0x2e, 0xf2, 0x33, 0xc7, 0x22, 0xd6, 0x1b, 0xff, 0x67, 0x6b, 0x4c, 0xbf, 0x72, 0xff, 0x67, 0xdb, 0x45, 0xba, 0xf0, 0x7f, 0xb5, 0x09, 0x1a, 0x28, 0xbc, 0x92, 0x4d, 0x62, 0x76, 0x2e, 0x8f, 0x0a, 0x6c, 0xd7, 0x22, 0xe0, 0xc2, 0x3f, 0xb2, 0xa0, 0xfb, 0x54, 0xf8, 0x2f, 0x6c, 0x58, 0x3e, 0x17, 0xd5, 0x8c, 0x18, 0xbf, 0x14, 0xfe, 0x67, 0xab, 0xd2, 0x4f, 0x40, 0x48, 0x15, 0x02, 0x28, 0xfc, 0x9f, 0xac, 0x22, 0xef, 0x0b, 0xff, 0xb9, 0xf5, 0xe2, 0xc7, 0xc2, 0x7f, 0x6f, 0xd7, 0xb9, 0x2c, 0xfc, 0x1f, 0xed, 0x37, 0x61, 0xe1, 0x5f, 0xda, 0xd3, 0x5f, 0xf8, 0x61, 0x51, 0x7f, 0xe8, 0x7b, 0x69, 0x6c, 0xaa, 0x2f, 0xf5, 0xa6, 0xda, 0x73, 0x3d, 0x99, 0x38, 0xa8, 0x59, 0xa7, 0x0e, 0x99, 0x1b, 0xee, 0x4b, 0x3c, 0xae, 0x3f, 0x29, 0x1b, 0xf9, 0xc9, 0x7f, 0x8e, 0xbb, 0x2d, 0x87, 0x91, 0x98, 0x20, 0xf4, 0x61, 0x15, 0xd5, 0x82, 0xd0, 0xb7, 0x59, 0x90, 0xdb, 0xe7, 0xf2, 0xa0, 0x1e, 0x6f, 0x3a, 0x24, 0xe1, 0xaa, 0xdd, 0xf8, 0x05, 0x24, 0x29, 0x54, 0xb1, 0x1a, 0x96, 0xe7, 0xf9, 0x5e, 0x81, 0x85, 0x3f, 0x18, 0x67, 0xa8, 0x8b, 0xd7, 0x56, 0x35, 0xc3, 0xa3, 0xb4, 0xd5, 0xb0, 0xbc, 0x6d, 0x41, 0x8e, 0xf2, 0xd8, 0x4f, 0x74, 0x52, 0x6d, 0x42, 0xbe, 0xf9, 0xad, 0x20, 0xb7, 0x75, 0xdb, 0x2f, 0x1d, 0x40, 0xb5, 0xf6, 0x7d, 0xc6, 0x71, 0x5a, 0x3a, 0xd9, 0xef, 0x69, 0x30, 0x6e, 0x99, 0xc2, 0x59, 0x98, 0x52, 0x77, 0x87, 0x95, 0xa4, 0xa0, 0xbd, 0xcf, 0x5e, 0x62, 0x52, 0x82, 0xa6, 0xd0, 0x7d, 0x3d, 0x9f, 0x6e, 0x24, 0x54, 0x77, 0x61, 0xbd, 0x6c, 0x6a, 0x05, 0x18, 0xaf, 0xda, 0xb4, 0x54, 0x60, 0x6c, 0xef, 0x75, 0x15, 0x10, 0x43, 0xb1, 0xc7, 0xef, 0x9f, 0x67, 0x01, 0x55, 0xba, 0xbd, 0x01, 0x9e, 0x91, 0x19, 0x63, 0x2f, 0x3a, 0x31, 0x4a, 0x1b, 0x76, 0x01, 0x72, 0x33, 0xe9, 0xf0, 0x6a, 0x7b, 0xa6, 0x75, 0xc0, 0xc8, 0x87, 0x61, 0x94, 0x28, 0x0d, 0x06, 0x74, 0x73, 0xc5, 0xcc, 0x77, 0x65, 0x43, 0x30, 0x92, 0x5f, 0xcc, 0xb6, 0x4f, 0x96, 0x04, 0x2c, 0xf1, 0xa6, 0xbe, 0x7d, 0xfd, 0x3d, 0x98, 0xf9, 0x6e, 0x19, 0x1f, 0xb0, 0xc8, 0x84, 0xb3, 0x17, 0x6e, 0x9e, 0xb3, 0x6b, 0xb2, 0x8e, 0xb5, 0x1a, 0x7f, 0xfb, 0xcb, 0x9f, 0xff, 0x9b, 0xd2, 0x0e, 0xf8, 0x4c, 0x65, 0x9d, 0x6e, 0x30, 0xe5, 0x64, 0x89, 0x37, 0x6c, 0x8c, 0xa2, 0x15, 0x72, 0x6a, 0xe1, 0xa8, 0xd7, 0xaf, 0x28, 0xd1, 0xbf, 0xc1, 0x84, 0xdb, 0x46, 0xe9, 0x27, 0x2a, 0xe2, 0xb5, 0x5a, 0x0d, 0xd5, 0x9e, 0x79, 0x99, 0x46, 0xb5, 0xe3, 0xbf, 0xfe, 0xcb, 0xbf, 0xc7, 0xa3, 0xa5, 0x8a, 0x79, 0xee, 0xb6, 0x7e, 0x33, 0x59, 0x42, 0xf5, 0xaa, 0x3c, 0x55, 0x55, 0xaf, 0x32, 0xa9, 0xfc, 0xec, 0x55, 0x2f, 0xc9, 0xec, 0x98, 0xff, 0xd9, 0xa9, 0x38, 0x62, 0xdc, 0x31, 0xe6, 0xae, 0x51, 0x4a, 0xf5, 0xaf, 0xbc, 0x66, 0x55, 0xff, 0x9a, 0xf6, 0x67, 0xfa, 0xde, 0x8e, 0xca, 0x61, 0xff, 0xe3, 0x7f, 0xc6, 0x61, 0xdb, 0x81, 0x12, 0xb7, 0xf5, 0x2c, 0x6c, 0x2a, 0x81, 0x2e, 0x69, 0xb9, 0xab, 0xde, 0x55, 0x9c, 0x6e, 0xc7, 0xb1, 0x70, 0xf1, 0x56, 0x90, 0xc8, 0x10, 0xf9, 0x98, 0xc8, 0xa8, 0x48, 0xcb, 0x8a, 0x17, 0xb4, 0x0e, 0xde, 0xe8, 0x8f, 0x46, 0x6a, 0x45, 0xb3, 0xc0, 0x79, 0x59, 0x5d, 0x1a, 0x77, 0xda, 0x0d, 0x79, 0x5a, 0x04, 0xab, 0xe9, 0x99, 0x48, 0x18, 0x1f, 0x52, 0x51, 0x5e, 0x16, 0x55, 0xc9, 0xdb, 0x7e, 0xe1, 0xc6, 0x07, 0xd7, 0xf8, 0x32, 0x93, 0x31, 0x25, 0x22, 0x62, 0xfd, 0xa9, 0x6c, 0xa2, 0x2e, 0x6b, 0xdc, 0x73, 0x6e, 0x14, 0x72, 0xe7, 0x94, 0x9a, 0x69, 0xfa, 0x3d, 0xd5, 0xda, 0x34, 0xf0, 0x50, 0x93, 0x66, 0xee, 0xa2, 0x30, 0x0a, 0xb9, 0x73, 0x4a, 0xcd, 0x34, 0xfd, 0x23, 0x35, 0x7d, 0x55, 0xe8, 0xa6, 0x2b, 0x26, 0xb5, 0xb9, 0xb8, 0x0a, 0xca, 0x2a, 0xd2, 0xe4, 0x36, 0xb7, 0xe8, 0xaf, 0xbc, 0xd2, 0xfa, 0xbc, 0xbc, 0x75, 0x69, 0x61, 0x14, 0x77, 0xef, 0x2c, 0x3f, 0x9b, 0xb4, 0x86, 0xea, 0x7f, 0x2a, 0x21, 0x9b, 0xb1, 0xf0, 0xe1, 0xf7, 0xe7, 0x45, 0xed, 0x06, 0x1f, 0xd9, 0x5a, 0xf3, 0x4b, 0xdb, 0xe7, 0xee, 0x27, 0x7f, 0x3b, 0x37, 0x35, 0xef, 0x9f, 0x58, 0x24, 0xb7, 0x19, 0xda, 0x65, 0x2e, 0x8b, 0x5b, 0x5a, 0x0e, 0xbf, 0xb0, 0xe5, 0xb0, 0xda, 0x32, 0x48, 0x2a, 0x2a, 0x24, 0xef, 0x0c, 0xba, 0x09, 0xeb, 0xbb, 0xc9, 0x67, 0xba, 0x69, 0x9f, 0x1c, 0x60, 0x96, 0xca, 0xc6, 0x91, 0x34, 0x80, 0x95, 0x87, 0x31, 0x98, 0x0e, 0xf8, 0xb4, 0xd5, 0xa8, 0x39, 0x13, 0x6b, 0x88, 0x94, 0x38, 0x9b, 0x65, 0x97, 0x03, 0x24, 0xab, 0xfa, 0x2e, 0x83, 0xb9, 0x5d, 0x1e, 0x97, 0x16, 0x1d, 0xeb, 0xc8, 0xc6, 0xec, 0xd8, 0xfa, 0xe0, 0xb8, 0x6b, 0xab, 0xc3, 0x28, 0xf1, 0x64, 0xff, 0xcf, 0x60, 0x97, 0x55, 0xf8, 0x99, 0x15, 0x07, 0x6e, 0xdd, 0xc5, 0x2d, 0x71, 0xa0, 0x65, 0x8a, 0x0a, 0xd3, 0x0f, 0x28, 0xca, 0x20, 0x7c, 0x7d, 0x4a, 0x40, 0xa4, 0x90, 0xfe, 0xd3, 0x82, 0xef, 0xbf, 0x6c, 0xf2, 0xa5, 0x25, 0x10, 0x3f, 0xf6, 0x18, 0xfc, 0xf2, 0x7f, 0x42, 0xa1, 0x87, 0xde, 0x16, 0x78, 0xc5, 0x68, 0xd1, 0x94, 0x17, 0x4b, 0x84, 0xf8, 0x06, 0x84, 0x1f, 0x6c, 0x81, 0x3e, 0x07, 0xf0, 0x79, 0xd3, 0xfa, 0x1c, 0xf8, 0x7d, 0x58, 0x53, 0x2f, 0xeb, 0x5c, 0x19, 0x59, 0x50, 0xfa, 0x34, 0x4e, 0xca, 0xf4, 0x43, 0xe3, 0x39, 0xb1, 0x7e, 0x87, 0x73, 0x22, 0xde, 0x8a, 0xd2, 0xc3, 0x64, 0xfe, 0x01, 0x1c, 0x5e, 0xb2, 0x45, 0x67, 0xba, 0xd5, 0x5b, 0x00, 0xec, 0x13, 0xde, 0x27, 0xea, 0x80, 0x17, 0x2f, 0x6c, 0xda, 0xfd, 0xca, 0x2c, 0xdf, 0x3b, 0xbf, 0xc5, 0x79, 0xf1, 0xf5, 0x6c, 0xee, 0x19, 0x0a, 0xe9, 0x5b, 0xfb, 0x61, 0xb5, 0x1a, 0xd3, 0x47, 0x87, 0xc0, 0x71, 0x80, 0xf9, 0x78, 0x44, 0xc4, 0x0b, 0xe7, 0xc9, 0xf2, 0x63, 0xba, 0x4d, 0xee, 0xb1, 0x8e, 0xc9, 0x11, 0x11, 0x33, 0x69, 0x92, 0x6a, 0x1c, 0xd9, 0x19, 0x71, 0x54, 0x9c, 0x0c, 0x75, 0xfe, 0x71, 0xa6, 0x73, 0xf3, 0x88, 0xda, 0xee, 0x85, 0x30, 0xfb, 0x0a, 0xf3, 0xca, 0x22, 0x66, 0x2f, 0x02, 0x10, 0x03, 0x60, 0xca, 0xa1, 0x91, 0xfd, 0xea, 0xd9, 0xde, 0xe5, 0x20, 0x2a, 0xb8, 0xf0, 0xa8, 0x18, 0x65, 0x9c, 0x4e, 0x66, 0xeb, 0xe2, 0x75, 0xb0, 0xdd, 0x3f, 0xac, 0xae, 0x6e, 0xa8, 0xc3, 0x7f, 0xc7, 0x4c, 0xce, 0xfc, 0x26, 0xba, 0xed, 0x94, 0x89, 0x22, 0x55, 0xea, 0x4e, 0x99, 0x56, 0x45, 0xee, 0x1b, 0x71, 0x4f, 0x36, 0xeb, 0xeb, 0x08, 0x8b, 0x81, 0xb2, 0x44, 0xcb, 0xab, 0xf3, 0x54, 0xb4, 0xc5, 0xa0, 0x3e, 0xbe, 0x55, 0xd8, 0x68, 0x55, 0xe9, 0x01, 0x7c, 0xd7, 0x5f, 0x30, 0xcf, 0x49, 0xdd, 0x51, 0xc6, 0xa0, 0x62, 0xd1, 0xc6, 0x5d, 0x5e, 0xdc, 0x06, 0x47, 0x76, 0xeb, 0xc1, 0x1d, 0x76, 0x6b, 0x71, 0x44, 0x81, 0x15, 0xd0, 0xde, 0x3b, 0x30, 0xec, 0xd4, 0x83, 0xda, 0x8c, 0xcb, 0xca, 0x80, 0x3e, 0x90, 0x67, 0x21, 0x6c, 0x91, 0x2e, 0x71, 0x3e, 0xe2, 0x85, 0x9b, 0x97, 0x3e, 0xdd, 0x97, 0xcd, 0xf1, 0x38, 0xc2, 0xe4, 0x68, 0x13, 0xff, 0xe4, 0x94, 0x42, 0xdd, 0x65, 0x44, 0x12, 0xe6, 0xd4, 0x1f, 0xa3, 0xa9, 0x3b, 0xf7, 0x16, 0xf1, 0x2e, 0x57, 0x57, 0x96, 0xbc, 0xb9, 0x71, 0xc5, 0x9d, 0xb0, 0xee, 0x25, 0x46, 0x5f, 0x07, 0x61, 0xa8, 0xbe, 0x58, 0x19, 0x3a, 0x36, 0x56, 0xd5, 0x99, 0xcc, 0xa5, 0x7f, 0x02, 0x3c, 0x0d, 0x79, 0x0a, 0xfc, 0x99, 0x9c, 0x36, 0xf3, 0x34, 0x2b, 0x5c, 0x77, 0x93, 0x1d, 0x9a, 0x71, 0xc5, 0x9b, 0x86, 0x87, 0x35, 0x66, 0x5a, 0x41, 0xef, 0x24, 0xd7, 0x5b, 0xd6, 0xdf, 0x0f, 0x6b, 0xbf, 0x7b, 0xeb, 0x09, 0x40, 0x31, 0xa5, 0x03, 0x19, 0x79, 0x8c, 0x24, 0x4c, 0xe7, 0x03, 0xe3, 0x70, 0x83, 0xf0, 0x26, 0x96, 0x99, 0x42, 0xdd, 0x57, 0x99, 0xca, 0x0d, 0xfc, 0x37, 0x30, 0x25, 0x4a, 0x21, 0x8f, 0x32, 0x64, 0xfa, 0x99, 0x70, 0x69, 0xc9, 0xb6, 0x4d, 0x87, 0x78, 0xa1, 0xa9, 0x69, 0xda, 0x1e, 0x31, 0x4c, 0xf9, 0xac, 0xd3, 0xce, 0x84, 0x98, 0x4d, 0x61, 0xb6, 0x06, 0x09, 0x75, 0x53, 0xd6, 0x15, 0x85, 0xfa, 0x50, 0xa8, 0xdf, 0x14, 0xd7, 0xf9, 0x1e, 0xa7, 0x23, 0x5f, 0xfd, 0x7e, 0x41, 0x11, 0xd3, 0x74, 0x6a, 0xa6, 0x72, 0xd8, 0xf4, 0x25, 0xc2, 0xaf, 0x75, 0xe9, 0xd6, 0x80, 0x99, 0xa5, 0x5b, 0x63, 0x26, 0xb2, 0x1e, 0xc9, 0xc7, 0xc5, 0xa9, 0xdf, 0x87, 0x69, 0x1f, 0x03, 0x2b, 0x59, 0x7c, 0xfa, 0x64, 0x3d, 0x73, 0x27, 0xe2, 0xcc, 0x8b, 0x1a, 0xec, 0x00, 0x21, 0x2b, 0xee, 0xaf, 0x12, 0x09, 0x50, 0x42, 0x67, 0xdc, 0x9b, 0x8d, 0xf4, 0xb7, 0x5d, 0xb6, 0x8a, 0x16, 0xf8, 0xb9, 0x07, 0x02, 0x23, 0x8c, 0x3e, 0x72, 0x67, 0x32, 0xe6, 0x5e, 0xe3, 0xd9, 0x00, 0x1d, 0xfa, 0x4c, 0x19, 0x86, 0x43, 0x4c, 0xcb, 0xab, 0xad, 0xab, 0x99, 0x0a, 0x06, 0xfe, 0x21, 0xaa, 0xd8, 0xf3, 0x62, 0x6c, 0x06, 0xb5, 0x16, 0xfe, 0xe8, 0x8e, 0x18, 0x9b, 0xdd, 0x4a, 0xf8, 0x43, 0x64, 0xfa, 0xce, 0x8f, 0x3d, 0x36, 0xaf, 0x5d, 0x97, 0xd3, 0xf8, 0xed, 0x58, 0x8b, 0xea, 0x59, 0xc2, 0x4e, 0xf5, 0x2c, 0xe1, 0xb5, 0xd1, 0xdb, 0xa4, 0xee, 0x82, 0x6f, 0x9a, 0xa5, 0x06, 0x06, 0x77, 0x0c, 0x73, 0x5c, 0x95, 0x7d, 0xff, 0x12, 0x1d, 0xeb, 0x29, 0x30, 0xc3, 0x70, 0xcd, 0x17, 0x50, 0xe4, 0x73, 0x23, 0x3d, 0x2e, 0xa1, 0xf3, 0x8f, 0xd8, 0xb9, 0x5a, 0xe0, 0x9b, 0xa6, 0x6b, 0xff, 0xa1, 0xbf, 0x8f, 0x88, 0xac, 0x89, 0xd2, 0x98, 0xc5, 0x6b, 0x35, 0xeb, 0x82, 0xb2, 0x0f, 0x98, 0xeb, 0x94, 0x6d, 0xc9, 0x40, 0x0d, 0xf8, 0xb2, 0xa9, 0xd6, 0x94, 0x54, 0x4a, 0x0e, 0x69, 0xe3, 0x16, 0xbb, 0xb7, 0x85, 0xd8, 0x81, 0x76, 0xef, 0x7f, 0x56, 0xdd, 0x59, 0xb4, 0x1f, 0xef, 0x97, 0x65, 0x01, 0xbc, 0xc3, 0xeb, 0xb7, 0xb1, 0x21, 0x9d, 0x60, 0xc5, 0x05, 0x97, 0xc2, 0x85, 0xaa, 0xde, 0xb5, 0x47, 0xba, 0xef, 0x89, 0xbb, 0x3e, 0xc8, 0xb3, 0x83, 0x6d, 0xdd, 0x3f, 0x10, 0x1f, 0x4a, 0xbf, 0xba, 0x4f, 0x5a, 0x80, 0xaf, 0xcb, 0x08, 0xf0, 0xce, 0x10, 0x75, 0x4a, 0xff, 0xc3, 0xd9, 0xab, 0x74, 0x85, 0x6b, 0xd6, 0xdf, 0xfe, 0xf2, 0x3f, 0xff, 0x47, 0x54, 0x49, 0xe5, 0xd0, 0x6d, 0x77, 0xfb, 0x47, 0x35, 0xee, 0xbb, 0xe8, 0x89, 0x7c, 0xbb, 0xe3, 0xee, 0x6c, 0xda, 0xc6, 0x6f, 0x99, 0x53, 0xe1, 0x6f, 0x7f, 0xf9, 0x4f, 0xff, 0xde, 0xd9, 0xe7, 0xc3, 0x34, 0x9b, 0x54, 0x21, 0x34, 0x1c, 0x2f, 0xef, 0x20, 0x0b, 0x35, 0x13, 0xe4, 0x86, 0xae, 0x1d, 0x06, 0x85, 0xe4, 0xf0, 0x72, 0xcb, 0x0e, 0x0e, 0xbe, 0x67, 0x53, 0x6f, 0x72, 0xc3, 0x65, 0xf2, 0x37, 0xb5, 0xb4, 0x03, 0xd2, 0xcc, 0xfd, 0x5b, 0x2a, 0x7d, 0xfa, 0x48, 0x1a, 0x33, 0x72, 0x0b, 0x8a, 0x0f, 0x83, 0xe5, 0x87, 0xcd, 0x27, 0xf6, 0x94, 0x90, 0xe8, 0x37, 0xe6, 0x28, 0xb9, 0x89, 0xcf, 0xf5, 0x81, 0xc7, 0xf5, 0xb9, 0x24, 0x95, 0xa0, 0x5c, 0xca, 0x7e, 0x6f, 0x28, 0xd6, 0x15, 0x13, 0x13, 0xfe, 0xdd, 0x7d, 0x3c, 0xf1, 0xbf, 0x35, 0x41, 0xfc, 0xf5, 0x5f, 0xfe, 0x83, 0xb3, 0x7d, 0xf0, 0xe6, 0xb7, 0x13, 0x03, 0xe0, 0x1d, 0x6f, 0x40, 0xeb, 0x4e, 0x2a, 0xc8, 0xdf, 0x7f, 0xf1, 0xf9, 0xab, 0xe6, 0x71, 0x3b, 0xcd, 0x0c, 0x6f, 0x54, 0xd9, 0xc0, 0x9c, 0x76, 0x2c, 0x27, 0x40, 0x1d, 0x97, 0x2f, 0xf2, 0x73, 0x8a, 0x5b, 0x61, 0x0e, 0x81, 0x29, 0x2d, 0x23, 0x4b, 0xc5, 0xc1, 0x3a, 0x63, 0xc4, 0xb9, 0xba, 0x12, 0x0d, 0x99, 0x02, 0x5e, 0x63, 0xa5, 0x05, 0x69, 0x74, 0x0c, 0x7e, 0x7e, 0x74, 0xf0, 0xe8, 0xe1, 0xff, 0x17, 0xf3, 0xf1, 0xb7, 0xbf, 0xfc, 0x4f, 0xff, 0xb7, 0xe8, 0xdd, 0xd9, 0x81, 0x52, 0x83, 0xff, 0x7f, 0x95, 0x7e, 0xf5, 0x2a, 0x15, 0x7a, 0xcd, 0xbf, 0xf2, 0x32, 0x9d, 0xc9, 0xcd, 0xb2, 0xfc, 0xa8, 0x2e, 0x53, 0xa9, 0x88, 0x19, 0x2b, 0xf3, 0xc0, 0xe8, 0xe0, 0xab, 0x9a, 0x7c, 0x30, 0x7f, 0xfb, 0xcb, 0x3f, 0xfd, 0x77, 0x62, 0xf2, 0xd1, 0x59, 0x1f, 0xcd, 0xb2, 0x87, 0xbc, 0xc7, 0xe9, 0xc2, 0x35, 0x91, 0x15, 0xa6, 0x86, 0xf2, 0x2b, 0xba, 0x26, 0xc1, 0xfd, 0x7b, 0xa4, 0x46, 0x95, 0x64, 0x42, 0x46, 0x74, 0x19, 0x94, 0x45, 0xae, 0xe2, 0xfb, 0x5b, 0x0e, 0x99, 0xc1, 0xbd, 0x96, 0xe1, 0xdc, 0xf9, 0xd7, 0x3f, 0xff, 0xaf, 0x7f, 0xfd, 0xf3, 0x3f, 0xc0, 0x7f, 0xce, 0x56, 0x9a, 0x16, 0xb8, 0x41, 0xe2, 0xf5, 0xb1, 0x7f, 0xff, 0xe8, 0xe1, 0xcb, 0x2d, 0xaf, 0xb6, 0xd8, 0x41, 0x90, 0x01, 0x19, 0xd3, 0xf5, 0x6c, 0xb4, 0x80, 0xdc, 0xbf, 0x7f, 0x3c, 0xaf, 0xe8, 0x8e, 0xba, 0xdd, 0xf0, 0x81, 0xf3, 0x8e, 0x77, 0xde, 0xec, 0x42, 0x59, 0x00, 0x03, 0x4a, 0x3b, 0x7f, 0xfd, 0x6f, 0xff, 0x07, 0xe7, 0x17, 0xbc, 0xcc, 0x08, 0xb3, 0x78, 0x90, 0x32, 0xd0, 0x4d, 0x43, 0x5e, 0xdb, 0xc8, 0x5e, 0x54, 0xc0, 0xa2, 0xd9, 0x39, 0x42, 0x0b, 0x38, 0xcf, 0xc5, 0xde, 0xeb, 0x56, 0x9b, 0xc1, 0xf0, 0x5e, 0xf4, 0xb0, 0xb1, 0x33, 0x8c, 0x40, 0x2b, 0xff, 0xd6, 0x31, 0x5a, 0x42, 0x15, 0x5a, 0x54, 0xc5, 0x1b, 0x3a, 0x43, 0x6f, 0x6e, 0x49, 0xed, 0x9e, 0xee, 0xfe, 0xfd, 0x5a, 0x75, 0x70, 0x58, 0xee, 0xcf, 0xb2, 0xdc, 0xb1, 0xb6, 0x27, 0x0b, 0x08, 0xe6, 0x36, 0xae, 0x2a, 0xbc, 0xa6, 0x8b, 0x56, 0x47, 0x0a, 0x85, 0xf9, 0x4a, 0x86, 0xf5, 0xe9, 0x16, 0x11, 0x9c, 0xbc, 0xb9, 0x4c, 0xe8, 0xbf, 0x00, 0x2b, 0xfa, 0xa7, 0xff, 0x8b, 0xee, 0xee, 0xfa, 0xed, 0x3c, 0xc8, 0x0a, 0x08, 0x32, 0xa5, 0xb2, 0x19, 0x1b, 0x49, 0x63, 0xe3, 0xab, 0xf8, 0xc9, 0x51, 0xd4, 0x4f, 0x66, 0xb8, 0x5c, 0xb8, 0x25, 0xc8, 0xc2, 0xfb, 0xaa, 0x26, 0x8d, 0x98, 0xa3, 0x7f, 0x0d, 0x88, 0xf7, 0x37, 0xb7, 0xbf, 0xae, 0xfd, 0xff, 0xb2, 0xe2, 0x81, 0x08, 0x62, 0x52, 0x31, 0xb2, 0xf7, 0xa1, 0x03, 0xeb, 0x96, 0x5a, 0x1c, 0x48, 0xe3, 0xfe, 0x5c, 0x56, 0xd9, 0x00, 0x41, 0x10, 0x7f, 0x69, 0xde, 0xd9, 0x7e, 0x0f, 0x41, 0x1c, 0xb6, 0x4d, 0x99, 0x4e, 0xc8, 0xd9, 0xcc, 0xba, 0x68, 0xf7, 0xea, 0x82, 0x86, 0x35, 0x03, 0xf3, 0x2d, 0x18, 0x92, 0x81, 0x20, 0x5f, 0xbd, 0x6b, 0xd7, 0x72, 0x25, 0xc1, 0x6a, 0x85, 0xc4, 0xed, 0xcd, 0x57, 0x0a, 0x1e, 0x57, 0x94, 0x82, 0xda, 0x80, 0xbd, 0x47, 0x5f, 0xb6, 0xe7, 0x3b, 0xdb, 0x01, 0x54, 0x8c, 0x8a, 0x49, 0x1d, 0x9d, 0x95, 0x61, 0xa1, 0xb0, 0xf1, 0xd2, 0x2a, 0x71, 0xf6, 0xb7, 0xbc, 0xff, 0xaa, 0xa4, 0x82, 0xdb, 0x61, 0xc2, 0xed, 0xda, 0x6a, 0xea, 0xef, 0xea, 0x96, 0xd1, 0x5d, 0xc4, 0x7c, 0xb7, 0xe4, 0xf1, 0xf8, 0x36, 0xed, 0xe0, 0xb1, 0x5d, 0x7a, 0x7e, 0x4e, 0x27, 0xd3, 0xce, 0xab, 0x04, 0x59, 0x32, 0xde, 0xde, 0x92, 0xf7, 0x6a, 0x56, 0xea, 0xfd, 0x61, 0xb5, 0x12, 0x53, 0x65, 0x50, 0x22, 0x61, 0xe4, 0x8e, 0xcd, 0xa4, 0x22, 0x9f, 0xa8, 0x45, 0x6c, 0xca, 0x27, 0xb4, 0xd6, 0xfe, 0xe9, 0xdf, 0x9a, 0x34, 0x2e, 0x2f, 0xe5, 0xca, 0x9d, 0xad, 0x8c, 0x07, 0xe7, 0xb0, 0x96, 0x92, 0x19, 0x31, 0x65, 0xae, 0xf2, 0x7b, 0x8b, 0xb6, 0x6b, 0xc4, 0x57, 0x0d, 0x43, 0x65, 0x33, 0x8f, 0x01, 0xa5, 0x2a, 0xa1, 0x3c, 0xa2, 0xf9, 0x49, 0x25, 0x7b, 0xc0, 0xbd, 0x56, 0x2c, 0x36, 0x4f, 0xc3, 0xf8, 0xdf, 0x70, 0xff, 0x17, 0x43, 0x99, 0x59, 0x9a, 0xf5, 0xd8, 0x15, 0x12, 0x1a, 0x32, 0x1a, 0xd8, 0x9f, 0xa3, 0xa4, 0xe5, 0xac, 0x08, 0x24, 0x9c, 0xa1, 0xbd, 0xb2, 0x59, 0x5c, 0x15, 0xf7, 0xa4, 0xab, 0x5a, 0x6b, 0x8b, 0x91, 0xcd, 0xfe, 0xdb, 0xac, 0xab, 0x6a, 0x8b, 0x7b, 0xd1, 0x30, 0x2a, 0xbe, 0x5a, 0xec, 0x7e, 0x54, 0x23, 0x76, 0xd7, 0x13, 0xff, 0x13, 0x21, 0x73, 0x7f, 0x89, 0xc4, 0x5d, 0xc5, 0x34, 0xd0, 0x3d, 0x5a, 0xc6, 0x01, 0xad, 0x4e, 0x10, 0xe3, 0xf5, 0x92, 0xc2, 0xa8, 0xf2, 0x85, 0x3b, 0xe0, 0x5d, 0x34, 0x24, 0x54, 0x84, 0xdf, 0x46, 0x44, 0xff, 0xce, 0x14, 0xf9, 0x64, 0x60, 0xfb, 0xd7, 0x91, 0x92, 0xf6, 0xba, 0x47, 0xc1, 0x91, 0x4e, 0x13, 0x98, 0x23, 0x3d, 0x37, 0xcc, 0x57, 0xbc, 0xe8, 0x36, 0xbf, 0x21, 0x99, 0x89, 0xbd, 0xe2, 0xbf, 0x4a, 0x62, 0xd3, 0xd3, 0xf7, 0x8d, 0xa8, 0xad, 0xf4, 0x05, 0x99, 0x25, 0xba, 0x7b, 0x99, 0x1b, 0x66, 0xf4, 0x2d, 0x75, 0xb2, 0x4c, 0x9a, 0x23, 0x0d, 0x5f, 0x6b, 0x00, 0x32, 0xb6, 0x6a, 0xf6, 0x43, 0xe9, 0x55, 0x53, 0xf3, 0xd1, 0x76, 0x7e, 0xa9, 0x14, 0xf8, 0x3a, 0x55, 0xe1, 0x91, 0xb5, 0x48, 0x60, 0x18, 0xf3, 0x85, 0xa0, 0xc7, 0x77, 0xad, 0x86, 0x7f, 0xfc, 0x67, 0x32, 0x87, 0xd6, 0x0b, 0x62, 0x8f, 0xef, 0x10, 0x01, 0x4d, 0x85, 0xf5, 0xa1, 0x15, 0xbc, 0x59, 0x23, 0x5a, 0x19, 0x21, 0x97, 0x9b, 0x78, 0xc5, 0x7c, 0x79, 0x15, 0xa4, 0xd4, 0xbb, 0x90, 0x23, 0x33, 0x63, 0x4a, 0x99, 0x0e, 0x3b, 0xf2, 0x9c, 0x28, 0x27, 0xcd, 0x90, 0x16, 0x1e, 0x85, 0xba, 0xea, 0x0e, 0x7a, 0xe5, 0xbe, 0xa6, 0x55, 0x32, 0x34, 0x08, 0xf5, 0x48, 0x8e, 0x1b, 0x92, 0x1c, 0xd7, 0xac, 0xc4, 0x83, 0x0a, 0x45, 0x76, 0x33, 0x87, 0xf6, 0x8d, 0xbb, 0xe8, 0x9d, 0x63, 0xbc, 0x28, 0x98, 0x77, 0x1c, 0xf2, 0x95, 0xea, 0xc1, 0xb0, 0xb0, 0x5b, 0x3e, 0xec, 0xf0, 0x10, 0x4f, 0x87, 0x43, 0x15, 0x7a, 0x0a, 0x10, 0xf4, 0x94, 0x52, 0xec, 0x1e, 0x1c, 0xbe, 0xfe, 0x71, 0xff, 0xf9, 0xbe, 0x47, 0x21, 0xb9, 0x61, 0xca, 0xf3, 0xe4, 0xbb, 0xc2, 0xa1, 0xa8, 0xdf, 0x12, 0x2e, 0x42, 0x51, 0x15, 0x06, 0xd3, 0x5e, 0x60, 0xc0, 0x20, 0xf4, 0x7d, 0x01, 0x3c, 0x9e, 0xcb, 0x07, 0x51, 0x92, 0xeb, 0xee, 0x98, 0x54, 0xc1, 0x03, 0x82, 0x9c, 0x51, 0x9f, 0x16, 0x32, 0x4a, 0x0c, 0x60, 0xe8, 0x8c, 0xa9, 0x50, 0x37, 0xef, 0x0e, 0xff, 0xbe, 0x4d, 0xd0, 0x2e, 0xbe, 0x5e, 0xd0, 0xc6, 0x80, 0x7f, 0x45, 0x5e, 0xb4, 0x48, 0xf2, 0xf9, 0x17, 0x0f, 0xdd, 0x27, 0x20, 0x59, 0x9e, 0x2d, 0x6c, 0xe3, 0x09, 0x21, 0x51, 0x12, 0x9a, 0x04, 0xee, 0x15, 0x9c, 0x5c, 0xbd, 0x85, 0xe8, 0x9f, 0xff, 0x47, 0x4a, 0x09, 0xa2, 0x1b, 0xd2, 0xd9, 0x4d, 0x6f, 0x6f, 0x4b, 0x67, 0x99, 0x85, 0xbd, 0xe4, 0x3f, 0x3a, 0xcf, 0x40, 0x7c, 0xa2, 0xfb, 0x62, 0xef, 0x03, 0x86, 0xce, 0x83, 0x70, 0x4b, 0x94, 0x74, 0xad, 0xa6, 0x25, 0x6d, 0xa3, 0x40, 0x3f, 0x78, 0xb3, 0xd0, 0x3c, 0x0f, 0x0d, 0xca, 0x30, 0x1f, 0x3a, 0x97, 0x03, 0x4e, 0x8b, 0x64, 0xe2, 0x70, 0x4a, 0xc5, 0xe6, 0xac, 0x35, 0x9f, 0xec, 0x6f, 0x49, 0xfa, 0xc3, 0xfa, 0x55, 0x93, 0x07, 0x90, 0xf9, 0x2d, 0x2d, 0x45, 0x85, 0x6c, 0x27, 0x77, 0x1e, 0x3f, 0x59, 0x7d, 0x69, 0x36, 0x64, 0x92, 0x23, 0x01, 0xa4, 0x57, 0x8b, 0xb9, 0x48, 0xc4, 0xd2, 0x98, 0xb7, 0x30, 0x3e, 0x18, 0xae, 0x0b, 0x6f, 0x67, 0x5c, 0x17, 0x64, 0x32, 0x4d, 0xe9, 0xbc, 0x20, 0x9f, 0xa4, 0xfb, 0x02, 0xb9, 0x35, 0x48, 0xf7, 0x05, 0xf1, 0xa5, 0x7a, 0x61, 0x4f, 0x4c, 0x65, 0x32, 0x2b, 0xc1, 0x66, 0xb7, 0xc6, 0xdb, 0x40, 0x2e, 0x12, 0x75, 0x77, 0x49, 0xad, 0xc3, 0xc1, 0x8b, 0xe3, 0xe3, 0x03, 0x71, 0x1c, 0xbe, 0xe0, 0x08, 0xb7, 0x02, 0x3c, 0x33, 0xef, 0x2a, 0x77, 0x03, 0xed, 0x5e, 0x20, 0xaf, 0x07, 0x72, 0xba, 0xe5, 0x85, 0xce, 0x1d, 0xe3, 0xea, 0x9f, 0xcc, 0xed, 0xce, 0xe6, 0xd0, 0xec, 0xce, 0xcf, 0xa1, 0x29, 0x41, 0x73, 0x30, 0x9b, 0x95, 0x91, 0x4b, 0x33, 0xd6, 0x57, 0x01, 0xd5, 0x79, 0x54, 0x54, 0xc7, 0x28, 0x65, 0xde, 0x01, 0x9d, 0xf4, 0x89, 0x51, 0x76, 0x8d, 0xe8, 0xd0, 0x19, 0x90, 0x13, 0x04, 0xf9, 0xde, 0xd7, 0x15, 0xc9, 0xd9, 0x14, 0xad, 0x8b, 0x1b, 0x8b, 0xf0, 0x9a, 0x9c, 0x12, 0xb0, 0x9a, 0x10, 0x38, 0xbc, 0xc7, 0xb8, 0x8f, 0x21, 0x70, 0xb6, 0x53, 0x08, 0x02, 0x96, 0x26, 0x48, 0x39, 0x6e, 0x63, 0x13, 0x48, 0x07, 0xef, 0x41, 0xcf, 0xc7, 0xf2, 0xc7, 0x65, 0x90, 0xd0, 0xdd, 0xec, 0xe4, 0x1c, 0x80, 0x1b, 0x3e, 0x39, 0x1d, 0xb4, 0x81, 0x6f, 0x23, 0x01, 0x0b, 0x0a, 0xea, 0x06, 0x09, 0x9e, 0x0d, 0x74, 0xb8, 0x03, 0xb2, 0x45, 0x9a, 0xf0, 0x66, 0xc3, 0xf3, 0xe6, 0xe3, 0x05, 0xeb, 0xaf, 0x50, 0x73, 0x73, 0x62, 0x26, 0xbf, 0x96, 0x14, 0xe8, 0x18, 0x14, 0x86, 0x20, 0x61, 0x14, 0x20, 0x57, 0xe2, 0x1f, 0x1b, 0x1e, 0xeb, 0xb9, 0x06, 0x65, 0x88, 0x3a, 0xd2, 0x39, 0x83, 0x2a, 0x98, 0xce, 0x19, 0xb7, 0x53, 0xcd, 0x8c, 0xbb, 0x06, 0xf9, 0x5f, 0x7c, 0x15, 0x5e, 0x37, 0xf7, 0xf6, 0x34, 0xd1, 0xd1, 0x9e, 0xec, 0x3c, 0x30, 0xe5, 0x2c, 0xba, 0xc9, 0x4a, 0xe2, 0x9c, 0xc2, 0x37, 0x43, 0x8e, 0xa1, 0xf6, 0x34, 0x1d, 0x83, 0x32, 0x61, 0x14, 0xf1, 0x15, 0x5c, 0xf8, 0xf3, 0x26, 0x04, 0xb1, 0x5b, 0x0d, 0x86, 0x16, 0xbd, 0x8a, 0x09, 0x39, 0x0b, 0xf0, 0xe0, 0xbf, 0x3a, 0x29, 0x5e, 0xdd, 0x7c, 0x18, 0x04, 0x59, 0x92, 0x46, 0xb9, 0xa4, 0x65, 0x27, 0xee, 0xfc, 0xfb, 0xb7, 0x2a, 0x28, 0x37, 0xaa, 0x2b, 0x6a, 0x3e, 0xba, 0xd7, 0x32, 0x23, 0x72, 0x0a, 0xe5, 0x86, 0xf0, 0x8d, 0x99, 0x09, 0xdd, 0xaf, 0x84, 0x19, 0x58, 0xb1, 0x95, 0xad, 0x38, 0xed, 0xb8, 0x27, 0x9d, 0x53, 0x76, 0x8d, 0x79, 0x12, 0x85, 0xa7, 0xe2, 0xca, 0x28, 0x06, 0x61, 0x01, 0xdd, 0x9f, 0x07, 0xfe, 0x65, 0x04, 0xb8, 0xbe, 0x6c, 0xbe, 0x39, 0xdc, 0x6b, 0x76, 0x41, 0xc7, 0x2f, 0xb8, 0xc8, 0x73, 0x08, 0xcf, 0xee, 0x19, 0x7a, 0x8c, 0x28, 0xf7, 0x21, 0xb6, 0xe8, 0x7f, 0xe0, 0xf9, 0xe8, 0xd1, 0x43, 0x52, 0x87, 0xcf, 0x30, 0x5a, 0xb6, 0xcf, 0x8b, 0x1d, 0xa0, 0xce, 0x5f, 0x00, 0x17, 0x80, 0xb1, 0xc5, 0x6b, 0xe9, 0xbd, 0x45, 0x1f, 0xf6, 0x41, 0x20, 0x19, 0xb8, 0xde, 0x83, 0x35, 0x74, 0xaf, 0x0d, 0x29, 0x89, 0x90, 0xfb, 0x90, 0x35, 0x56, 0x1b, 0xd5, 0x82, 0xe4, 0x9a, 0xe4, 0xcd, 0x96, 0x3a, 0xb3, 0x8b, 0xbd, 0x48, 0xc7, 0x59, 0x5e, 0x57, 0xae, 0xd2, 0xad, 0x88, 0xff, 0xbd, 0xbb, 0xe0, 0x91, 0x30, 0x46, 0xd6, 0x15, 0x44, 0x55, 0xff, 0x03, 0x9b, 0xf8, 0x61, 0xda, 0x1d, 0x53, 0x92, 0x15, 0x81, 0x97, 0xe7, 0x31, 0x49, 0xfb, 0x6e, 0x23, 0x80, 0xe9, 0x9a, 0x34, 0x07, 0x19, 0xef, 0xf9, 0x03, 0x36, 0x69, 0xaa, 0x49, 0xf4, 0x17, 0x99, 0xae, 0x81, 0xe2, 0x4e, 0x13, 0xc4, 0x56, 0x9e, 0x84, 0xe4, 0x12, 0xe2, 0x4e, 0x3c, 0x28, 0x49, 0x7e, 0x97, 0xe8, 0x6d, 0x5b, 0xa2, 0x3c, 0xe3, 0x17, 0xe9, 0xb9, 0x81, 0xf2, 0x81, 0x57, 0x69, 0x24, 0xe3, 0xa8, 0x39, 0xaa, 0x46, 0xe6, 0x70, 0x00, 0x05, 0xc2, 0x6f, 0x62, 0x02, 0x46, 0x5c, 0x72, 0xcf, 0xbe, 0xe5, 0xe4, 0xd9, 0xfd, 0x6e, 0x39, 0xa9, 0x09, 0xd5, 0x19, 0x18, 0x37, 0x8b, 0xa8, 0x6b, 0x47, 0xa0, 0xb1, 0x76, 0xe3, 0x50, 0x78, 0x88, 0x42, 0x51, 0xf4, 0xd5, 0x6d, 0xa9, 0x67, 0xf2, 0xe4, 0xee, 0xda, 0xb1, 0xc8, 0xf5, 0x5e, 0xc0, 0x63, 0xdb, 0x1b, 0x69, 0xd1, 0xdf, 0x42, 0x20, 0xf1, 0xfa, 0x94, 0x3a, 0x07, 0xa7, 0x09, 0x0b, 0x3c, 0xb6, 0x38, 0x93, 0xd8, 0xb3, 0xbe, 0x27, 0x37, 0xa2, 0x2c, 0xc7, 0x48, 0x95, 0x33, 0x3d, 0xbe, 0x8a, 0xee, 0xd5, 0x44, 0x7e, 0x07, 0xb0, 0xef, 0x66, 0x81, 0xad, 0xb9, 0xea, 0xe5, 0xae, 0x40, 0xe9, 0x5b, 0xf3, 0xc4, 0xce, 0x84, 0x45, 0x1b, 0x8f, 0xbb, 0x95, 0x64, 0xc4, 0x33, 0x51, 0xd1, 0xaf, 0xbe, 0x2c, 0x57, 0x71, 0x25, 0x2c, 0xfa, 0xe2, 0xcb, 0xae, 0x33, 0xff, 0x64, 0x7e, 0xfe, 0xa5, 0x92, 0xd9, 0x78, 0x36, 0x2a, 0xfa, 0x97, 0x6f, 0x73, 0x9b, 0xf9, 0xe6, 0x7d, 0x6e, 0x33, 0xbf, 0x2b, 0x4e, 0xba, 0xee, 0x32, 0xf3, 0xbb, 0xc2, 0xa4, 0x67, 0x2e, 0x2e, 0x1f, 0xd5, 0x5d, 0x5c, 0x6e, 0x14, 0x11, 0xf7, 0x96, 0x57, 0xa2, 0xa4, 0x2b, 0x17, 0xa2, 0x8b, 0x30, 0x69, 0xa3, 0xd2, 0x57, 0x5e, 0x52, 0x1e, 0x58, 0x2f, 0xae, 0x66, 0xe2, 0x9d, 0x45, 0x94, 0xb4, 0x19, 0xaa, 0x4c, 0x75, 0x2a, 0x41, 0xd2, 0x89, 0x55, 0x64, 0xde, 0x1d, 0xe5, 0x46, 0x91, 0x97, 0x54, 0xc7, 0x8a, 0xae, 0xac, 0x0f, 0x92, 0xbe, 0xeb, 0x8a, 0xf2, 0xca, 0xbd, 0xe6, 0x75, 0x51, 0xd2, 0xdd, 0x99, 0x28, 0xe9, 0xb7, 0x56, 0x11, 0x11, 0x24, 0x6d, 0x52, 0xcc, 0x8b, 0x9a, 0x5b, 0xe1, 0xab, 0x01, 0xe6, 0xbf, 0xfa, 0x6f, 0xcc, 0x46, 0x28, 0x6c, 0xda, 0x5a, 0x43, 0xf5, 0xd7, 0x7d, 0x9b, 0x0b, 0x83, 0x57, 0x62, 0x7c, 0xd7, 0x3f, 0xcd, 0xf6, 0xdb, 0x9b, 0xb9, 0x24, 0x7c, 0xe6, 0x06, 0xf0, 0x6f, 0x19, 0x4a, 0xcd, 0xbf, 0x34, 0x94, 0x7a, 0xfd, 0xa7, 0x59, 0x98, 0x9f, 0xf3, 0x6a, 0x9c, 0xb4, 0x08, 0xaf, 0x36, 0x33, 0x17, 0x14, 0x7e, 0x25, 0xc0, 0xba, 0x33, 0x0b, 0xcf, 0xa8, 0xa8, 0x04, 0x65, 0x7f, 0xcb, 0xf0, 0xea, 0xec, 0x5e, 0xe1, 0xd5, 0xc6, 0x8b, 0xe3, 0x99, 0xd0, 0x69, 0x11, 0x5e, 0x6d, 0x14, 0xc9, 0x0a, 0xff, 0xca, 0x7a, 0x21, 0x82, 0xab, 0xad, 0x35, 0x48, 0x45, 0x2a, 0xd1, 0xd5, 0x81, 0x55, 0xe9, 0xe7, 0x6a, 0x10, 0x34, 0x45, 0x57, 0x9b, 0x2b, 0x83, 0x82, 0xab, 0xcd, 0x31, 0xa5, 0xb3, 0xc8, 0xeb, 0x16, 0xd8, 0xac, 0x95, 0xba, 0xa0, 0xf0, 0xbb, 0x56, 0x47, 0x22, 0xb8, 0xda, 0x0a, 0xe4, 0xa7, 0x22, 0x95, 0xe8, 0xea, 0x4f, 0x56, 0x25, 0x11, 0x5c, 0x6d, 0x16, 0xf9, 0x89, 0x50, 0xf7, 0x6d, 0xa2, 0xab, 0x8d, 0x22, 0x22, 0xb8, 0xda, 0x9a, 0x7d, 0x8a, 0xae, 0xae, 0xdb, 0xee, 0x45, 0x7a, 0x72, 0x72, 0xe0, 0x15, 0x46, 0x3d, 0xf2, 0x83, 0x39, 0x3b, 0xef, 0xb0, 0xed, 0x32, 0x05, 0xbd, 0xf1, 0x19, 0x1d, 0x38, 0xf0, 0x2b, 0xdd, 0xd6, 0xf5, 0xa9, 0xfa, 0x15, 0x24, 0x13, 0x8e, 0x5f, 0x3f, 0x1b, 0x11, 0xb1, 0x56, 0x65, 0x90, 0xa8, 0xce, 0x46, 0x3c, 0xc3, 0x83, 0x39, 0xba, 0x2f, 0x5e, 0x07, 0xb4, 0x62, 0xa9, 0xee, 0x68, 0x8c, 0x2d, 0x08, 0xff, 0xb9, 0xb3, 0xe1, 0xe0, 0x33, 0xec, 0x01, 0x58, 0x64, 0xdf, 0x2e, 0xd2, 0x45, 0x97, 0x38, 0x8a, 0x92, 0x2b, 0xdf, 0x93, 0x69, 0xaf, 0x84, 0x7d, 0x42, 0xf5, 0x8e, 0xaa, 0xdf, 0x15, 0xf0, 0xef, 0xb8, 0x71, 0xdd, 0x7a, 0xf9, 0x59, 0x41, 0x9f, 0x14, 0x46, 0x98, 0xa3, 0x59, 0xdb, 0x84, 0xfe, 0x05, 0x37, 0x82, 0x19, 0x8d, 0x94, 0xfa, 0xb3, 0xd0, 0xc8, 0xc4, 0xfa, 0x9f, 0xcc, 0xc8, 0xc5, 0x59, 0x98, 0x44, 0xb8, 0xe2, 0xb1, 0xf8, 0xcc, 0xd5, 0x3d, 0x02, 0xf8, 0xe5, 0x27, 0xaa, 0xf8, 0xbc, 0xfc, 0x02, 0x72, 0xeb, 0x99, 0x00, 0x06, 0xbe, 0x76, 0xcc, 0x30, 0x43, 0x2e, 0xe3, 0x21, 0x85, 0x56, 0x59, 0x36, 0x21, 0xa2, 0x0a, 0x27, 0x85, 0xee, 0xfb, 0x32, 0xea, 0x45, 0x14, 0xbd, 0x89, 0xef, 0x7f, 0xb6, 0x5f, 0x67, 0xf0, 0x1e, 0x56, 0x4e, 0xcd, 0x97, 0x9c, 0xdc, 0x4b, 0xce, 0xf2, 0x22, 0x23, 0x7f, 0x70, 0x19, 0x1f, 0xf8, 0xa2, 0xd2, 0x6c, 0x34, 0x3a, 0x0b, 0xc2, 0x50, 0x85, 0x24, 0xff, 0x52, 0xf9, 0x3a, 0x0c, 0xba, 0xe6, 0xe7, 0xcb, 0xf2, 0xb3, 0x08, 0xe0, 0x36, 0x02, 0xb6, 0x65, 0x68, 0x9d, 0xfd, 0x59, 0xba, 0x46, 0x00, 0x49, 0x57, 0x82, 0xd2, 0xe8, 0x22, 0x5c, 0x14, 0xe7, 0xe7, 0x11, 0xdc, 0xf4, 0xef, 0x28, 0xdc, 0xcc, 0x2e, 0x58, 0x33, 0xb5, 0x50, 0x4e, 0xad, 0x8f, 0x97, 0x22, 0x41, 0xfe, 0x8f, 0xec, 0x27, 0x8c, 0x42, 0xf3, 0xd8, 0x4b, 0x91, 0x20, 0x7f, 0x9b, 0x43, 0x43, 0xf8, 0x30, 0x27, 0xae, 0x6c, 0x7a, 0x7f, 0x09, 0x9a, 0xdf, 0x21, 0xfe, 0xbe, 0xfc, 0x26, 0xe2, 0xef, 0x1d, 0x97, 0x75, 0xfc, 0x06, 0xf1, 0x77, 0xdb, 0x66, 0x9f, 0x33, 0xcc, 0xf4, 0xbc, 0x22, 0x20, 0xd7, 0xe4, 0x09, 0xba, 0xf5, 0xf2, 0x8e, 0xf3, 0x2f, 0xcb, 0x13, 0x54, 0xb9, 0xbc, 0xe3, 0xdd, 0x6d, 0x97, 0x77, 0x48, 0x81, 0xf8, 0xae, 0x3c, 0x41, 0x5b, 0x5f, 0x25, 0xfd, 0x1a, 0x2f, 0x40, 0xf8, 0xbd, 0xac, 0xc9, 0x11, 0x64, 0x49, 0x0b, 0x24, 0xfd, 0x9a, 0x9a, 0x41, 0x8d, 0xf0, 0x7b, 0x8f, 0x14, 0x41, 0x1f, 0xef, 0x95, 0x22, 0x68, 0x46, 0xf6, 0xbd, 0x2b, 0x43, 0x50, 0x36, 0x93, 0x21, 0xe8, 0x5f, 0x49, 0xf8, 0x4d, 0xee, 0x16, 0x7e, 0xe3, 0x7b, 0x09, 0xbf, 0x33, 0x19, 0x82, 0xcc, 0x3a, 0xf7, 0x4e, 0x11, 0x64, 0xee, 0xa9, 0x24, 0xfb, 0xde, 0x91, 0x21, 0x68, 0xfb, 0xb7, 0x0b, 0xba, 0x6f, 0xee, 0x4c, 0x0f, 0x34, 0xbe, 0x3b, 0x3d, 0x50, 0xef, 0x5e, 0x32, 0xad, 0x29, 0xa1, 0x71, 0xbf, 0x22, 0xd5, 0x1e, 0xcf, 0x8a, 0x7e, 0x71, 0x55, 0x12, 0x96, 0x32, 0xad, 0xd1, 0x8e, 0xc8, 0x0e, 0x64, 0x56, 0x7c, 0x3e, 0xdb, 0xce, 0xfb, 0x99, 0xa4, 0x42, 0x42, 0xa6, 0x35, 0x97, 0x0c, 0x65, 0x07, 0x32, 0x2b, 0x8e, 0x66, 0xe5, 0x34, 0x10, 0x69, 0xdf, 0xf3, 0x6f, 0x23, 0xd2, 0x5e, 0xd4, 0x89, 0xb4, 0x16, 0xc9, 0xd7, 0xcb, 0xb4, 0x77, 0x65, 0x0c, 0xba, 0x87, 0x4c, 0x3b, 0xa9, 0x93, 0x69, 0x6b, 0xf3, 0xe0, 0xec, 0xce, 0x8a, 0x06, 0x24, 0xa3, 0x55, 0xdf, 0x0f, 0x3b, 0xec, 0x82, 0xc4, 0x23, 0xfd, 0x5e, 0xc9, 0x18, 0xaf, 0xcb, 0x94, 0x26, 0xf8, 0x5a, 0xc9, 0x3b, 0xbf, 0x50, 0x00, 0x1a, 0x37, 0x8a, 0xcf, 0x8a, 0x69, 0xf9, 0xbc, 0xcf, 0x3b, 0xf4, 0xf9, 0xd9, 0x1c, 0xe9, 0x64, 0x8b, 0x1b, 0x82, 0x9a, 0xfa, 0x1a, 0xa3, 0x4b, 0xc4, 0x8c, 0x98, 0x66, 0xd7, 0x55, 0xcd, 0x0b, 0x51, 0x2d, 0xbc, 0x5d, 0xbc, 0x11, 0xb2, 0xd8, 0x41, 0x6d, 0x21, 0xdd, 0xd9, 0x39, 0x15, 0xea, 0xd5, 0x16, 0xb2, 0xfb, 0xfc, 0x4c, 0x25, 0x7f, 0xa9, 0x2d, 0xa9, 0x9d, 0x53, 0xa0, 0xc5, 0x63, 0x21, 0xc0, 0x16, 0x75, 0xe5, 0xa4, 0xbf, 0x0a, 0x94, 0x12, 0x29, 0x26, 0xde, 0xd7, 0xb6, 0x56, 0xe6, 0x04, 0xc1, 0x92, 0xa3, 0x5b, 0x44, 0x39, 0x3b, 0x29, 0x07, 0x94, 0xbe, 0xb9, 0x59, 0x25, 0xb1, 0x2e, 0x2b, 0x8c, 0x6b, 0x88, 0x27, 0x85, 0x71, 0x0f, 0x71, 0x50, 0x3e, 0x1c, 0x01, 0x5d, 0x59, 0xf6, 0xc5, 0x9f, 0xf9, 0x9d, 0x06, 0x46, 0x72, 0xe2, 0x69, 0xa0, 0x90, 0xf5, 0xb3, 0x94, 0x46, 0x40, 0x9b, 0x2a, 0x85, 0xa7, 0x19, 0x4a, 0x40, 0xf1, 0x2a, 0x2d, 0x2a, 0x25, 0x66, 0x26, 0x14, 0x4b, 0x75, 0xab, 0xa5, 0xe6, 0xcd, 0x04, 0x16, 0x06, 0xdd, 0xcb, 0x08, 0x67, 0xfc, 0x59, 0x08, 0x64, 0x40, 0x8d, 0xbf, 0x72, 0xf6, 0x33, 0x8a, 0x64, 0x3f, 0x0b, 0x91, 0xec, 0x15, 0x87, 0xce, 0xf1, 0x01, 0xdf, 0x04, 0xf8, 0xe6, 0x13, 0x87, 0x8e, 0xf0, 0xc1, 0x83, 0x36, 0x16, 0x7c, 0x50, 0x04, 0x53, 0x10, 0xad, 0x00, 0x0f, 0x3a, 0x37, 0x00, 0xbc, 0x01, 0x35, 0x0e, 0x2a, 0xdc, 0x9a, 0x1b, 0x80, 0xa5, 0xf3, 0xa5, 0x3a, 0x91, 0x24, 0x69, 0x50, 0x36, 0x19, 0xd1, 0xd5, 0xe2, 0x73, 0xf2, 0x07, 0xbc, 0xa8, 0xcd, 0x1f, 0x80, 0xee, 0xb6, 0x33, 0x31, 0x85, 0xca, 0xe7, 0xd0, 0xf0, 0x37, 0xd4, 0x21, 0x03, 0x6f, 0x46, 0x61, 0x50, 0x70, 0x11, 0x59, 0x18, 0xf5, 0x32, 0x4c, 0x66, 0x6e, 0x3b, 0x0f, 0x0d, 0x96, 0xff, 0xf8, 0x83, 0x0a, 0xb2, 0x37, 0x02, 0x2f, 0xf2, 0xac, 0xeb, 0xaf, 0x8c, 0xa9, 0xf2, 0xc6, 0xd3, 0x15, 0x51, 0xf3, 0x0b, 0x3c, 0xc7, 0xbe, 0x2c, 0xbb, 0xbb, 0xbc, 0x55, 0x08, 0x9d, 0x22, 0xb3, 0x34, 0x9e, 0x93, 0xd8, 0xbd, 0x36, 0x1b, 0xbe, 0x18, 0xed, 0x21, 0xa7, 0x6c, 0x29, 0xe4, 0x88, 0x11, 0x8a, 0xb6, 0x8a, 0x94, 0xdc, 0x5b, 0x26, 0xe5, 0x11, 0x78, 0x77, 0x80, 0xd7, 0x33, 0xe7, 0x0e, 0x65, 0x2c, 0x4d, 0xc7, 0x30, 0x03, 0xf9, 0x20, 0x4d, 0x0b, 0x27, 0xca, 0xf3, 0x31, 0xd0, 0x12, 0x1d, 0xa9, 0xdf, 0x9a, 0x7f, 0xdd, 0x8c, 0xbd, 0xfc, 0x64, 0xdd, 0xff, 0xf4, 0x39, 0xfa, 0xda, 0xec, 0xdc, 0xfa, 0xd8, 0xfd, 0x97, 0xd9, 0x8c, 0x01, 0x6b, 0xe5, 0xa1, 0x3b, 0xc6, 0x90, 0x47, 0x95, 0xf3, 0x2f, 0x11, 0xc9, 0x9c, 0xb8, 0x0d, 0x39, 0x7a, 0xec, 0x4d, 0x0c, 0x1e, 0x57, 0xa6, 0xc7, 0x2a, 0x27, 0x7b, 0x99, 0x28, 0x55, 0x7f, 0x9e, 0xd7, 0x86, 0x66, 0xe4, 0x24, 0x44, 0x78, 0x03, 0xab, 0x6a, 0xb0, 0xe9, 0x1c, 0xc4, 0x1c, 0x50, 0xee, 0x50, 0x53, 0x6b, 0xab, 0xcb, 0x6b, 0x3a, 0xe5, 0x04, 0x22, 0x3b, 0x51, 0x19, 0x29, 0xe0, 0x21, 0xc2, 0x54, 0xf0, 0x7d, 0x3c, 0x5b, 0x6c, 0xb9, 0x89, 0x79, 0x1e, 0x28, 0x5b, 0x53, 0xb0, 0xa9, 0x16, 0x31, 0x73, 0x7e, 0xd0, 0x0f, 0xa2, 0xa4, 0xa9, 0xe2, 0xe3, 0x55, 0xde, 0x82, 0x44, 0x9e, 0x06, 0xb6, 0x80, 0x20, 0xc6, 0x40, 0xd1, 0x78, 0x76, 0x89, 0x39, 0x83, 0xc7, 0x09, 0x3a, 0x2b, 0x71, 0x4a, 0xdf, 0xaf, 0x5a, 0xd3, 0xb1, 0xf5, 0xd3, 0x99, 0xeb, 0x25, 0x63, 0xff, 0x05, 0xaa, 0x43, 0x81, 0x1f, 0x5b, 0xb6, 0x23, 0x3f, 0xb0, 0xcd, 0x94, 0x7e, 0x66, 0x25, 0x47, 0xf3, 0x43, 0x4b, 0x82, 0xf2, 0xfb, 0xb6, 0x69, 0xda, 0xef, 0xd5, 0x6f, 0xb7, 0xa1, 0xa1, 0xaf, 0x0d, 0xe7, 0x1d, 0x57, 0x0c, 0x6d, 0x7d, 0xed, 0xc8, 0xff, 0x64, 0x45, 0x7a, 0x1f, 0xb1, 0xdc, 0xc8, 0xa4, 0x76, 0xc4, 0x3e, 0x88, 0x70, 0x5e, 0xe2, 0x7a, 0x6d, 0x11, 0xdb, 0x4b, 0x17, 0x6a, 0x01, 0xd7, 0x15, 0x0f, 0xea, 0x5e, 0x80, 0x29, 0x2d, 0x03, 0x4c, 0x9d, 0x76, 0xa4, 0x59, 0xce, 0x08, 0xfe, 0xd3, 0x4c, 0x3c, 0x02, 0x26, 0x3e, 0xaa, 0x85, 0x90, 0xcf, 0x40, 0xd8, 0x3e, 0xf9, 0x8c, 0x68, 0x33, 0xa8, 0x4a, 0x66, 0x7d, 0x51, 0x8b, 0x4c, 0xd0, 0x89, 0xce, 0xf4, 0x82, 0xd5, 0x46, 0x25, 0x4f, 0xc3, 0x06, 0x59, 0x3c, 0x87, 0xa7, 0xfd, 0x64, 0xc4, 0x27, 0x7c, 0x21, 0x4f, 0x7b, 0xd8, 0xd8, 0xd8, 0x1e, 0xe7, 0x45, 0x3a, 0x2c, 0xa3, 0xa1, 0xdc, 0xed, 0x9d, 0x77, 0x9e, 0xb3, 0xd6, 0x5c, 0x6d, 0xae, 0x09, 0xfe, 0x36, 0x2a, 0x1b, 0x7c, 0xbc, 0x41, 0xa7, 0xe3, 0xe8, 0x94, 0xe0, 0x28, 0x77, 0xaf, 0xae, 0xa8, 0xaf, 0x18, 0x42, 0xe9, 0xf0, 0xc5, 0x93, 0x01, 0x9e, 0xe7, 0x51, 0x36, 0x1b, 0xf4, 0x68, 0x04, 0x2e, 0x92, 0x66, 0x51, 0x1f, 0xdd, 0x3c, 0x9c, 0x51, 0x96, 0xe2, 0x19, 0xa2, 0xd3, 0x99, 0x38, 0x4f, 0x03, 0xbd, 0xb8, 0xa3, 0xe4, 0xdc, 0xc1, 0x7f, 0xe4, 0x1d, 0x1f, 0x0d, 0x71, 0x68, 0x59, 0x14, 0xa3, 0xbc, 0xb5, 0xb2, 0xd2, 0x07, 0xfa, 0x1c, 0x77, 0x60, 0xbb, 0x1e, 0xae, 0x7c, 0xcc, 0xd2, 0xcb, 0x64, 0xb2, 0xf1, 0x53, 0x9a, 0x04, 0x05, 0xf4, 0xe1, 0x1c, 0xe2, 0xe3, 0xd3, 0x95, 0x60, 0xa3, 0x49, 0x9e, 0x6e, 0x30, 0x00, 0x27, 0x08, 0x61, 0x2d, 0x05, 0xe1, 0x05, 0x42, 0x10, 0xc2, 0x6a, 0x0d, 0xd0, 0xf1, 0x2f, 0xa7, 0x73, 0xfb, 0x68, 0x08, 0xbd, 0x0b, 0x09, 0x02, 0x7d, 0xe4, 0x46, 0x15, 0xa4, 0x3d, 0x9e, 0xb9, 0xed, 0x65, 0x26, 0x28, 0xee, 0x5f, 0xfe, 0xc1, 0xd9, 0x0b, 0x28, 0x7f, 0xf2, 0x8e, 0x6a, 0xd8, 0xbd, 0x20, 0x8c, 0xc9, 0xb8, 0x8a, 0x71, 0x5c, 0x8e, 0x29, 0x2f, 0x96, 0x61, 0x1a, 0xbb, 0x0e, 0xfd, 0x8a, 0x92, 0x3c, 0x0a, 0xb9, 0xb8, 0xc2, 0x5c, 0x3b, 0x68, 0x1a, 0xee, 0xaa, 0x71, 0xa4, 0xdd, 0xe8, 0x2a, 0x77, 0x54, 0x39, 0xdb, 0x03, 0x20, 0x93, 0xbc, 0x44, 0xef, 0xb2, 0x11, 0x49, 0x6a, 0x78, 0x31, 0x5c, 0x44, 0xf9, 0x38, 0x88, 0xa3, 0xcf, 0x81, 0x76, 0x96, 0x53, 0xe2, 0x12, 0x73, 0x84, 0x40, 0x24, 0xbc, 0xeb, 0x4a, 0xb1, 0x87, 0x3c, 0x1a, 0x9e, 0xae, 0x60, 0xd7, 0x46, 0xf7, 0xcf, 0xc5, 0xec, 0x85, 0x8e, 0x15, 0x4b, 0xef, 0xec, 0xeb, 0x48, 0x55, 0x13, 0x12, 0xf2, 0x9e, 0xaa, 0xfa, 0x52, 0x94, 0xbe, 0x16, 0x6b, 0xf4, 0x19, 0x04, 0x0a, 0xdc, 0x2d, 0xb2, 0xc2, 0x13, 0xbc, 0xa6, 0xbc, 0x61, 0x82, 0x9c, 0xb2, 0xc8, 0xbf, 0xb5, 0x02, 0xc4, 0x66, 0xb7, 0x3b, 0xce, 0x90, 0x39, 0x89, 0xa8, 0x1f, 0xe7, 0x38, 0x0b, 0xe8, 0xae, 0x03, 0xb3, 0xef, 0x83, 0x8c, 0x77, 0xa3, 0x5c, 0xef, 0x50, 0xc2, 0x44, 0xe5, 0x00, 0xda, 0xba, 0x98, 0x7b, 0x1b, 0xc7, 0x97, 0x5b, 0xb7, 0xe0, 0x0d, 0xa0, 0xa2, 0x44, 0xcf, 0x4c, 0x7f, 0xaf, 0xb1, 0x72, 0xf4, 0x99, 0x93, 0xcf, 0x5b, 0xbf, 0xd2, 0xd1, 0x21, 0x0f, 0xc7, 0x5d, 0xc1, 0x7c, 0x61, 0x4b, 0x86, 0x01, 0xd1, 0x28, 0x24, 0x35, 0x85, 0x7a, 0x10, 0x84, 0xdd, 0xc1, 0x78, 0x18, 0x24, 0xcb, 0x78, 0x4f, 0x33, 0x45, 0x21, 0xea, 0x0c, 0x0a, 0xb9, 0xe8, 0x72, 0x65, 0x1c, 0xd7, 0xdc, 0x15, 0x73, 0x0f, 0xda, 0xa3, 0x18, 0x69, 0xbc, 0x4e, 0xef, 0x79, 0xb9, 0xb8, 0xf2, 0x6f, 0x47, 0x73, 0x7a, 0xd2, 0xc9, 0xfd, 0xcd, 0x1c, 0xfc, 0x73, 0xe5, 0xfe, 0x76, 0x94, 0xc6, 0x51, 0xf8, 0xd3, 0x91, 0x73, 0x74, 0xb0, 0x29, 0x10, 0x80, 0xd9, 0xe3, 0x32, 0xdc, 0xb2, 0xf2, 0x11, 0xec, 0xb3, 0xd1, 0x05, 0xce, 0x04, 0x1a, 0x29, 0x67, 0x90, 0x6b, 0x13, 0xd2, 0xb3, 0x20, 0x1f, 0x50, 0x92, 0xc7, 0x7a, 0x8a, 0x96, 0x9e, 0x57, 0x46, 0x60, 0x34, 0x75, 0x26, 0xa8, 0xdb, 0x51, 0xf9, 0x16, 0x9d, 0x4e, 0x90, 0xe5, 0x92, 0x9c, 0x61, 0x1e, 0x38, 0xec, 0x9d, 0x04, 0xc1, 0x10, 0x33, 0x9b, 0x75, 0xf3, 0x19, 0x10, 0xb6, 0xd1, 0x53, 0xa8, 0x8f, 0x24, 0x85, 0x13, 0x25, 0x00, 0x32, 0xfb, 0xdf, 0x1a, 0xc3, 0xf6, 0x24, 0x00, 0xe8, 0x5a, 0x45, 0x2f, 0xa2, 0x40, 0xbe, 0x21, 0x47, 0xb2, 0x99, 0x86, 0x77, 0x15, 0x15, 0x1c, 0x15, 0x41, 0x27, 0xc2, 0xeb, 0x70, 0x2c, 0xe4, 0x29, 0xb4, 0xde, 0x7a, 0xe1, 0xcd, 0x90, 0xa3, 0x2c, 0x15, 0xe5, 0xc3, 0x5c, 0x52, 0x16, 0x88, 0x63, 0x71, 0x1c, 0xf5, 0x29, 0x5f, 0x3c, 0xec, 0xfb, 0x63, 0xba, 0x8c, 0xa8, 0x8b, 0xf9, 0x9f, 0x26, 0xb3, 0xc8, 0x05, 0x14, 0x01, 0xa1, 0x6d, 0x01, 0x77, 0x85, 0xa6, 0x9e, 0xf1, 0x51, 0x9c, 0x4e, 0x90, 0x38, 0x4c, 0x30, 0xd4, 0xe5, 0x21, 0xd2, 0xb9, 0xb1, 0xd6, 0xa3, 0x11, 0x19, 0x06, 0x08, 0x12, 0x13, 0x47, 0x08, 0xa9, 0xbf, 0x95, 0x5e, 0x29, 0x2f, 0xe5, 0xd1, 0x90, 0xee, 0xe4, 0xa2, 0xb1, 0xef, 0xab, 0x41, 0xce, 0xb8, 0xca, 0x9a, 0xe2, 0xae, 0x91, 0xbb, 0x0a, 0xb7, 0x2c, 0x25, 0xab, 0xd6, 0x7b, 0x64, 0xbf, 0x48, 0x2f, 0xd1, 0x93, 0x13, 0xaf, 0x85, 0x33, 0x7c, 0x9e, 0x89, 0xb1, 0xdf, 0xb5, 0x26, 0xca, 0xe5, 0x30, 0x8c, 0x29, 0x7c, 0xca, 0xc0, 0xa8, 0x4e, 0xa2, 0x69, 0xf8, 0x30, 0xbf, 0x43, 0xe1, 0x4c, 0x27, 0xf1, 0x17, 0xec, 0xd4, 0x31, 0x58, 0xac, 0x48, 0xf4, 0x4f, 0x4e, 0x8d, 0xc0, 0x03, 0xa9, 0x01, 0x1e, 0x32, 0x71, 0xe1, 0x91, 0x74, 0x0c, 0xa5, 0xdb, 0x7d, 0x82, 0xca, 0x9d, 0x0d, 0x48, 0x5e, 0x30, 0x29, 0x47, 0x94, 0xb6, 0x8d, 0x92, 0xf4, 0x43, 0x0d, 0x79, 0xe1, 0x9c, 0xbe, 0xf8, 0xa7, 0x32, 0xe3, 0xd5, 0xab, 0xb8, 0x0c, 0x57, 0x6f, 0x7b, 0xf1, 0x88, 0x1b, 0x94, 0x64, 0x33, 0xdf, 0xe5, 0xd2, 0x2b, 0x4b, 0x2d, 0x58, 0x92, 0xe9, 0xa5, 0x07, 0x9d, 0x71, 0xb5, 0xd3, 0x65, 0x90, 0x1b, 0x2e, 0x7d, 0x8e, 0x7b, 0xb0, 0xf9, 0xe6, 0xe8, 0xf9, 0xb3, 0x15, 0xfc, 0xb3, 0xfb, 0xea, 0x47, 0x6a, 0x83, 0x7b, 0x33, 0x30, 0xd1, 0x0d, 0xf6, 0xc8, 0x3b, 0xa3, 0xae, 0x01, 0xd2, 0x6e, 0xaf, 0x8e, 0xf0, 0x91, 0xa4, 0x73, 0x0b, 0x37, 0xd5, 0xac, 0x6c, 0x94, 0x9d, 0x10, 0x08, 0x11, 0x21, 0x7c, 0x24, 0x78, 0xa8, 0xdc, 0x39, 0x9c, 0xb5, 0x27, 0xcb, 0x42, 0x60, 0x76, 0x64, 0xea, 0x43, 0x47, 0x85, 0x7e, 0x28, 0xf5, 0x7c, 0x76, 0x85, 0x20, 0xc8, 0xce, 0x7e, 0x90, 0xc0, 0xf4, 0x50, 0x1c, 0x44, 0x09, 0xe0, 0x01, 0xde, 0x7b, 0x8c, 0x61, 0x63, 0xe1, 0x58, 0xb8, 0xee, 0x73, 0x7b, 0x7e, 0xa0, 0xdb, 0x01, 0x5e, 0xb5, 0x63, 0xc1, 0x8f, 0x72, 0x50, 0x52, 0x72, 0x22, 0xb1, 0x8e, 0xc9, 0x5d, 0x58, 0x2c, 0xe7, 0x2e, 0xde, 0x33, 0xcc, 0x01, 0xfb, 0xb8, 0x03, 0x95, 0x98, 0x4c, 0x61, 0x1b, 0x0c, 0xa4, 0xb3, 0xf8, 0x0c, 0xf6, 0xc4, 0xe2, 0x36, 0xe3, 0x09, 0x2a, 0x28, 0xa1, 0xf6, 0x05, 0x6c, 0x34, 0x05, 0xd8, 0xb8, 0x9c, 0x59, 0x07, 0xa9, 0x5b, 0x6c, 0xea, 0xcc, 0xec, 0x50, 0x8d, 0x84, 0x66, 0x98, 0x7a, 0x66, 0x48, 0xb2, 0x54, 0x0b, 0x5b, 0x1c, 0x63, 0x34, 0xad, 0x5e, 0xe4, 0xa3, 0xf2, 0xe2, 0xb2, 0x87, 0x65, 0x54, 0xc1, 0x60, 0x22, 0x54, 0x11, 0x3a, 0x14, 0xca, 0xec, 0xc8, 0x02, 0x8c, 0x24, 0x48, 0x72, 0x12, 0x82, 0x32, 0x1e, 0x47, 0xb4, 0xdf, 0xe9, 0x25, 0x12, 0xaa, 0x45, 0x24, 0xb0, 0xd0, 0xc9, 0xe9, 0x64, 0xb1, 0x90, 0xbd, 0x4b, 0xae, 0x86, 0xf1, 0x10, 0x69, 0x4c, 0x17, 0x52, 0x21, 0x35, 0x20, 0xd2, 0x09, 0xbf, 0xa0, 0x40, 0xa2, 0x9f, 0x76, 0xa6, 0x89, 0x17, 0x71, 0x09, 0x68, 0x18, 0xa9, 0x3b, 0xf3, 0xb0, 0x34, 0xa9, 0x15, 0x46, 0x3f, 0xa0, 0x6b, 0x3a, 0xb0, 0xfb, 0xe0, 0x1e, 0x89, 0x57, 0x6f, 0x64, 0x6a, 0x95, 0x8a, 0x19, 0x6e, 0xde, 0x72, 0xdd, 0x1f, 0x72, 0x20, 0x54, 0x04, 0x56, 0xd6, 0x56, 0x29, 0x77, 0x82, 0xc1, 0x80, 0x84, 0x3e, 0x6c, 0x5f, 0x74, 0x97, 0x0f, 0x35, 0x7e, 0x28, 0x13, 0xed, 0x51, 0x3a, 0xce, 0x48, 0xdb, 0x0e, 0xcd, 0x6b, 0xbd, 0xbe, 0x42, 0xba, 0x1d, 0x46, 0xe7, 0x3c, 0xe6, 0xbc, 0x58, 0xe9, 0x76, 0xcf, 0xf2, 0x5e, 0x7e, 0xd6, 0x05, 0xd9, 0x39, 0xc8, 0xfa, 0xbc, 0xf0, 0xcf, 0x3a, 0x71, 0x90, 0x9c, 0x6f, 0xdc, 0x5a, 0x16, 0xc5, 0xe0, 0x99, 0x41, 0xce, 0x8a, 0xf0, 0x68, 0x77, 0x24, 0x9a, 0x05, 0x7a, 0x4c, 0x72, 0x01, 0x7a, 0x9e, 0xf6, 0x0a, 0xda, 0x04, 0x70, 0xf1, 0x2b, 0x51, 0x1d, 0xf0, 0x3d, 0x0c, 0x80, 0x55, 0x7e, 0x63, 0x49, 0xdd, 0x41, 0x5e, 0x1f, 0x12, 0x55, 0x60, 0xd2, 0x45, 0xd8, 0xd3, 0x83, 0x61, 0xf0, 0x19, 0x49, 0x40, 0xaa, 0x06, 0x79, 0xd3, 0xd9, 0x2d, 0xe4, 0x22, 0x4b, 0x52, 0x00, 0x69, 0x02, 0x4a, 0x04, 0x2c, 0xbe, 0x88, 0x40, 0x0a, 0xe0, 0x27, 0xd0, 0x1a, 0x79, 0xf2, 0x23, 0x47, 0x90, 0xbc, 0x12, 0xe8, 0x7a, 0x2b, 0xea, 0x1f, 0xc3, 0xd8, 0x8e, 0x61, 0x9f, 0x11, 0x93, 0x7d, 0xab, 0x06, 0x84, 0x79, 0x32, 0xc4, 0xe4, 0x6e, 0x67, 0x3c, 0x8c, 0x0a, 0x79, 0x5f, 0x2a, 0xae, 0x04, 0x5c, 0x12, 0xf3, 0x07, 0x6c, 0xcd, 0x88, 0x33, 0x6f, 0xf8, 0x3f, 0x8f, 0xa3, 0x24, 0x79, 0x06, 0x4b, 0x01, 0x56, 0x46, 0xbc, 0xf2, 0xba, 0x5b, 0xa4, 0x94, 0xaf, 0xf8, 0xff, 0xad, 0xed, 0xe8, 0x7a, 0xda, 0x86, 0x81, 0xef, 0xfb, 0x15, 0x11, 0xe2, 0x01, 0xa4, 0x86, 0x4c, 0x6c, 0x0f, 0x13, 0x28, 0x91, 0x58, 0x61, 0x7c, 0x68, 0x5a, 0x8b, 0x02, 0x8c, 0x6d, 0x9a, 0x98, 0x93, 0x96, 0xd6, 0xa3, 0x71, 0xa2, 0x38, 0xa1, 0xaa, 0x10, 0xff, 0x7d, 0x77, 0xf6, 0x25, 0xb5, 0x93, 0xd2, 0xa1, 0x35, 0x7b, 0xa9, 0xe2, 0xf8, 0xd2, 0x3b, 0xdb, 0xe7, 0xf3, 0x9d, 0xed, 0xbb, 0x73, 0xf1, 0xe9, 0x04, 0xa7, 0xba, 0x62, 0xef, 0xc0, 0x2e, 0xaa, 0xee, 0x71, 0x1d, 0x58, 0x9f, 0x98, 0x12, 0x1e, 0x53, 0x58, 0xdf, 0x40, 0x02, 0x22, 0xcf, 0xf7, 0x01, 0x35, 0x2b, 0x73, 0xee, 0xf4, 0x59, 0x1e, 0x41, 0xd5, 0xbc, 0x0a, 0xf5, 0x89, 0xbd, 0x56, 0xa4, 0x31, 0xee, 0xf2, 0x54, 0x42, 0xe5, 0x9f, 0x68, 0x07, 0xb9, 0x31, 0x4d, 0x40, 0x3c, 0x82, 0xd4, 0x5b, 0xc8, 0x07, 0x3e, 0x9b, 0xed, 0x51, 0x6b, 0x78, 0xea, 0x0d, 0x80, 0x53, 0x2a, 0x02, 0xbc, 0xc0, 0x2c, 0x11, 0xc5, 0x13, 0x0c, 0x6d, 0x06, 0x23, 0xc9, 0x97, 0xb1, 0xa7, 0x1c, 0x16, 0xe1, 0xe4, 0xc3, 0x89, 0xda, 0xa0, 0x7d, 0x43, 0x42, 0x8d, 0x4e, 0x8e, 0x23, 0x50, 0xd9, 0x60, 0xb8, 0xbd, 0xf0, 0xb8, 0x3f, 0x74, 0x95, 0xb2, 0xe1, 0x6a, 0x6b, 0xda, 0xa5, 0xad, 0x2f, 0x77, 0x48, 0xbd, 0xe3, 0xde, 0xbc, 0x03, 0x2b, 0xed, 0xad, 0x57, 0x00, 0x87, 0x78, 0x18, 0x66, 0x3c, 0xd0, 0xba, 0x89, 0xbd, 0x53, 0xe6, 0x0c, 0xeb, 0xce, 0x54, 0xed, 0xfa, 0x1a, 0x2a, 0x87, 0x25, 0xac, 0xa9, 0xba, 0x59, 0x05, 0xd1, 0xc0, 0x39, 0x41, 0x8c, 0xf7, 0xdf, 0x1a, 0x17, 0x61, 0x75, 0x3c, 0x4d, 0x85, 0x77, 0x94, 0x8f, 0x80, 0x9b, 0xd2, 0x0b, 0x50, 0x3f, 0x83, 0xea, 0x39, 0x1c, 0x7c, 0x21, 0x1a, 0xf1, 0x11, 0xfe, 0x3e, 0xca, 0x99, 0xa9, 0x1c, 0x6e, 0x8a, 0x3d, 0x19, 0xbb, 0x22, 0x75, 0xc1, 0xb2, 0xf2, 0x4e, 0x40, 0xdf, 0x47, 0xeb, 0x09, 0xb5, 0x14, 0x0c, 0x09, 0x92, 0x07, 0xad, 0x37, 0x44, 0x09, 0xf2, 0x24, 0x95, 0xbb, 0x22, 0xe3, 0x33, 0x7c, 0x21, 0x41, 0x2f, 0x7c, 0xef, 0x31, 0xdd, 0xf0, 0x5a, 0x57, 0x92, 0xc1, 0x52, 0x6d, 0xea, 0xab, 0x48, 0x87, 0x06, 0x15, 0x1a, 0xa2, 0x3b, 0x32, 0xf2, 0x34, 0x2a, 0x60, 0x4a, 0x30, 0xe0, 0x18, 0xef, 0xfa, 0xfa, 0xfc, 0x38, 0xc0, 0x1f, 0xc2, 0x87, 0xe1, 0x30, 0x3b, 0x44, 0xc5, 0x16, 0xa5, 0x9c, 0x4a, 0x30, 0x96, 0x13, 0xf6, 0x61, 0xdf, 0x43, 0x26, 0x63, 0xa2, 0x18, 0x5c, 0x1d, 0x05, 0xcb, 0x47, 0x42, 0x5c, 0x6b, 0xee, 0x5a, 0x61, 0xdf, 0xb4, 0xd7, 0xe7, 0xf3, 0xf9, 0x9e, 0x44, 0x13, 0xef, 0xb7, 0x54, 0x84, 0x04, 0xca, 0xde, 0x73, 0x2f, 0xc2, 0x0a, 0x5d, 0xae, 0x76, 0x89, 0x47, 0x1d, 0xf1, 0x5a, 0x01, 0x1a, 0x00, 0xde, 0x2f, 0x8f, 0x25, 0xa1, 0xbb, 0xa2, 0x17, 0xfd, 0xb0, 0xc2, 0x08, 0x55, 0x8e, 0xda, 0x27, 0xd7, 0x79, 0x9f, 0x37, 0x42, 0x37, 0x62, 0x5c, 0x2e, 0x4a, 0xae, 0x51, 0x1d, 0x63, 0x01, 0xad, 0x5c, 0x3d, 0x80, 0xbc, 0x33, 0x2c, 0x8f, 0xbc, 0x18, 0x43, 0xf7, 0xe1, 0xb4, 0x09, 0x6e, 0x78, 0x31, 0x6e, 0x76, 0x5d, 0x84, 0x56, 0x26, 0x88, 0xf4, 0x8d, 0xa5, 0x35, 0x0e, 0x16, 0xba, 0x49, 0xc8, 0x38, 0xe7, 0x59, 0x01, 0xf5, 0x93, 0xbd, 0x34, 0x9f, 0x40, 0x27, 0xc2, 0xbb, 0x50, 0xbd, 0x23, 0xd4, 0x4a, 0x4b, 0x65, 0x49, 0xa2, 0xb6, 0xce, 0x01, 0xac, 0x54, 0xce, 0x80, 0x1b, 0xe1, 0xce, 0x40, 0xbb, 0x42, 0x31, 0xcf, 0x53, 0x8d, 0x73, 0x48, 0xe5, 0xf3, 0x01, 0xe1, 0xec, 0xac, 0x95, 0xc6, 0xb4, 0x00, 0x93, 0x05, 0x95, 0x6d, 0x7e, 0x5f, 0x09, 0x02, 0x57, 0xf9, 0x78, 0x54, 0xf2, 0xb0, 0x8a, 0x95, 0xa6, 0xf0, 0x1b, 0xef, 0x9c, 0x4f, 0x1d, 0x8d, 0xac, 0x29, 0x98, 0xf9, 0x04, 0x57, 0x11, 0xb5, 0xf0, 0x48, 0xb5, 0xe6, 0x54, 0x4a, 0xaf, 0x5b, 0x2b, 0xa3, 0x6e, 0x92, 0x8e, 0xca, 0xd9, 0x98, 0x16, 0x99, 0x3a, 0x47, 0x42, 0x6d, 0x59, 0x62, 0x06, 0x70, 0xa8, 0xaf, 0x67, 0x72, 0x4b, 0x69, 0xd6, 0xdf, 0xff, 0xda, 0xed, 0xdd, 0xb6, 0xc2, 0x4c, 0xae, 0x31, 0x97, 0x49, 0x5b, 0x5d, 0x6f, 0x99, 0xab, 0xad, 0x8e, 0x57, 0x84, 0x89, 0x7c, 0x29, 0xcb, 0xbb, 0x4e, 0xeb, 0xbe, 0xef, 0x58, 0xe1, 0xc3, 0x28, 0xc6, 0xce, 0xea, 0x44, 0xcf, 0x4c, 0x48, 0x34, 0x5a, 0xa5, 0x91, 0x3a, 0xda, 0x59, 0x9b, 0x19, 0x1a, 0x3f, 0x40, 0x32, 0x8b, 0xd7, 0x83, 0xa3, 0xff, 0x67, 0x0d, 0x6d, 0x1e, 0x04, 0x9d, 0xae, 0xf6, 0xbf, 0x5c, 0x9d, 0xdd, 0xae, 0x76, 0x83, 0x12, 0x0d, 0x37, 0xa8, 0x47, 0x4d, 0xbe, 0x76, 0x80, 0x12, 0x86, 0x9f, 0x21, 0x27, 0x40, 0xb1, 0x74, 0x8d, 0xe4, 0xb5, 0x9f, 0xa1, 0xf8, 0xab, 0x9f, 0x21, 0xfd, 0xaf, 0xd2, 0x9c, 0x0e, 0xb6, 0x7a, 0x62, 0xf7, 0xd9, 0x8a, 0x87, 0x2b, 0xfc, 0x0b, 0x3c, 0x3c, 0xe0, 0xbe, 0xb0, 0xae, 0xeb, 0xfb, 0xdc, 0xba, 0x23, 0xe4, 0xcf, 0xec, 0xab, 0x0f, 0x2b, 0x8e, 0x64, 0xcc, 0x32, 0x9e, 0xc9, 0xac, 0x4a, 0x57, 0xd3, 0x08, 0x03, 0xcb, 0x0d, 0x3a, 0xee, 0x5f, 0x3a, 0xe0, 0xb8, 0xb7, 0x8f, 0x60, 0x32, 0xff, 0x16, 0xe9, 0x4d, 0xfc, 0xcc, 0xba, 0x5b, 0xe4, 0x27, 0xf6, 0x15, 0x20, 0x3f, 0xb4, 0xae, 0x79, 0x59, 0x1e, 0x3b, 0x87, 0x51, 0xfb, 0x8e, 0x08, 0x00, 0x58, 0xbe, 0x14, 0xfe, 0x9d, 0xf9, 0xc1, 0xb4, 0xf5, 0x41, 0x69, 0x7b, 0xf9, 0xf4, 0xb6, 0xfd, 0x72, 0xc5, 0xfd, 0xdb, 0xed, 0x46, 0x83, 0xe3, 0xe5, 0xdd, 0x0c, 0x5a, 0x5a, 0xef, 0x68, 0x78, 0xea, 0x6b, 0x84, 0x77, 0x35, 0x88, 0x12, 0x72, 0x18, 0x11, 0x63, 0x5c, 0x57, 0x96, 0x8d, 0x4a, 0xdc, 0xa0, 0xa0, 0xca, 0xac, 0x71, 0x74, 0x2d, 0x54, 0x59, 0x73, 0xd0, 0x25, 0x5f, 0x7a, 0x70, 0x81, 0xf8, 0x21, 0xf7, 0xad, 0x8f, 0x8b, 0xf3, 0xd1, 0xce, 0x56, 0x9e, 0xa6, 0x05, 0xf0, 0x5c, 0xa6, 0x8f, 0xe1, 0xce, 0x76, 0xbe, 0x8b, 0xde, 0x13, 0xbe, 0x3b, 0x90, 0xbc, 0x07, 0xb0, 0x4e, 0x8c, 0xed, 0xc9, 0xc7, 0x30, 0x14, 0x14, 0x9d, 0xfc, 0xc7, 0xd9, 0x4e, 0x59, 0xf4, 0x9e, 0x32, 0x86, 0x5e, 0xab, 0x1e, 0xe6, 0x3a, 0x49, 0xb2, 0x54, 0xe0, 0xa6, 0xc7, 0x83, 0x04, 0xce, 0xb2, 0x6a, 0x29, 0x43, 0xeb, 0x7a, 0x98, 0x2a, 0xfd, 0xaa, 0x01, 0x35, 0xe2, 0x4d, 0x28, 0x15, 0xd9, 0xdc, 0x80, 0xb8, 0x6e, 0x41, 0xc8, 0x85, 0x24, 0x4f, 0x5d, 0x03, 0xec, 0xa6, 0x05, 0xa6, 0x55, 0x19, 0x13, 0xe6, 0x5b, 0x0b, 0x46, 0x19, 0x16, 0x26, 0xc8, 0x29, 0x80, 0xfc, 0xc4, 0x79, 0x73, 0xc9, 0x77, 0x0f, 0xdf, 0xfc, 0x01, 0xd6, 0xcb, 0x1c, 0x8d, 0x04, 0x40, 0x01, 0x00
 };
-const size_t webui_css_gz_len = 9988;
-const char webui_css_mime[] = "text/css";
-const bool webui_css_compressed = true;
 
+// /index.html, 413 bytes, 285 gzipped
+const uint8_t webui_asset_2[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x5d, 0x91, 0xcb, 0x4e, 0x03, 0x31, 0x0c, 0x45, 0xf7, 0xfd, 0x0a, 0x93, 0x35, 0xf3, 0x80, 0x15, 0x8b, 0xc9, 0x48, 0x3c, 0x5a, 0x58, 0x20, 0x81, 0xd4, 0x41, 0x82, 0x65, 0x48, 0xcc, 0xc4, 0x25, 0x93, 0x54, 0x89, 0x99, 0xb6, 0x7c, 0x3d, 0x69, 0xa7, 0x88, 0xc7, 0x2a, 0xb6, 0x72, 0x72, 0xae, 0xe5, 0x34, 0x27, 0x37, 0x0f, 0xd7, 0xdd, 0xcb, 0xe3, 0x1c, 0x2c, 0x0f, 0xae, 0x9d, 0x35, 0xfb, 0x03, 0x9c, 0xf2, 0xbd, 0x14, 0xe8, 0x45, 0x3b, 0x03, 0x68, 0x2c, 0x2a, 0xb3, 0x2f, 0x72, 0x39, 0x20, 0x2b, 0xd0, 0x56, 0xc5, 0x84, 0x2c, 0xc5, 0x53, 0xb7, 0x28, 0x2e, 0x04, 0x54, 0xbf, 0x2f, 0xbd, 0x1a, 0x50, 0x8a, 0x91, 0x70, 0xb3, 0x0e, 0x91, 0x05, 0xe8, 0xe0, 0x19, 0x7d, 0x86, 0x37, 0x64, 0xd8, 0x4a, 0x83, 0x23, 0x69, 0x2c, 0x0e, 0xcd, 0x29, 0x90, 0x27, 0x26, 0xe5, 0x8a, 0xa4, 0x95, 0x43, 0x79, 0x56, 0xd6, 0x3f, 0x32, 0x26, 0x76, 0xd8, 0xce, 0x1d, 0xf6, 0x21, 0xc0, 0x33, 0x5c, 0x51, 0xdf, 0x45, 0xc4, 0x0e, 0xb5, 0x85, 0xe5, 0x62, 0x09, 0xe7, 0x65, 0xdd, 0x54, 0x13, 0x33, 0xf1, 0x49, 0x47, 0x5a, 0x33, 0xf0, 0x6e, 0x9d, 0xe3, 0x87, 0x60, 0x3e, 0x1c, 0xe6, 0xf0, 0x18, 0x52, 0x0a, 0x91, 0x7a, 0xf2, 0x90, 0xa2, 0x96, 0xa2, 0x52, 0x29, 0x4f, 0x9e, 0x2a, 0xf2, 0x06, 0xb7, 0xc5, 0xa7, 0xe7, 0xbb, 0xfb, 0xd1, 0xcf, 0xcb, 0x55, 0x12, 0x6d, 0x53, 0x4d, 0x8a, 0xa3, 0xcf, 0x91, 0x7f, 0x87, 0x88, 0x4e, 0x8a, 0xc4, 0x3b, 0x87, 0xc9, 0x22, 0xf2, 0x5f, 0xa1, 0x8d, 0xf8, 0xf6, 0xdf, 0x68, 0xb7, 0xee, 0xb2, 0xf6, 0xab, 0xdb, 0x52, 0xa7, 0x34, 0x2d, 0xaf, 0xfa, 0xde, 0x5e, 0xf3, 0x1a, 0xcc, 0xee, 0x28, 0x37, 0x34, 0x02, 0x19, 0x29, 0x62, 0x08, 0xbc, 0x4f, 0xce, 0xfd, 0x04, 0x4f, 0x4c, 0x7e, 0x74, 0xf8, 0x8c, 0x2f, 0xb7, 0x35, 0xad, 0x1f, 0x9d, 0x01, 0x00, 0x00
+};
 
-// Auto-generated from index-zntHLvnE.js
-const uint8_t webui_js_gz[] PROGMEM = {
-    0x1f, 0x8b, 0x08, 0x00, 0x4e, 0x90, 0x12, 0x69, 0x02, 0xff, 0xec, 0xbd, 0x6b, 0x6f, 0xe4, 0x48, 0xb2, 0x28, 0xf6, 0x57, 0xa8, 0x5a, 0x1d, 0x0d, 0x39, 0x9d, 0x2a, 0x49, 0xfd, 0x98, 0xdd, 0x2d, 0x35, 0x55, 0x90, 0xd4, 0xad, 0x69, 0x4d, 0x4b, 0xdd, 0x1a, 0x49, 0xfd, 0x98, 0xd1, 0xea, 0xaa, 0x59, 0xc5, 0xac, 0x2a, 0xb6, 0x58, 0x64, 0x35, 0xc9, 0x92, 0x54, 0x2d, 0xd5, 0xc1, 0xc1, 0x85, 0xe1, 0x0f, 0xd7, 0x30, 0x8e, 0xed, 0xb3, 0xf0, 0x81, 0x0f, 0x6c, 0xec, 0xbd, 0x06, 0x2e, 0x2e, 0xe0, 0x6f, 0xfe, 0x62, 0xdc, 0x4f, 0xfe, 0x31, 0xfb, 0x07, 0xbc, 0x3f, 0xc1, 0x11, 0x91, 0x0f, 0x66, 0xb2, 0x58, 0x92, 0xba, 0xa7, 0xcf, 0x35, 0x2e, 0xe0, 0xc5, 0x6c, 0xab, 0x48, 0xe6, 0x23, 0x32, 0x32, 0x32, 0x32, 0x22, 0x32, 0x22, 0xd2, 0xed, 0x8d, 0x93, 0x6e, 0x11, 0xa5, 0x89, 0xeb, 0x5d, 0x77, 0xd3, 0x24, 0x2f, 0x9c, 0xc2, 0x0f, 0xd3, 0xee, 0x78, 0xc8, 0x93, 0xa2, 0xd9, 0xcd, 0x78, 0x50, 0xf0, 0xe7, 0x31, 0xc7, 0x27, 0xb7, 0x11, 0x47, 0xc9, 0x79, 0xc3, 0x6b, 0x66, 0x3c, 0xde, 0x8b, 0xf2, 0x62, 0x3d, 0xea, 0xb9, 0xc5, 0xd2, 0x52, 0xd1, 0xcc, 0xc7, 0xa3, 0x51, 0x9a, 0x15, 0xb9, 0xf9, 0xdb, 0x6d, 0x0c, 0xd3, 0x70, 0x1c, 0xf3, 0x11, 0x14, 0x4e, 0x83, 0xb0, 0xe1, 0x79, 0x19, 0x2f, 0xc6, 0x59, 0xb2, 0xde, 0x4b, 0x33, 0x57, 0xf4, 0x13, 0x39, 0x69, 0xcf, 0xd1, 0x5d, 0x7d, 0x1a, 0xf3, 0x6c, 0x72, 0xc4, 0x63, 0xde, 0x2d, 0xd2, 0x6c, 0x33, 0x8e, 0xdd, 0xef, 0xb0, 0xb7, 0x13, 0xa8, 0xee, 0x57, 0x9a, 0x3a, 0xfd, 0xce, 0xf3, 0x12, 0x37, 0xf2, 0xd6, 0x13, 0x7e, 0xe9, 0xec, 0x8f, 0x8b, 0x00, 0xa1, 0x7f, 0xdd, 0xc9, 0x79, 0x76, 0xc1, 0x33, 0x37, 0xf2, 0x37, 0xae, 0xcb, 0x3e, 0x62, 0xec, 0x23, 0xf2, 0x00, 0xd2, 0xb8, 0x59, 0x4c, 0x46, 0xdc, 0xf7, 0xfd, 0x46, 0x77, 0x10, 0xc5, 0x21, 0x0e, 0xa0, 0xe1, 0x95, 0x05, 0x03, 0x2c, 0x18, 0x37, 0x83, 0x30, 0xe4, 0xe1, 0xab, 0x34, 0xe4, 0xb9, 0x17, 0x34, 0x8b, 0xa0, 0xff, 0x2a, 0x18, 0x52, 0x9d, 0xbd, 0xdd, 0x57, 0x2f, 0x1b, 0x4b, 0x4b, 0x01, 0x8e, 0x1d, 0x9f, 0x6d, 0x88, 0x96, 0x96, 0x12, 0x37, 0xf0, 0xa6, 0x5e, 0x33, 0x15, 0x50, 0xb8, 0x6a, 0x54, 0xec, 0x5a, 0x77, 0xd6, 0x5a, 0x58, 0x65, 0xf9, 0xb8, 0x53, 0x64, 0x9c, 0xc3, 0xcf, 0xa9, 0xb7, 0xae, 0xf0, 0xee, 0xe4, 0x30, 0x16, 0x89, 0xfa, 0xd8, 0xbf, 0x9e, 0xae, 0x0b, 0x44, 0x39, 0x51, 0x33, 0x4a, 0x0a, 0xde, 0xcf, 0xa2, 0x62, 0xb2, 0xb4, 0x04, 0xe0, 0xeb, 0x27, 0xdf, 0xf8, 0xe2, 0xb1, 0x08, 0x40, 0xea, 0xf1, 0x2c, 0xe3, 0xd9, 0x41, 0x1a, 0x47, 0x5d, 0x51, 0xd6, 0x7e, 0xe5, 0x57, 0xcb, 0x60, 0xad, 0x6e, 0x96, 0xe6, 0xf9, 0xeb, 0x2c, 0xea, 0x47, 0x09, 0x0e, 0x68, 0x9c, 0xf3, 0x65, 0x98, 0xed, 0x10, 0x80, 0x8e, 0x82, 0x38, 0x6f, 0xb4, 0xe3, 0xa6, 0xf1, 0xe8, 0x37, 0xa2, 0xa4, 0x1b, 0x8f, 0x43, 0xde, 0x68, 0xcd, 0xd4, 0x0c, 0x92, 0x34, 0x99, 0x0c, 0xd3, 0xf1, 0x6c, 0x9d, 0x74, 0x18, 0x15, 0x8d, 0x56, 0xe5, 0x65, 0x0e, 0x18, 0x5d, 0x4e, 0xa9, 0x76, 0x83, 0xc5, 0x53, 0x8d, 0x05, 0x9c, 0xd1, 0x6b, 0x98, 0xa7, 0xa8, 0xc9, 0x47, 0x8a, 0x56, 0xf0, 0xb7, 0xbf, 0xb0, 0xba, 0xae, 0x90, 0x83, 0x98, 0x5a, 0xef, 0xf1, 0xa2, 0x3b, 0x80, 0x62, 0x03, 0x18, 0x13, 0x8b, 0xbd, 0xe9, 0xd4, 0x73, 0x3d, 0x59, 0xe2, 0xa7, 0xdc, 0x5f, 0x58, 0x63, 0xef, 0x73, 0xdf, 0xe5, 0xac, 0xf0, 0xfc, 0x0d, 0x9c, 0xba, 0x82, 0xbd, 0x29, 0xfc, 0xa3, 0xc9, 0xb0, 0x93, 0xc6, 0x6e, 0x23, 0x87, 0xe1, 0x87, 0xcb, 0xa3, 0x2c, 0xbd, 0x9a, 0x34, 0x3c, 0x76, 0x9c, 0xfb, 0x48, 0x13, 0x30, 0xf1, 0x07, 0xf8, 0x06, 0xc6, 0xa2, 0xa0, 0x69, 0xb0, 0x67, 0x85, 0x7f, 0xcd, 0x3f, 0x8d, 0x01, 0xe4, 0xd6, 0xfb, 0x7c, 0xba, 0x1e, 0xf3, 0xc2, 0x79, 0x9e, 0xfb, 0xfb, 0xb9, 0xec, 0xa9, 0x28, 0xfc, 0x35, 0xb6, 0x55, 0xf8, 0x0f, 0xd9, 0x66, 0xee, 0x5f, 0xa7, 0x97, 0x09, 0x0f, 0x5b, 0xc9, 0x38, 0x8e, 0x59, 0x37, 0xe6, 0x41, 0x32, 0x1e, 0xe5, 0xf2, 0x29, 0x85, 0x89, 0xba, 0x2a, 0xc4, 0x03, 0x96, 0xca, 0xe8, 0xe7, 0x74, 0xfd, 0x22, 0xc8, 0x9c, 0x7d, 0x1f, 0x7f, 0x53, 0xd3, 0x3f, 0x17, 0xf4, 0x9b, 0xfd, 0x98, 0x8b, 0xbf, 0x6f, 0xc5, 0x9f, 0xf7, 0xe2, 0xcf, 0x21, 0x97, 0x6f, 0x0b, 0x7f, 0xb5, 0x24, 0x9b, 0xbd, 0x9c, 0x46, 0x29, 0x29, 0x27, 0xf7, 0xdf, 0xb2, 0xc4, 0xdf, 0x67, 0x91, 0xcf, 0x9b, 0x31, 0x4f, 0xfa, 0xc5, 0x00, 0xc6, 0xbe, 0xca, 0x62, 0xbf, 0x80, 0xbf, 0x17, 0x69, 0x14, 0x3a, 0xab, 0xed, 0xa4, 0x55, 0xb0, 0xc0, 0x8f, 0xda, 0x9b, 0x79, 0xeb, 0x6e, 0x90, 0x63, 0x9c, 0xcd, 0x59, 0xf0, 0xe3, 0x29, 0xcb, 0xa0, 0x09, 0xde, 0x72, 0x11, 0xbf, 0x2e, 0xfe, 0x1b, 0x89, 0x3f, 0x87, 0x05, 0xac, 0x01, 0xcf, 0x5b, 0xdf, 0xf7, 0x03, 0x09, 0xff, 0x7a, 0x91, 0x4d, 0xae, 0x25, 0x35, 0xe7, 0x85, 0x9b, 0xb1, 0x85, 0x55, 0x6f, 0xda, 0x8b, 0x92, 0x20, 0x8e, 0x27, 0xd7, 0x6f, 0xfd, 0x9c, 0x01, 0x06, 0xa6, 0x25, 0x05, 0x3c, 0x17, 0xe3, 0x29, 0xfc, 0xa2, 0xfd, 0xba, 0xf3, 0x11, 0xf8, 0x40, 0x33, 0xc8, 0xf3, 0xa8, 0x9f, 0xb8, 0xd7, 0x53, 0x98, 0x0e, 0xf8, 0xd4, 0x7a, 0x56, 0xac, 0xab, 0xd1, 0x5e, 0x5f, 0x04, 0xf1, 0x98, 0xb7, 0x38, 0x93, 0x4b, 0x2e, 0x93, 0xe0, 0xab, 0xc7, 0xa3, 0x38, 0x2d, 0xf4, 0x88, 0x86, 0xa3, 0x20, 0x0b, 0x80, 0xad, 0xb4, 0x8a, 0xa6, 0x98, 0xd3, 0x9b, 0x1b, 0x81, 0x92, 0x29, 0xe0, 0x0c, 0x18, 0x86, 0x2b, 0xc9, 0x20, 0x32, 0x49, 0x00, 0x16, 0x52, 0xe4, 0x47, 0x6e, 0xde, 0xa4, 0x9e, 0x3c, 0x8f, 0x7d, 0xcc, 0xdd, 0x9c, 0x45, 0x30, 0x42, 0x31, 0xa4, 0x93, 0xd7, 0x79, 0xb3, 0x13, 0x25, 0xa1, 0x9b, 0x7b, 0x2c, 0x39, 0x2d, 0x87, 0xf1, 0x0c, 0x87, 0xc1, 0x72, 0x35, 0x31, 0x89, 0xdf, 0xa7, 0x89, 0x62, 0x40, 0x99, 0x45, 0xe1, 0xad, 0xbf, 0x2e, 0xdc, 0xc4, 0x2b, 0x4b, 0x77, 0x73, 0x55, 0x1c, 0xc8, 0x2b, 0x4f, 0xd6, 0xeb, 0x2b, 0x25, 0x4d, 0x58, 0x9f, 0x19, 0x2c, 0x05, 0xa0, 0x85, 0xf6, 0x21, 0x6f, 0x8e, 0xc6, 0xf9, 0x00, 0x9a, 0x69, 0x55, 0x1a, 0x3b, 0x50, 0x6d, 0x41, 0x53, 0xb5, 0x38, 0xcc, 0x0d, 0x1c, 0x96, 0x7d, 0xac, 0xb2, 0x55, 0x35, 0x28, 0x27, 0x69, 0x6a, 0x84, 0x0a, 0xa2, 0x2b, 0x5f, 0x10, 0x4a, 0xd5, 0xcb, 0x12, 0xa9, 0x7e, 0x5e, 0x41, 0x2a, 0x23, 0xa8, 0x98, 0x42, 0x8f, 0x09, 0xe0, 0xcf, 0xd0, 0xa3, 0x67, 0x90, 0x04, 0x87, 0x01, 0x1a, 0x9f, 0x81, 0x92, 0x38, 0x31, 0x81, 0xb7, 0x40, 0xb4, 0xd8, 0x91, 0x64, 0x04, 0x0e, 0xd7, 0x4b, 0xbc, 0xf0, 0xdf, 0xae, 0xcf, 0x52, 0x17, 0x7c, 0x37, 0x08, 0xab, 0x30, 0x88, 0x2a, 0xcc, 0xab, 0xd3, 0xb1, 0x99, 0x65, 0xc1, 0xa4, 0x19, 0xe5, 0xf4, 0x17, 0xfa, 0xa3, 0x05, 0x18, 0xc1, 0x4a, 0x81, 0xfd, 0x2b, 0x6f, 0x86, 0xc8, 0x28, 0x15, 0x32, 0x02, 0xd8, 0x4b, 0xf0, 0x6b, 0x86, 0x5b, 0x5d, 0x02, 0x80, 0xfb, 0xb2, 0x92, 0x5c, 0x62, 0x1e, 0xed, 0x66, 0x58, 0xa2, 0x0f, 0x2b, 0xb3, 0xff, 0x54, 0xbd, 0x5f, 0xef, 0x3f, 0x78, 0xe0, 0x65, 0x27, 0xfd, 0x53, 0x9f, 0xc3, 0x3f, 0x00, 0x1b, 0x8f, 0x73, 0xee, 0x64, 0x3e, 0x0e, 0x03, 0xb7, 0x22, 0x35, 0xac, 0x18, 0xd9, 0x55, 0x20, 0x47, 0x16, 0xfa, 0x72, 0x21, 0xe1, 0x4a, 0x89, 0x58, 0xa0, 0x09, 0x0d, 0xc8, 0x32, 0x63, 0xa1, 0x31, 0xa6, 0x41, 0x81, 0x68, 0x02, 0xca, 0x91, 0xab, 0x0f, 0x88, 0xb3, 0xfc, 0xb8, 0x53, 0x18, 0x28, 0xde, 0x97, 0x78, 0xbc, 0xb9, 0x71, 0xf7, 0x9b, 0x6a, 0x9d, 0xcb, 0x77, 0x6d, 0xe3, 0xcd, 0x09, 0x3f, 0x6d, 0x95, 0x8f, 0x82, 0xbc, 0x90, 0xe4, 0x79, 0xd9, 0xee, 0x61, 0xee, 0x96, 0xcd, 0x96, 0xaf, 0x77, 0x2b, 0x5c, 0x68, 0x1f, 0x56, 0xd4, 0x5b, 0xe0, 0x01, 0xbc, 0x9e, 0x07, 0x14, 0xc4, 0x03, 0xba, 0x01, 0xb1, 0x70, 0xef, 0x7a, 0x80, 0x1c, 0x5d, 0xcf, 0xdc, 0x3e, 0xb0, 0x84, 0xb7, 0x16, 0x4b, 0xf8, 0x95, 0xe8, 0x45, 0xcf, 0x3c, 0x83, 0xf6, 0x15, 0x52, 0x80, 0x65, 0x0f, 0xa3, 0x9c, 0xc3, 0xce, 0x06, 0x4c, 0x1d, 0xb6, 0x5c, 0xaf, 0x59, 0x0c, 0x78, 0x42, 0x28, 0x41, 0x12, 0x00, 0xde, 0x92, 0xd3, 0xcc, 0x26, 0xeb, 0x15, 0x72, 0x83, 0x2e, 0xf6, 0x25, 0x15, 0xb7, 0x93, 0x66, 0x98, 0x26, 0xbc, 0x25, 0x99, 0x01, 0x00, 0x86, 0x3d, 0x9d, 0xfc, 0x1a, 0x31, 0x1e, 0x9f, 0xfa, 0xcf, 0x5d, 0x28, 0x5d, 0xf2, 0xdb, 0x9d, 0xca, 0x48, 0xd5, 0x9e, 0x22, 0x99, 0x64, 0x43, 0x4d, 0xd7, 0x75, 0x14, 0xb6, 0x72, 0x06, 0xe0, 0x5d, 0x44, 0x21, 0x32, 0xcc, 0x04, 0x19, 0x04, 0x90, 0x55, 0x30, 0x8e, 0x8b, 0xb7, 0x82, 0x69, 0x19, 0x23, 0x1c, 0xd3, 0x08, 0x11, 0xd0, 0x42, 0x01, 0xba, 0xbf, 0xb4, 0xb4, 0xaf, 0x58, 0x2f, 0x30, 0xa1, 0xc2, 0xd7, 0x4f, 0x27, 0xbc, 0x19, 0x85, 0xa7, 0xde, 0x82, 0xe6, 0xe8, 0x45, 0x8b, 0x37, 0xcd, 0xa6, 0xcb, 0x76, 0x7b, 0x16, 0xe6, 0x80, 0x31, 0x78, 0x80, 0xbc, 0x03, 0x41, 0x31, 0xb9, 0x5b, 0xb8, 0x5e, 0x49, 0x5e, 0x79, 0xb3, 0x48, 0x89, 0xae, 0x7d, 0x42, 0x9e, 0x5a, 0x27, 0x30, 0xdf, 0xaa, 0x84, 0xbd, 0x64, 0x12, 0x0f, 0x76, 0x92, 0x64, 0x41, 0x10, 0xd1, 0x49, 0x72, 0xda, 0x3a, 0x39, 0x9d, 0xb2, 0xbc, 0xec, 0xfa, 0x35, 0x52, 0x0a, 0xca, 0x86, 0x83, 0x28, 0x6f, 0xe6, 0xe9, 0x38, 0xeb, 0x72, 0x14, 0x0d, 0xe9, 0x09, 0x84, 0x35, 0xee, 0xe9, 0x6f, 0xf8, 0x84, 0x5b, 0x74, 0xe1, 0x01, 0xcb, 0xc0, 0x57, 0xde, 0x3a, 0xae, 0x14, 0x09, 0x02, 0xf7, 0xdf, 0xaf, 0xcb, 0x1d, 0x10, 0xe6, 0x0e, 0x61, 0x7b, 0x27, 0x4b, 0xd1, 0x34, 0xbe, 0xf7, 0xf9, 0x14, 0x59, 0x85, 0xa7, 0x8b, 0x53, 0xa3, 0x9a, 0x7d, 0xb5, 0xed, 0x47, 0xb9, 0x34, 0x5b, 0xab, 0xeb, 0x6f, 0x15, 0x50, 0x6d, 0x57, 0xff, 0x14, 0x24, 0x2f, 0x1a, 0x57, 0x2f, 0x89, 0xdf, 0xe9, 0xb5, 0xd0, 0x2a, 0x0b, 0xfb, 0x27, 0x58, 0xf0, 0xd4, 0x2e, 0x88, 0x6b, 0xc8, 0x63, 0x15, 0x10, 0xdc, 0x0a, 0x0c, 0xd4, 0xd8, 0xdb, 0x4a, 0x31, 0xa3, 0x9f, 0x12, 0x1e, 0x01, 0xed, 0xf2, 0x1a, 0x76, 0x6c, 0x37, 0xe2, 0x9f, 0xbc, 0x3d, 0xad, 0x69, 0x00, 0x5e, 0xcf, 0x54, 0x3e, 0xf5, 0xa6, 0x72, 0x06, 0xa9, 0xfc, 0x85, 0x4d, 0x22, 0x1f, 0x35, 0x6b, 0xa4, 0x75, 0x02, 0x82, 0x03, 0x15, 0x90, 0x93, 0xee, 0x2e, 0x70, 0x83, 0xc9, 0xdf, 0xdc, 0x58, 0x8f, 0x6e, 0x02, 0x2b, 0xc1, 0x03, 0xe2, 0x94, 0x75, 0x60, 0xbd, 0xf1, 0x12, 0xc2, 0xa5, 0x25, 0x3e, 0x83, 0x77, 0xe0, 0xad, 0x62, 0x0e, 0xaf, 0x15, 0xcb, 0x8c, 0x80, 0x65, 0x46, 0x4f, 0x67, 0x4b, 0xae, 0x47, 0x0f, 0xfc, 0xb5, 0x52, 0x20, 0x36, 0x0a, 0x9c, 0x44, 0xa7, 0x20, 0xbf, 0xfc, 0x0c, 0x8b, 0xe2, 0xe7, 0xa2, 0x99, 0x8d, 0x93, 0x24, 0x4a, 0xfa, 0xeb, 0x01, 0x3d, 0x85, 0x51, 0x3e, 0x4a, 0x73, 0x1e, 0x36, 0x07, 0x41, 0x0e, 0xfc, 0x95, 0xb9, 0x41, 0x7b, 0x01, 0x24, 0xfe, 0x23, 0xa4, 0xb0, 0x16, 0xfc, 0x12, 0x84, 0x47, 0xb2, 0xf1, 0x68, 0x9c, 0xf1, 0xf6, 0x7b, 0x81, 0xef, 0xd8, 0x6b, 0xa9, 0xdd, 0x14, 0x2a, 0xc5, 0xe6, 0x10, 0xde, 0x60, 0x3b, 0x1e, 0x0b, 0x80, 0x75, 0xca, 0xea, 0x48, 0xa7, 0x48, 0x71, 0xef, 0x25, 0xa0, 0x1b, 0x6b, 0xfc, 0x07, 0xaf, 0x18, 0x64, 0xe9, 0xa5, 0xf3, 0xde, 0x3f, 0x39, 0x65, 0xa8, 0x8e, 0x3c, 0xcf, 0xb2, 0x34, 0x9b, 0x22, 0x7d, 0xc2, 0x24, 0x1b, 0x4b, 0xa2, 0x90, 0x1b, 0x1b, 0x60, 0xb1, 0x97, 0x28, 0xf1, 0xf6, 0x10, 0xdf, 0x96, 0xfb, 0x5a, 0xb1, 0x0e, 0xfc, 0x8b, 0x33, 0x89, 0x52, 0x40, 0x70, 0x59, 0x9f, 0x3e, 0x94, 0x53, 0x25, 0xeb, 0x44, 0xc0, 0x6d, 0x63, 0xda, 0x0f, 0x81, 0xdf, 0x12, 0xa3, 0xc5, 0x49, 0xec, 0x25, 0x6e, 0xa1, 0x58, 0x6c, 0xa0, 0x59, 0x36, 0xa7, 0x71, 0xd3, 0x8c, 0xa9, 0xc1, 0xe0, 0x94, 0xa1, 0x14, 0x48, 0xd3, 0x85, 0x3f, 0x9a, 0x30, 0x35, 0xcf, 0x03, 0xa8, 0x76, 0x58, 0x78, 0xea, 0xa3, 0xd8, 0x86, 0xe1, 0x69, 0x3c, 0x0a, 0xa1, 0x5a, 0xb8, 0x59, 0xf8, 0xf9, 0x83, 0x35, 0x06, 0x8c, 0x3b, 0x30, 0xb7, 0xdc, 0x18, 0xf8, 0x6d, 0x34, 0xc5, 0xe1, 0xe9, 0x72, 0x37, 0x37, 0xc6, 0xc3, 0x53, 0x3f, 0x17, 0xe4, 0xa2, 0xdf, 0x08, 0xfe, 0xb1, 0xb4, 0xd4, 0xd0, 0x38, 0x07, 0x1d, 0xc3, 0xe1, 0x6d, 0xa2, 0x4a, 0x10, 0x6d, 0x14, 0x65, 0x25, 0x76, 0xdf, 0x06, 0x52, 0xa4, 0xf8, 0x92, 0xc3, 0x8e, 0x03, 0x83, 0x31, 0x75, 0xa8, 0x5e, 0x02, 0x82, 0x21, 0x0d, 0xb3, 0x95, 0x30, 0x5d, 0xb9, 0x14, 0x63, 0xa5, 0xe0, 0x2b, 0x97, 0x8b, 0xf9, 0x60, 0x8a, 0x8d, 0x96, 0x58, 0x2c, 0xc4, 0xcd, 0x42, 0x4a, 0xc1, 0xfb, 0x5a, 0x4c, 0xde, 0x6f, 0xef, 0xdb, 0x62, 0x32, 0xa2, 0xb9, 0x95, 0x6b, 0x2d, 0xae, 0xdc, 0x81, 0xf7, 0x81, 0x6d, 0x6f, 0x02, 0x61, 0xc1, 0x4e, 0x4c, 0x30, 0xb4, 0xe5, 0x5f, 0x4d, 0x89, 0xf2, 0xd9, 0x3f, 0x89, 0x81, 0x91, 0x18, 0x9a, 0xd1, 0x2b, 0x45, 0x3c, 0x5c, 0x73, 0xcc, 0x55, 0xad, 0x21, 0x99, 0x6f, 0xb7, 0x0a, 0x25, 0x58, 0xbc, 0x23, 0xca, 0x12, 0x1f, 0xc7, 0xf9, 0x88, 0x27, 0x39, 0x4c, 0x3d, 0x4a, 0x0a, 0xfa, 0x11, 0x54, 0xc8, 0x1d, 0x98, 0xbb, 0x4e, 0xd0, 0x3d, 0xf7, 0xb4, 0x94, 0x55, 0x7e, 0xe5, 0xbd, 0x1e, 0x08, 0x8f, 0x9a, 0xfb, 0x69, 0x22, 0x05, 0x26, 0x47, 0x32, 0xcf, 0xba, 0xcb, 0x7d, 0x41, 0x21, 0x19, 0xce, 0xeb, 0xfc, 0x79, 0x7f, 0x0b, 0xd2, 0xab, 0x27, 0x41, 0x44, 0xfb, 0x80, 0x6a, 0x50, 0x71, 0x01, 0x50, 0xc1, 0x34, 0xbb, 0x5a, 0xcf, 0x37, 0x80, 0x27, 0xe4, 0xcb, 0xcb, 0xb8, 0x43, 0x00, 0x85, 0x9e, 0x00, 0x8f, 0xe5, 0x95, 0x5d, 0x82, 0x8b, 0x2d, 0xc2, 0xa9, 0x0e, 0x5c, 0x6f, 0x5b, 0x35, 0x7b, 0x06, 0x50, 0xc9, 0xc9, 0xea, 0xa9, 0xda, 0x35, 0x4c, 0xf9, 0x82, 0x64, 0x82, 0x82, 0x90, 0xfb, 0xde, 0x94, 0x35, 0x05, 0x64, 0x0b, 0x6b, 0xeb, 0x30, 0x1a, 0x17, 0x17, 0xb7, 0x87, 0x82, 0x37, 0xbc, 0x59, 0x05, 0x7e, 0x81, 0x6b, 0xfd, 0x6d, 0xf1, 0xe0, 0x01, 0xad, 0x38, 0xd5, 0x2d, 0x2f, 0x77, 0xcb, 0x82, 0x76, 0xfc, 0x44, 0x2e, 0x41, 0x10, 0x1b, 0x41, 0x32, 0x76, 0xa5, 0x0e, 0xe7, 0x29, 0x9d, 0x0e, 0x16, 0x10, 0x08, 0xc6, 0x25, 0x24, 0x50, 0x49, 0x4c, 0xf2, 0x7b, 0xa4, 0x90, 0x1c, 0xc0, 0x91, 0x25, 0x61, 0xed, 0xa9, 0xc9, 0x56, 0x93, 0x70, 0xc8, 0xd7, 0x95, 0x4a, 0x58, 0x54, 0xd9, 0xeb, 0x73, 0xd8, 0xdc, 0x3d, 0x5b, 0xaa, 0xde, 0x27, 0x51, 0x40, 0x21, 0x1c, 0x75, 0xc8, 0xa2, 0x94, 0x54, 0x61, 0x1c, 0x1e, 0x12, 0xd8, 0x49, 0x71, 0x6a, 0x54, 0xc9, 0x13, 0x2d, 0x95, 0x80, 0xd8, 0xb0, 0x4a, 0xb3, 0x55, 0x53, 0xb1, 0x1c, 0x3d, 0x54, 0x97, 0x4a, 0x4a, 0x9b, 0x9f, 0xe4, 0x0f, 0x1e, 0x9c, 0xfa, 0x49, 0xeb, 0x95, 0x50, 0x4e, 0x74, 0xd5, 0x7c, 0x4e, 0x67, 0xef, 0xe4, 0x24, 0xa8, 0xf9, 0x5c, 0x35, 0x88, 0x03, 0xc8, 0x01, 0xba, 0xb4, 0xf7, 0xb5, 0xf5, 0xdc, 0xd8, 0x20, 0x90, 0xe3, 0xc9, 0xcf, 0x40, 0x2e, 0x24, 0xa7, 0xab, 0x67, 0x55, 0x24, 0xf2, 0x13, 0xd1, 0xf2, 0x7a, 0x44, 0x64, 0xd4, 0x06, 0xd9, 0xc5, 0x47, 0xc9, 0x6a, 0x21, 0x31, 0xa9, 0x36, 0xb1, 0xa9, 0x76, 0x69, 0x89, 0xe0, 0x6f, 0x45, 0x44, 0x5f, 0x4b, 0x4b, 0x00, 0x25, 0x6e, 0x7a, 0x53, 0x63, 0xce, 0xde, 0xd4, 0x22, 0x76, 0x66, 0x3f, 0x2b, 0x0c, 0x70, 0x73, 0x6b, 0x3f, 0x03, 0xa4, 0x49, 0x29, 0x08, 0x28, 0x44, 0xc9, 0x43, 0x5b, 0x80, 0x72, 0x6b, 0x93, 0xca, 0xcb, 0x4d, 0x0a, 0xe8, 0x2a, 0xaf, 0x6c, 0x52, 0xb9, 0x67, 0x92, 0x11, 0x6d, 0x29, 0x52, 0x9c, 0x14, 0x4b, 0x44, 0xe2, 0x82, 0x16, 0xed, 0x0c, 0x26, 0x4d, 0xb0, 0xb4, 0x24, 0x94, 0x8e, 0x5c, 0x20, 0x5f, 0xfd, 0x46, 0x8a, 0x27, 0xf4, 0x36, 0xf2, 0x8d, 0xee, 0xb1, 0x83, 0x08, 0xd8, 0x8a, 0x52, 0x86, 0x34, 0xff, 0x8d, 0x64, 0xe9, 0xc0, 0x9f, 0x11, 0x72, 0xf0, 0xfd, 0x7a, 0xf2, 0x34, 0xd2, 0x64, 0x8b, 0x9b, 0x6b, 0xd9, 0xcd, 0x49, 0x00, 0x84, 0xc3, 0x22, 0x10, 0x2a, 0x61, 0x47, 0xa9, 0x54, 0xc6, 0x97, 0xb0, 0xe7, 0x4c, 0x69, 0x58, 0xc5, 0x6b, 0x64, 0x95, 0x02, 0xf9, 0x85, 0xaf, 0x9e, 0x4b, 0x4e, 0x52, 0x20, 0x27, 0x29, 0x80, 0x93, 0x20, 0x42, 0xe4, 0x57, 0xa4, 0xba, 0xf5, 0x90, 0x03, 0x72, 0xb8, 0xa3, 0xde, 0x89, 0xd6, 0x52, 0xbb, 0xb1, 0xf4, 0xb6, 0xb6, 0x52, 0xdd, 0x94, 0xb9, 0x43, 0x8a, 0x76, 0xd4, 0x96, 0x51, 0x36, 0xa5, 0x55, 0xaa, 0xd9, 0xd6, 0xca, 0x8f, 0xd0, 0x9a, 0x8b, 0xcd, 0x69, 0x75, 0x8c, 0x5a, 0xd4, 0xcb, 0xc1, 0xb0, 0x91, 0x25, 0x86, 0x6e, 0x07, 0x3c, 0x10, 0xd0, 0x1d, 0x24, 0x5d, 0xb4, 0x5c, 0x90, 0xdc, 0xd1, 0x86, 0xed, 0x4e, 0xc9, 0x20, 0xca, 0xa4, 0x01, 0xec, 0xb1, 0x91, 0x17, 0x19, 0x48, 0x4a, 0x0d, 0xf8, 0xdc, 0x78, 0x93, 0x9c, 0x27, 0x00, 0xb5, 0xc3, 0xb1, 0x4c, 0x83, 0x5d, 0x77, 0x03, 0x58, 0xb3, 0xa0, 0x90, 0x18, 0xcb, 0x71, 0x40, 0xdb, 0xaa, 0xbf, 0xef, 0x5d, 0x0b, 0xd9, 0x86, 0x3a, 0x35, 0x74, 0xf4, 0x5c, 0x32, 0x2a, 0xa3, 0x03, 0xc3, 0x66, 0xb2, 0xa0, 0x75, 0x63, 0xa5, 0xbc, 0x42, 0x79, 0xd0, 0x36, 0x90, 0x58, 0xaa, 0x9a, 0x77, 0xa9, 0x9f, 0x9c, 0x9c, 0xce, 0xac, 0x79, 0xbd, 0xd6, 0x0d, 0x36, 0x83, 0x6d, 0xc1, 0x2a, 0xf7, 0xd6, 0x67, 0x14, 0x12, 0xb1, 0xb1, 0x34, 0x83, 0xd1, 0x28, 0x9e, 0x80, 0x92, 0x09, 0xeb, 0xb6, 0x50, 0x46, 0x12, 0x2d, 0x02, 0xab, 0x1f, 0x86, 0x08, 0x1c, 0x27, 0x82, 0xf5, 0xc8, 0x2f, 0xda, 0x14, 0x9e, 0x88, 0x35, 0x14, 0x29, 0x96, 0xfe, 0x4c, 0x28, 0x4e, 0x4a, 0x43, 0x77, 0xf5, 0x9e, 0xef, 0x5f, 0x37, 0x9b, 0x4d, 0xfd, 0xc4, 0x50, 0x8f, 0x4e, 0xa4, 0x9c, 0xcd, 0x7a, 0x42, 0x41, 0x4f, 0x9a, 0x64, 0x03, 0xce, 0x78, 0x02, 0x3a, 0x17, 0x13, 0x8a, 0x1b, 0xac, 0x24, 0x63, 0xd1, 0xbe, 0xb0, 0x80, 0x90, 0x7d, 0x70, 0x17, 0x78, 0xd2, 0xf5, 0xd4, 0x54, 0xed, 0x3f, 0x16, 0x5a, 0x05, 0x5f, 0x58, 0x9d, 0xca, 0xd5, 0x96, 0xfb, 0xd7, 0x7d, 0x5e, 0x28, 0xf1, 0x50, 0x8d, 0x15, 0x98, 0xd6, 0x9b, 0xa2, 0x9d, 0x83, 0x14, 0x85, 0x1f, 0x81, 0x6d, 0x31, 0x14, 0x8c, 0xcd, 0x6e, 0x64, 0x11, 0xd8, 0xd1, 0x38, 0x09, 0xcd, 0x58, 0x26, 0xe7, 0x45, 0xeb, 0x63, 0xc1, 0xc4, 0x1a, 0x01, 0x0d, 0x76, 0xc4, 0xb3, 0x62, 0x82, 0x6f, 0xa0, 0x11, 0x58, 0x2e, 0xea, 0xcd, 0x33, 0x9e, 0x77, 0xb3, 0x68, 0x84, 0x7a, 0x80, 0xd1, 0x22, 0xce, 0x52, 0x2f, 0xea, 0x8f, 0xb3, 0xa0, 0x13, 0xa3, 0x89, 0x9b, 0xf1, 0x64, 0x3c, 0xe4, 0xfa, 0x09, 0xe1, 0x30, 0xa4, 0x51, 0x05, 0xd6, 0xbc, 0x2e, 0xa7, 0x53, 0x14, 0xb5, 0x5e, 0xf2, 0x89, 0x69, 0x31, 0xe2, 0xcd, 0x73, 0x7c, 0x01, 0x4c, 0xa0, 0x54, 0xcb, 0x7f, 0x35, 0xec, 0x1d, 0x28, 0x34, 0xd4, 0x50, 0x65, 0x1b, 0x08, 0xb0, 0xc5, 0x3d, 0xa0, 0xff, 0x6b, 0x03, 0xeb, 0x19, 0x9e, 0x78, 0x28, 0xaa, 0x83, 0x65, 0x06, 0x34, 0x4f, 0x5a, 0x92, 0x24, 0x3c, 0xfe, 0xb4, 0x58, 0x7f, 0xf0, 0x80, 0x97, 0x1c, 0x12, 0x3f, 0xc2, 0xfc, 0x0a, 0x13, 0x4e, 0xae, 0x75, 0x70, 0x45, 0xe7, 0xb9, 0xd9, 0x74, 0xee, 0x02, 0x59, 0x28, 0x46, 0x8c, 0x72, 0x84, 0xea, 0x27, 0x00, 0xea, 0x0e, 0x4a, 0xea, 0x0e, 0x4a, 0xea, 0xce, 0x60, 0x13, 0x0d, 0x4e, 0xd7, 0x01, 0x08, 0xd0, 0xb5, 0x16, 0x32, 0xe0, 0xed, 0x40, 0x7f, 0xd0, 0x14, 0xc3, 0xd7, 0x6a, 0x58, 0x99, 0x35, 0x2c, 0xe0, 0x30, 0x80, 0xd8, 0x03, 0x37, 0x03, 0x25, 0x31, 0x43, 0x0e, 0x74, 0x8c, 0x7a, 0xb6, 0x02, 0x08, 0x59, 0x01, 0xd9, 0xb5, 0x5d, 0x22, 0x90, 0xa0, 0x1c, 0x6c, 0xa6, 0x6d, 0xc4, 0xc0, 0x8f, 0x32, 0xe4, 0x47, 0x19, 0xf0, 0xa3, 0x6b, 0x65, 0x86, 0x42, 0x8c, 0x9e, 0x64, 0xa7, 0x1e, 0x82, 0x03, 0x8d, 0x86, 0x33, 0x43, 0x0d, 0xa7, 0x82, 0x9c, 0xee, 0x6c, 0x12, 0x6a, 0x07, 0x38, 0x08, 0xd5, 0xa2, 0xa7, 0x88, 0x57, 0xae, 0xab, 0x85, 0xb5, 0x29, 0x13, 0x33, 0x2a, 0x3b, 0x0f, 0x4c, 0x4e, 0x90, 0x61, 0x2b, 0x25, 0xae, 0x32, 0xc0, 0x55, 0x20, 0x16, 0x35, 0x20, 0x57, 0x5a, 0x37, 0xa9, 0xb6, 0x6e, 0x5e, 0x9b, 0x66, 0xa1, 0x00, 0x0e, 0xff, 0x88, 0xc6, 0x7d, 0x0a, 0xe0, 0xc6, 0xb9, 0x57, 0x9a, 0x8e, 0xd1, 0xea, 0x2b, 0xeb, 0x8b, 0x03, 0x2e, 0x97, 0x04, 0x2d, 0x63, 0x92, 0x8c, 0xc1, 0x04, 0x38, 0x98, 0xa0, 0xc4, 0x8f, 0x9c, 0x27, 0xd4, 0xe5, 0x32, 0x0f, 0xd7, 0x7d, 0x94, 0x80, 0xce, 0xac, 0x70, 0x27, 0x9b, 0xb5, 0xd7, 0x0b, 0x1e, 0x22, 0xe5, 0x30, 0x4b, 0x86, 0xb5, 0xd0, 0xd8, 0x5e, 0xfa, 0xd8, 0x41, 0xbf, 0xec, 0xa0, 0xe7, 0x87, 0x27, 0x7d, 0xea, 0xa0, 0x87, 0xc7, 0x2b, 0x67, 0x67, 0xa3, 0x2c, 0x2d, 0xd2, 0xb3, 0xb3, 0xc6, 0xcd, 0x0d, 0xbd, 0xa0, 0x52, 0xd9, 0x18, 0x8f, 0xc9, 0x1a, 0x55, 0x00, 0x46, 0xf5, 0x00, 0x18, 0x0b, 0x36, 0x63, 0x3d, 0x22, 0xe0, 0x85, 0xe4, 0xa4, 0x77, 0xea, 0xe1, 0x3f, 0xfe, 0x08, 0x4b, 0xb7, 0xaf, 0xed, 0xe5, 0x5a, 0x5d, 0xcc, 0x50, 0xa4, 0x95, 0x25, 0xd2, 0xe0, 0x8d, 0xb5, 0x4e, 0xa8, 0x9a, 0x78, 0x91, 0x79, 0x20, 0xcf, 0xb5, 0x46, 0x82, 0xf1, 0x95, 0xd6, 0xa9, 0x91, 0x34, 0xac, 0x99, 0x46, 0x9d, 0xa1, 0x8f, 0xb5, 0xd7, 0x87, 0xb0, 0xf3, 0x8b, 0x7e, 0x87, 0x62, 0x4a, 0xad, 0xd6, 0xbc, 0x99, 0xb6, 0x96, 0x96, 0x64, 0x39, 0x64, 0x8d, 0x23, 0x65, 0x92, 0x07, 0x61, 0x4c, 0x89, 0x78, 0x30, 0xa9, 0xb1, 0x6f, 0x12, 0x45, 0x62, 0xce, 0x67, 0x7c, 0xdb, 0x7c, 0xc6, 0x30, 0x9f, 0x0c, 0xb6, 0x71, 0x20, 0xa1, 0x75, 0x50, 0x86, 0x43, 0x02, 0x4b, 0x36, 0x15, 0x72, 0xd0, 0x71, 0x35, 0x5f, 0x72, 0x23, 0x96, 0xb1, 0x10, 0x64, 0x42, 0x28, 0xea, 0x87, 0xed, 0x50, 0xc0, 0xa1, 0xcc, 0x87, 0x8a, 0x7f, 0x97, 0x7c, 0x20, 0xc0, 0xed, 0x05, 0x68, 0x51, 0x68, 0x18, 0xb8, 0x3a, 0xc5, 0xa2, 0xe6, 0x86, 0x68, 0x2a, 0xc9, 0xb4, 0xd0, 0x46, 0x05, 0xd8, 0xcb, 0x7a, 0x71, 0x00, 0xcc, 0xb2, 0x25, 0xb4, 0x96, 0x18, 0x34, 0xa4, 0x61, 0x30, 0x72, 0x03, 0xd8, 0x4a, 0xec, 0x25, 0x9d, 0x69, 0xc6, 0x18, 0x34, 0xe5, 0xf9, 0x1c, 0x92, 0x59, 0x1b, 0x17, 0x83, 0x02, 0x8a, 0x16, 0xea, 0x9c, 0x82, 0x4b, 0x4b, 0x19, 0x41, 0xa3, 0x17, 0xa1, 0x2e, 0xd4, 0x8b, 0xe2, 0x82, 0x03, 0xb1, 0xf8, 0x1b, 0xa2, 0x84, 0x27, 0x96, 0x90, 0x56, 0x71, 0x62, 0xb9, 0xb9, 0xce, 0xb0, 0x18, 0x7d, 0x76, 0x29, 0xf8, 0x43, 0x5b, 0x40, 0xd1, 0xc2, 0x25, 0xa3, 0x79, 0x46, 0xb5, 0xcc, 0xc2, 0x5a, 0x2b, 0xa8, 0x85, 0xc3, 0x9c, 0x4e, 0xee, 0x29, 0xa0, 0x00, 0x0f, 0x0b, 0xaa, 0xae, 0x82, 0x0b, 0xd4, 0x65, 0x6b, 0x75, 0x0b, 0x8c, 0xd1, 0x56, 0x8d, 0x5b, 0x68, 0xf5, 0xd0, 0xf9, 0x96, 0x55, 0x5a, 0x4a, 0x25, 0xf1, 0x9d, 0x6b, 0x89, 0xb3, 0x08, 0x85, 0xdc, 0x85, 0x18, 0x8b, 0x80, 0xe8, 0x03, 0xa2, 0x2c, 0xfe, 0x8d, 0x9b, 0xe5, 0x52, 0xc2, 0xa7, 0xcb, 0x2c, 0x2a, 0xd4, 0x6f, 0x73, 0x59, 0xad, 0x0b, 0x26, 0xb7, 0xb0, 0x06, 0xc4, 0xb7, 0x6a, 0x80, 0xd8, 0x47, 0x10, 0x0b, 0xaf, 0x5f, 0x4e, 0x55, 0x84, 0x3a, 0x36, 0x1d, 0xff, 0x04, 0xed, 0xe4, 0x24, 0x3c, 0x3d, 0x89, 0x40, 0x3e, 0x96, 0xc4, 0x57, 0x4f, 0xa8, 0x58, 0x8a, 0x45, 0x0c, 0x2d, 0x58, 0x0f, 0x1e, 0x84, 0xeb, 0x19, 0xe8, 0x17, 0x41, 0x3b, 0xbf, 0xbb, 0x5e, 0x2e, 0x2a, 0x4d, 0x0d, 0x3e, 0xca, 0xf2, 0x53, 0x89, 0xdc, 0x14, 0x94, 0x02, 0x7f, 0xe3, 0xc3, 0x51, 0x11, 0xc4, 0xdc, 0x01, 0xc6, 0x19, 0x3a, 0xbd, 0x2c, 0x1d, 0x3a, 0x4f, 0x17, 0xaf, 0xf9, 0x74, 0xa3, 0xf9, 0xa1, 0xdc, 0x93, 0x9f, 0x59, 0xc6, 0x67, 0xda, 0xb5, 0x79, 0xa8, 0xed, 0xcf, 0xbc, 0x79, 0x39, 0xe0, 0x89, 0x94, 0x84, 0xb4, 0x40, 0x04, 0x93, 0x06, 0xf2, 0xca, 0x01, 0x40, 0x20, 0x3f, 0xa8, 0xe3, 0x57, 0x17, 0x21, 0xc2, 0x39, 0xf7, 0x01, 0xd3, 0x53, 0x4d, 0x82, 0xa2, 0xad, 0x72, 0x1d, 0x89, 0x7d, 0x39, 0x32, 0x0d, 0x87, 0x4a, 0xee, 0xd2, 0x8a, 0xb9, 0xd8, 0x44, 0x63, 0x5b, 0x62, 0x55, 0xbc, 0x61, 0x63, 0xb5, 0x2d, 0x45, 0xaf, 0xd8, 0x2d, 0xda, 0x11, 0x1d, 0x70, 0x92, 0xc9, 0x0e, 0xde, 0x82, 0xe8, 0x26, 0x84, 0x61, 0x90, 0x0d, 0x1b, 0x47, 0x83, 0xf4, 0xb2, 0x51, 0x5a, 0xcf, 0x41, 0x1c, 0x01, 0x86, 0x15, 0x6b, 0xe9, 0xb2, 0xd9, 0x93, 0x76, 0x95, 0x69, 0x65, 0x88, 0x12, 0x8b, 0xdd, 0xc4, 0x3f, 0x69, 0x40, 0x91, 0xf4, 0xb2, 0x07, 0xbb, 0x0e, 0x10, 0x13, 0xe7, 0x49, 0x83, 0x35, 0x82, 0x7c, 0x92, 0x74, 0xf1, 0xef, 0xb8, 0x48, 0x7b, 0x69, 0x77, 0x9c, 0xcb, 0xdf, 0xa3, 0x38, 0x98, 0xc0, 0xcf, 0xee, 0x80, 0x77, 0xcf, 0x79, 0x88, 0xbf, 0x80, 0xe5, 0x67, 0x69, 0x8c, 0xdf, 0xa5, 0xe9, 0x1f, 0x7f, 0x45, 0x39, 0x92, 0x14, 0x7e, 0x07, 0x42, 0x1a, 0x26, 0x29, 0x4c, 0x72, 0x84, 0xda, 0x2c, 0xbc, 0x18, 0x44, 0x61, 0x48, 0x5d, 0x00, 0x73, 0x05, 0x21, 0x2b, 0x1b, 0x46, 0x89, 0xf8, 0x00, 0x13, 0x9f, 0x61, 0xe5, 0x28, 0x87, 0xd5, 0x02, 0x7f, 0xe3, 0x34, 0xc5, 0x3f, 0x43, 0x68, 0x32, 0x1a, 0xc5, 0x9c, 0x7e, 0x16, 0xd4, 0x66, 0x92, 0x0a, 0x87, 0x07, 0xfa, 0x69, 0x34, 0x0d, 0x54, 0x83, 0x0d, 0x23, 0x8c, 0x79, 0x94, 0xc4, 0xd0, 0x20, 0x3c, 0x21, 0x65, 0xa4, 0x49, 0x3c, 0xa1, 0x9f, 0x9f, 0xc6, 0x51, 0x46, 0x4d, 0x64, 0x1c, 0x75, 0x46, 0xfa, 0x99, 0xf3, 0x60, 0x18, 0xf3, 0x3c, 0xa7, 0x9f, 0xe8, 0xf0, 0x01, 0x6f, 0x81, 0x03, 0x27, 0x9a, 0x19, 0x9e, 0x34, 0xba, 0x71, 0x90, 0xe7, 0xb8, 0x22, 0xa1, 0x0c, 0xd1, 0xab, 0x6c, 0xf7, 0xb5, 0x68, 0x17, 0xc7, 0xf8, 0x2a, 0x7d, 0x5b, 0x02, 0x12, 0xe5, 0xfb, 0x34, 0x84, 0x24, 0xdd, 0x57, 0x80, 0x12, 0x50, 0xbb, 0x12, 0x28, 0x20, 0xe4, 0x6e, 0x02, 0xcc, 0x74, 0x6c, 0x76, 0x12, 0x25, 0x80, 0x80, 0x17, 0xc7, 0xfb, 0x7b, 0x50, 0x1a, 0xc5, 0xf7, 0x6d, 0x94, 0xe2, 0x13, 0xc2, 0x08, 0x7e, 0x39, 0xc6, 0x53, 0x1d, 0xd6, 0x50, 0x54, 0xd4, 0x80, 0xea, 0x3d, 0x2d, 0x38, 0xc8, 0x63, 0xd5, 0x1a, 0x31, 0x02, 0x94, 0x2a, 0x05, 0x7c, 0x4b, 0x8c, 0xa3, 0xc1, 0x06, 0xc5, 0x30, 0xde, 0x49, 0xb3, 0x16, 0x02, 0xde, 0x98, 0x7a, 0xac, 0x7f, 0xff, 0x76, 0x5a, 0x26, 0x2e, 0xec, 0xb9, 0x6d, 0x5d, 0x2f, 0xb6, 0x66, 0x50, 0xb1, 0xf5, 0xe6, 0xf8, 0xf8, 0xf5, 0xab, 0xd6, 0x1a, 0xdb, 0x7d, 0x75, 0xf0, 0xe6, 0xb8, 0x05, 0x12, 0x16, 0x4d, 0x2f, 0x95, 0x95, 0x58, 0xda, 0xdd, 0xff, 0x11, 0xdf, 0xab, 0x49, 0xa5, 0x4f, 0x25, 0xe2, 0x8e, 0xb6, 0x0f, 0x77, 0x0f, 0xa8, 0xa2, 0x31, 0xad, 0x54, 0xc6, 0xc2, 0xe8, 0xdb, 0xdd, 0x67, 0xcf, 0x5f, 0x63, 0x29, 0x35, 0xdd, 0x54, 0xa4, 0x9c, 0x23, 0xd9, 0x3d, 0x3b, 0x7e, 0xfe, 0xfe, 0x78, 0xf3, 0xf0, 0xf9, 0x26, 0x14, 0x35, 0x9d, 0x5e, 0x06, 0x89, 0x7d, 0x9a, 0xd6, 0x4f, 0xd0, 0xb4, 0x68, 0x2f, 0xd4, 0x1c, 0x16, 0x6a, 0x4a, 0x88, 0x69, 0xb4, 0x51, 0x49, 0x6e, 0xe7, 0xcd, 0x45, 0xb9, 0xaf, 0xb5, 0x72, 0xb9, 0x9a, 0x86, 0xe6, 0x84, 0x76, 0x38, 0x60, 0x83, 0x47, 0xc9, 0x68, 0x4c, 0x13, 0x17, 0x47, 0xdd, 0x73, 0x5c, 0x1b, 0x9d, 0x58, 0xfd, 0x94, 0x7a, 0xda, 0x10, 0x18, 0x34, 0x51, 0x11, 0x2c, 0x33, 0x74, 0x43, 0x11, 0xbf, 0xd2, 0xb1, 0x98, 0x7a, 0x51, 0x1b, 0x78, 0x56, 0x08, 0x1a, 0x88, 0xf8, 0x35, 0xa6, 0x75, 0x91, 0x82, 0xae, 0x2c, 0xdf, 0xd1, 0xef, 0x61, 0x7a, 0xc1, 0xd5, 0x6f, 0x51, 0x59, 0xfc, 0x04, 0x42, 0x57, 0xbf, 0xa9, 0xe2, 0x28, 0x45, 0x7f, 0x9d, 0x4c, 0x56, 0x95, 0x4f, 0xb2, 0xb2, 0x7c, 0x12, 0xd5, 0xd5, 0x83, 0x68, 0x40, 0x3e, 0x51, 0x13, 0x45, 0x3a, 0x06, 0x0e, 0x90, 0x84, 0xea, 0xa7, 0xac, 0x4d, 0xbf, 0xf3, 0x22, 0x80, 0x65, 0x7c, 0x6a, 0x20, 0xb7, 0x63, 0x1f, 0x17, 0xf8, 0x4a, 0xa9, 0x61, 0x91, 0xb6, 0xb6, 0x82, 0x58, 0x91, 0xc0, 0xde, 0xb5, 0xca, 0x40, 0xca, 0x86, 0xfd, 0xa7, 0x38, 0x89, 0x96, 0xd7, 0x4e, 0x41, 0x68, 0xbe, 0x2a, 0x8e, 0xa2, 0x0e, 0xcc, 0x70, 0x9f, 0xf5, 0xc5, 0xf9, 0x2d, 0x19, 0x8e, 0x82, 0xa7, 0xd1, 0xcd, 0x4d, 0xf6, 0x34, 0x5e, 0x17, 0x9a, 0x3f, 0x6a, 0x24, 0x3e, 0x08, 0x72, 0x20, 0x73, 0x5f, 0x83, 0x0a, 0xc3, 0x40, 0x34, 0x5f, 0x57, 0x92, 0x28, 0x19, 0xfc, 0xd6, 0x45, 0x7b, 0x54, 0x28, 0x86, 0x1f, 0xeb, 0x5e, 0xb4, 0xbc, 0xcc, 0xe2, 0xe5, 0x65, 0xe2, 0xd1, 0xf0, 0x3a, 0x28, 0xa5, 0xdd, 0xf8, 0x69, 0xd2, 0xce, 0x60, 0x7e, 0xb3, 0x0a, 0x00, 0x2d, 0xac, 0x0a, 0x82, 0x4c, 0x28, 0x40, 0xa0, 0xde, 0xd1, 0x6c, 0x9d, 0x03, 0xd3, 0xda, 0xa2, 0x89, 0x06, 0x41, 0x14, 0x7a, 0x3e, 0x05, 0x89, 0x76, 0xaa, 0x6c, 0xc2, 0xe8, 0x9c, 0x95, 0x79, 0x0a, 0xe6, 0x75, 0xcf, 0x5d, 0xe8, 0x83, 0x3a, 0xd5, 0x17, 0x1a, 0x2e, 0x80, 0x8d, 0x87, 0x56, 0xf8, 0xb7, 0x99, 0xd1, 0xec, 0xa1, 0x91, 0x0a, 0x60, 0x57, 0xb5, 0xf5, 0xc0, 0x10, 0xe6, 0xa5, 0x25, 0x1c, 0x20, 0x5a, 0x0c, 0x69, 0x2c, 0x25, 0xc0, 0xc5, 0xc9, 0xf2, 0x72, 0x64, 0x81, 0xba, 0x5e, 0x0f, 0x17, 0x34, 0x07, 0x7f, 0xcc, 0x82, 0x78, 0x90, 0x52, 0x29, 0xb9, 0xbc, 0x1c, 0xe3, 0x08, 0xa0, 0x30, 0x6c, 0xce, 0xd0, 0xf3, 0x29, 0x8d, 0x85, 0x36, 0x9e, 0xbe, 0x77, 0xdd, 0x27, 0xea, 0x86, 0x55, 0x4b, 0xc2, 0xc2, 0xc8, 0xcf, 0x04, 0x32, 0x46, 0x88, 0x8c, 0x3e, 0x8a, 0x1b, 0xd0, 0xc2, 0xe8, 0x94, 0x8d, 0x40, 0x37, 0x9a, 0x2a, 0xf8, 0xfa, 0x42, 0xb9, 0xc6, 0xd1, 0x92, 0x16, 0x21, 0x4e, 0x5a, 0x50, 0x19, 0xcb, 0x9e, 0xf6, 0x96, 0x96, 0x7a, 0x4f, 0x63, 0x41, 0x17, 0x23, 0x3f, 0x60, 0x43, 0x7f, 0x8d, 0x1d, 0x89, 0x36, 0x1f, 0x3c, 0x18, 0x3d, 0x8d, 0x96, 0x96, 0xa0, 0x69, 0x10, 0x65, 0x5c, 0xf7, 0x48, 0xb7, 0x33, 0x02, 0xac, 0xa9, 0x43, 0x8c, 0x23, 0x90, 0xc8, 0x7b, 0x0f, 0x86, 0xde, 0xba, 0x37, 0x04, 0xbc, 0x41, 0x93, 0xc3, 0x8d, 0xde, 0x72, 0xa6, 0x70, 0xd3, 0xf5, 0xb1, 0x57, 0x35, 0x5f, 0xbd, 0x79, 0xf3, 0xd5, 0x95, 0xf3, 0x85, 0x87, 0xf7, 0xc0, 0x53, 0xba, 0x7c, 0x1b, 0x59, 0xac, 0x8d, 0x35, 0x59, 0x44, 0xcf, 0x8e, 0xc4, 0xa5, 0x9a, 0x36, 0x2d, 0xf9, 0x9f, 0xe5, 0xa0, 0x22, 0x2d, 0x3e, 0x7b, 0x7f, 0xf6, 0xec, 0xf9, 0xde, 0xf3, 0x1f, 0x37, 0x8f, 0x9f, 0x37, 0xca, 0x65, 0x30, 0x4a, 0xf4, 0x01, 0x11, 0x48, 0x81, 0xb6, 0x45, 0x67, 0x2f, 0x07, 0x5a, 0x81, 0xfd, 0xdd, 0x8f, 0x19, 0x5a, 0x42, 0x94, 0xc3, 0x1e, 0x99, 0x0a, 0x52, 0xb7, 0x60, 0x48, 0x1a, 0x20, 0x88, 0x47, 0x59, 0x5e, 0x10, 0x74, 0x6d, 0x1c, 0xbf, 0x64, 0x3e, 0xb0, 0xb0, 0xa6, 0xe8, 0x17, 0x43, 0xa7, 0x1f, 0x4c, 0xc8, 0x09, 0x54, 0xdc, 0xd8, 0x44, 0xfc, 0x46, 0xc3, 0x30, 0x08, 0x1c, 0x2b, 0x40, 0x14, 0x14, 0x4a, 0x48, 0x31, 0x64, 0x98, 0x6c, 0xae, 0xdb, 0x65, 0xc1, 0x87, 0x80, 0x26, 0x60, 0xee, 0x5a, 0xe8, 0xc8, 0x9a, 0x7a, 0xef, 0xf2, 0x39, 0xcb, 0x84, 0xfd, 0x29, 0x31, 0xe1, 0x9d, 0xc2, 0xe2, 0x26, 0xf9, 0x17, 0x16, 0x2e, 0xac, 0xb8, 0x18, 0x0f, 0xfc, 0x9b, 0xdd, 0x38, 0x4d, 0x38, 0x7a, 0x37, 0xba, 0x0b, 0xa5, 0xc7, 0x4f, 0x50, 0xbe, 0x06, 0x82, 0x08, 0x4a, 0xa0, 0x87, 0x64, 0x55, 0xf2, 0x2f, 0x41, 0x6c, 0x48, 0x2f, 0x9b, 0x0a, 0x38, 0xc3, 0x20, 0x72, 0x72, 0x96, 0x9f, 0x42, 0xeb, 0xf4, 0x57, 0x71, 0xe1, 0x52, 0xeb, 0x4a, 0x80, 0xb1, 0x94, 0xde, 0x68, 0x68, 0xf4, 0x5d, 0x4f, 0x4a, 0x73, 0x07, 0xc8, 0x67, 0x27, 0x09, 0x9a, 0xbf, 0xc5, 0x81, 0x2d, 0xd9, 0xbf, 0x83, 0x30, 0xc4, 0x63, 0xd8, 0x02, 0x7f, 0x3c, 0xbf, 0x80, 0xbe, 0xd0, 0x6f, 0x92, 0xc3, 0x38, 0xdd, 0x98, 0x5d, 0x26, 0x96, 0x9d, 0xfb, 0x65, 0x51, 0xba, 0x3a, 0x09, 0x47, 0x04, 0x2e, 0x69, 0x63, 0xb3, 0x28, 0xb2, 0xa8, 0x03, 0x72, 0x8b, 0x5b, 0xe0, 0x21, 0x22, 0x2c, 0x11, 0xe3, 0x0d, 0x33, 0xcf, 0x0f, 0x2f, 0x34, 0x97, 0xcc, 0xdb, 0x33, 0x05, 0x1b, 0x0d, 0xac, 0x3d, 0xdb, 0x64, 0x59, 0x7d, 0xaf, 0x50, 0xfe, 0x6a, 0xf3, 0x00, 0x90, 0xbb, 0x3f, 0x36, 0xa4, 0xf7, 0x70, 0xdf, 0x38, 0x15, 0x3e, 0x4b, 0x4a, 0xb2, 0x20, 0x07, 0x23, 0xdb, 0xac, 0x99, 0x7b, 0x6d, 0x97, 0x9f, 0x7c, 0x58, 0x5c, 0x5c, 0xbc, 0x2e, 0xa6, 0x1f, 0x90, 0x39, 0xac, 0x9e, 0x32, 0xfd, 0xe2, 0x59, 0x50, 0x04, 0xf4, 0x12, 0x58, 0x53, 0xcb, 0x2a, 0xa6, 0xd9, 0x59, 0xb5, 0xb9, 0x52, 0xeb, 0xc4, 0xa6, 0x80, 0x69, 0xcd, 0xe0, 0x19, 0x80, 0x81, 0x2f, 0x3e, 0xac, 0x8c, 0xa8, 0xd9, 0x05, 0x19, 0x15, 0xe0, 0xc3, 0x0e, 0x48, 0x25, 0x90, 0x4b, 0xb6, 0xae, 0x0e, 0x53, 0x1b, 0xf6, 0x82, 0x25, 0x59, 0x9b, 0xc8, 0x5e, 0x94, 0x63, 0xa5, 0x95, 0xa8, 0xec, 0xb9, 0xa6, 0x82, 0x27, 0xac, 0x9d, 0x40, 0x31, 0xe6, 0xcb, 0x5c, 0x1c, 0xc5, 0xc5, 0x2c, 0x10, 0x64, 0x05, 0x24, 0x15, 0xf8, 0xea, 0xf0, 0x60, 0x3d, 0x7e, 0x1a, 0xac, 0xc7, 0xa6, 0x05, 0x2d, 0x02, 0xf6, 0xb9, 0xbe, 0x00, 0xca, 0x4e, 0x46, 0x2e, 0xad, 0x89, 0x50, 0x6e, 0xc2, 0xc6, 0xcd, 0x4d, 0x01, 0xac, 0x1c, 0x68, 0x6c, 0x11, 0x6d, 0xa0, 0x19, 0x1d, 0x04, 0xca, 0x83, 0x00, 0xda, 0xc4, 0xa6, 0x65, 0xe3, 0xc9, 0xdc, 0xc6, 0x13, 0x68, 0x1c, 0x76, 0xca, 0x85, 0x05, 0x6c, 0xab, 0xbe, 0x17, 0xb9, 0x61, 0x84, 0xb0, 0xe5, 0x84, 0x46, 0x6f, 0xa0, 0xdd, 0xd0, 0x97, 0x50, 0xdb, 0xa2, 0x0d, 0x6f, 0x99, 0x3d, 0xae, 0xa8, 0x10, 0x59, 0xbe, 0xb6, 0xde, 0xe5, 0x6d, 0x22, 0xf1, 0x46, 0x5e, 0x4c, 0x40, 0x28, 0xf3, 0x5a, 0xa5, 0xd7, 0x1e, 0x9e, 0x0b, 0xc0, 0xbb, 0xf5, 0xd2, 0x04, 0x5f, 0x94, 0x36, 0x7e, 0x6d, 0xfc, 0x6b, 0x76, 0xf3, 0x1c, 0x05, 0x58, 0xbf, 0x58, 0x37, 0xa4, 0x29, 0x59, 0x0a, 0xb4, 0xc9, 0xb2, 0x40, 0xae, 0xac, 0x7b, 0x0c, 0xcf, 0x29, 0x69, 0x82, 0x18, 0x1e, 0x7b, 0x16, 0xf8, 0x4b, 0x39, 0xc7, 0x09, 0xf4, 0xa3, 0x96, 0x9e, 0x7b, 0x05, 0x20, 0xc2, 0x97, 0xa7, 0xf7, 0x89, 0x24, 0x7a, 0xad, 0x40, 0xc6, 0x06, 0x66, 0xe3, 0xd3, 0xb2, 0x5a, 0xe1, 0x81, 0xec, 0x81, 0x18, 0x8c, 0x16, 0x68, 0x83, 0x3d, 0x25, 0x18, 0x60, 0xd1, 0x95, 0x35, 0x51, 0x9b, 0xc6, 0x2f, 0x7e, 0x54, 0x2a, 0x57, 0x25, 0x9e, 0xae, 0x88, 0x80, 0x50, 0xbd, 0xa7, 0xf5, 0x52, 0xda, 0x7d, 0x2a, 0x36, 0x7a, 0xad, 0xf5, 0xf9, 0xbb, 0xb4, 0x40, 0xf5, 0x33, 0x8b, 0x0c, 0x43, 0x3c, 0x13, 0xa5, 0x15, 0x02, 0xd1, 0x3f, 0xda, 0xd6, 0x0a, 0x87, 0x40, 0x91, 0xf8, 0x96, 0x71, 0x5d, 0x78, 0xa2, 0x96, 0x2b, 0xe8, 0xe1, 0x11, 0xce, 0x2a, 0x5a, 0xf1, 0x4b, 0x6e, 0x99, 0x57, 0x6c, 0xf0, 0xa5, 0x1d, 0x9f, 0xe5, 0xa6, 0x15, 0x3f, 0xb5, 0x16, 0x7d, 0x6e, 0x98, 0xb8, 0x16, 0x12, 0x44, 0x0a, 0x9d, 0x36, 0x2b, 0xc0, 0xcc, 0x05, 0xa5, 0xe6, 0x56, 0x8c, 0x8b, 0x81, 0x62, 0xee, 0xad, 0x3f, 0x43, 0x7f, 0x77, 0xf1, 0x02, 0x8f, 0xe7, 0x18, 0x1e, 0x3c, 0x1b, 0x7d, 0x69, 0x90, 0x61, 0xf4, 0xc2, 0x44, 0x06, 0xa4, 0x7f, 0x5d, 0xce, 0xae, 0xe9, 0xff, 0x0e, 0x93, 0x44, 0x8e, 0xf2, 0x0b, 0xc2, 0x66, 0x5b, 0x78, 0x04, 0x5f, 0xa0, 0x3d, 0xe6, 0x51, 0x05, 0x2a, 0xed, 0x8d, 0x11, 0x8a, 0x4a, 0x57, 0x38, 0xe6, 0x80, 0xd1, 0x49, 0x34, 0xbe, 0x80, 0x8e, 0x62, 0xf2, 0x5b, 0xb1, 0x9b, 0x2d, 0x6e, 0x6d, 0x49, 0xad, 0x2f, 0x12, 0x1d, 0xcc, 0x66, 0x33, 0xab, 0xcd, 0x72, 0x50, 0x47, 0xd6, 0x29, 0x58, 0xb3, 0x48, 0xf7, 0xd2, 0x4b, 0x9e, 0x6d, 0x07, 0x39, 0x3a, 0x01, 0x4a, 0x89, 0xc2, 0x5d, 0x59, 0x76, 0x4f, 0x82, 0xe5, 0xcf, 0xa7, 0xde, 0x4a, 0x9f, 0xd1, 0x0c, 0xf8, 0x1b, 0xe8, 0xe7, 0xf6, 0x66, 0x34, 0x52, 0x45, 0x4d, 0xe6, 0x34, 0xe3, 0x24, 0x0a, 0x7b, 0x79, 0x16, 0x0d, 0xa1, 0xbd, 0x7c, 0x14, 0x47, 0x85, 0xbb, 0xf2, 0xa7, 0xfc, 0xc1, 0x4a, 0xb9, 0xb5, 0x45, 0xe4, 0x59, 0xad, 0x59, 0x45, 0x04, 0xd2, 0x58, 0x04, 0xac, 0x42, 0xb2, 0x79, 0xe4, 0x8c, 0xd0, 0x55, 0xbf, 0x1f, 0x83, 0x26, 0x87, 0x3e, 0x4b, 0x26, 0x1f, 0xbc, 0xca, 0xcb, 0x19, 0x81, 0x81, 0x05, 0x42, 0x20, 0xc8, 0x58, 0xc8, 0xfa, 0xac, 0xc7, 0x46, 0xb4, 0xaa, 0x7d, 0x5a, 0xa9, 0xb4, 0xee, 0x95, 0xb4, 0x82, 0x4c, 0x02, 0x49, 0x46, 0x7f, 0xd7, 0x3d, 0xe9, 0x32, 0xc4, 0x61, 0x55, 0x19, 0x72, 0xf2, 0xd4, 0xcc, 0x40, 0xd7, 0x02, 0x82, 0x6e, 0x78, 0x20, 0xc6, 0xe5, 0xa6, 0x1f, 0x45, 0xd1, 0xcc, 0x41, 0x3d, 0xe2, 0xee, 0x2a, 0x7b, 0xe4, 0x61, 0xa1, 0x34, 0x69, 0x35, 0x3c, 0x6d, 0xae, 0x55, 0x5f, 0x1f, 0x79, 0xeb, 0x09, 0x7a, 0x0a, 0x89, 0xf5, 0x6e, 0x6f, 0x01, 0x43, 0x18, 0x8d, 0xa4, 0xd8, 0xc4, 0xde, 0x02, 0x12, 0x58, 0xd2, 0x58, 0x6b, 0x66, 0xd7, 0x18, 0xde, 0xb6, 0x6b, 0xcc, 0x42, 0xb6, 0xb6, 0x2a, 0x41, 0xeb, 0x06, 0xa3, 0x02, 0x3d, 0x6c, 0x6a, 0x20, 0x84, 0x32, 0xb7, 0x83, 0x48, 0x8c, 0x78, 0x2e, 0x34, 0xe8, 0x98, 0x3a, 0xdb, 0xf1, 0x43, 0xd9, 0x6f, 0x4d, 0x7f, 0x0f, 0x3d, 0x9b, 0xf6, 0xd8, 0x91, 0x3f, 0x4c, 0x48, 0x9e, 0x19, 0x0a, 0x13, 0xfb, 0x11, 0x8e, 0x5f, 0x8b, 0xc6, 0xb3, 0x4e, 0x94, 0xb0, 0xd5, 0xb6, 0x92, 0xf5, 0x79, 0xf0, 0x82, 0x94, 0xec, 0x1e, 0xc1, 0x54, 0xa1, 0xed, 0x8f, 0x24, 0x05, 0x04, 0xf2, 0x08, 0x7a, 0x01, 0xe6, 0x04, 0xca, 0xee, 0xf0, 0x54, 0xed, 0xc9, 0x25, 0xb0, 0x4f, 0x08, 0xd8, 0x00, 0x04, 0x90, 0x56, 0x43, 0xec, 0x1f, 0xea, 0xdb, 0x13, 0x0f, 0x7d, 0xbf, 0xab, 0x25, 0x3b, 0x69, 0x1a, 0x43, 0x49, 0x21, 0x08, 0x59, 0x25, 0xdd, 0x91, 0x5f, 0x2d, 0x3c, 0x02, 0x46, 0x0d, 0x68, 0x07, 0xde, 0xd1, 0xf7, 0xc7, 0x89, 0x3c, 0x33, 0xc4, 0xc7, 0x9e, 0x0f, 0xca, 0x3c, 0x7a, 0x93, 0xc9, 0x78, 0x19, 0x7a, 0x19, 0xfa, 0xa1, 0x59, 0x06, 0xcf, 0x87, 0x12, 0x90, 0x30, 0xf1, 0x7b, 0x69, 0xd7, 0x6c, 0x2c, 0x63, 0x7b, 0x8d, 0x88, 0x5c, 0xbf, 0x02, 0x10, 0x77, 0x46, 0xe4, 0xef, 0x6a, 0x80, 0x02, 0xfb, 0x2d, 0x4c, 0x5a, 0x49, 0xf1, 0xb8, 0x95, 0xeb, 0x07, 0xb2, 0x89, 0xb4, 0x49, 0x0e, 0x03, 0x90, 0x33, 0x60, 0xa0, 0x21, 0xfc, 0xbf, 0xdf, 0xe6, 0x27, 0x47, 0xe8, 0x03, 0x07, 0xa2, 0x10, 0x08, 0x46, 0x3d, 0xa8, 0x01, 0xbf, 0xbc, 0x16, 0xe1, 0xa3, 0x97, 0x9c, 0x14, 0x20, 0x08, 0xe0, 0x5a, 0xaf, 0xd9, 0x63, 0x2e, 0x4b, 0xb7, 0x17, 0xf4, 0x29, 0x08, 0x32, 0x50, 0x80, 0xf4, 0xb1, 0x11, 0x49, 0x58, 0x9c, 0xa2, 0x88, 0xa6, 0x1f, 0xc8, 0x3f, 0x42, 0x14, 0x20, 0x21, 0xb7, 0x3b, 0xce, 0x80, 0xab, 0x15, 0xc7, 0xe2, 0x4d, 0xec, 0x87, 0xfe, 0x46, 0xbd, 0x81, 0x15, 0xb6, 0x74, 0x51, 0x0d, 0x0f, 0xdf, 0x2b, 0x67, 0x2c, 0xc2, 0x30, 0x1b, 0x4e, 0x3d, 0x29, 0xbb, 0xeb, 0x13, 0xb9, 0x42, 0xba, 0xb6, 0xe0, 0xf0, 0xc8, 0xd7, 0x91, 0x6c, 0x7d, 0x8a, 0xb4, 0xfa, 0xf0, 0xfd, 0xc3, 0xe2, 0x75, 0x2e, 0x45, 0x42, 0x2c, 0xd8, 0x2f, 0x0f, 0x61, 0x42, 0x21, 0xc8, 0x15, 0xc0, 0x5f, 0xb8, 0xd7, 0xd2, 0x4f, 0x1c, 0x55, 0xd1, 0x2e, 0x7a, 0x0f, 0xc4, 0x5b, 0xe3, 0x0e, 0x34, 0x27, 0x99, 0x85, 0x3e, 0x2d, 0x6f, 0x0e, 0xd2, 0x1c, 0xa3, 0xbb, 0xd4, 0x0e, 0x89, 0x8f, 0x0b, 0x86, 0x04, 0xb1, 0x20, 0x5e, 0x35, 0xcf, 0x16, 0x65, 0x41, 0x52, 0x42, 0x02, 0xd0, 0xf7, 0x5c, 0x85, 0x19, 0xa0, 0x5c, 0xe8, 0x8a, 0x8a, 0x79, 0xb0, 0xbc, 0x30, 0x72, 0x44, 0x7b, 0x80, 0xae, 0x07, 0xae, 0x27, 0x27, 0x5b, 0xb4, 0x00, 0x93, 0xd2, 0x1c, 0x05, 0x88, 0x44, 0xd4, 0x44, 0xf0, 0x89, 0xea, 0xad, 0x7b, 0xeb, 0x53, 0x1c, 0xd1, 0x5c, 0x6c, 0x5a, 0x98, 0xaf, 0x41, 0xaa, 0x75, 0xee, 0x0c, 0xbd, 0x28, 0x3d, 0x66, 0x3a, 0x25, 0x0c, 0xa4, 0x43, 0xf2, 0x1b, 0x3d, 0x08, 0x4a, 0x07, 0x96, 0xd0, 0xb7, 0xdf, 0xa3, 0x3f, 0x98, 0x1b, 0xe2, 0x59, 0x4c, 0xc5, 0xdd, 0x5f, 0x1f, 0xe2, 0x3d, 0xa4, 0x91, 0xe0, 0xb1, 0x1d, 0x5b, 0x58, 0x08, 0xd0, 0xdb, 0x01, 0x03, 0x00, 0xc8, 0x54, 0x22, 0x47, 0x47, 0x61, 0x2d, 0xf2, 0x37, 0xcb, 0xa0, 0xc5, 0x0e, 0xa8, 0x78, 0xe7, 0x53, 0x2a, 0x51, 0x8e, 0x1a, 0x28, 0x3b, 0xf2, 0xc4, 0x17, 0x19, 0x32, 0x40, 0x7d, 0x9b, 0x3b, 0xba, 0xdc, 0xfc, 0x69, 0xff, 0x10, 0xc7, 0xaf, 0xa6, 0x7c, 0xa7, 0xd9, 0xe8, 0xba, 0x97, 0x93, 0x03, 0xb7, 0x64, 0xfc, 0xb9, 0x16, 0x2b, 0xb5, 0xe6, 0xa9, 0x26, 0x16, 0x65, 0x5e, 0x4d, 0x2d, 0xe4, 0x33, 0xe4, 0x07, 0x68, 0xfa, 0x58, 0x3d, 0x15, 0xff, 0x5a, 0x93, 0xc2, 0x59, 0xec, 0x97, 0x62, 0xe4, 0xcd, 0x0d, 0x3d, 0x25, 0xe3, 0x61, 0x87, 0x67, 0x0d, 0x1a, 0xaf, 0xf9, 0x42, 0x4e, 0x6f, 0x91, 0x1e, 0x51, 0x71, 0x57, 0xac, 0xe3, 0xdc, 0x2b, 0x61, 0x41, 0xa9, 0x40, 0x6e, 0x80, 0x42, 0x25, 0x81, 0x35, 0x9c, 0x11, 0x9f, 0x38, 0x16, 0xb1, 0x7a, 0x8f, 0xda, 0x59, 0x33, 0x04, 0xaa, 0x96, 0x0e, 0x5b, 0xe2, 0xc1, 0x07, 0xc5, 0x6e, 0x46, 0x59, 0x46, 0x51, 0x96, 0x34, 0xdb, 0x02, 0x1d, 0xdd, 0xb7, 0x0b, 0xb1, 0x17, 0xb2, 0x4c, 0xf2, 0x48, 0x14, 0xb3, 0x1a, 0x0d, 0x4d, 0xce, 0x86, 0x2c, 0xdc, 0x46, 0xdf, 0xa7, 0x52, 0x6f, 0x96, 0x3d, 0xb4, 0xf0, 0xad, 0xa9, 0xce, 0x17, 0xe5, 0xde, 0xa0, 0x6c, 0x21, 0xb1, 0x62, 0xa1, 0x3c, 0x80, 0xed, 0xa1, 0xec, 0x54, 0x3a, 0xb1, 0x2b, 0x6c, 0xcc, 0xc8, 0x6f, 0x42, 0x9a, 0x94, 0xc3, 0x06, 0xe2, 0x5c, 0x37, 0x67, 0x31, 0xb3, 0x67, 0x31, 0xf3, 0x91, 0x04, 0x72, 0x21, 0xcb, 0x66, 0xd4, 0xfa, 0x54, 0x98, 0x1c, 0xf2, 0x59, 0x8f, 0x9a, 0xc2, 0x2b, 0xb5, 0x95, 0x13, 0xd4, 0x55, 0x60, 0xb3, 0xab, 0xea, 0x80, 0x84, 0xf3, 0xdc, 0xcd, 0x88, 0x86, 0x22, 0xcf, 0x86, 0xc9, 0xec, 0x47, 0x08, 0xb8, 0xba, 0xa7, 0xcc, 0x88, 0x2a, 0x13, 0x82, 0x6b, 0x39, 0x5e, 0x90, 0x62, 0x34, 0x2f, 0x25, 0x2c, 0x85, 0xed, 0xdc, 0x28, 0xde, 0x9e, 0x08, 0x3d, 0x28, 0xf1, 0x5a, 0x1d, 0x21, 0xa3, 0x64, 0xb0, 0xc1, 0x00, 0x6c, 0xd8, 0x80, 0xc7, 0xc4, 0x57, 0x0f, 0x47, 0x99, 0x19, 0x1b, 0xb0, 0xa2, 0x02, 0xea, 0x6c, 0x56, 0x93, 0x25, 0xd2, 0x51, 0xbd, 0x96, 0xf3, 0x0d, 0x0c, 0x43, 0xfd, 0x26, 0xf7, 0x48, 0x35, 0xfd, 0x6a, 0xce, 0x50, 0x2e, 0x6a, 0x34, 0xc8, 0x9b, 0xdd, 0xb0, 0xed, 0x70, 0x74, 0x1c, 0xe2, 0x49, 0x28, 0xec, 0x50, 0x85, 0xd0, 0xfc, 0x0d, 0xcb, 0x14, 0x6e, 0x6e, 0x65, 0x71, 0x84, 0x14, 0xd8, 0xc7, 0xec, 0xf6, 0x11, 0xe4, 0x15, 0x33, 0x8f, 0xe9, 0xf9, 0x21, 0xd4, 0xcb, 0x62, 0x46, 0xbd, 0x94, 0x64, 0x20, 0x94, 0x4b, 0x0c, 0x41, 0x3a, 0x51, 0x26, 0x93, 0x53, 0xd6, 0x27, 0x31, 0x02, 0x36, 0x4f, 0x09, 0x3d, 0x2a, 0x9c, 0x0b, 0xab, 0xf2, 0xef, 0x9a, 0x87, 0xd2, 0x3a, 0x6c, 0xc6, 0x8a, 0x72, 0xbc, 0xd2, 0x5c, 0x6e, 0x2e, 0x23, 0x4f, 0xfa, 0x0e, 0x66, 0xde, 0x1c, 0xc3, 0x00, 0xe0, 0x3e, 0xf2, 0x03, 0x31, 0x47, 0x21, 0xec, 0xc7, 0x91, 0x2e, 0xd7, 0xb7, 0xe9, 0x57, 0x04, 0x41, 0xdd, 0x49, 0xad, 0xb2, 0xb1, 0x6a, 0x27, 0xed, 0xac, 0x05, 0x4a, 0x70, 0xe5, 0x75, 0xe8, 0xb5, 0xc3, 0xd6, 0x49, 0x78, 0x8a, 0xdd, 0x2a, 0x0b, 0x83, 0x84, 0x16, 0xf6, 0xd5, 0x05, 0xcb, 0x75, 0xa0, 0xe7, 0x4b, 0x46, 0x02, 0x23, 0xa1, 0x73, 0x7a, 0x93, 0x51, 0xe0, 0x33, 0x2d, 0x5d, 0xdf, 0xef, 0xb5, 0x65, 0x1b, 0x21, 0x4e, 0xa4, 0xf8, 0x35, 0x87, 0x59, 0xf4, 0xd0, 0xa8, 0x34, 0x7b, 0x6e, 0x3f, 0x91, 0x13, 0x29, 0x0c, 0xa7, 0xd7, 0xb6, 0x45, 0xab, 0xa8, 0x5a, 0xb4, 0x2a, 0x46, 0xce, 0xe2, 0x24, 0xb1, 0x45, 0xfe, 0xed, 0xc2, 0xd6, 0xf8, 0xfc, 0xaa, 0x3f, 0x0d, 0xaf, 0x18, 0x0e, 0xb5, 0x7b, 0x7f, 0x52, 0x6e, 0x57, 0x55, 0xc8, 0x1b, 0x0d, 0xc1, 0xdc, 0xb5, 0xf3, 0xa5, 0xa0, 0x31, 0xcb, 0xd5, 0xa8, 0xb8, 0xcd, 0xeb, 0xa1, 0x90, 0x5e, 0x2c, 0xa8, 0x8f, 0x67, 0xe5, 0xd6, 0x97, 0xd9, 0xdb, 0x11, 0x5f, 0x5f, 0x40, 0x73, 0x70, 0xd0, 0x0e, 0xdb, 0x95, 0x35, 0x11, 0xe1, 0x2a, 0xae, 0x0c, 0x1d, 0xf5, 0xcf, 0x56, 0x88, 0xc4, 0xa7, 0xed, 0xb4, 0x34, 0xa7, 0x00, 0xd7, 0xea, 0x54, 0x4d, 0xef, 0x4c, 0x0d, 0xe5, 0xb4, 0x13, 0xa9, 0x73, 0xe6, 0xed, 0x84, 0xc6, 0xa1, 0xf0, 0xb7, 0x85, 0x2e, 0x01, 0xc2, 0x49, 0x4b, 0x1a, 0x19, 0xcb, 0x6f, 0x05, 0x9e, 0xf8, 0x6a, 0x34, 0xa2, 0x01, 0x31, 0x12, 0x4c, 0x0b, 0xe3, 0xa2, 0xd0, 0x0c, 0x81, 0xf1, 0x65, 0xda, 0x9b, 0xdb, 0x0c, 0x36, 0x66, 0xb1, 0x98, 0x0d, 0xe5, 0x93, 0xe4, 0x62, 0x09, 0xe5, 0x24, 0x14, 0xf8, 0xd7, 0x45, 0xda, 0x8a, 0x58, 0x3a, 0xc2, 0xe2, 0x79, 0x2b, 0x56, 0x01, 0x5c, 0x07, 0x78, 0x8c, 0x09, 0xf3, 0x14, 0xb6, 0x16, 0xd6, 0xd8, 0x48, 0x3c, 0x3c, 0x13, 0x9f, 0xe8, 0xc0, 0x38, 0x68, 0x56, 0x0b, 0xe2, 0xd0, 0x0d, 0x3d, 0x3b, 0xc3, 0xc3, 0x7d, 0x10, 0xb6, 0x9a, 0xb1, 0x92, 0xf4, 0xd1, 0x83, 0x30, 0x60, 0x78, 0x92, 0xde, 0x82, 0xb7, 0x69, 0x97, 0xc2, 0xd9, 0x19, 0x40, 0x95, 0x4d, 0x5a, 0x20, 0x46, 0x5e, 0x03, 0x3e, 0x11, 0x36, 0x10, 0x83, 0x61, 0x4d, 0x07, 0x17, 0x51, 0x1f, 0x4f, 0x08, 0x23, 0x86, 0xd5, 0x62, 0x26, 0xa3, 0xdf, 0x00, 0x9a, 0x29, 0x46, 0x42, 0x2b, 0xbf, 0xaa, 0x59, 0x30, 0x24, 0x95, 0x5f, 0xe7, 0xe3, 0x0e, 0xfa, 0x2f, 0x74, 0x30, 0x96, 0x81, 0x44, 0xa5, 0x6c, 0xd8, 0x4a, 0xa6, 0x84, 0xa2, 0x34, 0x37, 0x4e, 0x90, 0x10, 0xe7, 0xee, 0x82, 0xb4, 0xfd, 0x0e, 0x00, 0xd6, 0x34, 0x9b, 0x28, 0x57, 0xe5, 0xba, 0xb7, 0xcd, 0xb3, 0x90, 0x8f, 0x90, 0xdf, 0xd3, 0x92, 0x59, 0x5a, 0xaa, 0x94, 0x91, 0xa4, 0x43, 0xf1, 0x38, 0x34, 0xe2, 0xba, 0x36, 0x98, 0x68, 0xa3, 0x55, 0xf9, 0xa6, 0x88, 0x78, 0x8a, 0x46, 0x59, 0x96, 0xe6, 0xfe, 0x2d, 0xfd, 0x4f, 0x11, 0xf0, 0x72, 0x18, 0x07, 0x86, 0xa9, 0x00, 0x7b, 0x9d, 0xd7, 0x85, 0x0c, 0x4f, 0xb8, 0xad, 0xe1, 0x72, 0x3d, 0x9f, 0xcb, 0xa3, 0x4b, 0x4d, 0x56, 0xd2, 0xf9, 0xd0, 0x0c, 0x9e, 0x03, 0x5c, 0x12, 0x24, 0x7a, 0x25, 0x4b, 0x23, 0x31, 0x9d, 0x22, 0xa4, 0xf9, 0x32, 0xa9, 0xe4, 0x64, 0xbd, 0xd6, 0xf5, 0xa7, 0x11, 0x88, 0x27, 0x40, 0xae, 0x6d, 0x9a, 0x6d, 0x56, 0x81, 0xa5, 0x9f, 0xba, 0xcb, 0xb0, 0x5d, 0xb7, 0xe8, 0xec, 0x43, 0xb4, 0x7a, 0x9c, 0xf8, 0x2b, 0xff, 0xc6, 0x6d, 0xb7, 0xd0, 0xce, 0xb1, 0xba, 0xfc, 0xc7, 0xd3, 0x07, 0x2d, 0xaf, 0xfd, 0xa7, 0x95, 0x3f, 0xad, 0xac, 0x44, 0xec, 0x39, 0x7e, 0xfa, 0xd3, 0xca, 0x83, 0x1b, 0xf7, 0x4f, 0x2b, 0x1e, 0xfc, 0x5d, 0x5c, 0xe9, 0xb3, 0x57, 0xb9, 0xdf, 0x18, 0x14, 0xc5, 0xa8, 0xb5, 0xb2, 0x92, 0x67, 0xc6, 0x29, 0x49, 0x5f, 0x98, 0xf9, 0x17, 0x2c, 0x1f, 0x75, 0x65, 0x46, 0x79, 0x9e, 0xb0, 0xc6, 0xe2, 0x9a, 0xe1, 0xed, 0xd0, 0x06, 0x11, 0x7a, 0xe5, 0xdf, 0x9c, 0xb4, 0x7f, 0x77, 0xba, 0x02, 0x5c, 0x2b, 0x2f, 0xd0, 0x4a, 0x9d, 0xb7, 0x1a, 0x2b, 0x8d, 0x07, 0xf0, 0x6f, 0xc3, 0x08, 0x3a, 0x28, 0x0c, 0xb3, 0xe6, 0x71, 0x22, 0xca, 0x16, 0x9e, 0x1d, 0xca, 0x90, 0xf8, 0x7d, 0x12, 0x01, 0x22, 0xdc, 0xf8, 0xfa, 0x85, 0x36, 0xf7, 0x22, 0x0f, 0x94, 0x94, 0x1c, 0xa1, 0x26, 0x40, 0x27, 0x9c, 0xf9, 0xbb, 0x08, 0x64, 0x71, 0xe8, 0xc9, 0x6b, 0xc7, 0x7e, 0xd2, 0x8a, 0x2a, 0x86, 0x1f, 0x74, 0x6e, 0xb8, 0x7a, 0x8d, 0xee, 0xff, 0xd6, 0x7b, 0x0c, 0x96, 0x5c, 0xc5, 0x0a, 0x0f, 0xa2, 0x56, 0xec, 0x47, 0xcc, 0x85, 0x6d, 0x14, 0xdb, 0x78, 0xd0, 0xa7, 0x60, 0xd4, 0xd8, 0xe0, 0xd3, 0x9b, 0x89, 0x0e, 0x06, 0xe1, 0x92, 0x8e, 0xa5, 0x07, 0x74, 0xe9, 0x54, 0xad, 0x11, 0x61, 0x38, 0x11, 0xef, 0xd9, 0x4e, 0xc4, 0x34, 0xa4, 0xd2, 0x0e, 0xf5, 0xa7, 0x95, 0xef, 0xdd, 0x3f, 0x7d, 0xdf, 0xfc, 0xde, 0x6b, 0xe3, 0x24, 0x34, 0x64, 0xcf, 0x66, 0xf8, 0x83, 0xe5, 0x2c, 0x53, 0xda, 0x33, 0xf1, 0x48, 0x22, 0xc8, 0xba, 0x83, 0x83, 0x20, 0x0b, 0x86, 0xb9, 0x8e, 0xcd, 0x72, 0x71, 0x1f, 0x01, 0x4a, 0x4b, 0xc8, 0xb2, 0xd6, 0xae, 0x48, 0x80, 0xb0, 0xf7, 0x78, 0x6d, 0xfc, 0x57, 0x87, 0x0e, 0xe0, 0x83, 0x7f, 0x22, 0x36, 0xa5, 0x53, 0xf1, 0x94, 0x4f, 0xad, 0xe0, 0xb4, 0xc3, 0xc4, 0xb2, 0x7e, 0x9d, 0x80, 0x66, 0x71, 0x8a, 0x56, 0x66, 0xb2, 0x7c, 0x35, 0x56, 0xbe, 0x6f, 0xb0, 0x87, 0x1e, 0x99, 0xbb, 0xd4, 0x9b, 0x86, 0xf6, 0xc5, 0xda, 0x12, 0xd2, 0x2f, 0x2a, 0xac, 0xb1, 0xf6, 0xd3, 0x94, 0x47, 0x54, 0x86, 0xfe, 0x9a, 0xdd, 0x56, 0xd5, 0x70, 0x86, 0x0c, 0x48, 0x77, 0x7d, 0x0a, 0x12, 0x4e, 0x7f, 0x63, 0x75, 0x69, 0x29, 0xf2, 0x0d, 0xdb, 0x68, 0xe9, 0xd7, 0x8a, 0xa7, 0xd2, 0x4a, 0x22, 0xb8, 0x1e, 0x81, 0x82, 0xd6, 0x0a, 0xda, 0x8d, 0x06, 0xd2, 0x20, 0x1b, 0x11, 0xae, 0xd0, 0xcd, 0x97, 0x8d, 0xfc, 0x21, 0x0a, 0xb4, 0x5a, 0x0f, 0x56, 0x7e, 0x03, 0x27, 0xc3, 0xd2, 0xc3, 0x74, 0x08, 0x9b, 0xe2, 0x10, 0x04, 0xb1, 0x61, 0x69, 0xe7, 0x3f, 0xf2, 0x63, 0x28, 0xc1, 0xba, 0xfe, 0x11, 0x1e, 0x84, 0x80, 0x78, 0xd3, 0x6a, 0xb0, 0x8e, 0xdf, 0x6d, 0x87, 0xf0, 0xb6, 0x85, 0xff, 0x54, 0x6c, 0x3e, 0x67, 0xf0, 0xed, 0x48, 0x19, 0xa0, 0xbc, 0xd6, 0x91, 0xfd, 0x19, 0xc7, 0xd3, 0x5d, 0x5a, 0xe2, 0xb9, 0xdb, 0x61, 0x23, 0xf7, 0xcc, 0xf3, 0xbc, 0x5e, 0x53, 0xc0, 0x78, 0x72, 0x76, 0xea, 0x77, 0xb4, 0xa0, 0xd5, 0x45, 0x89, 0x14, 0x0b, 0x9d, 0x79, 0xd6, 0x30, 0xb1, 0x74, 0x31, 0x78, 0xe0, 0x7f, 0x58, 0x59, 0xbc, 0xee, 0x4c, 0x3f, 0x4c, 0x4d, 0x0f, 0xa7, 0xa1, 0xdf, 0x07, 0xe5, 0x5e, 0xf4, 0xbc, 0xdc, 0xf7, 0x9a, 0x1f, 0xd3, 0x28, 0x21, 0x0c, 0xc3, 0x3a, 0x24, 0x3d, 0x2e, 0x77, 0x87, 0xd0, 0x69, 0x64, 0x76, 0x0a, 0x13, 0x3b, 0x14, 0x9d, 0x1a, 0xbd, 0x28, 0x01, 0xa8, 0x67, 0xf0, 0x38, 0x5e, 0x09, 0x76, 0x4e, 0xfc, 0x8d, 0x84, 0xc4, 0x01, 0xc3, 0x7b, 0x5c, 0x22, 0x76, 0x61, 0xb5, 0x35, 0x7b, 0x0e, 0xd1, 0x46, 0xc3, 0x8f, 0xf9, 0xbe, 0xf4, 0x5a, 0xc6, 0xe5, 0xd1, 0xaa, 0x2a, 0x2e, 0x6d, 0x58, 0xe4, 0xe9, 0x90, 0x13, 0xc1, 0x9a, 0x71, 0x0d, 0x87, 0xbc, 0xff, 0xfc, 0x6a, 0xd4, 0x2e, 0x04, 0xff, 0x80, 0x8a, 0xb0, 0xd1, 0x95, 0xba, 0x70, 0xa2, 0x57, 0xce, 0x09, 0xd0, 0x2f, 0x12, 0x2d, 0xa0, 0x0b, 0x88, 0x2b, 0xa9, 0x10, 0x2f, 0xda, 0x73, 0xe7, 0x53, 0x60, 0x99, 0xfa, 0x20, 0xe3, 0xe1, 0x18, 0xb0, 0x29, 0x3d, 0xce, 0xa2, 0x07, 0x22, 0xf2, 0x53, 0xb3, 0x9e, 0x16, 0xb0, 0x9e, 0x87, 0xad, 0x47, 0xd0, 0x9e, 0x22, 0x58, 0x43, 0x98, 0x6b, 0xaf, 0xb6, 0xd6, 0x4c, 0x9b, 0xf2, 0x4b, 0x6b, 0x59, 0xcb, 0x53, 0x7c, 0x10, 0x29, 0x0f, 0x8d, 0xb8, 0x6a, 0xc3, 0x7f, 0x72, 0xca, 0xc8, 0x85, 0x92, 0xb4, 0xfa, 0xd2, 0x04, 0x13, 0xa0, 0xef, 0xdf, 0xcd, 0xcd, 0x2e, 0x66, 0x9e, 0xa0, 0xf3, 0x0a, 0x3a, 0xf2, 0x8f, 0x98, 0x74, 0xa4, 0x73, 0x3d, 0x98, 0x51, 0x8c, 0x2a, 0x20, 0x27, 0x45, 0x28, 0x0a, 0x9b, 0xc3, 0x7c, 0x5f, 0x7d, 0xbd, 0x11, 0xde, 0xea, 0xe9, 0x6b, 0x38, 0xde, 0x6b, 0x48, 0x0e, 0x79, 0x0f, 0xdd, 0xb4, 0x9a, 0xda, 0x23, 0x1f, 0xad, 0xe7, 0x66, 0xcc, 0xc8, 0xdb, 0x32, 0x8a, 0xdd, 0x5f, 0x81, 0x3d, 0xa7, 0xfd, 0xa7, 0xd6, 0x09, 0xec, 0x3f, 0xa7, 0x0f, 0xbc, 0x3f, 0xb5, 0x57, 0x9a, 0xfc, 0x8a, 0x77, 0x65, 0x3c, 0xa2, 0x5e, 0xc6, 0xe8, 0xed, 0x23, 0x36, 0x50, 0xae, 0xed, 0x8c, 0x85, 0x60, 0xe2, 0x32, 0xf8, 0x88, 0x5e, 0xca, 0x57, 0x0f, 0xd0, 0x15, 0x56, 0x27, 0x5d, 0x50, 0x9b, 0xea, 0x49, 0xce, 0xf2, 0x07, 0x20, 0xc8, 0xae, 0x9d, 0x4a, 0x9f, 0x83, 0x02, 0x37, 0x44, 0xd8, 0x02, 0x67, 0x3a, 0x87, 0x49, 0xf6, 0x22, 0xc9, 0x12, 0x45, 0x0d, 0xec, 0x24, 0x51, 0x9d, 0x98, 0x8d, 0xcb, 0x21, 0xbf, 0x45, 0x0f, 0x62, 0x4d, 0x10, 0x68, 0xa8, 0xf7, 0x37, 0x4e, 0x48, 0xe4, 0x82, 0x7f, 0x22, 0x72, 0x2f, 0x45, 0xef, 0xd8, 0x07, 0x81, 0x77, 0xca, 0x4e, 0x4e, 0x95, 0xf3, 0xc5, 0x4e, 0xe2, 0xaf, 0xad, 0xae, 0xb2, 0x17, 0xb9, 0xbf, 0x03, 0xe8, 0x63, 0x23, 0xf9, 0xf7, 0x22, 0x27, 0xc3, 0x17, 0x6c, 0x30, 0xe3, 0xdc, 0x7d, 0x91, 0x7b, 0xac, 0xf1, 0x74, 0x73, 0xc3, 0x09, 0x92, 0xd0, 0xf9, 0x6e, 0x9c, 0xf3, 0xef, 0x1c, 0x74, 0xff, 0xe1, 0x99, 0x33, 0xca, 0xa2, 0x61, 0x54, 0x44, 0x17, 0x3c, 0x77, 0xba, 0x01, 0xc8, 0x60, 0xdc, 0x41, 0xbf, 0x2a, 0x07, 0xbd, 0x8e, 0x70, 0x4d, 0x44, 0x21, 0x77, 0x02, 0xe7, 0x10, 0xcb, 0x36, 0x41, 0x10, 0x7a, 0x9d, 0x50, 0xa3, 0xd0, 0xe2, 0x28, 0x07, 0x1a, 0xb9, 0x80, 0x8e, 0x9a, 0x1d, 0xe0, 0x3a, 0xec, 0x23, 0xb9, 0x69, 0x6a, 0xd2, 0x7b, 0x9d, 0xb8, 0x15, 0xa7, 0xc9, 0x42, 0x25, 0x4d, 0x20, 0xeb, 0x16, 0x4e, 0x26, 0x90, 0xcd, 0xbe, 0x5d, 0xeb, 0x22, 0x77, 0xeb, 0x5d, 0x2d, 0x73, 0x33, 0xd4, 0x31, 0x37, 0x52, 0x11, 0x40, 0xa3, 0x30, 0x55, 0x19, 0xb5, 0x09, 0xcb, 0x18, 0x36, 0x99, 0x29, 0xfb, 0x24, 0x06, 0x4e, 0xb0, 0x29, 0xd1, 0xb6, 0x94, 0x3c, 0xde, 0x88, 0x23, 0xbd, 0x86, 0xb2, 0xad, 0x5f, 0x93, 0xd5, 0x2d, 0x01, 0x79, 0xb5, 0x95, 0x33, 0x99, 0x5b, 0xa9, 0x95, 0x30, 0xfa, 0x13, 0x31, 0x75, 0x74, 0x04, 0xc2, 0x78, 0x94, 0xf4, 0xd2, 0x56, 0x30, 0x45, 0xd7, 0x07, 0x7f, 0x01, 0x36, 0x74, 0x9b, 0x9b, 0xa0, 0xf8, 0xb9, 0xa0, 0xb6, 0x23, 0x50, 0xaa, 0xaf, 0xcf, 0xf9, 0xa4, 0xc5, 0x59, 0x6d, 0xe3, 0xa0, 0x76, 0xaa, 0xd6, 0xd4, 0x98, 0x3e, 0xa3, 0x01, 0x13, 0xd9, 0x6e, 0x39, 0xfd, 0x7d, 0xd6, 0xf3, 0xac, 0xb4, 0x52, 0x23, 0x94, 0xe2, 0x81, 0x44, 0x7a, 0x5e, 0xc9, 0x8d, 0xf7, 0xd0, 0x08, 0x3e, 0x12, 0x12, 0xcc, 0x91, 0x9f, 0xb5, 0x87, 0xad, 0xa1, 0xc9, 0x86, 0xd6, 0x3c, 0x34, 0x70, 0x1d, 0xf9, 0x47, 0x26, 0x27, 0x42, 0x32, 0xea, 0xfa, 0x1b, 0xdd, 0x2a, 0x9b, 0xb9, 0xb9, 0xb1, 0x5f, 0x7d, 0x0f, 0x9c, 0xa7, 0xdb, 0xe2, 0x49, 0x17, 0xb4, 0xb2, 0x37, 0x87, 0xbb, 0xdb, 0x6a, 0x28, 0x6e, 0xd7, 0x33, 0x18, 0x3f, 0xeb, 0x0b, 0x12, 0x47, 0x49, 0x37, 0x64, 0x22, 0xc7, 0x52, 0x10, 0xe3, 0x84, 0xb4, 0x7a, 0x4c, 0x72, 0xc6, 0xd6, 0x11, 0x1b, 0x62, 0x5c, 0x2a, 0xcf, 0x5a, 0xb0, 0xef, 0x1f, 0xb1, 0x85, 0x8c, 0xf1, 0x26, 0xbd, 0xd9, 0x21, 0xae, 0x08, 0x8a, 0xab, 0x3e, 0xa5, 0xee, 0x4f, 0x89, 0xb4, 0x4b, 0xb7, 0x5e, 0x31, 0x5f, 0xab, 0x9a, 0x91, 0x10, 0xdd, 0xe6, 0x18, 0x6b, 0xdd, 0x05, 0x65, 0xae, 0x85, 0xfc, 0xf8, 0x84, 0x1b, 0xd9, 0x07, 0xbe, 0x5f, 0xe3, 0x8f, 0x97, 0x0b, 0xd5, 0xa1, 0x6b, 0x9c, 0xaf, 0x19, 0x61, 0x1e, 0x91, 0x19, 0x6d, 0x11, 0xa1, 0x9e, 0x1a, 0x95, 0x7a, 0x2a, 0xba, 0x89, 0x50, 0xd4, 0x7f, 0xdc, 0x2c, 0x5b, 0x21, 0x46, 0x12, 0x58, 0x1b, 0x65, 0xd2, 0x1c, 0x27, 0xf9, 0x20, 0xea, 0x15, 0x52, 0x9d, 0x22, 0xc8, 0x5a, 0x71, 0x39, 0x96, 0xc4, 0x0c, 0xdc, 0xfc, 0x6c, 0x06, 0x15, 0x55, 0xa3, 0xd2, 0xda, 0xbc, 0x05, 0xcc, 0xa9, 0x2c, 0xfc, 0x4b, 0x2e, 0xa9, 0x14, 0x98, 0x37, 0x46, 0xf9, 0xe3, 0xf9, 0xac, 0x3e, 0x7e, 0xa6, 0x96, 0x2a, 0x36, 0x9e, 0x3b, 0xfc, 0x13, 0xd0, 0x98, 0xa6, 0x0d, 0x91, 0x59, 0x69, 0xb3, 0x01, 0x80, 0x90, 0xe1, 0x1b, 0xbc, 0xdb, 0x6d, 0x20, 0x19, 0xd2, 0x91, 0x4b, 0x46, 0x14, 0x89, 0x4b, 0x45, 0x87, 0x9a, 0xc0, 0xea, 0xc9, 0x58, 0xe1, 0x55, 0x1d, 0xc7, 0x43, 0x50, 0x2a, 0x04, 0x19, 0xf4, 0x3d, 0x2d, 0x26, 0x55, 0x6c, 0x31, 0xe5, 0x41, 0x38, 0xea, 0xea, 0xea, 0xc1, 0x30, 0xd9, 0x09, 0x8b, 0x9f, 0xfa, 0x00, 0xcb, 0xa9, 0xe7, 0x01, 0x1a, 0xca, 0x37, 0x48, 0x69, 0x82, 0x9e, 0x0c, 0x83, 0xa7, 0x0a, 0x41, 0x01, 0x32, 0x41, 0x4e, 0x99, 0x9f, 0xea, 0x7d, 0x12, 0x13, 0x18, 0x89, 0x28, 0x0f, 0x6f, 0x2a, 0x83, 0x40, 0xa7, 0xa5, 0x01, 0x4d, 0x16, 0xc2, 0xa4, 0x22, 0x20, 0x04, 0x64, 0x85, 0x62, 0xb7, 0x41, 0x93, 0xc8, 0x6a, 0x39, 0x16, 0x7f, 0x0d, 0x42, 0x2c, 0xa4, 0x74, 0x62, 0xc4, 0x0c, 0xd2, 0x9e, 0xa1, 0x62, 0x06, 0x9f, 0x26, 0x66, 0xdc, 0x20, 0x10, 0xd8, 0x49, 0x7e, 0xaa, 0xe9, 0xa7, 0x90, 0x8e, 0xe2, 0xda, 0xec, 0x23, 0x37, 0x24, 0x63, 0xca, 0xb7, 0x92, 0xea, 0x79, 0x30, 0xee, 0xd4, 0x6f, 0x0e, 0xf7, 0xdc, 0x57, 0x39, 0x6a, 0x2b, 0x07, 0x6e, 0x4f, 0xf3, 0xc3, 0x11, 0xf1, 0x43, 0x23, 0xcb, 0x8d, 0x2a, 0x3a, 0x42, 0x5b, 0x2d, 0xc5, 0x80, 0xab, 0x2f, 0x58, 0x01, 0x44, 0x8e, 0x26, 0x05, 0x5f, 0xba, 0x1f, 0x76, 0x13, 0x72, 0xe4, 0x75, 0x70, 0x66, 0x9d, 0xc5, 0xeb, 0xd1, 0xf4, 0x83, 0xc7, 0x40, 0x06, 0x63, 0x49, 0xe9, 0xfa, 0x0e, 0xcb, 0x16, 0x10, 0xd1, 0xa3, 0x5c, 0x67, 0x30, 0x2f, 0x23, 0xfa, 0x31, 0x45, 0x69, 0x5c, 0xa6, 0x72, 0x01, 0xbe, 0x8a, 0xd5, 0x13, 0x3c, 0x76, 0x03, 0xd2, 0x2b, 0xdf, 0x0a, 0xdd, 0x81, 0x8e, 0x3c, 0x33, 0xe3, 0x35, 0x10, 0xd8, 0x00, 0x4f, 0xd5, 0xf0, 0x19, 0x28, 0x1a, 0x64, 0xef, 0xdc, 0x0d, 0x48, 0xb4, 0x00, 0x35, 0x24, 0x32, 0xb2, 0xc2, 0xa0, 0x34, 0xe2, 0xa8, 0xa6, 0x4b, 0x49, 0x20, 0x96, 0x12, 0x86, 0x23, 0xda, 0x37, 0x62, 0x46, 0xd4, 0x07, 0xec, 0xa1, 0x7c, 0x9d, 0xe9, 0xf2, 0xa4, 0xf9, 0x97, 0xb2, 0x8d, 0x7a, 0x0f, 0xbc, 0xb9, 0x7c, 0x1b, 0xe2, 0x5b, 0x4a, 0x04, 0xd8, 0xca, 0x41, 0x82, 0xec, 0x7b, 0xad, 0x97, 0xf8, 0xaf, 0x30, 0x4f, 0xf4, 0x0c, 0xb3, 0xcf, 0xab, 0xa4, 0xac, 0xd4, 0x33, 0x54, 0x99, 0x77, 0xb6, 0xc7, 0x9f, 0xd8, 0x55, 0xd0, 0xc1, 0x3a, 0x88, 0x5b, 0x27, 0x20, 0xd5, 0x9d, 0xb2, 0x71, 0x11, 0x01, 0x62, 0x03, 0xf8, 0x2c, 0xb6, 0x8f, 0x00, 0x45, 0xe3, 0x9c, 0x76, 0x42, 0x58, 0x66, 0x17, 0xb0, 0x57, 0x21, 0x7a, 0x02, 0x63, 0x33, 0xd3, 0xaf, 0xfb, 0xf0, 0x5a, 0x78, 0x18, 0xef, 0xf1, 0xe0, 0x82, 0xdf, 0xdc, 0xa0, 0x61, 0x8a, 0xf5, 0x7c, 0x50, 0x75, 0x01, 0x95, 0x09, 0x6d, 0xbe, 0xa0, 0x5c, 0x0a, 0xc3, 0x5c, 0xaf, 0xb4, 0xf2, 0x55, 0x95, 0xc8, 0x0f, 0x8b, 0xd7, 0xbd, 0xa9, 0x13, 0xe5, 0x4e, 0x92, 0xa2, 0x83, 0x84, 0x20, 0x02, 0xac, 0x4c, 0xf8, 0xfe, 0x00, 0x2b, 0x1a, 0x16, 0x1c, 0x4e, 0x16, 0x9d, 0x07, 0xe2, 0x19, 0x9a, 0x4c, 0x76, 0xd6, 0x63, 0x52, 0xab, 0xa4, 0x5c, 0x82, 0xdd, 0x2c, 0x8d, 0x63, 0x32, 0xfc, 0x88, 0x65, 0x7e, 0x32, 0x62, 0x43, 0x95, 0xb4, 0x88, 0xf6, 0xa0, 0x75, 0x75, 0xf2, 0xec, 0x5e, 0xb0, 0x73, 0xdc, 0xbf, 0xce, 0x65, 0x4a, 0x0d, 0xdf, 0xef, 0xe0, 0xe1, 0xdb, 0xb9, 0xce, 0x9f, 0x00, 0x13, 0x06, 0xa3, 0x3c, 0x32, 0xd4, 0xad, 0x21, 0x7a, 0x08, 0xb2, 0x1e, 0xc8, 0x01, 0xec, 0xc8, 0x3f, 0x67, 0xbf, 0x8a, 0x50, 0xd6, 0x6b, 0x2c, 0x72, 0x8e, 0xe7, 0xd1, 0xee, 0x91, 0x8c, 0xc1, 0x62, 0x63, 0xf8, 0x29, 0xb2, 0xab, 0xb0, 0x4b, 0x90, 0xab, 0xdc, 0x8f, 0xfe, 0xc6, 0x47, 0x25, 0x61, 0x5f, 0xf9, 0x1b, 0x57, 0x4d, 0x34, 0xac, 0xa3, 0xeb, 0xab, 0x87, 0x09, 0x12, 0x65, 0xc6, 0x10, 0xab, 0xb5, 0x9f, 0x65, 0xe3, 0xd8, 0x9b, 0x0c, 0x98, 0xa0, 0x53, 0x24, 0x69, 0xeb, 0x6a, 0x2c, 0x2d, 0xed, 0xba, 0x47, 0x1e, 0x1b, 0xe2, 0xc8, 0x00, 0x1a, 0x9d, 0xac, 0x09, 0xa5, 0x96, 0x13, 0x50, 0x99, 0x70, 0xd0, 0x1a, 0x5d, 0x1e, 0x3b, 0x19, 0xb0, 0xb1, 0x7a, 0x25, 0x01, 0x5b, 0xf4, 0x61, 0x45, 0x77, 0xd8, 0x80, 0x05, 0x22, 0xcd, 0xe4, 0xbb, 0x0c, 0xed, 0xfd, 0x99, 0xc7, 0x26, 0xc8, 0xd1, 0x2f, 0xa1, 0x30, 0xfa, 0xdc, 0x6c, 0xca, 0x75, 0xa2, 0x3c, 0x19, 0x9a, 0x45, 0x16, 0x24, 0x39, 0xfa, 0xd7, 0xbf, 0xc9, 0x62, 0x5b, 0x85, 0xa1, 0x0c, 0x4a, 0xcc, 0x2e, 0xe1, 0x2e, 0x96, 0x4b, 0x11, 0xb4, 0x18, 0x51, 0xc4, 0x7c, 0xc7, 0x0e, 0xcd, 0x53, 0xdd, 0x0b, 0x7f, 0x13, 0xbe, 0x9f, 0xa3, 0xc2, 0xaf, 0xd8, 0xd8, 0x47, 0x60, 0xbc, 0x1f, 0x9f, 0x5e, 0x28, 0x36, 0xf6, 0x11, 0x58, 0x98, 0x1d, 0x25, 0x70, 0xce, 0x2e, 0x4e, 0x3e, 0x9e, 0x4a, 0x65, 0x4e, 0x0b, 0x61, 0xe7, 0x53, 0xb6, 0x27, 0xe8, 0x18, 0xde, 0xca, 0xa1, 0xb5, 0x2b, 0xcf, 0xee, 0x21, 0xe6, 0xcf, 0x83, 0xd5, 0x74, 0xe8, 0xb1, 0x2d, 0xd2, 0x9a, 0x49, 0x18, 0x20, 0xb1, 0x60, 0x40, 0x96, 0xcb, 0x1e, 0x83, 0x2d, 0x13, 0xa0, 0xa0, 0x07, 0x3a, 0x3c, 0x31, 0x85, 0xc4, 0x8b, 0x32, 0xf7, 0x57, 0x01, 0x5c, 0xe9, 0x02, 0x43, 0x70, 0xf5, 0xd1, 0x11, 0xf0, 0x90, 0x08, 0xe6, 0x6c, 0xa3, 0xeb, 0xc2, 0xa4, 0xa1, 0xfc, 0xda, 0x80, 0x02, 0xec, 0x9a, 0x52, 0xa9, 0x51, 0xae, 0x4b, 0x78, 0x40, 0xfa, 0x6e, 0x6d, 0x31, 0x25, 0x04, 0xb6, 0x16, 0x95, 0xae, 0xbe, 0xc7, 0xa2, 0x1c, 0x65, 0x5a, 0xf4, 0xf8, 0x1e, 0xb1, 0x72, 0xd9, 0xb5, 0x42, 0xa6, 0x57, 0x66, 0x2b, 0x63, 0x92, 0x1a, 0xd2, 0x6c, 0x27, 0xc0, 0xc8, 0xc7, 0x49, 0x6b, 0x47, 0x8a, 0x15, 0x79, 0x6b, 0x93, 0x19, 0xab, 0xb2, 0xd5, 0x57, 0xc2, 0x1d, 0x09, 0xca, 0xad, 0x6d, 0x96, 0x43, 0xcb, 0x31, 0xdf, 0x89, 0xa3, 0xfe, 0xa0, 0xc0, 0x1d, 0xc6, 0x78, 0xb4, 0x94, 0x58, 0xfb, 0x13, 0xe6, 0xea, 0x1c, 0x46, 0x80, 0x76, 0x34, 0xff, 0x5e, 0x1a, 0xf1, 0xc6, 0xaf, 0x70, 0x35, 0xb1, 0x8f, 0xde, 0xb5, 0xf4, 0xef, 0x32, 0x42, 0xe1, 0xcf, 0xcd, 0xc3, 0x50, 0x5c, 0x26, 0x41, 0xb3, 0x9f, 0xb6, 0xf1, 0x1f, 0xf7, 0xdc, 0x6b, 0x29, 0xee, 0x7f, 0x19, 0x64, 0x20, 0xae, 0x1d, 0x0a, 0x91, 0x5f, 0x24, 0xf2, 0x0c, 0x44, 0xaa, 0xba, 0x94, 0x0b, 0x9e, 0x20, 0x73, 0xa8, 0x82, 0x8e, 0x1e, 0x13, 0x3a, 0x49, 0x3f, 0x20, 0xef, 0x3e, 0x35, 0xe7, 0x52, 0xdd, 0xb8, 0xf2, 0x17, 0xce, 0x6f, 0x6e, 0xce, 0xa5, 0xa5, 0xa2, 0xdd, 0x60, 0xd7, 0x8a, 0x41, 0xbc, 0xd6, 0x96, 0xe1, 0x77, 0x8a, 0x53, 0x7c, 0x92, 0x19, 0x71, 0x3e, 0x4f, 0x7d, 0x5d, 0x6c, 0x61, 0xad, 0xb4, 0x20, 0x5f, 0x69, 0x96, 0xb2, 0x8a, 0x3a, 0xce, 0xc7, 0x29, 0xfb, 0xc5, 0x7f, 0xd7, 0xbe, 0xb0, 0x74, 0x05, 0x18, 0x06, 0xcc, 0xff, 0xd5, 0xd2, 0x52, 0x49, 0xd7, 0xc8, 0xf1, 0x80, 0xbd, 0x20, 0xcf, 0xfb, 0xe5, 0x16, 0x9e, 0x87, 0xd5, 0x9d, 0xef, 0x16, 0xaf, 0xcf, 0xa7, 0xdf, 0x95, 0xac, 0x0f, 0xc7, 0x85, 0x6a, 0xa7, 0x62, 0x7c, 0xd0, 0x86, 0x32, 0xf7, 0x6e, 0xf8, 0x3b, 0xc9, 0x4c, 0x2b, 0x8d, 0xe3, 0x34, 0x75, 0x86, 0x41, 0x32, 0x01, 0xd4, 0x84, 0x51, 0x86, 0x19, 0x6a, 0xb4, 0x40, 0xf4, 0x23, 0x32, 0xb5, 0x75, 0xf7, 0x17, 0xd0, 0x48, 0x7e, 0xbc, 0xb9, 0xf9, 0xbc, 0x40, 0x5c, 0x0d, 0x5d, 0x0c, 0xb6, 0x41, 0xc8, 0xef, 0x37, 0xa5, 0xad, 0xdb, 0xfd, 0x05, 0xa6, 0x0e, 0x5e, 0x4e, 0xa4, 0xa4, 0x2c, 0x18, 0xeb, 0x8f, 0xac, 0xc4, 0x5b, 0x05, 0x5b, 0x03, 0x0c, 0xef, 0x62, 0x44, 0xd9, 0x92, 0x1d, 0x31, 0x59, 0xe9, 0x17, 0x8d, 0x4f, 0x62, 0x6d, 0x46, 0x06, 0x3e, 0x63, 0xb5, 0x5c, 0xf8, 0x17, 0x37, 0x37, 0x4a, 0x45, 0xdb, 0x62, 0x2e, 0x52, 0x8e, 0xbf, 0xa1, 0x68, 0xc8, 0x30, 0x65, 0x60, 0x1d, 0x31, 0x90, 0x73, 0x7f, 0x82, 0x9a, 0x02, 0xd2, 0x4f, 0x4c, 0xd2, 0xec, 0x85, 0x86, 0xee, 0x5c, 0x99, 0x15, 0x15, 0x94, 0xc0, 0xc2, 0xe9, 0x07, 0x80, 0xa8, 0x10, 0xe7, 0xaf, 0x9a, 0x47, 0x4f, 0xc4, 0xfa, 0x65, 0xc3, 0x1f, 0x7d, 0xc9, 0x94, 0x2e, 0x0c, 0x99, 0xe1, 0xca, 0xc7, 0x7d, 0xb5, 0x40, 0xf7, 0x1e, 0x91, 0xcb, 0x56, 0x73, 0xa3, 0xd7, 0x68, 0x60, 0xfc, 0xa8, 0x36, 0x51, 0x21, 0x50, 0xbf, 0x53, 0xab, 0xf6, 0xd3, 0xd4, 0xff, 0x78, 0xf2, 0xfa, 0x74, 0xfd, 0x5d, 0x53, 0xab, 0x55, 0x4b, 0x4b, 0xc6, 0x43, 0x53, 0x36, 0x57, 0xfb, 0x52, 0xd9, 0xc5, 0xaf, 0x95, 0x1a, 0x06, 0x24, 0xf9, 0x0e, 0x07, 0xfc, 0x19, 0x58, 0x7d, 0xee, 0xe2, 0xae, 0x8a, 0x2b, 0xeb, 0xb3, 0x7b, 0xad, 0x7a, 0x2b, 0xf9, 0xc6, 0xb5, 0x02, 0xbd, 0x55, 0x8e, 0x82, 0x09, 0x61, 0x04, 0xde, 0x48, 0xa9, 0x07, 0x65, 0x10, 0x78, 0xc2, 0x3f, 0x52, 0x9c, 0x00, 0xe9, 0x06, 0x58, 0x92, 0x4c, 0x09, 0x85, 0xcc, 0x0d, 0x75, 0xc2, 0x46, 0x63, 0xca, 0x22, 0x3a, 0x74, 0x6b, 0xe9, 0xe1, 0x53, 0xc2, 0x85, 0xc2, 0xbf, 0x32, 0x7d, 0xcd, 0x0d, 0x37, 0x6d, 0x01, 0x37, 0x31, 0xb3, 0xa8, 0x04, 0x2a, 0x56, 0x68, 0x21, 0x9d, 0x54, 0x73, 0xd7, 0xcc, 0xd0, 0x39, 0x43, 0xad, 0x73, 0xf6, 0xa7, 0x18, 0xac, 0xd8, 0x24, 0x84, 0x82, 0xf4, 0x20, 0xf6, 0x9c, 0x44, 0x0a, 0x72, 0xf2, 0x64, 0x53, 0x63, 0x2f, 0xac, 0xe2, 0x0c, 0xe4, 0xcd, 0x7e, 0xbb, 0xaf, 0x31, 0x13, 0x98, 0x40, 0xc8, 0xb1, 0xf4, 0x0a, 0xf4, 0xa9, 0x4a, 0x22, 0x4c, 0xb8, 0x0b, 0xe3, 0x51, 0x41, 0xd8, 0x52, 0xae, 0x13, 0xc7, 0x7b, 0xad, 0x82, 0x95, 0x50, 0x8e, 0x84, 0x86, 0x68, 0xf0, 0xff, 0xb0, 0xfd, 0xc2, 0x0d, 0x59, 0x6d, 0x27, 0x78, 0xc8, 0x0a, 0x8c, 0x1a, 0x65, 0x37, 0xa5, 0x0d, 0x94, 0xb2, 0x18, 0xe5, 0x66, 0x00, 0xdd, 0x1f, 0x66, 0xd0, 0x64, 0x1b, 0x47, 0xe6, 0xee, 0x11, 0xd1, 0x40, 0xd1, 0x5d, 0x8e, 0xf5, 0x5c, 0x23, 0x86, 0xfb, 0x2d, 0x19, 0x20, 0x0a, 0xb5, 0x41, 0x0a, 0x24, 0xe7, 0x53, 0xbf, 0x00, 0x61, 0x4e, 0xa6, 0xd2, 0x28, 0x9d, 0x79, 0x85, 0x14, 0x8e, 0xef, 0x40, 0x2f, 0x49, 0x28, 0xf8, 0x42, 0x8b, 0x5f, 0xf2, 0x10, 0x41, 0x1f, 0xe5, 0x91, 0x50, 0x18, 0x11, 0x49, 0xc5, 0x72, 0x23, 0xca, 0xed, 0x5d, 0xa1, 0xb0, 0x59, 0xbf, 0xb9, 0xab, 0xb7, 0x0a, 0x6b, 0x93, 0x2f, 0xe3, 0x4f, 0xb9, 0x3c, 0x91, 0x45, 0x7f, 0x42, 0x19, 0xb6, 0x17, 0x78, 0xec, 0x85, 0xfb, 0x22, 0x6f, 0xaa, 0xdc, 0x8f, 0x8a, 0x53, 0x04, 0x73, 0xb0, 0x05, 0x85, 0x41, 0xd6, 0x17, 0xc6, 0x1f, 0x91, 0xa9, 0x4e, 0x94, 0xcc, 0xd2, 0xd4, 0xf4, 0x59, 0x6a, 0xe2, 0xb3, 0x90, 0x96, 0x35, 0x31, 0xd8, 0x1f, 0x0f, 0xc4, 0x6b, 0x3c, 0x2a, 0xc1, 0xc7, 0x3d, 0xf8, 0x3d, 0xad, 0xef, 0xf3, 0x44, 0x20, 0xcd, 0x8d, 0xc9, 0x0e, 0x09, 0x9c, 0x50, 0x84, 0x1a, 0xbe, 0x70, 0x3f, 0xd5, 0x42, 0xd2, 0x81, 0xa1, 0xe3, 0x1e, 0x5b, 0x76, 0x18, 0xd1, 0x0c, 0x9f, 0x4e, 0xe9, 0xb8, 0xd1, 0xd8, 0x16, 0x5f, 0x24, 0x76, 0xc8, 0xaf, 0xd1, 0x56, 0x79, 0xa8, 0x99, 0x57, 0x3e, 0x08, 0xfa, 0x82, 0xf9, 0x55, 0x81, 0xc1, 0x9a, 0xee, 0xd5, 0xe6, 0xaa, 0x5f, 0x69, 0x8a, 0xcf, 0x4b, 0x62, 0x2c, 0x14, 0xc5, 0xa3, 0x3a, 0x60, 0xd1, 0xfc, 0xb4, 0x0c, 0x55, 0x7f, 0xe1, 0x3e, 0xcb, 0xc9, 0xb6, 0xea, 0x60, 0xd4, 0xb1, 0x99, 0x82, 0x44, 0xa0, 0x95, 0x62, 0x93, 0xa5, 0xa3, 0x98, 0xa3, 0x42, 0x77, 0xcd, 0x62, 0x0a, 0x87, 0xd3, 0xd2, 0x02, 0x15, 0xf9, 0x1b, 0x2f, 0xf0, 0x08, 0xb6, 0x0e, 0x24, 0x6c, 0x06, 0xd7, 0x48, 0xd9, 0x44, 0xa2, 0x74, 0x9d, 0x59, 0x0a, 0x30, 0x5a, 0x9f, 0x5a, 0x7b, 0xc8, 0x27, 0x0b, 0x9d, 0x27, 0xd2, 0x56, 0xaa, 0x8f, 0xcd, 0x0e, 0x50, 0xe6, 0xb2, 0x71, 0x29, 0xa5, 0x21, 0xe6, 0x0a, 0xb7, 0x62, 0xed, 0x60, 0x14, 0x97, 0x19, 0x9a, 0x60, 0x7b, 0xd6, 0xa7, 0x34, 0xca, 0x8a, 0x60, 0x18, 0x62, 0xfa, 0xa0, 0x45, 0xf7, 0x4a, 0xeb, 0x45, 0xff, 0x69, 0x4f, 0xb8, 0xb1, 0x29, 0xbe, 0x03, 0x2d, 0xc5, 0xe8, 0xe2, 0x36, 0xf4, 0x23, 0x4c, 0x50, 0x11, 0x2c, 0x2d, 0x8d, 0x30, 0x2d, 0x03, 0x01, 0x81, 0xe1, 0x1a, 0xa4, 0xa0, 0xea, 0xa7, 0x36, 0xba, 0xc3, 0xf9, 0x01, 0xfc, 0xd3, 0x72, 0x29, 0xc8, 0xbd, 0x80, 0x9f, 0x18, 0x7c, 0x87, 0x09, 0x71, 0xd9, 0x5e, 0x0e, 0xea, 0xc6, 0xc6, 0x35, 0x3e, 0xf9, 0x47, 0x8c, 0x8a, 0x22, 0x9b, 0x35, 0x47, 0x84, 0x6f, 0x97, 0xd7, 0x4e, 0x31, 0x9d, 0x9c, 0x39, 0x4e, 0x32, 0x71, 0x1e, 0xe5, 0x8a, 0x6b, 0x9e, 0xf4, 0x1f, 0xa0, 0x31, 0x57, 0x90, 0x4f, 0x0d, 0x3e, 0xb0, 0xc4, 0x29, 0xe9, 0x0a, 0x7a, 0xc5, 0xa0, 0xfd, 0xad, 0xcb, 0x5d, 0x9d, 0xb7, 0x4a, 0x1f, 0xad, 0xf5, 0xfd, 0x8d, 0xbe, 0x8b, 0x39, 0x1f, 0x97, 0x96, 0x40, 0x80, 0x6e, 0xb9, 0xb9, 0x8f, 0x5e, 0x7f, 0x2c, 0x34, 0xc9, 0xa9, 0xec, 0x19, 0x3d, 0x95, 0x5d, 0x65, 0xf8, 0x3d, 0xca, 0x91, 0x79, 0xe1, 0x97, 0xb9, 0xf4, 0x86, 0x54, 0xa0, 0x89, 0x4d, 0x93, 0x52, 0x81, 0x35, 0x46, 0xb3, 0x3c, 0xa3, 0x98, 0x43, 0x31, 0x45, 0x53, 0xb0, 0x69, 0x5a, 0x86, 0xb0, 0xed, 0x8f, 0x0b, 0xcb, 0x6c, 0x2b, 0x19, 0x65, 0x49, 0x57, 0x65, 0xc8, 0x18, 0xda, 0x4c, 0xae, 0xe7, 0x34, 0xea, 0x56, 0x56, 0xf3, 0xe7, 0xc4, 0x3d, 0x81, 0x3d, 0xef, 0x54, 0x6c, 0x7a, 0xca, 0x62, 0xcf, 0x92, 0x76, 0x84, 0xe9, 0x89, 0x31, 0x55, 0x3b, 0x68, 0x38, 0xa6, 0x8d, 0xcc, 0x70, 0x9c, 0x5d, 0x58, 0xd3, 0x2e, 0xb3, 0x91, 0x56, 0xa6, 0x22, 0xe3, 0x68, 0x48, 0x8e, 0x30, 0x9a, 0xc2, 0x16, 0x9a, 0xf8, 0xd0, 0xd5, 0x73, 0x17, 0x89, 0x99, 0x1c, 0x35, 0xbd, 0x6a, 0xd8, 0x7f, 0xa4, 0x75, 0xd6, 0x58, 0xe9, 0xc3, 0x91, 0xd6, 0x5b, 0x65, 0x62, 0xce, 0xa9, 0x4a, 0xab, 0xc4, 0x30, 0x97, 0xf7, 0x42, 0x81, 0x2c, 0x99, 0xce, 0x49, 0x3c, 0x23, 0x5d, 0x37, 0x79, 0x9e, 0x44, 0xf0, 0x0d, 0x13, 0x24, 0xd3, 0x4f, 0xd7, 0x45, 0xd3, 0xa3, 0xe8, 0x16, 0x69, 0x11, 0x4f, 0xdd, 0x13, 0x54, 0x61, 0xf1, 0xd0, 0xc5, 0xa3, 0x23, 0x71, 0x54, 0x5d, 0xde, 0x26, 0xae, 0x32, 0x21, 0x24, 0x4c, 0x70, 0xfa, 0x96, 0x62, 0xf9, 0xd2, 0x9c, 0xc0, 0x9b, 0xf4, 0xd7, 0x5c, 0xc0, 0x3f, 0x25, 0x95, 0x70, 0x90, 0xfa, 0xc8, 0x29, 0x4d, 0xb9, 0x35, 0x2e, 0xe0, 0x76, 0xb4, 0xda, 0xfb, 0x4a, 0xc0, 0x34, 0x20, 0x42, 0xfb, 0x06, 0xc1, 0x18, 0x64, 0xb0, 0xe0, 0xd6, 0x64, 0x37, 0x44, 0x8b, 0x64, 0xde, 0xce, 0xa5, 0x68, 0xb8, 0x9b, 0x14, 0xe9, 0xdb, 0x88, 0x5f, 0x62, 0x3e, 0x11, 0xed, 0xe1, 0x20, 0x3e, 0x1d, 0xa7, 0x2e, 0xa6, 0xfe, 0x96, 0x24, 0xfc, 0x63, 0xa2, 0x63, 0x4d, 0xcb, 0x7c, 0xdd, 0x98, 0x52, 0x69, 0x61, 0x95, 0x70, 0x01, 0xdc, 0xbb, 0xb1, 0x72, 0x26, 0x12, 0xb2, 0x35, 0x4a, 0xb2, 0x70, 0x22, 0x4d, 0x7e, 0x98, 0xf9, 0x0d, 0x97, 0xa7, 0xda, 0xe0, 0xd1, 0x14, 0x5a, 0xd5, 0xdb, 0x5c, 0x51, 0x44, 0xec, 0xd1, 0x19, 0x0b, 0x0d, 0x3f, 0x04, 0xb7, 0xa3, 0xdb, 0xec, 0x34, 0x51, 0xae, 0xcb, 0x47, 0x20, 0xea, 0xbe, 0x39, 0xdc, 0x45, 0xe5, 0x46, 0x7a, 0x2e, 0x5c, 0x5e, 0x5e, 0x36, 0x2f, 0x1f, 0x35, 0xd3, 0xac, 0xbf, 0xf2, 0x70, 0x75, 0x75, 0x75, 0x25, 0xbf, 0xe8, 0x1b, 0x4e, 0x07, 0x3d, 0x6c, 0x02, 0x94, 0x88, 0xce, 0x8c, 0xfb, 0xcb, 0xcd, 0x4d, 0xa7, 0xd9, 0x19, 0x17, 0x45, 0x8a, 0xbe, 0xae, 0xab, 0xf8, 0x34, 0xe4, 0x45, 0xf0, 0x92, 0x4f, 0xf0, 0x67, 0x10, 0x17, 0xf2, 0x57, 0xb7, 0xc8, 0x62, 0xf9, 0x93, 0xac, 0xc9, 0xf0, 0xdb, 0xf6, 0x58, 0x38, 0xf3, 0x3b, 0x15, 0xdf, 0x60, 0x34, 0x69, 0x84, 0xee, 0xa6, 0xbf, 0xb1, 0x69, 0x9e, 0x5b, 0xa2, 0xfb, 0xd4, 0xd2, 0xd2, 0x66, 0xe9, 0xf3, 0x6e, 0x85, 0x9e, 0xe0, 0x80, 0x36, 0x85, 0x9d, 0x68, 0xe1, 0x0c, 0x76, 0xed, 0xa5, 0xa5, 0x85, 0x33, 0x94, 0x56, 0x8d, 0xd0, 0x41, 0x71, 0xd5, 0x86, 0xdd, 0xf9, 0xc0, 0xef, 0xbb, 0x67, 0xb0, 0xe4, 0xfd, 0x41, 0xfb, 0x8c, 0x2c, 0x81, 0x84, 0xca, 0xb7, 0x40, 0x98, 0xe2, 0x11, 0xdb, 0x73, 0xf1, 0x9b, 0x70, 0xbf, 0x36, 0xbe, 0x4a, 0x7f, 0xec, 0x9b, 0x9b, 0x85, 0x71, 0x4d, 0x5f, 0xb4, 0x88, 0xaa, 0x9d, 0x4d, 0x7c, 0xf7, 0x0c, 0x09, 0xcb, 0x28, 0x07, 0x3b, 0x31, 0xf9, 0xeb, 0x37, 0x2a, 0x61, 0x31, 0xd0, 0x6d, 0xb5, 0x49, 0x8c, 0x75, 0x17, 0xf7, 0x7e, 0xdc, 0xdc, 0x4c, 0x96, 0x96, 0x26, 0x86, 0xcf, 0x3f, 0xbf, 0x42, 0xb1, 0x13, 0xb6, 0xe9, 0x4a, 0x87, 0x97, 0x30, 0x2c, 0x65, 0x3b, 0x1d, 0x33, 0x4d, 0xdb, 0x38, 0x08, 0xa0, 0x01, 0xaf, 0xa5, 0xbf, 0x09, 0xbc, 0xb9, 0x97, 0x4d, 0x71, 0xc2, 0x01, 0x13, 0x2a, 0xa9, 0x5a, 0xed, 0xc2, 0xf2, 0xc3, 0xcd, 0x0d, 0xec, 0x58, 0x97, 0x5a, 0x4b, 0x80, 0x81, 0x97, 0x0f, 0x15, 0xe7, 0x11, 0xe3, 0xac, 0x25, 0xae, 0xf8, 0x8f, 0x28, 0x28, 0x4f, 0xce, 0xd8, 0xa5, 0xc1, 0xf1, 0x46, 0x48, 0x6a, 0x8a, 0x26, 0x90, 0xee, 0xc4, 0x64, 0x5a, 0x43, 0x12, 0x96, 0xa8, 0x33, 0xb6, 0x88, 0x19, 0x11, 0x95, 0x2d, 0xc3, 0x1d, 0x6b, 0x20, 0x1e, 0x8c, 0xa5, 0xc2, 0x02, 0x3f, 0x84, 0x61, 0x76, 0xe2, 0x0f, 0x2a, 0x38, 0x97, 0x73, 0xb3, 0xde, 0x69, 0xda, 0xde, 0x66, 0xb8, 0xbc, 0xdc, 0x45, 0x54, 0xf8, 0x95, 0x03, 0x98, 0xd6, 0x12, 0x07, 0x95, 0xb9, 0x90, 0xef, 0x1b, 0x9e, 0x56, 0xf0, 0xab, 0x25, 0x92, 0x54, 0x7c, 0x69, 0x28, 0x15, 0x69, 0xd2, 0xfe, 0xe9, 0xe8, 0xf5, 0x2b, 0x01, 0xb4, 0x3b, 0xf1, 0xca, 0x04, 0xe9, 0x65, 0xb8, 0xdb, 0xfd, 0xc7, 0x8f, 0x41, 0x39, 0xc6, 0xa8, 0x41, 0xfb, 0x19, 0x9b, 0x56, 0xb1, 0xa8, 0x69, 0x1a, 0x6c, 0x60, 0xea, 0xab, 0x28, 0xd0, 0x57, 0xc8, 0xa0, 0x0f, 0x37, 0x48, 0x68, 0x39, 0x0c, 0xc5, 0x88, 0x06, 0x23, 0x40, 0x62, 0xc0, 0xe3, 0x71, 0x34, 0xc4, 0x34, 0x0c, 0xe8, 0x1e, 0x3a, 0x17, 0x30, 0x47, 0xa4, 0x6b, 0xb4, 0xe1, 0xc3, 0x0c, 0x67, 0x98, 0x8a, 0xf2, 0x76, 0x38, 0x33, 0x1f, 0xf6, 0x14, 0xd5, 0x87, 0xb0, 0xfc, 0x7c, 0x0d, 0xe4, 0x2c, 0xf4, 0x07, 0x53, 0xf6, 0x70, 0xd5, 0xf4, 0x15, 0xe8, 0xce, 0xe5, 0x5b, 0x0a, 0x9f, 0xc8, 0x2d, 0x91, 0xf7, 0x90, 0x55, 0x0a, 0xf5, 0xb6, 0xa5, 0x25, 0xe3, 0xa1, 0x32, 0x9d, 0xa8, 0xab, 0x04, 0xd2, 0x67, 0xb7, 0x6d, 0x16, 0xb3, 0xa1, 0x33, 0x8b, 0xb5, 0x3a, 0x8a, 0x69, 0xd8, 0x65, 0xd4, 0x77, 0x7b, 0x76, 0xe9, 0xc1, 0x3a, 0xa0, 0x44, 0xf6, 0x9c, 0x03, 0x7f, 0x16, 0xe5, 0x57, 0x1a, 0xfa, 0x5c, 0x74, 0xac, 0x8f, 0x4e, 0xce, 0xd8, 0x2b, 0x71, 0x74, 0x77, 0x76, 0xd7, 0x72, 0xf0, 0x98, 0xdd, 0xba, 0x0e, 0x19, 0x98, 0x12, 0x8e, 0x24, 0xa0, 0xc0, 0xc0, 0x07, 0x69, 0x68, 0x33, 0x56, 0xc4, 0xf3, 0xc1, 0xeb, 0xa3, 0xe3, 0xc6, 0xac, 0xe9, 0x08, 0xb3, 0x92, 0x38, 0xf8, 0xcd, 0xc1, 0x71, 0xe7, 0x0e, 0xa8, 0xc1, 0xca, 0xd0, 0xc6, 0x43, 0x7c, 0xe7, 0x6c, 0x12, 0xec, 0xa5, 0x45, 0x69, 0xe0, 0xff, 0x98, 0x90, 0x78, 0x70, 0x46, 0x60, 0x0f, 0xbc, 0xeb, 0xd9, 0x45, 0xb8, 0x6e, 0x8e, 0x72, 0x07, 0x1a, 0xc6, 0x18, 0x1c, 0x0d, 0x23, 0x33, 0x90, 0xef, 0xad, 0x0f, 0x44, 0xec, 0xcd, 0x75, 0x06, 0x72, 0x4f, 0x4f, 0x23, 0x7c, 0xca, 0xf4, 0x88, 0x38, 0x90, 0x83, 0xbc, 0xa3, 0x48, 0xe4, 0xe0, 0x01, 0x0c, 0xac, 0x20, 0xb4, 0xcb, 0xa8, 0x50, 0x34, 0xda, 0x63, 0xc5, 0x03, 0x8f, 0x0c, 0xc7, 0x30, 0xe0, 0x87, 0x20, 0xbc, 0x0d, 0x45, 0xd2, 0x1c, 0x91, 0xe5, 0x44, 0xf4, 0x89, 0xf9, 0x6a, 0x34, 0x17, 0x9d, 0x91, 0x3d, 0x54, 0xe1, 0x91, 0xc7, 0x30, 0x2b, 0xf8, 0x2d, 0x05, 0x8d, 0x54, 0x27, 0x47, 0xa8, 0xf2, 0xe4, 0x79, 0x74, 0x21, 0xae, 0x30, 0xba, 0xad, 0x79, 0x9d, 0x5b, 0x65, 0x78, 0xff, 0x3a, 0x46, 0x36, 0x93, 0x6a, 0xb5, 0x5b, 0xeb, 0xc9, 0xf1, 0xb2, 0xae, 0xc7, 0x76, 0xe4, 0xd2, 0xd4, 0xa5, 0xeb, 0x04, 0xab, 0x79, 0x63, 0xaf, 0x2d, 0x6b, 0x0e, 0xdf, 0x80, 0xa2, 0xb6, 0x6c, 0x39, 0xe8, 0xbb, 0x4a, 0x5a, 0x43, 0xf5, 0xee, 0x2a, 0x5d, 0x0e, 0x70, 0x6a, 0x06, 0xc2, 0xfe, 0x6a, 0x29, 0x89, 0x96, 0xff, 0x69, 0x75, 0x47, 0xd4, 0xfb, 0x9e, 0xf6, 0x4b, 0x44, 0xf7, 0xd0, 0x15, 0x46, 0xae, 0x90, 0xd5, 0xc2, 0xd2, 0x8a, 0x16, 0xf9, 0x5f, 0xec, 0x25, 0xbb, 0xb4, 0x64, 0x46, 0xef, 0xd7, 0x15, 0xf4, 0x4a, 0x5d, 0x74, 0x4d, 0xf9, 0xe4, 0xd5, 0x95, 0x53, 0xe6, 0x2a, 0xa1, 0x2b, 0x24, 0x33, 0x30, 0x92, 0x6d, 0x4f, 0x6c, 0x56, 0xd1, 0x74, 0x0a, 0xb2, 0xe9, 0x96, 0xe1, 0xb0, 0x02, 0xea, 0x08, 0x6a, 0x3a, 0xa0, 0x44, 0xa1, 0x1a, 0xa0, 0xda, 0xd0, 0x1b, 0x64, 0xa4, 0x36, 0xc2, 0x58, 0xb6, 0x10, 0x4c, 0x81, 0xfd, 0xb6, 0x6f, 0x73, 0x59, 0x3e, 0xc0, 0x0b, 0xbe, 0x18, 0x1e, 0xf3, 0x79, 0x55, 0x70, 0xd1, 0x90, 0x2c, 0x0a, 0x05, 0xa2, 0x00, 0x03, 0x51, 0x3d, 0xe4, 0x33, 0xae, 0x1a, 0x75, 0x23, 0xd0, 0x8e, 0x83, 0x1e, 0x28, 0x3b, 0x0c, 0x3d, 0x86, 0xd1, 0x22, 0x19, 0x15, 0xad, 0xc4, 0xdf, 0x00, 0x0d, 0x42, 0x54, 0xc1, 0x4c, 0x40, 0x23, 0x21, 0x07, 0xb0, 0xf3, 0x04, 0x5d, 0xc4, 0xc4, 0xa9, 0x03, 0xe6, 0x5e, 0x7e, 0xaa, 0x82, 0x08, 0x16, 0x72, 0x6d, 0xe2, 0x8e, 0xbc, 0x75, 0x2d, 0x90, 0x17, 0x1a, 0x29, 0x46, 0x01, 0xa9, 0x49, 0xb1, 0x6b, 0x31, 0x7a, 0xad, 0x45, 0x4d, 0x71, 0x9d, 0x49, 0x0d, 0x07, 0x25, 0x7f, 0xb5, 0xbd, 0x31, 0xde, 0xe4, 0x57, 0xa8, 0x34, 0x47, 0x40, 0x93, 0xc9, 0x79, 0x0e, 0xcf, 0x82, 0xcf, 0x6f, 0xa1, 0x2e, 0xce, 0x2d, 0x03, 0x99, 0x27, 0x55, 0xa2, 0xeb, 0x7e, 0x8a, 0x83, 0x98, 0xf5, 0x62, 0x06, 0xfc, 0x98, 0xc7, 0x35, 0x39, 0xde, 0xdf, 0xc5, 0xbd, 0x29, 0x5e, 0x88, 0xc5, 0x23, 0xff, 0xd8, 0x6d, 0x3c, 0x0d, 0x36, 0x1a, 0xa6, 0x0b, 0x37, 0xe5, 0x77, 0xe5, 0x3e, 0xe8, 0xaf, 0xd7, 0x51, 0x82, 0xfd, 0x5e, 0xf0, 0x6d, 0x91, 0x18, 0x4b, 0x3d, 0x36, 0x98, 0xf5, 0x5a, 0xbe, 0x9c, 0x32, 0x95, 0xb7, 0xfe, 0x04, 0x34, 0x59, 0x9f, 0x72, 0x31, 0x9e, 0x34, 0x50, 0x4e, 0x46, 0x16, 0x29, 0xd0, 0xa9, 0xf2, 0x73, 0x35, 0x8c, 0x06, 0x28, 0x07, 0x94, 0xfd, 0x8c, 0x89, 0x97, 0x4e, 0x31, 0xae, 0xec, 0x63, 0x22, 0xd5, 0x6b, 0x6c, 0x06, 0x5d, 0xc8, 0xf6, 0x29, 0xd7, 0x7b, 0xe4, 0x7f, 0x42, 0x93, 0xa7, 0x3a, 0x95, 0xd7, 0xc9, 0x4c, 0x65, 0x04, 0x5e, 0x50, 0x8d, 0xf8, 0x38, 0x01, 0x69, 0x6d, 0x61, 0xed, 0x54, 0x87, 0xbe, 0xf7, 0x0b, 0x37, 0x50, 0x22, 0x35, 0xb9, 0x56, 0x0b, 0x6f, 0xa1, 0x6a, 0x7c, 0x71, 0xe8, 0x6b, 0xb2, 0x72, 0xfb, 0xca, 0x90, 0x4a, 0xd2, 0x49, 0x45, 0x66, 0x55, 0x11, 0x15, 0x30, 0x6f, 0x49, 0xd8, 0xc6, 0x68, 0xa1, 0xb0, 0x15, 0x9a, 0x3b, 0x6a, 0xf6, 0x00, 0x17, 0xfe, 0xcd, 0x4d, 0x88, 0xe9, 0x92, 0x18, 0x15, 0x38, 0xd5, 0xa6, 0x4d, 0x31, 0x06, 0x9c, 0x90, 0xc0, 0xe7, 0x51, 0xb9, 0xaa, 0xae, 0x60, 0x0d, 0x30, 0x98, 0x86, 0x42, 0x98, 0x11, 0x10, 0x05, 0x96, 0x91, 0x0b, 0x2d, 0x35, 0xe4, 0x9f, 0x50, 0x77, 0xe0, 0x4f, 0xf2, 0xa4, 0xb0, 0x00, 0x44, 0xbd, 0x89, 0xca, 0xdd, 0xaf, 0x0c, 0x63, 0x2a, 0x98, 0xdd, 0xb5, 0x9c, 0xf5, 0x45, 0x38, 0xfd, 0xd2, 0xd2, 0xf5, 0x89, 0xfc, 0x79, 0x8a, 0x7b, 0x01, 0xc3, 0x5b, 0x70, 0xcc, 0x09, 0x82, 0xb7, 0xb1, 0x8b, 0xf8, 0xc2, 0x2f, 0xd6, 0x7b, 0xf9, 0x1a, 0x33, 0x70, 0x96, 0xa1, 0xf9, 0x98, 0x32, 0x12, 0xa8, 0xb8, 0x85, 0xee, 0x0f, 0xbc, 0x68, 0x04, 0x59, 0x14, 0x2c, 0xcb, 0x20, 0xd2, 0x86, 0xe5, 0xe8, 0x70, 0xb2, 0x76, 0xda, 0x6e, 0x8c, 0x82, 0x3e, 0x6f, 0x28, 0xf9, 0x77, 0x2a, 0xee, 0x10, 0x08, 0xf0, 0xca, 0x39, 0xa2, 0xd8, 0x02, 0x29, 0xf6, 0xbb, 0xa7, 0x61, 0x74, 0x21, 0xc6, 0x00, 0x52, 0x5e, 0xcc, 0xaf, 0x1c, 0xfc, 0x67, 0xb9, 0x9b, 0xc6, 0x4e, 0x54, 0xf0, 0x61, 0xbe, 0xdc, 0x45, 0x51, 0x2e, 0x73, 0x06, 0xcb, 0x22, 0xd9, 0x9f, 0x33, 0x2a, 0x96, 0xd7, 0x56, 0x9d, 0x4e, 0x7f, 0x19, 0x75, 0x9b, 0x65, 0xd0, 0x63, 0x9d, 0xc6, 0xc6, 0xd3, 0xc1, 0x9a, 0x6a, 0x02, 0x83, 0x81, 0x96, 0xaf, 0x62, 0x90, 0x49, 0x92, 0x62, 0xb9, 0x93, 0xc6, 0xa1, 0x73, 0xb9, 0x8c, 0xa9, 0x02, 0x9d, 0x61, 0x70, 0xb5, 0x7c, 0xb9, 0xfc, 0x04, 0x3e, 0x8d, 0xe2, 0xe5, 0x35, 0x67, 0xd4, 0x59, 0x7e, 0xdc, 0xd8, 0x00, 0xc5, 0xbf, 0x9f, 0xa6, 0xce, 0x36, 0xf4, 0x11, 0x8c, 0xb3, 0xc8, 0xd9, 0x0e, 0xb2, 0x0e, 0x2c, 0x9b, 0xa7, 0xa0, 0x3c, 0x27, 0xb2, 0x45, 0x6a, 0x30, 0xe8, 0x22, 0x18, 0x1b, 0xef, 0x9f, 0xae, 0xe0, 0x97, 0x0d, 0x67, 0x2b, 0xea, 0x1f, 0x03, 0x34, 0xc7, 0xbc, 0x3b, 0x70, 0x8e, 0x76, 0x8e, 0x9c, 0x87, 0xcd, 0x55, 0xab, 0x92, 0x00, 0x23, 0x1f, 0x3a, 0xf4, 0x97, 0x20, 0x95, 0x59, 0x86, 0x56, 0x7e, 0xbf, 0xda, 0xd8, 0xe8, 0xf6, 0x2e, 0x9d, 0xb5, 0xe6, 0x6a, 0x73, 0x4d, 0xb6, 0xf7, 0x74, 0x65, 0xb0, 0xb6, 0x61, 0x22, 0xa2, 0x08, 0x3a, 0xb9, 0x83, 0xff, 0x2c, 0xc7, 0xa0, 0x48, 0xcf, 0x0c, 0x01, 0x46, 0xbc, 0x02, 0xa5, 0xad, 0x2a, 0x33, 0xc3, 0x54, 0x28, 0x5a, 0x03, 0x14, 0x75, 0xd2, 0x2c, 0xe4, 0x99, 0x78, 0x7e, 0x04, 0xcf, 0xa3, 0xe5, 0x1f, 0x1a, 0x1b, 0xdf, 0x99, 0xd7, 0x28, 0x46, 0xe6, 0x6e, 0x48, 0x0b, 0x92, 0xfc, 0x96, 0xb5, 0x17, 0x50, 0xa1, 0xd7, 0x8b, 0xf6, 0xbf, 0x45, 0x51, 0x6b, 0xa5, 0x71, 0x73, 0x23, 0x7e, 0x20, 0x49, 0xe2, 0x35, 0x86, 0x91, 0x7a, 0x1d, 0x99, 0xaf, 0xe9, 0x26, 0x80, 0x64, 0x3a, 0xb3, 0x48, 0x12, 0xbf, 0x88, 0x28, 0x35, 0x7e, 0x62, 0xc4, 0x08, 0x32, 0xb4, 0x85, 0x98, 0xd9, 0xd4, 0xd0, 0x83, 0xcd, 0xcc, 0x18, 0x26, 0x21, 0x48, 0xdd, 0x98, 0xbd, 0x70, 0x0f, 0x60, 0x49, 0xe1, 0xca, 0x69, 0xe9, 0xce, 0xca, 0x65, 0xa1, 0x49, 0xf2, 0x03, 0x20, 0xd3, 0x59, 0xbc, 0x06, 0x0d, 0x5a, 0x15, 0xf2, 0xda, 0x88, 0xe5, 0x65, 0xc9, 0xef, 0xf0, 0x38, 0xeb, 0x83, 0x61, 0xa4, 0x6e, 0x1c, 0x89, 0x52, 0x40, 0xb4, 0xc2, 0xc8, 0x3f, 0xdb, 0x17, 0x2f, 0xf0, 0x58, 0xf9, 0xce, 0xde, 0x54, 0xb1, 0xbb, 0xfa, 0x53, 0xe5, 0xe6, 0xf7, 0x18, 0xa7, 0x77, 0xf6, 0x46, 0x45, 0xee, 0xe8, 0x69, 0x2f, 0xbd, 0xb5, 0x97, 0x7c, 0x92, 0x0f, 0x78, 0x10, 0x17, 0x83, 0xbb, 0x06, 0xa6, 0xcb, 0xdd, 0x35, 0xb2, 0x49, 0xee, 0xbc, 0x10, 0x25, 0xe7, 0xf7, 0x2a, 0x6e, 0x8f, 0xb8, 0xa3, 0x4b, 0x59, 0xe8, 0x8e, 0xfe, 0xde, 0x88, 0x52, 0xf3, 0xfb, 0x0a, 0x3a, 0x94, 0x30, 0xf0, 0xd6, 0xae, 0x44, 0x99, 0x3b, 0x7a, 0xda, 0xa4, 0x42, 0x46, 0x47, 0x01, 0xab, 0xd8, 0x8f, 0x59, 0xa2, 0xb9, 0x5d, 0x22, 0xf6, 0xe7, 0x72, 0xc5, 0x76, 0x83, 0x2c, 0x84, 0xcd, 0x9a, 0x45, 0x82, 0x0d, 0x8e, 0x36, 0xf0, 0xe4, 0x09, 0x48, 0xc0, 0x51, 0x24, 0xd3, 0x6c, 0xda, 0x3c, 0x25, 0x96, 0xdf, 0xe5, 0xdf, 0xe5, 0x7c, 0x44, 0x79, 0xcc, 0xf4, 0xb3, 0xe0, 0x0b, 0xc4, 0x50, 0x9a, 0xdf, 0xc1, 0x86, 0x8a, 0xed, 0x7e, 0x78, 0x4a, 0x7c, 0x62, 0xf0, 0xd0, 0x62, 0x4c, 0x71, 0xdf, 0xe0, 0x8f, 0x43, 0xe2, 0x84, 0xef, 0xa2, 0x5e, 0xe4, 0x28, 0x22, 0x04, 0x7e, 0xf4, 0xf0, 0xee, 0x4a, 0xce, 0x10, 0x59, 0x71, 0x63, 0xe3, 0x19, 0xbf, 0x00, 0x39, 0xac, 0x52, 0xb9, 0x17, 0xf1, 0x38, 0xcc, 0x15, 0x8a, 0x7d, 0xf5, 0xb8, 0xf1, 0x14, 0x38, 0x2e, 0xec, 0xab, 0x95, 0xd7, 0xcb, 0xe2, 0xed, 0x3c, 0x7e, 0xbc, 0x7b, 0xe0, 0x6c, 0x86, 0x80, 0xd0, 0x1c, 0x1a, 0x97, 0x25, 0x9f, 0x52, 0xaa, 0x49, 0x4a, 0x76, 0x49, 0x2c, 0xda, 0x89, 0x42, 0x9f, 0x53, 0xed, 0x68, 0xe4, 0x90, 0xec, 0x39, 0x00, 0x38, 0x79, 0xe6, 0x5f, 0x5d, 0x5d, 0x35, 0x8d, 0xff, 0xcb, 0x8e, 0xa9, 0x36, 0x60, 0xab, 0x84, 0xeb, 0xeb, 0x00, 0xde, 0x4f, 0x2f, 0x50, 0xf3, 0x80, 0xc1, 0x27, 0x39, 0x68, 0xc1, 0xd2, 0xc2, 0x51, 0x0b, 0xa5, 0x70, 0x6e, 0x41, 0x38, 0x0b, 0x51, 0xca, 0x19, 0x46, 0xe4, 0xf1, 0x8e, 0x3c, 0xdb, 0x07, 0xae, 0x0c, 0xbf, 0x40, 0x67, 0x19, 0xd1, 0x2b, 0x0b, 0xca, 0x91, 0x7c, 0x8c, 0x83, 0x0e, 0x8f, 0x37, 0xe8, 0xae, 0x3a, 0x74, 0x2f, 0x18, 0x46, 0x71, 0x1c, 0xe5, 0x20, 0xd4, 0x24, 0x61, 0xee, 0x74, 0x78, 0x71, 0x89, 0xdb, 0x23, 0xe6, 0x10, 0x45, 0x22, 0xa1, 0xe4, 0xc2, 0xc5, 0x80, 0x3b, 0xa8, 0x11, 0x11, 0x88, 0xb9, 0x00, 0xd1, 0x7d, 0xba, 0xb0, 0x91, 0x7b, 0x4f, 0x57, 0x46, 0xdf, 0x60, 0xf4, 0x3b, 0xc8, 0xb2, 0x9d, 0xbd, 0x60, 0xc2, 0xef, 0x3b, 0x74, 0x62, 0xf2, 0x54, 0xe1, 0xb8, 0x06, 0x09, 0x3f, 0xdc, 0x1b, 0x09, 0xaa, 0x76, 0x15, 0x0d, 0x68, 0x8a, 0xa0, 0x3e, 0x9c, 0x98, 0xa0, 0xfa, 0x96, 0xa3, 0x3d, 0x42, 0x11, 0xd0, 0x39, 0x00, 0x29, 0xac, 0xb8, 0xe7, 0x68, 0x49, 0x68, 0xa4, 0x0a, 0x95, 0xd1, 0xd6, 0x0d, 0xf7, 0xce, 0xf1, 0xce, 0x0c, 0xb6, 0x48, 0x9d, 0xcb, 0x20, 0x02, 0x59, 0xb9, 0x27, 0x03, 0x20, 0x12, 0x92, 0x1c, 0x41, 0x4e, 0x75, 0x84, 0x96, 0xe0, 0x50, 0xa6, 0x64, 0x24, 0x87, 0x11, 0x5e, 0x55, 0xe2, 0xa0, 0x95, 0x3f, 0x8a, 0x03, 0x22, 0x87, 0x6c, 0x9c, 0x20, 0x40, 0xdf, 0x12, 0x41, 0x07, 0xaa, 0x93, 0x43, 0x6a, 0xbb, 0x44, 0x0e, 0x8d, 0x41, 0xb3, 0x31, 0xf1, 0x30, 0xce, 0x80, 0x1a, 0x97, 0x65, 0x9a, 0xd6, 0x86, 0x85, 0x40, 0x4a, 0xd7, 0xdc, 0x49, 0xaf, 0x10, 0x85, 0x04, 0xf8, 0xeb, 0x44, 0xb4, 0xa8, 0x9a, 0xd0, 0x05, 0xd4, 0x0f, 0x29, 0xa0, 0x41, 0x33, 0x06, 0xc3, 0xa4, 0x8e, 0x96, 0x91, 0x39, 0x48, 0xc8, 0x08, 0x43, 0x88, 0x0d, 0x3c, 0x5c, 0xb4, 0x30, 0x91, 0x3b, 0xd0, 0x3a, 0x73, 0x32, 0x10, 0x71, 0x00, 0x93, 0xc5, 0x00, 0xda, 0x88, 0x05, 0x3b, 0xa3, 0x35, 0x34, 0x87, 0x2d, 0x41, 0xb1, 0x30, 0xe6, 0x54, 0x22, 0x93, 0x23, 0x96, 0xe2, 0x9c, 0x98, 0xb4, 0xdf, 0x8e, 0xd1, 0xe7, 0x09, 0x25, 0xab, 0xf9, 0x26, 0x98, 0xe4, 0xa2, 0xad, 0xaf, 0xc6, 0xe1, 0x3b, 0x44, 0xda, 0x38, 0x91, 0xb9, 0xb4, 0x19, 0x88, 0xe7, 0xce, 0x25, 0x50, 0xa3, 0x83, 0x27, 0x3a, 0x18, 0x2c, 0x1e, 0x4f, 0x1c, 0x99, 0x5c, 0x87, 0xa8, 0x0d, 0xe5, 0x36, 0x8c, 0xbe, 0x01, 0xa9, 0x94, 0x56, 0x25, 0x21, 0x3f, 0x87, 0x2a, 0xc5, 0xc0, 0x89, 0xb2, 0x14, 0xaf, 0x1f, 0xbc, 0x05, 0x5d, 0xf7, 0xdd, 0x7b, 0xc4, 0xc4, 0xbe, 0xe5, 0x19, 0x6c, 0x5f, 0xc2, 0x34, 0x50, 0xd9, 0x87, 0x70, 0xbf, 0xcd, 0xd2, 0x98, 0xfb, 0x41, 0xcc, 0x33, 0x4d, 0x40, 0xd0, 0xc4, 0x0f, 0x8e, 0x78, 0x43, 0xff, 0x2e, 0x63, 0x18, 0x8b, 0xfc, 0x99, 0xa7, 0x3d, 0x44, 0x82, 0xd8, 0x37, 0x1f, 0xa9, 0x89, 0x51, 0xbd, 0x03, 0x1a, 0x26, 0xce, 0x6c, 0xaf, 0x6d, 0xe8, 0xed, 0x51, 0xb9, 0x68, 0x01, 0xba, 0x87, 0x1b, 0xc7, 0x40, 0x17, 0x2a, 0x8e, 0x04, 0x99, 0xd2, 0xf0, 0x12, 0xcd, 0xa6, 0x83, 0x20, 0x74, 0x02, 0xa7, 0x9b, 0x45, 0x05, 0x54, 0x05, 0x25, 0x27, 0xcf, 0xc7, 0xbc, 0x45, 0xc8, 0x4c, 0xc7, 0x30, 0x38, 0x0a, 0x5a, 0xd2, 0xab, 0x15, 0x49, 0xeb, 0x29, 0x28, 0x7e, 0x69, 0xd2, 0xdf, 0x20, 0xb6, 0x06, 0x28, 0x13, 0x4f, 0x33, 0x0b, 0x19, 0xb3, 0x93, 0x93, 0x2c, 0xdf, 0x74, 0x76, 0x7b, 0x54, 0x91, 0x30, 0x0e, 0xe4, 0x1c, 0x46, 0x61, 0xf2, 0x1d, 0x0c, 0xb4, 0x5b, 0x8c, 0xd1, 0x7d, 0x58, 0xb6, 0xee, 0x86, 0xb0, 0x8b, 0x00, 0x07, 0x49, 0x60, 0xe3, 0x48, 0xb3, 0x73, 0x01, 0x48, 0xce, 0x40, 0x2b, 0x1b, 0x12, 0xc3, 0xc8, 0x52, 0x98, 0xc9, 0x21, 0xbc, 0x50, 0x73, 0x07, 0x2d, 0x75, 0x38, 0x7e, 0xea, 0x8c, 0xf3, 0x89, 0xc7, 0x1c, 0x0c, 0x86, 0xe7, 0x9f, 0xc6, 0x08, 0x42, 0x05, 0x96, 0x5c, 0x8e, 0xa5, 0x03, 0x2c, 0xab, 0x9f, 0x00, 0x1f, 0x0a, 0x9b, 0xc4, 0x60, 0x2a, 0xd8, 0x89, 0x72, 0x87, 0x27, 0x03, 0x3c, 0xf3, 0x0b, 0x4b, 0xf4, 0x04, 0x21, 0x30, 0x36, 0x35, 0x64, 0x01, 0xe9, 0x85, 0x81, 0xe7, 0x72, 0xfc, 0xcb, 0x92, 0xed, 0xe5, 0xc2, 0x43, 0x1a, 0x70, 0x2a, 0x4a, 0x03, 0x39, 0x0e, 0x61, 0x5d, 0x12, 0x7d, 0x0e, 0x81, 0xcc, 0x8a, 0x34, 0xcb, 0x4d, 0x74, 0x7c, 0x97, 0x3b, 0x42, 0x03, 0xc0, 0xc1, 0x4b, 0xa3, 0x0e, 0x96, 0xb5, 0xd1, 0x13, 0xce, 0x62, 0x31, 0xe5, 0x39, 0xa2, 0x51, 0xf4, 0x82, 0x64, 0x1c, 0x89, 0xf9, 0x51, 0xbb, 0xf9, 0x08, 0xc0, 0x4c, 0x8d, 0x75, 0x81, 0xf9, 0xe7, 0x87, 0x01, 0xcd, 0x72, 0x8c, 0x3e, 0x97, 0x45, 0x36, 0x71, 0xc6, 0x23, 0xec, 0x15, 0x6b, 0xa9, 0xc0, 0x41, 0x18, 0xbb, 0xdc, 0x2f, 0x30, 0xd6, 0x13, 0x9a, 0xca, 0x6b, 0x70, 0xa5, 0xf0, 0xf1, 0x22, 0xbd, 0x14, 0x94, 0x92, 0x9d, 0xe7, 0x2d, 0x8d, 0x0a, 0x2a, 0x3f, 0x2e, 0xb9, 0x02, 0xa8, 0xe9, 0xcb, 0xb0, 0x12, 0xbb, 0x0e, 0xfd, 0x92, 0xb1, 0x6f, 0xb8, 0x5e, 0x9c, 0x61, 0x8c, 0xa2, 0xde, 0xd3, 0x38, 0xda, 0x38, 0x42, 0x9e, 0x63, 0x21, 0x0c, 0x01, 0x93, 0x63, 0x85, 0x05, 0x19, 0x51, 0xa9, 0x7d, 0x81, 0x3f, 0x8d, 0x03, 0x89, 0x38, 0x5c, 0xce, 0x8d, 0x83, 0xcd, 0x37, 0x47, 0xcf, 0x9f, 0x35, 0x1c, 0xf5, 0x7b, 0xf7, 0xd5, 0x8f, 0x0d, 0x61, 0xb7, 0xd0, 0xd5, 0x77, 0x7b, 0x1a, 0x39, 0xfc, 0x6a, 0x14, 0x81, 0xfc, 0x46, 0x78, 0xc3, 0xe7, 0x7c, 0x0c, 0xcc, 0x26, 0xcf, 0x91, 0x39, 0x10, 0x14, 0x4c, 0x22, 0x48, 0xa0, 0x86, 0x00, 0xd2, 0xcd, 0x6c, 0xcb, 0x64, 0x87, 0xc0, 0x7c, 0x8a, 0x88, 0x34, 0x5c, 0x2a, 0x1c, 0x41, 0x73, 0x20, 0xed, 0x00, 0x3f, 0x0a, 0x89, 0x46, 0xe5, 0x60, 0x68, 0x42, 0xb9, 0xac, 0xbd, 0x32, 0x8e, 0xeb, 0xc9, 0x2e, 0x1f, 0x67, 0x54, 0x3d, 0x8e, 0x88, 0x61, 0x55, 0x17, 0x13, 0x71, 0x76, 0xa4, 0x2a, 0x8c, 0xe6, 0x05, 0xfa, 0x9b, 0x38, 0x69, 0x57, 0x98, 0x39, 0xba, 0x00, 0x2a, 0xfa, 0xdf, 0x7e, 0x1c, 0xa3, 0xa6, 0x3c, 0xe0, 0x52, 0xda, 0x48, 0x13, 0x2e, 0xe6, 0x4d, 0xe8, 0xe5, 0xe2, 0xdf, 0xdf, 0xb2, 0x8b, 0x5a, 0x2c, 0xed, 0x7e, 0xd2, 0x06, 0x61, 0xc0, 0xac, 0x67, 0x0a, 0x1d, 0x4f, 0xbe, 0xb5, 0xd0, 0xd1, 0xd3, 0x38, 0x37, 0xd7, 0xa7, 0x12, 0x3c, 0xc4, 0x6c, 0x7e, 0x4b, 0xe1, 0x62, 0x3f, 0xb8, 0x8a, 0x86, 0xe3, 0xa1, 0xe4, 0xbd, 0x87, 0x82, 0x00, 0xee, 0xc0, 0x08, 0x8c, 0x97, 0x8a, 0xcb, 0xd2, 0x42, 0xfa, 0x22, 0x2c, 0xac, 0x29, 0x14, 0xdc, 0x36, 0xfe, 0x57, 0xf6, 0xc2, 0xc4, 0xa1, 0x8b, 0x71, 0xd9, 0x0b, 0x27, 0xea, 0xd9, 0x28, 0xe8, 0x05, 0x51, 0x9c, 0x57, 0x07, 0x2d, 0xfc, 0x27, 0xd4, 0x1a, 0xed, 0x14, 0x80, 0xa9, 0x22, 0x91, 0x5b, 0x2e, 0xfd, 0xc4, 0x6d, 0x47, 0xed, 0x6a, 0x47, 0xc1, 0x45, 0xa9, 0x4f, 0x7d, 0xf0, 0x58, 0x56, 0x5a, 0xca, 0x6a, 0xf7, 0xb2, 0xc7, 0xd6, 0x5e, 0x26, 0xae, 0xa7, 0xdb, 0x00, 0x15, 0x30, 0xf8, 0xa2, 0x7a, 0x72, 0x4d, 0x42, 0xf7, 0xb2, 0x67, 0x27, 0x07, 0x38, 0x42, 0x63, 0xad, 0xc6, 0x93, 0x05, 0x68, 0x35, 0xd5, 0xad, 0xce, 0xcc, 0x65, 0x43, 0x3f, 0x37, 0xee, 0x12, 0xa6, 0x8f, 0x76, 0x9f, 0xdd, 0xaa, 0xcc, 0xe5, 0x39, 0x46, 0x77, 0x19, 0x8a, 0x5c, 0xe3, 0x39, 0xf1, 0xa0, 0x77, 0xd1, 0x4e, 0xa4, 0x37, 0x2d, 0x3a, 0x95, 0x69, 0x36, 0x1b, 0xdf, 0x56, 0xa9, 0x3b, 0x80, 0x97, 0xd0, 0x7c, 0x58, 0x0b, 0xdf, 0x48, 0x7e, 0x14, 0x2b, 0x4e, 0xfe, 0x9e, 0x07, 0xa7, 0x2a, 0x70, 0x1b, 0x8c, 0x73, 0x66, 0xa7, 0xa8, 0xcc, 0xce, 0xac, 0x84, 0x42, 0xc2, 0xd3, 0xab, 0xb4, 0x00, 0xf1, 0x41, 0x6c, 0x85, 0x5d, 0x60, 0x5b, 0x7d, 0x25, 0xb3, 0x5e, 0xa2, 0x42, 0xaf, 0xf0, 0x34, 0x49, 0xc7, 0x40, 0xf6, 0x13, 0x78, 0xe6, 0xc4, 0xe8, 0x85, 0x4d, 0x35, 0xa0, 0x23, 0x5e, 0x50, 0xae, 0x03, 0xa1, 0x5c, 0xe3, 0x17, 0xb4, 0x8a, 0xd0, 0x16, 0x05, 0x6c, 0x32, 0x24, 0xc5, 0x5e, 0xef, 0x84, 0xd4, 0x22, 0x30, 0x81, 0x84, 0x77, 0x4b, 0x3a, 0x67, 0xf4, 0x49, 0x94, 0x14, 0xfb, 0x1e, 0xdd, 0x55, 0x42, 0x8d, 0x6c, 0x1e, 0xc0, 0x0e, 0x8c, 0x71, 0xd7, 0x80, 0x69, 0x84, 0x00, 0xe3, 0xb2, 0x33, 0x2e, 0x5b, 0x70, 0x3a, 0x13, 0xdd, 0x18, 0x82, 0x2c, 0xb6, 0xc5, 0x77, 0x26, 0xd4, 0x38, 0xbb, 0xa1, 0x14, 0xbe, 0xdf, 0x6f, 0x1d, 0x1f, 0x1f, 0xed, 0x1c, 0x3d, 0x5c, 0x25, 0x70, 0xa0, 0xb5, 0x4c, 0x17, 0x93, 0x07, 0xd1, 0xb9, 0xb3, 0xff, 0xec, 0xd5, 0x11, 0xca, 0xa0, 0xdd, 0x94, 0x58, 0xb6, 0xea, 0x32, 0x88, 0xf3, 0xd4, 0x41, 0x47, 0x23, 0x73, 0x54, 0x4e, 0x50, 0x38, 0x4f, 0x83, 0x72, 0xcf, 0x4c, 0xce, 0x1d, 0xfc, 0x47, 0x09, 0xc1, 0x14, 0x33, 0x28, 0xdd, 0xa6, 0xba, 0xdd, 0xab, 0xbc, 0x97, 0x43, 0xcf, 0x78, 0xfa, 0x14, 0x6f, 0xd8, 0x8f, 0xb0, 0x1e, 0xba, 0xc2, 0xb2, 0x63, 0xad, 0x70, 0x58, 0xd1, 0x1b, 0xdb, 0x38, 0x1d, 0xf6, 0x90, 0xcc, 0xb3, 0x99, 0x30, 0x52, 0x37, 0xb7, 0x91, 0xb7, 0xa0, 0xff, 0x1c, 0xd3, 0x52, 0xb1, 0x93, 0x9c, 0x25, 0xfa, 0x37, 0x06, 0xdd, 0xa9, 0xdf, 0x01, 0xcb, 0xf0, 0xf7, 0x43, 0xfe, 0x08, 0x1e, 0x42, 0xd6, 0xc7, 0x87, 0xc7, 0xf4, 0xd0, 0x63, 0x23, 0x7c, 0x58, 0xe3, 0x8f, 0xe1, 0x61, 0xc8, 0x8e, 0x28, 0x8e, 0x6d, 0x15, 0x7e, 0x77, 0x59, 0x47, 0x57, 0x3f, 0x63, 0x03, 0x19, 0xdf, 0xc6, 0x4e, 0xc6, 0x6c, 0x11, 0x7f, 0x0b, 0xab, 0xd5, 0xc9, 0x84, 0x5d, 0xea, 0x1a, 0x9b, 0xec, 0x50, 0xff, 0xde, 0x63, 0x5b, 0xd4, 0xec, 0x13, 0xea, 0xe4, 0x15, 0xdb, 0xc1, 0xa7, 0x47, 0xde, 0xfa, 0xa0, 0x70, 0xe9, 0xba, 0x1d, 0xb2, 0xe1, 0x62, 0xe8, 0xe6, 0x11, 0x25, 0xc4, 0x97, 0xd9, 0xa7, 0xfc, 0x40, 0xec, 0x0e, 0x1c, 0xaf, 0xef, 0x6d, 0xac, 0x00, 0x39, 0x9d, 0x95, 0x26, 0x50, 0xf2, 0x7d, 0xd8, 0x6e, 0xa6, 0xe7, 0xb3, 0x21, 0x2e, 0x3b, 0x40, 0x4c, 0x82, 0x36, 0xd1, 0x9c, 0xa5, 0x6d, 0x60, 0x2d, 0x67, 0xf1, 0x7a, 0xbb, 0x29, 0xe4, 0x8e, 0xa9, 0xf1, 0x1b, 0x53, 0x79, 0x4d, 0x3f, 0xa8, 0x5e, 0x2f, 0x64, 0xaf, 0xdb, 0xcd, 0x8f, 0x79, 0x8a, 0x11, 0xfb, 0x85, 0x7b, 0xd1, 0x44, 0x06, 0x42, 0xfe, 0x56, 0x2c, 0x21, 0x14, 0xc4, 0xf0, 0x4e, 0x59, 0x88, 0xc4, 0xfb, 0x0c, 0xde, 0x48, 0x01, 0xe5, 0xe6, 0x86, 0x10, 0xdb, 0x87, 0x37, 0xb4, 0xa1, 0x9f, 0x91, 0xf9, 0xe0, 0x4c, 0x7f, 0x25, 0x4c, 0x8f, 0xb0, 0x55, 0xd4, 0xaf, 0xcf, 0x48, 0x20, 0x2a, 0xbf, 0x12, 0xea, 0x17, 0xe1, 0x6b, 0x30, 0x3a, 0x1b, 0x52, 0xae, 0x47, 0x81, 0xdb, 0x4b, 0x17, 0xe3, 0x2c, 0x60, 0xaf, 0x38, 0x4b, 0x93, 0x33, 0x21, 0x5a, 0x94, 0x31, 0xff, 0x33, 0x9f, 0x5a, 0x88, 0xf6, 0x43, 0x84, 0x52, 0x68, 0x6a, 0x66, 0x51, 0xf9, 0x8a, 0x8a, 0x6c, 0xe9, 0x56, 0xcd, 0x6d, 0x47, 0x41, 0x73, 0x36, 0xcc, 0x01, 0x20, 0x9a, 0xb4, 0x1d, 0x28, 0x08, 0x9b, 0xdd, 0x99, 0x28, 0x2c, 0x65, 0xa6, 0x9b, 0x1b, 0x68, 0xa2, 0x83, 0x18, 0x91, 0x77, 0x2c, 0x6f, 0x7b, 0xd7, 0x1d, 0xf7, 0x03, 0x4d, 0x83, 0x32, 0x25, 0x56, 0xd0, 0x0f, 0x7b, 0x5f, 0x1e, 0xf4, 0x31, 0x3e, 0xc0, 0xbe, 0x01, 0x15, 0x63, 0x6e, 0xed, 0xb0, 0xdc, 0xc6, 0xbc, 0x69, 0x6c, 0xb0, 0xed, 0xf2, 0xc6, 0xf3, 0x23, 0x24, 0xc3, 0xa9, 0x0a, 0xbd, 0x74, 0x76, 0x7d, 0x9b, 0x9e, 0x06, 0x44, 0xa5, 0x04, 0xa2, 0xa6, 0xaa, 0x6b, 0x9c, 0x4d, 0xcc, 0xdf, 0xc4, 0x88, 0xa5, 0x86, 0x14, 0x25, 0x21, 0xb1, 0x8d, 0xee, 0x5b, 0x6a, 0x62, 0x5b, 0x74, 0x97, 0x84, 0xc0, 0x44, 0x2b, 0xc0, 0x08, 0xd3, 0xd9, 0xd9, 0x6c, 0x85, 0xd4, 0x8c, 0x8d, 0xfb, 0x89, 0x4b, 0xee, 0x5b, 0xd5, 0xb9, 0x6d, 0xf5, 0xe0, 0xbd, 0x42, 0xfe, 0xa6, 0xae, 0x37, 0x07, 0xf1, 0xad, 0x3d, 0x28, 0x31, 0x83, 0xf1, 0xd6, 0x2b, 0x3c, 0x99, 0xbe, 0xa8, 0xac, 0x0c, 0x61, 0xcc, 0x2e, 0x17, 0x07, 0xbb, 0x16, 0x3e, 0x39, 0x2d, 0xe1, 0x83, 0xc3, 0x06, 0x3c, 0x80, 0xdd, 0x24, 0x6f, 0x5d, 0x37, 0x64, 0x6e, 0xbb, 0x65, 0xcc, 0xd6, 0xd7, 0x68, 0x35, 0xf0, 0x9a, 0x56, 0xd9, 0xf5, 0x0a, 0x92, 0x7b, 0x63, 0xca, 0x3a, 0x69, 0x38, 0x69, 0x55, 0x0e, 0x09, 0x01, 0xdf, 0x62, 0xbd, 0x5d, 0xdc, 0xb1, 0xde, 0x70, 0x93, 0xb7, 0x26, 0xfc, 0xc2, 0x58, 0x6f, 0x17, 0x35, 0xeb, 0x0d, 0xa7, 0x3b, 0x4e, 0xfb, 0x6e, 0xe3, 0x16, 0x39, 0x01, 0x26, 0x5c, 0x4c, 0xd9, 0x36, 0xad, 0xc3, 0x72, 0x7e, 0xb6, 0xf5, 0x1a, 0xd4, 0xd3, 0xb4, 0xad, 0x16, 0x61, 0xed, 0x64, 0x6d, 0xd7, 0x2d, 0xc8, 0xda, 0xa9, 0xda, 0xae, 0x5b, 0x9c, 0x33, 0x13, 0xbd, 0x5d, 0x5d, 0x76, 0x7a, 0x7a, 0xb7, 0xd5, 0x2a, 0xbb, 0x63, 0x92, 0xb7, 0x6f, 0x5f, 0x7d, 0x35, 0x04, 0xb0, 0x3d, 0xbb, 0x0c, 0x35, 0xf1, 0x6e, 0x2b, 0xa6, 0x31, 0xf5, 0xd8, 0x80, 0x38, 0x6f, 0xc5, 0x53, 0x4e, 0x2c, 0x87, 0x47, 0xb0, 0xa0, 0x6b, 0x16, 0x2c, 0x60, 0xfe, 0x1b, 0xad, 0x57, 0x9b, 0x0c, 0x68, 0xbd, 0xce, 0x1e, 0xd7, 0x6d, 0xfb, 0x89, 0x71, 0xa6, 0x9d, 0xba, 0xdb, 0xac, 0xfc, 0x76, 0x21, 0x0f, 0xf0, 0x17, 0x16, 0x86, 0xe5, 0x29, 0x3a, 0x25, 0x30, 0x71, 0xbd, 0x76, 0x04, 0xd5, 0x5a, 0x65, 0xd9, 0x73, 0x3f, 0xc6, 0x85, 0xfa, 0xd1, 0x3f, 0x37, 0x8f, 0xfd, 0xae, 0xfc, 0x8f, 0xd6, 0xb1, 0xdf, 0x6b, 0xff, 0xca, 0x7a, 0x7e, 0xe7, 0xbf, 0x36, 0x8b, 0x7f, 0xf2, 0xdf, 0x59, 0x9f, 0x3f, 0xc3, 0x67, 0xf3, 0xf9, 0x17, 0xff, 0xb3, 0x59, 0xfc, 0x47, 0xff, 0x17, 0xeb, 0x73, 0xc1, 0xfd, 0x1f, 0xad, 0x17, 0x03, 0x14, 0x3e, 0xcd, 0x1a, 0x43, 0xee, 0x0f, 0xb8, 0x75, 0xf0, 0x38, 0xb4, 0x1f, 0x71, 0x28, 0x1d, 0x0e, 0xdd, 0x98, 0xcd, 0xec, 0x72, 0xbf, 0x63, 0x35, 0x93, 0x73, 0x7f, 0xd7, 0xaa, 0xc7, 0x76, 0xb8, 0x9f, 0xdb, 0x6f, 0x40, 0xb0, 0xdc, 0xb1, 0x2a, 0x5d, 0x80, 0xa4, 0x59, 0xe9, 0x6c, 0xb6, 0xef, 0x98, 0xba, 0xb2, 0x50, 0xc6, 0xfd, 0xd8, 0x6a, 0xe7, 0x8c, 0xfb, 0xaf, 0xed, 0x22, 0x1f, 0xb9, 0x7f, 0x66, 0xbf, 0xd9, 0xe7, 0xfe, 0x47, 0xab, 0x52, 0xc6, 0xfd, 0x7d, 0x5e, 0x39, 0x71, 0x9d, 0xe9, 0xfc, 0x0d, 0x75, 0x65, 0xb6, 0xf3, 0x8c, 0xfb, 0x6f, 0xac, 0x76, 0xb6, 0xb8, 0xff, 0xcc, 0x2e, 0x12, 0x70, 0x7f, 0xcb, 0x2a, 0xb2, 0x48, 0x75, 0xcc, 0x22, 0x57, 0xdc, 0x5f, 0xb4, 0x8a, 0x4c, 0xb8, 0x7f, 0x65, 0x17, 0x49, 0xb8, 0x3f, 0xb1, 0x8a, 0xbc, 0xa2, 0x3a, 0x66, 0x91, 0x23, 0xee, 0xbf, 0xb2, 0xdf, 0xbc, 0xe3, 0xfe, 0x91, 0xfd, 0xe6, 0x25, 0xf7, 0xdf, 0x59, 0xcd, 0x5c, 0x72, 0xff, 0xa5, 0x5d, 0x24, 0xe5, 0xfe, 0x65, 0xa5, 0xef, 0xc2, 0x4f, 0xad, 0x4a, 0x5d, 0xd0, 0x38, 0x0b, 0x0b, 0x3b, 0xdd, 0x59, 0x64, 0x6d, 0x53, 0x57, 0x66, 0x3b, 0x6f, 0xb9, 0xbf, 0x6d, 0xb5, 0x13, 0x72, 0xff, 0xad, 0x5d, 0xe4, 0x05, 0x15, 0xa9, 0x3d, 0xf8, 0x3e, 0x37, 0x16, 0xde, 0x1b, 0xbd, 0xf0, 0xba, 0xf6, 0xc2, 0x7b, 0x43, 0x59, 0xc2, 0x75, 0xb9, 0x5f, 0xfd, 0xcc, 0x5a, 0xbc, 0xbf, 0xa2, 0xcf, 0xdf, 0xaf, 0x74, 0x40, 0xe9, 0xe1, 0x62, 0xc4, 0x13, 0xcc, 0xfa, 0x76, 0xcf, 0x6a, 0xda, 0x0d, 0xa2, 0xbb, 0xeb, 0x8d, 0xef, 0x80, 0x27, 0x45, 0x26, 0x70, 0xc0, 0xfd, 0x5f, 0x4d, 0x3c, 0x9c, 0x73, 0xff, 0xc0, 0x42, 0xcc, 0x98, 0xfb, 0xe7, 0x36, 0x62, 0x3e, 0x51, 0x11, 0xf3, 0x4d, 0x8f, 0xfb, 0x9f, 0xac, 0x4a, 0x9f, 0xb9, 0xdf, 0xab, 0xc5, 0xdd, 0x98, 0x37, 0x17, 0x17, 0x49, 0x0b, 0xf3, 0x39, 0x86, 0x4c, 0xba, 0x5c, 0x65, 0x5c, 0x57, 0x39, 0x10, 0x3e, 0xdb, 0x25, 0x92, 0xd9, 0x12, 0x22, 0xe1, 0x33, 0xb4, 0x24, 0xc2, 0x6b, 0xd0, 0x6b, 0x48, 0xbe, 0xfb, 0xac, 0xde, 0x61, 0x80, 0xa0, 0x81, 0xdc, 0xab, 0xb9, 0x48, 0xba, 0x0b, 0x47, 0x5d, 0x63, 0xce, 0x7e, 0x05, 0xc0, 0xc8, 0xfd, 0x92, 0xfc, 0x15, 0x17, 0x69, 0xb7, 0xb0, 0xfa, 0xf8, 0xa4, 0x21, 0x7f, 0x83, 0x37, 0x71, 0xbe, 0xa9, 0xc0, 0xfd, 0xa3, 0xf9, 0x39, 0x73, 0xc9, 0x8f, 0x78, 0x37, 0x29, 0xaa, 0xe5, 0x6e, 0x6e, 0x30, 0x0d, 0x3b, 0x00, 0x5c, 0x70, 0x3a, 0xd0, 0x76, 0xe1, 0x71, 0x65, 0x0d, 0x36, 0xa0, 0x66, 0x91, 0xee, 0x44, 0x57, 0x3c, 0x74, 0x61, 0x43, 0xc2, 0xf8, 0xe7, 0x9c, 0x9b, 0x0d, 0xf6, 0x6f, 0x69, 0x30, 0x14, 0x0d, 0xee, 0xc8, 0x06, 0xc3, 0x9a, 0x06, 0x2f, 0xa0, 0xc1, 0x33, 0xab, 0xc1, 0xd1, 0x2d, 0x0d, 0xf6, 0x44, 0x83, 0x1f, 0x65, 0x83, 0xbd, 0x9a, 0x06, 0x33, 0xcc, 0xea, 0xc2, 0xeb, 0xbc, 0x77, 0x49, 0x31, 0x6b, 0x30, 0xe8, 0xe2, 0xb2, 0x6c, 0x59, 0x1e, 0x6c, 0x40, 0xb3, 0xc9, 0x1d, 0x95, 0x0e, 0xeb, 0x2a, 0x5d, 0x5a, 0xa0, 0x6f, 0xdd, 0x02, 0xfa, 0x9e, 0x00, 0x3d, 0x95, 0xa0, 0xef, 0xd5, 0x80, 0xde, 0xe5, 0x78, 0x13, 0x90, 0xd9, 0xe0, 0xce, 0x2d, 0x0d, 0xbe, 0xc2, 0x06, 0x5f, 0x70, 0x4d, 0x1c, 0xbb, 0x92, 0x18, 0x3f, 0x49, 0x5a, 0x8c, 0x4a, 0xfa, 0xfc, 0x51, 0xbe, 0x0a, 0xca, 0x57, 0xb9, 0x22, 0xd9, 0xb0, 0x7c, 0x77, 0xa6, 0xde, 0xf5, 0xca, 0x77, 0x01, 0x57, 0xa3, 0xf5, 0x27, 0xe5, 0xdb, 0xa4, 0x7c, 0xbb, 0x59, 0xbe, 0xbd, 0x54, 0xf5, 0xf7, 0xca, 0x77, 0xa1, 0x7a, 0x47, 0xe0, 0x9e, 0x2b, 0xb2, 0xf5, 0xd8, 0x36, 0xfd, 0x1c, 0x8a, 0x4b, 0x45, 0xcd, 0xdb, 0x27, 0x4f, 0x3d, 0xe2, 0x9d, 0xe3, 0x19, 0x3f, 0x31, 0x74, 0x9d, 0xb0, 0xfc, 0x9b, 0xf2, 0x41, 0x10, 0xa6, 0x97, 0xcb, 0xf9, 0xb0, 0xb1, 0x51, 0x2d, 0xb7, 0x8c, 0xc2, 0xb1, 0x33, 0x22, 0xc3, 0x77, 0xd5, 0xd5, 0x0c, 0x8d, 0xb8, 0x20, 0x2b, 0x2f, 0xab, 0xc3, 0x73, 0xcb, 0xe3, 0x6c, 0xd8, 0x59, 0x7e, 0xd8, 0x30, 0x8e, 0x80, 0x44, 0x6b, 0x45, 0x54, 0xe0, 0x91, 0x9f, 0x38, 0x94, 0x42, 0x7f, 0x0b, 0x3c, 0xf6, 0xa9, 0xb6, 0xdb, 0x0f, 0x46, 0x54, 0xb7, 0xde, 0xe8, 0x77, 0x95, 0xd3, 0x1f, 0x0c, 0x45, 0xc4, 0xcb, 0x40, 0x37, 0xfe, 0xf6, 0x97, 0x3f, 0xff, 0xf7, 0x0f, 0x9e, 0xae, 0x88, 0xc2, 0x5f, 0x52, 0x69, 0xf9, 0x4b, 0x2b, 0x1d, 0x72, 0x10, 0xf0, 0xca, 0x4a, 0xa6, 0xad, 0xda, 0x74, 0x3e, 0x23, 0x17, 0xba, 0xbc, 0xc6, 0x77, 0xed, 0x87, 0x55, 0xb4, 0x50, 0xc2, 0xc8, 0xd0, 0x51, 0xdf, 0xa1, 0x13, 0xc7, 0xdc, 0xe9, 0xa6, 0xb1, 0xb8, 0x86, 0x56, 0x5a, 0xca, 0x1f, 0x3a, 0xca, 0x54, 0xfc, 0xd7, 0x7f, 0xf8, 0xdf, 0x9d, 0xed, 0x01, 0x1e, 0x9a, 0x0b, 0x65, 0x27, 0xaf, 0x2d, 0x81, 0x37, 0x02, 0x93, 0x5b, 0x4b, 0x00, 0x9a, 0xde, 0xd3, 0x85, 0x0d, 0xb4, 0xd2, 0x62, 0x66, 0x34, 0x51, 0x1d, 0x09, 0x81, 0xc4, 0x53, 0xba, 0xeb, 0x56, 0xf6, 0xf9, 0x1d, 0xea, 0x75, 0xb5, 0xce, 0x83, 0x6a, 0x46, 0xe5, 0x1c, 0x56, 0x5c, 0x08, 0x1f, 0xff, 0xc1, 0x3e, 0xdd, 0xbc, 0xd3, 0xa5, 0x66, 0x18, 0x92, 0x1d, 0xb5, 0x6f, 0x58, 0x3c, 0xbb, 0x41, 0x72, 0x11, 0xe0, 0x41, 0x46, 0x58, 0x0c, 0xd0, 0x98, 0x5e, 0xf1, 0xbf, 0x13, 0x9e, 0x76, 0x33, 0x0e, 0x77, 0x59, 0x8a, 0x57, 0x9d, 0x85, 0xea, 0xb0, 0xb6, 0x9b, 0xa5, 0x39, 0xd0, 0x6c, 0x24, 0xcc, 0xb4, 0x83, 0x99, 0xb1, 0x20, 0x96, 0x81, 0x66, 0x1f, 0x5a, 0x7e, 0x8e, 0xaa, 0x0d, 0xe9, 0x5b, 0xd8, 0xd0, 0xc7, 0x42, 0x47, 0xf2, 0x1e, 0x60, 0xe7, 0x00, 0xb1, 0x53, 0x1e, 0x0c, 0x39, 0xe4, 0x2a, 0xd2, 0x42, 0xa4, 0x32, 0x3a, 0x43, 0x68, 0x39, 0x96, 0xcf, 0x5f, 0x5e, 0xc9, 0x00, 0x2a, 0x32, 0xf9, 0x88, 0x14, 0xb6, 0xd2, 0x08, 0x14, 0xb3, 0x00, 0x7f, 0x5f, 0x7f, 0x4e, 0xd3, 0xe1, 0x1e, 0xcc, 0x5e, 0xdc, 0x5a, 0x23, 0xbd, 0xed, 0x10, 0x99, 0x61, 0xeb, 0x87, 0x55, 0xa6, 0xee, 0x20, 0x16, 0x5d, 0x53, 0x46, 0x54, 0x19, 0x9e, 0xa8, 0xa3, 0xa4, 0x6d, 0xed, 0x5e, 0xbc, 0xed, 0x08, 0x6d, 0xd8, 0x35, 0x75, 0x62, 0x72, 0xb8, 0xa5, 0x09, 0xc6, 0xbc, 0x7c, 0xc2, 0x90, 0xd3, 0xa1, 0xbc, 0xf4, 0x4b, 0x4b, 0xb9, 0x2b, 0x7e, 0x29, 0x1d, 0xa8, 0x2b, 0x00, 0xaf, 0xd5, 0x64, 0xa8, 0x35, 0x34, 0x86, 0x66, 0x22, 0x98, 0xbc, 0x45, 0xbe, 0xff, 0xca, 0xf8, 0x10, 0x09, 0xe3, 0x03, 0xeb, 0xfb, 0x5d, 0x79, 0x45, 0x75, 0x76, 0x73, 0x53, 0xb8, 0x9e, 0x79, 0x45, 0x83, 0x15, 0x5a, 0xd7, 0xf1, 0x29, 0xf6, 0x67, 0x0b, 0xb1, 0x0f, 0x34, 0x01, 0x14, 0x09, 0xe4, 0x74, 0x08, 0x83, 0x16, 0x09, 0x6c, 0x9b, 0x5d, 0x7a, 0xf1, 0x7e, 0xb9, 0x03, 0x2d, 0xf4, 0x0a, 0x36, 0xd0, 0xaf, 0x7e, 0x81, 0x57, 0x45, 0x3a, 0x62, 0x63, 0xff, 0xf1, 0x2a, 0x5b, 0x84, 0x56, 0x88, 0x66, 0x96, 0x1f, 0x7e, 0x3f, 0x66, 0x13, 0x78, 0x1a, 0x70, 0xcc, 0x97, 0x80, 0x8f, 0x14, 0xd7, 0xf3, 0x74, 0x7c, 0x73, 0x73, 0xb6, 0x31, 0x7e, 0xb0, 0x78, 0x73, 0x33, 0xc0, 0xdf, 0x03, 0xf8, 0x3d, 0xa9, 0x06, 0xf9, 0x61, 0x9f, 0x9b, 0xfe, 0x7e, 0x50, 0x0c, 0x9a, 0xb0, 0x4a, 0x5c, 0x4c, 0x05, 0x4e, 0x69, 0x10, 0x77, 0xfd, 0x8d, 0xdd, 0x66, 0x41, 0x59, 0x92, 0xc4, 0xc7, 0xe0, 0xaa, 0xe6, 0xe3, 0x9e, 0xef, 0x9e, 0x2d, 0x8f, 0xbd, 0x95, 0x45, 0xb6, 0xe5, 0x6f, 0x3e, 0x70, 0x0f, 0x97, 0x37, 0xbd, 0xef, 0xf7, 0x68, 0xb2, 0x5e, 0xf9, 0x97, 0xe8, 0xeb, 0xbb, 0x23, 0x6a, 0x07, 0x9d, 0xdc, 0x7d, 0xd5, 0x2c, 0x96, 0xb7, 0xbc, 0xf5, 0x4b, 0x1d, 0xdf, 0xbd, 0xab, 0x9d, 0x41, 0xb7, 0xcb, 0x52, 0xbb, 0xa2, 0xd4, 0xf6, 0xd3, 0x1d, 0x10, 0x5a, 0x76, 0xfc, 0x6d, 0xf6, 0xca, 0xdf, 0xc5, 0xc0, 0xea, 0x00, 0x8b, 0x53, 0xfe, 0x95, 0xdd, 0x0a, 0x85, 0xbc, 0xa2, 0xcc, 0x53, 0x3d, 0x11, 0x70, 0x11, 0x60, 0xfe, 0x46, 0x2a, 0xd6, 0x35, 0xa8, 0x4a, 0x8f, 0x60, 0x6d, 0x95, 0x75, 0x9b, 0xfa, 0xfd, 0xca, 0x43, 0x10, 0xcd, 0x34, 0x19, 0x76, 0x9b, 0xfa, 0xf7, 0xf7, 0x0f, 0xa9, 0xcd, 0xd1, 0xdd, 0x6d, 0x02, 0xca, 0xd6, 0x1e, 0x3f, 0xb6, 0x5a, 0xfd, 0x7e, 0x5e, 0xab, 0x2b, 0xa2, 0xd5, 0xa1, 0x6a, 0xf5, 0xcb, 0x96, 0xc0, 0x94, 0x1d, 0xf9, 0xfa, 0x0e, 0xf4, 0x3b, 0x08, 0xac, 0x2b, 0x08, 0x6c, 0x5b, 0x5c, 0xaf, 0xec, 0x36, 0x1e, 0x86, 0xd2, 0x52, 0xda, 0x9d, 0x25, 0x44, 0x22, 0x21, 0x20, 0x3b, 0x45, 0x3e, 0x40, 0x6e, 0x8f, 0x57, 0xd7, 0x91, 0xe2, 0x78, 0x90, 0x11, 0x51, 0xae, 0xb2, 0x55, 0x86, 0xa9, 0x90, 0x75, 0x70, 0x15, 0x6c, 0x63, 0xdf, 0x0f, 0x80, 0xfe, 0xce, 0xf0, 0x2f, 0x14, 0xed, 0x45, 0x71, 0x7c, 0x84, 0x17, 0xa4, 0xf9, 0x8d, 0xdf, 0xf5, 0xfe, 0xd0, 0xfb, 0x63, 0x2f, 0x80, 0xf5, 0x41, 0x6f, 0xa9, 0xfe, 0x80, 0x0d, 0xd8, 0x98, 0x2d, 0x82, 0x0c, 0x82, 0xc6, 0xa4, 0xf4, 0x9c, 0xab, 0xb2, 0xfc, 0x8f, 0xbc, 0x8b, 0xee, 0xff, 0xdd, 0x26, 0x6e, 0x26, 0xef, 0x88, 0xff, 0x95, 0x17, 0x26, 0x5c, 0xf9, 0xab, 0xeb, 0x57, 0x4f, 0xfd, 0x35, 0xf8, 0xb7, 0x4c, 0x7b, 0xf0, 0xda, 0x1f, 0x3c, 0xb8, 0xfa, 0x7e, 0xbc, 0xb2, 0x86, 0x20, 0x76, 0x78, 0x3f, 0x4a, 0x44, 0xd8, 0x2f, 0xb4, 0x81, 0x6e, 0x69, 0xc7, 0xa9, 0xfb, 0x9a, 0x0d, 0x3c, 0xd9, 0xa2, 0x78, 0x7a, 0x60, 0xf4, 0xec, 0xca, 0xbb, 0x25, 0xcb, 0xe6, 0x9f, 0xcc, 0xb6, 0xbe, 0xb8, 0xf2, 0x64, 0x5e, 0xe3, 0x03, 0xf6, 0xda, 0x68, 0x7c, 0xf0, 0x60, 0x2c, 0x9e, 0x75, 0xe3, 0x2a, 0x56, 0xb7, 0x70, 0xad, 0xec, 0x49, 0x4f, 0x1f, 0xda, 0x78, 0xdf, 0xf4, 0x9f, 0x61, 0x90, 0x4e, 0x92, 0x5e, 0x0a, 0x49, 0x6d, 0x39, 0x86, 0xc9, 0x2c, 0x09, 0x08, 0x28, 0xe0, 0xd0, 0x9f, 0x58, 0x59, 0xdb, 0x8a, 0x0d, 0x7f, 0x93, 0x9a, 0x3c, 0x9c, 0xd3, 0xe4, 0x9e, 0xb5, 0x86, 0x0f, 0x69, 0x99, 0x8a, 0x9a, 0x1e, 0xa6, 0x18, 0x33, 0xd7, 0x70, 0xe5, 0xe3, 0xab, 0x79, 0x35, 0x2f, 0xe0, 0xe3, 0xce, 0xbc, 0x9a, 0xf8, 0x71, 0xd7, 0xdf, 0x59, 0x7e, 0x75, 0x73, 0xb3, 0xc6, 0xb6, 0xfd, 0x57, 0xcb, 0xbb, 0xdf, 0x37, 0xd7, 0xd8, 0x85, 0xbf, 0xf3, 0x00, 0x7f, 0xac, 0xdb, 0x53, 0x8d, 0x17, 0x38, 0xc5, 0x29, 0x10, 0x6d, 0xe3, 0x77, 0xab, 0xab, 0xbf, 0xef, 0xf4, 0x2a, 0x73, 0xfe, 0x90, 0xd9, 0xe8, 0x3e, 0x2c, 0xb3, 0xab, 0x5f, 0x01, 0x82, 0x35, 0x9b, 0x78, 0x07, 0xd3, 0xe3, 0x02, 0xd0, 0xcb, 0x7b, 0xde, 0x8a, 0xbb, 0x05, 0xff, 0x02, 0xdf, 0xfb, 0x04, 0xef, 0x16, 0x97, 0xe1, 0xed, 0xc5, 0xf2, 0x36, 0xbc, 0xc5, 0x7f, 0xbf, 0x5f, 0x5c, 0x7f, 0x4d, 0x17, 0xdd, 0xe8, 0x69, 0x7b, 0xc7, 0x3e, 0x79, 0x2d, 0x3d, 0x6d, 0xf8, 0x34, 0x35, 0xa7, 0x8d, 0x99, 0x24, 0x5c, 0x03, 0x6b, 0x09, 0xcf, 0x95, 0x86, 0xe5, 0x75, 0x0d, 0x2c, 0xef, 0x6a, 0x61, 0xa9, 0x92, 0x52, 0x90, 0x75, 0x81, 0x2c, 0xdf, 0xb1, 0x47, 0xb0, 0xac, 0x1e, 0x7e, 0x4f, 0xe8, 0x3d, 0xd8, 0x55, 0x30, 0xa0, 0x04, 0xbb, 0xae, 0x12, 0x4f, 0xc5, 0x94, 0x38, 0xd2, 0x60, 0x05, 0x48, 0x00, 0xe7, 0x4b, 0x4b, 0x87, 0x22, 0x39, 0xb7, 0x98, 0x41, 0x4c, 0xda, 0xd7, 0x2c, 0xaf, 0x1a, 0xba, 0x42, 0xb8, 0xce, 0x6d, 0xb8, 0x5e, 0x0b, 0xb8, 0xce, 0xab, 0x70, 0xd9, 0xab, 0xb1, 0xd7, 0xc3, 0x73, 0x7c, 0x7b, 0x66, 0x1e, 0xb1, 0x3a, 0xe8, 0x61, 0x52, 0xd8, 0x0f, 0x55, 0xe8, 0x6b, 0x91, 0x89, 0xad, 0xe2, 0xff, 0x1a, 0x73, 0xdb, 0x79, 0x3c, 0x07, 0x0b, 0x76, 0x2b, 0x3f, 0xfc, 0xf0, 0x03, 0xb1, 0x94, 0x14, 0x2f, 0x64, 0x59, 0x7b, 0x38, 0xba, 0x72, 0x36, 0x33, 0x4c, 0x2d, 0x83, 0x7c, 0x17, 0x38, 0xdc, 0x66, 0x1c, 0xf5, 0x13, 0x10, 0xa7, 0x49, 0x2a, 0x6b, 0x30, 0xde, 0x9c, 0xec, 0xe1, 0x71, 0x3b, 0xec, 0x20, 0x00, 0x57, 0x70, 0x21, 0xa0, 0xa2, 0xb0, 0x28, 0xbc, 0xb7, 0xd9, 0x5d, 0x7b, 0x82, 0x5c, 0x01, 0xb9, 0x7f, 0xb7, 0x99, 0xa5, 0x14, 0x18, 0xb3, 0x2c, 0x21, 0x10, 0x2f, 0xb1, 0x6b, 0xb4, 0x4f, 0xbb, 0xaa, 0x25, 0x86, 0x89, 0x19, 0xb0, 0x34, 0xc7, 0xc0, 0x29, 0xd2, 0xce, 0xad, 0x9e, 0x33, 0xe4, 0x9c, 0x8d, 0xf5, 0xdb, 0x79, 0xcb, 0xf6, 0x03, 0x81, 0x7a, 0x77, 0x6d, 0xf9, 0x6a, 0xe5, 0x89, 0x47, 0xe4, 0xa2, 0xb8, 0x8d, 0xee, 0xf1, 0xb5, 0xa9, 0xb4, 0x0d, 0x96, 0x9f, 0xb0, 0x77, 0x0f, 0x1e, 0x23, 0x36, 0x66, 0x87, 0xb9, 0xae, 0xd2, 0x88, 0xd9, 0xbc, 0xe4, 0x0e, 0x20, 0xf6, 0x1e, 0x08, 0xaa, 0x70, 0x0d, 0x10, 0xc6, 0x2b, 0x4f, 0x60, 0x1d, 0x11, 0x06, 0x48, 0x22, 0x74, 0xdd, 0x8f, 0xcb, 0xaf, 0x3d, 0x90, 0xcd, 0x3d, 0x13, 0xb2, 0x0f, 0x8b, 0xd7, 0x9f, 0xa6, 0x43, 0x27, 0xe8, 0xa7, 0x1f, 0x80, 0x7a, 0xcf, 0x96, 0x9f, 0x18, 0x49, 0x07, 0x07, 0x2a, 0xce, 0x53, 0x87, 0xe0, 0x76, 0x31, 0x3c, 0x7b, 0x17, 0x01, 0x05, 0x15, 0xcd, 0x0d, 0x19, 0x1e, 0x86, 0x19, 0x46, 0x09, 0xda, 0x5d, 0xf4, 0xe7, 0x2e, 0xad, 0x47, 0x99, 0x77, 0x92, 0x42, 0x97, 0x8e, 0x28, 0xcf, 0x5b, 0x69, 0xb5, 0xe8, 0xfa, 0x63, 0xb4, 0xec, 0x74, 0xfc, 0xae, 0x65, 0x8a, 0xf4, 0x3b, 0xe6, 0xe3, 0xc0, 0x3f, 0xb3, 0xac, 0x3c, 0xfe, 0xc0, 0xb2, 0xe8, 0x2c, 0xfa, 0x63, 0xcb, 0x08, 0xe8, 0x2f, 0x5a, 0x9f, 0x2f, 0x81, 0xe5, 0x9a, 0xcf, 0x9b, 0xd0, 0x9a, 0xf9, 0x7c, 0xe8, 0x6f, 0x9a, 0xd5, 0xf7, 0xfc, 0xc3, 0x3a, 0x63, 0xd0, 0x9e, 0x6d, 0xec, 0x83, 0x1d, 0x43, 0x38, 0xf0, 0x93, 0x96, 0x87, 0x09, 0x28, 0x95, 0x4a, 0xdd, 0x63, 0x13, 0xfd, 0x7b, 0xc4, 0x2e, 0xf5, 0xef, 0x21, 0x54, 0xea, 0x18, 0x23, 0xdf, 0xd2, 0xb6, 0xaf, 0xc4, 0xb6, 0xeb, 0x6c, 0xb9, 0x5e, 0xbb, 0x67, 0x1b, 0xc1, 0x5f, 0xf9, 0x7d, 0xc4, 0xd2, 0x8e, 0xff, 0xca, 0x80, 0x74, 0x7d, 0x47, 0xb7, 0x2d, 0x2c, 0x87, 0xbb, 0x7e, 0xa6, 0xef, 0x0d, 0x10, 0xe9, 0x60, 0x76, 0xad, 0x74, 0x9a, 0x43, 0x90, 0xc2, 0xd8, 0x0e, 0x5e, 0xea, 0xb6, 0x03, 0xb0, 0xbc, 0x62, 0xa6, 0xb1, 0x5e, 0xc1, 0x32, 0xc3, 0x9a, 0x4c, 0xc8, 0xb6, 0x6d, 0x8b, 0xd3, 0x85, 0x3f, 0x88, 0x28, 0xb7, 0xe6, 0x85, 0x89, 0x3f, 0xb4, 0xd4, 0x5b, 0x46, 0x5a, 0xdb, 0x54, 0xaf, 0xa3, 0xdc, 0x2a, 0xf8, 0xbc, 0x10, 0x89, 0xc3, 0xaa, 0xdd, 0x37, 0x2f, 0x84, 0x41, 0x4c, 0x7c, 0xc6, 0x53, 0x29, 0x5c, 0x15, 0xee, 0x6c, 0xb9, 0xe2, 0x7b, 0x69, 0x19, 0xd9, 0xc3, 0xb3, 0x76, 0xae, 0xef, 0xc2, 0x13, 0xc7, 0xab, 0x17, 0xda, 0xf4, 0x25, 0x9e, 0x85, 0x9d, 0xe1, 0x65, 0xe1, 0xee, 0xb0, 0x86, 0x10, 0x8f, 0x90, 0xbb, 0x88, 0x5f, 0x37, 0x37, 0xa0, 0x42, 0xe1, 0xfe, 0xa9, 0xeb, 0x6c, 0x22, 0x04, 0x9b, 0x1a, 0x40, 0xbd, 0xa1, 0xb3, 0x3d, 0xa0, 0xee, 0xd2, 0x24, 0x61, 0x99, 0x22, 0x86, 0xf7, 0x36, 0x45, 0x50, 0x30, 0x86, 0x1d, 0xec, 0x41, 0x96, 0x88, 0xbb, 0x0c, 0x0a, 0xa0, 0x0e, 0x76, 0xee, 0xa5, 0xda, 0x8e, 0x26, 0xcb, 0x5f, 0xaa, 0xcd, 0xca, 0xf6, 0x47, 0x33, 0xed, 0xd7, 0x78, 0x0f, 0x09, 0xef, 0x12, 0x3a, 0x64, 0x42, 0xad, 0x91, 0x5d, 0x18, 0x2a, 0xb0, 0xa9, 0xa8, 0x06, 0x57, 0xcb, 0xa8, 0x57, 0x3b, 0xe8, 0x72, 0xd1, 0x8b, 0x61, 0xe0, 0x93, 0x65, 0x74, 0x7c, 0x44, 0xc3, 0xc9, 0x63, 0x0d, 0x3e, 0x3a, 0xcf, 0xe6, 0x7c, 0x18, 0x29, 0xf7, 0xdd, 0x87, 0x68, 0x8a, 0x20, 0xcf, 0x27, 0xe1, 0xcd, 0xb5, 0x59, 0x80, 0x9e, 0x3e, 0x2a, 0xd0, 0x65, 0xf7, 0x71, 0x8d, 0x41, 0x82, 0x7c, 0x61, 0x46, 0xa8, 0x12, 0x4b, 0xb5, 0xba, 0xa8, 0xb1, 0xe5, 0x50, 0xd8, 0xe0, 0x65, 0x16, 0x8c, 0x84, 0xf5, 0xc5, 0x91, 0x56, 0x0c, 0x1a, 0xf1, 0xd9, 0xcc, 0x88, 0xfb, 0x59, 0x14, 0x3a, 0xf8, 0x0f, 0x46, 0x1a, 0xe6, 0x50, 0x7c, 0x18, 0xb6, 0xca, 0xc7, 0x47, 0xb2, 0x0d, 0x72, 0x91, 0x2a, 0xd5, 0x6d, 0xa3, 0x3e, 0x9e, 0x8a, 0x92, 0xb7, 0xe3, 0x32, 0xba, 0x3f, 0x07, 0xdd, 0x62, 0xf6, 0xb3, 0x39, 0xb3, 0x08, 0xc7, 0x31, 0xec, 0x5d, 0xf1, 0xec, 0xe0, 0xa8, 0x28, 0x19, 0xc6, 0x8c, 0x9e, 0xe6, 0x58, 0x66, 0xbe, 0xa2, 0xd7, 0x23, 0x71, 0x28, 0x7b, 0x9f, 0x7e, 0xe5, 0x5f, 0xe5, 0x05, 0xf6, 0x0d, 0x81, 0xd0, 0xde, 0x7a, 0xf7, 0x05, 0x02, 0xd3, 0xbc, 0x62, 0xba, 0xab, 0x6f, 0x09, 0xc4, 0x7e, 0x70, 0xe5, 0x3c, 0xbf, 0xea, 0x72, 0x1e, 0xa2, 0x77, 0xe8, 0x7d, 0x21, 0x51, 0xcb, 0xe1, 0x1b, 0xce, 0x08, 0xc8, 0x24, 0x41, 0x9f, 0xdf, 0x8f, 0x12, 0xfe, 0xee, 0x5b, 0x76, 0x1c, 0x7d, 0xbe, 0x67, 0xaf, 0x2f, 0xb7, 0x60, 0xd1, 0x2c, 0xca, 0xb8, 0x34, 0xcb, 0x2c, 0xd8, 0xcf, 0x82, 0xc9, 0xf2, 0x13, 0x60, 0x73, 0xba, 0xec, 0xab, 0x54, 0xba, 0x43, 0x06, 0x72, 0x11, 0x93, 0x8b, 0x17, 0x2c, 0xd3, 0x10, 0xda, 0xb8, 0xaa, 0x06, 0xbd, 0x51, 0x56, 0x2a, 0xe0, 0x11, 0x6b, 0x18, 0xf9, 0x36, 0xa9, 0x67, 0x74, 0x96, 0xd1, 0xae, 0x6a, 0xa2, 0xc5, 0x65, 0x69, 0x19, 0xc2, 0x70, 0x64, 0xb7, 0x37, 0xa1, 0xac, 0xb1, 0x56, 0xb0, 0xec, 0x43, 0x67, 0x50, 0xb6, 0x44, 0xa6, 0x3b, 0x3d, 0xc9, 0x06, 0x4b, 0x25, 0xce, 0x35, 0xe4, 0x61, 0x34, 0x1e, 0x6e, 0xe8, 0x68, 0x85, 0x6a, 0xa1, 0x12, 0x31, 0x3f, 0xac, 0xae, 0x22, 0xbb, 0x39, 0x12, 0xe3, 0x32, 0x59, 0x73, 0x27, 0x08, 0xfb, 0xdc, 0xa1, 0x7f, 0xf5, 0x8a, 0x98, 0x38, 0xbf, 0x83, 0xc2, 0x97, 0xf7, 0x40, 0x02, 0x8e, 0x60, 0xed, 0x0b, 0x47, 0x80, 0xe1, 0xbd, 0xd2, 0x6c, 0x94, 0xfb, 0xd7, 0xab, 0xad, 0xc6, 0xae, 0x4c, 0xf0, 0xc8, 0xd6, 0x5a, 0x0d, 0xea, 0xbe, 0xc1, 0x1e, 0xb6, 0x1a, 0x92, 0x3f, 0x34, 0xd8, 0xa3, 0x56, 0xc3, 0x5c, 0x21, 0x0d, 0xf6, 0xb8, 0xd5, 0xd8, 0x8c, 0x31, 0x9c, 0x4c, 0xc6, 0x3b, 0x84, 0x8d, 0x29, 0x4b, 0x44, 0x53, 0xbf, 0x7b, 0xd4, 0xf9, 0xc3, 0xc3, 0xde, 0x0f, 0xd4, 0xd4, 0xef, 0x7a, 0x4f, 0xfe, 0xc8, 0x57, 0x3b, 0xd4, 0xd8, 0xef, 0xd6, 0x56, 0x3b, 0x7f, 0xfc, 0xc3, 0x1a, 0x35, 0xf6, 0x3b, 0xde, 0x7b, 0x0c, 0xff, 0xa3, 0x76, 0x7e, 0xf7, 0x43, 0xe7, 0xf7, 0x0f, 0xff, 0xb0, 0xda, 0x30, 0x92, 0xe4, 0x6d, 0x47, 0xb7, 0x1a, 0x1f, 0xa5, 0x6f, 0x9a, 0x34, 0x3f, 0x92, 0x29, 0x32, 0x63, 0x61, 0xf9, 0xa5, 0x5f, 0xb1, 0x2a, 0x86, 0xe2, 0xbd, 0x4e, 0xf3, 0x3a, 0xc7, 0xae, 0x88, 0x2a, 0xd9, 0x08, 0xfd, 0x61, 0xf4, 0x85, 0x55, 0xa2, 0xe0, 0x48, 0xd9, 0x1b, 0x73, 0xf7, 0x88, 0xec, 0x8c, 0x37, 0x37, 0xe5, 0xbd, 0x34, 0xc3, 0x4a, 0x6b, 0xb8, 0x62, 0xf2, 0xe7, 0x66, 0x93, 0xc3, 0x9a, 0x26, 0x87, 0xaa, 0xc9, 0xc8, 0x3d, 0xc2, 0x5b, 0xe7, 0xc8, 0x6c, 0x39, 0xf2, 0x00, 0xd2, 0x91, 0x99, 0xeb, 0x8c, 0x76, 0xd8, 0xf6, 0x48, 0xf9, 0x6c, 0xb4, 0x66, 0xec, 0x98, 0x94, 0xbd, 0xa6, 0x34, 0x5f, 0x06, 0xc2, 0x7c, 0xb9, 0xae, 0x64, 0xf8, 0xbe, 0x91, 0xdb, 0xd6, 0x94, 0xe1, 0xfb, 0xec, 0x11, 0x7f, 0xec, 0xad, 0xab, 0x94, 0x2e, 0xb6, 0x04, 0x3f, 0xc2, 0x54, 0x28, 0xe5, 0x05, 0x17, 0x23, 0x43, 0x06, 0x1b, 0xd9, 0x12, 0x17, 0x5a, 0x8d, 0x95, 0xd4, 0x35, 0xe3, 0x0d, 0x32, 0xf2, 0x87, 0x28, 0x2a, 0x0e, 0xfd, 0x91, 0x29, 0x2a, 0x1e, 0xf9, 0x43, 0x53, 0x9e, 0xd5, 0xc7, 0xcd, 0x47, 0xb6, 0x6c, 0x9d, 0xba, 0x43, 0x4b, 0x63, 0x30, 0x64, 0x55, 0x4b, 0xf5, 0x40, 0xe9, 0xb4, 0x13, 0x59, 0x72, 0xde, 0xbc, 0xaa, 0x59, 0x4d, 0xd5, 0xb2, 0x5c, 0xc7, 0x1f, 0x45, 0x64, 0xb2, 0xed, 0xd4, 0x80, 0x67, 0xa9, 0x22, 0xa9, 0x7b, 0x86, 0x37, 0xee, 0x52, 0x5f, 0x9d, 0x8a, 0x8c, 0x39, 0xa7, 0xef, 0x18, 0xfb, 0xba, 0x13, 0x80, 0x8b, 0x1a, 0x00, 0xcc, 0x9e, 0x49, 0xc6, 0x1c, 0x54, 0x34, 0x19, 0x54, 0x8c, 0xea, 0xf0, 0x69, 0xaa, 0x1d, 0x8b, 0xf3, 0xd4, 0x8e, 0x45, 0x1b, 0x84, 0x89, 0x7f, 0x86, 0x20, 0x5c, 0x92, 0xbd, 0x4a, 0x8f, 0x77, 0xd3, 0xbf, 0x34, 0x1f, 0x51, 0x75, 0x32, 0x01, 0xd8, 0x83, 0xcf, 0xe6, 0xf3, 0x96, 0xbf, 0x67, 0xf9, 0x5e, 0xf8, 0x5b, 0xb6, 0x73, 0x8b, 0x6f, 0x6b, 0x55, 0xbb, 0xfe, 0x8e, 0x59, 0x7c, 0xdb, 0xdf, 0xb5, 0x3e, 0x5f, 0xc0, 0x67, 0xf3, 0xf9, 0x4e, 0xc5, 0xe3, 0x62, 0xc6, 0x47, 0xc8, 0x28, 0xfe, 0xae, 0xe2, 0x03, 0x84, 0x3e, 0x42, 0xa6, 0x57, 0x40, 0xc5, 0xa3, 0xe8, 0x3e, 0x2e, 0x42, 0x75, 0xb8, 0x3f, 0x64, 0x2a, 0xef, 0x74, 0x81, 0x52, 0x9d, 0x92, 0x5f, 0x3d, 0xa1, 0x81, 0xc9, 0x4f, 0xa5, 0x3f, 0x1c, 0xf1, 0x4f, 0xfa, 0xba, 0xad, 0xbf, 0x52, 0x24, 0x81, 0x59, 0xf1, 0xa3, 0xfe, 0x04, 0x42, 0xb5, 0x62, 0xc3, 0xf8, 0xe1, 0x1d, 0x7d, 0x30, 0x14, 0x7e, 0x2c, 0x83, 0x6c, 0x01, 0x37, 0xf4, 0x15, 0x59, 0xe1, 0x99, 0x7c, 0xfe, 0x1e, 0x74, 0x10, 0x8f, 0x7d, 0xc2, 0x7a, 0x3f, 0xde, 0x5a, 0x6f, 0x6d, 0xf5, 0xe1, 0x63, 0x8f, 0xe1, 0x05, 0x0f, 0x13, 0x4d, 0xe2, 0x67, 0x1e, 0xd1, 0xfe, 0x2c, 0x5d, 0x55, 0xcc, 0xd7, 0x36, 0x81, 0xb5, 0x17, 0x6d, 0xbd, 0x76, 0xe2, 0x5f, 0x59, 0x7e, 0x26, 0x13, 0xa6, 0x9a, 0x90, 0xf7, 0xed, 0xad, 0xad, 0xe2, 0xf0, 0x41, 0x61, 0xa0, 0xf4, 0x81, 0x68, 0xa4, 0xbc, 0xf4, 0x37, 0xca, 0xfa, 0x9b, 0xfe, 0x04, 0x89, 0xb4, 0x46, 0x83, 0x37, 0x5d, 0x8b, 0x2a, 0x54, 0xf6, 0xaa, 0x5e, 0xc1, 0x4f, 0xdd, 0x2d, 0xea, 0xfd, 0x32, 0x3f, 0xb9, 0x6c, 0xa2, 0xfe, 0x7c, 0x8a, 0x43, 0x3c, 0x34, 0x86, 0xb8, 0x23, 0x87, 0x78, 0x29, 0x66, 0x64, 0x1b, 0x30, 0x55, 0x6c, 0x58, 0x43, 0xdc, 0xb1, 0xd7, 0xd0, 0xae, 0x7f, 0x64, 0x0c, 0x6f, 0xd7, 0x66, 0x1c, 0xbb, 0xac, 0xda, 0x96, 0xe4, 0x1b, 0xbb, 0x33, 0x7c, 0x44, 0x10, 0x4a, 0xcf, 0xbd, 0x24, 0xd5, 0x13, 0x36, 0x84, 0xe1, 0x88, 0xce, 0xca, 0x77, 0x74, 0x3f, 0x1f, 0x30, 0x9b, 0x72, 0x9f, 0xe6, 0x6e, 0x99, 0xcc, 0x9c, 0xe8, 0xde, 0x97, 0xe8, 0x91, 0x4c, 0x1f, 0xae, 0x7e, 0x80, 0xe5, 0x74, 0x57, 0xa9, 0x0f, 0x0a, 0xd4, 0x9d, 0x26, 0xf7, 0xf7, 0x38, 0xa8, 0xbc, 0xbb, 0x0c, 0x7e, 0x7a, 0xf0, 0x4f, 0x81, 0xcf, 0x7b, 0x6c, 0x1b, 0x7f, 0xc2, 0xf3, 0x94, 0x5d, 0x73, 0x99, 0xad, 0x85, 0x15, 0x3a, 0x6d, 0x21, 0xdb, 0xa4, 0x63, 0x7a, 0x93, 0x4e, 0xd4, 0x10, 0xc6, 0x34, 0x04, 0x99, 0xb5, 0x0a, 0x44, 0x15, 0x14, 0xf2, 0xdd, 0xcb, 0x5c, 0xcc, 0xa9, 0x7b, 0xb2, 0xc8, 0x26, 0xa7, 0x9e, 0x39, 0xb3, 0x97, 0xfe, 0x65, 0x44, 0x27, 0x58, 0xb7, 0xf1, 0x1b, 0x73, 0x95, 0x4d, 0x10, 0x21, 0x7b, 0xfe, 0x06, 0x81, 0x3d, 0x6f, 0xa0, 0xda, 0x31, 0x62, 0xd1, 0x83, 0xd1, 0x82, 0xfa, 0x0e, 0x0c, 0x4e, 0x82, 0x5c, 0xe5, 0xde, 0x23, 0x9d, 0x8e, 0xe1, 0x40, 0x4b, 0xa6, 0x28, 0x89, 0x9e, 0xab, 0x1c, 0x0c, 0x5f, 0x9c, 0x70, 0x01, 0x24, 0xb8, 0xe3, 0x7a, 0xd5, 0x98, 0xc4, 0x04, 0x95, 0xba, 0x45, 0x58, 0x05, 0xcc, 0xe3, 0x5c, 0x4b, 0x9c, 0xc3, 0xb2, 0xd5, 0x67, 0x21, 0xbe, 0x6f, 0x1c, 0xc8, 0xd8, 0xbb, 0x6d, 0x11, 0x2b, 0x61, 0xea, 0x2e, 0x1b, 0xce, 0x1c, 0xed, 0xe0, 0x96, 0xe6, 0x64, 0xb2, 0x86, 0x37, 0x23, 0x24, 0xba, 0xbb, 0xb5, 0x01, 0x8a, 0x3a, 0x31, 0xbc, 0x1d, 0x6a, 0x3a, 0x5a, 0x0e, 0x79, 0xde, 0x05, 0xe5, 0x02, 0xe4, 0x19, 0xe7, 0xd5, 0xf1, 0x81, 0x83, 0x72, 0x99, 0x05, 0xd7, 0x4c, 0x27, 0x64, 0x33, 0x51, 0xf9, 0x6a, 0x8a, 0xe5, 0x3f, 0x58, 0xa7, 0xdc, 0x64, 0x14, 0x01, 0xed, 0xab, 0xde, 0xa5, 0xc3, 0xb4, 0xa3, 0x3c, 0x34, 0xdf, 0x89, 0xd1, 0xed, 0x63, 0xec, 0xd9, 0x6e, 0x42, 0xc9, 0x19, 0x45, 0xb8, 0xa8, 0x8a, 0x01, 0xae, 0xe4, 0xe5, 0xd1, 0x6e, 0x1a, 0x8f, 0x4b, 0xc3, 0xc1, 0x2d, 0x41, 0xbf, 0xfb, 0x41, 0x94, 0x74, 0x52, 0x04, 0x1b, 0xa3, 0x96, 0x28, 0xd2, 0x77, 0xc3, 0x08, 0xf7, 0x9b, 0x57, 0x6d, 0x5b, 0x64, 0x46, 0xc2, 0xdc, 0x89, 0x32, 0xf4, 0xfc, 0x0b, 0x2a, 0x8b, 0x44, 0x03, 0x22, 0x0f, 0xcd, 0x97, 0xf7, 0x29, 0xb2, 0x32, 0x7c, 0x41, 0x3d, 0x32, 0x4f, 0x7c, 0x71, 0xad, 0x83, 0x2c, 0xed, 0x8b, 0xbc, 0x1c, 0x5f, 0x0c, 0xe0, 0x71, 0xd4, 0x3d, 0xcf, 0xbf, 0x18, 0xc0, 0x2f, 0xad, 0x25, 0xb1, 0x38, 0xe2, 0xb8, 0x70, 0x66, 0x6a, 0xdd, 0x4a, 0xa6, 0x44, 0x9a, 0x4a, 0x61, 0xfd, 0xa1, 0x31, 0x13, 0x94, 0xfe, 0xd0, 0x4a, 0x33, 0x45, 0xaf, 0x4a, 0xd7, 0xa1, 0x1f, 0xd0, 0x45, 0xe7, 0x9f, 0xfe, 0x9d, 0xf3, 0x82, 0x92, 0xb7, 0x51, 0xa8, 0x37, 0x6e, 0xd1, 0x33, 0x04, 0x59, 0x31, 0x44, 0xad, 0x39, 0x71, 0xbf, 0x65, 0xda, 0xa5, 0x90, 0x46, 0x7f, 0xa8, 0xcb, 0xf7, 0xf4, 0x65, 0x15, 0xab, 0xd5, 0x71, 0x6c, 0x5f, 0x3c, 0xa0, 0xbf, 0xfe, 0xcb, 0xff, 0xf2, 0xff, 0xfc, 0xe7, 0x7f, 0x74, 0xd4, 0x04, 0x1e, 0x4d, 0x72, 0x90, 0x5e, 0x6a, 0xe2, 0xed, 0x6b, 0x96, 0xb9, 0xb9, 0xc2, 0xef, 0x5c, 0xd9, 0xb7, 0x8d, 0xd2, 0xb2, 0xd3, 0x3d, 0xb4, 0x07, 0xfd, 0x48, 0xae, 0xe8, 0x3a, 0x8b, 0x9d, 0x9a, 0xc7, 0x87, 0xa6, 0x01, 0xb6, 0x32, 0x58, 0xbc, 0x42, 0x34, 0x00, 0xbd, 0x18, 0x67, 0xee, 0x3f, 0x38, 0xaf, 0x44, 0xc8, 0x96, 0xf6, 0xf0, 0x9a, 0x35, 0x0c, 0x28, 0x93, 0xe6, 0x06, 0xc5, 0xfa, 0x61, 0x44, 0x63, 0x4b, 0x19, 0x09, 0x46, 0x35, 0xd9, 0xc3, 0xaa, 0xd4, 0x3a, 0xb7, 0x39, 0x99, 0x6e, 0x62, 0xf7, 0xe0, 0xdb, 0x34, 0xb7, 0x79, 0xe0, 0xec, 0x63, 0xa4, 0xc1, 0x3d, 0x1b, 0x9b, 0xe1, 0xf1, 0x5f, 0x82, 0xb9, 0xbf, 0xfe, 0xe3, 0xff, 0x89, 0x24, 0x22, 0xe3, 0x17, 0xf2, 0xfb, 0x20, 0x6f, 0x5f, 0x25, 0xa8, 0x11, 0x39, 0x74, 0x6e, 0x05, 0x73, 0x98, 0x5b, 0x31, 0xc5, 0xf7, 0x18, 0xbc, 0x91, 0xa2, 0xe6, 0x1b, 0xb7, 0x6c, 0xa4, 0x83, 0xf9, 0xe2, 0x96, 0x7f, 0x13, 0x8e, 0xff, 0xf6, 0x97, 0x3f, 0xff, 0x27, 0x95, 0x70, 0x68, 0x49, 0xd8, 0x66, 0xee, 0x83, 0xe7, 0x4a, 0x76, 0x96, 0x6f, 0x43, 0x5b, 0x12, 0x0c, 0x99, 0xa7, 0xe4, 0xdb, 0xb4, 0x39, 0x1b, 0x00, 0xff, 0x8d, 0x67, 0x0e, 0xed, 0x5c, 0x56, 0x18, 0xf9, 0x4c, 0xfb, 0x0d, 0xa3, 0x83, 0x92, 0x25, 0x36, 0xe6, 0x6d, 0x1d, 0xd5, 0xb3, 0x8a, 0xf9, 0x1e, 0x94, 0xbf, 0x5f, 0x35, 0xf9, 0xaa, 0x11, 0x6a, 0x1d, 0x50, 0xd0, 0x7c, 0x0f, 0xf6, 0xd2, 0x81, 0xf6, 0xa4, 0xc4, 0x20, 0x75, 0xe1, 0x28, 0x79, 0x8f, 0xed, 0xea, 0xab, 0x38, 0xfa, 0xdf, 0xfe, 0xf2, 0x9f, 0xfe, 0x0f, 0xe7, 0x18, 0x94, 0x0f, 0x21, 0x9a, 0x7c, 0x23, 0xfe, 0xad, 0x49, 0xd8, 0x90, 0xcc, 0xb0, 0x13, 0x89, 0xf4, 0x1d, 0x69, 0x03, 0xb4, 0x53, 0xa6, 0x68, 0xd1, 0x4c, 0xe4, 0x23, 0xa3, 0xf2, 0x94, 0x7f, 0x83, 0xea, 0x28, 0xbb, 0x61, 0x10, 0x47, 0xc5, 0x44, 0x67, 0x91, 0x18, 0x06, 0x89, 0xc8, 0xd9, 0x01, 0x7b, 0xec, 0x68, 0x44, 0x69, 0xaf, 0x64, 0x22, 0x87, 0xa6, 0xf3, 0x26, 0xe7, 0x22, 0xef, 0x47, 0x0e, 0x2f, 0xea, 0x32, 0x15, 0x60, 0x54, 0xb2, 0x08, 0xe7, 0x8f, 0xd3, 0x7e, 0xd4, 0x75, 0x02, 0x51, 0x5c, 0xe4, 0x01, 0x29, 0x33, 0x42, 0x88, 0xb4, 0x59, 0x22, 0xb9, 0x43, 0x9d, 0x9f, 0xaf, 0x2d, 0x40, 0xd6, 0xfb, 0xe1, 0x1a, 0xc7, 0x19, 0xb7, 0x3b, 0xec, 0xea, 0xd3, 0x06, 0xdb, 0x45, 0xf7, 0x4b, 0xe8, 0xab, 0x41, 0x22, 0x8e, 0xf4, 0x00, 0x2d, 0xb1, 0x6e, 0x78, 0x85, 0x3e, 0xa3, 0xcb, 0xdf, 0x10, 0x6b, 0x1c, 0x7d, 0x70, 0xe7, 0x67, 0x01, 0x19, 0xcd, 0x34, 0x55, 0xf2, 0x6a, 0x40, 0xb8, 0xd1, 0xe4, 0x51, 0x34, 0x1c, 0xc7, 0xe4, 0xe1, 0x5b, 0xe2, 0x0d, 0xa7, 0x04, 0x48, 0x79, 0x98, 0x52, 0x84, 0x1a, 0xa6, 0x8b, 0x00, 0x7a, 0x96, 0xbe, 0xbd, 0xcc, 0x81, 0x75, 0xd7, 0xef, 0xf3, 0x8c, 0x32, 0xb7, 0xa8, 0x44, 0x29, 0x12, 0x14, 0x9a, 0x0e, 0xd0, 0xab, 0x9e, 0xcf, 0x1c, 0x1e, 0xcc, 0x57, 0x6b, 0x76, 0x54, 0xb7, 0x47, 0xa2, 0x5b, 0x53, 0x49, 0x02, 0xfd, 0x6e, 0xf3, 0x6b, 0x9a, 0x52, 0x59, 0xac, 0xac, 0x96, 0xb6, 0xf3, 0xaf, 0x4b, 0xc5, 0x70, 0x90, 0xcf, 0x9c, 0x09, 0xdc, 0xa5, 0x5e, 0xe2, 0x02, 0xd3, 0x46, 0xfc, 0xbd, 0x48, 0x18, 0xf1, 0xc3, 0x98, 0x93, 0xd9, 0xfd, 0x45, 0x8a, 0x69, 0x7a, 0xc8, 0xea, 0xfe, 0x2c, 0x13, 0xc4, 0x4f, 0x66, 0xf7, 0xe7, 0x57, 0xa3, 0x34, 0xa7, 0x87, 0xc7, 0xad, 0xc6, 0x5e, 0xd4, 0xa3, 0xab, 0x0f, 0xd9, 0x93, 0x56, 0xe3, 0x40, 0xe4, 0x64, 0x6a, 0xb0, 0x1f, 0xc4, 0x6f, 0x34, 0xf1, 0xff, 0x1e, 0xf3, 0x5c, 0xaa, 0xca, 0x7f, 0x90, 0x0f, 0xf8, 0xe1, 0x8f, 0xad, 0xc6, 0xb6, 0x4c, 0xeb, 0x04, 0xbd, 0x41, 0xbf, 0x80, 0x14, 0xee, 0x6c, 0xa3, 0xa3, 0x3f, 0x95, 0x5d, 0x83, 0x9e, 0x94, 0x4a, 0x03, 0x4f, 0xd0, 0xbc, 0x8c, 0x34, 0x6c, 0x39, 0x6b, 0x4f, 0xe0, 0x05, 0xf4, 0xf1, 0x82, 0x07, 0xf2, 0xeb, 0x1f, 0xcc, 0xaf, 0x7f, 0x80, 0x17, 0x7f, 0x34, 0x5f, 0xfc, 0x11, 0xc6, 0x00, 0x1d, 0x6c, 0x01, 0xa9, 0x90, 0x77, 0xa5, 0x18, 0xd5, 0x9a, 0x51, 0xe4, 0xe1, 0x9a, 0x79, 0x70, 0x70, 0x9e, 0x57, 0xc3, 0xe6, 0xe9, 0x74, 0x40, 0x86, 0xcd, 0x53, 0x7c, 0x7b, 0x4d, 0xd8, 0x3c, 0xbd, 0x97, 0x51, 0xf3, 0xf4, 0x5e, 0x06, 0xcd, 0x5f, 0x4b, 0x32, 0xc5, 0x18, 0x62, 0x45, 0xba, 0x72, 0x7f, 0xd4, 0x51, 0xc5, 0xad, 0xeb, 0xa1, 0x52, 0xff, 0x40, 0xc2, 0x6b, 0x34, 0x18, 0x2d, 0x10, 0xa1, 0x98, 0xb5, 0x56, 0x59, 0x94, 0x2b, 0x4c, 0x60, 0x15, 0x99, 0x0c, 0x57, 0x08, 0x1c, 0xab, 0x8c, 0xcc, 0x83, 0xea, 0x61, 0x24, 0x95, 0x25, 0xf8, 0x29, 0x8b, 0x91, 0x36, 0xa3, 0x8a, 0xa9, 0x07, 0x6a, 0x8e, 0x34, 0x96, 0x83, 0x6e, 0x41, 0x1d, 0xbc, 0xe3, 0x9d, 0x3c, 0xed, 0x9e, 0x93, 0x8f, 0xa8, 0x30, 0x02, 0xe0, 0xd5, 0xb5, 0x6c, 0x4c, 0x4a, 0x7c, 0xeb, 0x5a, 0x6e, 0x12, 0x50, 0x54, 0x28, 0xbe, 0xf8, 0xbd, 0xf1, 0x2a, 0x95, 0xc9, 0xe0, 0xf0, 0xe0, 0x66, 0x5a, 0x66, 0x06, 0x10, 0x61, 0xb9, 0x30, 0x0a, 0x1d, 0x92, 0x0b, 0xbf, 0x55, 0x08, 0xed, 0x6a, 0x6d, 0x08, 0xee, 0x6a, 0x6d, 0xb8, 0xed, 0xea, 0x4c, 0x68, 0x2d, 0x62, 0x4c, 0xc5, 0xa9, 0xaf, 0xdd, 0x11, 0x44, 0xbb, 0x5a, 0x13, 0x26, 0xbb, 0x6a, 0x44, 0x74, 0xa3, 0x8b, 0x91, 0x71, 0xc6, 0x23, 0x16, 0xc1, 0x62, 0x8d, 0xd7, 0x38, 0xa6, 0x58, 0x45, 0x0e, 0x7d, 0xa6, 0xf2, 0xba, 0x6a, 0xdf, 0xf1, 0x91, 0xbb, 0xe8, 0xb1, 0x82, 0xce, 0x4b, 0x58, 0xa7, 0xd6, 0x0b, 0x7d, 0x7c, 0x67, 0xb6, 0x82, 0xb1, 0x71, 0xb2, 0x23, 0x7b, 0x77, 0xc6, 0xaa, 0x83, 0x23, 0xe8, 0x40, 0x9d, 0xec, 0x8c, 0xef, 0x74, 0x48, 0x37, 0x62, 0x6b, 0xc7, 0xe8, 0x80, 0x7e, 0x56, 0x01, 0x29, 0x21, 0x42, 0x8e, 0x8d, 0xb0, 0xf7, 0x2a, 0x78, 0xc0, 0x38, 0x0b, 0x81, 0xb2, 0x6a, 0xb4, 0xb8, 0x0c, 0xf5, 0x1e, 0xdf, 0x15, 0xea, 0x8d, 0x39, 0x4f, 0xb0, 0x15, 0xc1, 0x69, 0xd1, 0x7e, 0x36, 0x36, 0x82, 0xbd, 0xc7, 0xb7, 0x05, 0x7b, 0x1f, 0xeb, 0x6a, 0x7a, 0xaf, 0xc8, 0x89, 0xcf, 0x1b, 0x51, 0xdf, 0x3a, 0xa7, 0x00, 0x60, 0x23, 0xd6, 0x21, 0xca, 0x32, 0x41, 0x57, 0xb5, 0xdf, 0xaf, 0x8b, 0x52, 0xae, 0x8c, 0x80, 0x70, 0xa9, 0xce, 0xc6, 0x12, 0xe9, 0xda, 0x3f, 0xa8, 0x60, 0x36, 0x23, 0xcc, 0xf6, 0xef, 0xc2, 0xac, 0xca, 0x94, 0x79, 0x86, 0x3c, 0xe1, 0x2b, 0x31, 0x2c, 0xb7, 0x35, 0x01, 0x62, 0x99, 0x7a, 0x13, 0x77, 0xcb, 0x2f, 0x46, 0xb6, 0x55, 0x5d, 0xb5, 0x5c, 0x89, 0xb3, 0x77, 0x96, 0x45, 0xd2, 0x95, 0x5c, 0x6e, 0xc0, 0x7a, 0xdb, 0xd5, 0xfb, 0xb0, 0xbd, 0xf1, 0x9a, 0x33, 0xd4, 0x57, 0x33, 0x64, 0xec, 0xc5, 0xf3, 0xe0, 0xfe, 0xaa, 0xc9, 0xba, 0x05, 0x19, 0xd6, 0xbc, 0x65, 0xf2, 0x4c, 0xb3, 0x74, 0x4f, 0x34, 0xe6, 0x8f, 0xe6, 0x4e, 0xcc, 0xd6, 0x41, 0x06, 0x9b, 0x5e, 0xce, 0x9b, 0x78, 0x11, 0xc8, 0x49, 0x17, 0x1d, 0x0c, 0x5d, 0xef, 0xb4, 0x9c, 0x52, 0xf3, 0xf8, 0xb3, 0xcb, 0x1e, 0x3e, 0xc1, 0x83, 0x90, 0x45, 0xeb, 0x6d, 0x87, 0xad, 0xcd, 0x3f, 0x14, 0x1d, 0xc3, 0x48, 0xac, 0x17, 0x8b, 0x74, 0x4a, 0x6a, 0x1c, 0x15, 0x8c, 0xfd, 0x03, 0xeb, 0x60, 0x63, 0x5c, 0x7b, 0x02, 0xc7, 0x67, 0x4e, 0xe0, 0xda, 0xe7, 0xd5, 0x03, 0x92, 0xe3, 0xfb, 0x9d, 0xc2, 0xdd, 0xe2, 0xc0, 0xb8, 0x57, 0x3d, 0x36, 0xdc, 0xaa, 0x9c, 0xda, 0xe1, 0xb1, 0x9c, 0x51, 0x1f, 0xbd, 0x0c, 0xed, 0x53, 0x39, 0xfb, 0x50, 0x0f, 0x8f, 0xe5, 0xcc, 0xf0, 0x73, 0x7f, 0xdb, 0x8a, 0xc9, 0xad, 0x9c, 0xba, 0xd5, 0x04, 0xee, 0x1b, 0x8f, 0xb3, 0x71, 0xfb, 0x1f, 0x6f, 0x3f, 0x94, 0xfb, 0x54, 0x39, 0x94, 0xb3, 0xe3, 0xfa, 0xf1, 0x54, 0xce, 0x28, 0x5e, 0x17, 0xb7, 0x6f, 0x1f, 0xdb, 0x89, 0xb8, 0x7d, 0xa3, 0x4a, 0x87, 0xfb, 0x76, 0xe4, 0x3e, 0x06, 0xe9, 0xdb, 0xa1, 0xfd, 0x32, 0x4a, 0xdf, 0xc4, 0x58, 0x5d, 0x90, 0x7e, 0x25, 0x90, 0x5f, 0x44, 0xe9, 0x9b, 0x99, 0xcb, 0xb9, 0x7f, 0x31, 0x13, 0x91, 0x6f, 0x07, 0xf2, 0xcb, 0x90, 0x7c, 0xf3, 0x8c, 0xb3, 0x2e, 0x22, 0xbf, 0x12, 0xb5, 0x2f, 0x42, 0xf2, 0x8d, 0x4a, 0x6f, 0xb8, 0x9f, 0xcd, 0x84, 0xdf, 0xdb, 0x51, 0xfb, 0x32, 0xfe, 0xde, 0xa8, 0x24, 0xc2, 0xef, 0x2d, 0x37, 0x5b, 0x5e, 0x39, 0x8f, 0xbd, 0x77, 0xf8, 0xbd, 0x45, 0x6c, 0x73, 0xe2, 0xef, 0xcd, 0x93, 0xd9, 0xfb, 0x86, 0xdf, 0x9b, 0xe7, 0x69, 0x14, 0x7d, 0x6f, 0xbc, 0xb8, 0x3b, 0xf8, 0x9e, 0x6d, 0x73, 0xbf, 0x6b, 0x15, 0x79, 0x5b, 0x8d, 0xa2, 0xc7, 0x48, 0xfb, 0xee, 0x4c, 0xa4, 0x7d, 0x68, 0x63, 0xd7, 0x7f, 0x61, 0x97, 0xf8, 0x15, 0x0b, 0x98, 0x2f, 0xea, 0xc3, 0xd6, 0xad, 0x83, 0x7b, 0x8e, 0xc0, 0x56, 0xe2, 0xd6, 0xc7, 0x56, 0x37, 0x22, 0x6c, 0xdd, 0x4a, 0x62, 0x41, 0x71, 0xeb, 0x46, 0x11, 0xce, 0xfd, 0xcf, 0x76, 0x91, 0x5f, 0xb8, 0xcf, 0xad, 0x22, 0x51, 0xe1, 0xff, 0x62, 0xc7, 0xba, 0x47, 0xc5, 0x4c, 0x06, 0x82, 0xe3, 0x6a, 0x40, 0x3c, 0x8b, 0x0b, 0xff, 0xd8, 0x6a, 0xe7, 0x27, 0xee, 0xc7, 0x36, 0x32, 0x9f, 0x73, 0xff, 0x27, 0xab, 0xc8, 0x7b, 0xee, 0x3f, 0xb7, 0xbb, 0x7a, 0x5f, 0x93, 0x12, 0x83, 0x1a, 0xb6, 0x56, 0x4e, 0xe1, 0x77, 0x0a, 0x8b, 0xd9, 0xc1, 0xaa, 0xb0, 0xbb, 0xba, 0x28, 0xfc, 0x4d, 0xab, 0xab, 0x1f, 0x61, 0x29, 0xd9, 0xc3, 0xf8, 0x71, 0xb6, 0xab, 0xb3, 0x02, 0x31, 0x6a, 0xf9, 0x0f, 0x14, 0xfe, 0x99, 0xd5, 0xd5, 0x62, 0xe1, 0x9f, 0xdb, 0x5d, 0x1d, 0x17, 0xfe, 0xa2, 0x55, 0xe4, 0x0a, 0x00, 0xb6, 0x8b, 0x64, 0x54, 0xc4, 0x7c, 0x33, 0x29, 0xfc, 0xcc, 0xaa, 0x14, 0x14, 0xfe, 0xc4, 0x2e, 0xf2, 0x33, 0xc7, 0x22, 0xd6, 0x1b, 0xff, 0x67, 0x6b, 0x4c, 0xbf, 0x72, 0xff, 0x67, 0xdb, 0x45, 0xba, 0xf0, 0x7f, 0xb5, 0x09, 0x1a, 0x28, 0xbc, 0x92, 0x4d, 0x62, 0x76, 0x2e, 0x8f, 0x0a, 0x6c, 0xd7, 0x22, 0xe0, 0xc2, 0x3f, 0xb2, 0xa0, 0xfb, 0x54, 0xf8, 0x2f, 0x6c, 0x58, 0x3e, 0x17, 0xd5, 0x8c, 0x18, 0xbf, 0x14, 0xfe, 0x67, 0xab, 0xd2, 0x4f, 0x40, 0x48, 0x15, 0x02, 0x28, 0xfc, 0x9f, 0xac, 0x22, 0xef, 0x0b, 0xff, 0xb9, 0xf5, 0xe2, 0xc7, 0xc2, 0x7f, 0x6f, 0xd7, 0xb9, 0x2c, 0xfc, 0x1f, 0xed, 0x37, 0x61, 0xe1, 0x5f, 0xda, 0xd3, 0x5f, 0xf8, 0x61, 0x51, 0x7f, 0xe8, 0x7b, 0x69, 0x6c, 0xaa, 0x2f, 0xf5, 0xa6, 0xda, 0x73, 0x3d, 0x99, 0x38, 0xa8, 0x59, 0xa7, 0x0e, 0x99, 0x1b, 0xee, 0x4b, 0x3c, 0xae, 0x3f, 0x29, 0x1b, 0xf9, 0xc9, 0x7f, 0x8e, 0xbb, 0x2d, 0x87, 0x91, 0x98, 0x20, 0xf4, 0x61, 0x15, 0xd5, 0x82, 0xd0, 0xb7, 0x59, 0x90, 0xdb, 0xe7, 0xf2, 0xa0, 0x1e, 0x6f, 0x3a, 0x24, 0xe1, 0xaa, 0xdd, 0xf8, 0x05, 0x24, 0x29, 0x54, 0xb1, 0x1a, 0x96, 0xe7, 0xf9, 0x5e, 0x81, 0x85, 0x3f, 0x18, 0x67, 0xa8, 0x8b, 0xd7, 0x56, 0x35, 0xc3, 0xa3, 0xb4, 0xd5, 0xb0, 0xbc, 0x6d, 0x41, 0x8e, 0xf2, 0xd8, 0x4f, 0x74, 0x52, 0x6d, 0x42, 0xbe, 0xf9, 0xad, 0x20, 0xb7, 0x75, 0xdb, 0x2f, 0x1d, 0x40, 0xb5, 0xf6, 0x7d, 0xc6, 0x71, 0x5a, 0x3a, 0xd9, 0xef, 0x69, 0x30, 0x6e, 0x99, 0xc2, 0x59, 0x98, 0x52, 0x77, 0x87, 0x95, 0xa4, 0xa0, 0xbd, 0xcf, 0x5e, 0x62, 0x52, 0x82, 0xa6, 0xd0, 0x7d, 0x3d, 0x9f, 0x6e, 0x24, 0x54, 0x77, 0x61, 0xbd, 0x6c, 0x6a, 0x05, 0x18, 0xaf, 0xda, 0xb4, 0x54, 0x60, 0x6c, 0xef, 0x75, 0x15, 0x10, 0x43, 0xb1, 0xc7, 0xef, 0x9f, 0x67, 0x01, 0x55, 0xba, 0xbd, 0x01, 0x9e, 0x91, 0x19, 0x63, 0x2f, 0x3a, 0x31, 0x4a, 0x1b, 0x76, 0x01, 0x72, 0x33, 0xe9, 0xf0, 0x6a, 0x7b, 0xa6, 0x75, 0xc0, 0xc8, 0x87, 0x61, 0x94, 0x28, 0x0d, 0x06, 0x74, 0x73, 0xc5, 0xcc, 0x77, 0x65, 0x43, 0x30, 0x92, 0x5f, 0xcc, 0xb6, 0x4f, 0x96, 0x04, 0x2c, 0xf1, 0xa6, 0xbe, 0x7d, 0xfd, 0x3d, 0x98, 0xf9, 0x6e, 0x19, 0x1f, 0xb0, 0xc8, 0x84, 0xb3, 0x17, 0x6e, 0x9e, 0xb3, 0x6b, 0xb2, 0x8e, 0xb5, 0x1a, 0x7f, 0xfb, 0xcb, 0x9f, 0xff, 0x9b, 0xd2, 0x0e, 0xf8, 0x4c, 0x65, 0x9d, 0x6e, 0x30, 0xe5, 0x64, 0x89, 0x37, 0x6c, 0x8c, 0xa2, 0x15, 0x72, 0x6a, 0xe1, 0xa8, 0xd7, 0xaf, 0x28, 0xd1, 0xbf, 0xc1, 0x84, 0xdb, 0x46, 0xe9, 0x27, 0x2a, 0xe2, 0xb5, 0x5a, 0x0d, 0xd5, 0x9e, 0x79, 0x99, 0x46, 0xb5, 0xe3, 0xbf, 0xfe, 0xcb, 0xbf, 0xc7, 0xa3, 0xa5, 0x8a, 0x79, 0xee, 0xb6, 0x7e, 0x33, 0x59, 0x42, 0xf5, 0xaa, 0x3c, 0x55, 0x55, 0xaf, 0x32, 0xa9, 0xfc, 0xec, 0x55, 0x2f, 0xc9, 0xec, 0x98, 0xff, 0xd9, 0xa9, 0x38, 0x62, 0xdc, 0x31, 0xe6, 0xae, 0x51, 0x4a, 0xf5, 0xaf, 0xbc, 0x66, 0x55, 0xff, 0x9a, 0xf6, 0x67, 0xfa, 0xde, 0x8e, 0xca, 0x61, 0xff, 0xe3, 0x7f, 0xc6, 0x61, 0xdb, 0x81, 0x12, 0xb7, 0xf5, 0x2c, 0x6c, 0x2a, 0x81, 0x2e, 0x69, 0xb9, 0xab, 0xde, 0x55, 0x9c, 0x6e, 0xc7, 0xb1, 0x70, 0xf1, 0x56, 0x90, 0xc8, 0x10, 0xf9, 0x98, 0xc8, 0xa8, 0x48, 0xcb, 0x8a, 0x17, 0xb4, 0x0e, 0xde, 0xe8, 0x8f, 0x46, 0x6a, 0x45, 0xb3, 0xc0, 0x79, 0x59, 0x5d, 0x1a, 0x77, 0xda, 0x0d, 0x79, 0x5a, 0x04, 0xab, 0xe9, 0x99, 0x48, 0x18, 0x1f, 0x52, 0x51, 0x5e, 0x16, 0x55, 0xc9, 0xdb, 0x7e, 0xe1, 0xc6, 0x07, 0xd7, 0xf8, 0x32, 0x93, 0x31, 0x25, 0x22, 0x62, 0xfd, 0xa9, 0x6c, 0xa2, 0x2e, 0x6b, 0xdc, 0x73, 0x6e, 0x14, 0x72, 0xe7, 0x94, 0x9a, 0x69, 0xfa, 0x3d, 0xd5, 0xda, 0x34, 0xf0, 0x50, 0x93, 0x66, 0xee, 0xa2, 0x30, 0x0a, 0xb9, 0x73, 0x4a, 0xcd, 0x34, 0xfd, 0x23, 0x35, 0x7d, 0x55, 0xe8, 0xa6, 0x2b, 0x26, 0xb5, 0xb9, 0xb8, 0x0a, 0xca, 0x2a, 0xd2, 0xe4, 0x36, 0xb7, 0xe8, 0xaf, 0xbc, 0xd2, 0xfa, 0xbc, 0xbc, 0x75, 0x69, 0x61, 0x14, 0x77, 0xef, 0x2c, 0x3f, 0x9b, 0xb4, 0x86, 0xea, 0x7f, 0x2a, 0x21, 0x9b, 0xb1, 0xf0, 0xe1, 0xf7, 0xe7, 0x45, 0xed, 0x06, 0x1f, 0xd9, 0x5a, 0xf3, 0x4b, 0xdb, 0xe7, 0xee, 0x27, 0x7f, 0x3b, 0x37, 0x35, 0xef, 0x9f, 0x58, 0x24, 0xb7, 0x19, 0xda, 0x65, 0x2e, 0x8b, 0x5b, 0x5a, 0x0e, 0xbf, 0xb0, 0xe5, 0xb0, 0xda, 0x32, 0x48, 0x2a, 0x2a, 0x24, 0xef, 0x0c, 0xba, 0x09, 0xeb, 0xbb, 0xc9, 0x67, 0xba, 0x69, 0x9f, 0x1c, 0x60, 0x96, 0xca, 0xc6, 0x91, 0x34, 0x80, 0x95, 0x87, 0x31, 0x98, 0x0e, 0xf8, 0xb4, 0xd5, 0xa8, 0x39, 0x13, 0x6b, 0x88, 0x94, 0x38, 0x9b, 0x65, 0x97, 0x03, 0x24, 0xab, 0xfa, 0x2e, 0x83, 0xb9, 0x5d, 0x1e, 0x97, 0x16, 0x1d, 0xeb, 0xc8, 0xc6, 0xec, 0xd8, 0xfa, 0xe0, 0xb8, 0x6b, 0xab, 0xc3, 0x28, 0xf1, 0x64, 0xff, 0xcf, 0x60, 0x97, 0x55, 0xf8, 0x99, 0x15, 0x07, 0x6e, 0xdd, 0xc5, 0x2d, 0x71, 0xa0, 0x65, 0x8a, 0x0a, 0xd3, 0x0f, 0x28, 0xca, 0x20, 0x7c, 0x7d, 0x4a, 0x40, 0xa4, 0x90, 0xfe, 0xd3, 0x82, 0xef, 0xbf, 0x6c, 0xf2, 0xa5, 0x25, 0x10, 0x3f, 0xf6, 0x18, 0xfc, 0xf2, 0x7f, 0x42, 0xa1, 0x87, 0xde, 0x16, 0x78, 0xc5, 0x68, 0xd1, 0x94, 0x17, 0x4b, 0x84, 0xf8, 0x06, 0x84, 0x1f, 0x6c, 0x81, 0x3e, 0x07, 0xf0, 0x79, 0xd3, 0xfa, 0x1c, 0xf8, 0x7d, 0x58, 0x53, 0x2f, 0xeb, 0x5c, 0x19, 0x59, 0x50, 0xfa, 0x34, 0x4e, 0xca, 0xf4, 0x43, 0xe3, 0x39, 0xb1, 0x7e, 0x87, 0x73, 0x22, 0xde, 0x8a, 0xd2, 0xc3, 0x64, 0xfe, 0x01, 0x1c, 0x5e, 0xb2, 0x45, 0x67, 0xba, 0xd5, 0x5b, 0x00, 0xec, 0x13, 0xde, 0x27, 0xea, 0x80, 0x17, 0x2f, 0x6c, 0xda, 0xfd, 0xca, 0x2c, 0xdf, 0x3b, 0xbf, 0xc5, 0x79, 0xf1, 0xf5, 0x6c, 0xee, 0x19, 0x0a, 0xe9, 0x5b, 0xfb, 0x61, 0xb5, 0x1a, 0xd3, 0x47, 0x87, 0xc0, 0x71, 0x80, 0xf9, 0x78, 0x44, 0xc4, 0x0b, 0xe7, 0xc9, 0xf2, 0x63, 0xba, 0x4d, 0xee, 0xb1, 0x8e, 0xc9, 0x11, 0x11, 0x33, 0x69, 0x92, 0x6a, 0x1c, 0xd9, 0x19, 0x71, 0x54, 0x9c, 0x0c, 0x75, 0xfe, 0x71, 0xa6, 0x73, 0xf3, 0x88, 0xda, 0xee, 0x85, 0x30, 0xfb, 0x0a, 0xf3, 0xca, 0x22, 0x66, 0x2f, 0x02, 0x10, 0x03, 0x60, 0xca, 0xa1, 0x91, 0xfd, 0xea, 0xd9, 0xde, 0xe5, 0x20, 0x2a, 0xb8, 0xf0, 0xa8, 0x18, 0x65, 0x9c, 0x4e, 0x66, 0xeb, 0xe2, 0x75, 0xb0, 0xdd, 0x3f, 0xac, 0xae, 0x6e, 0xa8, 0xc3, 0x7f, 0xc7, 0x4c, 0xce, 0xfc, 0x26, 0xba, 0xed, 0x94, 0x89, 0x22, 0x55, 0xea, 0x4e, 0x99, 0x56, 0x45, 0xee, 0x1b, 0x71, 0x4f, 0x36, 0xeb, 0xeb, 0x08, 0x8b, 0x81, 0xb2, 0x44, 0xcb, 0xab, 0xf3, 0x54, 0xb4, 0xc5, 0xa0, 0x3e, 0xbe, 0x55, 0xd8, 0x68, 0x55, 0xe9, 0x01, 0x7c, 0xd7, 0x5f, 0x30, 0xcf, 0x49, 0xdd, 0x51, 0xc6, 0xa0, 0x62, 0xd1, 0xc6, 0x5d, 0x5e, 0xdc, 0x06, 0x47, 0x76, 0xeb, 0xc1, 0x1d, 0x76, 0x6b, 0x71, 0x44, 0x81, 0x15, 0xd0, 0xde, 0x3b, 0x30, 0xec, 0xd4, 0x83, 0xda, 0x8c, 0xcb, 0xca, 0x80, 0x3e, 0x90, 0x67, 0x21, 0x6c, 0x91, 0x2e, 0x71, 0x3e, 0xe2, 0x85, 0x9b, 0x97, 0x3e, 0xdd, 0x97, 0xcd, 0xf1, 0x38, 0xc2, 0xe4, 0x68, 0x13, 0xff, 0xe4, 0x94, 0x42, 0xdd, 0x65, 0x44, 0x12, 0xe6, 0xd4, 0x1f, 0xa3, 0xa9, 0x3b, 0xf7, 0x16, 0xf1, 0x2e, 0x57, 0x57, 0x96, 0xbc, 0xb9, 0x71, 0xc5, 0x9d, 0xb0, 0xee, 0x25, 0x46, 0x5f, 0x07, 0x61, 0xa8, 0xbe, 0x58, 0x19, 0x3a, 0x36, 0x56, 0xd5, 0x99, 0xcc, 0xa5, 0x7f, 0x02, 0x3c, 0x0d, 0x79, 0x0a, 0xfc, 0x99, 0x9c, 0x36, 0xf3, 0x34, 0x2b, 0x5c, 0x77, 0x93, 0x1d, 0x9a, 0x71, 0xc5, 0x9b, 0x86, 0x87, 0x35, 0x66, 0x5a, 0x41, 0xef, 0x24, 0xd7, 0x5b, 0xd6, 0xdf, 0x0f, 0x6b, 0xbf, 0x7b, 0xeb, 0x09, 0x40, 0x31, 0xa5, 0x03, 0x19, 0x79, 0x8c, 0x24, 0x4c, 0xe7, 0x03, 0xe3, 0x70, 0x83, 0xf0, 0x26, 0x96, 0x99, 0x42, 0xdd, 0x57, 0x99, 0xca, 0x0d, 0xfc, 0x37, 0x30, 0x25, 0x4a, 0x21, 0x8f, 0x32, 0x64, 0xfa, 0x99, 0x70, 0x69, 0xc9, 0xb6, 0x4d, 0x87, 0x78, 0xa1, 0xa9, 0x69, 0xda, 0x1e, 0x31, 0x4c, 0xf9, 0xac, 0xd3, 0xce, 0x84, 0x98, 0x4d, 0x61, 0xb6, 0x06, 0x09, 0x75, 0x53, 0xd6, 0x15, 0x85, 0xfa, 0x50, 0xa8, 0xdf, 0x14, 0xd7, 0xf9, 0x1e, 0xa7, 0x23, 0x5f, 0xfd, 0x7e, 0x41, 0x11, 0xd3, 0x74, 0x6a, 0xa6, 0x72, 0xd8, 0xf4, 0x25, 0xc2, 0xaf, 0x75, 0xe9, 0xd6, 0x80, 0x99, 0xa5, 0x5b, 0x63, 0x26, 0xb2, 0x1e, 0xc9, 0xc7, 0xc5, 0xa9, 0xdf, 0x87, 0x69, 0x1f, 0x03, 0x2b, 0x59, 0x7c, 0xfa, 0x64, 0x3d, 0x73, 0x27, 0xe2, 0xcc, 0x8b, 0x1a, 0xec, 0x00, 0x21, 0x2b, 0xee, 0xaf, 0x12, 0x09, 0x50, 0x42, 0x67, 0xdc, 0x9b, 0x8d, 0xf4, 0xb7, 0x5d, 0xb6, 0x8a, 0x16, 0xf8, 0xb9, 0x07, 0x02, 0x23, 0x8c, 0x3e, 0x72, 0x67, 0x32, 0xe6, 0x5e, 0xe3, 0xd9, 0x00, 0x1d, 0xfa, 0x4c, 0x19, 0x86, 0x43, 0x4c, 0xcb, 0xab, 0xad, 0xab, 0x99, 0x0a, 0x06, 0xfe, 0x21, 0xaa, 0xd8, 0xf3, 0x62, 0x6c, 0x06, 0xb5, 0x16, 0xfe, 0xe8, 0x8e, 0x18, 0x9b, 0xdd, 0x4a, 0xf8, 0x43, 0x64, 0xfa, 0xce, 0x8f, 0x3d, 0x36, 0xaf, 0x5d, 0x97, 0xd3, 0xf8, 0xed, 0x58, 0x8b, 0xea, 0x59, 0xc2, 0x4e, 0xf5, 0x2c, 0xe1, 0xb5, 0xd1, 0xdb, 0xa4, 0xee, 0x82, 0x6f, 0x9a, 0xa5, 0x06, 0x06, 0x77, 0x0c, 0x73, 0x5c, 0x95, 0x7d, 0xff, 0x12, 0x1d, 0xeb, 0x29, 0x30, 0xc3, 0x70, 0xcd, 0x17, 0x50, 0xe4, 0x73, 0x23, 0x3d, 0x2e, 0xa1, 0xf3, 0x8f, 0xd8, 0xb9, 0x5a, 0xe0, 0x9b, 0xa6, 0x6b, 0xff, 0xa1, 0xbf, 0x8f, 0x88, 0xac, 0x89, 0xd2, 0x98, 0xc5, 0x6b, 0x35, 0xeb, 0x82, 0xb2, 0x0f, 0x98, 0xeb, 0x94, 0x6d, 0xc9, 0x40, 0x0d, 0xf8, 0xb2, 0xa9, 0xd6, 0x94, 0x54, 0x4a, 0x0e, 0x69, 0xe3, 0x16, 0xbb, 0xb7, 0x85, 0xd8, 0x81, 0x76, 0xef, 0x7f, 0x56, 0xdd, 0x59, 0xb4, 0x1f, 0xef, 0x97, 0x65, 0x01, 0xbc, 0xc3, 0xeb, 0xb7, 0xb1, 0x21, 0x9d, 0x60, 0xc5, 0x05, 0x97, 0xc2, 0x85, 0xaa, 0xde, 0xb5, 0x47, 0xba, 0xef, 0x89, 0xbb, 0x3e, 0xc8, 0xb3, 0x83, 0x6d, 0xdd, 0x3f, 0x10, 0x1f, 0x4a, 0xbf, 0xba, 0x4f, 0x5a, 0x80, 0xaf, 0xcb, 0x08, 0xf0, 0xce, 0x10, 0x75, 0x4a, 0xff, 0xc3, 0xd9, 0xab, 0x74, 0x85, 0x6b, 0xd6, 0xdf, 0xfe, 0xf2, 0x3f, 0xff, 0x47, 0x54, 0x49, 0xe5, 0xd0, 0x6d, 0x77, 0xfb, 0x47, 0x35, 0xee, 0xbb, 0xe8, 0x89, 0x7c, 0xbb, 0xe3, 0xee, 0x6c, 0xda, 0xc6, 0x6f, 0x99, 0x53, 0xe1, 0x6f, 0x7f, 0xf9, 0x4f, 0xff, 0xde, 0xd9, 0xe7, 0xc3, 0x34, 0x9b, 0x54, 0x21, 0x34, 0x1c, 0x2f, 0xef, 0x20, 0x0b, 0x35, 0x13, 0xe4, 0x86, 0xae, 0x1d, 0x06, 0x85, 0xe4, 0xf0, 0x72, 0xcb, 0x0e, 0x0e, 0xbe, 0x67, 0x53, 0x6f, 0x72, 0xc3, 0x65, 0xf2, 0x37, 0xb5, 0xb4, 0x03, 0xd2, 0xcc, 0xfd, 0x5b, 0x2a, 0x7d, 0xfa, 0x48, 0x1a, 0x33, 0x72, 0x0b, 0x8a, 0x0f, 0x83, 0xe5, 0x87, 0xcd, 0x27, 0xf6, 0x94, 0x90, 0xe8, 0x37, 0xe6, 0x28, 0xb9, 0x89, 0xcf, 0xf5, 0x81, 0xc7, 0xf5, 0xb9, 0x24, 0x95, 0xa0, 0x5c, 0xca, 0x7e, 0x6f, 0x28, 0xd6, 0x15, 0x13, 0x13, 0xfe, 0xdd, 0x7d, 0x3c, 0xf1, 0xbf, 0x35, 0x41, 0xfc, 0xf5, 0x5f, 0xfe, 0x83, 0xb3, 0x7d, 0xf0, 0xe6, 0xb7, 0x13, 0x03, 0xe0, 0x1d, 0x6f, 0x40, 0xeb, 0x4e, 0x2a, 0xc8, 0xdf, 0x7f, 0xf1, 0xf9, 0xab, 0xe6, 0x71, 0x3b, 0xcd, 0x0c, 0x6f, 0x54, 0xd9, 0xc0, 0x9c, 0x76, 0x2c, 0x27, 0x40, 0x1d, 0x97, 0x2f, 0xf2, 0x73, 0x8a, 0x5b, 0x61, 0x0e, 0x81, 0x29, 0x2d, 0x23, 0x4b, 0xc5, 0xc1, 0x3a, 0x63, 0xc4, 0xb9, 0xba, 0x12, 0x0d, 0x99, 0x02, 0x5e, 0x63, 0xa5, 0x05, 0x69, 0x74, 0x0c, 0x7e, 0x7e, 0x74, 0xf0, 0xe8, 0xe1, 0xff, 0x17, 0xf3, 0xf1, 0xb7, 0xbf, 0xfc, 0x4f, 0xff, 0xb7, 0xe8, 0xdd, 0xd9, 0x81, 0x52, 0x83, 0xff, 0x7f, 0x95, 0x7e, 0xf5, 0x2a, 0x15, 0x7a, 0xcd, 0xbf, 0xf2, 0x32, 0x9d, 0xc9, 0xcd, 0xb2, 0xfc, 0xa8, 0x2e, 0x53, 0xa9, 0x88, 0x19, 0x2b, 0xf3, 0xc0, 0xe8, 0xe0, 0xab, 0x9a, 0x7c, 0x30, 0x7f, 0xfb, 0xcb, 0x3f, 0xfd, 0x77, 0x62, 0xf2, 0xd1, 0x59, 0x1f, 0xcd, 0xb2, 0x87, 0xbc, 0xc7, 0xe9, 0xc2, 0x35, 0x91, 0x15, 0xa6, 0x86, 0xf2, 0x2b, 0xba, 0x26, 0xc1, 0xfd, 0x7b, 0xa4, 0x46, 0x95, 0x64, 0x42, 0x46, 0x74, 0x19, 0x94, 0x45, 0xae, 0xe2, 0xfb, 0x5b, 0x0e, 0x99, 0xc1, 0xbd, 0x96, 0xe1, 0xdc, 0xf9, 0xd7, 0x3f, 0xff, 0xaf, 0x7f, 0xfd, 0xf3, 0x3f, 0xc0, 0x7f, 0xce, 0x56, 0x9a, 0x16, 0xb8, 0x41, 0xe2, 0xf5, 0xb1, 0x7f, 0xff, 0xe8, 0xe1, 0xcb, 0x2d, 0xaf, 0xb6, 0xd8, 0x41, 0x90, 0x01, 0x19, 0xd3, 0xf5, 0x6c, 0xb4, 0x80, 0xdc, 0xbf, 0x7f, 0x3c, 0xaf, 0xe8, 0x8e, 0xba, 0xdd, 0xf0, 0x81, 0xf3, 0x8e, 0x77, 0xde, 0xec, 0x42, 0x59, 0x00, 0x03, 0x4a, 0x3b, 0x7f, 0xfd, 0x6f, 0xff, 0x07, 0xe7, 0x17, 0xbc, 0xcc, 0x08, 0xb3, 0x78, 0x90, 0x32, 0xd0, 0x4d, 0x43, 0x5e, 0xdb, 0xc8, 0x5e, 0x54, 0xc0, 0xa2, 0xd9, 0x39, 0x42, 0x0b, 0x38, 0xcf, 0xc5, 0xde, 0xeb, 0x56, 0x9b, 0xc1, 0xf0, 0x5e, 0xf4, 0xb0, 0xb1, 0x33, 0x8c, 0x40, 0x2b, 0xff, 0xd6, 0x31, 0x5a, 0x42, 0x15, 0x5a, 0x54, 0xc5, 0x1b, 0x3a, 0x43, 0x6f, 0x6e, 0x49, 0xed, 0x9e, 0xee, 0xfe, 0xfd, 0x5a, 0x75, 0x70, 0x58, 0xee, 0xcf, 0xb2, 0xdc, 0xb1, 0xb6, 0x27, 0x0b, 0x08, 0xe6, 0x36, 0xae, 0x2a, 0xbc, 0xa6, 0x8b, 0x56, 0x47, 0x0a, 0x85, 0xf9, 0x4a, 0x86, 0xf5, 0xe9, 0x16, 0x11, 0x9c, 0xbc, 0xb9, 0x4c, 0xe8, 0xbf, 0x00, 0x2b, 0xfa, 0xa7, 0xff, 0x8b, 0xee, 0xee, 0xfa, 0xed, 0x3c, 0xc8, 0x0a, 0x08, 0x32, 0xa5, 0xb2, 0x19, 0x1b, 0x49, 0x63, 0xe3, 0xab, 0xf8, 0xc9, 0x51, 0xd4, 0x4f, 0x66, 0xb8, 0x5c, 0xb8, 0x25, 0xc8, 0xc2, 0xfb, 0xaa, 0x26, 0x8d, 0x98, 0xa3, 0x7f, 0x0d, 0x88, 0xf7, 0x37, 0xb7, 0xbf, 0xae, 0xfd, 0xff, 0xb2, 0xe2, 0x81, 0x08, 0x62, 0x52, 0x31, 0xb2, 0xf7, 0xa1, 0x03, 0xeb, 0x96, 0x5a, 0x1c, 0x48, 0xe3, 0xfe, 0x5c, 0x56, 0xd9, 0x00, 0x41, 0x10, 0x7f, 0x69, 0xde, 0xd9, 0x7e, 0x0f, 0x41, 0x1c, 0xb6, 0x4d, 0x99, 0x4e, 0xc8, 0xd9, 0xcc, 0xba, 0x68, 0xf7, 0xea, 0x82, 0x86, 0x35, 0x03, 0xf3, 0x2d, 0x18, 0x92, 0x81, 0x20, 0x5f, 0xbd, 0x6b, 0xd7, 0x72, 0x25, 0xc1, 0x6a, 0x85, 0xc4, 0xed, 0xcd, 0x57, 0x0a, 0x1e, 0x57, 0x94, 0x82, 0xda, 0x80, 0xbd, 0x47, 0x5f, 0xb6, 0xe7, 0x3b, 0xdb, 0x01, 0x54, 0x8c, 0x8a, 0x49, 0x1d, 0x9d, 0x95, 0x61, 0xa1, 0xb0, 0xf1, 0xd2, 0x2a, 0x71, 0xf6, 0xb7, 0xbc, 0xff, 0xaa, 0xa4, 0x82, 0xdb, 0x61, 0xc2, 0xed, 0xda, 0x6a, 0xea, 0xef, 0xea, 0x96, 0xd1, 0x5d, 0xc4, 0x7c, 0xb7, 0xe4, 0xf1, 0xf8, 0x36, 0xed, 0xe0, 0xb1, 0x5d, 0x7a, 0x7e, 0x4e, 0x27, 0xd3, 0xce, 0xab, 0x04, 0x59, 0x32, 0xde, 0xde, 0x92, 0xf7, 0x6a, 0x56, 0xea, 0xfd, 0x61, 0xb5, 0x12, 0x53, 0x65, 0x50, 0x22, 0x61, 0xe4, 0x8e, 0xcd, 0xa4, 0x22, 0x9f, 0xa8, 0x45, 0x6c, 0xca, 0x27, 0xb4, 0xd6, 0xfe, 0xe9, 0xdf, 0x9a, 0x34, 0x2e, 0x2f, 0xe5, 0xca, 0x9d, 0xad, 0x8c, 0x07, 0xe7, 0xb0, 0x96, 0x92, 0x19, 0x31, 0x65, 0xae, 0xf2, 0x7b, 0x8b, 0xb6, 0x6b, 0xc4, 0x57, 0x0d, 0x43, 0x65, 0x33, 0x8f, 0x01, 0xa5, 0x2a, 0xa1, 0x3c, 0xa2, 0xf9, 0x49, 0x25, 0x7b, 0xc0, 0xbd, 0x56, 0x2c, 0x36, 0x4f, 0xc3, 0xf8, 0xdf, 0x70, 0xff, 0x17, 0x43, 0x99, 0x59, 0x9a, 0xf5, 0xd8, 0x15, 0x12, 0x1a, 0x32, 0x1a, 0xd8, 0x9f, 0xa3, 0xa4, 0xe5, 0xac, 0x08, 0x24, 0x9c, 0xa1, 0xbd, 0xb2, 0x59, 0x5c, 0x15, 0xf7, 0xa4, 0xab, 0x5a, 0x6b, 0x8b, 0x91, 0xcd, 0xfe, 0xdb, 0xac, 0xab, 0x6a, 0x8b, 0x7b, 0xd1, 0x30, 0x2a, 0xbe, 0x5a, 0xec, 0x7e, 0x54, 0x23, 0x76, 0xd7, 0x13, 0xff, 0x13, 0x21, 0x73, 0x7f, 0x89, 0xc4, 0x5d, 0xc5, 0x34, 0xd0, 0x3d, 0x5a, 0xc6, 0x01, 0xad, 0x4e, 0x10, 0xe3, 0xf5, 0x92, 0xc2, 0xa8, 0xf2, 0x85, 0x3b, 0xe0, 0x5d, 0x34, 0x24, 0x54, 0x84, 0xdf, 0x46, 0x44, 0xff, 0xce, 0x14, 0xf9, 0x64, 0x60, 0xfb, 0xd7, 0x91, 0x92, 0xf6, 0xba, 0x47, 0xc1, 0x91, 0x4e, 0x13, 0x98, 0x23, 0x3d, 0x37, 0xcc, 0x57, 0xbc, 0xe8, 0x36, 0xbf, 0x21, 0x99, 0x89, 0xbd, 0xe2, 0xbf, 0x4a, 0x62, 0xd3, 0xd3, 0xf7, 0x8d, 0xa8, 0xad, 0xf4, 0x05, 0x99, 0x25, 0xba, 0x7b, 0x99, 0x1b, 0x66, 0xf4, 0x2d, 0x75, 0xb2, 0x4c, 0x9a, 0x23, 0x0d, 0x5f, 0x6b, 0x00, 0x32, 0xb6, 0x6a, 0xf6, 0x43, 0xe9, 0x55, 0x53, 0xf3, 0xd1, 0x76, 0x7e, 0xa9, 0x14, 0xf8, 0x3a, 0x55, 0xe1, 0x91, 0xb5, 0x48, 0x60, 0x18, 0xf3, 0x85, 0xa0, 0xc7, 0x77, 0xad, 0x86, 0x7f, 0xfc, 0x67, 0x32, 0x87, 0xd6, 0x0b, 0x62, 0x8f, 0xef, 0x10, 0x01, 0x4d, 0x85, 0xf5, 0xa1, 0x15, 0xbc, 0x59, 0x23, 0x5a, 0x19, 0x21, 0x97, 0x9b, 0x78, 0xc5, 0x7c, 0x79, 0x15, 0xa4, 0xd4, 0xbb, 0x90, 0x23, 0x33, 0x63, 0x4a, 0x99, 0x0e, 0x3b, 0xf2, 0x9c, 0x28, 0x27, 0xcd, 0x90, 0x16, 0x1e, 0x85, 0xba, 0xea, 0x0e, 0x7a, 0xe5, 0xbe, 0xa6, 0x55, 0x32, 0x34, 0x08, 0xf5, 0x48, 0x8e, 0x1b, 0x92, 0x1c, 0xd7, 0xac, 0xc4, 0x83, 0x0a, 0x45, 0x76, 0x33, 0x87, 0xf6, 0x8d, 0xbb, 0xe8, 0x9d, 0x63, 0xbc, 0x28, 0x98, 0x77, 0x1c, 0xf2, 0x95, 0xea, 0xc1, 0xb0, 0xb0, 0x5b, 0x3e, 0xec, 0xf0, 0x10, 0x4f, 0x87, 0x43, 0x15, 0x7a, 0x0a, 0x10, 0xf4, 0x94, 0x52, 0xec, 0x1e, 0x1c, 0xbe, 0xfe, 0x71, 0xff, 0xf9, 0xbe, 0x47, 0x21, 0xb9, 0x61, 0xca, 0xf3, 0xe4, 0xbb, 0xc2, 0xa1, 0xa8, 0xdf, 0x12, 0x2e, 0x42, 0x51, 0x15, 0x06, 0xd3, 0x5e, 0x60, 0xc0, 0x20, 0xf4, 0x7d, 0x01, 0x3c, 0x9e, 0xcb, 0x07, 0x51, 0x92, 0xeb, 0xee, 0x98, 0x54, 0xc1, 0x03, 0x82, 0x9c, 0x51, 0x9f, 0x16, 0x32, 0x4a, 0x0c, 0x60, 0xe8, 0x8c, 0xa9, 0x50, 0x37, 0xef, 0x0e, 0xff, 0xbe, 0x4d, 0xd0, 0x2e, 0xbe, 0x5e, 0xd0, 0xc6, 0x80, 0x7f, 0x45, 0x5e, 0xb4, 0x48, 0xf2, 0xf9, 0x17, 0x0f, 0xdd, 0x27, 0x20, 0x59, 0x9e, 0x2d, 0x6c, 0xe3, 0x09, 0x21, 0x51, 0x12, 0x9a, 0x04, 0xee, 0x15, 0x9c, 0x5c, 0xbd, 0x85, 0xe8, 0x9f, 0xff, 0x47, 0x4a, 0x09, 0xa2, 0x1b, 0xd2, 0xd9, 0x4d, 0x6f, 0x6f, 0x4b, 0x67, 0x99, 0x85, 0xbd, 0xe4, 0x3f, 0x3a, 0xcf, 0x40, 0x7c, 0xa2, 0xfb, 0x62, 0xef, 0x03, 0x86, 0xce, 0x83, 0x70, 0x4b, 0x94, 0x74, 0xad, 0xa6, 0x25, 0x6d, 0xa3, 0x40, 0x3f, 0x78, 0xb3, 0xd0, 0x3c, 0x0f, 0x0d, 0xca, 0x30, 0x1f, 0x3a, 0x97, 0x03, 0x4e, 0x8b, 0x64, 0xe2, 0x70, 0x4a, 0xc5, 0xe6, 0xac, 0x35, 0x9f, 0xec, 0x6f, 0x49, 0xfa, 0xc3, 0xfa, 0x55, 0x93, 0x07, 0x90, 0xf9, 0x2d, 0x2d, 0x45, 0x85, 0x6c, 0x27, 0x77, 0x1e, 0x3f, 0x59, 0x7d, 0x69, 0x36, 0x64, 0x92, 0x23, 0x01, 0xa4, 0x57, 0x8b, 0xb9, 0x48, 0xc4, 0xd2, 0x98, 0xb7, 0x30, 0x3e, 0x18, 0xae, 0x0b, 0x6f, 0x67, 0x5c, 0x17, 0x64, 0x32, 0x4d, 0xe9, 0xbc, 0x20, 0x9f, 0xa4, 0xfb, 0x02, 0xb9, 0x35, 0x48, 0xf7, 0x05, 0xf1, 0xa5, 0x7a, 0x61, 0x4f, 0x4c, 0x65, 0x32, 0x2b, 0xc1, 0x66, 0xb7, 0xc6, 0xdb, 0x40, 0x2e, 0x12, 0x75, 0x77, 0x49, 0xad, 0xc3, 0xc1, 0x8b, 0xe3, 0xe3, 0x03, 0x71, 0x1c, 0xbe, 0xe0, 0x08, 0xb7, 0x02, 0x3c, 0x33, 0xef, 0x2a, 0x77, 0x03, 0xed, 0x5e, 0x20, 0xaf, 0x07, 0x72, 0xba, 0xe5, 0x85, 0xce, 0x1d, 0xe3, 0xea, 0x9f, 0xcc, 0xed, 0xce, 0xe6, 0xd0, 0xec, 0xce, 0xcf, 0xa1, 0x29, 0x41, 0x73, 0x30, 0x9b, 0x95, 0x91, 0x4b, 0x33, 0xd6, 0x57, 0x01, 0xd5, 0x79, 0x54, 0x54, 0xc7, 0x28, 0x65, 0xde, 0x01, 0x9d, 0xf4, 0x89, 0x51, 0x76, 0x8d, 0xe8, 0xd0, 0x19, 0x90, 0x13, 0x04, 0xf9, 0xde, 0xd7, 0x15, 0xc9, 0xd9, 0x14, 0xad, 0x8b, 0x1b, 0x8b, 0xf0, 0x9a, 0x9c, 0x12, 0xb0, 0x9a, 0x10, 0x38, 0xbc, 0xc7, 0xb8, 0x8f, 0x21, 0x70, 0xb6, 0x53, 0x08, 0x02, 0x96, 0x26, 0x48, 0x39, 0x6e, 0x63, 0x13, 0x48, 0x07, 0xef, 0x41, 0xcf, 0xc7, 0xf2, 0xc7, 0x65, 0x90, 0xd0, 0xdd, 0xec, 0xe4, 0x1c, 0x80, 0x1b, 0x3e, 0x39, 0x1d, 0xb4, 0x81, 0x6f, 0x23, 0x01, 0x0b, 0x0a, 0xea, 0x06, 0x09, 0x9e, 0x0d, 0x74, 0xb8, 0x03, 0xb2, 0x45, 0x9a, 0xf0, 0x66, 0xc3, 0xf3, 0xe6, 0xe3, 0x05, 0xeb, 0xaf, 0x50, 0x73, 0x73, 0x62, 0x26, 0xbf, 0x96, 0x14, 0xe8, 0x18, 0x14, 0x86, 0x20, 0x61, 0x14, 0x20, 0x57, 0xe2, 0x1f, 0x1b, 0x1e, 0xeb, 0xb9, 0x06, 0x65, 0x88, 0x3a, 0xd2, 0x39, 0x83, 0x2a, 0x98, 0xce, 0x19, 0xb7, 0x53, 0xcd, 0x8c, 0xbb, 0x06, 0xf9, 0x5f, 0x7c, 0x15, 0x5e, 0x37, 0xf7, 0xf6, 0x34, 0xd1, 0xd1, 0x9e, 0xec, 0x3c, 0x30, 0xe5, 0x2c, 0xba, 0xc9, 0x4a, 0xe2, 0x9c, 0xc2, 0x37, 0x43, 0x8e, 0xa1, 0xf6, 0x34, 0x1d, 0x83, 0x32, 0x61, 0x14, 0xf1, 0x15, 0x5c, 0xf8, 0xf3, 0x26, 0x04, 0xb1, 0x5b, 0x0d, 0x86, 0x16, 0xbd, 0x8a, 0x09, 0x39, 0x0b, 0xf0, 0xe0, 0xbf, 0x3a, 0x29, 0x5e, 0xdd, 0x7c, 0x18, 0x04, 0x59, 0x92, 0x46, 0xb9, 0xa4, 0x65, 0x27, 0xee, 0xfc, 0xfb, 0xb7, 0x2a, 0x28, 0x37, 0xaa, 0x2b, 0x6a, 0x3e, 0xba, 0xd7, 0x32, 0x23, 0x72, 0x0a, 0xe5, 0x86, 0xf0, 0x8d, 0x99, 0x09, 0xdd, 0xaf, 0x84, 0x19, 0x58, 0xb1, 0x95, 0xad, 0x38, 0xed, 0xb8, 0x27, 0x9d, 0x53, 0x76, 0x8d, 0x79, 0x12, 0x85, 0xa7, 0xe2, 0xca, 0x28, 0x06, 0x61, 0x01, 0xdd, 0x9f, 0x07, 0xfe, 0x65, 0x04, 0xb8, 0xbe, 0x6c, 0xbe, 0x39, 0xdc, 0x6b, 0x76, 0x41, 0xc7, 0x2f, 0xb8, 0xc8, 0x73, 0x08, 0xcf, 0xee, 0x19, 0x7a, 0x8c, 0x28, 0xf7, 0x21, 0xb6, 0xe8, 0x7f, 0xe0, 0xf9, 0xe8, 0xd1, 0x43, 0x52, 0x87, 0xcf, 0x30, 0x5a, 0xb6, 0xcf, 0x8b, 0x1d, 0xa0, 0xce, 0x5f, 0x00, 0x17, 0x80, 0xb1, 0xc5, 0x6b, 0xe9, 0xbd, 0x45, 0x1f, 0xf6, 0x41, 0x20, 0x19, 0xb8, 0xde, 0x83, 0x35, 0x74, 0xaf, 0x0d, 0x29, 0x89, 0x90, 0xfb, 0x90, 0x35, 0x56, 0x1b, 0xd5, 0x82, 0xe4, 0x9a, 0xe4, 0xcd, 0x96, 0x3a, 0xb3, 0x8b, 0xbd, 0x48, 0xc7, 0x59, 0x5e, 0x57, 0xae, 0xd2, 0xad, 0x88, 0xff, 0xbd, 0xbb, 0xe0, 0x91, 0x30, 0x46, 0xd6, 0x15, 0x44, 0x55, 0xff, 0x03, 0x9b, 0xf8, 0x61, 0xda, 0x1d, 0x53, 0x92, 0x15, 0x81, 0x97, 0xe7, 0x31, 0x49, 0xfb, 0x6e, 0x23, 0x80, 0xe9, 0x9a, 0x34, 0x07, 0x19, 0xef, 0xf9, 0x03, 0x36, 0x69, 0xaa, 0x49, 0xf4, 0x17, 0x99, 0xae, 0x81, 0xe2, 0x4e, 0x13, 0xc4, 0x56, 0x9e, 0x84, 0xe4, 0x12, 0xe2, 0x4e, 0x3c, 0x28, 0x49, 0x7e, 0x97, 0xe8, 0x6d, 0x5b, 0xa2, 0x3c, 0xe3, 0x17, 0xe9, 0xb9, 0x81, 0xf2, 0x81, 0x57, 0x69, 0x24, 0xe3, 0xa8, 0x39, 0xaa, 0x46, 0xe6, 0x70, 0x00, 0x05, 0xc2, 0x6f, 0x62, 0x02, 0x46, 0x5c, 0x72, 0xcf, 0xbe, 0xe5, 0xe4, 0xd9, 0xfd, 0x6e, 0x39, 0xa9, 0x09, 0xd5, 0x19, 0x18, 0x37, 0x8b, 0xa8, 0x6b, 0x47, 0xa0, 0xb1, 0x76, 0xe3, 0x50, 0x78, 0x88, 0x42, 0x51, 0xf4, 0xd5, 0x6d, 0xa9, 0x67, 0xf2, 0xe4, 0xee, 0xda, 0xb1, 0xc8, 0xf5, 0x5e, 0xc0, 0x63, 0xdb, 0x1b, 0x69, 0xd1, 0xdf, 0x42, 0x20, 0xf1, 0xfa, 0x94, 0x3a, 0x07, 0xa7, 0x09, 0x0b, 0x3c, 0xb6, 0x38, 0x93, 0xd8, 0xb3, 0xbe, 0x27, 0x37, 0xa2, 0x2c, 0xc7, 0x48, 0x95, 0x33, 0x3d, 0xbe, 0x8a, 0xee, 0xd5, 0x44, 0x7e, 0x07, 0xb0, 0xef, 0x66, 0x81, 0xad, 0xb9, 0xea, 0xe5, 0xae, 0x40, 0xe9, 0x5b, 0xf3, 0xc4, 0xce, 0x84, 0x45, 0x1b, 0x8f, 0xbb, 0x95, 0x64, 0xc4, 0x33, 0x51, 0xd1, 0xaf, 0xbe, 0x2c, 0x57, 0x71, 0x25, 0x2c, 0xfa, 0xe2, 0xcb, 0xae, 0x33, 0xff, 0x64, 0x7e, 0xfe, 0xa5, 0x92, 0xd9, 0x78, 0x36, 0x2a, 0xfa, 0x97, 0x6f, 0x73, 0x9b, 0xf9, 0xe6, 0x7d, 0x6e, 0x33, 0xbf, 0x2b, 0x4e, 0xba, 0xee, 0x32, 0xf3, 0xbb, 0xc2, 0xa4, 0x67, 0x2e, 0x2e, 0x1f, 0xd5, 0x5d, 0x5c, 0x6e, 0x14, 0x11, 0xf7, 0x96, 0x57, 0xa2, 0xa4, 0x2b, 0x17, 0xa2, 0x8b, 0x30, 0x69, 0xa3, 0xd2, 0x57, 0x5e, 0x52, 0x1e, 0x58, 0x2f, 0xae, 0x66, 0xe2, 0x9d, 0x45, 0x94, 0xb4, 0x19, 0xaa, 0x4c, 0x75, 0x2a, 0x41, 0xd2, 0x89, 0x55, 0x64, 0xde, 0x1d, 0xe5, 0x46, 0x91, 0x97, 0x54, 0xc7, 0x8a, 0xae, 0xac, 0x0f, 0x92, 0xbe, 0xeb, 0x8a, 0xf2, 0xca, 0xbd, 0xe6, 0x75, 0x51, 0xd2, 0xdd, 0x99, 0x28, 0xe9, 0xb7, 0x56, 0x11, 0x11, 0x24, 0x6d, 0x52, 0xcc, 0x8b, 0x9a, 0x5b, 0xe1, 0xab, 0x01, 0xe6, 0xbf, 0xfa, 0x6f, 0xcc, 0x46, 0x28, 0x6c, 0xda, 0x5a, 0x43, 0xf5, 0xd7, 0x7d, 0x9b, 0x0b, 0x83, 0x57, 0x62, 0x7c, 0xd7, 0x3f, 0xcd, 0xf6, 0xdb, 0x9b, 0xb9, 0x24, 0x7c, 0xe6, 0x06, 0xf0, 0x6f, 0x19, 0x4a, 0xcd, 0xbf, 0x34, 0x94, 0x7a, 0xfd, 0xa7, 0x59, 0x98, 0x9f, 0xf3, 0x6a, 0x9c, 0xb4, 0x08, 0xaf, 0x36, 0x33, 0x17, 0x14, 0x7e, 0x25, 0xc0, 0xba, 0x33, 0x0b, 0xcf, 0xa8, 0xa8, 0x04, 0x65, 0x7f, 0xcb, 0xf0, 0xea, 0xec, 0x5e, 0xe1, 0xd5, 0xc6, 0x8b, 0xe3, 0x99, 0xd0, 0x69, 0x11, 0x5e, 0x6d, 0x14, 0xc9, 0x0a, 0xff, 0xca, 0x7a, 0x21, 0x82, 0xab, 0xad, 0x35, 0x48, 0x45, 0x2a, 0xd1, 0xd5, 0x81, 0x55, 0xe9, 0xe7, 0x6a, 0x10, 0x34, 0x45, 0x57, 0x9b, 0x2b, 0x83, 0x82, 0xab, 0xcd, 0x31, 0xa5, 0xb3, 0xc8, 0xeb, 0x16, 0xd8, 0xac, 0x95, 0xba, 0xa0, 0xf0, 0xbb, 0x56, 0x47, 0x22, 0xb8, 0xda, 0x0a, 0xe4, 0xa7, 0x22, 0x95, 0xe8, 0xea, 0x4f, 0x56, 0x25, 0x11, 0x5c, 0x6d, 0x16, 0xf9, 0x89, 0x50, 0xf7, 0x6d, 0xa2, 0xab, 0x8d, 0x22, 0x22, 0xb8, 0xda, 0x9a, 0x7d, 0x8a, 0xae, 0xae, 0xdb, 0xee, 0x45, 0x7a, 0x72, 0x72, 0xe0, 0x15, 0x46, 0x3d, 0xf2, 0x83, 0x39, 0x3b, 0xef, 0xb0, 0xed, 0x32, 0x05, 0xbd, 0xf1, 0x19, 0x1d, 0x38, 0xf0, 0x2b, 0xdd, 0xd6, 0xf5, 0xa9, 0xfa, 0x15, 0x24, 0x13, 0x8e, 0x5f, 0x3f, 0x1b, 0x11, 0xb1, 0x56, 0x65, 0x90, 0xa8, 0xce, 0x46, 0x3c, 0xc3, 0x83, 0x39, 0xba, 0x2f, 0x5e, 0x07, 0xb4, 0x62, 0xa9, 0xee, 0x68, 0x8c, 0x2d, 0x08, 0xff, 0xb9, 0xb3, 0xe1, 0xe0, 0x33, 0xec, 0x01, 0x58, 0x64, 0xdf, 0x2e, 0xd2, 0x45, 0x97, 0x38, 0x8a, 0x92, 0x2b, 0xdf, 0x93, 0x69, 0xaf, 0x84, 0x7d, 0x42, 0xf5, 0x8e, 0xaa, 0xdf, 0x15, 0xf0, 0xef, 0xb8, 0x71, 0xdd, 0x7a, 0xf9, 0x59, 0x41, 0x9f, 0x14, 0x46, 0x98, 0xa3, 0x59, 0xdb, 0x84, 0xfe, 0x05, 0x37, 0x82, 0x19, 0x8d, 0x94, 0xfa, 0xb3, 0xd0, 0xc8, 0xc4, 0xfa, 0x9f, 0xcc, 0xc8, 0xc5, 0x59, 0x98, 0x44, 0xb8, 0xe2, 0xb1, 0xf8, 0xcc, 0xd5, 0x3d, 0x02, 0xf8, 0xe5, 0x27, 0xaa, 0xf8, 0xbc, 0xfc, 0x02, 0x72, 0xeb, 0x99, 0x00, 0x06, 0xbe, 0x76, 0xcc, 0x30, 0x43, 0x2e, 0xe3, 0x21, 0x85, 0x56, 0x59, 0x36, 0x21, 0xa2, 0x0a, 0x27, 0x85, 0xee, 0xfb, 0x32, 0xea, 0x45, 0x14, 0xbd, 0x89, 0xef, 0x7f, 0xb6, 0x5f, 0x67, 0xf0, 0x1e, 0x56, 0x4e, 0xcd, 0x97, 0x9c, 0xdc, 0x4b, 0xce, 0xf2, 0x22, 0x23, 0x7f, 0x70, 0x19, 0x1f, 0xf8, 0xa2, 0xd2, 0x6c, 0x34, 0x3a, 0x0b, 0xc2, 0x50, 0x85, 0x24, 0xff, 0x52, 0xf9, 0x3a, 0x0c, 0xba, 0xe6, 0xe7, 0xcb, 0xf2, 0xb3, 0x08, 0xe0, 0x36, 0x02, 0xb6, 0x65, 0x68, 0x9d, 0xfd, 0x59, 0xba, 0x46, 0x00, 0x49, 0x57, 0x82, 0xd2, 0xe8, 0x22, 0x5c, 0x14, 0xe7, 0xe7, 0x11, 0xdc, 0xf4, 0xef, 0x28, 0xdc, 0xcc, 0x2e, 0x58, 0x33, 0xb5, 0x50, 0x4e, 0xad, 0x8f, 0x97, 0x22, 0x41, 0xfe, 0x8f, 0xec, 0x27, 0x8c, 0x42, 0xf3, 0xd8, 0x4b, 0x91, 0x20, 0x7f, 0x9b, 0x43, 0x43, 0xf8, 0x30, 0x27, 0xae, 0x6c, 0x7a, 0x7f, 0x09, 0x9a, 0xdf, 0x21, 0xfe, 0xbe, 0xfc, 0x26, 0xe2, 0xef, 0x1d, 0x97, 0x75, 0xfc, 0x06, 0xf1, 0x77, 0xdb, 0x66, 0x9f, 0x33, 0xcc, 0xf4, 0xbc, 0x22, 0x20, 0xd7, 0xe4, 0x09, 0xba, 0xf5, 0xf2, 0x8e, 0xf3, 0x2f, 0xcb, 0x13, 0x54, 0xb9, 0xbc, 0xe3, 0xdd, 0x6d, 0x97, 0x77, 0x48, 0x81, 0xf8, 0xae, 0x3c, 0x41, 0x5b, 0x5f, 0x25, 0xfd, 0x1a, 0x2f, 0x40, 0xf8, 0xbd, 0xac, 0xc9, 0x11, 0x64, 0x49, 0x0b, 0x24, 0xfd, 0x9a, 0x9a, 0x41, 0x8d, 0xf0, 0x7b, 0x8f, 0x14, 0x41, 0x1f, 0xef, 0x95, 0x22, 0x68, 0x46, 0xf6, 0xbd, 0x2b, 0x43, 0x50, 0x36, 0x93, 0x21, 0xe8, 0x5f, 0x49, 0xf8, 0x4d, 0xee, 0x16, 0x7e, 0xe3, 0x7b, 0x09, 0xbf, 0x33, 0x19, 0x82, 0xcc, 0x3a, 0xf7, 0x4e, 0x11, 0x64, 0xee, 0xa9, 0x24, 0xfb, 0xde, 0x91, 0x21, 0x68, 0xfb, 0xb7, 0x0b, 0xba, 0x6f, 0xee, 0x4c, 0x0f, 0x34, 0xbe, 0x3b, 0x3d, 0x50, 0xef, 0x5e, 0x32, 0xad, 0x29, 0xa1, 0x71, 0xbf, 0x22, 0xd5, 0x1e, 0xcf, 0x8a, 0x7e, 0x71, 0x55, 0x12, 0x96, 0x32, 0xad, 0xd1, 0x8e, 0xc8, 0x0e, 0x64, 0x56, 0x7c, 0x3e, 0xdb, 0xce, 0xfb, 0x99, 0xa4, 0x42, 0x42, 0xa6, 0x35, 0x97, 0x0c, 0x65, 0x07, 0x32, 0x2b, 0x8e, 0x66, 0xe5, 0x34, 0x10, 0x69, 0xdf, 0xf3, 0x6f, 0x23, 0xd2, 0x5e, 0xd4, 0x89, 0xb4, 0x16, 0xc9, 0xd7, 0xcb, 0xb4, 0x77, 0x65, 0x0c, 0xba, 0x87, 0x4c, 0x3b, 0xa9, 0x93, 0x69, 0x6b, 0xf3, 0xe0, 0xec, 0xce, 0x8a, 0x06, 0x24, 0xa3, 0x55, 0xdf, 0x0f, 0x3b, 0xec, 0x82, 0xc4, 0x23, 0xfd, 0x5e, 0xc9, 0x18, 0xaf, 0xcb, 0x94, 0x26, 0xf8, 0x5a, 0xc9, 0x3b, 0xbf, 0x50, 0x00, 0x1a, 0x37, 0x8a, 0xcf, 0x8a, 0x69, 0xf9, 0xbc, 0xcf, 0x3b, 0xf4, 0xf9, 0xd9, 0x1c, 0xe9, 0x64, 0x8b, 0x1b, 0x82, 0x9a, 0xfa, 0x1a, 0xa3, 0x4b, 0xc4, 0x8c, 0x98, 0x66, 0xd7, 0x55, 0xcd, 0x0b, 0x51, 0x2d, 0xbc, 0x5d, 0xbc, 0x11, 0xb2, 0xd8, 0x41, 0x6d, 0x21, 0xdd, 0xd9, 0x39, 0x15, 0xea, 0xd5, 0x16, 0xb2, 0xfb, 0xfc, 0x4c, 0x25, 0x7f, 0xa9, 0x2d, 0xa9, 0x9d, 0x53, 0xa0, 0xc5, 0x63, 0x21, 0xc0, 0x16, 0x75, 0xe5, 0xa4, 0xbf, 0x0a, 0x94, 0x12, 0x29, 0x26, 0xde, 0xd7, 0xb6, 0x56, 0xe6, 0x04, 0xc1, 0x92, 0xa3, 0x5b, 0x44, 0x39, 0x3b, 0x29, 0x07, 0x94, 0xbe, 0xb9, 0x59, 0x25, 0xb1, 0x2e, 0x2b, 0x8c, 0x6b, 0x88, 0x27, 0x85, 0x71, 0x0f, 0x71, 0x50, 0x3e, 0x1c, 0x01, 0x5d, 0x59, 0xf6, 0xc5, 0x9f, 0xf9, 0x9d, 0x06, 0x46, 0x72, 0xe2, 0x69, 0xa0, 0x90, 0xf5, 0xb3, 0x94, 0x46, 0x40, 0x9b, 0x2a, 0x85, 0xa7, 0x19, 0x4a, 0x40, 0xf1, 0x2a, 0x2d, 0x2a, 0x25, 0x66, 0x26, 0x14, 0x4b, 0x75, 0xab, 0xa5, 0xe6, 0xcd, 0x04, 0x16, 0x06, 0xdd, 0xcb, 0x08, 0x67, 0xfc, 0x59, 0x08, 0x64, 0x40, 0x8d, 0xbf, 0x72, 0xf6, 0x33, 0x8a, 0x64, 0x3f, 0x0b, 0x91, 0xec, 0x15, 0x87, 0xce, 0xf1, 0x01, 0xdf, 0x04, 0xf8, 0xe6, 0x13, 0x87, 0x8e, 0xf0, 0xc1, 0x83, 0x36, 0x16, 0x7c, 0x50, 0x04, 0x53, 0x10, 0xad, 0x00, 0x0f, 0x3a, 0x37, 0x00, 0xbc, 0x01, 0x35, 0x0e, 0x2a, 0xdc, 0x9a, 0x1b, 0x80, 0xa5, 0xf3, 0xa5, 0x3a, 0x91, 0x24, 0x69, 0x50, 0x36, 0x19, 0xd1, 0xd5, 0xe2, 0x73, 0xf2, 0x07, 0xbc, 0xa8, 0xcd, 0x1f, 0x80, 0xee, 0xb6, 0x33, 0x31, 0x85, 0xca, 0xe7, 0xd0, 0xf0, 0x37, 0xd4, 0x21, 0x03, 0x6f, 0x46, 0x61, 0x50, 0x70, 0x11, 0x59, 0x18, 0xf5, 0x32, 0x4c, 0x66, 0x6e, 0x3b, 0x0f, 0x0d, 0x96, 0xff, 0xf8, 0x83, 0x0a, 0xb2, 0x37, 0x02, 0x2f, 0xf2, 0xac, 0xeb, 0xaf, 0x8c, 0xa9, 0xf2, 0xc6, 0xd3, 0x15, 0x51, 0xf3, 0x0b, 0x3c, 0xc7, 0xbe, 0x2c, 0xbb, 0xbb, 0xbc, 0x55, 0x08, 0x9d, 0x22, 0xb3, 0x34, 0x9e, 0x93, 0xd8, 0xbd, 0x36, 0x1b, 0xbe, 0x18, 0xed, 0x21, 0xa7, 0x6c, 0x29, 0xe4, 0x88, 0x11, 0x8a, 0xb6, 0x8a, 0x94, 0xdc, 0x5b, 0x26, 0xe5, 0x11, 0x78, 0x77, 0x80, 0xd7, 0x33, 0xe7, 0x0e, 0x65, 0x2c, 0x4d, 0xc7, 0x30, 0x03, 0xf9, 0x20, 0x4d, 0x0b, 0x27, 0xca, 0xf3, 0x31, 0xd0, 0x12, 0x1d, 0xa9, 0xdf, 0x9a, 0x7f, 0xdd, 0x8c, 0xbd, 0xfc, 0x64, 0xdd, 0xff, 0xf4, 0x39, 0xfa, 0xda, 0xec, 0xdc, 0xfa, 0xd8, 0xfd, 0x97, 0xd9, 0x8c, 0x01, 0x6b, 0xe5, 0xa1, 0x3b, 0xc6, 0x90, 0x47, 0x95, 0xf3, 0x2f, 0x11, 0xc9, 0x9c, 0xb8, 0x0d, 0x39, 0x7a, 0xec, 0x4d, 0x0c, 0x1e, 0x57, 0xa6, 0xc7, 0x2a, 0x27, 0x7b, 0x99, 0x28, 0x55, 0x7f, 0x9e, 0xd7, 0x86, 0x66, 0xe4, 0x24, 0x44, 0x78, 0x03, 0xab, 0x6a, 0xb0, 0xe9, 0x1c, 0xc4, 0x1c, 0x50, 0xee, 0x50, 0x53, 0x6b, 0xab, 0xcb, 0x6b, 0x3a, 0xe5, 0x04, 0x22, 0x3b, 0x51, 0x19, 0x29, 0xe0, 0x21, 0xc2, 0x54, 0xf0, 0x7d, 0x3c, 0x5b, 0x6c, 0xb9, 0x89, 0x79, 0x1e, 0x28, 0x5b, 0x53, 0xb0, 0xa9, 0x16, 0x31, 0x73, 0x7e, 0xd0, 0x0f, 0xa2, 0xa4, 0xa9, 0xe2, 0xe3, 0x55, 0xde, 0x82, 0x44, 0x9e, 0x06, 0xb6, 0x80, 0x20, 0xc6, 0x40, 0xd1, 0x78, 0x76, 0x89, 0x39, 0x83, 0xc7, 0x09, 0x3a, 0x2b, 0x71, 0x4a, 0xdf, 0xaf, 0x5a, 0xd3, 0xb1, 0xf5, 0xd3, 0x99, 0xeb, 0x25, 0x63, 0xff, 0x05, 0xaa, 0x43, 0x81, 0x1f, 0x5b, 0xb6, 0x23, 0x3f, 0xb0, 0xcd, 0x94, 0x7e, 0x66, 0x25, 0x47, 0xf3, 0x43, 0x4b, 0x82, 0xf2, 0xfb, 0xb6, 0x69, 0xda, 0xef, 0xd5, 0x6f, 0xb7, 0xa1, 0xa1, 0xaf, 0x0d, 0xe7, 0x1d, 0x57, 0x0c, 0x6d, 0x7d, 0xed, 0xc8, 0xff, 0x64, 0x45, 0x7a, 0x1f, 0xb1, 0xdc, 0xc8, 0xa4, 0x76, 0xc4, 0x3e, 0x88, 0x70, 0x5e, 0xe2, 0x7a, 0x6d, 0x11, 0xdb, 0x4b, 0x17, 0x6a, 0x01, 0xd7, 0x15, 0x0f, 0xea, 0x5e, 0x80, 0x29, 0x2d, 0x03, 0x4c, 0x9d, 0x76, 0xa4, 0x59, 0xce, 0x08, 0xfe, 0xd3, 0x4c, 0x3c, 0x02, 0x26, 0x3e, 0xaa, 0x85, 0x90, 0xcf, 0x40, 0xd8, 0x3e, 0xf9, 0x8c, 0x68, 0x33, 0xa8, 0x4a, 0x66, 0x7d, 0x51, 0x8b, 0x4c, 0xd0, 0x89, 0xce, 0xf4, 0x82, 0xd5, 0x46, 0x25, 0x4f, 0xc3, 0x06, 0x59, 0x3c, 0x87, 0xa7, 0xfd, 0x64, 0xc4, 0x27, 0x7c, 0x21, 0x4f, 0x7b, 0xd8, 0xd8, 0xd8, 0x1e, 0xe7, 0x45, 0x3a, 0x2c, 0xa3, 0xa1, 0xdc, 0xed, 0x9d, 0x77, 0x9e, 0xb3, 0xd6, 0x5c, 0x6d, 0xae, 0x09, 0xfe, 0x36, 0x2a, 0x1b, 0x7c, 0xbc, 0x41, 0xa7, 0xe3, 0xe8, 0x94, 0xe0, 0x28, 0x77, 0xaf, 0xae, 0xa8, 0xaf, 0x18, 0x42, 0xe9, 0xf0, 0xc5, 0x93, 0x01, 0x9e, 0xe7, 0x51, 0x36, 0x1b, 0xf4, 0x68, 0x04, 0x2e, 0x92, 0x66, 0x51, 0x1f, 0xdd, 0x3c, 0x9c, 0x51, 0x96, 0xe2, 0x19, 0xa2, 0xd3, 0x99, 0x38, 0x4f, 0x03, 0xbd, 0xb8, 0xa3, 0xe4, 0xdc, 0xc1, 0x7f, 0xe4, 0x1d, 0x1f, 0x0d, 0x71, 0x68, 0x59, 0x14, 0xa3, 0xbc, 0xb5, 0xb2, 0xd2, 0x07, 0xfa, 0x1c, 0x77, 0x60, 0xbb, 0x1e, 0xae, 0x7c, 0xcc, 0xd2, 0xcb, 0x64, 0xb2, 0xf1, 0x53, 0x9a, 0x04, 0x05, 0xf4, 0xe1, 0x1c, 0xe2, 0xe3, 0xd3, 0x95, 0x60, 0xa3, 0x49, 0x9e, 0x6e, 0x30, 0x00, 0x27, 0x08, 0x61, 0x2d, 0x05, 0xe1, 0x05, 0x42, 0x10, 0xc2, 0x6a, 0x0d, 0xd0, 0xf1, 0x2f, 0xa7, 0x73, 0xfb, 0x68, 0x08, 0xbd, 0x0b, 0x09, 0x02, 0x7d, 0xe4, 0x46, 0x15, 0xa4, 0x3d, 0x9e, 0xb9, 0xed, 0x65, 0x26, 0x28, 0xee, 0x5f, 0xfe, 0xc1, 0xd9, 0x0b, 0x28, 0x7f, 0xf2, 0x8e, 0x6a, 0xd8, 0xbd, 0x20, 0x8c, 0xc9, 0xb8, 0x8a, 0x71, 0x5c, 0x8e, 0x29, 0x2f, 0x96, 0x61, 0x1a, 0xbb, 0x0e, 0xfd, 0x8a, 0x92, 0x3c, 0x0a, 0xb9, 0xb8, 0xc2, 0x5c, 0x3b, 0x68, 0x1a, 0xee, 0xaa, 0x71, 0xa4, 0xdd, 0xe8, 0x2a, 0x77, 0x54, 0x39, 0xdb, 0x03, 0x20, 0x93, 0xbc, 0x44, 0xef, 0xb2, 0x11, 0x49, 0x6a, 0x78, 0x31, 0x5c, 0x44, 0xf9, 0x38, 0x88, 0xa3, 0xcf, 0x81, 0x76, 0x96, 0x53, 0xe2, 0x12, 0x73, 0x84, 0x40, 0x24, 0xbc, 0xeb, 0x4a, 0xb1, 0x87, 0x3c, 0x1a, 0x9e, 0xae, 0x60, 0xd7, 0x46, 0xf7, 0xcf, 0xc5, 0xec, 0x85, 0x8e, 0x15, 0x4b, 0xef, 0xec, 0xeb, 0x48, 0x55, 0x13, 0x12, 0xf2, 0x9e, 0xaa, 0xfa, 0x52, 0x94, 0xbe, 0x16, 0x6b, 0xf4, 0x19, 0x04, 0x0a, 0xdc, 0x2d, 0xb2, 0xc2, 0x13, 0xbc, 0xa6, 0xbc, 0x61, 0x82, 0x9c, 0xb2, 0xc8, 0xbf, 0xb5, 0x02, 0xc4, 0x66, 0xb7, 0x3b, 0xce, 0x90, 0x39, 0x89, 0xa8, 0x1f, 0xe7, 0x38, 0x0b, 0xe8, 0xae, 0x03, 0xb3, 0xef, 0x83, 0x8c, 0x77, 0xa3, 0x5c, 0xef, 0x50, 0xc2, 0x44, 0xe5, 0x00, 0xda, 0xba, 0x98, 0x7b, 0x1b, 0xc7, 0x97, 0x5b, 0xb7, 0xe0, 0x0d, 0xa0, 0xa2, 0x44, 0xcf, 0x4c, 0x7f, 0xaf, 0xb1, 0x72, 0xf4, 0x99, 0x93, 0xcf, 0x5b, 0xbf, 0xd2, 0xd1, 0x21, 0x0f, 0xc7, 0x5d, 0xc1, 0x7c, 0x61, 0x4b, 0x86, 0x01, 0xd1, 0x28, 0x24, 0x35, 0x85, 0x7a, 0x10, 0x84, 0xdd, 0xc1, 0x78, 0x18, 0x24, 0xcb, 0x78, 0x4f, 0x33, 0x45, 0x21, 0xea, 0x0c, 0x0a, 0xb9, 0xe8, 0x72, 0x65, 0x1c, 0xd7, 0xdc, 0x15, 0x73, 0x0f, 0xda, 0xa3, 0x18, 0x69, 0xbc, 0x4e, 0xef, 0x79, 0xb9, 0xb8, 0xf2, 0x6f, 0x47, 0x73, 0x7a, 0xd2, 0xc9, 0xfd, 0xcd, 0x1c, 0xfc, 0x73, 0xe5, 0xfe, 0x76, 0x94, 0xc6, 0x51, 0xf8, 0xd3, 0x91, 0x73, 0x74, 0xb0, 0x29, 0x10, 0x80, 0xd9, 0xe3, 0x32, 0xdc, 0xb2, 0xf2, 0x11, 0xec, 0xb3, 0xd1, 0x05, 0xce, 0x04, 0x1a, 0x29, 0x67, 0x90, 0x6b, 0x13, 0xd2, 0xb3, 0x20, 0x1f, 0x50, 0x92, 0xc7, 0x7a, 0x8a, 0x96, 0x9e, 0x57, 0x46, 0x60, 0x34, 0x75, 0x26, 0xa8, 0xdb, 0x51, 0xf9, 0x16, 0x9d, 0x4e, 0x90, 0xe5, 0x92, 0x9c, 0x61, 0x1e, 0x38, 0xec, 0x9d, 0x04, 0xc1, 0x10, 0x33, 0x9b, 0x75, 0xf3, 0x19, 0x10, 0xb6, 0xd1, 0x53, 0xa8, 0x8f, 0x24, 0x85, 0x13, 0x25, 0x00, 0x32, 0xfb, 0xdf, 0x1a, 0xc3, 0xf6, 0x24, 0x00, 0xe8, 0x5a, 0x45, 0x2f, 0xa2, 0x40, 0xbe, 0x21, 0x47, 0xb2, 0x99, 0x86, 0x77, 0x15, 0x15, 0x1c, 0x15, 0x41, 0x27, 0xc2, 0xeb, 0x70, 0x2c, 0xe4, 0x29, 0xb4, 0xde, 0x7a, 0xe1, 0xcd, 0x90, 0xa3, 0x2c, 0x15, 0xe5, 0xc3, 0x5c, 0x52, 0x16, 0x88, 0x63, 0x71, 0x1c, 0xf5, 0x29, 0x5f, 0x3c, 0xec, 0xfb, 0x63, 0xba, 0x8c, 0xa8, 0x8b, 0xf9, 0x9f, 0x26, 0xb3, 0xc8, 0x05, 0x14, 0x01, 0xa1, 0x6d, 0x01, 0x77, 0x85, 0xa6, 0x9e, 0xf1, 0x51, 0x9c, 0x4e, 0x90, 0x38, 0x4c, 0x30, 0xd4, 0xe5, 0x21, 0xd2, 0xb9, 0xb1, 0xd6, 0xa3, 0x11, 0x19, 0x06, 0x08, 0x12, 0x13, 0x47, 0x08, 0xa9, 0xbf, 0x95, 0x5e, 0x29, 0x2f, 0xe5, 0xd1, 0x90, 0xee, 0xe4, 0xa2, 0xb1, 0xef, 0xab, 0x41, 0xce, 0xb8, 0xca, 0x9a, 0xe2, 0xae, 0x91, 0xbb, 0x0a, 0xb7, 0x2c, 0x25, 0xab, 0xd6, 0x7b, 0x64, 0xbf, 0x48, 0x2f, 0xd1, 0x93, 0x13, 0xaf, 0x85, 0x33, 0x7c, 0x9e, 0x89, 0xb1, 0xdf, 0xb5, 0x26, 0xca, 0xe5, 0x30, 0x8c, 0x29, 0x7c, 0xca, 0xc0, 0xa8, 0x4e, 0xa2, 0x69, 0xf8, 0x30, 0xbf, 0x43, 0xe1, 0x4c, 0x27, 0xf1, 0x17, 0xec, 0xd4, 0x31, 0x58, 0xac, 0x48, 0xf4, 0x4f, 0x4e, 0x8d, 0xc0, 0x03, 0xa9, 0x01, 0x1e, 0x32, 0x71, 0xe1, 0x91, 0x74, 0x0c, 0xa5, 0xdb, 0x7d, 0x82, 0xca, 0x9d, 0x0d, 0x48, 0x5e, 0x30, 0x29, 0x47, 0x94, 0xb6, 0x8d, 0x92, 0xf4, 0x43, 0x0d, 0x79, 0xe1, 0x9c, 0xbe, 0xf8, 0xa7, 0x32, 0xe3, 0xd5, 0xab, 0xb8, 0x0c, 0x57, 0x6f, 0x7b, 0xf1, 0x88, 0x1b, 0x94, 0x64, 0x33, 0xdf, 0xe5, 0xd2, 0x2b, 0x4b, 0x2d, 0x58, 0x92, 0xe9, 0xa5, 0x07, 0x9d, 0x71, 0xb5, 0xd3, 0x65, 0x90, 0x1b, 0x2e, 0x7d, 0x8e, 0x7b, 0xb0, 0xf9, 0xe6, 0xe8, 0xf9, 0xb3, 0x15, 0xfc, 0xb3, 0xfb, 0xea, 0x47, 0x6a, 0x83, 0x7b, 0x33, 0x30, 0xd1, 0x0d, 0xf6, 0xc8, 0x3b, 0xa3, 0xae, 0x01, 0xd2, 0x6e, 0xaf, 0x8e, 0xf0, 0x91, 0xa4, 0x73, 0x0b, 0x37, 0xd5, 0xac, 0x6c, 0x94, 0x9d, 0x10, 0x08, 0x11, 0x21, 0x7c, 0x24, 0x78, 0xa8, 0xdc, 0x39, 0x9c, 0xb5, 0x27, 0xcb, 0x42, 0x60, 0x76, 0x64, 0xea, 0x43, 0x47, 0x85, 0x7e, 0x28, 0xf5, 0x7c, 0x76, 0x85, 0x20, 0xc8, 0xce, 0x7e, 0x90, 0xc0, 0xf4, 0x50, 0x1c, 0x44, 0x09, 0xe0, 0x01, 0xde, 0x7b, 0x8c, 0x61, 0x63, 0xe1, 0x58, 0xb8, 0xee, 0x73, 0x7b, 0x7e, 0xa0, 0xdb, 0x01, 0x5e, 0xb5, 0x63, 0xc1, 0x8f, 0x72, 0x50, 0x52, 0x72, 0x22, 0xb1, 0x8e, 0xc9, 0x5d, 0x58, 0x2c, 0xe7, 0x2e, 0xde, 0x33, 0xcc, 0x01, 0xfb, 0xb8, 0x03, 0x95, 0x98, 0x4c, 0x61, 0x1b, 0x0c, 0xa4, 0xb3, 0xf8, 0x0c, 0xf6, 0xc4, 0xe2, 0x36, 0xe3, 0x09, 0x2a, 0x28, 0xa1, 0xf6, 0x05, 0x6c, 0x34, 0x05, 0xd8, 0xb8, 0x9c, 0x59, 0x07, 0xa9, 0x5b, 0x6c, 0xea, 0xcc, 0xec, 0x50, 0x8d, 0x84, 0x66, 0x98, 0x7a, 0x66, 0x48, 0xb2, 0x54, 0x0b, 0x5b, 0x1c, 0x63, 0x34, 0xad, 0x5e, 0xe4, 0xa3, 0xf2, 0xe2, 0xb2, 0x87, 0x65, 0x54, 0xc1, 0x60, 0x22, 0x54, 0x11, 0x3a, 0x14, 0xca, 0xec, 0xc8, 0x02, 0x8c, 0x24, 0x48, 0x72, 0x12, 0x82, 0x32, 0x1e, 0x47, 0xb4, 0xdf, 0xe9, 0x25, 0x12, 0xaa, 0x45, 0x24, 0xb0, 0xd0, 0xc9, 0xe9, 0x64, 0xb1, 0x90, 0xbd, 0x4b, 0xae, 0x86, 0xf1, 0x10, 0x69, 0x4c, 0x17, 0x52, 0x21, 0x35, 0x20, 0xd2, 0x09, 0xbf, 0xa0, 0x40, 0xa2, 0x9f, 0x76, 0xa6, 0x89, 0x17, 0x71, 0x09, 0x68, 0x18, 0xa9, 0x3b, 0xf3, 0xb0, 0x34, 0xa9, 0x15, 0x46, 0x3f, 0xa0, 0x6b, 0x3a, 0xb0, 0xfb, 0xe0, 0x1e, 0x89, 0x57, 0x6f, 0x64, 0x6a, 0x95, 0x8a, 0x19, 0x6e, 0xde, 0x72, 0xdd, 0x1f, 0x72, 0x20, 0x54, 0x04, 0x56, 0xd6, 0x56, 0x29, 0x77, 0x82, 0xc1, 0x80, 0x84, 0x3e, 0x6c, 0x5f, 0x74, 0x97, 0x0f, 0x35, 0x7e, 0x28, 0x13, 0xed, 0x51, 0x3a, 0xce, 0x48, 0xdb, 0x0e, 0xcd, 0x6b, 0xbd, 0xbe, 0x42, 0xba, 0x1d, 0x46, 0xe7, 0x3c, 0xe6, 0xbc, 0x58, 0xe9, 0x76, 0xcf, 0xf2, 0x5e, 0x7e, 0xd6, 0x05, 0xd9, 0x39, 0xc8, 0xfa, 0xbc, 0xf0, 0xcf, 0x3a, 0x71, 0x90, 0x9c, 0x6f, 0xdc, 0x5a, 0x16, 0xc5, 0xe0, 0x99, 0x41, 0xce, 0x8a, 0xf0, 0x68, 0x77, 0x24, 0x9a, 0x05, 0x7a, 0x4c, 0x72, 0x01, 0x7a, 0x9e, 0xf6, 0x0a, 0xda, 0x04, 0x70, 0xf1, 0x2b, 0x51, 0x1d, 0xf0, 0x3d, 0x0c, 0x80, 0x55, 0x7e, 0x63, 0x49, 0xdd, 0x41, 0x5e, 0x1f, 0x12, 0x55, 0x60, 0xd2, 0x45, 0xd8, 0xd3, 0x83, 0x61, 0xf0, 0x19, 0x49, 0x40, 0xaa, 0x06, 0x79, 0xd3, 0xd9, 0x2d, 0xe4, 0x22, 0x4b, 0x52, 0x00, 0x69, 0x02, 0x4a, 0x04, 0x2c, 0xbe, 0x88, 0x40, 0x0a, 0xe0, 0x27, 0xd0, 0x1a, 0x79, 0xf2, 0x23, 0x47, 0x90, 0xbc, 0x12, 0xe8, 0x7a, 0x2b, 0xea, 0x1f, 0xc3, 0xd8, 0x8e, 0x61, 0x9f, 0x11, 0x93, 0x7d, 0xab, 0x06, 0x84, 0x79, 0x32, 0xc4, 0xe4, 0x6e, 0x67, 0x3c, 0x8c, 0x0a, 0x79, 0x5f, 0x2a, 0xae, 0x04, 0x5c, 0x12, 0xf3, 0x07, 0x6c, 0xcd, 0x88, 0x33, 0x6f, 0xf8, 0x3f, 0x8f, 0xa3, 0x24, 0x79, 0x06, 0x4b, 0x01, 0x56, 0x46, 0xbc, 0xf2, 0xba, 0x5b, 0xa4, 0x94, 0xaf, 0xf8, 0xff, 0xad, 0xed, 0xe8, 0x7a, 0xda, 0x86, 0x81, 0xef, 0xfb, 0x15, 0x11, 0xe2, 0x01, 0xa4, 0x86, 0x4c, 0x6c, 0x0f, 0x13, 0x28, 0x91, 0x58, 0x61, 0x7c, 0x68, 0x5a, 0x8b, 0x02, 0x8c, 0x6d, 0x9a, 0x98, 0x93, 0x96, 0xd6, 0xa3, 0x71, 0xa2, 0x38, 0xa1, 0xaa, 0x10, 0xff, 0x7d, 0x77, 0xf6, 0x25, 0xb5, 0x93, 0xd2, 0xa1, 0x35, 0x7b, 0xa9, 0xe2, 0xf8, 0xd2, 0x3b, 0xdb, 0xe7, 0xf3, 0x9d, 0xed, 0xbb, 0x73, 0xf1, 0xe9, 0x04, 0xa7, 0xba, 0x62, 0xef, 0xc0, 0x2e, 0xaa, 0xee, 0x71, 0x1d, 0x58, 0x9f, 0x98, 0x12, 0x1e, 0x53, 0x58, 0xdf, 0x40, 0x02, 0x22, 0xcf, 0xf7, 0x01, 0x35, 0x2b, 0x73, 0xee, 0xf4, 0x59, 0x1e, 0x41, 0xd5, 0xbc, 0x0a, 0xf5, 0x89, 0xbd, 0x56, 0xa4, 0x31, 0xee, 0xf2, 0x54, 0x42, 0xe5, 0x9f, 0x68, 0x07, 0xb9, 0x31, 0x4d, 0x40, 0x3c, 0x82, 0xd4, 0x5b, 0xc8, 0x07, 0x3e, 0x9b, 0xed, 0x51, 0x6b, 0x78, 0xea, 0x0d, 0x80, 0x53, 0x2a, 0x02, 0xbc, 0xc0, 0x2c, 0x11, 0xc5, 0x13, 0x0c, 0x6d, 0x06, 0x23, 0xc9, 0x97, 0xb1, 0xa7, 0x1c, 0x16, 0xe1, 0xe4, 0xc3, 0x89, 0xda, 0xa0, 0x7d, 0x43, 0x42, 0x8d, 0x4e, 0x8e, 0x23, 0x50, 0xd9, 0x60, 0xb8, 0xbd, 0xf0, 0xb8, 0x3f, 0x74, 0x95, 0xb2, 0xe1, 0x6a, 0x6b, 0xda, 0xa5, 0xad, 0x2f, 0x77, 0x48, 0xbd, 0xe3, 0xde, 0xbc, 0x03, 0x2b, 0xed, 0xad, 0x57, 0x00, 0x87, 0x78, 0x18, 0x66, 0x3c, 0xd0, 0xba, 0x89, 0xbd, 0x53, 0xe6, 0x0c, 0xeb, 0xce, 0x54, 0xed, 0xfa, 0x1a, 0x2a, 0x87, 0x25, 0xac, 0xa9, 0xba, 0x59, 0x05, 0xd1, 0xc0, 0x39, 0x41, 0x8c, 0xf7, 0xdf, 0x1a, 0x17, 0x61, 0x75, 0x3c, 0x4d, 0x85, 0x77, 0x94, 0x8f, 0x80, 0x9b, 0xd2, 0x0b, 0x50, 0x3f, 0x83, 0xea, 0x39, 0x1c, 0x7c, 0x21, 0x1a, 0xf1, 0x11, 0xfe, 0x3e, 0xca, 0x99, 0xa9, 0x1c, 0x6e, 0x8a, 0x3d, 0x19, 0xbb, 0x22, 0x75, 0xc1, 0xb2, 0xf2, 0x4e, 0x40, 0xdf, 0x47, 0xeb, 0x09, 0xb5, 0x14, 0x0c, 0x09, 0x92, 0x07, 0xad, 0x37, 0x44, 0x09, 0xf2, 0x24, 0x95, 0xbb, 0x22, 0xe3, 0x33, 0x7c, 0x21, 0x41, 0x2f, 0x7c, 0xef, 0x31, 0xdd, 0xf0, 0x5a, 0x57, 0x92, 0xc1, 0x52, 0x6d, 0xea, 0xab, 0x48, 0x87, 0x06, 0x15, 0x1a, 0xa2, 0x3b, 0x32, 0xf2, 0x34, 0x2a, 0x60, 0x4a, 0x30, 0xe0, 0x18, 0xef, 0xfa, 0xfa, 0xfc, 0x38, 0xc0, 0x1f, 0xc2, 0x87, 0xe1, 0x30, 0x3b, 0x44, 0xc5, 0x16, 0xa5, 0x9c, 0x4a, 0x30, 0x96, 0x13, 0xf6, 0x61, 0xdf, 0x43, 0x26, 0x63, 0xa2, 0x18, 0x5c, 0x1d, 0x05, 0xcb, 0x47, 0x42, 0x5c, 0x6b, 0xee, 0x5a, 0x61, 0xdf, 0xb4, 0xd7, 0xe7, 0xf3, 0xf9, 0x9e, 0x44, 0x13, 0xef, 0xb7, 0x54, 0x84, 0x04, 0xca, 0xde, 0x73, 0x2f, 0xc2, 0x0a, 0x5d, 0xae, 0x76, 0x89, 0x47, 0x1d, 0xf1, 0x5a, 0x01, 0x1a, 0x00, 0xde, 0x2f, 0x8f, 0x25, 0xa1, 0xbb, 0xa2, 0x17, 0xfd, 0xb0, 0xc2, 0x08, 0x55, 0x8e, 0xda, 0x27, 0xd7, 0x79, 0x9f, 0x37, 0x42, 0x37, 0x62, 0x5c, 0x2e, 0x4a, 0xae, 0x51, 0x1d, 0x63, 0x01, 0xad, 0x5c, 0x3d, 0x80, 0xbc, 0x33, 0x2c, 0x8f, 0xbc, 0x18, 0x43, 0xf7, 0xe1, 0xb4, 0x09, 0x6e, 0x78, 0x31, 0x6e, 0x76, 0x5d, 0x84, 0x56, 0x26, 0x88, 0xf4, 0x8d, 0xa5, 0x35, 0x0e, 0x16, 0xba, 0x49, 0xc8, 0x38, 0xe7, 0x59, 0x01, 0xf5, 0x93, 0xbd, 0x34, 0x9f, 0x40, 0x27, 0xc2, 0xbb, 0x50, 0xbd, 0x23, 0xd4, 0x4a, 0x4b, 0x65, 0x49, 0xa2, 0xb6, 0xce, 0x01, 0xac, 0x54, 0xce, 0x80, 0x1b, 0xe1, 0xce, 0x40, 0xbb, 0x42, 0x31, 0xcf, 0x53, 0x8d, 0x73, 0x48, 0xe5, 0xf3, 0x01, 0xe1, 0xec, 0xac, 0x95, 0xc6, 0xb4, 0x00, 0x93, 0x05, 0x95, 0x6d, 0x7e, 0x5f, 0x09, 0x02, 0x57, 0xf9, 0x78, 0x54, 0xf2, 0xb0, 0x8a, 0x95, 0xa6, 0xf0, 0x1b, 0xef, 0x9c, 0x4f, 0x1d, 0x8d, 0xac, 0x29, 0x98, 0xf9, 0x04, 0x57, 0x11, 0xb5, 0xf0, 0x48, 0xb5, 0xe6, 0x54, 0x4a, 0xaf, 0x5b, 0x2b, 0xa3, 0x6e, 0x92, 0x8e, 0xca, 0xd9, 0x98, 0x16, 0x99, 0x3a, 0x47, 0x42, 0x6d, 0x59, 0x62, 0x06, 0x70, 0xa8, 0xaf, 0x67, 0x72, 0x4b, 0x69, 0xd6, 0xdf, 0xff, 0xda, 0xed, 0xdd, 0xb6, 0xc2, 0x4c, 0xae, 0x31, 0x97, 0x49, 0x5b, 0x5d, 0x6f, 0x99, 0xab, 0xad, 0x8e, 0x57, 0x84, 0x89, 0x7c, 0x29, 0xcb, 0xbb, 0x4e, 0xeb, 0xbe, 0xef, 0x58, 0xe1, 0xc3, 0x28, 0xc6, 0xce, 0xea, 0x44, 0xcf, 0x4c, 0x48, 0x34, 0x5a, 0xa5, 0x91, 0x3a, 0xda, 0x59, 0x9b, 0x19, 0x1a, 0x3f, 0x40, 0x32, 0x8b, 0xd7, 0x83, 0xa3, 0xff, 0x67, 0x0d, 0x6d, 0x1e, 0x04, 0x9d, 0xae, 0xf6, 0xbf, 0x5c, 0x9d, 0xdd, 0xae, 0x76, 0x83, 0x12, 0x0d, 0x37, 0xa8, 0x47, 0x4d, 0xbe, 0x76, 0x80, 0x12, 0x86, 0x9f, 0x21, 0x27, 0x40, 0xb1, 0x74, 0x8d, 0xe4, 0xb5, 0x9f, 0xa1, 0xf8, 0xab, 0x9f, 0x21, 0xfd, 0xaf, 0xd2, 0x9c, 0x0e, 0xb6, 0x7a, 0x62, 0xf7, 0xd9, 0x8a, 0x87, 0x2b, 0xfc, 0x0b, 0x3c, 0x3c, 0xe0, 0xbe, 0xb0, 0xae, 0xeb, 0xfb, 0xdc, 0xba, 0x23, 0xe4, 0xcf, 0xec, 0xab, 0x0f, 0x2b, 0x8e, 0x64, 0xcc, 0x32, 0x9e, 0xc9, 0xac, 0x4a, 0x57, 0xd3, 0x08, 0x03, 0xcb, 0x0d, 0x3a, 0xee, 0x5f, 0x3a, 0xe0, 0xb8, 0xb7, 0x8f, 0x60, 0x32, 0xff, 0x16, 0xe9, 0x4d, 0xfc, 0xcc, 0xba, 0x5b, 0xe4, 0x27, 0xf6, 0x15, 0x20, 0x3f, 0xb4, 0xae, 0x79, 0x59, 0x1e, 0x3b, 0x87, 0x51, 0xfb, 0x8e, 0x08, 0x00, 0x58, 0xbe, 0x14, 0xfe, 0x9d, 0xf9, 0xc1, 0xb4, 0xf5, 0x41, 0x69, 0x7b, 0xf9, 0xf4, 0xb6, 0xfd, 0x72, 0xc5, 0xfd, 0xdb, 0xed, 0x46, 0x83, 0xe3, 0xe5, 0xdd, 0x0c, 0x5a, 0x5a, 0xef, 0x68, 0x78, 0xea, 0x6b, 0x84, 0x77, 0x35, 0x88, 0x12, 0x72, 0x18, 0x11, 0x63, 0x5c, 0x57, 0x96, 0x8d, 0x4a, 0xdc, 0xa0, 0xa0, 0xca, 0xac, 0x71, 0x74, 0x2d, 0x54, 0x59, 0x73, 0xd0, 0x25, 0x5f, 0x7a, 0x70, 0x81, 0xf8, 0x21, 0xf7, 0xad, 0x8f, 0x8b, 0xf3, 0xd1, 0xce, 0x56, 0x9e, 0xa6, 0x05, 0xf0, 0x5c, 0xa6, 0x8f, 0xe1, 0xce, 0x76, 0xbe, 0x8b, 0xde, 0x13, 0xbe, 0x3b, 0x90, 0xbc, 0x07, 0xb0, 0x4e, 0x8c, 0xed, 0xc9, 0xc7, 0x30, 0x14, 0x14, 0x9d, 0xfc, 0xc7, 0xd9, 0x4e, 0x59, 0xf4, 0x9e, 0x32, 0x86, 0x5e, 0xab, 0x1e, 0xe6, 0x3a, 0x49, 0xb2, 0x54, 0xe0, 0xa6, 0xc7, 0x83, 0x04, 0xce, 0xb2, 0x6a, 0x29, 0x43, 0xeb, 0x7a, 0x98, 0x2a, 0xfd, 0xaa, 0x01, 0x35, 0xe2, 0x4d, 0x28, 0x15, 0xd9, 0xdc, 0x80, 0xb8, 0x6e, 0x41, 0xc8, 0x85, 0x24, 0x4f, 0x5d, 0x03, 0xec, 0xa6, 0x05, 0xa6, 0x55, 0x19, 0x13, 0xe6, 0x5b, 0x0b, 0x46, 0x19, 0x16, 0x26, 0xc8, 0x29, 0x80, 0xfc, 0xc4, 0x79, 0x73, 0xc9, 0x77, 0x0f, 0xdf, 0xfc, 0x01, 0xd6, 0xcb, 0x1c, 0x8d, 0x04, 0x40, 0x01, 0x00
+const embedded_asset_t WEBUI_ASSETS[] = {
+    {"/assets/index-hxlA0njG.css", "text/css", webui_asset_0, 9988, true, true, "\"53cce695b41fdd60\""},
+    {"/assets/index-zntHLvnE.js", "application/javascript", webui_asset_1, 25886, true, true, "\"ab66d90e4aa19365\""},
+    {"/index.html", "text/html", webui_asset_2, 285, true, false, "\"6af97a45e5cc989d\""},
 };
-const size_t webui_js_gz_len = 25886;
-const char webui_js_mime[] = "application/javascript";
-const bool webui_js_compressed = true;
+
+#define WEBUI_ASSET_COUNT 3
+#define WEBUI_INDEX_ASSET 2  // Entry for /index.html, -1 if there isn't one
+
+// Perfect hash: slot (hash & WEBUI_ASSET_SLOT_MASK) holds the only asset that can match
+#define WEBUI_ASSET_HASH_SEED 0x811c9dc5u
+#define WEBUI_ASSET_SLOT_MASK 7
+const int16_t WEBUI_ASSET_SLOTS[8] = {-1, 2, -1, -1, 0, 1, -1, -1};
 
 #endif // EMBEDDED_WEBUI_H
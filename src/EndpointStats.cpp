@@ -0,0 +1,112 @@
+#include "EndpointStats.h"
+
+#include "Trace.h"
+
+EndpointProbe *EndpointProbe::current = nullptr;
+
+EndpointStats &EndpointStats::getInstance()
+{
+    static EndpointStats instance;
+    return instance;
+}
+
+EndpointStats::EndpointStats()
+{
+    memset(entries, 0, sizeof(entries));
+    entryCount = 0;
+    statsLock  = portMUX_INITIALIZER_UNLOCKED;
+}
+
+void EndpointStats::record(const char *name, uint32_t heapBytes, uint32_t largestBlock,
+                           uint32_t durationUs)
+{
+    portENTER_CRITICAL(&statsLock);
+    endpoint_stats_t *entry = nullptr;
+    for (int i = 0; i < entryCount && entry == nullptr; i++)
+    {
+        if (entries[i].name == name || strcmp(entries[i].name, name) == 0)
+        {
+            entry = &entries[i];
+        }
+    }
+    if (entry == nullptr && entryCount < ENDPOINT_STATS_MAX_ENDPOINTS)
+    {
+        entry                  = &entries[entryCount++];
+        entry->name            = name;
+        entry->minLargestBlock = UINT32_MAX;
+    }
+    if (entry != nullptr)
+    {
+        entry->requests++;
+        entry->lastHeapBytes   = heapBytes;
+        entry->peakHeapBytes   = max(entry->peakHeapBytes, heapBytes);
+        entry->minLargestBlock = min(entry->minLargestBlock, largestBlock);
+        entry->totalUs += durationUs;
+        entry->maxUs = max(entry->maxUs, durationUs);
+    }
+    portEXIT_CRITICAL(&statsLock);
+}
+
+int EndpointStats::snapshot(endpoint_stats_t *out)
+{
+    portENTER_CRITICAL(&statsLock);
+    int count = entryCount;
+    memcpy(out, entries, count * sizeof(endpoint_stats_t));
+    portEXIT_CRITICAL(&statsLock);
+    return count;
+}
+
+void EndpointStats::reportStats(JsonObject out)
+{
+    endpoint_stats_t copy[ENDPOINT_STATS_MAX_ENDPOINTS];
+    int              count = snapshot(copy);
+
+    for (int i = 0; i < count; i++)
+    {
+        JsonObject endpoint                = out.createNestedObject(copy[i].name);
+        endpoint["requests"]               = copy[i].requests;
+        endpoint["peak_heap_bytes"]        = copy[i].peakHeapBytes;
+        endpoint["last_heap_bytes"]        = copy[i].lastHeapBytes;
+        endpoint["min_largest_free_block"] = copy[i].minLargestBlock;
+        endpoint["avg_us"] =
+            copy[i].requests > 0 ? (uint32_t) (copy[i].totalUs / copy[i].requests) : 0;
+        endpoint["max_us"] = copy[i].maxUs;
+    }
+}
+
+EndpointProbe::EndpointProbe(const char *name) : name(name)
+{
+    previous        = current;
+    current         = this;
+    startFree       = ESP.getFreeHeap();
+    minFree         = startFree;
+    minLargestBlock = ESP.getMaxAllocHeap();
+    startUs         = esp_timer_get_time();
+}
+
+EndpointProbe::~EndpointProbe()
+{
+    sample();
+    int64_t endUs = esp_timer_get_time();
+    endpointStats.record(name, startFree > minFree ? startFree - minFree : 0, minLargestBlock,
+                         (uint32_t) (endUs - startUs));
+#ifdef ENABLE_TRACING
+    // Every probed handler shows up in the trace under its route
+    tracer.record(name, startUs, endUs);
+#endif
+    current = previous;
+}
+
+void EndpointProbe::sample()
+{
+    minFree         = min(minFree, (uint32_t) ESP.getFreeHeap());
+    minLargestBlock = min(minLargestBlock, (uint32_t) ESP.getMaxAllocHeap());
+}
+
+void EndpointProbe::sampleCurrent()
+{
+    if (current != nullptr)
+    {
+        current->sample();
+    }
+}
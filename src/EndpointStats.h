@@ -0,0 +1,81 @@
+#ifndef ENDPOINT_STATS_H
+#define ENDPOINT_STATS_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <esp_timer.h>
+
+#define ENDPOINT_STATS_MAX_ENDPOINTS 32
+
+typedef struct
+{
+    const char *name;  // Route literal, compared by pointer first
+    uint32_t    requests;
+    uint32_t    peakHeapBytes;  // Most internal heap one request has held at once
+    uint32_t    lastHeapBytes;
+    uint32_t    minLargestBlock;  // Smallest largest-free-block seen while handling it
+    uint64_t    totalUs;          // Time spent in the handler, summed over requests
+    uint32_t    maxUs;
+} endpoint_stats_t;
+
+// Heap cost of each HTTP endpoint, so changes to how responses are built show up as
+// numbers in /system_health rather than as a guess
+class EndpointStats
+{
+   private:
+    endpoint_stats_t entries[ENDPOINT_STATS_MAX_ENDPOINTS];
+    int              entryCount;
+    portMUX_TYPE     statsLock;
+
+    EndpointStats();
+
+    // Delete copy constructor and assignment operator
+    EndpointStats(const EndpointStats &)            = delete;
+    EndpointStats &operator=(const EndpointStats &) = delete;
+
+   public:
+    // Singleton access method
+    static EndpointStats &getInstance();
+
+    void record(const char *name, uint32_t heapBytes, uint32_t largestBlock,
+                uint32_t durationUs);
+    void reportStats(JsonObject out);
+
+    // Copy every entry into out (ENDPOINT_STATS_MAX_ENDPOINTS long); returns the count
+    int snapshot(endpoint_stats_t *out);
+};
+
+// Convenience macro for easier access
+#define endpointStats EndpointStats::getInstance()
+
+// Put one at the top of a handler. Heap is sampled when it is created, whenever
+// sampleCurrent() is called (e.g. once the payload is serialized) and when it goes out of
+// scope; the largest drop from the starting free heap is recorded against the endpoint,
+// along with the time from creation to destruction.
+// Handlers all run on the async_tcp task, so one probe is current at a time.
+class EndpointProbe
+{
+   private:
+    static EndpointProbe *current;
+
+    const char    *name;
+    EndpointProbe *previous;
+    uint32_t       startFree;
+    uint32_t       minFree;
+    uint32_t       minLargestBlock;
+    int64_t        startUs;
+
+    void sample();
+
+    // Delete copy constructor and assignment operator
+    EndpointProbe(const EndpointProbe &)            = delete;
+    EndpointProbe &operator=(const EndpointProbe &) = delete;
+
+   public:
+    explicit EndpointProbe(const char *name);
+    ~EndpointProbe();
+
+    static void sampleCurrent();
+};
+
+#endif  // ENDPOINT_STATS_H
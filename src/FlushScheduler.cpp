@@ -0,0 +1,188 @@
+#include "FlushScheduler.h"
+
+#include <esp_system.h>
+
+#include "JobScheduler.h"
+#include "Logger.h"
+#include "TimeBase.h"
+
+// Longest flushAll() waits for a flush already running on another task
+#define FLUSH_ALL_WAIT_MS 2000
+
+static const char *PRIORITY_NAMES[FLUSH_PRIORITY_COUNT] = {"immediate", "normal", "lazy"};
+
+FlushScheduler &FlushScheduler::getInstance()
+{
+    static FlushScheduler instance;
+    return instance;
+}
+
+FlushScheduler::FlushScheduler()
+{
+    memset(stores, 0, sizeof(stores));
+    storeCount                 = 0;
+    intervals[FLUSH_IMMEDIATE] = 0;
+    intervals[FLUSH_NORMAL]    = FLUSH_NORMAL_INTERVAL_MS;
+    intervals[FLUSH_LAZY]      = FLUSH_LAZY_INTERVAL_MS;
+    schedulerLock              = portMUX_INITIALIZER_UNLOCKED;
+    flushing                   = false;
+    // Recursive so a restart from inside a flush callback can still run the final flush
+    flushMutex = xSemaphoreCreateRecursiveMutex();
+}
+
+void FlushScheduler::begin()
+{
+    esp_register_shutdown_handler(shutdownHandler);
+    jobScheduler.schedulePeriodic("flush", FLUSH_POLL_INTERVAL_MS, JOB_PRIORITY_LOW,
+                                  [this]() { loop(); });
+
+    // The brownout detector resets the chip straight from its interrupt, so there is no
+    // chance to flush; say how much could have been lost instead
+    if (esp_reset_reason() == ESP_RST_BROWNOUT)
+    {
+        logger.logf("Reset by brownout, up to %lu s of history may not have reached flash",
+                    intervals[FLUSH_LAZY] / 1000);
+    }
+}
+
+void FlushScheduler::shutdownHandler()
+{
+    flushScheduler.flushAll("restart");
+}
+
+flush_store_t FlushScheduler::registerStore(const char *name, flush_priority_t priority,
+                                            FlushCallback flush)
+{
+    if (storeCount >= FLUSH_MAX_STORES)
+    {
+        logger.logf("Can't schedule flushes for %s, too many stores", name);
+        return FLUSH_STORE_NONE;
+    }
+
+    portENTER_CRITICAL(&schedulerLock);
+    flush_store_t store      = storeCount;
+    stores[store].name       = name;
+    stores[store].priority   = priority;
+    stores[store].dirty      = false;
+    stores[store].urgent     = false;
+    stores[store].dirtySince = 0;
+    stores[store].flushes    = 0;
+    portEXIT_CRITICAL(&schedulerLock);
+
+    // The callback isn't touched by markDirty(), so it can be assigned outside the lock
+    stores[store].flush = flush;
+    storeCount++;
+    return store;
+}
+
+void FlushScheduler::markDirty(flush_store_t store, bool urgent)
+{
+    if (store < 0 || store >= storeCount)
+    {
+        return;
+    }
+    unsigned long now = timeBase.nowMs();
+
+    portENTER_CRITICAL(&schedulerLock);
+    if (!stores[store].dirty)
+    {
+        stores[store].dirty      = true;
+        stores[store].dirtySince = now;
+    }
+    stores[store].urgent = stores[store].urgent || urgent;
+    portEXIT_CRITICAL(&schedulerLock);
+}
+
+void FlushScheduler::flushStore(int index)
+{
+    // Cleared first so anything changed while the callback runs marks the store again
+    portENTER_CRITICAL(&schedulerLock);
+    stores[index].dirty  = false;
+    stores[index].urgent = false;
+    portEXIT_CRITICAL(&schedulerLock);
+
+    stores[index].flush();
+    stores[index].flushes++;
+}
+
+void FlushScheduler::loop()
+{
+    // Skip this pass if another task is in flushAll()
+    if (xSemaphoreTakeRecursive(flushMutex, 0) != pdTRUE)
+    {
+        return;
+    }
+
+    unsigned long now = timeBase.nowMs();
+    for (int i = 0; i < storeCount; i++)
+    {
+        portENTER_CRITICAL(&schedulerLock);
+        bool due = stores[i].dirty && (stores[i].urgent || now - stores[i].dirtySince >=
+                                                               intervals[stores[i].priority]);
+        portEXIT_CRITICAL(&schedulerLock);
+
+        if (due)
+        {
+            flushStore(i);
+        }
+    }
+
+    xSemaphoreGiveRecursive(flushMutex);
+}
+
+void FlushScheduler::flushAll(const char *reason)
+{
+    if (flushing)
+    {
+        return;  // Restart requested by a flush callback; the outer flushAll finishes
+    }
+    if (xSemaphoreTakeRecursive(flushMutex, pdMS_TO_TICKS(FLUSH_ALL_WAIT_MS)) != pdTRUE)
+    {
+        return;
+    }
+    flushing = true;
+
+    // Logged first so the line makes it into the log file's own flush
+    logger.logf("Flushing all stores before %s", reason);
+    for (int i = 0; i < storeCount; i++)
+    {
+        if (stores[i].dirty)
+        {
+            flushStore(i);
+        }
+    }
+
+    flushing = false;
+    xSemaphoreGiveRecursive(flushMutex);
+}
+
+void FlushScheduler::setInterval(flush_priority_t priority, unsigned long intervalMs)
+{
+    if (priority < FLUSH_PRIORITY_COUNT)
+    {
+        intervals[priority] = intervalMs;
+    }
+}
+
+unsigned long FlushScheduler::getInterval(flush_priority_t priority)
+{
+    return priority < FLUSH_PRIORITY_COUNT ? intervals[priority] : 0;
+}
+
+void FlushScheduler::reportStats(JsonObject out)
+{
+    JsonObject intervalsOut = out.createNestedObject("intervals_ms");
+    for (int i = 0; i < FLUSH_PRIORITY_COUNT; i++)
+    {
+        intervalsOut[PRIORITY_NAMES[i]] = intervals[i];
+    }
+
+    JsonObject storesOut = out.createNestedObject("stores");
+    for (int i = 0; i < storeCount; i++)
+    {
+        JsonObject store  = storesOut.createNestedObject(stores[i].name);
+        store["priority"] = PRIORITY_NAMES[stores[i].priority];
+        store["dirty"]    = stores[i].dirty;
+        store["flushes"]  = stores[i].flushes;
+    }
+}
@@ -0,0 +1,97 @@
+#ifndef FLUSH_SCHEDULER_H
+#define FLUSH_SCHEDULER_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+#include <functional>
+
+#define FLUSH_MAX_STORES 8
+
+// How long a store may stay dirty before it is written, by priority
+#define FLUSH_NORMAL_INTERVAL_MS 30000
+#define FLUSH_LAZY_INTERVAL_MS 300000
+// How often loop() runs, which is also how soon an immediate store is written
+#define FLUSH_POLL_INTERVAL_MS 100
+
+typedef enum
+{
+    FLUSH_IMMEDIATE = 0,  // Written on the next loop() pass (pause attempts)
+    FLUSH_NORMAL    = 1,  // Log file, job index
+    FLUSH_LAZY      = 2,  // Chart history that is rebuilt from RAM anyway
+    FLUSH_PRIORITY_COUNT
+} flush_priority_t;
+
+// Handle to a registered store, returned by registerStore()
+typedef int flush_store_t;
+
+#define FLUSH_STORE_NONE -1
+
+typedef std::function<void()> FlushCallback;
+
+typedef struct
+{
+    const char      *name;
+    flush_priority_t priority;
+    FlushCallback    flush;
+    bool             dirty;
+    bool             urgent;      // Flush on the next pass regardless of priority
+    unsigned long    dirtySince;  // timeBase.nowMs() of the first change since the last flush
+    uint32_t         flushes;
+} flush_store_entry_t;
+
+// Write-back for everything the firmware keeps on flash. Stores keep their changes in RAM
+// and call markDirty(); loop() runs a store's flush callback once it has been dirty for its
+// priority's interval, so a burst of changes becomes one open/write/close. markDirty() may
+// be called from any task; flushes run on the main loop, or on whichever task calls
+// flushAll() before the flash is about to go away (OTA, restart).
+class FlushScheduler
+{
+   private:
+    flush_store_entry_t stores[FLUSH_MAX_STORES];
+    int                 storeCount;
+    unsigned long       intervals[FLUSH_PRIORITY_COUNT];
+    portMUX_TYPE        schedulerLock;
+    SemaphoreHandle_t   flushMutex;  // Held while flushing, so only one task writes at a time
+    bool                flushing;
+
+    FlushScheduler();
+
+    // Delete copy constructor and assignment operator
+    FlushScheduler(const FlushScheduler &)            = delete;
+    FlushScheduler &operator=(const FlushScheduler &) = delete;
+
+    void flushStore(int index);
+
+    static void shutdownHandler();
+
+   public:
+    // Singleton access method
+    static FlushScheduler &getInstance();
+
+    // Hook the final flush into esp_restart() and schedule loop() as a job; call once
+    // from setup()
+    void begin();
+
+    // name must outlive the scheduler
+    flush_store_t registerStore(const char *name, flush_priority_t priority, FlushCallback flush);
+
+    // Note that store has unwritten changes. urgent skips the priority's interval.
+    void markDirty(flush_store_t store, bool urgent = false);
+
+    // Flush the stores that are due
+    void loop();
+
+    // Write every dirty store now
+    void flushAll(const char *reason);
+
+    void          setInterval(flush_priority_t priority, unsigned long intervalMs);
+    unsigned long getInterval(flush_priority_t priority);
+
+    void reportStats(JsonObject out);
+};
+
+// Convenience macro for easier access
+#define flushScheduler FlushScheduler::getInstance()
+
+#endif  // FLUSH_SCHEDULER_H
@@ -0,0 +1,250 @@
+#include "ImprovSerial.h"
+
+#include <WiFi.h>
+
+#include "ConnectivityManager.h"
+#include "JobScheduler.h"
+#include "Logger.h"
+#include "SettingsManager.h"
+
+extern const char *firmwareVersion;
+extern const char *chipFamily;
+
+ImprovSerial &ImprovSerial::getInstance()
+{
+    static ImprovSerial instance;
+    return instance;
+}
+
+ImprovSerial::ImprovSerial()
+{
+    task               = nullptr;
+    position           = 0;
+    scanning           = false;
+    pendingLock        = portMUX_INITIALIZER_UNLOCKED;
+    credentialsPending = false;
+    memset(buffer, 0, sizeof(buffer));
+    memset(pendingSsid, 0, sizeof(pendingSsid));
+    memset(pendingPassword, 0, sizeof(pendingPassword));
+}
+
+static std::vector<std::string> getLocalUrl()
+{
+    return {// URL where user can finish onboarding or use device
+            // Recommended to use website hosted by device
+            String("http://" + WiFi.localIP().toString()).c_str()};
+}
+
+static void onImprovError(improv::Error err)
+{
+    logger.logf("Improv error: %d", err);
+}
+
+void ImprovSerial::begin()
+{
+    if (task != nullptr)
+    {
+        return;
+    }
+    if (xTaskCreate(taskEntry, "improv", IMPROV_TASK_STACK, this, IMPROV_TASK_PRIORITY, &task) !=
+        pdPASS)
+    {
+        task = nullptr;
+        logger.log("Failed to start the improv serial task");
+        return;
+    }
+
+    // Runs on the UART event task whenever the driver has received bytes
+    Serial.onReceive([this]() { xTaskNotifyGive(task); });
+
+    jobScheduler.schedulePeriodic("improv_apply", IMPROV_APPLY_INTERVAL_MS, JOB_PRIORITY_LOW,
+                                  [this]() { applyCredentials(); });
+}
+
+void ImprovSerial::taskEntry(void *param)
+{
+    ((ImprovSerial *) param)->run();
+}
+
+void ImprovSerial::run()
+{
+    while (true)
+    {
+        // The timeout covers a scan in progress and bytes the driver didn't report
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(IMPROV_WAKE_INTERVAL_MS));
+        readAvailable();
+        if (scanning)
+        {
+            checkScan();
+        }
+    }
+}
+
+void ImprovSerial::readAvailable()
+{
+    while (Serial.available() > 0)
+    {
+        uint8_t b = Serial.read();
+
+        if (position < IMPROV_BUFFER_SIZE &&
+            improv::parse_improv_serial_byte(
+                position, b, buffer, [this](improv::ImprovCommand cmd)
+                { return handleCommand(cmd); },
+                onImprovError))
+        {
+            buffer[position++] = b;
+        }
+        else
+        {
+            // Not improv, a finished packet or one too long for the buffer
+            position = 0;
+        }
+    }
+}
+
+bool ImprovSerial::handleCommand(improv::ImprovCommand cmd)
+{
+    switch (cmd.command)
+    {
+        case improv::Command::GET_CURRENT_STATE:
+        {
+            if ((WiFi.status() == WL_CONNECTED))
+            {
+                improv::set_state(improv::State::STATE_PROVISIONED);
+                std::vector<uint8_t> data =
+                    improv::build_rpc_response(improv::GET_CURRENT_STATE, getLocalUrl(), false);
+                improv::send_response(data);
+            }
+            else
+            {
+                improv::set_state(improv::State::STATE_AUTHORIZED);
+            }
+
+            break;
+        }
+
+        case improv::Command::WIFI_SETTINGS:
+        {
+            if (cmd.ssid.length() == 0 || cmd.ssid.length() >= IMPROV_SSID_LEN ||
+                cmd.password.length() >= IMPROV_PASSWORD_LEN)
+            {
+                improv::set_error(improv::Error::ERROR_INVALID_RPC);
+                break;
+            }
+
+            improv::set_state(improv::STATE_PROVISIONING);
+
+            // Applied by the main loop, which answers once the connection succeeds or times out
+            portENTER_CRITICAL(&pendingLock);
+            strlcpy(pendingSsid, cmd.ssid.c_str(), sizeof(pendingSsid));
+            strlcpy(pendingPassword, cmd.password.c_str(), sizeof(pendingPassword));
+            credentialsPending = true;
+            portEXIT_CRITICAL(&pendingLock);
+
+            break;
+        }
+
+        case improv::Command::GET_DEVICE_INFO:
+        {
+            std::vector<std::string> infos = {// Firmware name
+                                              "CC_SFS",
+                                              // Firmware version
+                                              firmwareVersion,
+                                              // Hardware chip/variant
+                                              chipFamily,
+                                              // Device name
+                                              "CC_SFS"};
+            std::vector<uint8_t>     data =
+                improv::build_rpc_response(improv::GET_DEVICE_INFO, infos, false);
+            improv::send_response(data);
+            break;
+        }
+
+        case improv::Command::GET_WIFI_NETWORKS:
+        {
+            // Results are sent from checkScan() when the scan finishes
+            if (!scanning)
+            {
+                scanning = WiFi.scanNetworks(true) == WIFI_SCAN_RUNNING;
+                if (!scanning)
+                {
+                    checkScan();
+                }
+            }
+            break;
+        }
+
+        default:
+        {
+            improv::set_error(improv::ERROR_UNKNOWN_RPC);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void ImprovSerial::checkScan()
+{
+    int networkNum = WiFi.scanComplete();
+    if (networkNum == WIFI_SCAN_RUNNING)
+    {
+        return;
+    }
+    scanning = false;
+
+    // A failed scan still gets the final empty response, so the client stops waiting
+    for (int id = 0; id < networkNum; ++id)
+    {
+        std::vector<uint8_t> data =
+            improv::build_rpc_response(improv::GET_WIFI_NETWORKS,
+                                       {WiFi.SSID(id), String(WiFi.RSSI(id)),
+                                        (WiFi.encryptionType(id) == WIFI_AUTH_OPEN ? "NO" : "YES")},
+                                       false);
+        improv::send_response(data);
+    }
+    WiFi.scanDelete();
+
+    // final response
+    std::vector<uint8_t> data =
+        improv::build_rpc_response(improv::GET_WIFI_NETWORKS, std::vector<std::string>{}, false);
+    improv::send_response(data);
+}
+
+void ImprovSerial::applyCredentials()
+{
+    if (!credentialsPending)
+    {
+        return;
+    }
+
+    char ssid[IMPROV_SSID_LEN];
+    char password[IMPROV_PASSWORD_LEN];
+    portENTER_CRITICAL(&pendingLock);
+    memcpy(ssid, pendingSsid, sizeof(ssid));
+    memcpy(password, pendingPassword, sizeof(password));
+    credentialsPending = false;
+    portEXIT_CRITICAL(&pendingLock);
+
+    settingsManager.setSSID(ssid);
+    settingsManager.setPassword(password);
+    settingsManager.setAPMode(false);
+    settingsManager.save(true);  // skip wifi check, we're about to try connecting
+
+    connectivityManager.applyCredentials(
+        [](bool connected)
+        {
+            if (connected)
+            {
+                improv::set_state(improv::STATE_PROVISIONED);
+                std::vector<uint8_t> data =
+                    improv::build_rpc_response(improv::WIFI_SETTINGS, getLocalUrl(), false);
+                improv::send_response(data);
+            }
+            else
+            {
+                improv::set_state(improv::STATE_STOPPED);
+                improv::set_error(improv::Error::ERROR_UNABLE_TO_CONNECT);
+            }
+        });
+}
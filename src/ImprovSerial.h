@@ -0,0 +1,61 @@
+#ifndef IMPROV_SERIAL_H
+#define IMPROV_SERIAL_H
+
+#include <Arduino.h>
+
+#include "improv.h"
+
+#define IMPROV_TASK_STACK 6144
+#define IMPROV_TASK_PRIORITY 1
+#define IMPROV_BUFFER_SIZE 256        // One packet; SSID and password fit with room to spare
+#define IMPROV_WAKE_INTERVAL_MS 100   // Longest the task sleeps, to follow up on scans
+#define IMPROV_APPLY_INTERVAL_MS 100  // How often the main loop picks up new credentials
+
+#define IMPROV_SSID_LEN 33
+#define IMPROV_PASSWORD_LEN 65
+
+// Improv WiFi provisioning over the serial port, off the main loop. A task of its own
+// wakes when the UART driver reports received bytes, drains everything that arrived and
+// answers the queries it can handle alone; WiFi scans run asynchronously and are reported
+// when they finish. New credentials touch the settings and the connectivity manager, so
+// they are handed to a main-loop job that applies them and replies once connected.
+class ImprovSerial
+{
+   private:
+    TaskHandle_t task;
+    uint8_t      buffer[IMPROV_BUFFER_SIZE];
+    size_t       position;
+    bool         scanning;
+
+    // Credentials waiting for the main loop
+    portMUX_TYPE pendingLock;
+    bool         credentialsPending;
+    char         pendingSsid[IMPROV_SSID_LEN];
+    char         pendingPassword[IMPROV_PASSWORD_LEN];
+
+    ImprovSerial();
+
+    // Delete copy constructor and assignment operator
+    ImprovSerial(const ImprovSerial &)            = delete;
+    ImprovSerial &operator=(const ImprovSerial &) = delete;
+
+    static void taskEntry(void *param);
+    void        run();
+    void        readAvailable();
+    bool        handleCommand(improv::ImprovCommand cmd);
+    void        checkScan();
+    void        applyCredentials();
+
+   public:
+    // Singleton access method
+    static ImprovSerial &getInstance();
+
+    // Start the serial task and the job that applies credentials; call once from setup()
+    // after Serial.begin()
+    void begin();
+};
+
+// Convenience macro for easier access
+#define improvSerial ImprovSerial::getInstance()
+
+#endif  // IMPROV_SERIAL_H
@@ -0,0 +1,318 @@
+#include "JobScheduler.h"
+
+#include <esp_timer.h>
+#include <limits.h>
+
+#include "Logger.h"
+#include "LoopWatchdog.h"
+#include "SystemMetrics.h"
+#include "TimeBase.h"
+#include "Trace.h"
+
+static const char *PRIORITY_NAMES[JOB_PRIORITY_COUNT] = {"high", "normal", "low"};
+
+// True once deadline has been reached; wrap-safe like the millis() comparisons it replaces
+static inline bool isDue(unsigned long deadline, unsigned long now)
+{
+    return (long) (now - deadline) >= 0;
+}
+
+JobScheduler &JobScheduler::getInstance()
+{
+    static JobScheduler instance;
+    return instance;
+}
+
+JobScheduler::JobScheduler()
+{
+    for (int i = 0; i < JOB_MAX_JOBS; i++)
+    {
+        jobs[i].active = false;
+        jobs[i].next   = JOB_NONE;
+    }
+    for (int i = 0; i < JOB_WHEEL_SLOTS; i++)
+    {
+        slots[i] = JOB_NONE;
+    }
+    lastTick  = timeBase.nowMs() / JOB_WHEEL_TICK_MS;
+    idleUs    = 0;
+    statsLock = portMUX_INITIALIZER_UNLOCKED;
+}
+
+job_id_t JobScheduler::schedulePeriodic(const char *name, unsigned long periodMs,
+                                        job_priority_t priority, JobCallback callback,
+                                        unsigned long initialDelayMs)
+{
+    return schedule(name, initialDelayMs, periodMs > 0 ? periodMs : 1, priority, callback);
+}
+
+job_id_t JobScheduler::scheduleOnce(const char *name, unsigned long delayMs,
+                                    job_priority_t priority, JobCallback callback)
+{
+    return schedule(name, delayMs, 0, priority, callback);
+}
+
+job_id_t JobScheduler::schedule(const char *name, unsigned long delayMs, unsigned long periodMs,
+                                job_priority_t priority, JobCallback callback)
+{
+    job_id_t job = JOB_NONE;
+    for (int i = 0; i < JOB_MAX_JOBS; i++)
+    {
+        if (!jobs[i].active)
+        {
+            job = i;
+            break;
+        }
+    }
+    if (job == JOB_NONE)
+    {
+        logger.logf("Can't schedule %s, too many jobs", name);
+        return JOB_NONE;
+    }
+
+    portENTER_CRITICAL(&statsLock);
+    memset(&jobs[job].stats, 0, sizeof(job_stats_t));
+    jobs[job].stats.name     = name;
+    jobs[job].stats.priority = priority;
+    jobs[job].stats.periodMs = periodMs;
+    jobs[job].active         = true;
+    portEXIT_CRITICAL(&statsLock);
+
+    jobs[job].callback = callback;
+    jobs[job].deadline = timeBase.nowMs() + delayMs;
+    insert(job);
+    return job;
+}
+
+void JobScheduler::insert(job_id_t job)
+{
+    // A deadline behind the wheel's position goes in the current slot, which the next
+    // tick() visits again
+    unsigned long tick = jobs[job].deadline / JOB_WHEEL_TICK_MS;
+    if ((long) (tick - lastTick) < 0)
+    {
+        tick = lastTick;
+    }
+    int slot       = tick % JOB_WHEEL_SLOTS;
+    jobs[job].next = slots[slot];
+    slots[slot]    = job;
+}
+
+void JobScheduler::unlink(job_id_t job)
+{
+    for (int slot = 0; slot < JOB_WHEEL_SLOTS; slot++)
+    {
+        for (int *link = &slots[slot]; *link != JOB_NONE; link = &jobs[*link].next)
+        {
+            if (*link == job)
+            {
+                *link          = jobs[job].next;
+                jobs[job].next = JOB_NONE;
+                return;
+            }
+        }
+    }
+}
+
+void JobScheduler::cancel(job_id_t job)
+{
+    if (job < 0 || job >= JOB_MAX_JOBS || !jobs[job].active)
+    {
+        return;
+    }
+    unlink(job);
+    portENTER_CRITICAL(&statsLock);
+    jobs[job].active = false;
+    portEXIT_CRITICAL(&statsLock);
+    jobs[job].callback = nullptr;
+}
+
+void JobScheduler::tick()
+{
+    unsigned long now     = timeBase.nowMs();
+    unsigned long nowTick = now / JOB_WHEEL_TICK_MS;
+
+    // Visit every slot passed since the last call, including the last one again, since a
+    // job due later in that tick stayed behind. After a long gap that's the whole wheel.
+    unsigned long passed = nowTick - lastTick + 1;
+    if (passed > JOB_WHEEL_SLOTS)
+    {
+        passed = JOB_WHEEL_SLOTS;
+    }
+
+    job_id_t      due[JOB_MAX_JOBS];
+    unsigned long dueDeadline[JOB_MAX_JOBS];
+    int           dueCount = 0;
+    for (unsigned long i = 0; i < passed; i++)
+    {
+        int slot = (nowTick - i) % JOB_WHEEL_SLOTS;
+        for (int *link = &slots[slot]; *link != JOB_NONE;)
+        {
+            job_id_t job = *link;
+            if (!isDue(jobs[job].deadline, now))
+            {
+                // Later turn of the wheel
+                link = &jobs[job].next;
+                continue;
+            }
+            *link          = jobs[job].next;
+            jobs[job].next = JOB_NONE;
+
+            // Insertion sort by priority, then deadline
+            int at = dueCount++;
+            while (at > 0 &&
+                   (jobs[due[at - 1]].stats.priority > jobs[job].stats.priority ||
+                    (jobs[due[at - 1]].stats.priority == jobs[job].stats.priority &&
+                     (long) (dueDeadline[at - 1] - jobs[job].deadline) > 0)))
+            {
+                due[at]         = due[at - 1];
+                dueDeadline[at] = dueDeadline[at - 1];
+                at--;
+            }
+            due[at]         = job;
+            dueDeadline[at] = jobs[job].deadline;
+        }
+    }
+    lastTick = nowTick;
+
+    for (int i = 0; i < dueCount; i++)
+    {
+        // An earlier job may have cancelled this one, or cancelled it and reused the entry
+        if (jobs[due[i]].active && jobs[due[i]].deadline == dueDeadline[i] &&
+            jobs[due[i]].next == JOB_NONE)
+        {
+            run(due[i], dueDeadline[i]);
+        }
+    }
+}
+
+void JobScheduler::run(job_id_t job, unsigned long deadline)
+{
+    unsigned long startMs  = timeBase.nowMs();
+    int64_t       startUs  = esp_timer_get_time();
+    unsigned long lateness = startMs - deadline;
+
+    // Copied so the job can cancel or reschedule itself
+    JobCallback callback = jobs[job].callback;
+    loopWatchdog.enterPhase(LOOP_PHASE_JOBS, jobs[job].stats.name);
+    {
+        TRACE_SPAN(jobs[job].stats.name);
+        callback();
+    }
+    loopWatchdog.enterPhase(LOOP_PHASE_JOBS);
+
+    uint32_t      durationUs = esp_timer_get_time() - startUs;
+    unsigned long endMs      = timeBase.nowMs();
+    unsigned long periodMs   = jobs[job].stats.periodMs;
+
+    uint32_t skipped = 0;
+    if (jobs[job].active && periodMs > 0 && jobs[job].deadline == deadline)
+    {
+        unsigned long next = deadline + periodMs;
+        if (isDue(next, endMs))
+        {
+            // Too late for one or more periods; resume on the rate's next step
+            skipped = (endMs - next) / periodMs + 1;
+            next += skipped * periodMs;
+        }
+        jobs[job].deadline = next;
+        insert(job);
+    }
+    else if (periodMs == 0 && jobs[job].deadline == deadline)
+    {
+        cancel(job);
+    }
+
+    portENTER_CRITICAL(&statsLock);
+    job_stats_t &stats = jobs[job].stats;
+    stats.runs++;
+    stats.overruns += skipped;
+    stats.totalUs += durationUs;
+    stats.totalLatenessMs += lateness;
+    if (durationUs > stats.maxUs)
+    {
+        stats.maxUs = durationUs;
+    }
+    if (lateness > stats.maxLatenessMs)
+    {
+        stats.maxLatenessMs = lateness;
+    }
+    portEXIT_CRITICAL(&statsLock);
+}
+
+unsigned long JobScheduler::msUntilNextDeadline()
+{
+    unsigned long now     = timeBase.nowMs();
+    unsigned long nearest = ULONG_MAX;
+    for (int i = 0; i < JOB_MAX_JOBS; i++)
+    {
+        if (!jobs[i].active)
+        {
+            continue;
+        }
+        if (isDue(jobs[i].deadline, now))
+        {
+            return 0;
+        }
+        unsigned long until = jobs[i].deadline - now;
+        if (until < nearest)
+        {
+            nearest = until;
+        }
+    }
+    return nearest;
+}
+
+void JobScheduler::idle(unsigned long maxMs)
+{
+    unsigned long waitMs = min(maxMs, msUntilNextDeadline());
+    if (waitMs == 0)
+    {
+        return;
+    }
+
+    loopWatchdog.idle();
+    int64_t startUs = esp_timer_get_time();
+    vTaskDelay(pdMS_TO_TICKS(waitMs));
+    uint32_t sleptUs = esp_timer_get_time() - startUs;
+
+    idleUs += sleptUs;
+    systemMetrics.recordLoopIdle(sleptUs);
+}
+
+int JobScheduler::snapshot(job_stats_t *out)
+{
+    int count = 0;
+    portENTER_CRITICAL(&statsLock);
+    for (int i = 0; i < JOB_MAX_JOBS; i++)
+    {
+        if (jobs[i].active)
+        {
+            out[count++] = jobs[i].stats;
+        }
+    }
+    portEXIT_CRITICAL(&statsLock);
+    return count;
+}
+
+void JobScheduler::reportStats(JsonObject out)
+{
+    job_stats_t stats[JOB_MAX_JOBS];
+    int         count = snapshot(stats);
+
+    out["idle_ms"]     = (uint32_t) (idleUs / 1000);
+    JsonObject jobsOut = out.createNestedObject("jobs");
+    for (int i = 0; i < count; i++)
+    {
+        uint32_t   runs        = max(stats[i].runs, (uint32_t) 1);
+        JsonObject job         = jobsOut.createNestedObject(stats[i].name);
+        job["priority"]        = PRIORITY_NAMES[stats[i].priority];
+        job["period_ms"]       = stats[i].periodMs;
+        job["runs"]            = stats[i].runs;
+        job["avg_us"]          = (uint32_t) (stats[i].totalUs / runs);
+        job["max_us"]          = stats[i].maxUs;
+        job["avg_lateness_ms"] = (uint32_t) (stats[i].totalLatenessMs / runs);
+        job["max_lateness_ms"] = stats[i].maxLatenessMs;
+        job["overruns"]        = stats[i].overruns;
+    }
+}
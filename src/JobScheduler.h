@@ -0,0 +1,113 @@
+#ifndef JOB_SCHEDULER_H
+#define JOB_SCHEDULER_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+#include <functional>
+
+#define JOB_MAX_JOBS 16
+
+// The wheel covers JOB_WHEEL_SLOTS * JOB_WHEEL_TICK_MS; later deadlines wait in their slot
+// for as many turns as they need
+#define JOB_WHEEL_SLOTS 64
+#define JOB_WHEEL_TICK_MS 10
+
+// Document size reportStats() needs
+#define JOB_SCHEDULER_JSON_SIZE \
+    (JSON_OBJECT_SIZE(2) + JSON_OBJECT_SIZE(JOB_MAX_JOBS) + JOB_MAX_JOBS * JSON_OBJECT_SIZE(8))
+
+typedef enum
+{
+    JOB_PRIORITY_HIGH   = 0,  // Detection and anything a pause depends on
+    JOB_PRIORITY_NORMAL = 1,
+    JOB_PRIORITY_LOW    = 2,  // Housekeeping that can slip
+    JOB_PRIORITY_COUNT
+} job_priority_t;
+
+// Handle to a scheduled job, returned by schedulePeriodic() and scheduleOnce()
+typedef int job_id_t;
+
+#define JOB_NONE -1
+
+typedef std::function<void()> JobCallback;
+
+typedef struct
+{
+    const char    *name;
+    job_priority_t priority;
+    unsigned long  periodMs;  // 0 for a one-shot job
+    uint32_t       runs;
+    uint32_t       overruns;  // Periods skipped because the job ran too late to catch up
+    uint64_t       totalUs;
+    uint32_t       maxUs;
+    uint64_t       totalLatenessMs;  // How long after its deadline each run started
+    uint32_t       maxLatenessMs;
+} job_stats_t;
+
+// Cooperative scheduler for the main loop. Jobs sit on a hashed timer wheel keyed by
+// deadline, so tick() only looks at the slots that came due since the last call, and
+// runs what is due in priority order. Periodic jobs keep a fixed rate: the next deadline
+// is counted from the previous one, not from when the job happened to run, and whole
+// periods that were missed are skipped and counted as overruns rather than run back to
+// back. Jobs are scheduled, cancelled and run on the main loop only; reportStats() and
+// snapshot() may be called from any task.
+class JobScheduler
+{
+   private:
+    typedef struct
+    {
+        job_stats_t   stats;
+        JobCallback   callback;
+        unsigned long deadline;  // timeBase.nowMs()
+        bool          active;
+        int           next;  // Next job in the same wheel slot, JOB_NONE at the end
+    } job_entry_t;
+
+    job_entry_t   jobs[JOB_MAX_JOBS];
+    int           slots[JOB_WHEEL_SLOTS];  // Head of each slot's list
+    unsigned long lastTick;                // Wheel position of the last tick() call
+    uint64_t      idleUs;
+    portMUX_TYPE  statsLock;
+
+    JobScheduler();
+
+    // Delete copy constructor and assignment operator
+    JobScheduler(const JobScheduler &)            = delete;
+    JobScheduler &operator=(const JobScheduler &) = delete;
+
+    job_id_t schedule(const char *name, unsigned long delayMs, unsigned long periodMs,
+                      job_priority_t priority, JobCallback callback);
+    void     insert(job_id_t job);
+    void     unlink(job_id_t job);
+    void     run(job_id_t job, unsigned long deadline);
+
+   public:
+    // Singleton access method
+    static JobScheduler &getInstance();
+
+    // Run callback every periodMs, first after initialDelayMs. name must outlive the job.
+    job_id_t schedulePeriodic(const char *name, unsigned long periodMs, job_priority_t priority,
+                              JobCallback callback, unsigned long initialDelayMs = 0);
+    // Run callback once, delayMs from now
+    job_id_t scheduleOnce(const char *name, unsigned long delayMs, job_priority_t priority,
+                          JobCallback callback);
+    void     cancel(job_id_t job);
+
+    // Run the jobs that are due; call from the main loop
+    void tick();
+    // Milliseconds until the earliest deadline, 0 if something is due
+    unsigned long msUntilNextDeadline();
+    // Sleep until the next deadline, but no longer than maxMs; the time is reported to
+    // systemMetrics so the loop histogram keeps measuring work, not sleep
+    void idle(unsigned long maxMs);
+
+    // Copy the stats of every active job into out (JOB_MAX_JOBS long); returns the count
+    int  snapshot(job_stats_t *out);
+    void reportStats(JsonObject out);
+};
+
+// Convenience macro for easier access
+#define jobScheduler JobScheduler::getInstance()
+
+#endif  // JOB_SCHEDULER_H
@@ -0,0 +1,333 @@
+#include "JsonResponse.h"
+
+#include "EndpointStats.h"
+#include "Logger.h"
+
+JsonDocumentPool &JsonDocumentPool::getInstance()
+{
+    static JsonDocumentPool instance;
+    return instance;
+}
+
+JsonDocumentPool::JsonDocumentPool()
+{
+    poolLock  = portMUX_INITIALIZER_UNLOCKED;
+    leases    = 0;
+    fallbacks = 0;
+    peakInUse = 0;
+
+    documentCount = memoryPolicy.hasPsram() ? JSON_POOL_PSRAM_DOCUMENTS : JSON_POOL_INTERNAL_DOCUMENTS;
+    documentCapacity =
+        memoryPolicy.scaleCapacity(JSON_POOL_INTERNAL_CAPACITY, JSON_POOL_PSRAM_CAPACITY);
+
+    int allocated = 0;
+    for (int i = 0; i < JSON_POOL_MAX_DOCUMENTS; i++)
+    {
+        documents[i] = nullptr;
+        inUse[i]     = false;
+        if (i >= documentCount)
+        {
+            continue;
+        }
+
+        ScratchJsonDocument *document = new ScratchJsonDocument(documentCapacity);
+        if (document->capacity() == 0)
+        {
+            // Out of memory; the pool just runs with fewer documents
+            delete document;
+            continue;
+        }
+        documents[allocated++] = document;
+    }
+    documentCount = allocated;
+}
+
+ScratchJsonDocument *JsonDocumentPool::acquire(size_t capacity)
+{
+    if (capacity > documentCapacity)
+    {
+        return nullptr;
+    }
+
+    ScratchJsonDocument *document = nullptr;
+    portENTER_CRITICAL(&poolLock);
+    int active = 0;
+    for (int i = 0; i < documentCount; i++)
+    {
+        if (!inUse[i] && document == nullptr)
+        {
+            inUse[i] = true;
+            document = documents[i];
+        }
+        if (inUse[i])
+        {
+            active++;
+        }
+    }
+    if (document != nullptr)
+    {
+        leases++;
+        peakInUse = max(peakInUse, active);
+    }
+    portEXIT_CRITICAL(&poolLock);
+
+    if (document != nullptr)
+    {
+        document->clear();
+    }
+    return document;
+}
+
+void JsonDocumentPool::release(ScratchJsonDocument *document)
+{
+    portENTER_CRITICAL(&poolLock);
+    for (int i = 0; i < documentCount; i++)
+    {
+        if (documents[i] == document)
+        {
+            inUse[i] = false;
+        }
+    }
+    portEXIT_CRITICAL(&poolLock);
+}
+
+void JsonDocumentPool::recordFallback()
+{
+    portENTER_CRITICAL(&poolLock);
+    fallbacks++;
+    portEXIT_CRITICAL(&poolLock);
+}
+
+void JsonDocumentPool::reportStats(JsonObject out)
+{
+    out["documents"]         = documentCount;
+    out["document_capacity"] = documentCapacity;
+    out["leases"]            = leases;
+    out["fallbacks"]         = fallbacks;
+    out["peak_in_use"]       = peakInUse;
+}
+
+PooledJsonDocument::PooledJsonDocument(size_t capacity)
+{
+    document = jsonDocumentPool.acquire(capacity);
+    pooled   = document != nullptr;
+    if (!pooled)
+    {
+        jsonDocumentPool.recordFallback();
+        document = new ScratchJsonDocument(capacity);
+    }
+}
+
+PooledJsonDocument::~PooledJsonDocument()
+{
+    if (pooled)
+    {
+        jsonDocumentPool.release(document);
+    }
+    else
+    {
+        delete document;
+    }
+}
+
+// Counts what passes through it, forwarding to target when there is one. With no target
+// it sizes a body before a stream is allocated for it.
+class CountingPrint : public Print
+{
+   private:
+    Print *target;
+
+   public:
+    size_t count;
+
+    explicit CountingPrint(Print *target) : target(target), count(0) {}
+
+    size_t write(uint8_t value) override
+    {
+        count++;
+        return target != nullptr ? target->write(value) : 1;
+    }
+
+    size_t write(const uint8_t *buffer, size_t size) override
+    {
+        count += size;
+        return target != nullptr ? target->write(buffer, size) : size;
+    }
+};
+
+// MessagePack container header, using the smallest form that fits
+static void writeMsgPackHeader(Print &out, uint8_t fixBase, uint8_t code16, size_t size)
+{
+    if (size < 16)
+    {
+        out.write((uint8_t) (fixBase | size));
+    }
+    else if (size <= 0xFFFF)
+    {
+        uint8_t header[] = {code16, (uint8_t) (size >> 8), (uint8_t) size};
+        out.write(header, sizeof(header));
+    }
+    else
+    {
+        uint8_t header[] = {(uint8_t) (code16 + 1), (uint8_t) (size >> 24),
+                            (uint8_t) (size >> 16), (uint8_t) (size >> 8), (uint8_t) size};
+        out.write(header, sizeof(header));
+    }
+}
+
+static void writeMsgPackMap(Print &out, size_t size)
+{
+    writeMsgPackHeader(out, 0x80, 0xde, size);
+}
+
+static void writeMsgPackArray(Print &out, size_t size)
+{
+    writeMsgPackHeader(out, 0x90, 0xdc, size);
+}
+
+static void writeMsgPackString(Print &out, JsonString value)
+{
+    size_t length = value.size();
+    if (length < 32)
+    {
+        out.write((uint8_t) (0xa0 | length));
+    }
+    else if (length <= 0xFF)
+    {
+        uint8_t header[] = {0xd9, (uint8_t) length};
+        out.write(header, sizeof(header));
+    }
+    else
+    {
+        // str16/str32 share the array header layout
+        writeMsgPackHeader(out, 0, 0xda, length);
+    }
+    out.write((const uint8_t *) value.c_str(), length);
+}
+
+// rows as {field: [value per row]}, fields in the order of the first row
+static void writeMsgPackColumns(Print &out, JsonArrayConst rows)
+{
+    JsonObjectConst first = rows[0].as<JsonObjectConst>();
+    writeMsgPackMap(out, first.size());
+    for (JsonPairConst field : first)
+    {
+        writeMsgPackString(out, field.key());
+        writeMsgPackArray(out, rows.size());
+        for (JsonVariantConst row : rows)
+        {
+            serializeMsgPack(row[field.key().c_str()], out);
+        }
+    }
+}
+
+static void writeColumnarMsgPack(JsonDocument &doc, Print &out)
+{
+    if (!doc.is<JsonObject>())
+    {
+        serializeMsgPack(doc, out);
+        return;
+    }
+
+    JsonObjectConst root = doc.as<JsonObjectConst>();
+    writeMsgPackMap(out, root.size());
+    for (JsonPairConst member : root)
+    {
+        writeMsgPackString(out, member.key());
+        JsonArrayConst rows = member.value().as<JsonArrayConst>();
+        if (rows.isNull())
+        {
+            serializeMsgPack(member.value(), out);
+        }
+        else if (rows.size() == 0)
+        {
+            // No rows: an empty column set, so the client sees the same shape
+            writeMsgPackMap(out, 0);
+        }
+        else if (rows[0].is<JsonObjectConst>())
+        {
+            writeMsgPackColumns(out, rows);
+        }
+        else
+        {
+            serializeMsgPack(rows, out);
+        }
+    }
+}
+
+size_t serializeColumnarMsgPack(JsonDocument &doc, Print &out)
+{
+    CountingPrint counter(&out);
+    writeColumnarMsgPack(doc, counter);
+    return counter.count;
+}
+
+size_t measureColumnarMsgPack(JsonDocument &doc)
+{
+    CountingPrint counter(nullptr);
+    writeColumnarMsgPack(doc, counter);
+    return counter.count;
+}
+
+response_format_t negotiateFormat(AsyncWebServerRequest *request)
+{
+    if (request->hasHeader("Accept") &&
+        request->header("Accept").indexOf("application/msgpack") >= 0)
+    {
+        return RESPONSE_MSGPACK;
+    }
+    return RESPONSE_JSON;
+}
+
+const char *formatContentType(response_format_t format)
+{
+    return format == RESPONSE_MSGPACK ? "application/msgpack" : "application/json";
+}
+
+size_t measureResponse(JsonDocument &doc, response_format_t format)
+{
+    return format == RESPONSE_MSGPACK ? measureColumnarMsgPack(doc) : measureJson(doc);
+}
+
+size_t serializeResponse(JsonDocument &doc, response_format_t format, Print &out)
+{
+    return format == RESPONSE_MSGPACK ? serializeColumnarMsgPack(doc, out)
+                                      : serializeJson(doc, out);
+}
+
+void sendJson(AsyncWebServerRequest *request, JsonDocument &doc, int code)
+{
+    if (doc.overflowed())
+    {
+        logger.logf("JSON response for %s overflowed its %u byte document", request->url().c_str(),
+                    (unsigned) doc.capacity());
+        request->send(500, "application/json", "{\"error\":\"Response too large\"}");
+        return;
+    }
+
+    size_t               length   = measureJson(doc);
+    AsyncResponseStream *response = request->beginResponseStream("application/json", length);
+    response->setCode(code);
+    serializeJson(doc, *response);
+    // Document and serialized payload both exist here, which is the handler's peak
+    EndpointProbe::sampleCurrent();
+    request->send(response);
+}
+
+void sendNegotiated(AsyncWebServerRequest *request, JsonDocument &doc,
+                    response_format_t format)
+{
+    if (doc.overflowed())
+    {
+        sendJson(request, doc);  // Reports the overflow
+        return;
+    }
+
+    size_t               length   = measureResponse(doc, format);
+    AsyncResponseStream *response = request->beginResponseStream(formatContentType(format), length);
+    // Both encodings come from the same URL, so caches must key on Accept
+    response->addHeader("Vary", "Accept");
+    serializeResponse(doc, format, *response);
+    EndpointProbe::sampleCurrent();
+    request->send(response);
+}
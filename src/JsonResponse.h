@@ -0,0 +1,108 @@
+#ifndef JSON_RESPONSE_H
+#define JSON_RESPONSE_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <ESPAsyncWebServer.h>
+
+#include "MemoryPolicy.h"
+
+// Documents kept for reuse by request handlers, and the capacity of each. PSRAM boards
+// keep more and larger ones; without PSRAM the pool stays small so it doesn't pin much
+// internal heap.
+#define JSON_POOL_INTERNAL_DOCUMENTS 2
+#define JSON_POOL_PSRAM_DOCUMENTS 4
+#define JSON_POOL_INTERNAL_CAPACITY (6 * 1024)
+#define JSON_POOL_PSRAM_CAPACITY (32 * 1024)
+#define JSON_POOL_MAX_DOCUMENTS JSON_POOL_PSRAM_DOCUMENTS
+
+// Fixed set of preallocated documents handed out to handlers, so building a response
+// doesn't allocate and free a pool-sized block on every request
+class JsonDocumentPool
+{
+   private:
+    ScratchJsonDocument *documents[JSON_POOL_MAX_DOCUMENTS];
+    bool                 inUse[JSON_POOL_MAX_DOCUMENTS];
+    int                  documentCount;
+    size_t               documentCapacity;
+    portMUX_TYPE         poolLock;
+
+    uint32_t leases;
+    uint32_t fallbacks;  // Requests served by a one-off document instead
+    int      peakInUse;
+
+    JsonDocumentPool();
+
+    // Delete copy constructor and assignment operator
+    JsonDocumentPool(const JsonDocumentPool &)            = delete;
+    JsonDocumentPool &operator=(const JsonDocumentPool &) = delete;
+
+   public:
+    // Singleton access method
+    static JsonDocumentPool &getInstance();
+
+    // A cleared pooled document of at least capacity bytes, or nullptr if every document
+    // is leased or capacity is larger than they are
+    ScratchJsonDocument *acquire(size_t capacity);
+    void                 release(ScratchJsonDocument *document);
+    void                 recordFallback();
+
+    void reportStats(JsonObject out);
+};
+
+// Convenience macro for easier access
+#define jsonDocumentPool JsonDocumentPool::getInstance()
+
+// Lease on a document for the lifetime of this object: a pooled one when available,
+// otherwise a one-off allocation of exactly the requested capacity
+class PooledJsonDocument
+{
+   private:
+    ScratchJsonDocument *document;
+    bool                 pooled;
+
+    // Delete copy constructor and assignment operator
+    PooledJsonDocument(const PooledJsonDocument &)            = delete;
+    PooledJsonDocument &operator=(const PooledJsonDocument &) = delete;
+
+   public:
+    explicit PooledJsonDocument(size_t capacity);
+    ~PooledJsonDocument();
+
+    JsonDocument &operator*() { return *document; }
+    JsonDocument *operator->() { return document; }
+};
+
+// Serialize doc straight into the response stream and send it. The stream is sized from
+// measureJson() up front, so the payload is written once and never regrown. Sends 500 if
+// the document overflowed while it was being filled.
+void sendJson(AsyncWebServerRequest *request, JsonDocument &doc, int code = 200);
+
+// Body encodings a telemetry endpoint can answer with
+typedef enum
+{
+    RESPONSE_JSON    = 0,
+    RESPONSE_MSGPACK = 1,  // Columnar MessagePack, see serializeColumnarMsgPack()
+    RESPONSE_FORMAT_COUNT
+} response_format_t;
+
+// RESPONSE_MSGPACK if the request's Accept header lists application/msgpack
+response_format_t negotiateFormat(AsyncWebServerRequest *request);
+const char       *formatContentType(response_format_t format);
+
+// MessagePack encoding of doc in which every array of objects directly under the root is
+// turned into columns: an object mapping each field name (taken from the first element)
+// to the array of that field's values. Point and log arrays repeat the same few keys on
+// every element, so this removes most of their size as well as the JSON punctuation.
+size_t serializeColumnarMsgPack(JsonDocument &doc, Print &out);
+size_t measureColumnarMsgPack(JsonDocument &doc);
+
+// measureJson/serializeJson or their columnar MessagePack counterparts
+size_t measureResponse(JsonDocument &doc, response_format_t format);
+size_t serializeResponse(JsonDocument &doc, response_format_t format, Print &out);
+
+// sendJson for endpoints that negotiate their encoding; adds Vary: Accept
+void sendNegotiated(AsyncWebServerRequest *request, JsonDocument &doc,
+                    response_format_t format);
+
+#endif  // JSON_RESPONSE_H
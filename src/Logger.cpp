@@ -1,9 +1,10 @@
 #include "Logger.h"
+#include "MemoryPolicy.h"
+#include "PushChannel.h"
+#include "TimeBase.h"
+#include "Trace.h"
 #include "time.h"
 
-// External function to get current time (from main.cpp)
-extern unsigned long getTime();
-
 // Define the static constant
 const char* Logger::LOG_FILE_PATH = "/system_logs.txt";
 
@@ -17,7 +18,36 @@ Logger::Logger()
 {
   currentIndex = 0;
   totalEntries = 0;
+  version = 0;
+  ringLock = portMUX_INITIALIZER_UNLOCKED;
+  memset(&stats, 0, sizeof(stats));
+  logFile = storageManager.track(LOG_FILE_PATH, MAX_LOG_FILE_SIZE);
   uuidGenerator.generate();
+
+  pendingLength = 0;
+  pendingLock = portMUX_INITIALIZER_UNLOCKED;
+  fileMutex = xSemaphoreCreateMutex();
+  pendingCapacity = memoryPolicy.scaleCapacity(INTERNAL_PENDING_BYTES, PSRAM_PENDING_BYTES);
+  pendingBuffer = (char *)memoryPolicy.allocate(pendingCapacity, ALLOC_LOG);
+  if (pendingBuffer == nullptr)
+  {
+    // Lines go straight to the file, one open/write/close each
+    pendingCapacity = 0;
+  }
+  flushStore = flushScheduler.registerStore(LOG_FILE_PATH, FLUSH_NORMAL, [this]() { flush(); });
+
+  maxLogEntries = memoryPolicy.scaleCapacity(INTERNAL_LOG_ENTRIES, PSRAM_LOG_ENTRIES);
+  logBuffer = (LogEntry *)memoryPolicy.allocate(maxLogEntries * sizeof(LogEntry), ALLOC_LOG);
+  if (logBuffer == nullptr && maxLogEntries > INTERNAL_LOG_ENTRIES)
+  {
+    maxLogEntries = INTERNAL_LOG_ENTRIES;
+    logBuffer = (LogEntry *)memoryPolicy.allocate(maxLogEntries * sizeof(LogEntry), ALLOC_LOG);
+  }
+  if (logBuffer == nullptr)
+  {
+    // Serial and the log file still work without the in-memory ring
+    maxLogEntries = 0;
+  }
 }
 
 void Logger::log(const String &message)
@@ -25,28 +55,47 @@ void Logger::log(const String &message)
   // Print to serial first
   Serial.println(message);
 
-  // Generate UUID for this log entry
-  uuidGenerator.generate();
-  String uuid = String(uuidGenerator.toCharArray());
-
   // Get current timestamp
-  unsigned long timestamp = getTime();
+  uint64_t timestamp = timeBase.now();
+  stats.entries++;
 
-  // Store in circular buffer
-  logBuffer[currentIndex].uuid = uuid;
-  logBuffer[currentIndex].timestamp = timestamp;
-  logBuffer[currentIndex].message = message;
+  // Generate UUID for this log entry
+  uuidGenerator.generate();
+  const char *uuid = uuidGenerator.toCharArray();
 
-  // Update indices
-  currentIndex = (currentIndex + 1) % MAX_LOG_ENTRIES;
-  if (totalEntries < MAX_LOG_ENTRIES)
+  if (maxLogEntries > 0)
   {
-    totalEntries++;
+    // Store in circular buffer. The main loop, the web server and the mDNS and Improv tasks
+    // all log, and /api/logs reads the ring from the web server task.
+    portENTER_CRITICAL(&ringLock);
+    LogEntry &entry = logBuffer[currentIndex];
+    strlcpy(entry.uuid, uuid, sizeof(entry.uuid));
+    entry.timestamp = timestamp;
+    if (strlcpy(entry.message, message.c_str(), sizeof(entry.message)) >= sizeof(entry.message))
+    {
+      stats.truncated++;
+    }
+
+    // Update indices
+    currentIndex = (currentIndex + 1) % maxLogEntries;
+    if (totalEntries < maxLogEntries)
+    {
+      totalEntries++;
+    }
+    else
+    {
+      stats.ringEvictions++;
+    }
+    portEXIT_CRITICAL(&ringLock);
   }
 
-  // Write to persistent log file
+  // Push to live UI clients
+  pushChannel.publishLog(uuid, timeBase.toSeconds(timestamp), message.c_str());
+
+  // Queue the line for the log file
   String formattedTimestamp = formatTimestamp(timestamp);
   writeLogToFile(formattedTimestamp, message);
+  version++;
 }
 
 void Logger::log(const char *message)
@@ -64,25 +113,56 @@ void Logger::logf(const char *format, ...)
   log(String(buffer));
 }
 
-String Logger::getLogsAsJson()
+size_t Logger::getLogsJsonCapacity(int maxEntries)
 {
-  DynamicJsonDocument jsonDoc(8192); // Allocate enough space for logs
-  JsonArray logsArray = jsonDoc.createNestedArray("logs");
+  portENTER_CRITICAL(&ringLock);
+  int count = totalEntries;
+  portEXIT_CRITICAL(&ringLock);
+  if (maxEntries > 0 && maxEntries < count)
+  {
+    count = maxEntries;
+  }
+
+  // The strings are copied into the document, so room for the longest of each
+  return JSON_OBJECT_SIZE(1) + JSON_ARRAY_SIZE(count) + count * JSON_OBJECT_SIZE(3) +
+         count * (sizeof(LogEntry::uuid) + sizeof(LogEntry::message));
+}
 
-  // If we have less than MAX_LOG_ENTRIES, start from 0
-  // Otherwise, start from currentIndex (oldest entry)
-  int startIndex = (totalEntries < MAX_LOG_ENTRIES) ? 0 : currentIndex;
+void Logger::writeLogsJson(JsonObject out, int maxEntries)
+{
+  portENTER_CRITICAL(&ringLock);
   int count = totalEntries;
+  int newestIndex = currentIndex;
+  portEXIT_CRITICAL(&ringLock);
+  if (maxEntries > 0 && maxEntries < count)
+  {
+    count = maxEntries;
+  }
+
+  JsonArray logsArray = out.createNestedArray("logs");
 
+  // Entry i, oldest first, was written (count - i) slots before newestIndex. Each one is
+  // copied out under the lock; log() can overwrite the oldest while the response is built.
+  LogEntry entry;
   for (int i = 0; i < count; i++)
   {
-    int bufferIndex = (startIndex + i) % MAX_LOG_ENTRIES;
+    int slot = ((newestIndex - (count - i)) % maxLogEntries + maxLogEntries) % maxLogEntries;
+    portENTER_CRITICAL(&ringLock);
+    memcpy(&entry, &logBuffer[slot], sizeof(entry));
+    portEXIT_CRITICAL(&ringLock);
 
+    // char * rather than const char *, so ArduinoJson copies them
     JsonObject logEntry = logsArray.createNestedObject();
-    logEntry["uuid"] = logBuffer[bufferIndex].uuid;
-    logEntry["timestamp"] = logBuffer[bufferIndex].timestamp;
-    logEntry["message"] = logBuffer[bufferIndex].message;
+    logEntry["uuid"] = (char *)entry.uuid;
+    logEntry["timestamp"] = timeBase.toSeconds(entry.timestamp);
+    logEntry["message"] = (char *)entry.message;
   }
+}
+
+String Logger::getLogsAsJson(int maxEntries)
+{
+  ScratchJsonDocument jsonDoc(getLogsJsonCapacity(maxEntries));
+  writeLogsJson(jsonDoc.to<JsonObject>(), maxEntries);
 
   String jsonResponse;
   serializeJson(jsonDoc, jsonResponse);
@@ -91,15 +171,13 @@ String Logger::getLogsAsJson()
 
 void Logger::clearLogs()
 {
+  // Slots past totalEntries are never read, so the ring itself needn't be wiped (which
+  // could also wipe a line another task logs meanwhile)
+  portENTER_CRITICAL(&ringLock);
   currentIndex = 0;
   totalEntries = 0;
-  // Clear the buffer
-  for (int i = 0; i < MAX_LOG_ENTRIES; i++)
-  {
-    logBuffer[i].uuid = "";
-    logBuffer[i].timestamp = 0;
-    logBuffer[i].message = "";
-  }
+  portEXIT_CRITICAL(&ringLock);
+  version++;
 }
 
 int Logger::getLogCount()
@@ -107,73 +185,144 @@ int Logger::getLogCount()
   return totalEntries;
 }
 
+int Logger::getLogCapacity()
+{
+  return maxLogEntries;
+}
+
 void Logger::writeLogToFile(const String &timestamp, const String &message)
 {
+  char prefix[32];
+  size_t prefixLength = snprintf(prefix, sizeof(prefix), "[%s] ", timestamp.c_str());
+  size_t lineLength = prefixLength + message.length() + 1;
+
+  if (pendingBuffer == nullptr)
+  {
+    String line = String(prefix) + message + "\n";
+    if (!appendToFile(line.c_str(), line.length()))
+    {
+      stats.fileWriteFailures++;
+    }
+    return;
+  }
+
+  bool stored = false;
+  bool halfFull = false;
+  portENTER_CRITICAL(&pendingLock);
+  if (pendingLength + lineLength <= pendingCapacity)
+  {
+    char *line = pendingBuffer + pendingLength;
+    memcpy(line, prefix, prefixLength);
+    memcpy(line + prefixLength, message.c_str(), message.length());
+    line[lineLength - 1] = '\n';
+    pendingLength += lineLength;
+    stored = true;
+  }
+  halfFull = pendingLength >= pendingCapacity / 2;
+  portEXIT_CRITICAL(&pendingLock);
+
+  if (!stored)
+  {
+    // The file has been unreachable long enough to fill the buffer
+    stats.fileWriteFailures++;
+  }
+  flushScheduler.markDirty(flushStore, halfFull);
+}
+
+bool Logger::appendToFile(const char *data, size_t length)
+{
+  if (!storageManager.isMounted())
+  {
+    return false;
+  }
+
   // Check if we need to rotate the log file when it exceeds the limit
-  if (getLogFileSize() > MAX_LOG_FILE_SIZE)
+  if (storageManager.isOverQuota(logFile))
   {
     rotateLogFile();
   }
 
-  // Open log file for appending
-  File logFile = LittleFS.open(LOG_FILE_PATH, "a");
-  if (logFile)
+  File file = LittleFS.open(LOG_FILE_PATH, "a");
+  if (!file)
+  {
+    return false;
+  }
+  size_t written = file.write((const uint8_t *)data, length);
+  file.close();
+  storageManager.addFileBytes(logFile, written);
+  return written == length;
+}
+
+void Logger::flush()
+{
+  TRACE_SPAN("log_flush");
+  xSemaphoreTake(fileMutex, portMAX_DELAY);
+
+  // Lines logged while the file is being written land after length and stay pending
+  portENTER_CRITICAL(&pendingLock);
+  size_t length = pendingLength;
+  portEXIT_CRITICAL(&pendingLock);
+
+  // Before the mount, or if the file can't be opened, keep the lines for the next flush
+  if (length > 0 && appendToFile(pendingBuffer, length))
   {
-    // Write human-readable log entry
-    logFile.printf("[%s] %s\n", timestamp.c_str(), message.c_str());
-    logFile.close();
+    portENTER_CRITICAL(&pendingLock);
+    memmove(pendingBuffer, pendingBuffer + length, pendingLength - length);
+    pendingLength -= length;
+    portEXIT_CRITICAL(&pendingLock);
   }
+
+  xSemaphoreGive(fileMutex);
 }
 
 void Logger::rotateLogFile()
 {
   // Simply delete the current log file when it exceeds the limit
   // No backup file to save storage space
-  if (LittleFS.exists(LOG_FILE_PATH))
+  if (storageManager.removeFile(logFile))
   {
-    LittleFS.remove(LOG_FILE_PATH);
+    stats.fileRotations++;
   }
 }
 
-String Logger::formatTimestamp(unsigned long timestamp)
+String Logger::formatTimestamp(uint64_t timestamp)
 {
-  if (timestamp == 0)
+  char timeStr[24];
+
+  // The file is append-only, so lines written before NTP sync can't be fixed up later;
+  // mark them as time since boot instead of printing a misleading wall-clock time
+  if (!TimeBase::isEpoch(timestamp))
   {
-    return "00:00:00";
+    snprintf(timeStr, sizeof(timeStr), "+%lu.%03lus", (unsigned long)(timestamp / 1000000ULL),
+             (unsigned long)(timestamp / 1000ULL % 1000));
+    return String(timeStr);
   }
-  
+
   // Convert to hours, minutes, seconds
-  unsigned long hours = (timestamp / 3600) % 24;
-  unsigned long minutes = (timestamp / 60) % 60;
-  unsigned long seconds = timestamp % 60;
-  
-  char timeStr[16];
-  snprintf(timeStr, sizeof(timeStr), "%02lu:%02lu:%02lu", hours, minutes, seconds);
+  unsigned long seconds = timestamp / 1000000ULL;
+  snprintf(timeStr, sizeof(timeStr), "%02lu:%02lu:%02lu.%03lu", (seconds / 3600) % 24,
+           (seconds / 60) % 60, seconds % 60, (unsigned long)(timestamp / 1000ULL % 1000));
   return String(timeStr);
 }
 
 size_t Logger::getLogFileSize()
 {
-  File logFile = LittleFS.open(LOG_FILE_PATH, "r");
-  if (logFile)
-  {
-    size_t size = logFile.size();
-    logFile.close();
-    return size;
-  }
-  return 0;
+  return storageManager.getFileSize(logFile);
 }
 
 String Logger::getLogFileContents()
 {
   String contents = "";
+
+  // Write out pending lines so the file is complete
+  flush();
   
   // Read current log file only (no backup file)
-  File logFile = LittleFS.open(LOG_FILE_PATH, "r");
-  if (logFile)
+  File file = LittleFS.open(LOG_FILE_PATH, "r");
+  if (file)
   {
-    contents += logFile.readString();
-    logFile.close();
+    contents += file.readString();
+    file.close();
   }
   
   return contents;
@@ -181,15 +330,28 @@ String Logger::getLogFileContents()
 
 void Logger::clearLogFile()
 {
+  version++;
+  xSemaphoreTake(fileMutex, portMAX_DELAY);
+  portENTER_CRITICAL(&pendingLock);
+  pendingLength = 0;
+  portEXIT_CRITICAL(&pendingLock);
   // Remove current log file only (no backup file)
-  if (LittleFS.exists(LOG_FILE_PATH))
-  {
-    LittleFS.remove(LOG_FILE_PATH);
-  }
+  storageManager.removeFile(logFile);
+  xSemaphoreGive(fileMutex);
 }
 
 size_t Logger::getLogFileUsage()
 {
   // Return only current log file size (no backup file)
   return getLogFileSize();
-}
\ No newline at end of file
+}
+
+uint32_t Logger::getVersion()
+{
+  return version;
+}
+
+log_stats_t Logger::getStats()
+{
+  return stats;
+}
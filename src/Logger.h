@@ -6,28 +6,63 @@
 #include <UUID.h>
 #include <LittleFS.h>
 
+#include "FlushScheduler.h"
+#include "StorageManager.h"
+
+#define LOG_MESSAGE_MAX_LEN 192
+
+// Fixed-size entry so the whole ring is one flat arena with no per-entry heap strings
 struct LogEntry
 {
-  String uuid;
-  unsigned long timestamp;
-  String message;
+  char uuid[37];
+  uint64_t timestamp; // TimeBase stamp
+  char message[LOG_MESSAGE_MAX_LEN];
 };
 
+// Running totals since boot, for /metrics
+typedef struct
+{
+  uint32_t entries;
+  uint32_t ringEvictions;     // Entries overwritten in the ring before anyone read them
+  uint32_t truncated;         // Messages cut to LOG_MESSAGE_MAX_LEN in the ring
+  uint32_t fileWriteFailures; // Lines that never reached the log file
+  uint32_t fileRotations;     // Times the log file was deleted for being full
+} log_stats_t;
+
 class Logger
 {
 private:
-  static const int MAX_LOG_ENTRIES = 50;
+  static const int INTERNAL_LOG_ENTRIES = 50; // Ring size without PSRAM
+  static const int PSRAM_LOG_ENTRIES = 500;
   static const size_t MAX_LOG_FILE_SIZE = 3 * 1024 * 1024; // 3MB
+  static const size_t INTERNAL_PENDING_BYTES = 2048; // File lines held for the next flush
+  static const size_t PSRAM_PENDING_BYTES = 8192;
   static const char* LOG_FILE_PATH;
   
-  LogEntry logBuffer[MAX_LOG_ENTRIES];
+  LogEntry *logBuffer;
+  int maxLogEntries;
   int currentIndex;
   int totalEntries;
+  portMUX_TYPE ringLock; // Guards the slot being written, currentIndex and totalEntries
+  uint32_t version; // Bumped whenever the buffer or the log file changes
+  log_stats_t stats;
+  storage_file_t logFile;
   UUID uuidGenerator;
+
+  // Formatted lines waiting for the flush scheduler. log() only appends under the lock;
+  // flushes write the front of the buffer outside it and are serialized by fileMutex.
+  char *pendingBuffer;
+  size_t pendingCapacity;
+  size_t pendingLength;
+  portMUX_TYPE pendingLock;
+  SemaphoreHandle_t fileMutex;
+  flush_store_t flushStore;
   
   void writeLogToFile(const String &timestamp, const String &message);
+  bool appendToFile(const char *data, size_t length);
+  void flush();
   void rotateLogFile();
-  String formatTimestamp(unsigned long timestamp);
+  String formatTimestamp(uint64_t timestamp);
 
   Logger();
 
@@ -42,13 +77,20 @@ public:
   void log(const String &message);
   void log(const char *message);
   void logf(const char *format, ...);
-  String getLogsAsJson();
+  String getLogsAsJson(int maxEntries = 0); // 0 returns every buffered entry
+  // Fill out with the "logs" array, in a document of at least getLogsJsonCapacity(maxEntries)
+  // bytes. Entries are copied, so the document stays valid while log() carries on.
+  void writeLogsJson(JsonObject out, int maxEntries = 0);
+  size_t getLogsJsonCapacity(int maxEntries = 0);
   String getLogFileContents();
   void clearLogs();
   void clearLogFile();
   int getLogCount();
+  int getLogCapacity();
   size_t getLogFileSize();
   size_t getLogFileUsage();
+  uint32_t getVersion();
+  log_stats_t getStats();
 };
 
 // Convenience macro for easier access
@@ -0,0 +1,286 @@
+#include "LoopWatchdog.h"
+
+#include <esp_rom_crc.h>
+#include <esp_task_wdt.h>
+
+#include "Logger.h"
+#include "TimeBase.h"
+
+#define HANG_RECORD_MAGIC 0x4C574431  // "LWD1"
+
+static const char *PHASE_NAMES[LOOP_PHASE_COUNT] = {"connectivity", "elegoo", "jobs", "web",
+                                                    "other"};
+
+// Phase that was hanging when the hang check last ran. Survives a watchdog reset; cleared
+// once the phase finishes, so a later unrelated reset isn't blamed on it.
+typedef struct
+{
+    uint32_t magic;
+    int32_t  phase;
+    char     detail[LOOP_WATCHDOG_DETAIL_LEN];
+    uint32_t durationMs;  // How long it had been running at the last check
+    uint32_t crc;         // CRC32 of everything above
+} hang_record_t;
+
+RTC_NOINIT_ATTR static hang_record_t hangRecord;
+
+static uint32_t hangRecordCrc(const hang_record_t &record)
+{
+    return esp_rom_crc32_le(0, (const uint8_t *) &record, offsetof(hang_record_t, crc));
+}
+
+LoopWatchdog &LoopWatchdog::getInstance()
+{
+    static LoopWatchdog instance;
+    return instance;
+}
+
+LoopWatchdog::LoopWatchdog()
+{
+    currentPhase  = LOOP_PHASE_OTHER;
+    currentDetail = nullptr;
+    spanStartUs   = 0;
+    hangReported  = false;
+    memset(phaseStats, 0, sizeof(phaseStats));
+    memset(stalls, 0, sizeof(stalls));
+    stallHead  = 0;
+    stallCount = 0;
+    hadHang    = false;
+    memset(&lastHang, 0, sizeof(lastHang));
+    memset(lastHangDetail, 0, sizeof(lastHangDetail));
+    started      = false;
+    checkTimer   = nullptr;
+    watchdogLock = portMUX_INITIALIZER_UNLOCKED;
+}
+
+void LoopWatchdog::begin()
+{
+    if (started)
+    {
+        return;
+    }
+    started = true;
+
+    if (hangRecord.magic == HANG_RECORD_MAGIC && hangRecord.crc == hangRecordCrc(hangRecord))
+    {
+        hadHang = true;
+        strlcpy(lastHangDetail, hangRecord.detail, sizeof(lastHangDetail));
+        lastHang.phase      = (loop_phase_t) min((int) hangRecord.phase, LOOP_PHASE_COUNT - 1);
+        lastHang.detail     = lastHangDetail[0] != '\0' ? lastHangDetail : nullptr;
+        lastHang.durationUs = hangRecord.durationMs * 1000;
+        logger.logf("Main loop was stuck in %s%s%s for %lu ms before the last reset",
+                    PHASE_NAMES[lastHang.phase], lastHang.detail ? "/" : "",
+                    lastHang.detail ? lastHang.detail : "", (unsigned long) hangRecord.durationMs);
+    }
+    hangRecord.magic = 0;
+
+    // The loop task isn't watched by default; the watchdog itself normally is running
+    if (esp_task_wdt_add(nullptr) != ESP_OK)
+    {
+        esp_task_wdt_init(LOOP_WATCHDOG_TWDT_TIMEOUT_S, true);
+        if (esp_task_wdt_add(nullptr) != ESP_OK)
+        {
+            logger.log("Failed to register the main loop with the task watchdog");
+        }
+    }
+
+    esp_timer_create_args_t args = {};
+    args.callback                = checkCallback;
+    args.arg                     = this;
+    args.dispatch_method         = ESP_TIMER_TASK;
+    args.name                    = "loop_wdt";
+    if (esp_timer_create(&args, &checkTimer) != ESP_OK ||
+        esp_timer_start_periodic(checkTimer, LOOP_WATCHDOG_CHECK_INTERVAL_MS * 1000ULL) != ESP_OK)
+    {
+        logger.log("Failed to start the main loop hang check");
+    }
+}
+
+void LoopWatchdog::feed()
+{
+    esp_task_wdt_reset();
+    enterPhase(LOOP_PHASE_OTHER);
+}
+
+void LoopWatchdog::enterPhase(loop_phase_t phase, const char *detail)
+{
+    int64_t nowUs = esp_timer_get_time();
+
+    portENTER_CRITICAL(&watchdogLock);
+    loop_phase_t endedPhase  = currentPhase;
+    const char  *endedDetail = currentDetail;
+    int64_t      startUs     = spanStartUs;
+    bool         wasHung     = hangReported;
+    currentPhase             = phase;
+    currentDetail            = detail;
+    spanStartUs              = nowUs;
+    hangReported             = false;
+    portEXIT_CRITICAL(&watchdogLock);
+
+    if (startUs == 0)
+    {
+        return;  // Coming out of idle()
+    }
+    uint32_t durationUs = (uint32_t) (nowUs - startUs);
+
+    portENTER_CRITICAL(&watchdogLock);
+    loop_phase_stats_t &stats = phaseStats[endedPhase];
+    stats.spans++;
+    stats.totalUs += durationUs;
+    if (durationUs > stats.maxUs)
+    {
+        stats.maxUs = durationUs;
+    }
+    portEXIT_CRITICAL(&watchdogLock);
+
+    if (durationUs >= LOOP_WATCHDOG_STALL_MS * 1000)
+    {
+        recordStall(endedPhase, endedDetail, durationUs);
+    }
+    if (wasHung)
+    {
+        // It finished after all; don't let a later reset be blamed on it
+        hangRecord.magic = 0;
+        logger.logf("Main loop was stuck in %s%s%s, recovered after %lu ms", PHASE_NAMES[endedPhase],
+                    endedDetail ? "/" : "", endedDetail ? endedDetail : "",
+                    (unsigned long) (durationUs / 1000));
+    }
+}
+
+void LoopWatchdog::idle()
+{
+    enterPhase(LOOP_PHASE_OTHER);
+    portENTER_CRITICAL(&watchdogLock);
+    spanStartUs = 0;
+    portEXIT_CRITICAL(&watchdogLock);
+}
+
+void LoopWatchdog::recordStall(loop_phase_t phase, const char *detail, uint32_t durationUs)
+{
+    portENTER_CRITICAL(&watchdogLock);
+    loop_stall_t &stall = stalls[stallHead];
+    stall.phase         = phase;
+    stall.detail        = detail;
+    stall.durationUs    = durationUs;
+    stall.stamp         = timeBase.now();
+    stallHead           = (stallHead + 1) % LOOP_WATCHDOG_STALL_RECORDS;
+    if (stallCount < LOOP_WATCHDOG_STALL_RECORDS)
+    {
+        stallCount++;
+    }
+    phaseStats[phase].stalls++;
+    portEXIT_CRITICAL(&watchdogLock);
+}
+
+void LoopWatchdog::checkCallback(void *arg)
+{
+    ((LoopWatchdog *) arg)->checkHang();
+}
+
+void LoopWatchdog::checkHang()
+{
+    portENTER_CRITICAL(&watchdogLock);
+    loop_phase_t phase   = currentPhase;
+    const char  *detail  = currentDetail;
+    int64_t      startUs = spanStartUs;
+    bool         already = hangReported;
+    portEXIT_CRITICAL(&watchdogLock);
+
+    if (startUs == 0)
+    {
+        return;
+    }
+    uint32_t runningMs = (uint32_t) ((esp_timer_get_time() - startUs) / 1000);
+    if (runningMs < LOOP_WATCHDOG_HANG_MS)
+    {
+        return;
+    }
+
+    // Refreshed on every check, so the record says how long it had been stuck at the reset
+    hang_record_t record;
+    memset(&record, 0, sizeof(record));
+    record.magic = HANG_RECORD_MAGIC;
+    record.phase = phase;
+    strlcpy(record.detail, detail ? detail : "", sizeof(record.detail));
+    record.durationMs = runningMs;
+    record.crc        = hangRecordCrc(record);
+    hangRecord        = record;
+
+    // No logging here: the logger isn't safe to call from the esp_timer task. The main loop
+    // logs the hang when the span ends; if it never does, begin() logs the record after the reset.
+    if (!already)
+    {
+        portENTER_CRITICAL(&watchdogLock);
+        if (spanStartUs == startUs)
+        {
+            hangReported = true;
+        }
+        portEXIT_CRITICAL(&watchdogLock);
+    }
+}
+
+const char *LoopWatchdog::getPhaseName(loop_phase_t phase)
+{
+    return phase < LOOP_PHASE_COUNT ? PHASE_NAMES[phase] : "unknown";
+}
+
+int LoopWatchdog::snapshot(loop_phase_stats_t *out)
+{
+    portENTER_CRITICAL(&watchdogLock);
+    memcpy(out, phaseStats, sizeof(phaseStats));
+    portEXIT_CRITICAL(&watchdogLock);
+    return LOOP_PHASE_COUNT;
+}
+
+void LoopWatchdog::reportStats(JsonObject out)
+{
+    loop_phase_stats_t phases[LOOP_PHASE_COUNT];
+    loop_stall_t       recent[LOOP_WATCHDOG_STALL_RECORDS];
+    int                count;
+    portENTER_CRITICAL(&watchdogLock);
+    memcpy(phases, phaseStats, sizeof(phases));
+    count = stallCount;
+    for (int i = 0; i < count; i++)
+    {
+        // Newest first
+        recent[i] = stalls[(stallHead - 1 - i + LOOP_WATCHDOG_STALL_RECORDS) %
+                           LOOP_WATCHDOG_STALL_RECORDS];
+    }
+    portEXIT_CRITICAL(&watchdogLock);
+
+    out["stall_threshold_ms"] = LOOP_WATCHDOG_STALL_MS;
+
+    JsonObject phasesOut = out.createNestedObject("phases");
+    for (int i = 0; i < LOOP_PHASE_COUNT; i++)
+    {
+        JsonObject phase = phasesOut.createNestedObject(PHASE_NAMES[i]);
+        phase["spans"]   = phases[i].spans;
+        phase["avg_us"]  = (uint32_t) (phases[i].totalUs / max(phases[i].spans, (uint32_t) 1));
+        phase["max_us"]  = phases[i].maxUs;
+        phase["stalls"]  = phases[i].stalls;
+    }
+
+    JsonArray stallsOut = out.createNestedArray("stalls");
+    for (int i = 0; i < count; i++)
+    {
+        JsonObject stall = stallsOut.createNestedObject();
+        stall["phase"]   = PHASE_NAMES[recent[i].phase];
+        if (recent[i].detail)
+        {
+            stall["job"] = recent[i].detail;
+        }
+        stall["ms"] = recent[i].durationUs / 1000;
+        stall["t"]  = timeBase.toSeconds(recent[i].stamp);
+    }
+
+    if (hadHang)
+    {
+        JsonObject hang = out.createNestedObject("hang_before_reset");
+        hang["phase"]   = PHASE_NAMES[lastHang.phase];
+        if (lastHang.detail)
+        {
+            hang["job"] = lastHang.detail;
+        }
+        hang["ms"] = lastHang.durationUs / 1000;
+    }
+}
@@ -0,0 +1,115 @@
+#ifndef LOOP_WATCHDOG_H
+#define LOOP_WATCHDOG_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <esp_timer.h>
+
+#define LOOP_WATCHDOG_STALL_MS 100          // Spans longer than this are recorded as stalls
+#define LOOP_WATCHDOG_STALL_RECORDS 8       // Most recent stalls kept
+#define LOOP_WATCHDOG_HANG_MS 2000          // Recorded as a hang while still running
+#define LOOP_WATCHDOG_CHECK_INTERVAL_MS 250
+#define LOOP_WATCHDOG_TWDT_TIMEOUT_S 5      // Only used if the task watchdog isn't running yet
+#define LOOP_WATCHDOG_DETAIL_LEN 24
+
+// Document size reportStats() needs
+#define LOOP_WATCHDOG_JSON_SIZE                                                          \
+    (JSON_OBJECT_SIZE(4) + JSON_OBJECT_SIZE(LOOP_PHASE_COUNT) +                          \
+     LOOP_PHASE_COUNT * JSON_OBJECT_SIZE(4) + JSON_ARRAY_SIZE(LOOP_WATCHDOG_STALL_RECORDS) + \
+     LOOP_WATCHDOG_STALL_RECORDS * JSON_OBJECT_SIZE(4) + JSON_OBJECT_SIZE(4))
+
+// What the main loop is doing. Improv runs on its own task and NTP inside the connectivity
+// manager; sampling and the other periodic work are jobs, attributed by job name.
+typedef enum
+{
+    LOOP_PHASE_CONNECTIVITY = 0,  // WiFi state machine, NTP and mDNS
+    LOOP_PHASE_ELEGOO,            // Printer websocket, detection and pause handling
+    LOOP_PHASE_JOBS,              // Scheduled jobs: sampling, pushes, flushes, pings...
+    LOOP_PHASE_WEB,               // OTA housekeeping
+    LOOP_PHASE_OTHER,             // Between the phases above
+    LOOP_PHASE_COUNT
+} loop_phase_t;
+
+typedef struct
+{
+    uint32_t spans;
+    uint32_t stalls;
+    uint64_t totalUs;
+    uint32_t maxUs;
+} loop_phase_stats_t;
+
+typedef struct
+{
+    loop_phase_t phase;
+    const char  *detail;  // Job name, or nullptr
+    uint32_t     durationUs;
+    uint64_t     stamp;   // TimeBase stamp of the end of the span
+} loop_stall_t;
+
+// Times each phase of the main loop and names the one responsible when an iteration is
+// slow. The loop task is registered with the task watchdog; a timer checks the phase in
+// progress and, if it has been running for LOOP_WATCHDOG_HANG_MS, leaves a record in RTC
+// memory, so a watchdog reset that follows can be attributed after boot. The hang is
+// logged by the main loop once the phase ends, or after the reset if it never does.
+// Phases are entered from the main loop only; reportStats() may be called from any task.
+class LoopWatchdog
+{
+   private:
+    // Span in progress, read by the hang check on the esp_timer task
+    loop_phase_t currentPhase;
+    const char  *currentDetail;
+    int64_t      spanStartUs;
+    bool         hangReported;
+
+    loop_phase_stats_t phaseStats[LOOP_PHASE_COUNT];
+    loop_stall_t       stalls[LOOP_WATCHDOG_STALL_RECORDS];
+    int                stallHead;
+    int                stallCount;
+
+    // Hang recorded before the last reset, if any
+    bool         hadHang;
+    loop_stall_t lastHang;
+    char         lastHangDetail[LOOP_WATCHDOG_DETAIL_LEN];
+
+    bool               started;
+    esp_timer_handle_t checkTimer;
+    portMUX_TYPE       watchdogLock;
+
+    LoopWatchdog();
+
+    // Delete copy constructor and assignment operator
+    LoopWatchdog(const LoopWatchdog &)            = delete;
+    LoopWatchdog &operator=(const LoopWatchdog &) = delete;
+
+    static void checkCallback(void *arg);
+    void        checkHang();
+    void        recordStall(loop_phase_t phase, const char *detail, uint32_t durationUs);
+
+   public:
+    // Singleton access method
+    static LoopWatchdog &getInstance();
+
+    // Register the calling task (the main loop) with the task watchdog, pick up a hang
+    // recorded before the last reset and start the hang check
+    void begin();
+
+    // Feed the task watchdog; call at the top of every loop() iteration
+    void feed();
+
+    // End the span in progress and start timing the next. detail, if given, must outlive
+    // the span (job names are string literals).
+    void enterPhase(loop_phase_t phase, const char *detail = nullptr);
+
+    // Stop timing before the loop sleeps, so idle time isn't counted against a phase
+    void idle();
+
+    static const char *getPhaseName(loop_phase_t phase);
+
+    int  snapshot(loop_phase_stats_t *out);  // LOOP_PHASE_COUNT entries
+    void reportStats(JsonObject out);
+};
+
+// Convenience macro for easier access
+#define loopWatchdog LoopWatchdog::getInstance()
+
+#endif  // LOOP_WATCHDOG_H
@@ -0,0 +1,147 @@
+#include "MemoryPolicy.h"
+
+#include <esp_heap_caps.h>
+
+#define INTERNAL_CAPS (MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT)
+#define PSRAM_CAPS (MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT)
+
+// Every block is prefixed with its size and region so release() can account for it
+// without asking the heap. 8 bytes keeps the payload 8-byte aligned.
+struct alloc_header_t
+{
+    uint32_t size;
+    uint32_t region;
+};
+
+static const char *CATEGORY_NAMES[ALLOC_CATEGORY_COUNT] = {
+    "history", "log", "json", "push", "cache", "metrics", "trace", "profile"};
+
+MemoryPolicy &MemoryPolicy::getInstance()
+{
+    static MemoryPolicy instance;
+    return instance;
+}
+
+MemoryPolicy::MemoryPolicy()
+{
+#if MEMORY_POLICY_PREFER_PSRAM
+    psramAvailable = psramFound();
+#else
+    psramAvailable = false;
+#endif
+    usageLock = portMUX_INITIALIZER_UNLOCKED;
+    memset(usage, 0, sizeof(usage));
+}
+
+bool MemoryPolicy::hasPsram()
+{
+    return psramAvailable;
+}
+
+void MemoryPolicy::trackUsage(alloc_category_t category, alloc_region_t region, long delta)
+{
+    portENTER_CRITICAL(&usageLock);
+    usage[category][region] += delta;
+    portEXIT_CRITICAL(&usageLock);
+}
+
+void *MemoryPolicy::allocate(size_t bytes, alloc_category_t category)
+{
+    size_t          total  = bytes + sizeof(alloc_header_t);
+    alloc_header_t *header = nullptr;
+    alloc_region_t  region = ALLOC_REGION_INTERNAL;
+
+    if (psramAvailable)
+    {
+        header = (alloc_header_t *) heap_caps_malloc(total, PSRAM_CAPS);
+        region = ALLOC_REGION_PSRAM;
+    }
+    if (header == nullptr)
+    {
+        // No PSRAM on this board, or it is exhausted
+        header = (alloc_header_t *) heap_caps_malloc(total, INTERNAL_CAPS);
+        region = ALLOC_REGION_INTERNAL;
+    }
+    if (header == nullptr)
+    {
+        return nullptr;
+    }
+
+    header->size   = bytes;
+    header->region = region;
+    trackUsage(category, region, bytes);
+    return header + 1;
+}
+
+void *MemoryPolicy::reallocate(void *ptr, size_t bytes, alloc_category_t category)
+{
+    if (ptr == nullptr)
+    {
+        return allocate(bytes, category);
+    }
+
+    alloc_header_t *header   = ((alloc_header_t *) ptr) - 1;
+    size_t          oldSize  = header->size;
+    alloc_region_t  region   = (alloc_region_t) header->region;
+    uint32_t        caps     = region == ALLOC_REGION_PSRAM ? PSRAM_CAPS : INTERNAL_CAPS;
+    alloc_header_t *resized =
+        (alloc_header_t *) heap_caps_realloc(header, bytes + sizeof(alloc_header_t), caps);
+    if (resized == nullptr)
+    {
+        return nullptr;
+    }
+
+    resized->size = bytes;
+    trackUsage(category, region, (long) bytes - (long) oldSize);
+    return resized + 1;
+}
+
+void MemoryPolicy::release(void *ptr, alloc_category_t category)
+{
+    if (ptr == nullptr)
+    {
+        return;
+    }
+
+    alloc_header_t *header = ((alloc_header_t *) ptr) - 1;
+    trackUsage(category, (alloc_region_t) header->region, -(long) header->size);
+    heap_caps_free(header);
+}
+
+size_t MemoryPolicy::scaleCapacity(size_t internalCapacity, size_t psramCapacity)
+{
+    return psramAvailable ? psramCapacity : internalCapacity;
+}
+
+size_t MemoryPolicy::getUsage(alloc_category_t category, alloc_region_t region)
+{
+    portENTER_CRITICAL(&usageLock);
+    size_t bytes = usage[category][region];
+    portEXIT_CRITICAL(&usageLock);
+    return bytes;
+}
+
+void MemoryPolicy::reportUsage(JsonObject out)
+{
+    JsonObject internal            = out.createNestedObject("internal");
+    internal["total_bytes"]        = heap_caps_get_total_size(INTERNAL_CAPS);
+    internal["free_bytes"]         = heap_caps_get_free_size(INTERNAL_CAPS);
+    internal["largest_free_block"] = heap_caps_get_largest_free_block(INTERNAL_CAPS);
+    internal["min_free_bytes"]     = heap_caps_get_minimum_free_size(INTERNAL_CAPS);
+
+    JsonObject psram     = out.createNestedObject("psram");
+    psram["available"]   = psramAvailable;
+    psram["total_bytes"] = psramAvailable ? heap_caps_get_total_size(PSRAM_CAPS) : 0;
+    psram["free_bytes"]  = psramAvailable ? heap_caps_get_free_size(PSRAM_CAPS) : 0;
+    psram["largest_free_block"] =
+        psramAvailable ? heap_caps_get_largest_free_block(PSRAM_CAPS) : 0;
+
+    JsonObject policy      = out.createNestedObject("policy");
+    policy["prefer_psram"] = MEMORY_POLICY_PREFER_PSRAM == 1;
+    for (int i = 0; i < ALLOC_CATEGORY_COUNT; i++)
+    {
+        JsonObject category        = policy.createNestedObject(CATEGORY_NAMES[i]);
+        category["internal_bytes"] = getUsage((alloc_category_t) i, ALLOC_REGION_INTERNAL);
+        category["psram_bytes"]    = getUsage((alloc_category_t) i, ALLOC_REGION_PSRAM);
+    }
+}
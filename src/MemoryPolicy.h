@@ -0,0 +1,95 @@
+#ifndef MEMORY_POLICY_H
+#define MEMORY_POLICY_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+// Boards built with BOARD_HAS_PSRAM place large buffers in PSRAM. Define
+// MEMORY_POLICY_INTERNAL_ONLY to keep everything in internal heap regardless.
+#if defined(BOARD_HAS_PSRAM) && !defined(MEMORY_POLICY_INTERNAL_ONLY)
+#define MEMORY_POLICY_PREFER_PSRAM 1
+#else
+#define MEMORY_POLICY_PREFER_PSRAM 0
+#endif
+
+// What a large allocation is used for, so usage can be reported per category
+typedef enum
+{
+    ALLOC_HISTORY = 0,  // Time series and pause attempt rings
+    ALLOC_LOG     = 1,  // Logger arena
+    ALLOC_JSON    = 2,  // JSON scratch documents
+    ALLOC_PUSH    = 3,  // Push channel replay ring
+    ALLOC_CACHE   = 4,  // Cached response bodies
+    ALLOC_METRICS = 5,  // /metrics render buffer
+    ALLOC_TRACE   = 6,  // Span trace ring and its export copy (ENABLE_TRACING builds)
+    ALLOC_PROFILE = 7,  // CPU profiler sample ring (ENABLE_PROFILER builds)
+    ALLOC_CATEGORY_COUNT
+} alloc_category_t;
+
+typedef enum
+{
+    ALLOC_REGION_INTERNAL = 0,
+    ALLOC_REGION_PSRAM    = 1,
+    ALLOC_REGION_COUNT
+} alloc_region_t;
+
+class MemoryPolicy
+{
+   private:
+    bool         psramAvailable;
+    size_t       usage[ALLOC_CATEGORY_COUNT][ALLOC_REGION_COUNT];
+    portMUX_TYPE usageLock;
+
+    MemoryPolicy();
+
+    // Delete copy constructor and assignment operator
+    MemoryPolicy(const MemoryPolicy &)            = delete;
+    MemoryPolicy &operator=(const MemoryPolicy &) = delete;
+
+    void trackUsage(alloc_category_t category, alloc_region_t region, long delta);
+
+   public:
+    // Singleton access method
+    static MemoryPolicy &getInstance();
+
+    // True when the policy prefers PSRAM and PSRAM was found at runtime
+    bool hasPsram();
+
+    // Allocate from PSRAM when available, falling back to internal heap.
+    // Returns nullptr if neither region can satisfy the request.
+    void *allocate(size_t bytes, alloc_category_t category);
+    void *reallocate(void *ptr, size_t bytes, alloc_category_t category);
+    void  release(void *ptr, alloc_category_t category);
+
+    // Pick the capacity a buffer should be sized for on this board
+    size_t scaleCapacity(size_t internalCapacity, size_t psramCapacity);
+
+    size_t getUsage(alloc_category_t category, alloc_region_t region);
+    void   reportUsage(JsonObject out);
+};
+
+// Convenience macro for easier access
+#define memoryPolicy MemoryPolicy::getInstance()
+
+// ArduinoJson allocator that routes document pools through the memory policy
+struct ScratchJsonAllocator
+{
+    void *allocate(size_t size)
+    {
+        return memoryPolicy.allocate(size, ALLOC_JSON);
+    }
+
+    void deallocate(void *ptr)
+    {
+        memoryPolicy.release(ptr, ALLOC_JSON);
+    }
+
+    void *reallocate(void *ptr, size_t new_size)
+    {
+        return memoryPolicy.reallocate(ptr, new_size, ALLOC_JSON);
+    }
+};
+
+typedef BasicJsonDocument<ScratchJsonAllocator> ScratchJsonDocument;
+
+#endif  // MEMORY_POLICY_H
@@ -0,0 +1,435 @@
+#include "MetricsExporter.h"
+
+#include <esp_heap_caps.h>
+#include <esp_timer.h>
+
+#include "ElegooCC.h"
+#include "EndpointStats.h"
+#include "JobScheduler.h"
+#include "Logger.h"
+#include "LoopWatchdog.h"
+#include "MemoryPolicy.h"
+#include "PauseAttemptData.h"
+#include "PushChannel.h"
+#include "StorageManager.h"
+#include "SystemMetrics.h"
+
+#define METRICS_CONTENT_TYPE "text/plain; version=0.0.4; charset=utf-8"
+#define METRICS_PREFIX "cc_sfs_"
+
+// Kept free while rendering so a truncated scrape can still say so
+#define METRICS_TRUNCATION_NOTE "# truncated\n"
+
+extern PauseAttemptData *pauseAttemptData;
+
+static const char *PAUSE_TYPE_NAMES[PAUSE_ATTEMPT_TYPE_COUNT] = {
+    "initial", "retry", "success", "max_exceeded", "already_paused"};
+
+// Sends the render buffer in place and hands it back to the exporter once done
+class MetricsResponse : public AsyncAbstractResponse
+{
+   private:
+    const char *body;
+    size_t      readLength;
+
+   public:
+    MetricsResponse(const char *body, size_t length) : body(body), readLength(0)
+    {
+        _code          = 200;
+        _contentType   = METRICS_CONTENT_TYPE;
+        _contentLength = length;
+    }
+
+    ~MetricsResponse()
+    {
+        metricsExporter.finishScrape();
+    }
+
+    bool _sourceValid() const override
+    {
+        return true;
+    }
+
+    size_t _fillBuffer(uint8_t *data, size_t len) override
+    {
+        size_t left = _contentLength - readLength;
+        size_t n    = left < len ? left : len;
+        memcpy(data, body + readLength, n);
+        readLength += n;
+        return n;
+    }
+};
+
+MetricsExporter &MetricsExporter::getInstance()
+{
+    static MetricsExporter instance;
+    return instance;
+}
+
+MetricsExporter::MetricsExporter()
+{
+    buffer         = nullptr;
+    capacity       = 0;
+    length         = 0;
+    truncated      = false;
+    inFlight       = false;
+    scrapes        = 0;
+    busyRejections = 0;
+    lastRenderUs   = 0;
+}
+
+void MetricsExporter::begin()
+{
+    if (buffer != nullptr)
+    {
+        return;
+    }
+    capacity = memoryPolicy.scaleCapacity(METRICS_INTERNAL_BUFFER, METRICS_PSRAM_BUFFER);
+    buffer   = (char *) memoryPolicy.allocate(capacity, ALLOC_METRICS);
+    if (buffer == nullptr)
+    {
+        capacity = 0;
+        logger.log("Metrics buffer allocation failed, /metrics disabled");
+    }
+}
+
+void MetricsExporter::handle(AsyncWebServerRequest *request)
+{
+    if (buffer == nullptr)
+    {
+        request->send(503, "text/plain", "Metrics unavailable");
+        return;
+    }
+    if (inFlight)
+    {
+        busyRejections++;
+        AsyncWebServerResponse *response =
+            request->beginResponse(503, "text/plain", "Previous scrape still sending");
+        response->addHeader("Retry-After", "1");
+        request->send(response);
+        return;
+    }
+
+    int64_t start = esp_timer_get_time();
+    render();
+    lastRenderUs = (uint32_t) (esp_timer_get_time() - start);
+    scrapes++;
+
+    inFlight = true;
+    request->send(new MetricsResponse(buffer, length));
+}
+
+void MetricsExporter::finishScrape()
+{
+    inFlight = false;
+}
+
+void MetricsExporter::append(const char *format, ...)
+{
+    if (truncated)
+    {
+        return;
+    }
+
+    size_t  limit = capacity - sizeof(METRICS_TRUNCATION_NOTE);
+    va_list args;
+    va_start(args, format);
+    int written = vsnprintf(buffer + length, limit - length, format, args);
+    va_end(args);
+
+    if (written < 0 || length + written >= limit)
+    {
+        // Drop the partial line so the output still parses
+        buffer[length] = '\0';
+        truncated      = true;
+        return;
+    }
+    length += written;
+}
+
+void MetricsExporter::family(const char *name, const char *type, const char *help)
+{
+    append("# HELP " METRICS_PREFIX "%s %s\n# TYPE " METRICS_PREFIX "%s %s\n", name, help, name,
+           type);
+}
+
+void MetricsExporter::value(const char *name, uint64_t sample)
+{
+    append(METRICS_PREFIX "%s %llu\n", name, (unsigned long long) sample);
+}
+
+void MetricsExporter::value(const char *name, const char *label, const char *labelValue,
+                            uint64_t sample)
+{
+    append(METRICS_PREFIX "%s{%s=\"%s\"} %llu\n", name, label, labelValue,
+           (unsigned long long) sample);
+}
+
+// Integer formatting of a microsecond count as seconds, to stay clear of printf's float
+// path on a hot handler
+void MetricsExporter::seconds(const char *name, uint64_t us)
+{
+    append(METRICS_PREFIX "%s %llu.%06llu\n", name, (unsigned long long) (us / 1000000ULL),
+           (unsigned long long) (us % 1000000ULL));
+}
+
+void MetricsExporter::seconds(const char *name, const char *label, const char *labelValue,
+                              uint64_t us)
+{
+    append(METRICS_PREFIX "%s{%s=\"%s\"} %llu.%06llu\n", name, label, labelValue,
+           (unsigned long long) (us / 1000000ULL), (unsigned long long) (us % 1000000ULL));
+}
+
+void MetricsExporter::render()
+{
+    length    = 0;
+    truncated = false;
+    buffer[0] = '\0';
+
+    elegoo_stats_t printerStats = elegooCC.getStats();
+    printer_info_t printerInfo  = elegooCC.getCurrentInformation();
+
+    renderDetection(printerStats, printerInfo);
+    renderPauses();
+    renderPrinter(printerStats, printerInfo);
+    renderMemory();
+    renderHttp();
+    renderLogs();
+    renderSystem();
+
+    if (truncated)
+    {
+        memcpy(buffer + length, METRICS_TRUNCATION_NOTE, sizeof(METRICS_TRUNCATION_NOTE) - 1);
+        length += sizeof(METRICS_TRUNCATION_NOTE) - 1;
+    }
+}
+
+void MetricsExporter::renderDetection(const elegoo_stats_t &stats, const printer_info_t &info)
+{
+    family("movement_edges_total", "counter", "Movement sensor level changes");
+    value("movement_edges_total", stats.movementEdges);
+    family("filament_stalls_total", "counter", "Movement timeouts while watching for motion");
+    value("filament_stalls_total", stats.stalls);
+    family("filament_runouts_total", "counter", "Runout switch reporting no filament");
+    value("filament_runouts_total", stats.runouts);
+    family("filament_stopped", "gauge", "1 while filament movement has timed out");
+    value("filament_stopped", info.filamentStopped ? 1 : 0);
+    family("filament_runout", "gauge", "1 while the runout switch reports no filament");
+    value("filament_runout", info.filamentRunout ? 1 : 0);
+}
+
+void MetricsExporter::renderPauses()
+{
+    if (pauseAttemptData == nullptr)
+    {
+        return;
+    }
+    const PauseAttemptStats &stats = pauseAttemptData->getStats();
+
+    family("pause_attempts_total", "counter", "Pause attempts by outcome");
+    for (int i = 0; i < PAUSE_ATTEMPT_TYPE_COUNT; i++)
+    {
+        value("pause_attempts_total", "type", PAUSE_TYPE_NAMES[i], stats.countByType[i]);
+    }
+
+    family("pause_latency_seconds", "histogram", "First pause command to printer paused");
+    uint64_t cumulative = 0;
+    for (int i = 0; i < PAUSE_LATENCY_BUCKETS; i++)
+    {
+        cumulative += stats.latencyBuckets[i];
+        if (i < PAUSE_LATENCY_BUCKETS - 1)
+        {
+            char bound[16];
+            snprintf(bound, sizeof(bound), "%lu.%03lu",
+                     (unsigned long) (PAUSE_LATENCY_BOUNDS_MS[i] / 1000),
+                     (unsigned long) (PAUSE_LATENCY_BOUNDS_MS[i] % 1000));
+            value("pause_latency_seconds_bucket", "le", bound, cumulative);
+        }
+        else
+        {
+            value("pause_latency_seconds_bucket", "le", "+Inf", cumulative);
+        }
+    }
+    seconds("pause_latency_seconds_sum", (uint64_t) stats.latencySumMs * 1000);
+    value("pause_latency_seconds_count", stats.latencyCount);
+}
+
+void MetricsExporter::renderPrinter(const elegoo_stats_t &stats, const printer_info_t &info)
+{
+    family("printer_connected", "gauge", "1 while the printer websocket is open");
+    value("printer_connected", info.isWebsocketConnected ? 1 : 0);
+    family("printer_connects_total", "counter", "Printer websocket connections established");
+    value("printer_connects_total", stats.connects);
+    family("printer_reconnects_total", "counter", "Connections after the first since boot");
+    value("printer_reconnects_total", stats.connects > 1 ? stats.connects - 1 : 0);
+    family("printer_disconnects_total", "counter", "Printer websocket connections lost");
+    value("printer_disconnects_total", stats.disconnects);
+    family("printer_commands_total", "counter", "Commands sent to the printer");
+    value("printer_commands_total", stats.commandsSent);
+
+    family("printer_rtt_seconds", "summary", "Command sent to the printer's response");
+    seconds("printer_rtt_seconds_sum", stats.rttSumUs);
+    value("printer_rtt_seconds_count", stats.responses);
+    family("printer_rtt_last_seconds", "gauge", "Round trip of the most recent command");
+    seconds("printer_rtt_last_seconds", stats.lastRttUs);
+    family("printer_rtt_max_seconds", "gauge", "Slowest command round trip since boot");
+    seconds("printer_rtt_max_seconds", stats.rttMaxUs);
+}
+
+void MetricsExporter::renderMemory()
+{
+    family("heap_free_bytes", "gauge", "Free internal heap");
+    value("heap_free_bytes", heap_caps_get_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT));
+    family("heap_min_free_bytes", "gauge", "Lowest free internal heap since boot");
+    value("heap_min_free_bytes",
+          heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT));
+    family("heap_largest_free_block_bytes", "gauge", "Largest internal heap allocation possible");
+    value("heap_largest_free_block_bytes",
+          heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT));
+
+    bool psram = memoryPolicy.hasPsram();
+    family("psram_total_bytes", "gauge", "PSRAM heap size, 0 without PSRAM");
+    value("psram_total_bytes", psram ? heap_caps_get_total_size(MALLOC_CAP_SPIRAM) : 0);
+    family("psram_free_bytes", "gauge", "Free PSRAM heap");
+    value("psram_free_bytes", psram ? heap_caps_get_free_size(MALLOC_CAP_SPIRAM) : 0);
+
+    storage_fs_stats_t fs = storageManager.getFsStats();
+    family("fs_total_bytes", "gauge", "LittleFS partition size");
+    value("fs_total_bytes", fs.totalBytes);
+    family("fs_used_bytes", "gauge", "LittleFS space in use as of the last refresh");
+    value("fs_used_bytes", fs.usedBytes);
+
+    storage_file_entry_t files[STORAGE_MAX_FILES];
+    int                  count = storageManager.snapshotFiles(files);
+    family("storage_bytes_written_total", "counter", "Bytes written to each tracked file");
+    for (int i = 0; i < count; i++)
+    {
+        value("storage_bytes_written_total", "file", files[i].path, files[i].bytesWritten);
+    }
+}
+
+void MetricsExporter::renderHttp()
+{
+    endpoint_stats_t endpoints[ENDPOINT_STATS_MAX_ENDPOINTS];
+    int              count = endpointStats.snapshot(endpoints);
+
+    family("http_request_duration_seconds", "summary", "Time spent in each endpoint's handler");
+    for (int i = 0; i < count; i++)
+    {
+        seconds("http_request_duration_seconds_sum", "endpoint", endpoints[i].name,
+                endpoints[i].totalUs);
+    }
+    for (int i = 0; i < count; i++)
+    {
+        value("http_request_duration_seconds_count", "endpoint", endpoints[i].name,
+              endpoints[i].requests);
+    }
+    family("http_request_duration_max_seconds", "gauge", "Slowest request to each endpoint");
+    for (int i = 0; i < count; i++)
+    {
+        seconds("http_request_duration_max_seconds", "endpoint", endpoints[i].name,
+                endpoints[i].maxUs);
+    }
+    family("http_request_peak_heap_bytes", "gauge", "Most heap one request has held");
+    for (int i = 0; i < count; i++)
+    {
+        value("http_request_peak_heap_bytes", "endpoint", endpoints[i].name,
+              endpoints[i].peakHeapBytes);
+    }
+}
+
+void MetricsExporter::renderLogs()
+{
+    log_stats_t stats = logger.getStats();
+
+    family("log_entries_total", "counter", "Log lines written");
+    value("log_entries_total", stats.entries);
+    family("log_dropped_total", "counter", "Log lines lost before anyone could read them");
+    value("log_dropped_total", "reason", "ring_overwritten", stats.ringEvictions);
+    value("log_dropped_total", "reason", "file_write_failed", stats.fileWriteFailures);
+    family("log_truncated_total", "counter", "Log lines shortened to fit the ring");
+    value("log_truncated_total", stats.truncated);
+    family("log_file_rotations_total", "counter", "Times the full log file was discarded");
+    value("log_file_rotations_total", stats.fileRotations);
+
+    family("push_clients", "gauge", "Browsers connected to the live event stream");
+    value("push_clients", pushChannel.getClientCount());
+    family("push_dropped_events_total", "counter", "Live events dropped for slow clients");
+    value("push_dropped_events_total", pushChannel.getDroppedEvents());
+}
+
+void MetricsExporter::renderSystem()
+{
+    family("uptime_seconds", "gauge", "Time since boot");
+    value("uptime_seconds", esp_timer_get_time() / 1000000LL);
+
+    family("cpu_usage_percent", "gauge", "Core utilization over the last sample interval");
+    for (int core = 0; core < SYSTEM_METRICS_CORES; core++)
+    {
+        int usage = systemMetrics.getCoreUsage(core);
+        if (usage >= 0)
+        {
+            char name[4];
+            snprintf(name, sizeof(name), "%d", core);
+            value("cpu_usage_percent", "core", name, usage);
+        }
+    }
+
+    loop_metrics_t loop = systemMetrics.getLoopMetrics();
+    family("loop_iteration_p99_seconds", "gauge", "99th percentile main loop iteration time");
+    seconds("loop_iteration_p99_seconds", loop.p99Us);
+    family("loop_iteration_max_seconds", "gauge", "Slowest main loop iteration last interval");
+    seconds("loop_iteration_max_seconds", loop.maxUs);
+
+    loop_phase_stats_t phases[LOOP_PHASE_COUNT];
+    int                phaseCount = loopWatchdog.snapshot(phases);
+    family("loop_phase_seconds_total", "counter", "Main loop time spent in each phase");
+    for (int i = 0; i < phaseCount; i++)
+    {
+        seconds("loop_phase_seconds_total", "phase", LoopWatchdog::getPhaseName((loop_phase_t) i),
+                phases[i].totalUs);
+    }
+    family("loop_phase_max_seconds", "gauge", "Longest single run of each main loop phase");
+    for (int i = 0; i < phaseCount; i++)
+    {
+        seconds("loop_phase_max_seconds", "phase", LoopWatchdog::getPhaseName((loop_phase_t) i),
+                phases[i].maxUs);
+    }
+    family("loop_stalls_total", "counter", "Main loop phases that ran past the stall threshold");
+    for (int i = 0; i < phaseCount; i++)
+    {
+        value("loop_stalls_total", "phase", LoopWatchdog::getPhaseName((loop_phase_t) i),
+              phases[i].stalls);
+    }
+
+    job_stats_t jobs[JOB_MAX_JOBS];
+    int         jobCount = jobScheduler.snapshot(jobs);
+    family("job_runs_total", "counter", "Runs of each scheduled main loop job");
+    for (int i = 0; i < jobCount; i++)
+    {
+        value("job_runs_total", "job", jobs[i].name, jobs[i].runs);
+    }
+    family("job_run_seconds_total", "counter", "Time spent running each job");
+    for (int i = 0; i < jobCount; i++)
+    {
+        seconds("job_run_seconds_total", "job", jobs[i].name, jobs[i].totalUs);
+    }
+    family("job_lateness_max_seconds", "gauge", "Longest a job has started after its deadline");
+    for (int i = 0; i < jobCount; i++)
+    {
+        seconds("job_lateness_max_seconds", "job", jobs[i].name,
+                (uint64_t) jobs[i].maxLatenessMs * 1000);
+    }
+    family("job_overruns_total", "counter", "Periods a job skipped because it ran too late");
+    for (int i = 0; i < jobCount; i++)
+    {
+        value("job_overruns_total", "job", jobs[i].name, jobs[i].overruns);
+    }
+
+    family("metrics_scrapes_total", "counter", "Scrapes of this endpoint");
+    value("metrics_scrapes_total", scrapes);
+    family("metrics_busy_rejections_total", "counter", "Scrapes refused while one was sending");
+    value("metrics_busy_rejections_total", busyRejections);
+    family("metrics_render_seconds", "gauge", "Time the previous scrape took to render");
+    seconds("metrics_render_seconds", lastRenderUs);
+}
@@ -0,0 +1,69 @@
+#ifndef METRICS_EXPORTER_H
+#define METRICS_EXPORTER_H
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+
+#include "ElegooCC.h"
+
+// Render buffer size; a full scrape is around 6 KB with every endpoint hit
+#define METRICS_INTERNAL_BUFFER (8 * 1024)
+#define METRICS_PSRAM_BUFFER (16 * 1024)
+
+// Prometheus text exposition for /metrics. Every scrape is rendered with snprintf into one
+// buffer allocated at startup and sent straight from it, so a scrape allocates nothing
+// beyond the response object and all counters are read from what their owners already
+// keep. Handlers and responses all run on the async_tcp task; a scrape that arrives while
+// the previous one is still being sent gets 503 instead of a second buffer.
+class MetricsExporter
+{
+   private:
+    char  *buffer;
+    size_t capacity;
+    size_t length;
+    bool   truncated;
+    bool   inFlight;
+
+    uint32_t scrapes;
+    uint32_t busyRejections;
+    uint32_t lastRenderUs;
+
+    MetricsExporter();
+
+    // Delete copy constructor and assignment operator
+    MetricsExporter(const MetricsExporter &)            = delete;
+    MetricsExporter &operator=(const MetricsExporter &) = delete;
+
+    void append(const char *format, ...);
+    void family(const char *name, const char *type, const char *help);
+    void value(const char *name, uint64_t sample);
+    void value(const char *name, const char *label, const char *labelValue, uint64_t sample);
+    void seconds(const char *name, uint64_t us);
+    void seconds(const char *name, const char *label, const char *labelValue, uint64_t us);
+
+    void render();
+    void renderDetection(const elegoo_stats_t &stats, const printer_info_t &info);
+    void renderPauses();
+    void renderPrinter(const elegoo_stats_t &stats, const printer_info_t &info);
+    void renderMemory();
+    void renderHttp();
+    void renderLogs();
+    void renderSystem();
+
+   public:
+    // Singleton access method
+    static MetricsExporter &getInstance();
+
+    // Allocate the render buffer; call once from WebServer::begin()
+    void begin();
+
+    void handle(AsyncWebServerRequest *request);
+
+    // Called when the response sending the buffer is done with it
+    void finishScrape();
+};
+
+// Convenience macro for easier access
+#define metricsExporter MetricsExporter::getInstance()
+
+#endif  // METRICS_EXPORTER_H
@@ -1,125 +1,329 @@
 #include "PauseAttemptData.h"
+#include "FlushScheduler.h"
 #include "Logger.h"
+#include "MemoryPolicy.h"
+#include "TimeBase.h"
 
-extern unsigned long getTime();
+#include <esp_rom_crc.h>
+
+// Journal layout: a sequence of [header][payload] records. Each attempt is appended as an
+// ATTEMPT record followed by a COMMIT record carrying the running statistics; on load,
+// attempts after the last valid commit (a torn write) are discarded.
+enum PauseJournalRecordKind : uint8_t {
+    PAUSE_JOURNAL_ATTEMPT = 0xA1,
+    PAUSE_JOURNAL_COMMIT = 0xC1
+};
+
+struct __attribute__((packed)) PauseJournalHeader {
+    uint8_t kind;
+    uint8_t reserved;
+    uint16_t length; // Payload bytes that follow
+    uint32_t crc;    // CRC32 of the payload
+};
+
+struct __attribute__((packed)) PauseJournalAttempt {
+    uint64_t timestamp; // Epoch µs, 0 if the clock wasn't synced yet
+    uint8_t type;
+    uint8_t retryCount;
+    int16_t printStatus;
+};
+
+static uint32_t journalCrc(const void* payload, size_t length) {
+    return esp_rom_crc32_le(0, (const uint8_t*) payload, length);
+}
+
+static size_t writeJournalRecord(File& file, uint8_t kind, const void* payload, uint16_t length) {
+    PauseJournalHeader header = {kind, 0, length, journalCrc(payload, length)};
+    size_t written = file.write((const uint8_t*) &header, sizeof(header));
+    written += file.write((const uint8_t*) payload, length);
+    return written;
+}
+
+// Reads one record into payload; false at end of file or on a damaged record
+static bool readJournalRecord(File& file, PauseJournalHeader& header, void* payload, size_t maxLength) {
+    if (file.read((uint8_t*) &header, sizeof(header)) != sizeof(header)) return false;
+    if (header.length > maxLength) return false;
+    if (file.read((uint8_t*) payload, header.length) != header.length) return false;
+    return journalCrc(payload, header.length) == header.crc;
+}
 
 PauseAttemptData::PauseAttemptData(const String& filePath) : 
     dataFilePath(filePath), 
     currentIndex(0), 
     totalPoints(0), 
-    isCircularBuffer(false) {
+    isCircularBuffer(false),
+    pendingInitialStamp(0),
+    unflushedPoints(0),
+    loaded(false),
+    version(0) {
+    
+    memset(&stats, 0, sizeof(stats));
+    journalFile = storageManager.track(dataFilePath.c_str(), MAX_DATA_SIZE);
+    // Pause events are rare and matter most after a crash, so they go out right away
+    flushStore = flushScheduler.registerStore(dataFilePath.c_str(), FLUSH_IMMEDIATE,
+                                              [this]() { flush(); });
+    
+    capacity = memoryPolicy.scaleCapacity(INTERNAL_POINTS_PER_SERIES, PSRAM_POINTS_PER_SERIES);
+    dataBuffer = (PauseAttemptPoint*) memoryPolicy.allocate(capacity * sizeof(PauseAttemptPoint), ALLOC_HISTORY);
+    if (dataBuffer == nullptr && capacity > INTERNAL_POINTS_PER_SERIES) {
+        capacity = INTERNAL_POINTS_PER_SERIES;
+        dataBuffer = (PauseAttemptPoint*) memoryPolicy.allocate(capacity * sizeof(PauseAttemptPoint), ALLOC_HISTORY);
+    }
+    if (dataBuffer == nullptr) {
+        capacity = 0;
+        logger.logf("Failed to allocate pause attempt buffer for %s", dataFilePath.c_str());
+        return;
+    }
     
-    dataBuffer = new PauseAttemptPoint[MAX_POINTS_PER_SERIES];
-    loadDataFromFile();
+    // The journal is replayed by load(), off the boot critical path
 }
 
 PauseAttemptData::~PauseAttemptData() {
-    writeDataToFile();
-    delete[] dataBuffer;
+    // Every attempt is already on flash, nothing to write back
+    memoryPolicy.release(dataBuffer, ALLOC_HISTORY);
 }
 
 void PauseAttemptData::addAttempt(PauseAttemptType type, int retryCount, int printStatus) {
-    addAttempt(getTime(), type, retryCount, printStatus);
+    addAttempt(timeBase.now(), type, retryCount, printStatus);
+}
+
+void PauseAttemptData::load() {
+    if (loaded) return;
+    loaded = true;
+    if (dataBuffer == nullptr) return;
+    
+    loadJournal();
+    version++;
+}
+
+bool PauseAttemptData::isLoaded() {
+    return loaded;
 }
 
-void PauseAttemptData::addAttempt(unsigned long timestamp, PauseAttemptType type, int retryCount, int printStatus) {
+void PauseAttemptData::addAttempt(uint64_t timestamp, PauseAttemptType type, int retryCount, int printStatus) {
     if (dataBuffer == nullptr) return;
+    // Replay first, so the statistics carry on from the journal and the ring stays ordered
+    load();
     
-    dataBuffer[currentIndex] = {timestamp, type, retryCount, printStatus};
+    PauseAttemptPoint point = {timestamp, type, retryCount, printStatus};
+    storePoint(point);
+    updateStats(point);
+    version++;
     
-    currentIndex = (currentIndex + 1) % MAX_POINTS_PER_SERIES;
+    if (unflushedPoints < capacity) {
+        unflushedPoints++;
+    }
+    flushScheduler.markDirty(flushStore);
+}
+
+void PauseAttemptData::flush() {
+    if (unflushedPoints == 0) return;
+    
+    if (!appendToJournal()) {
+        // A short write leaves a torn record, and replay stops at the first bad one, so
+        // every later commit would be lost. Rewrite the journal from memory, which drops
+        // the torn tail; the attempts being flushed are in the ring and go with it. If
+        // that fails too they stay pending for the next flush.
+        logger.logf("Failed to append pause attempts to %s, rewriting it", dataFilePath.c_str());
+        compactJournal();
+        return;
+    }
+    unflushedPoints = 0;
+    if (storageManager.isOverQuota(journalFile)) {
+        compactJournal();
+    }
+}
+
+void PauseAttemptData::storePoint(const PauseAttemptPoint& point) {
+    dataBuffer[currentIndex] = point;
+    
+    currentIndex = (currentIndex + 1) % capacity;
     
     if (!isCircularBuffer) {
         totalPoints++;
-        if (totalPoints >= MAX_POINTS_PER_SERIES) {
+        if (totalPoints >= capacity) {
             isCircularBuffer = true;
-            totalPoints = MAX_POINTS_PER_SERIES;
+            totalPoints = capacity;
         }
     }
+}
+
+void PauseAttemptData::updateStats(const PauseAttemptPoint& point) {
+    if (point.type < PAUSE_ATTEMPT_TYPE_COUNT) {
+        stats.countByType[point.type]++;
+    }
     
-    // Check if we need to rotate data to stay under size limit
-    if (getDataSize() > MAX_DATA_SIZE) {
-        rotateData();
+    switch (point.type) {
+        case PAUSE_ATTEMPT_INITIAL:
+            // Retries send a fresh INITIAL; latency runs from the first one
+            if (pendingInitialStamp == 0) {
+                pendingInitialStamp = point.timestamp;
+            }
+            break;
+        case PAUSE_ATTEMPT_SUCCESS:
+            if (pendingInitialStamp != 0) {
+                uint64_t start = timeBase.resolve(pendingInitialStamp);
+                uint64_t end = timeBase.resolve(point.timestamp);
+                uint32_t latencyMs = end > start ? (uint32_t) ((end - start) / 1000ULL) : 0;
+                
+                size_t bucket = 0;
+                while (bucket < PAUSE_LATENCY_BUCKETS - 1 && latencyMs > PAUSE_LATENCY_BOUNDS_MS[bucket]) {
+                    bucket++;
+                }
+                stats.latencyBuckets[bucket]++;
+                stats.latencyCount++;
+                stats.latencySumMs += latencyMs;
+                if (latencyMs > stats.latencyMaxMs) {
+                    stats.latencyMaxMs = latencyMs;
+                }
+            }
+            pendingInitialStamp = 0;
+            break;
+        case PAUSE_ATTEMPT_MAX_EXCEEDED:
+            pendingInitialStamp = 0;
+            break;
+        default:
+            break;
     }
 }
 
-void PauseAttemptData::writeDataToFile() {
-    if (!LittleFS.begin()) return;
-    
-    File file = LittleFS.open(dataFilePath, "w");
-    if (!file) return;
+bool PauseAttemptData::appendToJournal() {
+    File file = LittleFS.open(dataFilePath, "a");
+    if (!file) return false;
+    
+    // Every attempt since the last flush, then one commit with the totals after them all
+    size_t startIndex = (currentIndex + capacity - unflushedPoints) % capacity;
+    size_t written = 0;
+    for (size_t i = 0; i < unflushedPoints; i++) {
+        const PauseAttemptPoint& point = dataBuffer[(startIndex + i) % capacity];
+        PauseJournalAttempt record = {
+            timeBase.toPersistedUs(point.timestamp),
+            (uint8_t) point.type,
+            (uint8_t) point.retryCount,
+            (int16_t) point.printStatus
+        };
+        written += writeJournalRecord(file, PAUSE_JOURNAL_ATTEMPT, &record, sizeof(record));
+    }
+    written += writeJournalRecord(file, PAUSE_JOURNAL_COMMIT, &stats, sizeof(stats));
     
-    DynamicJsonDocument doc(8192);
-    doc["currentIndex"] = currentIndex;
-    doc["totalPoints"] = totalPoints;
-    doc["isCircularBuffer"] = isCircularBuffer;
+    // Closing the file is what makes the batch durable on LittleFS
+    file.close();
     
-    JsonArray dataArray = doc.createNestedArray("data");
+    storageManager.addFileBytes(journalFile, written);
+    return written == (unflushedPoints + 1) * sizeof(PauseJournalHeader) +
+                      unflushedPoints * sizeof(PauseJournalAttempt) + sizeof(stats);
+}
+
+void PauseAttemptData::loadJournal() {
+    File file = LittleFS.open(dataFilePath, "r");
+    if (!file) return;
     
-    size_t pointsToWrite = isCircularBuffer ? MAX_POINTS_PER_SERIES : totalPoints;
-    size_t startIndex = isCircularBuffer ? currentIndex : 0;
+    size_t fileSize = file.size();
+    PauseJournalHeader header;
+    uint8_t payload[sizeof(PauseAttemptStats)];
     
-    for (size_t i = 0; i < pointsToWrite; i++) {
-        size_t index = (startIndex + i) % MAX_POINTS_PER_SERIES;
-        JsonObject point = dataArray.createNestedObject();
-        point["timestamp"] = dataBuffer[index].timestamp;
-        point["type"] = (int)dataBuffer[index].type;
-        point["retryCount"] = dataBuffer[index].retryCount;
-        point["printStatus"] = dataBuffer[index].printStatus;
+    // First pass: find where the last complete commit ends
+    size_t committedEnd = 0;
+    while (readJournalRecord(file, header, payload, sizeof(payload))) {
+        if (header.kind == PAUSE_JOURNAL_COMMIT && header.length == sizeof(PauseAttemptStats)) {
+            committedEnd = file.position();
+            memcpy(&stats, payload, sizeof(stats));
+        }
     }
     
-    serializeJson(doc, file);
+    // Second pass: replay attempts up to that point into the ring
+    file.seek(0);
+    while (file.position() < committedEnd && readJournalRecord(file, header, payload, sizeof(payload))) {
+        if (header.kind != PAUSE_JOURNAL_ATTEMPT || header.length != sizeof(PauseJournalAttempt)) {
+            continue;
+        }
+        PauseJournalAttempt record;
+        memcpy(&record, payload, sizeof(record));
+        storePoint({timeBase.fromPersistedUs(record.timestamp), (PauseAttemptType) record.type,
+                    record.retryCount, record.printStatus});
+    }
     file.close();
+    
+    storageManager.setFileSize(journalFile, committedEnd, false);
+    if (committedEnd != fileSize) {
+        // Torn or damaged tail; rewrite so new appends aren't stranded behind it
+        logger.logf("Pause journal %s had %u damaged bytes, compacting", dataFilePath.c_str(),
+                    (unsigned) (fileSize - committedEnd));
+        compactJournal();
+    }
 }
 
-void PauseAttemptData::loadDataFromFile() {
-    if (!LittleFS.begin()) return;
-    
-    File file = LittleFS.open(dataFilePath, "r");
+void PauseAttemptData::compactJournal() {
+    String tempPath = dataFilePath + ".tmp";
+    File file = LittleFS.open(tempPath, "w");
     if (!file) return;
     
-    DynamicJsonDocument doc(8192);
-    DeserializationError error = deserializeJson(doc, file);
-    file.close();
-    
-    if (error) return;
+    // Keep the newest attempts and one commit with the running totals
+    size_t pointsToWrite = totalPoints < MAX_COMPACTED_POINTS ? totalPoints : MAX_COMPACTED_POINTS;
+    size_t startIndex = (currentIndex + capacity - pointsToWrite) % capacity;
+    size_t written = 0;
     
-    currentIndex = doc["currentIndex"] | 0;
-    totalPoints = doc["totalPoints"] | 0;
-    isCircularBuffer = doc["isCircularBuffer"] | false;
+    for (size_t i = 0; i < pointsToWrite; i++) {
+        const PauseAttemptPoint& point = dataBuffer[(startIndex + i) % capacity];
+        PauseJournalAttempt record = {
+            timeBase.toPersistedUs(point.timestamp),
+            (uint8_t) point.type,
+            (uint8_t) point.retryCount,
+            (int16_t) point.printStatus
+        };
+        written += writeJournalRecord(file, PAUSE_JOURNAL_ATTEMPT, &record, sizeof(record));
+    }
+    written += writeJournalRecord(file, PAUSE_JOURNAL_COMMIT, &stats, sizeof(stats));
+    file.close();
     
-    JsonArray dataArray = doc["data"];
-    size_t arraySize = dataArray.size();
+    size_t expected = (pointsToWrite + 1) * sizeof(PauseJournalHeader) +
+                      pointsToWrite * sizeof(PauseJournalAttempt) + sizeof(stats);
+    if (written != expected) {
+        logger.logf("Failed to write compacted pause journal for %s", dataFilePath.c_str());
+        LittleFS.remove(tempPath);
+        return;
+    }
     
-    for (size_t i = 0; i < arraySize && i < MAX_POINTS_PER_SERIES; i++) {
-        JsonObject point = dataArray[i];
-        dataBuffer[i].timestamp = point["timestamp"];
-        dataBuffer[i].type = (PauseAttemptType)(int)point["type"];
-        dataBuffer[i].retryCount = point["retryCount"];
-        dataBuffer[i].printStatus = point["printStatus"];
+    // rename replaces the journal atomically, so a reset leaves either the old one or this one
+    if (!LittleFS.rename(tempPath, dataFilePath)) {
+        logger.logf("Failed to replace pause journal %s", dataFilePath.c_str());
+        LittleFS.remove(tempPath);
+        return;
     }
+    storageManager.setFileSize(journalFile, written);
+    unflushedPoints = 0;
 }
 
-String PauseAttemptData::getDataAsJSON(size_t maxPoints) {
-    DynamicJsonDocument doc(4096);
-    JsonArray dataArray = doc.createNestedArray("data");
-    
+size_t PauseAttemptData::getDataJsonCapacity(size_t maxPoints) {
     size_t pointsToReturn = min(maxPoints, totalPoints);
+    return JSON_OBJECT_SIZE(1) + JSON_ARRAY_SIZE(pointsToReturn) +
+           pointsToReturn * JSON_OBJECT_SIZE(4);
+}
+
+void PauseAttemptData::writeDataJson(JsonObject out, size_t maxPoints) {
+    size_t pointsToReturn = min(maxPoints, totalPoints);
+    JsonArray dataArray = out.createNestedArray("data");
+    
     size_t startIndex = isCircularBuffer ? 
-        (currentIndex + MAX_POINTS_PER_SERIES - pointsToReturn) % MAX_POINTS_PER_SERIES : 
+        (currentIndex + capacity - pointsToReturn) % capacity : 
         (totalPoints > pointsToReturn ? totalPoints - pointsToReturn : 0);
     
     for (size_t i = 0; i < pointsToReturn; i++) {
         size_t index = isCircularBuffer ? 
-            (startIndex + i) % MAX_POINTS_PER_SERIES : 
+            (startIndex + i) % capacity : 
             startIndex + i;
             
         JsonObject point = dataArray.createNestedObject();
-        point["timestamp"] = dataBuffer[index].timestamp;
+        point["timestamp"] = timeBase.toSeconds(dataBuffer[index].timestamp);
         point["type"] = (int)dataBuffer[index].type;
         point["retryCount"] = dataBuffer[index].retryCount;
         point["printStatus"] = dataBuffer[index].printStatus;
     }
+}
+
+String PauseAttemptData::getDataAsJSON(size_t maxPoints) {
+    ScratchJsonDocument doc(getDataJsonCapacity(maxPoints));
+    writeDataJson(doc.to<JsonObject>(), maxPoints);
     
     String result;
     serializeJson(doc, result);
@@ -127,21 +331,33 @@ String PauseAttemptData::getDataAsJSON(size_t maxPoints) {
 }
 
 String PauseAttemptData::getRecentData(size_t minutes) {
-    unsigned long cutoffTime = getTime() - (minutes * 60);
-    
-    DynamicJsonDocument doc(4096);
-    JsonArray dataArray = doc.createNestedArray("data");
+    // Compare resolved stamps so attempts from before the NTP sync line up with later ones
+    uint64_t now = timeBase.now();
+    uint64_t window = (uint64_t) minutes * 60 * 1000000ULL;
+    uint64_t cutoffTime = now > window ? now - window : 0;
     
     size_t pointsToCheck = totalPoints;
     size_t startIndex = isCircularBuffer ? currentIndex : 0;
     
+    // Count first so the document is sized for exactly what is returned
+    size_t recentPoints = 0;
+    for (size_t i = 0; i < pointsToCheck; i++) {
+        if (timeBase.resolve(dataBuffer[(startIndex + i) % capacity].timestamp) >= cutoffTime) {
+            recentPoints++;
+        }
+    }
+    
+    ScratchJsonDocument doc(JSON_OBJECT_SIZE(1) + JSON_ARRAY_SIZE(recentPoints) +
+                            recentPoints * JSON_OBJECT_SIZE(4));
+    JsonArray dataArray = doc.createNestedArray("data");
+    
     for (size_t i = 0; i < pointsToCheck; i++) {
         size_t index = isCircularBuffer ? 
-            (startIndex + i) % MAX_POINTS_PER_SERIES : i;
+            (startIndex + i) % capacity : i;
             
-        if (dataBuffer[index].timestamp >= cutoffTime) {
+        if (timeBase.resolve(dataBuffer[index].timestamp) >= cutoffTime) {
             JsonObject point = dataArray.createNestedObject();
-            point["timestamp"] = dataBuffer[index].timestamp;
+            point["timestamp"] = timeBase.toSeconds(dataBuffer[index].timestamp);
             point["type"] = (int)dataBuffer[index].type;
             point["retryCount"] = dataBuffer[index].retryCount;
             point["printStatus"] = dataBuffer[index].printStatus;
@@ -153,92 +369,74 @@ String PauseAttemptData::getRecentData(size_t minutes) {
     return result;
 }
 
-String PauseAttemptData::getStatistics() {
-    DynamicJsonDocument doc(2048);
-    
-    int initialAttempts = 0;
-    int retryAttempts = 0;
-    int successfulPauses = 0;
-    int maxExceeded = 0;
-    int alreadyPaused = 0;
-    
-    size_t pointsToCheck = totalPoints;
-    size_t startIndex = isCircularBuffer ? currentIndex : 0;
-    
-    for (size_t i = 0; i < pointsToCheck; i++) {
-        size_t index = isCircularBuffer ? 
-            (startIndex + i) % MAX_POINTS_PER_SERIES : i;
-            
-        switch (dataBuffer[index].type) {
-            case PAUSE_ATTEMPT_INITIAL:
-                initialAttempts++;
-                break;
-            case PAUSE_ATTEMPT_RETRY:
-                retryAttempts++;
-                break;
-            case PAUSE_ATTEMPT_SUCCESS:
-                successfulPauses++;
-                break;
-            case PAUSE_ATTEMPT_MAX_EXCEEDED:
-                maxExceeded++;
-                break;
-            case PAUSE_ATTEMPT_ALREADY_PAUSED:
-                alreadyPaused++;
-                break;
-        }
+void PauseAttemptData::writeStatistics(JsonObject doc) {
+    uint32_t totalAttempts = 0;
+    for (size_t i = 0; i < PAUSE_ATTEMPT_TYPE_COUNT; i++) {
+        totalAttempts += stats.countByType[i];
     }
     
-    doc["totalAttempts"] = totalPoints;
-    doc["initialAttempts"] = initialAttempts;
-    doc["retryAttempts"] = retryAttempts;
-    doc["successfulPauses"] = successfulPauses;
-    doc["maxExceeded"] = maxExceeded;
-    doc["alreadyPaused"] = alreadyPaused;
+    doc["totalAttempts"] = totalAttempts;
+    doc["initialAttempts"] = stats.countByType[PAUSE_ATTEMPT_INITIAL];
+    doc["retryAttempts"] = stats.countByType[PAUSE_ATTEMPT_RETRY];
+    doc["successfulPauses"] = stats.countByType[PAUSE_ATTEMPT_SUCCESS];
+    doc["maxExceeded"] = stats.countByType[PAUSE_ATTEMPT_MAX_EXCEEDED];
+    doc["alreadyPaused"] = stats.countByType[PAUSE_ATTEMPT_ALREADY_PAUSED];
     doc["dataSize"] = getDataSize();
     doc["maxDataSize"] = MAX_DATA_SIZE;
+    doc["capacity"] = capacity;
+    doc["bufferedAttempts"] = totalPoints;
+    
+    // Pause latency from the first INITIAL to SUCCESS
+    JsonObject latency = doc.createNestedObject("latency");
+    latency["count"] = stats.latencyCount;
+    latency["avgMs"] = stats.latencyCount > 0 ? stats.latencySumMs / stats.latencyCount : 0;
+    latency["maxMs"] = stats.latencyMaxMs;
+    JsonArray buckets = latency.createNestedArray("buckets");
+    for (size_t i = 0; i < PAUSE_LATENCY_BUCKETS; i++) {
+        JsonObject bucket = buckets.createNestedObject();
+        if (i < PAUSE_LATENCY_BUCKETS - 1) {
+            bucket["le"] = PAUSE_LATENCY_BOUNDS_MS[i];
+        } else {
+            bucket["le"] = "+Inf";
+        }
+        bucket["count"] = stats.latencyBuckets[i];
+    }
+}
+
+String PauseAttemptData::getStatistics() {
+    StaticJsonDocument<PAUSE_STATISTICS_JSON_SIZE> doc;
+    writeStatistics(doc.to<JsonObject>());
     
     String result;
     serializeJson(doc, result);
     return result;
 }
 
+const PauseAttemptStats& PauseAttemptData::getStats() {
+    return stats;
+}
+
 void PauseAttemptData::clearData() {
+    // Nothing left to replay
+    loaded = true;
     currentIndex = 0;
     totalPoints = 0;
     isCircularBuffer = false;
-    if (LittleFS.begin()) {
-        LittleFS.remove(dataFilePath);
-    }
-}
-
-void PauseAttemptData::rotateData() {
-    // Remove oldest 25% of data to stay under size limit
-    size_t pointsToRemove = totalPoints / 4;
-    if (pointsToRemove == 0) pointsToRemove = 1;
-    
-    // Shift data to remove oldest points
-    for (size_t i = 0; i < totalPoints - pointsToRemove; i++) {
-        size_t sourceIndex = isCircularBuffer ? 
-            (currentIndex + pointsToRemove + i) % MAX_POINTS_PER_SERIES : 
-            pointsToRemove + i;
-        dataBuffer[i] = dataBuffer[sourceIndex];
-    }
-    
-    totalPoints -= pointsToRemove;
-    currentIndex = totalPoints;
-    isCircularBuffer = false;
+    pendingInitialStamp = 0;
+    unflushedPoints = 0;
+    memset(&stats, 0, sizeof(stats));
+    version++;
+    storageManager.removeFile(journalFile);
 }
 
 size_t PauseAttemptData::getDataSize() {
-    if (!LittleFS.begin()) return 0;
-    
-    File file = LittleFS.open(dataFilePath, "r");
-    if (!file) return 0;
-    size_t size = file.size();
-    file.close();
-    return size;
+    return storageManager.getFileSize(journalFile);
 }
 
 size_t PauseAttemptData::getPointCount() {
     return totalPoints;
 }
+
+uint32_t PauseAttemptData::getVersion() {
+    return version;
+}
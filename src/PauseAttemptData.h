@@ -5,52 +5,102 @@
 #include <LittleFS.h>
 #include <ArduinoJson.h>
 
+#include "FlushScheduler.h"
+#include "StorageManager.h"
+
 enum PauseAttemptType {
     PAUSE_ATTEMPT_INITIAL = 0,    // Initial pause attempt
     PAUSE_ATTEMPT_RETRY = 1,      // Retry attempt
     PAUSE_ATTEMPT_SUCCESS = 2,    // Successful pause
     PAUSE_ATTEMPT_MAX_EXCEEDED = 3, // Max retries exceeded
-    PAUSE_ATTEMPT_ALREADY_PAUSED = 4 // Attempted pause when already paused/idle
+    PAUSE_ATTEMPT_ALREADY_PAUSED = 4, // Attempted pause when already paused/idle
+    PAUSE_ATTEMPT_TYPE_COUNT
 };
 
 struct PauseAttemptPoint {
-    unsigned long timestamp;
+    uint64_t timestamp; // TimeBase stamp
     PauseAttemptType type;
     int retryCount;
     int printStatus;  // Printer status at time of attempt
 };
 
+// Upper bounds (ms) of the INITIAL -> SUCCESS latency histogram; the last bucket is +Inf
+#define PAUSE_LATENCY_BUCKETS 10
+static const uint32_t PAUSE_LATENCY_BOUNDS_MS[PAUSE_LATENCY_BUCKETS - 1] = {
+    250, 500, 1000, 2000, 5000, 10000, 15000, 30000, 60000};
+
+// Document size needed for the statistics object
+#define PAUSE_STATISTICS_JSON_SIZE                                       \
+    (JSON_OBJECT_SIZE(11) + JSON_OBJECT_SIZE(5) +                        \
+     JSON_ARRAY_SIZE(PAUSE_LATENCY_BUCKETS) + PAUSE_LATENCY_BUCKETS * JSON_OBJECT_SIZE(2))
+
+// Running totals since the journal was created. Written as the commit record after every
+// attempt, so the latest commit is the full statistics and nothing needs rescanning.
+struct PauseAttemptStats {
+    uint32_t countByType[PAUSE_ATTEMPT_TYPE_COUNT];
+    uint32_t latencyCount;
+    uint32_t latencySumMs;
+    uint32_t latencyMaxMs;
+    uint32_t latencyBuckets[PAUSE_LATENCY_BUCKETS];
+};
+
 class PauseAttemptData {
 private:
-    static const size_t MAX_DATA_SIZE = 50 * 1024; // 50KB limit as requested
-    static const size_t MAX_POINTS_PER_SERIES = 500; // Limit data points
-    
+    static const size_t MAX_DATA_SIZE = 50 * 1024; // Journal is compacted past this
+    static const size_t INTERNAL_POINTS_PER_SERIES = 500; // Ring size without PSRAM
+    static const size_t PSRAM_POINTS_PER_SERIES = 5000;
+    static const size_t MAX_COMPACTED_POINTS = 400; // Attempts kept when the journal is compacted
+
     String dataFilePath;
     PauseAttemptPoint* dataBuffer;
+    size_t capacity;
     size_t currentIndex;
     size_t totalPoints;
     bool isCircularBuffer;
-    
-    void writeDataToFile();
-    void loadDataFromFile();
-    void rotateData();
-    
+
+    PauseAttemptStats stats;
+    uint64_t pendingInitialStamp; // First INITIAL of the pause in progress, 0 if none
+    storage_file_t journalFile;   // Size tracked by the storage manager, so appends never stat
+    flush_store_t flushStore;
+    size_t unflushedPoints;       // Newest ring points not yet appended to the journal
+    bool loaded;                  // Journal replayed into the ring (or cleared)
+    uint32_t version;             // Bumped on every change, for response caching
+
+    void storePoint(const PauseAttemptPoint& point);
+    void updateStats(const PauseAttemptPoint& point);
+    bool appendToJournal();
+    void flush();
+    void loadJournal();
+    void compactJournal();
+
 public:
     PauseAttemptData(const String& filePath);
     ~PauseAttemptData();
-    
+
+    // Replay the journal into the ring and statistics. Deferred like TimeSeriesData::load():
+    // called after boot, or by the first addAttempt if that comes sooner.
+    void load();
+    bool isLoaded();
+
     void addAttempt(PauseAttemptType type, int retryCount, int printStatus);
-    void addAttempt(unsigned long timestamp, PauseAttemptType type, int retryCount, int printStatus);
+    void addAttempt(uint64_t timestamp, PauseAttemptType type, int retryCount, int printStatus);
     String getDataAsJSON(size_t maxPoints = 100);
+    // Fill out with the "data" array getDataAsJSON returns, in a document of at least
+    // getDataJsonCapacity(maxPoints) bytes
+    void writeDataJson(JsonObject out, size_t maxPoints = 100);
+    size_t getDataJsonCapacity(size_t maxPoints = 100);
     void clearData();
     size_t getDataSize();
     size_t getPointCount();
-    
+
     // Get recent data points
     String getRecentData(size_t minutes = 60);
-    
+
     // Get statistics
     String getStatistics();
+    void writeStatistics(JsonObject out); // Needs PAUSE_STATISTICS_JSON_SIZE bytes
+    const PauseAttemptStats& getStats();
+    uint32_t getVersion();
 };
 
 #endif
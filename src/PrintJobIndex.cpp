@@ -0,0 +1,435 @@
+#include "PrintJobIndex.h"
+
+#include <LittleFS.h>
+
+#include "Logger.h"
+#include "MemoryPolicy.h"
+#include "TimeBase.h"
+#include "TimeSeriesData.h"
+
+// External timeseries data (from main.cpp)
+extern TimeSeriesData *movementData;
+extern TimeSeriesData *runoutData;
+extern TimeSeriesData *connectionData;
+
+const char *PrintJobIndex::JOBS_FILE_PATH = "/print_jobs.json";
+const char *PrintJobIndex::JOBS_TEMP_PATH = "/print_jobs.json.tmp";
+
+// Serialized size of one job summary object
+#define JOB_SUMMARY_SIZE (JSON_OBJECT_SIZE(18) + PRINT_JOB_MAINBOARD_ID_LEN)
+
+PrintJobIndex &PrintJobIndex::getInstance()
+{
+    static PrintJobIndex instance;
+    return instance;
+}
+
+PrintJobIndex::PrintJobIndex()
+{
+    currentIndex   = 0;
+    totalJobs      = 0;
+    nextJobId      = 1;
+    jobActive      = false;
+    stallStartedAt = 0;
+    jobsFile       = storageManager.track(JOBS_FILE_PATH);
+    flushStore     = flushScheduler.registerStore(JOBS_FILE_PATH, FLUSH_NORMAL,
+                                                  [this]() { writeToFile(); });
+    memset(jobs, 0, sizeof(jobs));
+}
+
+print_job_t *PrintJobIndex::activeJob()
+{
+    if (!jobActive)
+    {
+        return nullptr;
+    }
+    // The active job is always the most recently started one
+    return &jobs[(currentIndex + MAX_JOBS - 1) % MAX_JOBS];
+}
+
+print_job_t *PrintJobIndex::findJob(uint32_t id)
+{
+    for (int i = 0; i < totalJobs; i++)
+    {
+        if (jobs[i].id == id)
+        {
+            return &jobs[i];
+        }
+    }
+    return nullptr;
+}
+
+bool PrintJobIndex::isJobActive()
+{
+    return jobActive;
+}
+
+void PrintJobIndex::startJob(const String &mainboardID, int totalLayers, int totalTicks)
+{
+    if (jobActive)
+    {
+        // Status went inactive without us seeing it (e.g. dropped websocket), close it out
+        endJob(-1);
+    }
+
+    print_job_t &job = jobs[currentIndex];
+    memset(&job, 0, sizeof(job));
+    job.id = nextJobId++;
+    strlcpy(job.mainboardID, mainboardID.c_str(), sizeof(job.mainboardID));
+    job.startTime   = timeBase.now();
+    job.endStatus   = -1;
+    job.totalLayers = totalLayers;
+    job.totalTicks  = totalTicks;
+
+    currentIndex = (currentIndex + 1) % MAX_JOBS;
+    if (totalJobs < MAX_JOBS)
+    {
+        totalJobs++;
+    }
+    jobActive      = true;
+    stallStartedAt = 0;
+
+    logger.logf("Print job %u started", job.id);
+    save();
+}
+
+void PrintJobIndex::updateProgress(int currentLayer, int totalLayers, int currentTicks,
+                                   int totalTicks)
+{
+    print_job_t *job = activeJob();
+    if (job == nullptr)
+    {
+        return;
+    }
+    job->lastLayer   = currentLayer;
+    job->totalLayers = totalLayers;
+    job->lastTicks   = currentTicks;
+    job->totalTicks  = totalTicks;
+}
+
+void PrintJobIndex::endJob(int endStatus)
+{
+    print_job_t *job = activeJob();
+    if (job == nullptr)
+    {
+        return;
+    }
+
+    // A stall still open at the end of the job counts up to now
+    if (stallStartedAt != 0)
+    {
+        recordStallEnd(timeBase.nowMs());
+    }
+
+    job->endTime   = timeBase.now();
+    job->endStatus = endStatus;
+    jobActive      = false;
+
+    logger.logf("Print job %u ended with status %d", job->id, endStatus);
+    save();
+}
+
+void PrintJobIndex::recordMovementPulse()
+{
+    print_job_t *job = activeJob();
+    if (job != nullptr)
+    {
+        job->movementPulses++;
+    }
+}
+
+void PrintJobIndex::recordStallStart(unsigned long currentTime)
+{
+    print_job_t *job = activeJob();
+    if (job == nullptr || stallStartedAt != 0)
+    {
+        return;
+    }
+    job->stallCount++;
+    // 0 means "no stall", so nudge a stall starting at 0 ms
+    stallStartedAt = currentTime == 0 ? 1 : currentTime;
+}
+
+void PrintJobIndex::recordStallEnd(unsigned long currentTime)
+{
+    print_job_t *job = activeJob();
+    if (job != nullptr && stallStartedAt != 0)
+    {
+        job->totalStallMs += currentTime - stallStartedAt;
+    }
+    stallStartedAt = 0;
+}
+
+void PrintJobIndex::recordRunout()
+{
+    print_job_t *job = activeJob();
+    if (job != nullptr)
+    {
+        job->runoutEvents++;
+    }
+}
+
+void PrintJobIndex::recordPauseAttempt(PauseAttemptType type, unsigned long latencyMs)
+{
+    print_job_t *job = activeJob();
+    if (job == nullptr)
+    {
+        return;
+    }
+
+    // Retries re-enter pausePrint() and log another INITIAL, so that alone counts commands sent
+    if (type == PAUSE_ATTEMPT_INITIAL)
+    {
+        job->pauseAttempts++;
+    }
+    else if (type == PAUSE_ATTEMPT_SUCCESS)
+    {
+        job->pauseSuccesses++;
+        job->totalPauseLatencyMs += latencyMs;
+        if (latencyMs > job->maxPauseLatencyMs)
+        {
+            job->maxPauseLatencyMs = latencyMs;
+        }
+        // Pauses are rare and important, so get the summary to flash without waiting
+        save(true);
+    }
+}
+
+void PrintJobIndex::writeJobSummary(JsonObject out, const print_job_t &job, bool forFlash)
+{
+    // Flash copies drop pre-sync stamps, which mean nothing after a reboot
+    unsigned long startTime =
+        forFlash ? timeBase.toPersistedSeconds(job.startTime) : timeBase.toSeconds(job.startTime);
+    unsigned long endTime =
+        forFlash ? timeBase.toPersistedSeconds(job.endTime) : timeBase.toSeconds(job.endTime);
+
+    out["id"]                     = job.id;
+    out["mainboard_id"]           = (const char *) job.mainboardID;
+    out["start_time"]             = startTime;
+    out["end_time"]               = endTime;
+    out["end_status"]             = job.endStatus;
+    out["total_layers"]           = job.totalLayers;
+    out["last_layer"]             = job.lastLayer;
+    out["total_ticks"]            = job.totalTicks;
+    out["last_ticks"]             = job.lastTicks;
+    out["movement_pulses"]        = job.movementPulses;
+    out["stall_count"]            = job.stallCount;
+    out["total_stall_ms"]         = job.totalStallMs;
+    out["runout_events"]          = job.runoutEvents;
+    out["pause_attempts"]         = job.pauseAttempts;
+    out["pause_successes"]        = job.pauseSuccesses;
+    out["total_pause_latency_ms"] = job.totalPauseLatencyMs;
+    out["max_pause_latency_ms"]   = job.maxPauseLatencyMs;
+    out["avg_pause_latency_ms"] =
+        job.pauseSuccesses > 0 ? job.totalPauseLatencyMs / job.pauseSuccesses : 0;
+}
+
+size_t PrintJobIndex::getJobsJsonCapacity(int limit)
+{
+    int count = (limit > 0 && limit < totalJobs) ? limit : totalJobs;
+    return JSON_OBJECT_SIZE(2) + JSON_ARRAY_SIZE(count) + count * JOB_SUMMARY_SIZE;
+}
+
+void PrintJobIndex::writeJobsJson(JsonObject out, int limit)
+{
+    int count = (limit > 0 && limit < totalJobs) ? limit : totalJobs;
+
+    out["active"]  = jobActive;
+    JsonArray list = out.createNestedArray("jobs");
+
+    // Newest job first
+    for (int i = 1; i <= count; i++)
+    {
+        const print_job_t &job = jobs[(currentIndex + MAX_JOBS - i) % MAX_JOBS];
+        writeJobSummary(list.createNestedObject(), job);
+    }
+}
+
+String PrintJobIndex::getJobsAsJson(int limit)
+{
+    ScratchJsonDocument doc(getJobsJsonCapacity(limit));
+    writeJobsJson(doc.to<JsonObject>(), limit);
+
+    String result;
+    serializeJson(doc, result);
+    return result;
+}
+
+size_t PrintJobIndex::getJobJsonCapacity(size_t maxPoints)
+{
+    return JSON_OBJECT_SIZE(2) + JOB_SUMMARY_SIZE + JSON_OBJECT_SIZE(3) +
+           3 * (JSON_ARRAY_SIZE(maxPoints) + maxPoints * JSON_OBJECT_SIZE(2));
+}
+
+bool PrintJobIndex::writeJobJson(JsonObject out, uint32_t id, size_t maxPoints)
+{
+    print_job_t *job = findJob(id);
+    if (job == nullptr)
+    {
+        return false;
+    }
+
+    uint64_t endTime = job->endTime != 0 ? job->endTime : timeBase.now();
+
+    writeJobSummary(out.createNestedObject("job"), *job);
+
+    // The job's window of each series, downsampled to at most maxPoints
+    JsonObject series = out.createNestedObject("series");
+    if (movementData)
+    {
+        movementData->getRange(series.createNestedArray("movement"), job->startTime, endTime,
+                               maxPoints);
+    }
+    if (runoutData)
+    {
+        runoutData->getRange(series.createNestedArray("runout"), job->startTime, endTime,
+                             maxPoints);
+    }
+    if (connectionData)
+    {
+        connectionData->getRange(series.createNestedArray("connection"), job->startTime,
+                                 endTime, maxPoints);
+    }
+    return true;
+}
+
+String PrintJobIndex::getJobAsJson(uint32_t id, size_t maxPoints)
+{
+    ScratchJsonDocument doc(getJobJsonCapacity(maxPoints));
+    if (!writeJobJson(doc.to<JsonObject>(), id, maxPoints))
+    {
+        return "";
+    }
+
+    String result;
+    serializeJson(doc, result);
+    return result;
+}
+
+void PrintJobIndex::clearJobs()
+{
+    // Keep a running job so its summary isn't lost mid-print
+    print_job_t *job = activeJob();
+    print_job_t  running;
+    if (job != nullptr)
+    {
+        running = *job;
+    }
+
+    memset(jobs, 0, sizeof(jobs));
+    currentIndex = 0;
+    totalJobs    = 0;
+    if (job != nullptr)
+    {
+        jobs[0]      = running;
+        currentIndex = 1;
+        totalJobs    = 1;
+    }
+    save();
+}
+
+void PrintJobIndex::save(bool urgent)
+{
+    flushScheduler.markDirty(flushStore, urgent);
+}
+
+void PrintJobIndex::writeToFile()
+{
+    // Built before anything on flash is touched, so running out of memory keeps the old file
+    ScratchJsonDocument doc(JSON_OBJECT_SIZE(3) + JSON_ARRAY_SIZE(totalJobs) +
+                            totalJobs * JOB_SUMMARY_SIZE);
+    if (doc.capacity() == 0)
+    {
+        logger.log("No memory to save the print job index, keeping the previous file");
+        return;
+    }
+    doc["next_id"] = nextJobId;
+    doc["active"]  = jobActive;
+
+    // Oldest first, so load() can replay them into the ring in order
+    JsonArray list  = doc.createNestedArray("jobs");
+    int       start = totalJobs < MAX_JOBS ? 0 : currentIndex;
+    for (int i = 0; i < totalJobs; i++)
+    {
+        writeJobSummary(list.createNestedObject(), jobs[(start + i) % MAX_JOBS], true);
+    }
+    if (doc.overflowed())
+    {
+        logger.log("Print job index didn't fit its document, keeping the previous file");
+        return;
+    }
+
+    // Written beside the real file and renamed over it, which replaces it atomically
+    File file = LittleFS.open(JOBS_TEMP_PATH, "w");
+    if (!file)
+    {
+        return;
+    }
+    size_t written = serializeJson(doc, file);
+    file.close();
+    if (written == 0 || !LittleFS.rename(JOBS_TEMP_PATH, JOBS_FILE_PATH))
+    {
+        logger.log("Failed to save the print job index");
+        LittleFS.remove(JOBS_TEMP_PATH);
+        return;
+    }
+    storageManager.setFileSize(jobsFile, written);
+}
+
+void PrintJobIndex::load()
+{
+    File file = LittleFS.open(JOBS_FILE_PATH, "r");
+    if (!file)
+    {
+        return;
+    }
+
+    ScratchJsonDocument      doc(JSON_OBJECT_SIZE(3) + JSON_ARRAY_SIZE(MAX_JOBS) +
+                                 MAX_JOBS * (JOB_SUMMARY_SIZE + PRINT_JOB_MAINBOARD_ID_LEN));
+    DeserializationError error = deserializeJson(doc, file);
+    file.close();
+
+    if (error)
+    {
+        logger.logf("Failed to load print job index: %s", error.c_str());
+        return;
+    }
+
+    nextJobId    = doc["next_id"] | 1;
+    currentIndex = 0;
+    totalJobs    = 0;
+
+    for (JsonObject entry : doc["jobs"].as<JsonArray>())
+    {
+        if (totalJobs >= MAX_JOBS)
+        {
+            break;
+        }
+        print_job_t &job = jobs[currentIndex];
+        memset(&job, 0, sizeof(job));
+        job.id = entry["id"];
+        strlcpy(job.mainboardID, entry["mainboard_id"] | "", sizeof(job.mainboardID));
+        job.startTime           = timeBase.fromPersistedSeconds(entry["start_time"]);
+        job.endTime             = timeBase.fromPersistedSeconds(entry["end_time"]);
+        job.endStatus           = entry["end_status"] | -1;
+        job.totalLayers         = entry["total_layers"];
+        job.lastLayer           = entry["last_layer"];
+        job.totalTicks          = entry["total_ticks"];
+        job.lastTicks           = entry["last_ticks"];
+        job.movementPulses      = entry["movement_pulses"];
+        job.stallCount          = entry["stall_count"];
+        job.totalStallMs        = entry["total_stall_ms"];
+        job.runoutEvents        = entry["runout_events"];
+        job.pauseAttempts       = entry["pause_attempts"];
+        job.pauseSuccesses      = entry["pause_successes"];
+        job.totalPauseLatencyMs = entry["total_pause_latency_ms"];
+        job.maxPauseLatencyMs   = entry["max_pause_latency_ms"];
+
+        currentIndex = (currentIndex + 1) % MAX_JOBS;
+        totalJobs++;
+    }
+
+    // A job that was running at reboot resumes only if the printer still reports printing;
+    // handleStatus starts a fresh job otherwise, closing this one out
+    jobActive = (doc["active"] | false) && totalJobs > 0;
+}
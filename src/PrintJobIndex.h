@@ -0,0 +1,101 @@
+#ifndef PRINT_JOB_INDEX_H
+#define PRINT_JOB_INDEX_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+#include "FlushScheduler.h"
+#include "PauseAttemptData.h"
+#include "StorageManager.h"
+
+#define PRINT_JOB_MAINBOARD_ID_LEN 33
+
+// One print job and its running summary. Every counter is updated as events happen, so
+// reading a summary never rescans the time series.
+typedef struct
+{
+    uint32_t      id;
+    char          mainboardID[PRINT_JOB_MAINBOARD_ID_LEN];
+    uint64_t      startTime;  // TimeBase stamp when the job started
+    uint64_t      endTime;    // 0 while the job is still running
+    int           endStatus;  // sdcp_print_status_t that ended the job
+    int           totalLayers;
+    int           lastLayer;
+    int           totalTicks;
+    int           lastTicks;
+
+    uint32_t movementPulses;
+    uint16_t stallCount;
+    uint32_t totalStallMs;
+    uint16_t runoutEvents;
+    uint16_t pauseAttempts;
+    uint16_t pauseSuccesses;
+    uint32_t totalPauseLatencyMs;
+    uint32_t maxPauseLatencyMs;
+} print_job_t;
+
+class PrintJobIndex
+{
+   private:
+    static const int   MAX_JOBS = 20;
+    static const char *JOBS_FILE_PATH;
+    static const char *JOBS_TEMP_PATH;  // Written first, then renamed over JOBS_FILE_PATH
+
+    print_job_t    jobs[MAX_JOBS];  // Ring, oldest job overwritten first
+    int            currentIndex;
+    int            totalJobs;
+    uint32_t       nextJobId;
+    bool           jobActive;
+    unsigned long  stallStartedAt;  // timeBase.nowMs() when the current stall began, 0 if none
+    storage_file_t jobsFile;
+    flush_store_t  flushStore;
+
+    PrintJobIndex();
+
+    // Delete copy constructor and assignment operator
+    PrintJobIndex(const PrintJobIndex &)            = delete;
+    PrintJobIndex &operator=(const PrintJobIndex &) = delete;
+
+    print_job_t *activeJob();
+    print_job_t *findJob(uint32_t id);
+    void         writeJobSummary(JsonObject out, const print_job_t &job, bool forFlash = false);
+    // Queue the index for the flush scheduler; writeToFile() is its callback
+    void         save(bool urgent = false);
+    void         writeToFile();
+
+   public:
+    // Singleton access method
+    static PrintJobIndex &getInstance();
+
+    void load();
+
+    // Job lifecycle, driven by print status transitions
+    void startJob(const String &mainboardID, int totalLayers, int totalTicks);
+    void updateProgress(int currentLayer, int totalLayers, int currentTicks, int totalTicks);
+    void endJob(int endStatus);
+    bool isJobActive();
+
+    // Incremental summary updates
+    void recordMovementPulse();
+    void recordStallStart(unsigned long currentTime);
+    void recordStallEnd(unsigned long currentTime);
+    void recordRunout();
+    void recordPauseAttempt(PauseAttemptType type, unsigned long latencyMs);
+
+    String getJobsAsJson(int limit = MAX_JOBS);
+    // Single job with its slice of each time series, empty string if the id is unknown
+    String getJobAsJson(uint32_t id, size_t maxPoints = 200);
+
+    // The same bodies filled into a caller's document of at least the matching capacity.
+    // writeJobJson returns false, leaving out empty, if the id is unknown.
+    void   writeJobsJson(JsonObject out, int limit = MAX_JOBS);
+    size_t getJobsJsonCapacity(int limit = MAX_JOBS);
+    bool   writeJobJson(JsonObject out, uint32_t id, size_t maxPoints = 200);
+    size_t getJobJsonCapacity(size_t maxPoints = 200);
+    void   clearJobs();
+};
+
+// Convenience macro for easier access
+#define printJobIndex PrintJobIndex::getInstance()
+
+#endif  // PRINT_JOB_INDEX_H
@@ -0,0 +1,319 @@
+#include "Profiler.h"
+
+#ifdef ENABLE_PROFILER
+
+#include <memory>
+
+#include "Logger.h"
+#include "MemoryPolicy.h"
+
+#if defined(__XTENSA__)
+#include <esp_debug_helpers.h>
+#include <freertos/xtensa_context.h>
+#include <soc/soc_memory_layout.h>
+
+// Maintained by the port's interrupt entry and exit; 1 inside the timer interrupt itself
+extern "C" unsigned port_interruptNesting[portNUM_PROCESSORS];
+#endif
+
+#define TIMER_DIVIDER 80  // 1 MHz timer clock from the 80 MHz APB clock
+
+Profiler &Profiler::getInstance()
+{
+    static Profiler instance;
+    return instance;
+}
+
+Profiler::Profiler()
+{
+    samples       = nullptr;
+    capacity      = 0;
+    nextSample    = 0;
+    dropped       = 0;
+    nestedSkipped = 0;
+    hz            = PROFILER_DEFAULT_HZ;
+    running       = false;
+    exporting     = false;
+    for (int i = 0; i < portNUM_PROCESSORS; i++)
+    {
+        timers[i] = nullptr;
+    }
+}
+
+void IRAM_ATTR Profiler::onTimer()
+{
+    profiler.sample();
+}
+
+void Profiler::timerSetupTask(void *param)
+{
+    // The interrupt is allocated on the core that attaches it, so each core sets up its own
+    int         core  = (int) (intptr_t) param;
+    hw_timer_t *timer = timerBegin(PROFILER_FIRST_TIMER + core, TIMER_DIVIDER, true);
+    if (timer != nullptr)
+    {
+        timerAttachInterrupt(timer, onTimer, true);
+        timerAlarmWrite(timer, 1000000 / profiler.hz, true);
+        timerAlarmEnable(timer);
+        profiler.timers[core] = timer;
+    }
+    vTaskDelete(nullptr);
+}
+
+bool Profiler::start(uint32_t requestedHz)
+{
+#if !defined(__XTENSA__)
+    return false;  // Reading the interrupted PC relies on the Xtensa interrupt frame
+#endif
+    if (exporting)
+    {
+        return false;
+    }
+    if (samples == nullptr)
+    {
+        size_t size = memoryPolicy.scaleCapacity(PROFILER_INTERNAL_SAMPLES, PROFILER_PSRAM_SAMPLES);
+        samples =
+            (profile_sample_t *) memoryPolicy.allocate(size * sizeof(profile_sample_t), ALLOC_PROFILE);
+        if (samples == nullptr)
+        {
+            logger.log("Not enough memory for the profiler");
+            return false;
+        }
+        capacity = size;
+    }
+
+    stop();
+    hz            = constrain(requestedHz, 1, PROFILER_MAX_HZ);
+    nextSample    = 0;
+    dropped       = 0;
+    nestedSkipped = 0;
+    memset(samples, 0, capacity * sizeof(profile_sample_t));
+    running = true;
+
+    for (int core = 0; core < portNUM_PROCESSORS; core++)
+    {
+        if (timers[core] == nullptr)
+        {
+            xTaskCreatePinnedToCore(timerSetupTask, "prof_setup", 2048, (void *) (intptr_t) core,
+                                    configMAX_PRIORITIES - 1, nullptr, core);
+        }
+        else
+        {
+            timerAlarmWrite(timers[core], 1000000 / hz, true);
+            timerAlarmEnable(timers[core]);
+        }
+    }
+    logger.logf("Profiler started at %lu Hz, room for %u samples", (unsigned long) hz,
+                (unsigned) capacity);
+    return true;
+}
+
+void Profiler::stop()
+{
+    for (int core = 0; core < portNUM_PROCESSORS; core++)
+    {
+        if (timers[core] != nullptr)
+        {
+            timerAlarmDisable(timers[core]);
+        }
+    }
+    running = false;
+}
+
+void IRAM_ATTR Profiler::sample()
+{
+#if defined(__XTENSA__)
+    if (!running)
+    {
+        return;
+    }
+    int core = xPortGetCoreID();
+    if (port_interruptNesting[core] > 1)
+    {
+        // The task's saved frame only describes the outermost interrupt
+        nestedSkipped++;
+        return;
+    }
+
+    TaskHandle_t task = xTaskGetCurrentTaskHandleForCPU(core);
+    if (task == nullptr)
+    {
+        return;
+    }
+
+    uint32_t slot = __atomic_fetch_add(&nextSample, 1, __ATOMIC_RELAXED);
+    if (slot >= capacity)
+    {
+        __atomic_fetch_add(&dropped, 1, __ATOMIC_RELAXED);
+        return;
+    }
+    profile_sample_t &out = samples[slot];
+
+    // Interrupt entry spills the task's register windows and stores its stack pointer,
+    // which points at the interrupt frame, in pxTopOfStack, the first field of the TCB
+    XtExcFrame           *frame = *(XtExcFrame **) task;
+    esp_backtrace_frame_t bt    = {(uint32_t) frame->pc, (uint32_t) frame->a1,
+                                   (uint32_t) frame->a0, frame};
+    out.pc[0]                   = bt.pc;
+    int depth                   = 1;
+    while (depth < PROFILER_DEPTH && bt.next_pc != 0 && esp_stack_ptr_is_sane(bt.sp))
+    {
+        if (!esp_backtrace_get_next_frame(&bt))
+        {
+            break;
+        }
+        uint32_t pc = esp_cpu_process_stack_pc(bt.pc);
+        if (!esp_ptr_executable((void *) pc))
+        {
+            break;
+        }
+        out.pc[depth++] = pc;
+    }
+
+    strlcpy(out.task, pcTaskGetName(task), sizeof(out.task));
+    out.core = core;
+    __atomic_store_n(&out.depth, (uint8_t) depth, __ATOMIC_RELEASE);
+#endif
+}
+
+void Profiler::handleStart(AsyncWebServerRequest *request)
+{
+    uint32_t requestedHz = PROFILER_DEFAULT_HZ;
+    if (request->hasParam("hz"))
+    {
+        requestedHz = request->getParam("hz")->value().toInt();
+    }
+    if (!start(requestedHz))
+    {
+        request->send(503, "text/plain", "Profiler unavailable");
+        return;
+    }
+    char body[64];
+    snprintf(body, sizeof(body), "Profiling at %lu Hz, room for %u samples\n",
+             (unsigned long) hz, (unsigned) capacity);
+    request->send(200, "text/plain", body);
+}
+
+void Profiler::handleStop(AsyncWebServerRequest *request)
+{
+    stop();
+    request->send(200, "text/plain", "Profiler stopped\n");
+}
+
+// Streams one line per sample: "<core> <task> <pc>,<pc>..." with the interrupted PC first
+class ProfileExport
+{
+   private:
+    const profile_sample_t *samples;
+    size_t                  count;
+    size_t                  next;
+    char                    header[160];
+    bool                    headerSent;
+    char                    line[96];
+    size_t                  lineLength;
+    size_t                  linePos;
+
+    bool nextLine()
+    {
+        if (!headerSent)
+        {
+            headerSent = true;
+            lineLength = strlen(header);
+            memcpy(line, header, min(lineLength + 1, sizeof(line)));
+            lineLength = min(lineLength, sizeof(line) - 1);
+            linePos    = 0;
+            return true;
+        }
+        // Skip slots that were claimed but never finished
+        while (next < count && __atomic_load_n(&samples[next].depth, __ATOMIC_ACQUIRE) == 0)
+        {
+            next++;
+        }
+        if (next >= count)
+        {
+            return false;
+        }
+        const profile_sample_t &sample = samples[next++];
+        int length = snprintf(line, sizeof(line), "%d %s", sample.core, sample.task);
+        for (int i = 0; i < sample.depth && length < (int) sizeof(line); i++)
+        {
+            length += snprintf(line + length, sizeof(line) - length, "%s0x%08lx", i == 0 ? " " : ",",
+                               (unsigned long) sample.pc[i]);
+        }
+        if (length < (int) sizeof(line) - 1)
+        {
+            line[length++] = '\n';
+        }
+        lineLength = min((size_t) length, sizeof(line) - 1);
+        linePos    = 0;
+        return true;
+    }
+
+   public:
+    ProfileExport(const profile_sample_t *samples, size_t count, uint32_t hz, uint32_t dropped,
+                  uint32_t nested)
+        : samples(samples), count(count), next(0), headerSent(false), lineLength(0), linePos(0)
+    {
+        snprintf(header, sizeof(header),
+                 "# cc_sfs profile v1\n# hz %lu\n# samples %u dropped %lu nested %lu\n",
+                 (unsigned long) hz, (unsigned) count, (unsigned long) dropped,
+                 (unsigned long) nested);
+    }
+
+    ~ProfileExport() { profiler.finishExport(); }
+
+    size_t fill(uint8_t *buffer, size_t maxLen)
+    {
+        size_t written = 0;
+        while (written < maxLen)
+        {
+            if (linePos == lineLength && !nextLine())
+            {
+                break;
+            }
+            size_t n = min(maxLen - written, lineLength - linePos);
+            memcpy(buffer + written, line + linePos, n);
+            written += n;
+            linePos += n;
+        }
+        return written;  // 0 ends the chunked response
+    }
+};
+
+void Profiler::handleExport(AsyncWebServerRequest *request)
+{
+    if (samples == nullptr)
+    {
+        request->send(404, "text/plain", "No profile recorded, POST /api/profile/start first");
+        return;
+    }
+    if (exporting)
+    {
+        AsyncWebServerResponse *response =
+            request->beginResponse(503, "text/plain", "Previous profile still sending");
+        response->addHeader("Retry-After", "1");
+        request->send(response);
+        return;
+    }
+
+    // Streamed straight from the ring, which stays put until the next start()
+    stop();
+    exporting    = true;
+    size_t count = min((size_t) nextSample, capacity);
+
+    std::shared_ptr<ProfileExport> state =
+        std::make_shared<ProfileExport>(samples, count, hz, dropped, nestedSkipped);
+    AsyncWebServerResponse *response =
+        request->beginChunkedResponse("text/plain",
+                                      [state](uint8_t *buffer, size_t maxLen, size_t index)
+                                      { return state->fill(buffer, maxLen); });
+    response->addHeader("Content-Disposition", "attachment; filename=\"profile.txt\"");
+    request->send(response);
+}
+
+void Profiler::finishExport()
+{
+    exporting = false;
+}
+
+#endif  // ENABLE_PROFILER
@@ -0,0 +1,87 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+// Sampling CPU profiler, compiled in only with -D ENABLE_PROFILER. A hardware timer on
+// each core interrupts at a fixed rate and records what that core was running: the task,
+// the interrupted PC and a few return addresses. Samples go out on GET /api/profile as
+// text, which profile_symbolize.py turns into flamegraph folded stacks using the ELF.
+//
+//   POST /api/profile/start?hz=997   clear the ring and start sampling
+//   POST /api/profile/stop
+//   GET  /api/profile                stop, then stream the samples
+//
+// The timer interrupt isn't IRAM-safe, so it is held off while the flash cache is
+// disabled: time inside SPI flash erase/write primitives shows up as the code running
+// right after them rather than as samples of its own.
+
+#ifdef ENABLE_PROFILER
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+
+#define PROFILER_DEFAULT_HZ 997  // Prime, so it doesn't beat against the 1 kHz tick
+#define PROFILER_MAX_HZ 5000
+#define PROFILER_DEPTH 4  // Interrupted PC plus up to three callers
+#define PROFILER_TASK_NAME_LEN 10
+#define PROFILER_INTERNAL_SAMPLES 1024  // Ring size without PSRAM
+#define PROFILER_PSRAM_SAMPLES 32768    // About 16 s of both cores at the default rate
+#define PROFILER_FIRST_TIMER 0          // Hardware timers PROFILER_FIRST_TIMER + core are used
+
+typedef struct
+{
+    uint32_t pc[PROFILER_DEPTH];  // Interrupted PC first, then return addresses
+    char     task[PROFILER_TASK_NAME_LEN];
+    uint8_t  core;
+    uint8_t  depth;  // Written last; 0 while the sample is being written
+} profile_sample_t;
+
+// Samples fill the ring once and then count as dropped, so a capture covers the window
+// right after start() rather than whatever came last. Interrupts on both cores claim
+// slots with an atomic increment.
+class Profiler
+{
+   private:
+    profile_sample_t *samples;
+    size_t            capacity;
+    uint32_t          nextSample;
+    uint32_t          dropped;
+    uint32_t          nestedSkipped;  // Timer fired inside another interrupt
+    uint32_t          hz;
+    volatile bool     running;
+    bool              exporting;
+    hw_timer_t       *timers[portNUM_PROCESSORS];
+
+    Profiler();
+
+    // Delete copy constructor and assignment operator
+    Profiler(const Profiler &)            = delete;
+    Profiler &operator=(const Profiler &) = delete;
+
+    static void timerSetupTask(void *param);
+    static void onTimer();
+
+   public:
+    // Singleton access method
+    static Profiler &getInstance();
+
+    bool start(uint32_t hz);
+    void stop();
+
+    // Runs in the timer interrupt
+    void sample();
+
+    // POST /api/profile/start, POST /api/profile/stop and GET /api/profile
+    void handleStart(AsyncWebServerRequest *request);
+    void handleStop(AsyncWebServerRequest *request);
+    void handleExport(AsyncWebServerRequest *request);
+
+    // Called when the response streaming the samples is done
+    void finishExport();
+};
+
+// Convenience macro for easier access
+#define profiler Profiler::getInstance()
+
+#endif  // ENABLE_PROFILER
+
+#endif  // PROFILER_H
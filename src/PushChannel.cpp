@@ -0,0 +1,244 @@
+#include "PushChannel.h"
+
+#include <ArduinoJson.h>
+
+#include "JobScheduler.h"
+#include "MemoryPolicy.h"
+
+static const char *EVENT_NAMES[PUSH_EVENT_TYPE_COUNT] = {"status", "log", "sample", "resync"};
+
+PushChannel &PushChannel::getInstance()
+{
+    static PushChannel instance;
+    return instance;
+}
+
+PushChannel::PushChannel() : events("/events")
+{
+    replayHead        = 0;
+    replayCount       = 0;
+    nextId            = 1;
+    droppedEvents     = 0;
+    haveLastStatus    = false;
+    lastStatusVersion = 0;
+    lock              = xSemaphoreCreateMutex();
+    replay = (push_event_t *) memoryPolicy.allocate(REPLAY_EVENTS * sizeof(push_event_t), ALLOC_PUSH);
+}
+
+void PushChannel::begin(AsyncWebServer &server)
+{
+    // Runs on the async_tcp task with the event source's client lock held
+    events.onConnect([this](AsyncEventSourceClient *client) { replayTo(client); });
+    server.addHandler(&events);
+
+    jobScheduler.schedulePeriodic("push_status", STATUS_INTERVAL_MS, JOB_PRIORITY_NORMAL,
+                                  [this]() { publishStatus(); });
+}
+
+void PushChannel::publish(push_event_type_t type, const char *data)
+{
+    xSemaphoreTake(lock, portMAX_DELAY);
+    uint32_t id = nextId++;
+    if (replay != nullptr)
+    {
+        push_event_t &event = replay[replayHead];
+        event.id            = id;
+        event.type          = type;
+        strlcpy(event.data, data, sizeof(event.data));
+        replayHead = (replayHead + 1) % REPLAY_EVENTS;
+        if (replayCount < REPLAY_EVENTS)
+        {
+            replayCount++;
+        }
+    }
+    xSemaphoreGive(lock);
+
+    // Sent outside our lock: onConnect holds the event source's lock and then takes ours
+    if (events.count() == 0)
+    {
+        return;
+    }
+    if (events.send(data, EVENT_NAMES[type], id) != AsyncEventSource::ENQUEUED)
+    {
+        // A client's queue was full; it will see the gap in ids and resync itself
+        droppedEvents++;
+    }
+}
+
+void PushChannel::replayTo(AsyncEventSourceClient *client)
+{
+    char     snapshot[PUSH_EVENT_MAX_LEN];
+    uint32_t lastId = client->lastId();
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    uint32_t latestId  = nextId - 1;
+    uint32_t oldestId  = latestId - replayCount + 1;
+    uint32_t behind    = latestId - lastId;
+    bool     canReplay = lastId != 0 && lastId <= latestId && lastId + 1 >= oldestId &&
+                     behind <= SSE_MAX_QUEUED_MESSAGES / 2;
+
+    if (canReplay)
+    {
+        // Resume: the events after the cursor, oldest first
+        for (uint32_t i = 0; i < behind; i++)
+        {
+            const push_event_t &event =
+                replay[(replayHead + REPLAY_EVENTS - behind + i) % REPLAY_EVENTS];
+            client->send(event.data, EVENT_NAMES[event.type], event.id);
+        }
+    }
+    else if (lastId != 0)
+    {
+        // Too far behind to replay without overflowing the client's queue
+        client->send("{}", EVENT_NAMES[PUSH_EVENT_RESYNC], latestId);
+    }
+    else if (haveLastStatus && buildStatus(snapshot, sizeof(snapshot), lastStatus, true))
+    {
+        // Fresh connection: the full status, stamped so later ids follow on
+        client->send(snapshot, EVENT_NAMES[PUSH_EVENT_STATUS], latestId);
+    }
+    xSemaphoreGive(lock);
+}
+
+bool PushChannel::buildStatus(char *out, size_t length, const printer_info_t &info, bool full)
+{
+    StaticJsonDocument<JSON_OBJECT_SIZE(4) + JSON_OBJECT_SIZE(11)> doc;
+    const printer_info_t &last = lastStatus;
+
+    if (full || info.filamentStopped != last.filamentStopped)
+    {
+        doc["stopped"] = info.filamentStopped;
+    }
+    if (full || info.filamentRunout != last.filamentRunout)
+    {
+        doc["filamentRunout"] = info.filamentRunout;
+    }
+
+    JsonObject elegoo = doc.createNestedObject("elegoo");
+    if (full || info.mainboardID != last.mainboardID)
+    {
+        elegoo["mainboardID"] = info.mainboardID.c_str();
+    }
+    if (full || info.printStatus != last.printStatus)
+    {
+        elegoo["printStatus"] = (int) info.printStatus;
+    }
+    if (full || info.isPrinting != last.isPrinting)
+    {
+        elegoo["isPrinting"] = info.isPrinting;
+    }
+    if (full || info.currentLayer != last.currentLayer)
+    {
+        elegoo["currentLayer"] = info.currentLayer;
+    }
+    if (full || info.totalLayer != last.totalLayer)
+    {
+        elegoo["totalLayer"] = info.totalLayer;
+    }
+    if (full || info.progress != last.progress)
+    {
+        elegoo["progress"] = info.progress;
+    }
+    if (full || info.currentTicks != last.currentTicks)
+    {
+        elegoo["currentTicks"] = info.currentTicks;
+    }
+    if (full || info.totalTicks != last.totalTicks)
+    {
+        elegoo["totalTicks"] = info.totalTicks;
+    }
+    if (full || info.PrintSpeedPct != last.PrintSpeedPct)
+    {
+        elegoo["PrintSpeedPct"] = info.PrintSpeedPct;
+    }
+    if (full || info.isWebsocketConnected != last.isWebsocketConnected)
+    {
+        elegoo["isWebsocketConnected"] = info.isWebsocketConnected;
+    }
+    if (full || info.currentZ != last.currentZ)
+    {
+        elegoo["currentZ"] = info.currentZ;
+    }
+
+    if (elegoo.size() == 0)
+    {
+        doc.remove("elegoo");
+    }
+    if (doc.size() == 0)
+    {
+        return false;
+    }
+    if (full)
+    {
+        doc["full"] = true;
+    }
+    return serializeJson(doc, out, length) < length - 1;
+}
+
+void PushChannel::publishStatus()
+{
+    uint32_t statusVersion = elegooCC.getStatusVersion();
+    if (haveLastStatus && statusVersion == lastStatusVersion)
+    {
+        return;
+    }
+    lastStatusVersion = statusVersion;
+
+    // Changes within one interval are coalesced into a single delta
+    printer_info_t info = elegooCC.getCurrentInformation();
+    char           delta[PUSH_EVENT_MAX_LEN];
+    bool           changed = buildStatus(delta, sizeof(delta), info, !haveLastStatus);
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    lastStatus     = info;
+    haveLastStatus = true;
+    xSemaphoreGive(lock);
+
+    if (changed)
+    {
+        publish(PUSH_EVENT_STATUS, delta);
+    }
+}
+
+void PushChannel::publishLog(const char *uuid, unsigned long timestamp, const char *message)
+{
+    StaticJsonDocument<JSON_OBJECT_SIZE(4)> doc;
+    doc["uuid"]      = uuid;
+    doc["timestamp"] = timestamp;
+    doc["message"]   = message;
+
+    char data[PUSH_EVENT_MAX_LEN];
+    if (measureJson(doc) >= sizeof(data))
+    {
+        // Escaping pushed it past one event; the client fetches the entry over REST
+        doc.remove("message");
+        doc["truncated"] = true;
+    }
+    serializeJson(doc, data, sizeof(data));
+    publish(PUSH_EVENT_LOG, data);
+}
+
+void PushChannel::publishSample(unsigned long timestamp, float movement, float runout,
+                                float connection)
+{
+    // Samples are the cheapest to lose, so they are skipped while clients are backed up
+    if (events.count() > 0 && events.avgPacketsWaiting() > SSE_MAX_QUEUED_MESSAGES / 4)
+    {
+        return;
+    }
+
+    char data[96];
+    snprintf(data, sizeof(data), "{\"t\":%lu,\"movement\":%g,\"runout\":%g,\"connection\":%g}",
+             timestamp, movement, runout, connection);
+    publish(PUSH_EVENT_SAMPLE, data);
+}
+
+size_t PushChannel::getClientCount()
+{
+    return events.count();
+}
+
+uint32_t PushChannel::getDroppedEvents()
+{
+    return droppedEvents;
+}
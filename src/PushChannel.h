@@ -0,0 +1,78 @@
+#ifndef PUSH_CHANNEL_H
+#define PUSH_CHANNEL_H
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+
+#include "ElegooCC.h"
+
+#define PUSH_EVENT_MAX_LEN 256
+
+typedef enum
+{
+    PUSH_EVENT_STATUS = 0,  // Changed /sensor_status fields
+    PUSH_EVENT_LOG    = 1,  // One new log entry
+    PUSH_EVENT_SAMPLE = 2,  // One new point on each time series
+    PUSH_EVENT_RESYNC = 3,  // Client fell too far behind and should refetch over REST
+    PUSH_EVENT_TYPE_COUNT
+} push_event_type_t;
+
+typedef struct
+{
+    uint32_t id;
+    uint8_t  type;
+    char     data[PUSH_EVENT_MAX_LEN];
+} push_event_t;
+
+// Server-sent events on /events. Every event carries a sequential id; a browser that
+// reconnects sends Last-Event-ID and gets the events it missed from a small replay ring,
+// or a resync if it is too far behind. A client that sees a gap in the ids refetches
+// over REST, so a slow client that drops messages recovers without the server tracking it.
+class PushChannel
+{
+   private:
+    static const int           REPLAY_EVENTS      = 32;
+    static const unsigned long STATUS_INTERVAL_MS = 250;
+
+    AsyncEventSource  events;
+    push_event_t     *replay;  // Ring of the most recent events
+    int               replayHead;
+    int               replayCount;
+    uint32_t          nextId;
+    uint32_t          droppedEvents;
+    SemaphoreHandle_t lock;
+
+    // Last status pushed, so only changed fields go out
+    printer_info_t lastStatus;
+    bool           haveLastStatus;
+    uint32_t       lastStatusVersion;
+
+    PushChannel();
+
+    // Delete copy constructor and assignment operator
+    PushChannel(const PushChannel &)            = delete;
+    PushChannel &operator=(const PushChannel &) = delete;
+
+    void publish(push_event_type_t type, const char *data);
+    void replayTo(AsyncEventSourceClient *client);
+    bool buildStatus(char *out, size_t length, const printer_info_t &info, bool full);
+    // Diff printer status and push what changed; runs every STATUS_INTERVAL_MS as a job
+    void publishStatus();
+
+   public:
+    // Singleton access method
+    static PushChannel &getInstance();
+
+    void begin(AsyncWebServer &server);
+
+    void publishLog(const char *uuid, unsigned long timestamp, const char *message);
+    void publishSample(unsigned long timestamp, float movement, float runout, float connection);
+
+    size_t   getClientCount();
+    uint32_t getDroppedEvents();
+};
+
+// Convenience macro for easier access
+#define pushChannel PushChannel::getInstance()
+
+#endif  // PUSH_CHANNEL_H
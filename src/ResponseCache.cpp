@@ -0,0 +1,226 @@
+#include "ResponseCache.h"
+
+#include <WebResponseImpl.h>
+#include <esp_system.h>
+
+#include "EndpointStats.h"
+#include "MemoryPolicy.h"
+
+// Sends a cached body in place, holding a reference until the response is freed
+class CachedBodyResponse : public AsyncAbstractResponse
+{
+   private:
+    cached_body_t *body;
+    size_t         readLength;
+
+   public:
+    CachedBodyResponse(cached_body_t *body, const char *contentType)
+        : body(body), readLength(0)
+    {
+        ResponseCache::retain(body);
+        _code          = 200;
+        _contentType   = contentType;
+        _contentLength = body->length;
+    }
+
+    ~CachedBodyResponse()
+    {
+        ResponseCache::release(body);
+    }
+
+    bool _sourceValid() const override
+    {
+        return true;
+    }
+
+    size_t _fillBuffer(uint8_t *data, size_t len) override
+    {
+        size_t left = body->length - readLength;
+        size_t n    = left < len ? left : len;
+        memcpy(data, body->data + readLength, n);
+        readLength += n;
+        return n;
+    }
+};
+
+// Print into a body buffer of known size
+class CachedBodyWriter : public Print
+{
+   private:
+    char  *buffer;
+    size_t capacity;
+    size_t length;
+
+   public:
+    CachedBodyWriter(char *buffer, size_t capacity)
+        : buffer(buffer), capacity(capacity), length(0)
+    {
+    }
+
+    size_t write(uint8_t value) override
+    {
+        return write(&value, 1);
+    }
+
+    size_t write(const uint8_t *data, size_t size) override
+    {
+        size_t n = min(size, capacity - length);
+        memcpy(buffer + length, data, n);
+        length += n;
+        return n;
+    }
+};
+
+ResponseCache &ResponseCache::getInstance()
+{
+    static ResponseCache instance;
+    return instance;
+}
+
+ResponseCache::ResponseCache()
+{
+    memset(entries, 0, sizeof(entries));
+    for (int slot = 0; slot < CACHED_RESPONSE_COUNT; slot++)
+    {
+        for (int format = 0; format < RESPONSE_FORMAT_COUNT; format++)
+        {
+            entries[slot][format].format = (response_format_t) format;
+        }
+    }
+    bootId      = esp_random();
+    hits        = 0;
+    misses      = 0;
+    notModified = 0;
+}
+
+uint32_t ResponseCache::combine(uint32_t version, uint32_t other)
+{
+    // FNV-1a step over the 32-bit value
+    uint32_t hash = (version ^ 2166136261UL) * 16777619UL;
+    return (hash ^ other) * 16777619UL;
+}
+
+void ResponseCache::retain(cached_body_t *body)
+{
+    body->refs++;
+}
+
+void ResponseCache::release(cached_body_t *body)
+{
+    if (body != nullptr && --body->refs == 0)
+    {
+        memoryPolicy.release(body, ALLOC_CACHE);
+    }
+}
+
+bool ResponseCache::rebuild(cached_response_entry_t &entry, uint32_t version, JsonDocument &doc)
+{
+    // Serialized once, straight into the buffer it will be served from
+    size_t         length = measureResponse(doc, entry.format);
+    cached_body_t *body =
+        (cached_body_t *) memoryPolicy.allocate(sizeof(cached_body_t) + length + 1, ALLOC_CACHE);
+    if (body == nullptr)
+    {
+        return false;
+    }
+    body->refs   = 1;
+    if (entry.format == RESPONSE_MSGPACK)
+    {
+        // Binary, so written through a Print bounded by the measured length
+        CachedBodyWriter writer(body->data, length);
+        body->length = serializeColumnarMsgPack(doc, writer);
+    }
+    else
+    {
+        body->length = serializeJson(doc, body->data, length + 1);
+    }
+
+    release(entry.body);
+    entry.body    = body;
+    entry.version = version;
+    entry.generation++;
+    return true;
+}
+
+void ResponseCache::formatETag(const cached_response_entry_t &entry, char *out, size_t length)
+{
+    // Encodings have their own generations, so the format is part of the tag
+    snprintf(out, length, "\"%08lx-%lx%s\"", (unsigned long) bootId,
+             (unsigned long) entry.generation, entry.format == RESPONSE_MSGPACK ? "m" : "");
+}
+
+void ResponseCache::sendBody(AsyncWebServerRequest *request, const cached_response_entry_t &entry,
+                             bool negotiated)
+{
+    char etag[24];
+    formatETag(entry, etag, sizeof(etag));
+
+    AsyncWebServerResponse *response =
+        new CachedBodyResponse(entry.body, formatContentType(entry.format));
+    response->addHeader("ETag", etag);
+    response->addHeader("Cache-Control", "no-cache");
+    if (negotiated)
+    {
+        response->addHeader("Vary", "Accept");
+    }
+    request->send(response);
+}
+
+void ResponseCache::send(AsyncWebServerRequest *request, cached_response_t slot,
+                         uint32_t version, size_t capacity, BodyBuilder build,
+                         bool negotiated)
+{
+    response_format_t        format = negotiated ? negotiateFormat(request) : RESPONSE_JSON;
+    cached_response_entry_t &entry  = entries[slot][format];
+
+    if (entry.body != nullptr && entry.version == version)
+    {
+        char etag[24];
+        formatETag(entry, etag, sizeof(etag));
+        if (request->hasHeader("If-None-Match") &&
+            request->header("If-None-Match").indexOf(etag) >= 0)
+        {
+            notModified++;
+            AsyncWebServerResponse *response = request->beginResponse(304);
+            response->addHeader("ETag", etag);
+            response->addHeader("Cache-Control", "no-cache");
+            if (negotiated)
+            {
+                response->addHeader("Vary", "Accept");
+            }
+            request->send(response);
+            return;
+        }
+
+        hits++;
+        sendBody(request, entry, negotiated);
+        return;
+    }
+
+    // The data changed since the last build, so no ETag the client holds can match
+    misses++;
+    PooledJsonDocument doc(capacity);
+    build(*doc);
+    EndpointProbe::sampleCurrent();
+    if (doc->overflowed() || !rebuild(entry, version, *doc))
+    {
+        // Too large for the document, or no memory to keep it: send without caching
+        if (negotiated)
+        {
+            sendNegotiated(request, *doc, format);
+        }
+        else
+        {
+            sendJson(request, *doc);
+        }
+        return;
+    }
+    sendBody(request, entry, negotiated);
+}
+
+void ResponseCache::reportStats(JsonObject out)
+{
+    out["hits"]         = hits;
+    out["misses"]       = misses;
+    out["not_modified"] = notModified;
+}
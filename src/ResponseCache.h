@@ -0,0 +1,96 @@
+#ifndef RESPONSE_CACHE_H
+#define RESPONSE_CACHE_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <ESPAsyncWebServer.h>
+
+#include <functional>
+
+#include "JsonResponse.h"
+
+// Read-mostly endpoints whose serialized body is kept between requests
+typedef enum
+{
+    CACHED_SETTINGS       = 0,  // /get_settings
+    CACHED_VERSION        = 1,  // /version
+    CACHED_SENSOR_STATUS  = 2,  // /sensor_status
+    CACHED_STORAGE        = 3,  // /api/storage
+    CACHED_MOVEMENT       = 4,  // /api/timeseries/movement
+    CACHED_RUNOUT         = 5,  // /api/timeseries/runout
+    CACHED_CONNECTION     = 6,  // /api/timeseries/connection
+    CACHED_PAUSE_ATTEMPTS = 7,  // /api/timeseries/pause_attempts
+    CACHED_PAUSE_STATS    = 8,  // /api/timeseries/pause_attempts/stats
+    CACHED_RESPONSE_COUNT
+} cached_response_t;
+
+// Serialized body shared by the cache and every response still sending it. Freed when
+// the last reference is dropped, so a rebuild never pulls a body out from under a slow
+// client.
+typedef struct
+{
+    uint32_t refs;
+    size_t   length;
+    char     data[];
+} cached_body_t;
+
+typedef struct
+{
+    uint32_t          version;     // Version of the data the body was built from
+    uint32_t          generation;  // Bumped on every rebuild; the ETag is derived from it
+    cached_body_t    *body;
+    response_format_t format;
+} cached_response_entry_t;
+
+// Serialized responses keyed by the version of the data behind them. A request rebuilds
+// the body only when the version changed since the last build, and a client that sends
+// back the current ETag in If-None-Match gets 304 with no body at all. Cached bodies are
+// sent straight from the cache without copying. Handlers and responses all run on the
+// async_tcp task, so the entries and reference counts need no lock.
+class ResponseCache
+{
+   private:
+    cached_response_entry_t entries[CACHED_RESPONSE_COUNT][RESPONSE_FORMAT_COUNT];
+    uint32_t                bootId;  // Keeps ETags from a previous boot from matching
+    uint32_t                hits;
+    uint32_t                misses;
+    uint32_t                notModified;
+
+    ResponseCache();
+
+    // Delete copy constructor and assignment operator
+    ResponseCache(const ResponseCache &)            = delete;
+    ResponseCache &operator=(const ResponseCache &) = delete;
+
+    bool rebuild(cached_response_entry_t &entry, uint32_t version, JsonDocument &doc);
+    void formatETag(const cached_response_entry_t &entry, char *out, size_t length);
+    void sendBody(AsyncWebServerRequest *request, const cached_response_entry_t &entry,
+                  bool negotiated);
+
+   public:
+    typedef std::function<void(JsonDocument &)> BodyBuilder;
+
+    // Singleton access method
+    static ResponseCache &getInstance();
+
+    // Answer request from the cache, filling a document of the given capacity with build
+    // only if version differs from the cached body's. Versions are compared for equality
+    // only, so any value that changes whenever the body would is fine. When negotiated,
+    // the body is encoded as the Accept header asks (see negotiateFormat()) and each
+    // encoding is cached separately.
+    void send(AsyncWebServerRequest *request, cached_response_t slot, uint32_t version,
+              size_t capacity, BodyBuilder build, bool negotiated = false);
+
+    // Fold another data source's version into a combined one
+    static uint32_t combine(uint32_t version, uint32_t other);
+
+    static void retain(cached_body_t *body);
+    static void release(cached_body_t *body);
+
+    void reportStats(JsonObject out);
+};
+
+// Convenience macro for easier access
+#define responseCache ResponseCache::getInstance()
+
+#endif  // RESPONSE_CACHE_H
@@ -3,10 +3,77 @@
 #include <Arduino.h>
 #include <ArduinoJson.h>
 #include <LittleFS.h>
+#include <nvs.h>
 #include <stdlib.h>
 
 #include "Logger.h"
 
+#define SETTING_BOOL(id, key, nvsKey, member, defaultValue, flags)                              \
+    {                                                                                          \
+        id, key, nvsKey, SETTING_TYPE_BOOL, offsetof(user_settings, member), sizeof(bool),     \
+            defaultValue, nullptr, 0, 1, flags                                                 \
+    }
+#define SETTING_INT(id, key, nvsKey, member, defaultValue, minValue, maxValue)                  \
+    {                                                                                          \
+        id, key, nvsKey, SETTING_TYPE_INT, offsetof(user_settings, member), sizeof(int),       \
+            defaultValue, nullptr, minValue, maxValue, 0                                       \
+    }
+#define SETTING_STRING(id, key, nvsKey, member, defaultString, flags)                           \
+    {                                                                                          \
+        id, key, nvsKey, SETTING_TYPE_STRING, offsetof(user_settings, member),                 \
+            sizeof(((user_settings *) nullptr)->member), 0, defaultString, 0, 0, flags         \
+    }
+
+#define MAX_TIMEOUT_MS 3600000  // An hour; anything longer is a typo
+
+static constexpr setting_field_t SETTING_FIELDS[SETTING_COUNT] = {
+    SETTING_STRING(SETTING_SSID, "ssid", "ssid", ssid, "lee", SETTING_FLAG_WIFI),
+    SETTING_STRING(SETTING_PASSWD, "passwd", "passwd", passwd, "qqqqqqqq",
+                   SETTING_FLAG_WIFI | SETTING_FLAG_SECRET),
+    SETTING_BOOL(SETTING_AP_MODE, "ap_mode", "ap_mode", ap_mode, false, SETTING_FLAG_WIFI),
+    SETTING_STRING(SETTING_ELEGOOIP, "elegooip", "elegooip", elegooip, "192.168.0.107", 0),
+    SETTING_INT(SETTING_TIMEOUT, "timeout", "timeout", timeout, 20000, 100, MAX_TIMEOUT_MS),
+    SETTING_INT(SETTING_FIRST_LAYER_TIMEOUT, "first_layer_timeout", "first_layer_to",
+                first_layer_timeout, 8000, 100, MAX_TIMEOUT_MS),
+    SETTING_BOOL(SETTING_PAUSE_ON_RUNOUT, "pause_on_runout", "pause_runout", pause_on_runout, true,
+                 0),
+    SETTING_INT(SETTING_START_PRINT_TIMEOUT, "start_print_timeout", "start_print_to",
+                start_print_timeout, 10000, 0, MAX_TIMEOUT_MS),
+    SETTING_BOOL(SETTING_ENABLED, "enabled", "enabled", enabled, true, 0),
+    SETTING_BOOL(SETTING_HAS_CONNECTED, "has_connected", "has_connected", has_connected, false, 0),
+    SETTING_INT(SETTING_PAUSE_VERIFICATION_TIMEOUT_MS, "pause_verification_timeout_ms",
+                "pause_verify_to", pause_verification_timeout_ms, 15000, 100, MAX_TIMEOUT_MS),
+    SETTING_INT(SETTING_MAX_PAUSE_RETRIES, "max_pause_retries", "pause_retries", max_pause_retries,
+                5, 0, 100),
+};
+
+// Single-return recursion, so these stay constexpr under C++11
+static constexpr size_t keyLength(const char *key, size_t i = 0)
+{
+    return key[i] == '\0' ? i : keyLength(key, i + 1);
+}
+
+static constexpr bool fieldValid(int i)
+{
+    // 15 is NVS_KEY_NAME_MAX_SIZE - 1
+    return SETTING_FIELDS[i].id == i && keyLength(SETTING_FIELDS[i].nvsKey) >= 1 &&
+           keyLength(SETTING_FIELDS[i].nvsKey) <= 15;
+}
+
+static constexpr bool settingFieldsValid(int i = 0)
+{
+    return i >= SETTING_COUNT || (fieldValid(i) && settingFieldsValid(i + 1));
+}
+
+static_assert(settingFieldsValid(),
+              "SETTING_FIELDS must follow setting_id_t, with NVS keys of 1-15 characters");
+static_assert(SETTING_COUNT <= 32, "dirtyMask has a bit per setting");
+
+static bool intInRange(const setting_field_t &field, int32_t value)
+{
+    return value >= field.minValue && value <= field.maxValue;
+}
+
 SettingsManager &SettingsManager::getInstance()
 {
     static SettingsManager instance;
@@ -15,81 +82,220 @@ SettingsManager &SettingsManager::getInstance()
 
 SettingsManager::SettingsManager()
 {
-    isLoaded                     = false;
-    requestWifiReconnect         = false;
-    wifiChanged                  = false;
-    settings.ap_mode             = false;
-    settings.ssid                = "lee";           // Default WiFi SSID
-    settings.passwd              = "qqqqqqqq";      // Default WiFi password
-    settings.elegooip            = "192.168.0.107";
-    settings.timeout             = 20000;
-    settings.first_layer_timeout = 8000;
-    settings.pause_on_runout     = true;
-    settings.start_print_timeout = 10000;
-    settings.enabled             = true;
-    settings.has_connected       = false;
-    settings.pause_verification_timeout_ms = 15000;  // 15 seconds default
-    settings.max_pause_retries   = 5;                // 5 retries default
+    isLoaded             = false;
+    requestWifiReconnect = false;
+    wifiChanged          = false;
+    version              = 0;
+    dirtyMask            = 0;
+    applyDefaults();
+
+    memset(&snapshot, 0, sizeof(snapshot));
+    generation  = 0;
+    publishLock = portMUX_INITIALIZER_UNLOCKED;
+    publish();
 }
 
-bool SettingsManager::load()
+void SettingsManager::applyDefaults()
 {
-    File file = LittleFS.open("/user_settings.json", "r");
-    if (!file)
+    memset(&settings, 0, sizeof(settings));
+    for (const setting_field_t &field : SETTING_FIELDS)
     {
-        logger.log("Settings file not found, using defaults");
-        isLoaded = true;
-        return false;
+        uint8_t *value = (uint8_t *) &settings + field.offset;
+        switch (field.type)
+        {
+            case SETTING_TYPE_BOOL:
+                *(bool *) value = field.defaultValue != 0;
+                break;
+            case SETTING_TYPE_INT:
+                *(int *) value = field.defaultValue;
+                break;
+            case SETTING_TYPE_STRING:
+                strlcpy((char *) value, field.defaultString, field.size);
+                break;
+        }
     }
+}
 
-    StaticJsonDocument<1024> doc;
-    DeserializationError     error = deserializeJson(doc, file);
-    file.close();
+bool SettingsManager::load()
+{
+    isLoaded = true;
 
-    if (error)
+    nvs_handle_t handle;
+    esp_err_t    err = nvs_open(SETTINGS_NVS_NAMESPACE, NVS_READONLY, &handle);
+    if (err == ESP_ERR_NVS_NOT_FOUND)
+    {
+        // Nothing saved to NVS yet
+        bool migrated = migrateFromFile();
+        if (!migrated)
+        {
+            logger.log("No saved settings, using defaults");
+        }
+        version++;
+        publish();
+        return migrated;
+    }
+    if (err != ESP_OK)
     {
-        logger.log("Settings JSON parsing error, using defaults");
-        isLoaded = true;
+        logger.logf("Failed to open settings in NVS (%d), using defaults", err);
+        publish();
         return false;
     }
 
-    settings.ap_mode             = doc["ap_mode"] | false;
-    settings.ssid                = doc["ssid"] | "";
-    settings.passwd              = doc["passwd"] | "";
-    settings.elegooip            = doc["elegooip"] | "";
-    settings.timeout             = doc["timeout"] | 4000;
-    settings.first_layer_timeout = doc["first_layer_timeout"] | 8000;
-    settings.pause_on_runout     = doc["pause_on_runout"] | true;
-    settings.enabled             = doc["enabled"] | true;
-    settings.start_print_timeout = doc["start_print_timeout"] | 10000;
-    settings.has_connected       = doc["has_connected"] | false;
-    settings.pause_verification_timeout_ms = doc["pause_verification_timeout_ms"] | 15000;
-    settings.max_pause_retries   = doc["max_pause_retries"] | 5;
+    int rejected = 0;
+    for (const setting_field_t &field : SETTING_FIELDS)
+    {
+        uint8_t *value = (uint8_t *) &settings + field.offset;
+        switch (field.type)
+        {
+            case SETTING_TYPE_BOOL:
+            {
+                uint8_t stored;
+                err = nvs_get_u8(handle, field.nvsKey, &stored);
+                if (err == ESP_OK)
+                {
+                    *(bool *) value = stored != 0;
+                }
+                break;
+            }
+            case SETTING_TYPE_INT:
+            {
+                int32_t stored;
+                err = nvs_get_i32(handle, field.nvsKey, &stored);
+                if (err == ESP_OK)
+                {
+                    if (intInRange(field, stored))
+                    {
+                        *(int *) value = stored;
+                    }
+                    else
+                    {
+                        rejected++;
+                    }
+                }
+                break;
+            }
+            case SETTING_TYPE_STRING:
+            {
+                // Only written on success; too long for the field counts as invalid
+                size_t length = field.size;
+                err           = nvs_get_str(handle, field.nvsKey, (char *) value, &length);
+                if (err == ESP_ERR_NVS_INVALID_LENGTH)
+                {
+                    rejected++;
+                }
+                break;
+            }
+        }
+    }
+    nvs_close(handle);
 
-    isLoaded = true;
+    if (rejected > 0)
+    {
+        logger.logf("%d saved settings were invalid, using their defaults", rejected);
+    }
+    version++;
+    publish();
     return true;
 }
 
-bool SettingsManager::save(bool skipWifiCheck)
+bool SettingsManager::migrateFromFile()
 {
-    String output = toJson(true);
-
-    File file = LittleFS.open("/user_settings.json", "w");
+    File file = LittleFS.open(SETTINGS_FILE_PATH, "r");
     if (!file)
     {
-        logger.log("Failed to open settings file for writing");
         return false;
     }
 
-    if (file.print(output) == 0)
+    StaticJsonDocument<SETTINGS_JSON_SIZE> doc;
+    DeserializationError                   error = deserializeJson(doc, file);
+    file.close();
+    if (error)
     {
-        logger.log("Failed to write settings to file");
-        file.close();
+        logger.log("Old settings file is corrupt, using defaults");
         return false;
     }
 
-    file.close();
-    logger.log("Settings saved successfully");
+    // Copied as stored: a blank password there is an open network, not "keep the current one"
+    JsonObjectConst legacy = doc.as<JsonObjectConst>();
+    String          rejectedKeys;
+    if (validateJson(legacy, rejectedKeys) > 0)
+    {
+        logger.logf("Old settings had invalid values, using defaults for: %s", rejectedKeys.c_str());
+    }
+    importJson(legacy, false);
+    wifiChanged = false;  // Nothing to reconnect; these are the credentials in use
+
+    // Everything goes to NVS, defaults included, so the namespace is complete
+    dirtyMask = (1UL << SETTING_COUNT) - 1;
+    if (!save(true))
+    {
+        return true;  // Still in use from memory; the file stays for the next boot to retry
+    }
+    storageManager.removeFile(SETTINGS_FILE_PATH);
+    logger.log("Moved settings from " SETTINGS_FILE_PATH " to NVS");
+    return true;
+}
+
+bool SettingsManager::save(bool skipWifiCheck)
+{
+    // Takes effect even if NVS can't be written; a save that changed nothing readers see
+    // publishes nothing
+    publish();
+
+    if (dirtyMask != 0)
+    {
+        nvs_handle_t handle;
+        esp_err_t    err = nvs_open(SETTINGS_NVS_NAMESPACE, NVS_READWRITE, &handle);
+        if (err != ESP_OK)
+        {
+            logger.logf("Failed to open settings in NVS for writing (%d)", err);
+            return false;
+        }
+
+        // Each key is replaced atomically, so a reset part way leaves every value either
+        // old or new, never missing
+        int written = 0;
+        for (const setting_field_t &field : SETTING_FIELDS)
+        {
+            if ((dirtyMask & (1UL << field.id)) == 0)
+            {
+                continue;
+            }
+            const uint8_t *value = (const uint8_t *) &settings + field.offset;
+            switch (field.type)
+            {
+                case SETTING_TYPE_BOOL:
+                    err = nvs_set_u8(handle, field.nvsKey, *(const bool *) value ? 1 : 0);
+                    break;
+                case SETTING_TYPE_INT:
+                    err = nvs_set_i32(handle, field.nvsKey, *(const int *) value);
+                    break;
+                case SETTING_TYPE_STRING:
+                    err = nvs_set_str(handle, field.nvsKey, (const char *) value);
+                    break;
+            }
+            if (err != ESP_OK)
+            {
+                logger.logf("Failed to write setting %s (%d)", field.key, err);
+                break;
+            }
+            dirtyMask &= ~(1UL << field.id);
+            written++;
+        }
+        if (err == ESP_OK)
+        {
+            err = nvs_commit(handle);
+        }
+        nvs_close(handle);
+
+        if (err != ESP_OK)
+        {
+            logger.logf("Failed to commit settings to NVS (%d)", err);
+            return false;
+        }
+        logger.logf("Settings saved (%d changed)", written);
+    }
+
     if (!skipWifiCheck && wifiChanged)
     {
         logger.log("WiFi changed, requesting reconnection");
@@ -168,124 +374,279 @@ int SettingsManager::getMaxPauseRetries()
     return getSettings().max_pause_retries;
 }
 
-void SettingsManager::setSSID(const String &ssid)
+void SettingsManager::markChanged(setting_id_t id)
+{
+    dirtyMask |= 1UL << id;
+    if (SETTING_FIELDS[id].flags & SETTING_FLAG_WIFI)
+    {
+        wifiChanged = true;
+    }
+    version++;
+}
+
+bool SettingsManager::setBool(setting_id_t id, bool value)
 {
     if (!isLoaded)
         load();
-    if (settings.ssid != ssid)
+    bool *current = (bool *) ((uint8_t *) &settings + SETTING_FIELDS[id].offset);
+    if (*current != value)
     {
-        settings.ssid = ssid;
-        wifiChanged   = true;
+        *current = value;
+        markChanged(id);
     }
+    return true;
 }
 
-void SettingsManager::setPassword(const String &password)
+bool SettingsManager::setInt(setting_id_t id, int32_t value)
 {
     if (!isLoaded)
         load();
-    if (settings.passwd != password)
+    const setting_field_t &field = SETTING_FIELDS[id];
+    if (!intInRange(field, value))
+    {
+        logger.logf("Ignoring %s = %ld, outside %ld-%ld", field.key, (long) value,
+                    (long) field.minValue, (long) field.maxValue);
+        return false;
+    }
+    int *current = (int *) ((uint8_t *) &settings + field.offset);
+    if (*current != value)
     {
-        settings.passwd = password;
-        wifiChanged     = true;
+        *current = value;
+        markChanged(id);
     }
+    return true;
 }
 
-void SettingsManager::setAPMode(bool apMode)
+bool SettingsManager::setString(setting_id_t id, const char *value)
 {
     if (!isLoaded)
         load();
-    if (settings.ap_mode != apMode)
+    const setting_field_t &field = SETTING_FIELDS[id];
+    if (strlen(value) >= field.size)
+    {
+        logger.logf("Ignoring %s, longer than %u characters", field.key, (unsigned) field.size - 1);
+        return false;
+    }
+    char *current = (char *) &settings + field.offset;
+    if (strcmp(current, value) != 0)
     {
-        settings.ap_mode = apMode;
-        wifiChanged      = true;
+        strlcpy(current, value, field.size);
+        markChanged(id);
     }
+    return true;
+}
+
+void SettingsManager::setSSID(const String &ssid)
+{
+    setString(SETTING_SSID, ssid.c_str());
+}
+
+void SettingsManager::setPassword(const String &password)
+{
+    setString(SETTING_PASSWD, password.c_str());
+}
+
+void SettingsManager::setAPMode(bool apMode)
+{
+    setBool(SETTING_AP_MODE, apMode);
 }
 
 void SettingsManager::setElegooIP(const String &ip)
 {
-    if (!isLoaded)
-        load();
-    settings.elegooip = ip;
+    setString(SETTING_ELEGOOIP, ip.c_str());
 }
 
 void SettingsManager::setTimeout(int timeout)
 {
-    if (!isLoaded)
-        load();
-    settings.timeout = timeout;
+    setInt(SETTING_TIMEOUT, timeout);
 }
 
 void SettingsManager::setFirstLayerTimeout(int timeout)
 {
-    if (!isLoaded)
-        load();
-    settings.first_layer_timeout = timeout;
+    setInt(SETTING_FIRST_LAYER_TIMEOUT, timeout);
 }
 
 void SettingsManager::setPauseOnRunout(bool pauseOnRunout)
 {
-    if (!isLoaded)
-        load();
-    settings.pause_on_runout = pauseOnRunout;
+    setBool(SETTING_PAUSE_ON_RUNOUT, pauseOnRunout);
 }
 
 void SettingsManager::setStartPrintTimeout(int timeoutMs)
 {
-    if (!isLoaded)
-        load();
-    settings.start_print_timeout = timeoutMs;
+    setInt(SETTING_START_PRINT_TIMEOUT, timeoutMs);
 }
 
 void SettingsManager::setEnabled(bool enabled)
 {
-    if (!isLoaded)
-        load();
-    settings.enabled = enabled;
+    setBool(SETTING_ENABLED, enabled);
 }
 
 void SettingsManager::setHasConnected(bool hasConnected)
 {
-    if (!isLoaded)
-        load();
-    settings.has_connected = hasConnected;
+    setBool(SETTING_HAS_CONNECTED, hasConnected);
 }
 
 void SettingsManager::setPauseVerificationTimeoutMs(int timeoutMs)
 {
-    if (!isLoaded)
-        load();
-    settings.pause_verification_timeout_ms = timeoutMs;
+    setInt(SETTING_PAUSE_VERIFICATION_TIMEOUT_MS, timeoutMs);
 }
 
 void SettingsManager::setMaxPauseRetries(int retries)
 {
-    if (!isLoaded)
-        load();
-    settings.max_pause_retries = retries;
+    setInt(SETTING_MAX_PAUSE_RETRIES, retries);
 }
 
-String SettingsManager::toJson(bool includePassword)
+uint32_t SettingsManager::getVersion()
 {
-    String                   output;
-    StaticJsonDocument<1024> doc;
-
-    doc["ap_mode"]             = settings.ap_mode;
-    doc["ssid"]                = settings.ssid;
-    doc["elegooip"]            = settings.elegooip;
-    doc["timeout"]             = settings.timeout;
-    doc["first_layer_timeout"] = settings.first_layer_timeout;
-    doc["pause_on_runout"]     = settings.pause_on_runout;
-    doc["start_print_timeout"] = settings.start_print_timeout;
-    doc["enabled"]             = settings.enabled;
-    doc["has_connected"]       = settings.has_connected;
-    doc["pause_verification_timeout_ms"] = settings.pause_verification_timeout_ms;
-    doc["max_pause_retries"]   = settings.max_pause_retries;
-
-    if (includePassword)
+    return version;
+}
+
+void SettingsManager::publish()
+{
+    // Built zeroed, padding included, so an unchanged snapshot compares equal
+    settings_snapshot_t next;
+    memset(&next, 0, sizeof(next));
+    strlcpy(next.elegooip, settings.elegooip, sizeof(next.elegooip));
+    next.ap_mode                       = settings.ap_mode;
+    next.timeout                       = settings.timeout;
+    next.first_layer_timeout           = settings.first_layer_timeout;
+    next.pause_on_runout               = settings.pause_on_runout;
+    next.start_print_timeout           = settings.start_print_timeout;
+    next.enabled                       = settings.enabled;
+    next.has_connected                 = settings.has_connected;
+    next.pause_verification_timeout_ms = settings.pause_verification_timeout_ms;
+    next.max_pause_retries             = settings.max_pause_retries;
+
+    portENTER_CRITICAL(&publishLock);
+    next.generation = snapshot.generation;
+    if (generation == 0 || memcmp(&next, &snapshot, sizeof(next)) != 0)
     {
-        doc["passwd"] = settings.passwd;
+        next.generation = generation + 1;
+        snapshot        = next;
+        __atomic_store_n(&generation, next.generation, __ATOMIC_RELEASE);
     }
+    portEXIT_CRITICAL(&publishLock);
+}
 
+void SettingsManager::getSnapshot(settings_snapshot_t &out)
+{
+    portENTER_CRITICAL(&publishLock);
+    out = snapshot;
+    portEXIT_CRITICAL(&publishLock);
+}
+
+uint32_t SettingsManager::getGeneration()
+{
+    return __atomic_load_n(&generation, __ATOMIC_ACQUIRE);
+}
+
+String SettingsManager::toJson(bool includePassword)
+{
+    String                                 output;
+    StaticJsonDocument<SETTINGS_JSON_SIZE> doc;
+    writeJson(doc.to<JsonObject>(), includePassword);
     serializeJson(doc, output);
     return output;
 }
+
+void SettingsManager::writeJson(JsonObject doc, bool includePassword)
+{
+    for (const setting_field_t &field : SETTING_FIELDS)
+    {
+        if ((field.flags & SETTING_FLAG_SECRET) && !includePassword)
+        {
+            continue;
+        }
+        uint8_t *value = (uint8_t *) &settings + field.offset;
+        switch (field.type)
+        {
+            case SETTING_TYPE_BOOL:
+                doc[field.key] = *(bool *) value;
+                break;
+            case SETTING_TYPE_INT:
+                doc[field.key] = *(int *) value;
+                break;
+            case SETTING_TYPE_STRING:
+                doc[field.key] = (char *) value;  // Non-const, so the document copies it
+                break;
+        }
+    }
+}
+
+// Whether value has the field's type and is in range, without storing it
+static bool jsonValueValid(const setting_field_t &field, JsonVariantConst value)
+{
+    switch (field.type)
+    {
+        case SETTING_TYPE_BOOL:
+            return value.is<bool>();
+        case SETTING_TYPE_INT:
+            return value.is<int32_t>() && intInRange(field, value.as<int32_t>());
+        case SETTING_TYPE_STRING:
+        {
+            const char *text = value.as<const char *>();
+            return text != nullptr && strlen(text) < field.size;
+        }
+    }
+    return false;
+}
+
+int SettingsManager::validateJson(JsonObjectConst in, String &rejectedKeys)
+{
+    int rejected = 0;
+    rejectedKeys = "";
+    for (const setting_field_t &field : SETTING_FIELDS)
+    {
+        JsonVariantConst value = in[field.key];
+        if (value.isNull() || jsonValueValid(field, value))
+        {
+            continue;
+        }
+        if (rejected++ > 0)
+        {
+            rejectedKeys += ", ";
+        }
+        rejectedKeys += field.key;
+    }
+    return rejected;
+}
+
+int SettingsManager::importJson(JsonObjectConst in, bool blankSecretKeeps)
+{
+    int rejected = 0;
+    for (const setting_field_t &field : SETTING_FIELDS)
+    {
+        JsonVariantConst value = in[field.key];
+        if (value.isNull())
+        {
+            continue;
+        }
+        bool accepted = false;
+        switch (field.type)
+        {
+            case SETTING_TYPE_BOOL:
+                accepted = value.is<bool>() && setBool(field.id, value.as<bool>());
+                break;
+            case SETTING_TYPE_INT:
+                accepted = value.is<int32_t>() && setInt(field.id, value.as<int32_t>());
+                break;
+            case SETTING_TYPE_STRING:
+            {
+                const char *text = value.as<const char *>();
+                if (blankSecretKeeps && text != nullptr && text[0] == '\0' &&
+                    (field.flags & SETTING_FLAG_SECRET))
+                {
+                    accepted = true;  // Left blank in the form: keep the current one
+                    break;
+                }
+                accepted = text != nullptr && setString(field.id, text);
+                break;
+            }
+        }
+        if (!accepted)
+        {
+            rejected++;
+        }
+    }
+    return rejected;
+}
@@ -1,34 +1,129 @@
 #include <Arduino.h>
 #include <ArduinoJson.h>
 
+#include "StorageManager.h"
+
 #ifndef SETTINGS_DATA_H
 #define SETTINGS_DATA_H
 
+#define SETTINGS_SSID_LEN 33    // 32 characters and the terminator
+#define SETTINGS_PASSWD_LEN 65  // WPA2 allows 63, or a 64 hex digit key
+#define SETTINGS_HOST_LEN 64    // Printer address, IP or hostname, with its terminator
+
 struct user_settings
 {
-    String ssid;
-    String passwd;
-    bool   ap_mode;
-    String elegooip;
-    int    timeout;
-    int    first_layer_timeout;
-    bool   pause_on_runout;
-    int    start_print_timeout;
-    bool   enabled;
-    bool   has_connected;
-    int    pause_verification_timeout_ms;
-    int    max_pause_retries;
+    char ssid[SETTINGS_SSID_LEN];
+    char passwd[SETTINGS_PASSWD_LEN];
+    bool ap_mode;
+    char elegooip[SETTINGS_HOST_LEN];
+    int  timeout;
+    int  first_layer_timeout;
+    bool pause_on_runout;
+    int  start_print_timeout;
+    bool enabled;
+    bool has_connected;
+    int  pause_verification_timeout_ms;
+    int  max_pause_retries;
 };
 
+// One entry per field of user_settings, in the order of the table in SettingsManager.cpp
+typedef enum
+{
+    SETTING_SSID,
+    SETTING_PASSWD,
+    SETTING_AP_MODE,
+    SETTING_ELEGOOIP,
+    SETTING_TIMEOUT,
+    SETTING_FIRST_LAYER_TIMEOUT,
+    SETTING_PAUSE_ON_RUNOUT,
+    SETTING_START_PRINT_TIMEOUT,
+    SETTING_ENABLED,
+    SETTING_HAS_CONNECTED,
+    SETTING_PAUSE_VERIFICATION_TIMEOUT_MS,
+    SETTING_MAX_PAUSE_RETRIES,
+    SETTING_COUNT
+} setting_id_t;
+
+typedef enum
+{
+    SETTING_TYPE_BOOL,
+    SETTING_TYPE_INT,
+    SETTING_TYPE_STRING
+} setting_type_t;
+
+#define SETTING_FLAG_WIFI 0x01    // Changing it reconnects WiFi
+#define SETTING_FLAG_SECRET 0x02  // Left out of exports; an empty import keeps the old value
+
+// Describes one setting, for load, save, JSON import and export and validation
+typedef struct
+{
+    setting_id_t   id;
+    const char    *key;     // JSON name
+    const char    *nvsKey;  // At most 15 characters
+    setting_type_t type;
+    size_t         offset;  // Into user_settings
+    size_t         size;    // Buffer size for strings
+    int32_t        defaultValue;
+    const char    *defaultString;
+    int32_t        minValue;  // Inclusive range for ints
+    int32_t        maxValue;
+    uint8_t        flags;
+} setting_field_t;
+
+// Fixed-size copy of what the main loop reads, published whole when a load or save changes
+// it. Nothing in it allocates, so hot paths keep their own copy and only fetch a new one
+// when getGeneration() moves. Credentials stay out of it.
+typedef struct
+{
+    uint32_t generation;
+    char     elegooip[SETTINGS_HOST_LEN];
+    bool     ap_mode;
+    int      timeout;
+    int      first_layer_timeout;
+    bool     pause_on_runout;
+    int      start_print_timeout;
+    bool     enabled;
+    bool     has_connected;
+    int      pause_verification_timeout_ms;
+    int      max_pause_retries;
+} settings_snapshot_t;
+
+// Document size for the serialized settings; strings are copied in, so this leaves room
+// for them
+#define SETTINGS_JSON_SIZE 1024
+
+// NVS namespace holding one key per setting
+#define SETTINGS_NVS_NAMESPACE "settings"
+
+// Where settings lived before NVS; imported once on the first boot without the namespace
+#define SETTINGS_FILE_PATH "/user_settings.json"
+
 class SettingsManager
 {
    private:
     user_settings settings;
     bool          isLoaded;
     bool          wifiChanged;
+    uint32_t      version;    // Bumped on every load and change, for response caching
+    uint32_t      dirtyMask;  // Bit per setting_id_t changed since the last save
+
+    // Only ever copied in and out whole under publishLock, so no reader sees it half written
+    settings_snapshot_t snapshot;
+    uint32_t            generation;
+    portMUX_TYPE        publishLock;
 
     SettingsManager();
 
+    void publish();
+    void applyDefaults();
+    bool migrateFromFile();
+
+    // Validate and store one value, marking it dirty when it changes
+    bool setBool(setting_id_t id, bool value);
+    bool setInt(setting_id_t id, int32_t value);
+    bool setString(setting_id_t id, const char *value);
+    void markChanged(setting_id_t id);
+
     SettingsManager(const SettingsManager &)            = delete;
     SettingsManager &operator=(const SettingsManager &) = delete;
 
@@ -38,7 +133,9 @@ class SettingsManager
     // Flag to request WiFi reconnection with new credentials
     bool requestWifiReconnect;
 
+    // Read every setting from NVS; missing or invalid keys keep their defaults
     bool load();
+    // Write the settings changed since the last save, then commit
     bool save(bool skipWifiCheck = false);
 
     //  (loads if not already loaded)
@@ -70,7 +167,22 @@ class SettingsManager
     void setPauseVerificationTimeoutMs(int timeoutMs);
     void setMaxPauseRetries(int retries);
 
+    uint32_t getVersion();
+
+    // Copy out the settings as of the last load or save that changed them; holders fetch
+    // a new copy whenever getGeneration() moves
+    void     getSnapshot(settings_snapshot_t &out);
+    uint32_t getGeneration();
+
     String toJson(bool includePassword = true);
+    // Fill out with the same fields, in a document of at least SETTINGS_JSON_SIZE bytes
+    void writeJson(JsonObject out, bool includePassword = true);
+    // Check the settings present in in without applying any; returns how many are invalid
+    // and lists their keys, comma separated, in rejectedKeys
+    int validateJson(JsonObjectConst in, String &rejectedKeys);
+    // Apply the settings present in in; returns how many values were rejected. With
+    // blankSecretKeeps, a blank secret (left empty in the form) keeps the current value.
+    int importJson(JsonObjectConst in, bool blankSecretKeeps = true);
 };
 
 #define settingsManager SettingsManager::getInstance()
@@ -0,0 +1,275 @@
+#include "StorageManager.h"
+
+#include <esp_timer.h>
+
+#include "JobScheduler.h"
+#include "Logger.h"
+#include "TimeBase.h"
+
+StorageManager &StorageManager::getInstance()
+{
+    static StorageManager instance;
+    return instance;
+}
+
+StorageManager::StorageManager()
+{
+    memset(files, 0, sizeof(files));
+    memset(&fsStats, 0, sizeof(fsStats));
+    fileCount       = 0;
+    mounted         = false;
+    fsStatsDirty    = false;
+    version         = 0;
+    wearWindowStart = 0;
+    storageLock     = portMUX_INITIALIZER_UNLOCKED;
+}
+
+bool StorageManager::begin()
+{
+    if (mounted)
+    {
+        return true;
+    }
+
+    // Format if the mount fails, e.g. after a corrupted write
+    if (LittleFS.begin(true))
+    {
+        mounted = true;
+        logger.log("LittleFS mounted successfully");
+    }
+    else
+    {
+        logger.log("LittleFS mount failed, formatting...");
+        if (LittleFS.format())
+        {
+            logger.log("LittleFS formatted successfully");
+            mounted = LittleFS.begin();
+            logger.log(mounted ? "LittleFS mounted after format"
+                               : "LittleFS mount failed even after format!");
+        }
+        else
+        {
+            logger.log("LittleFS format failed!");
+        }
+    }
+
+    if (!mounted)
+    {
+        return false;
+    }
+
+    // Files tracked before the mount couldn't be stat'ed yet
+    for (int i = 0; i < fileCount; i++)
+    {
+        size_t size = statFile(files[i].path);
+        portENTER_CRITICAL(&storageLock);
+        files[i].size = size;
+        portEXIT_CRITICAL(&storageLock);
+    }
+    refreshFsStats();
+
+    jobScheduler.schedulePeriodic("storage", STORAGE_MAINTENANCE_INTERVAL_MS, JOB_PRIORITY_LOW,
+                                  [this]() { loop(); });
+    return true;
+}
+
+void StorageManager::loop()
+{
+    unsigned long now = timeBase.nowMs();
+    if (now - wearWindowStart >= STORAGE_WEAR_WINDOW_MS)
+    {
+        portENTER_CRITICAL(&storageLock);
+        for (int i = 0; i < fileCount; i++)
+        {
+            files[i].bytesLastHour = files[i].bytesThisHour;
+            files[i].bytesThisHour = 0;
+        }
+        portEXIT_CRITICAL(&storageLock);
+        wearWindowStart = now;
+    }
+
+    unsigned long elapsed = timeBase.nowMs() - fsStats.sampledAt;
+    if ((fsStatsDirty && elapsed >= STORAGE_FS_DIRTY_REFRESH_MS) ||
+        elapsed >= STORAGE_FS_REFRESH_MS)
+    {
+        refreshFsStats();
+    }
+}
+
+bool StorageManager::isMounted()
+{
+    return mounted;
+}
+
+void StorageManager::refreshFsStats()
+{
+    storage_fs_stats_t stats;
+    stats.totalBytes = LittleFS.totalBytes();
+    stats.usedBytes  = LittleFS.usedBytes();
+    stats.sampledAt  = timeBase.nowMs();
+
+    portENTER_CRITICAL(&storageLock);
+    fsStats      = stats;
+    fsStatsDirty = false;
+    version++;
+    portEXIT_CRITICAL(&storageLock);
+}
+
+size_t StorageManager::statFile(const char *path)
+{
+    File file = LittleFS.open(path, "r");
+    if (!file)
+    {
+        return 0;
+    }
+    size_t size = file.size();
+    file.close();
+    return size;
+}
+
+bool StorageManager::isValid(storage_file_t file)
+{
+    return file >= 0 && file < fileCount;
+}
+
+storage_file_t StorageManager::track(const char *path, size_t quota)
+{
+    for (int i = 0; i < fileCount; i++)
+    {
+        if (strcmp(files[i].path, path) == 0)
+        {
+            files[i].quota = quota;
+            return i;
+        }
+    }
+    if (fileCount >= STORAGE_MAX_FILES || strlen(path) >= STORAGE_PATH_LEN)
+    {
+        logger.logf("Can't track %s, storage table full or path too long", path);
+        return STORAGE_FILE_NONE;
+    }
+
+    size_t size = mounted ? statFile(path) : 0;
+
+    portENTER_CRITICAL(&storageLock);
+    storage_file_t file = fileCount;
+    strlcpy(files[file].path, path, STORAGE_PATH_LEN);
+    files[file].size  = size;
+    files[file].quota = quota;
+    fileCount++;
+    portEXIT_CRITICAL(&storageLock);
+    return file;
+}
+
+size_t StorageManager::getFileSize(storage_file_t file)
+{
+    return isValid(file) ? files[file].size : 0;
+}
+
+size_t StorageManager::getQuota(storage_file_t file)
+{
+    return isValid(file) ? files[file].quota : 0;
+}
+
+bool StorageManager::isOverQuota(storage_file_t file)
+{
+    return isValid(file) && files[file].quota > 0 && files[file].size > files[file].quota;
+}
+
+void StorageManager::setFileSize(storage_file_t file, size_t size, bool written)
+{
+    if (!isValid(file))
+    {
+        return;
+    }
+    portENTER_CRITICAL(&storageLock);
+    files[file].size = size;
+    if (written)
+    {
+        files[file].bytesWritten += size;
+        files[file].bytesThisHour += size;
+    }
+    fsStatsDirty = true;
+    version++;
+    portEXIT_CRITICAL(&storageLock);
+}
+
+void StorageManager::addFileBytes(storage_file_t file, size_t bytes)
+{
+    if (!isValid(file))
+    {
+        return;
+    }
+    portENTER_CRITICAL(&storageLock);
+    files[file].size += bytes;
+    files[file].bytesWritten += bytes;
+    files[file].bytesThisHour += bytes;
+    fsStatsDirty = true;
+    version++;
+    portEXIT_CRITICAL(&storageLock);
+}
+
+bool StorageManager::removeFile(storage_file_t file)
+{
+    if (!isValid(file))
+    {
+        return false;
+    }
+    bool removed =
+        mounted && LittleFS.exists(files[file].path) && LittleFS.remove(files[file].path);
+    setFileSize(file, 0, false);
+    return removed;
+}
+
+bool StorageManager::removeFile(const char *path)
+{
+    for (int i = 0; i < fileCount; i++)
+    {
+        if (strcmp(files[i].path, path) == 0)
+        {
+            return removeFile(i);
+        }
+    }
+    return mounted && LittleFS.exists(path) && LittleFS.remove(path);
+}
+
+storage_fs_stats_t StorageManager::getFsStats()
+{
+    portENTER_CRITICAL(&storageLock);
+    storage_fs_stats_t stats = fsStats;
+    portEXIT_CRITICAL(&storageLock);
+    return stats;
+}
+
+int StorageManager::snapshotFiles(storage_file_entry_t *out)
+{
+    portENTER_CRITICAL(&storageLock);
+    int count = fileCount;
+    memcpy(out, files, count * sizeof(storage_file_entry_t));
+    portEXIT_CRITICAL(&storageLock);
+    return count;
+}
+
+void StorageManager::reportFiles(JsonObject out)
+{
+    storage_file_entry_t copy[STORAGE_MAX_FILES];
+    int                  count = snapshotFiles(copy);
+
+    // Average since boot; the last full hour shows the current rate
+    uint64_t uptimeS = max((uint64_t) 1, (uint64_t) (esp_timer_get_time() / 1000000LL));
+
+    // Paths never change once tracked, so the table's copies can be referenced
+    for (int i = 0; i < count; i++)
+    {
+        JsonObject file         = out.createNestedObject((const char *) files[i].path);
+        file["size_bytes"]      = copy[i].size;
+        file["quota_bytes"]     = copy[i].quota;
+        file["bytes_written"]   = copy[i].bytesWritten;
+        file["bytes_last_hour"] = copy[i].bytesLastHour;
+        file["bytes_per_hour"]  = (uint32_t) (copy[i].bytesWritten * 3600 / uptimeS);
+    }
+}
+
+uint32_t StorageManager::getVersion()
+{
+    return version;
+}
@@ -0,0 +1,111 @@
+#ifndef STORAGE_MANAGER_H
+#define STORAGE_MANAGER_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <LittleFS.h>
+
+#define STORAGE_MAX_FILES 12
+#define STORAGE_PATH_LEN 32
+
+// LittleFS has to walk its block map to count used space. The figure is refreshed from
+// loop() this long after a write, and at least every STORAGE_FS_REFRESH_MS regardless.
+#define STORAGE_FS_DIRTY_REFRESH_MS 5000
+#define STORAGE_FS_REFRESH_MS 60000
+#define STORAGE_MAINTENANCE_INTERVAL_MS 1000
+
+#define STORAGE_WEAR_WINDOW_MS 3600000UL
+
+#define STORAGE_FILE_NONE -1
+
+// Handle to a tracked file, returned by track()
+typedef int storage_file_t;
+
+typedef struct
+{
+    char     path[STORAGE_PATH_LEN];
+    size_t   size;
+    size_t   quota;         // 0 if the file has no limit
+    uint64_t bytesWritten;  // Since boot, for flash wear estimates
+    uint32_t bytesThisHour;
+    uint32_t bytesLastHour;
+} storage_file_entry_t;
+
+typedef struct
+{
+    size_t        totalBytes;
+    size_t        usedBytes;
+    unsigned long sampledAt;  // timeBase.nowMs() of the last refresh
+} storage_fs_stats_t;
+
+// Owns the LittleFS mount and keeps the size of every file a store writes in RAM. Stores
+// register their file once with track() and report each write with addFileBytes() or
+// setFileSize(), so size and quota checks are memory reads rather than an open/stat/close.
+// The same reports add up the bytes each file has put on flash, per hour and since boot.
+// Sizes are stat'ed once when the file is tracked (or at mount, for files tracked before
+// it). Stores write from the main loop and from request handlers, so the table is
+// guarded by a spinlock.
+class StorageManager
+{
+   private:
+    storage_file_entry_t files[STORAGE_MAX_FILES];
+    int                  fileCount;
+    bool                 mounted;
+    storage_fs_stats_t   fsStats;
+    bool                 fsStatsDirty;
+    uint32_t             version;  // Bumped whenever a size or the totals change
+    unsigned long        wearWindowStart;
+    portMUX_TYPE         storageLock;
+
+    StorageManager();
+
+    // Delete copy constructor and assignment operator
+    StorageManager(const StorageManager &)            = delete;
+    StorageManager &operator=(const StorageManager &) = delete;
+
+    size_t statFile(const char *path);
+    void   refreshFsStats();
+    bool   isValid(storage_file_t file);
+
+   public:
+    // Singleton access method
+    static StorageManager &getInstance();
+
+    // Mount LittleFS, formatting it if the mount fails, and schedule loop() as a job;
+    // call once from setup()
+    bool begin();
+    // Refresh the filesystem totals and roll the wear window when they're due
+    void loop();
+    bool isMounted();
+
+    // Start tracking path (at most STORAGE_MAX_FILES files), or return its existing handle.
+    // quota is the size the store keeps the file under; 0 for none.
+    storage_file_t track(const char *path, size_t quota = 0);
+
+    size_t getFileSize(storage_file_t file);
+    size_t getQuota(storage_file_t file);
+    bool   isOverQuota(storage_file_t file);
+
+    // Record a write: the file's new size after truncating it, or bytes appended to it.
+    // Pass written = false when only correcting the tracked size.
+    void setFileSize(storage_file_t file, size_t size, bool written = true);
+    void addFileBytes(storage_file_t file, size_t bytes);
+
+    // Delete the file and zero its tracked size
+    bool removeFile(storage_file_t file);
+    bool removeFile(const char *path);
+
+    // Totals as of the last refresh
+    storage_fs_stats_t getFsStats();
+
+    void     reportFiles(JsonObject out);
+    uint32_t getVersion();
+
+    // Copy the table into out (STORAGE_MAX_FILES long); returns the count
+    int snapshotFiles(storage_file_entry_t *out);
+};
+
+// Convenience macro for easier access
+#define storageManager StorageManager::getInstance()
+
+#endif  // STORAGE_MANAGER_H
@@ -0,0 +1,77 @@
+#ifndef STORAGE_VIEW_PAGE_H
+#define STORAGE_VIEW_PAGE_H
+
+#include <Arduino.h>
+
+// /storage/view, streamed through the async template processor straight from flash.
+// %NAME% placeholders are filled per request; a literal percent sign is written %%.
+static const char STORAGE_VIEW_HTML[] PROGMEM = R"rawliteral(<!DOCTYPE html><html><head>
+<title>System Health - Storage Information</title>
+<style>
+body { font-family: Arial, sans-serif; margin: 20px; background: #f5f5f5; }
+.container { max-width: 600px; margin: 0 auto; background: white; padding: 20px; border-radius: 8px; box-shadow: 0 2px 4px rgba(0,0,0,0.1); }
+h1 { color: #333; text-align: center; }
+.storage-item { margin: 15px 0; padding: 10px; background: #f8f9fa; border-radius: 4px; }
+.storage-label { font-weight: bold; color: #555; }
+.storage-value { color: #007bff; font-size: 1.1em; }
+.progress-bar { width: 100%%; height: 20px; background: #e9ecef; border-radius: 10px; overflow: hidden; margin: 5px 0; }
+.progress-fill { height: 100%%; background: linear-gradient(90deg, #28a745, #ffc107, #dc3545); transition: width 0.3s; }
+.log-progress { background: linear-gradient(90deg, #17a2b8, #6f42c1); }
+.nav-link { display: inline-block; margin: 10px 5px; padding: 8px 15px; background: #007bff; color: white; text-decoration: none; border-radius: 4px; }
+.nav-link:hover { background: #0056b3; }
+</style></head><body>
+<div class='container'>
+<h1>🖥️ System Health - Storage Information</h1>
+<div style='text-align: center; margin-bottom: 20px;'>
+<a href='/' class='nav-link'>🏠 Home</a>
+<a href='/logs/history' class='nav-link'>📋 View Logs</a>
+<a href='/storage' class='nav-link'>📊 JSON Data</a>
+</div>
+<div class='storage-item'>
+<div class='storage-label'>💾 Filesystem Storage</div>
+<div class='storage-value'>Total: %TOTAL_KB% KB (%TOTAL_BYTES% bytes)</div>
+<div class='storage-value'>Used: %USED_KB% KB (%USED_BYTES% bytes)</div>
+<div class='storage-value'>Free: %FREE_KB% KB (%FREE_BYTES% bytes)</div>
+<div class='progress-bar'>
+<div class='progress-fill' style='width: %USAGE_PERCENT%%%'></div>
+</div>
+<div>Usage: %USAGE_PERCENT%%%</div>
+</div>
+<div class='storage-item'>
+<div class='storage-label'>📝 Log Storage</div>
+<div class='storage-value'>Used: %LOG_KB% KB (%LOG_BYTES% bytes)</div>
+<div class='storage-value'>Limit: 200 KB (204,800 bytes)</div>
+<div class='storage-value'>Available: %LOG_AVAILABLE_KB% KB</div>
+<div class='progress-bar'>
+<div class='progress-fill log-progress' style='width: %LOG_PERCENT%%%'></div>
+</div>
+<div>Log Usage: %LOG_PERCENT%%%</div>
+</div>
+<div class='storage-item'>
+<div class='storage-label'>📁 Storage Breakdown</div>
+<div>• Settings: ~1 KB</div>
+<div>• WebUI Assets: Embedded in firmware</div>
+<div>• Log Files: %LOG_KB% KB</div>
+<div>• Other Files: %OTHER_KB% KB</div>
+<p style='margin-top: 10px; font-size: 0.9em; color: #666;'>• Logs are automatically rotated when they exceed 200KB</p>
+</div>
+<div class='storage-item' style='text-align: center;'>
+<div class='storage-label'>🔧 Actions</div>
+<button onclick='clearLogs()' style='margin: 5px; padding: 8px 15px; background: #dc3545; color: white; border: none; border-radius: 4px; cursor: pointer;'>Clear All Logs</button>
+<button onclick='location.reload()' style='margin: 5px; padding: 8px 15px; background: #28a745; color: white; border: none; border-radius: 4px; cursor: pointer;'>Refresh</button>
+</div>
+</div>
+<script>
+function clearLogs() {
+  if (confirm('Are you sure you want to clear all logs?')) {
+    fetch('/logs/clear', { method: 'POST' })
+      .then(response => response.text())
+      .then(data => { alert(data); location.reload(); })
+      .catch(error => alert('Error: ' + error));
+  }
+}
+</script>
+</body></html>
+)rawliteral";
+
+#endif  // STORAGE_VIEW_PAGE_H
@@ -0,0 +1,415 @@
+#include "SystemMetrics.h"
+
+#include <esp_freertos_hooks.h>
+
+#include "Logger.h"
+
+// Incremented by each core's idle task while it has nothing else to run
+static volatile uint32_t idleCount[SYSTEM_METRICS_CORES];
+
+static bool countIdleCore0()
+{
+    idleCount[0]++;
+    return false;  // Keep being called rather than waiting for the next interrupt
+}
+
+#if SYSTEM_METRICS_CORES > 1
+static bool countIdleCore1()
+{
+    idleCount[1]++;
+    return false;
+}
+#endif
+
+SystemMetrics &SystemMetrics::getInstance()
+{
+    static SystemMetrics instance;
+    return instance;
+}
+
+SystemMetrics::SystemMetrics()
+{
+    sampleTimer        = nullptr;
+    metricsLock        = portMUX_INITIALIZER_UNLOCKED;
+    started            = false;
+    loopMaxUs          = 0;
+    lastLoopStartUs    = 0;
+    loopIdleUs         = 0;
+    lastSampleUs       = 0;
+    idleCalibration    = 0;
+    taskCount          = 0;
+    loopMaxSinceBootUs = 0;
+    heapHistoryIndex   = 0;
+    heapHistoryCount   = 0;
+    memset((void *) loopHistogram, 0, sizeof(loopHistogram));
+    memset(lastLoopHistogram, 0, sizeof(lastLoopHistogram));
+    memset(lastIdleCount, 0, sizeof(lastIdleCount));
+    memset(tasks, 0, sizeof(tasks));
+    memset(&loopMetrics, 0, sizeof(loopMetrics));
+    memset(heapHistory, 0, sizeof(heapHistory));
+    for (int core = 0; core < SYSTEM_METRICS_CORES; core++)
+    {
+        coreUsage[core] = -1;
+    }
+#if configGENERATE_RUN_TIME_STATS
+    lastTotalRunTime = 0;
+    lastTaskCount    = 0;
+#endif
+}
+
+void SystemMetrics::begin()
+{
+    if (started)
+    {
+        return;
+    }
+    started = true;
+
+#if !configGENERATE_RUN_TIME_STATS
+    esp_register_freertos_idle_hook_for_cpu(countIdleCore0, 0);
+#if SYSTEM_METRICS_CORES > 1
+    esp_register_freertos_idle_hook_for_cpu(countIdleCore1, 1);
+#endif
+#endif
+
+    esp_timer_create_args_t args = {};
+    args.callback                = sampleCallback;
+    args.arg                     = this;
+    args.dispatch_method         = ESP_TIMER_TASK;
+    args.name                    = "metrics";
+    if (esp_timer_create(&args, &sampleTimer) != ESP_OK ||
+        esp_timer_start_periodic(sampleTimer, SYSTEM_METRICS_SAMPLE_INTERVAL_MS * 1000ULL) != ESP_OK)
+    {
+        logger.log("Failed to start system metrics sampler");
+        return;
+    }
+    lastSampleUs = esp_timer_get_time();
+}
+
+void SystemMetrics::sampleCallback(void *arg)
+{
+    static_cast<SystemMetrics *>(arg)->sample();
+}
+
+int SystemMetrics::loopBucket(uint32_t us)
+{
+    if (us < LOOP_HISTOGRAM_STEPS_PER_OCTAVE)
+    {
+        return us;
+    }
+    // Octave from the top bit, step from the two bits below it
+    int octave = 31 - __builtin_clz(us);
+    int step   = (us >> (octave - 2)) & (LOOP_HISTOGRAM_STEPS_PER_OCTAVE - 1);
+    int bucket = (octave - 1) * LOOP_HISTOGRAM_STEPS_PER_OCTAVE + step;
+    return min(bucket, LOOP_HISTOGRAM_BUCKETS - 1);
+}
+
+uint32_t SystemMetrics::loopBucketUpperBound(int bucket)
+{
+    if (bucket < LOOP_HISTOGRAM_STEPS_PER_OCTAVE)
+    {
+        return bucket + 1;
+    }
+    int octave = bucket / LOOP_HISTOGRAM_STEPS_PER_OCTAVE + 1;
+    int step   = bucket % LOOP_HISTOGRAM_STEPS_PER_OCTAVE;
+    return ((uint32_t) (LOOP_HISTOGRAM_STEPS_PER_OCTAVE + step + 1)) << (octave - 2);
+}
+
+void SystemMetrics::recordLoopIteration()
+{
+    unsigned long nowUs = micros();
+    if (lastLoopStartUs != 0)
+    {
+        // Runs on every iteration, so no lock: a critical section here would cost more
+        // than most iterations take
+        uint32_t elapsed = nowUs - lastLoopStartUs;
+        elapsed          = elapsed > loopIdleUs ? elapsed - loopIdleUs : 0;
+        loopHistogram[loopBucket(elapsed)]++;
+        if (elapsed > loopMaxUs)
+        {
+            loopMaxUs = elapsed;
+        }
+    }
+    lastLoopStartUs = nowUs;
+    loopIdleUs      = 0;
+}
+
+void SystemMetrics::recordLoopIdle(uint32_t us)
+{
+    loopIdleUs += us;
+}
+
+void SystemMetrics::sample()
+{
+    uint64_t nowUs     = esp_timer_get_time();
+    uint64_t elapsedUs = nowUs - lastSampleUs;
+    lastSampleUs       = nowUs;
+
+    // Static: the esp_timer task's stack is small
+    static TaskStatus_t status[SYSTEM_METRICS_MAX_TASKS];
+    uint32_t            totalRunTime = 0;
+    int count = uxTaskGetSystemState(status, SYSTEM_METRICS_MAX_TASKS, &totalRunTime);
+
+    sampleCores(elapsedUs, status, count, totalRunTime);
+    sampleTasks(status, count, totalRunTime);
+    sampleLoop();
+    sampleHeap();
+}
+
+void SystemMetrics::sampleCores(uint64_t elapsedUs, TaskStatus_t *status, int count,
+                                uint32_t totalRunTime)
+{
+    int8_t usage[SYSTEM_METRICS_CORES];
+
+#if configGENERATE_RUN_TIME_STATS
+    // Busy share is whatever the core's idle task didn't get
+    uint32_t totalDelta = totalRunTime - lastTotalRunTime;
+    for (int core = 0; core < SYSTEM_METRICS_CORES; core++)
+    {
+        usage[core]       = -1;
+        TaskHandle_t idle = xTaskGetIdleTaskHandleForCPU(core);
+        for (int i = 0; i < count && totalDelta > 0; i++)
+        {
+            if (status[i].xHandle != idle)
+            {
+                continue;
+            }
+            for (int j = 0; j < lastTaskCount; j++)
+            {
+                if (lastTaskHandles[j] == idle)
+                {
+                    uint32_t idleDelta = status[i].ulRunTimeCounter - lastTaskRunTime[j];
+                    usage[core]        = 100 - min(100U, idleDelta * 100 / totalDelta);
+                }
+            }
+        }
+    }
+#else
+    float    seconds = elapsedUs / 1000000.0f;
+    uint32_t deltas[SYSTEM_METRICS_CORES];
+    for (int core = 0; core < SYSTEM_METRICS_CORES; core++)
+    {
+        uint32_t current    = idleCount[core];
+        deltas[core]        = current - lastIdleCount[core];
+        lastIdleCount[core] = current;
+        if (seconds > 0)
+        {
+            idleCalibration = max(idleCalibration, deltas[core] / seconds);
+        }
+    }
+    for (int core = 0; core < SYSTEM_METRICS_CORES; core++)
+    {
+        if (idleCalibration <= 0 || seconds <= 0)
+        {
+            usage[core] = -1;
+            continue;
+        }
+        float idleShare = deltas[core] / seconds / idleCalibration;
+        usage[core]     = (int8_t) (100 - constrain((int) (idleShare * 100 + 0.5f), 0, 100));
+    }
+#endif
+
+    portENTER_CRITICAL(&metricsLock);
+    memcpy(coreUsage, usage, sizeof(coreUsage));
+    portEXIT_CRITICAL(&metricsLock);
+}
+
+void SystemMetrics::sampleTasks(TaskStatus_t *status, int count, uint32_t totalRunTime)
+{
+    task_metrics_t snapshot[SYSTEM_METRICS_MAX_TASKS];
+
+#if configGENERATE_RUN_TIME_STATS
+    uint32_t totalDelta = totalRunTime - lastTotalRunTime;
+#endif
+
+    for (int i = 0; i < count; i++)
+    {
+        task_metrics_t &task = snapshot[i];
+        strlcpy(task.name, status[i].pcTaskName, sizeof(task.name));
+        task.priority       = status[i].uxCurrentPriority;
+        task.stackFreeBytes = status[i].usStackHighWaterMark * sizeof(StackType_t);
+#if configTASKLIST_INCLUDE_COREID
+        task.core = status[i].xCoreID == tskNO_AFFINITY ? -1 : status[i].xCoreID;
+#else
+        task.core = -1;
+#endif
+        task.cpuPercent = TASK_CPU_UNKNOWN;
+#if configGENERATE_RUN_TIME_STATS
+        for (int j = 0; j < lastTaskCount && totalDelta > 0; j++)
+        {
+            if (lastTaskHandles[j] == status[i].xHandle)
+            {
+                uint32_t delta  = status[i].ulRunTimeCounter - lastTaskRunTime[j];
+                task.cpuPercent = min(100U, delta * 100 / totalDelta);
+            }
+        }
+#endif
+    }
+
+#if configGENERATE_RUN_TIME_STATS
+    for (int i = 0; i < count; i++)
+    {
+        lastTaskHandles[i] = status[i].xHandle;
+        lastTaskRunTime[i] = status[i].ulRunTimeCounter;
+    }
+    lastTaskCount    = count;
+    lastTotalRunTime = totalRunTime;
+#endif
+
+    portENTER_CRITICAL(&metricsLock);
+    memcpy(tasks, snapshot, count * sizeof(task_metrics_t));
+    taskCount = count;
+    portEXIT_CRITICAL(&metricsLock);
+}
+
+void SystemMetrics::sampleLoop()
+{
+    // This interval's counts, as the difference from the previous sample
+    uint32_t histogram[LOOP_HISTOGRAM_BUCKETS];
+    uint32_t iterations = 0;
+    for (int bucket = 0; bucket < LOOP_HISTOGRAM_BUCKETS; bucket++)
+    {
+        uint32_t current          = loopHistogram[bucket];
+        histogram[bucket]         = current - lastLoopHistogram[bucket];
+        lastLoopHistogram[bucket] = current;
+        iterations += histogram[bucket];
+    }
+    uint32_t maxUs = loopMaxUs;
+    loopMaxUs      = 0;
+
+    loop_metrics_t metrics = {0, 0, maxUs, iterations};
+    uint32_t       counted = 0;
+    for (int bucket = 0; bucket < LOOP_HISTOGRAM_BUCKETS && iterations > 0; bucket++)
+    {
+        counted += histogram[bucket];
+        if (metrics.p50Us == 0 && counted * 2 >= iterations)
+        {
+            metrics.p50Us = min(loopBucketUpperBound(bucket), maxUs);
+        }
+        if (metrics.p99Us == 0 && counted * 100 >= iterations * 99)
+        {
+            metrics.p99Us = min(loopBucketUpperBound(bucket), maxUs);
+        }
+    }
+
+    portENTER_CRITICAL(&metricsLock);
+    loopMetrics        = metrics;
+    loopMaxSinceBootUs = max(loopMaxSinceBootUs, maxUs);
+    portEXIT_CRITICAL(&metricsLock);
+}
+
+void SystemMetrics::sampleHeap()
+{
+    heap_sample_t sample;
+    sample.freeKb         = ESP.getFreeHeap() / 1024;
+    sample.largestBlockKb = ESP.getMaxAllocHeap() / 1024;
+
+    portENTER_CRITICAL(&metricsLock);
+    heapHistory[heapHistoryIndex] = sample;
+    heapHistoryIndex              = (heapHistoryIndex + 1) % SYSTEM_METRICS_HEAP_HISTORY;
+    heapHistoryCount              = min(heapHistoryCount + 1, SYSTEM_METRICS_HEAP_HISTORY);
+    portEXIT_CRITICAL(&metricsLock);
+}
+
+void SystemMetrics::reportCpu(JsonObject out)
+{
+    int8_t         usage[SYSTEM_METRICS_CORES];
+    task_metrics_t snapshot[SYSTEM_METRICS_MAX_TASKS];
+    int            count;
+
+    portENTER_CRITICAL(&metricsLock);
+    memcpy(usage, coreUsage, sizeof(usage));
+    count = taskCount;
+    memcpy(snapshot, tasks, count * sizeof(task_metrics_t));
+    portEXIT_CRITICAL(&metricsLock);
+
+    out["usage_source"] = configGENERATE_RUN_TIME_STATS ? "runtime_stats" : "idle_hook";
+    JsonArray cores     = out.createNestedArray("core_usage_percent");
+    for (int core = 0; core < SYSTEM_METRICS_CORES; core++)
+    {
+        if (usage[core] < 0)
+        {
+            cores.add(nullptr);  // Not measured yet
+        }
+        else
+        {
+            cores.add(usage[core]);
+        }
+    }
+
+    JsonArray list = out.createNestedArray("tasks");
+    for (int i = 0; i < count; i++)
+    {
+        JsonObject task          = list.createNestedObject();
+        task["name"]             = snapshot[i].name;  // Copied: the snapshot is local
+        task["priority"]         = snapshot[i].priority;
+        task["core"]             = snapshot[i].core;
+        task["stack_free_bytes"] = snapshot[i].stackFreeBytes;
+        if (snapshot[i].cpuPercent != TASK_CPU_UNKNOWN)
+        {
+            task["cpu_percent"] = snapshot[i].cpuPercent;
+        }
+    }
+}
+
+void SystemMetrics::reportLoop(JsonObject out)
+{
+    portENTER_CRITICAL(&metricsLock);
+    loop_metrics_t metrics   = loopMetrics;
+    uint32_t       maxEverUs = loopMaxSinceBootUs;
+    portEXIT_CRITICAL(&metricsLock);
+
+    out["p50_us"]            = metrics.p50Us;
+    out["p99_us"]            = metrics.p99Us;
+    out["max_us"]            = metrics.maxUs;
+    out["iterations_per_s"]  = metrics.iterations / (SYSTEM_METRICS_SAMPLE_INTERVAL_MS / 1000);
+    out["max_since_boot_us"] = maxEverUs;
+    out["interval_s"]        = SYSTEM_METRICS_SAMPLE_INTERVAL_MS / 1000;
+}
+
+int SystemMetrics::getCoreUsage(int core)
+{
+    if (core < 0 || core >= SYSTEM_METRICS_CORES)
+    {
+        return -1;
+    }
+    return coreUsage[core];
+}
+
+loop_metrics_t SystemMetrics::getLoopMetrics()
+{
+    portENTER_CRITICAL(&metricsLock);
+    loop_metrics_t metrics = loopMetrics;
+    portEXIT_CRITICAL(&metricsLock);
+    return metrics;
+}
+
+void SystemMetrics::reportHeap(JsonObject out)
+{
+    heap_sample_t history[SYSTEM_METRICS_HEAP_HISTORY];
+    int           count;
+    int           index;
+
+    portENTER_CRITICAL(&metricsLock);
+    memcpy(history, heapHistory, sizeof(history));
+    count = heapHistoryCount;
+    index = heapHistoryIndex;
+    portEXIT_CRITICAL(&metricsLock);
+
+    // Fragmentation: how much of the free heap can't be had in one allocation
+    size_t freeHeap              = ESP.getFreeHeap();
+    size_t largest               = ESP.getMaxAllocHeap();
+    out["fragmentation_percent"] = freeHeap > 0 ? 100 - (int) (largest * 100 / freeHeap) : 0;
+    out["interval_s"]            = SYSTEM_METRICS_SAMPLE_INTERVAL_MS / 1000;
+
+    // Oldest first
+    JsonArray freeKb    = out.createNestedArray("free_kb");
+    JsonArray largestKb = out.createNestedArray("largest_free_block_kb");
+    int start = (index - count + SYSTEM_METRICS_HEAP_HISTORY) % SYSTEM_METRICS_HEAP_HISTORY;
+    for (int i = 0; i < count; i++)
+    {
+        const heap_sample_t &sample = history[(start + i) % SYSTEM_METRICS_HEAP_HISTORY];
+        freeKb.add(sample.freeKb);
+        largestKb.add(sample.largestBlockKb);
+    }
+}
@@ -0,0 +1,140 @@
+#ifndef SYSTEM_METRICS_H
+#define SYSTEM_METRICS_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <esp_timer.h>
+
+#define SYSTEM_METRICS_SAMPLE_INTERVAL_MS 10000
+#define SYSTEM_METRICS_MAX_TASKS 24
+#define SYSTEM_METRICS_HEAP_HISTORY 60  // 10 minutes at the sample interval
+#define SYSTEM_METRICS_CORES portNUM_PROCESSORS
+
+// Loop iteration times are bucketed on a log scale with this many buckets per doubling,
+// so percentiles are accurate to within a quarter of their value
+#define LOOP_HISTOGRAM_STEPS_PER_OCTAVE 4
+#define LOOP_HISTOGRAM_OCTAVES 24  // Up to ~16 s
+#define LOOP_HISTOGRAM_BUCKETS (LOOP_HISTOGRAM_STEPS_PER_OCTAVE * LOOP_HISTOGRAM_OCTAVES)
+
+// Document size reportCpu(), reportLoop() and reportHeap() need together
+#define SYSTEM_METRICS_JSON_SIZE                                                       \
+    (JSON_OBJECT_SIZE(4) + JSON_ARRAY_SIZE(SYSTEM_METRICS_CORES) +                     \
+     JSON_ARRAY_SIZE(SYSTEM_METRICS_MAX_TASKS) +                                       \
+     SYSTEM_METRICS_MAX_TASKS * JSON_OBJECT_SIZE(5) + JSON_OBJECT_SIZE(6) +            \
+     JSON_OBJECT_SIZE(5) + 2 * JSON_ARRAY_SIZE(SYSTEM_METRICS_HEAP_HISTORY) +          \
+     SYSTEM_METRICS_MAX_TASKS * configMAX_TASK_NAME_LEN)
+
+#define TASK_CPU_UNKNOWN 0xFF
+
+typedef struct
+{
+    char     name[configMAX_TASK_NAME_LEN];
+    uint8_t  priority;
+    int8_t   core;            // -1 if the task may run on either core
+    uint8_t  cpuPercent;      // Share of one core over the last interval, or TASK_CPU_UNKNOWN
+    uint32_t stackFreeBytes;  // Least free stack the task has ever had
+} task_metrics_t;
+
+typedef struct
+{
+    uint32_t p50Us;
+    uint32_t p99Us;
+    uint32_t maxUs;
+    uint32_t iterations;  // In the last interval
+} loop_metrics_t;
+
+typedef struct
+{
+    uint16_t freeKb;
+    uint16_t largestBlockKb;
+} heap_sample_t;
+
+// Background view of where CPU time and heap go. Sampled every
+// SYSTEM_METRICS_SAMPLE_INTERVAL_MS from an esp_timer callback into fixed buffers, so
+// /system_health only copies the last snapshot out.
+//
+// Per-core utilization and per-task shares come from the FreeRTOS run-time counters when
+// the framework is built with configGENERATE_RUN_TIME_STATS. The stock Arduino core is
+// not, so utilization then falls back to idle hooks: each core's idle task counts how
+// often it gets to run, and the highest rate seen on any core is taken as 100% idle.
+// Per-task shares are unavailable in that mode. Registering the hooks keeps the idle
+// tasks spinning instead of waiting for an interrupt, so the chip draws a little more.
+class SystemMetrics
+{
+   private:
+    esp_timer_handle_t sampleTimer;
+    portMUX_TYPE       metricsLock;
+    bool               started;
+
+    // Written by loop() without locking: the counts only ever grow and the sampler works
+    // from the difference to its previous copy. A maximum that lands while the sampler
+    // resets it may be dropped.
+    volatile uint32_t loopHistogram[LOOP_HISTOGRAM_BUCKETS];
+    volatile uint32_t loopMaxUs;
+    unsigned long     lastLoopStartUs;
+    uint32_t          loopIdleUs;  // Slept since the last iteration started, not counted
+
+    // Sampler state
+    uint32_t lastLoopHistogram[LOOP_HISTOGRAM_BUCKETS];
+    uint64_t lastSampleUs;
+    uint32_t lastIdleCount[SYSTEM_METRICS_CORES];
+    float    idleCalibration;  // Idle hook calls per second on an otherwise idle core
+#if configGENERATE_RUN_TIME_STATS
+    uint32_t     lastTotalRunTime;
+    TaskHandle_t lastTaskHandles[SYSTEM_METRICS_MAX_TASKS];
+    uint32_t     lastTaskRunTime[SYSTEM_METRICS_MAX_TASKS];
+    int          lastTaskCount;
+#endif
+
+    // Published snapshot
+    int8_t         coreUsage[SYSTEM_METRICS_CORES];  // -1 until known
+    task_metrics_t tasks[SYSTEM_METRICS_MAX_TASKS];
+    int            taskCount;
+    loop_metrics_t loopMetrics;
+    uint32_t       loopMaxSinceBootUs;
+    heap_sample_t  heapHistory[SYSTEM_METRICS_HEAP_HISTORY];
+    int            heapHistoryIndex;
+    int            heapHistoryCount;
+
+    SystemMetrics();
+
+    // Delete copy constructor and assignment operator
+    SystemMetrics(const SystemMetrics &)            = delete;
+    SystemMetrics &operator=(const SystemMetrics &) = delete;
+
+    static void sampleCallback(void *arg);
+    void        sample();
+    void        sampleCores(uint64_t elapsedUs, TaskStatus_t *status, int count,
+                            uint32_t totalRunTime);
+    void        sampleTasks(TaskStatus_t *status, int count, uint32_t totalRunTime);
+    void        sampleLoop();
+    void        sampleHeap();
+
+    static int      loopBucket(uint32_t us);
+    static uint32_t loopBucketUpperBound(int bucket);
+
+   public:
+    // Singleton access method
+    static SystemMetrics &getInstance();
+
+    // Start the background sampler; call once from setup()
+    void begin();
+
+    // Call at the top of every loop(); records the time since the previous call
+    void recordLoopIteration();
+    // Call from the loop after sleeping, so the sleep isn't counted as iteration time
+    void recordLoopIdle(uint32_t us);
+
+    void reportCpu(JsonObject out);
+    void reportLoop(JsonObject out);
+    void reportHeap(JsonObject out);
+
+    // Utilization of a core over the last interval in percent, -1 until measured
+    int            getCoreUsage(int core);
+    loop_metrics_t getLoopMetrics();
+};
+
+// Convenience macro for easier access
+#define systemMetrics SystemMetrics::getInstance()
+
+#endif  // SYSTEM_METRICS_H
@@ -0,0 +1,111 @@
+#include "TimeBase.h"
+
+#include <esp_timer.h>
+#include <sys/time.h>
+
+TimeBase &TimeBase::getInstance()
+{
+    static TimeBase instance;
+    return instance;
+}
+
+TimeBase::TimeBase()
+{
+    epochOffsetUs = 0;
+    synced        = false;
+    syncCount     = 0;
+    offsetLock    = portMUX_INITIALIZER_UNLOCKED;
+}
+
+uint64_t TimeBase::monotonicUs()
+{
+    return (uint64_t) esp_timer_get_time();
+}
+
+unsigned long TimeBase::nowMs()
+{
+    return (unsigned long) (monotonicUs() / 1000ULL);
+}
+
+uint64_t TimeBase::now()
+{
+    return resolve(monotonicUs());
+}
+
+void TimeBase::syncFromSystemClock()
+{
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+    uint64_t epochUs = (uint64_t) tv.tv_sec * 1000000ULL + tv.tv_usec;
+    if (!isEpoch(epochUs))
+    {
+        // SNTP hasn't set the clock yet
+        return;
+    }
+
+    uint64_t offset = epochUs - monotonicUs();
+    portENTER_CRITICAL(&offsetLock);
+    epochOffsetUs = offset;
+    synced        = true;
+    syncCount++;
+    portEXIT_CRITICAL(&offsetLock);
+}
+
+bool TimeBase::isSynced()
+{
+    return synced;
+}
+
+uint32_t TimeBase::getSyncCount()
+{
+    return syncCount;
+}
+
+bool TimeBase::isEpoch(uint64_t stamp)
+{
+    return stamp >= TIMEBASE_EPOCH_MIN_US;
+}
+
+uint64_t TimeBase::resolve(uint64_t stamp)
+{
+    if (stamp == 0 || isEpoch(stamp))
+    {
+        return stamp;
+    }
+
+    portENTER_CRITICAL(&offsetLock);
+    bool     haveOffset = synced;
+    uint64_t offset     = epochOffsetUs;
+    portEXIT_CRITICAL(&offsetLock);
+
+    return haveOffset ? stamp + offset : stamp;
+}
+
+unsigned long TimeBase::toSeconds(uint64_t stamp)
+{
+    return (unsigned long) (resolve(stamp) / 1000000ULL);
+}
+
+unsigned long TimeBase::toPersistedSeconds(uint64_t stamp)
+{
+    uint64_t resolved = resolve(stamp);
+    return isEpoch(resolved) ? (unsigned long) (resolved / 1000000ULL) : 0;
+}
+
+uint64_t TimeBase::fromPersistedSeconds(unsigned long seconds)
+{
+    uint64_t stamp = (uint64_t) seconds * 1000000ULL;
+    // Anything else is a monotonic value from an earlier boot and can't be placed
+    return isEpoch(stamp) ? stamp : 0;
+}
+
+uint64_t TimeBase::toPersistedUs(uint64_t stamp)
+{
+    uint64_t resolved = resolve(stamp);
+    return isEpoch(resolved) ? resolved : 0;
+}
+
+uint64_t TimeBase::fromPersistedUs(uint64_t persisted)
+{
+    return isEpoch(persisted) ? persisted : 0;
+}
@@ -0,0 +1,65 @@
+#ifndef TIME_BASE_H
+#define TIME_BASE_H
+
+#include <Arduino.h>
+
+// Anything at or above this (2020-01-01 in µs) is an epoch time; anything below is
+// microseconds since this boot.
+#define TIMEBASE_EPOCH_MIN_US (1577836800ULL * 1000000ULL)
+
+// Single clock for the whole firmware. Stamps are taken from the monotonic esp_timer
+// and stored as-is; once NTP syncs, an epoch offset is recorded and stamps from before
+// the sync are mapped onto wall-clock time when they are read. A stamp of 0 means
+// "unknown time" (e.g. a pre-sync stamp persisted by a previous boot).
+class TimeBase
+{
+   private:
+    uint64_t     epochOffsetUs;  // Epoch µs minus monotonic µs, valid when synced
+    bool         synced;
+    uint32_t     syncCount;  // Pre-sync stamps render differently after every sync
+    portMUX_TYPE offsetLock;
+
+    TimeBase();
+
+    // Delete copy constructor and assignment operator
+    TimeBase(const TimeBase &)            = delete;
+    TimeBase &operator=(const TimeBase &) = delete;
+
+   public:
+    // Singleton access method
+    static TimeBase &getInstance();
+
+    // Microseconds since boot, never goes backwards
+    uint64_t monotonicUs();
+    // Milliseconds since boot, wraps like millis() so unsigned differences stay valid
+    unsigned long nowMs();
+
+    // Stamp for a new record: epoch µs once synced, monotonic µs before
+    uint64_t now();
+
+    // Record the epoch offset from the system clock; call after every NTP sync
+    void syncFromSystemClock();
+    bool isSynced();
+    uint32_t getSyncCount();
+
+    // Map a stamp onto the best clock available now. Pre-sync stamps from this boot
+    // become epoch µs once synced; before that they stay monotonic, which still compares
+    // correctly against now().
+    uint64_t resolve(uint64_t stamp);
+    // resolve() in whole seconds, for JSON responses
+    unsigned long toSeconds(uint64_t stamp);
+    // Epoch seconds for writing to flash, 0 if the stamp can't be placed on the wall clock
+    unsigned long toPersistedSeconds(uint64_t stamp);
+    // Inverse of toPersistedSeconds() when loading
+    uint64_t fromPersistedSeconds(unsigned long seconds);
+    // Full-resolution variants for binary records
+    uint64_t toPersistedUs(uint64_t stamp);
+    uint64_t fromPersistedUs(uint64_t persisted);
+
+    static bool isEpoch(uint64_t stamp);
+};
+
+// Convenience macro for easier access
+#define timeBase TimeBase::getInstance()
+
+#endif  // TIME_BASE_H
@@ -1,153 +1,193 @@
 #include "TimeSeriesData.h"
+#include "FlushScheduler.h"
 #include "Logger.h"
-
-extern unsigned long getTime();
+#include "MemoryPolicy.h"
+#include "TimeBase.h"
 
 TimeSeriesData::TimeSeriesData(const String& filePath) : 
     dataFilePath(filePath), 
     currentIndex(0), 
     totalPoints(0), 
-    isCircularBuffer(false) {
+    isCircularBuffer(false),
+    loaded(false),
+    version(0) {
     
-    dataBuffer = new DataPoint[MAX_POINTS_PER_SERIES];
-    loadDataFromFile();
+    dataFile = storageManager.track(dataFilePath.c_str(), MAX_DATA_SIZE);
+    // The file is a full rewrite of the recent window, so coalesce as much as possible
+    flushStore = flushScheduler.registerStore(dataFilePath.c_str(), FLUSH_LAZY,
+                                              [this]() { writeDataToFile(); });
+    
+    // Size the ring for 24 h of samples when PSRAM is present, falling back to the
+    // internal-heap ring if the large allocation can't be satisfied
+    capacity = memoryPolicy.scaleCapacity(INTERNAL_POINTS_PER_SERIES, PSRAM_POINTS_PER_SERIES);
+    dataBuffer = (DataPoint*) memoryPolicy.allocate(capacity * sizeof(DataPoint), ALLOC_HISTORY);
+    if (dataBuffer == nullptr && capacity > INTERNAL_POINTS_PER_SERIES) {
+        capacity = INTERNAL_POINTS_PER_SERIES;
+        dataBuffer = (DataPoint*) memoryPolicy.allocate(capacity * sizeof(DataPoint), ALLOC_HISTORY);
+    }
+    if (dataBuffer == nullptr) {
+        capacity = 0;
+        logger.logf("Failed to allocate history buffer for %s", dataFilePath.c_str());
+        return;
+    }
+    
+    // The file is read by load(), off the boot critical path
 }
 
 TimeSeriesData::~TimeSeriesData() {
-    writeDataToFile();
-    delete[] dataBuffer;
+    // Writing before the file was read would replace it with the few points taken since boot
+    if (loaded) writeDataToFile();
+    memoryPolicy.release(dataBuffer, ALLOC_HISTORY);
+}
+
+DataPoint& TimeSeriesData::pointAt(size_t age) {
+    size_t startIndex = isCircularBuffer ? currentIndex : 0;
+    return dataBuffer[(startIndex + age) % capacity];
 }
 
 void TimeSeriesData::addDataPoint(float value) {
-    addDataPoint(getTime(), value);
+    addDataPoint(timeBase.now(), value);
 }
 
-void TimeSeriesData::addDataPoint(unsigned long timestamp, float value) {
+void TimeSeriesData::load() {
+    if (loaded) return;
+    loaded = true;
     if (dataBuffer == nullptr) return;
     
+    loadDataFromFile();
+    version++;
+}
+
+bool TimeSeriesData::isLoaded() {
+    return loaded;
+}
+
+void TimeSeriesData::addDataPoint(uint64_t timestamp, float value) {
+    if (dataBuffer == nullptr) return;
+    // The persisted points go in first, so a write before the deferred load can't reorder them
+    load();
+    
     dataBuffer[currentIndex] = {timestamp, value};
     
     if (!isCircularBuffer) {
         totalPoints++;
         currentIndex++;
         
-        if (currentIndex >= MAX_POINTS_PER_SERIES) {
+        if (currentIndex >= capacity) {
             isCircularBuffer = true;
             currentIndex = 0;
-            totalPoints = MAX_POINTS_PER_SERIES;
+            totalPoints = capacity;
         }
     } else {
-        currentIndex = (currentIndex + 1) % MAX_POINTS_PER_SERIES;
+        currentIndex = (currentIndex + 1) % capacity;
     }
+    version++;
     
-    // Write to file periodically (every 10 points to reduce wear)
-    if (totalPoints % 10 == 0) {
-        writeDataToFile();
-        
-        // Check if we need to rotate data to stay under size limit
-        if (getDataSize() > MAX_DATA_SIZE) {
-            // If over limit, reduce data points and rewrite
-            if (isCircularBuffer && totalPoints > 500) {
-                // Keep only the most recent 500 points when over size limit
-                totalPoints = 500;
-                writeDataToFile();
-            }
-        }
-    }
+    // Rewritten by the flush scheduler on the lazy interval. The file is capped at
+    // MAX_PERSISTED_POINTS, which keeps it well under MAX_DATA_SIZE.
+    flushScheduler.markDirty(flushStore);
 }
 
 void TimeSeriesData::writeDataToFile() {
-    if (!LittleFS.begin()) return;
+    if (dataBuffer == nullptr) return;
+    if (!storageManager.isMounted()) return;
     
-    File file = LittleFS.open(dataFilePath, "w");
-    if (!file) return;
+    // Only the most recent window goes to flash; the rest of a PSRAM ring is RAM-only history
+    size_t pointsToSave = (totalPoints < MAX_PERSISTED_POINTS) ? totalPoints : MAX_PERSISTED_POINTS;
+    size_t firstPoint = totalPoints - pointsToSave;
     
-    DynamicJsonDocument doc(8192);
-    doc["circular"] = isCircularBuffer;
-    doc["currentIndex"] = currentIndex;
-    doc["totalPoints"] = totalPoints;
+    // Built before anything on flash is touched, so running out of memory keeps the old file
+    ScratchJsonDocument doc(JSON_OBJECT_SIZE(2) + JSON_ARRAY_SIZE(pointsToSave) +
+                            pointsToSave * JSON_OBJECT_SIZE(2));
+    if (doc.capacity() == 0) {
+        logger.logf("No memory to save %s, keeping the previous file", dataFilePath.c_str());
+        return;
+    }
+    doc["totalPoints"] = pointsToSave;
     
+    // Points are always saved oldest first
     JsonArray dataArray = doc.createNestedArray("data");
-    
-    size_t pointsToSave = (totalPoints < MAX_POINTS_PER_SERIES) ? totalPoints : MAX_POINTS_PER_SERIES;
-    
-    if (isCircularBuffer) {
-        // Save from currentIndex to end, then from 0 to currentIndex
-        for (size_t i = currentIndex; i < MAX_POINTS_PER_SERIES; i++) {
-            JsonObject point = dataArray.createNestedObject();
-            point["t"] = dataBuffer[i].timestamp;
-            point["v"] = dataBuffer[i].value;
-        }
-        for (size_t i = 0; i < currentIndex; i++) {
-            JsonObject point = dataArray.createNestedObject();
-            point["t"] = dataBuffer[i].timestamp;
-            point["v"] = dataBuffer[i].value;
-        }
-    } else {
-        // Save from 0 to currentIndex
-        for (size_t i = 0; i < currentIndex; i++) {
-            JsonObject point = dataArray.createNestedObject();
-            point["t"] = dataBuffer[i].timestamp;
-            point["v"] = dataBuffer[i].value;
-        }
+    for (size_t i = firstPoint; i < totalPoints; i++) {
+        DataPoint& dataPoint = pointAt(i);
+        JsonObject point = dataArray.createNestedObject();
+        point["t"] = timeBase.toPersistedSeconds(dataPoint.timestamp);
+        point["v"] = dataPoint.value;
+    }
+    if (doc.overflowed()) {
+        logger.logf("History for %s didn't fit its document, keeping the previous file",
+                    dataFilePath.c_str());
+        return;
     }
     
-    serializeJson(doc, file);
+    // Written beside the real file and renamed over it, which replaces it atomically
+    String tempPath = dataFilePath + ".tmp";
+    File file = LittleFS.open(tempPath, "w");
+    if (!file) return;
+    size_t written = serializeJson(doc, file);
     file.close();
+    if (written == 0 || !LittleFS.rename(tempPath, dataFilePath)) {
+        logger.logf("Failed to save %s", dataFilePath.c_str());
+        LittleFS.remove(tempPath);
+        return;
+    }
+    storageManager.setFileSize(dataFile, written);
 }
 
 void TimeSeriesData::loadDataFromFile() {
-    if (!LittleFS.begin()) return;
+    if (!storageManager.isMounted()) return;
     
     File file = LittleFS.open(dataFilePath, "r");
     if (!file) return;
     
-    DynamicJsonDocument doc(8192);
+    ScratchJsonDocument doc(JSON_OBJECT_SIZE(4) + JSON_ARRAY_SIZE(MAX_PERSISTED_POINTS) +
+                            MAX_PERSISTED_POINTS * JSON_OBJECT_SIZE(2));
     DeserializationError error = deserializeJson(doc, file);
     file.close();
     
     if (error) return;
     
-    isCircularBuffer = doc["circular"] | false;
-    currentIndex = doc["currentIndex"] | 0;
-    totalPoints = doc["totalPoints"] | 0;
-    
+    // The file holds points oldest first, so they fill the ring from the start
     JsonArray dataArray = doc["data"];
     size_t arrayIndex = 0;
     
     for (JsonObject point : dataArray) {
-        if (arrayIndex >= MAX_POINTS_PER_SERIES) break;
+        if (arrayIndex >= capacity) break;
         
-        dataBuffer[arrayIndex].timestamp = point["t"];
+        dataBuffer[arrayIndex].timestamp = timeBase.fromPersistedSeconds(point["t"]);
         dataBuffer[arrayIndex].value = point["v"];
         arrayIndex++;
     }
+    
+    totalPoints = arrayIndex;
+    isCircularBuffer = arrayIndex >= capacity;
+    currentIndex = arrayIndex % capacity;
 }
 
-String TimeSeriesData::getDataAsJSON(size_t maxPoints) {
-    DynamicJsonDocument doc(4096);
-    JsonArray dataArray = doc.createNestedArray("data");
-    
+size_t TimeSeriesData::getDataJsonCapacity(size_t maxPoints) {
     size_t pointsToReturn = (totalPoints < maxPoints) ? totalPoints : maxPoints;
-    size_t step = (totalPoints / pointsToReturn > 1) ? (totalPoints / pointsToReturn) : 1;
+    return JSON_OBJECT_SIZE(1) + JSON_ARRAY_SIZE(pointsToReturn) +
+           pointsToReturn * JSON_OBJECT_SIZE(2);
+}
+
+void TimeSeriesData::writeDataJson(JsonObject out, size_t maxPoints) {
+    size_t pointsToReturn = (totalPoints < maxPoints) ? totalPoints : maxPoints;
+    JsonArray dataArray = out.createNestedArray("data");
     
-    if (isCircularBuffer) {
-        size_t startIndex = (currentIndex + MAX_POINTS_PER_SERIES - pointsToReturn * step) % MAX_POINTS_PER_SERIES;
-        for (size_t i = 0; i < pointsToReturn; i++) {
-            size_t index = (startIndex + i * step) % MAX_POINTS_PER_SERIES;
-            JsonObject point = dataArray.createNestedObject();
-            point["t"] = dataBuffer[index].timestamp;
-            point["v"] = dataBuffer[index].value;
-        }
-    } else {
-        size_t startIndex = ((int)(currentIndex - pointsToReturn * step) > 0) ? (currentIndex - pointsToReturn * step) : 0;
-        for (size_t i = 0; i < pointsToReturn && (startIndex + i * step) < currentIndex; i++) {
-            size_t index = startIndex + i * step;
+    if (pointsToReturn > 0) {
+        // Downsample evenly across the whole ring, ending at the newest point
+        size_t step = (totalPoints / pointsToReturn > 1) ? (totalPoints / pointsToReturn) : 1;
+        for (size_t i = pointsToReturn; i > 0; i--) {
+            DataPoint& dataPoint = pointAt(totalPoints - 1 - (i - 1) * step);
             JsonObject point = dataArray.createNestedObject();
-            point["t"] = dataBuffer[index].timestamp;
-            point["v"] = dataBuffer[index].value;
+            point["t"] = timeBase.toSeconds(dataPoint.timestamp);
+            point["v"] = dataPoint.value;
         }
     }
+}
+
+String TimeSeriesData::getDataAsJSON(size_t maxPoints) {
+    ScratchJsonDocument doc(getDataJsonCapacity(maxPoints));
+    writeDataJson(doc.to<JsonObject>(), maxPoints);
     
     String result;
     serializeJson(doc, result);
@@ -155,28 +195,27 @@ String TimeSeriesData::getDataAsJSON(size_t maxPoints) {
 }
 
 String TimeSeriesData::getRecentData(size_t minutes) {
-    unsigned long cutoffTime = getTime() - (minutes * 60);
+    // Compare resolved stamps so points from before the NTP sync line up with later ones
+    uint64_t now = timeBase.now();
+    uint64_t window = (uint64_t) minutes * 60 * 1000000ULL;
+    uint64_t cutoffTime = now > window ? now - window : 0;
     
-    DynamicJsonDocument doc(4096);
+    // Count first so the document is sized for exactly what is returned
+    size_t firstRecent = totalPoints;
+    while (firstRecent > 0 && timeBase.resolve(pointAt(firstRecent - 1).timestamp) >= cutoffTime) {
+        firstRecent--;
+    }
+    size_t recentPoints = totalPoints - firstRecent;
+    
+    ScratchJsonDocument doc(JSON_OBJECT_SIZE(1) + JSON_ARRAY_SIZE(recentPoints) +
+                            recentPoints * JSON_OBJECT_SIZE(2));
     JsonArray dataArray = doc.createNestedArray("data");
     
-    if (isCircularBuffer) {
-        for (size_t i = 0; i < MAX_POINTS_PER_SERIES; i++) {
-            size_t index = (currentIndex + i) % MAX_POINTS_PER_SERIES;
-            if (dataBuffer[index].timestamp >= cutoffTime) {
-                JsonObject point = dataArray.createNestedObject();
-                point["t"] = dataBuffer[index].timestamp;
-                point["v"] = dataBuffer[index].value;
-            }
-        }
-    } else {
-        for (size_t i = 0; i < currentIndex; i++) {
-            if (dataBuffer[i].timestamp >= cutoffTime) {
-                JsonObject point = dataArray.createNestedObject();
-                point["t"] = dataBuffer[i].timestamp;
-                point["v"] = dataBuffer[i].value;
-            }
-        }
+    for (size_t i = firstRecent; i < totalPoints; i++) {
+        DataPoint& dataPoint = pointAt(i);
+        JsonObject point = dataArray.createNestedObject();
+        point["t"] = timeBase.toSeconds(dataPoint.timestamp);
+        point["v"] = dataPoint.value;
     }
     
     String result;
@@ -184,27 +223,82 @@ String TimeSeriesData::getRecentData(size_t minutes) {
     return result;
 }
 
+void TimeSeriesData::getRange(JsonArray out, uint64_t startStamp, uint64_t endStamp, size_t maxPoints) {
+    if (maxPoints == 0) return;
+    
+    uint64_t start = timeBase.resolve(startStamp);
+    uint64_t end = timeBase.resolve(endStamp);
+    
+    size_t first = totalPoints;
+    size_t inRange = 0;
+    for (size_t i = 0; i < totalPoints; i++) {
+        uint64_t timestamp = timeBase.resolve(pointAt(i).timestamp);
+        if (timestamp >= start && timestamp <= end) {
+            if (first == totalPoints) first = i;
+            inRange++;
+        }
+    }
+    if (inRange == 0) return;
+    
+    // Take every step-th point so the whole window is covered
+    size_t step = (inRange + maxPoints - 1) / maxPoints;
+    size_t taken = 0;
+    for (size_t i = first; i < totalPoints; i++) {
+        DataPoint& dataPoint = pointAt(i);
+        uint64_t timestamp = timeBase.resolve(dataPoint.timestamp);
+        if (timestamp < start || timestamp > end) continue;
+        if (taken++ % step != 0) continue;
+        
+        JsonObject point = out.createNestedObject();
+        point["t"] = timeBase.toSeconds(dataPoint.timestamp);
+        point["v"] = dataPoint.value;
+    }
+}
+
+unsigned long TimeSeriesData::getSince(JsonArray out, unsigned long sinceSeconds, size_t maxPoints) {
+    if (maxPoints == 0 || totalPoints == 0) return sinceSeconds;
+    
+    // The ring is chronological, so walk back from the newest point until the cursor
+    size_t newer = 0;
+    while (newer < totalPoints &&
+           timeBase.toSeconds(pointAt(totalPoints - 1 - newer).timestamp) > sinceSeconds) {
+        newer++;
+    }
+    if (newer == 0) return sinceSeconds;
+    
+    size_t step = (newer + maxPoints - 1) / maxPoints;
+    for (size_t i = (newer - 1) % step; i < newer; i += step) {
+        DataPoint& dataPoint = pointAt(totalPoints - newer + i);
+        JsonObject point = out.createNestedObject();
+        point["t"] = timeBase.toSeconds(dataPoint.timestamp);
+        point["v"] = dataPoint.value;
+    }
+    return timeBase.toSeconds(pointAt(totalPoints - 1).timestamp);
+}
+
 void TimeSeriesData::clearData() {
+    // Nothing left to load
+    loaded = true;
     currentIndex = 0;
     totalPoints = 0;
     isCircularBuffer = false;
+    version++;
     
-    if (LittleFS.begin()) {
-        LittleFS.remove(dataFilePath);
-    }
+    storageManager.removeFile(dataFile);
 }
 
 size_t TimeSeriesData::getDataSize() {
-    if (!LittleFS.begin()) return 0;
-    
-    File file = LittleFS.open(dataFilePath, "r");
-    if (!file) return 0;
-    
-    size_t size = file.size();
-    file.close();
-    return size;
+    return storageManager.getFileSize(dataFile);
 }
 
 size_t TimeSeriesData::getPointCount() {
     return totalPoints;
 }
+
+size_t TimeSeriesData::getCapacity() {
+    return capacity;
+}
+
+uint32_t TimeSeriesData::getVersion() {
+    return version;
+}
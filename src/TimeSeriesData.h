@@ -5,39 +5,70 @@
 #include <LittleFS.h>
 #include <ArduinoJson.h>
 
+#include "FlushScheduler.h"
+#include "StorageManager.h"
+
 struct DataPoint {
-    unsigned long timestamp;
+    uint64_t timestamp; // TimeBase stamp
     float value;
 };
 
 class TimeSeriesData {
 private:
     static const size_t MAX_DATA_SIZE = 150 * 1024; // 150KB per series
-    static const size_t MAX_POINTS_PER_SERIES = 1000; // Limit data points
+    static const size_t INTERNAL_POINTS_PER_SERIES = 1000; // Ring size without PSRAM
+    static const size_t PSRAM_POINTS_PER_SERIES = 24UL * 60 * 60 / 2; // 24 h of 2 s samples
+    static const size_t MAX_PERSISTED_POINTS = 1000; // Most recent points written to flash
     
     String dataFilePath;
+    storage_file_t dataFile;
+    flush_store_t flushStore;
     DataPoint* dataBuffer;
+    size_t capacity;
     size_t currentIndex;
     size_t totalPoints;
     bool isCircularBuffer;
+    bool loaded; // File read into the ring (or cleared)
+    uint32_t version; // Bumped on every change, for response caching
     
     void writeDataToFile();
     void loadDataFromFile();
     void rotateData();
+    DataPoint& pointAt(size_t age); // 0 = oldest retained point
     
 public:
     TimeSeriesData(const String& filePath);
     ~TimeSeriesData();
     
+    // Read the persisted points into the ring. Construction leaves the series empty so boot
+    // doesn't wait on flash; this runs from the deferred boot phase, or from the first
+    // addDataPoint if that comes sooner. Readers see an empty series until then.
+    void load();
+    bool isLoaded();
+    
     void addDataPoint(float value);
-    void addDataPoint(unsigned long timestamp, float value);
+    void addDataPoint(uint64_t timestamp, float value);
     String getDataAsJSON(size_t maxPoints = 100);
+    // Fill out with the "data" array getDataAsJSON returns, in a document of at least
+    // getDataJsonCapacity(maxPoints) bytes
+    void writeDataJson(JsonObject out, size_t maxPoints = 100);
+    size_t getDataJsonCapacity(size_t maxPoints = 100);
     void clearData();
     size_t getDataSize();
     size_t getPointCount();
+    size_t getCapacity();
+    uint32_t getVersion();
     
     // Get recent data points
     String getRecentData(size_t minutes = 60);
+    
+    // Append points stamped within [startStamp, endStamp] to out, downsampled to at most maxPoints
+    void getRange(JsonArray out, uint64_t startStamp, uint64_t endStamp, size_t maxPoints);
+    
+    // Append points newer than sinceSeconds (as reported in "t") to out, downsampled to at
+    // most maxPoints and always ending at the newest one. Returns the newest point's "t",
+    // or sinceSeconds if there is nothing newer, for use as the next cursor.
+    unsigned long getSince(JsonArray out, unsigned long sinceSeconds, size_t maxPoints);
 };
 
 #endif
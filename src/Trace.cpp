@@ -0,0 +1,272 @@
+#include "Trace.h"
+
+#ifdef ENABLE_TRACING
+
+#include <memory>
+
+#include "MemoryPolicy.h"
+
+// State of one /api/trace response, streamed a fragment at a time from a copy of the ring
+class TraceExport
+{
+   private:
+    typedef enum
+    {
+        STAGE_HEADER,
+        STAGE_THREADS,
+        STAGE_EVENTS,
+        STAGE_FOOTER,
+        STAGE_DONE
+    } stage_t;
+
+    trace_event_t *events;
+    size_t         count;
+    size_t         nextEvent;
+    uint32_t       tasks[TRACE_MAX_TASKS];
+    size_t         taskFirstEvent[TRACE_MAX_TASKS];  // Where each task's name comes from
+    int            taskCount;
+    int            nextTask;
+    stage_t        stage;
+    bool           first;
+    char           fragment[192];
+    size_t         fragmentLength;
+    size_t         fragmentPos;
+
+    int  threadId(uint32_t task);
+    bool nextFragment();
+
+   public:
+    TraceExport(trace_event_t *events, size_t count);
+    ~TraceExport();
+
+    size_t fill(uint8_t *buffer, size_t maxLen);
+};
+
+TraceExport::TraceExport(trace_event_t *events, size_t count)
+    : events(events), count(count), nextEvent(0), taskCount(0), nextTask(0),
+      stage(STAGE_HEADER), first(true), fragmentLength(0), fragmentPos(0)
+{
+    // Each task becomes a thread, named after the first of its spans
+    for (size_t i = 0; i < count && taskCount < TRACE_MAX_TASKS; i++)
+    {
+        if (threadId(events[i].task) == 0)
+        {
+            tasks[taskCount]          = events[i].task;
+            taskFirstEvent[taskCount] = i;
+            taskCount++;
+        }
+    }
+}
+
+TraceExport::~TraceExport()
+{
+    memoryPolicy.release(events, ALLOC_TRACE);
+    tracer.finishExport();
+}
+
+int TraceExport::threadId(uint32_t task)
+{
+    for (int i = 0; i < taskCount; i++)
+    {
+        if (tasks[i] == task)
+        {
+            return i + 1;
+        }
+    }
+    return 0;  // Past TRACE_MAX_TASKS; shown together as one thread
+}
+
+bool TraceExport::nextFragment()
+{
+    const char *separator = first ? "" : ",";
+    int         length    = 0;
+    switch (stage)
+    {
+        case STAGE_HEADER:
+            length = snprintf(fragment, sizeof(fragment), "{\"traceEvents\":[");
+            stage  = STAGE_THREADS;
+            break;
+
+        case STAGE_THREADS:
+            if (nextTask >= taskCount)
+            {
+                stage = STAGE_EVENTS;
+                return nextFragment();
+            }
+            length = snprintf(fragment, sizeof(fragment),
+                              "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,"
+                              "\"args\":{\"name\":\"%s\"}}",
+                              separator, nextTask + 1,
+                              events[taskFirstEvent[nextTask]].taskName);
+            nextTask++;
+            first = false;
+            break;
+
+        case STAGE_EVENTS:
+        {
+            if (nextEvent >= count)
+            {
+                stage = STAGE_FOOTER;
+                return nextFragment();
+            }
+            const trace_event_t &event = events[nextEvent++];
+            length = snprintf(fragment, sizeof(fragment),
+                              "%s{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%llu,\"dur\":%lu,\"pid\":1,"
+                              "\"tid\":%d,\"args\":{\"core\":%d}}",
+                              separator, event.name, (unsigned long long) event.startUs,
+                              (unsigned long) event.durationUs, threadId(event.task), event.core);
+            first = false;
+            break;
+        }
+
+        case STAGE_FOOTER:
+            length = snprintf(fragment, sizeof(fragment), "],\"displayTimeUnit\":\"ms\"}");
+            stage  = STAGE_DONE;
+            break;
+
+        case STAGE_DONE:
+            return false;
+    }
+
+    fragmentLength = min((size_t) max(length, 0), sizeof(fragment) - 1);
+    fragmentPos    = 0;
+    return true;
+}
+
+size_t TraceExport::fill(uint8_t *buffer, size_t maxLen)
+{
+    size_t written = 0;
+    while (written < maxLen)
+    {
+        if (fragmentPos == fragmentLength && !nextFragment())
+        {
+            break;
+        }
+        size_t n = min(maxLen - written, fragmentLength - fragmentPos);
+        memcpy(buffer + written, fragment + fragmentPos, n);
+        written += n;
+        fragmentPos += n;
+    }
+    return written;  // 0 ends the chunked response
+}
+
+Tracer &Tracer::getInstance()
+{
+    static Tracer instance;
+    return instance;
+}
+
+Tracer::Tracer()
+{
+    events    = nullptr;
+    capacity  = 0;
+    nextSlot  = 0;
+    exporting = false;
+}
+
+void Tracer::begin()
+{
+    if (events != nullptr)
+    {
+        return;
+    }
+    size_t size = memoryPolicy.scaleCapacity(TRACE_INTERNAL_EVENTS, TRACE_PSRAM_EVENTS);
+    trace_event_t *ring =
+        (trace_event_t *) memoryPolicy.allocate(size * sizeof(trace_event_t), ALLOC_TRACE);
+    if (ring == nullptr)
+    {
+        return;
+    }
+    memset(ring, 0, size * sizeof(trace_event_t));
+    capacity = size;
+    events   = ring;
+}
+
+void Tracer::record(const char *name, int64_t startUs, int64_t endUs)
+{
+    if (events == nullptr)
+    {
+        return;
+    }
+
+    uint32_t       slot  = __atomic_fetch_add(&nextSlot, 1, __ATOMIC_RELAXED);
+    trace_event_t &event = events[slot % capacity];
+
+    // Unpublish, fill, republish: a reader that sees the same non-zero seq before and after
+    // copying the slot got a consistent event
+    __atomic_store_n(&event.seq, 0, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    event.name       = name;
+    event.startUs    = (uint64_t) startUs;
+    event.durationUs = (uint32_t) (endUs - startUs);
+    event.task       = (uint32_t) (uintptr_t) xTaskGetCurrentTaskHandle();
+    event.core       = (uint8_t) xPortGetCoreID();
+    strlcpy(event.taskName, pcTaskGetName(nullptr), sizeof(event.taskName));
+    __atomic_store_n(&event.seq, slot + 1, __ATOMIC_RELEASE);
+}
+
+size_t Tracer::copyEvents(trace_event_t *out)
+{
+    uint32_t end   = __atomic_load_n(&nextSlot, __ATOMIC_ACQUIRE);
+    uint32_t begin = end > capacity ? end - capacity : 0;
+    size_t   count = 0;
+
+    // Oldest first
+    for (uint32_t slot = begin; slot < end; slot++)
+    {
+        const trace_event_t &event = events[slot % capacity];
+        uint32_t             seq   = __atomic_load_n(&event.seq, __ATOMIC_ACQUIRE);
+        if (seq != slot + 1)
+        {
+            continue;  // Being written, or already overwritten by a newer span
+        }
+        out[count] = event;
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (__atomic_load_n(&event.seq, __ATOMIC_RELAXED) == seq)
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+void Tracer::handle(AsyncWebServerRequest *request)
+{
+    if (events == nullptr)
+    {
+        request->send(503, "text/plain", "Trace buffer unavailable");
+        return;
+    }
+    if (exporting)
+    {
+        AsyncWebServerResponse *response =
+            request->beginResponse(503, "text/plain", "Previous trace still sending");
+        response->addHeader("Retry-After", "1");
+        request->send(response);
+        return;
+    }
+
+    trace_event_t *copy =
+        (trace_event_t *) memoryPolicy.allocate(capacity * sizeof(trace_event_t), ALLOC_TRACE);
+    if (copy == nullptr)
+    {
+        request->send(503, "text/plain", "Not enough memory to export the trace");
+        return;
+    }
+    exporting = true;
+
+    std::shared_ptr<TraceExport> state = std::make_shared<TraceExport>(copy, copyEvents(copy));
+    AsyncWebServerResponse      *response =
+        request->beginChunkedResponse("application/json",
+                                      [state](uint8_t *buffer, size_t maxLen, size_t index)
+                                      { return state->fill(buffer, maxLen); });
+    response->addHeader("Content-Disposition", "attachment; filename=\"trace.json\"");
+    request->send(response);
+}
+
+void Tracer::finishExport()
+{
+    exporting = false;
+}
+
+#endif  // ENABLE_TRACING
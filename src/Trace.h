@@ -0,0 +1,100 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+// Span tracing for latency work, compiled in only with -D ENABLE_TRACING. Put
+// TRACE_SPAN("name") at the top of a scope to record when it was entered and left, on
+// which task and core; GET /api/trace returns the recorded spans as Chrome trace_event
+// JSON, for chrome://tracing or ui.perfetto.dev. Without the flag the macro expands to
+// nothing and neither the ring nor the endpoint exists.
+
+#ifdef ENABLE_TRACING
+
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+#include <esp_timer.h>
+
+#define TRACE_INTERNAL_EVENTS 256   // Ring size without PSRAM
+#define TRACE_PSRAM_EVENTS 8192
+#define TRACE_TASK_NAME_LEN 12
+#define TRACE_MAX_TASKS 16          // Distinct tasks named in one export
+
+typedef struct
+{
+    uint32_t    seq;  // Slot number + 1 once written, 0 while being written
+    const char *name;
+    uint64_t    startUs;
+    uint32_t    durationUs;
+    uint32_t    task;  // Task handle, to group spans into threads
+    char        taskName[TRACE_TASK_NAME_LEN];
+    uint8_t     core;
+} trace_event_t;
+
+// Fixed-size ring of finished spans. Writers claim a slot with an atomic increment and
+// publish it by storing its sequence number last, so spans can be recorded from any task
+// without a lock; the exporter copies the ring and skips slots caught mid-write.
+class Tracer
+{
+   private:
+    trace_event_t *events;
+    size_t         capacity;
+    uint32_t       nextSlot;
+    bool           exporting;
+
+    Tracer();
+
+    // Delete copy constructor and assignment operator
+    Tracer(const Tracer &)            = delete;
+    Tracer &operator=(const Tracer &) = delete;
+
+    size_t copyEvents(trace_event_t *out);
+
+   public:
+    // Singleton access method
+    static Tracer &getInstance();
+
+    // Allocate the ring; call first thing in setup(). Spans before it are dropped.
+    void begin();
+
+    void record(const char *name, int64_t startUs, int64_t endUs);
+
+    // GET /api/trace
+    void handle(AsyncWebServerRequest *request);
+
+    // Called when the response streaming an export is done with its copy
+    void finishExport();
+};
+
+// Convenience macro for easier access
+#define tracer Tracer::getInstance()
+
+class TraceSpan
+{
+   private:
+    const char *name;
+    int64_t     startUs;
+
+    // Delete copy constructor and assignment operator
+    TraceSpan(const TraceSpan &)            = delete;
+    TraceSpan &operator=(const TraceSpan &) = delete;
+
+   public:
+    explicit TraceSpan(const char *name) : name(name), startUs(esp_timer_get_time()) {}
+    ~TraceSpan() { tracer.record(name, startUs, esp_timer_get_time()); }
+};
+
+#define TRACE_CONCAT_INNER(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_INNER(a, b)
+
+// name must be a string literal, or otherwise outlive the ring
+#define TRACE_SPAN(name) TraceSpan TRACE_CONCAT(traceSpan, __LINE__)(name)
+
+#else
+
+#define TRACE_SPAN(name) \
+    do                   \
+    {                    \
+    } while (0)
+
+#endif  // ENABLE_TRACING
+
+#endif  // TRACE_H
@@ -2,11 +2,29 @@
 
 #include <AsyncJson.h>
 
+#include "BootTimeline.h"
+#include "ConnectivityManager.h"
 #include "ElegooCC.h"
+#include "EndpointStats.h"
+#include "FlushScheduler.h"
+#include "JobScheduler.h"
+#include "JsonResponse.h"
 #include "Logger.h"
-#include "EmbeddedWebUI.h"
+#include "LoopWatchdog.h"
+#include "MemoryPolicy.h"
+#include "MetricsExporter.h"
+#include "EmbeddedAssets.h"
 #include "TimeSeriesData.h"
 #include "PauseAttemptData.h"
+#include "PrintJobIndex.h"
+#include "Profiler.h"
+#include "PushChannel.h"
+#include "ResponseCache.h"
+#include "StorageManager.h"
+#include "StorageViewPage.h"
+#include "SystemMetrics.h"
+#include "TimeBase.h"
+#include "Trace.h"
 
 #define SPIFFS LittleFS
 
@@ -17,6 +35,11 @@ extern const char *chipFamily;
 // External functions for uptime tracking from main.cpp
 extern unsigned long getUptimeSeconds();
 extern String getUptimeFormatted();
+extern bool uptimeStarted;
+
+// /sensor_status is rebuilt at most this often while the printer status is unchanged, so
+// the uptime it reports can lag by up to this much
+#define SENSOR_STATUS_UPTIME_RESOLUTION_S 10
 
 // External timeseries data from main.cpp
 extern TimeSeriesData* movementData;
@@ -24,70 +47,314 @@ extern TimeSeriesData* runoutData;
 extern TimeSeriesData* connectionData;
 extern PauseAttemptData* pauseAttemptData;
 
+// Printer status as served by /sensor_status and the dashboard's status section
+static void fillSensorStatus(JsonDocument &jsonDoc)
+{
+    // Add elegoo status information using singleton
+    printer_info_t elegooStatus = elegooCC.getCurrentInformation();
+
+    jsonDoc["stopped"]        = elegooStatus.filamentStopped;
+    jsonDoc["filamentRunout"] = elegooStatus.filamentRunout;
+
+    jsonDoc["elegoo"]["mainboardID"]          = elegooStatus.mainboardID;
+    jsonDoc["elegoo"]["printStatus"]          = (int) elegooStatus.printStatus;
+    jsonDoc["elegoo"]["isPrinting"]           = elegooStatus.isPrinting;
+    jsonDoc["elegoo"]["currentLayer"]         = elegooStatus.currentLayer;
+    jsonDoc["elegoo"]["totalLayer"]           = elegooStatus.totalLayer;
+    jsonDoc["elegoo"]["progress"]             = elegooStatus.progress;
+    jsonDoc["elegoo"]["currentTicks"]         = elegooStatus.currentTicks;
+    jsonDoc["elegoo"]["totalTicks"]           = elegooStatus.totalTicks;
+    jsonDoc["elegoo"]["PrintSpeedPct"]        = elegooStatus.PrintSpeedPct;
+    jsonDoc["elegoo"]["isWebsocketConnected"] = elegooStatus.isWebsocketConnected;
+    jsonDoc["elegoo"]["currentZ"]             = elegooStatus.currentZ;
+
+    // Add uptime information
+    jsonDoc["uptime"]["seconds"]   = getUptimeSeconds();
+    jsonDoc["uptime"]["formatted"] = getUptimeFormatted();
+}
+
+// Document sizes for the bodies built below
+#define SENSOR_STATUS_JSON_SIZE 512
+#define STORAGE_INFO_JSON_SIZE \
+    (512 + JSON_OBJECT_SIZE(STORAGE_MAX_FILES) + STORAGE_MAX_FILES * JSON_OBJECT_SIZE(5))
+#define SYSTEM_HEALTH_JSON_SIZE                                                        \
+    (2048 + JSON_OBJECT_SIZE(ENDPOINT_STATS_MAX_ENDPOINTS) +                           \
+     ENDPOINT_STATS_MAX_ENDPOINTS * JSON_OBJECT_SIZE(6) + SYSTEM_METRICS_JSON_SIZE +   \
+     JSON_OBJECT_SIZE(2) + JSON_OBJECT_SIZE(FLUSH_PRIORITY_COUNT) +                    \
+     JSON_OBJECT_SIZE(FLUSH_MAX_STORES) + FLUSH_MAX_STORES * JSON_OBJECT_SIZE(3) +     \
+     JOB_SCHEDULER_JSON_SIZE + BOOT_TIMELINE_JSON_SIZE + LOOP_WATCHDOG_JSON_SIZE)
+
+// Body of /api/storage
+static void fillStorageInfo(JsonDocument &jsonDoc)
+{
+    // Basic filesystem info, as of the storage manager's last refresh
+    storage_fs_stats_t fsStats = storageManager.getFsStats();
+    size_t totalBytes = fsStats.totalBytes;
+    size_t usedBytes = fsStats.usedBytes;
+    size_t freeBytes = totalBytes - usedBytes;
+
+    size_t logUsage = logger.getLogFileUsage();
+
+    jsonDoc["total_bytes"] = totalBytes;
+    jsonDoc["used_bytes"] = usedBytes;
+    jsonDoc["free_bytes"] = freeBytes;
+    jsonDoc["total_kb"] = totalBytes / 1024;
+    jsonDoc["used_kb"] = usedBytes / 1024;
+    jsonDoc["free_kb"] = freeBytes / 1024;
+    jsonDoc["total_mb"] = totalBytes / (1024 * 1024);
+    jsonDoc["usage_percent"] = totalBytes > 0 ? (usedBytes * 100) / totalBytes : 0;
+
+    // Log file specific info
+    jsonDoc["log_usage_bytes"] = logUsage;
+    jsonDoc["log_usage_kb"] = logUsage / 1024;
+    jsonDoc["log_limit_kb"] = 1536; // 1.5MB
+    jsonDoc["log_usage_percent"] = (logUsage * 100) / (1536 * 1024); // 1.5MB
+
+    // Timeseries data info
+    size_t movementSize = movementData ? movementData->getDataSize() : 0;
+    size_t runoutSize = runoutData ? runoutData->getDataSize() : 0;
+    size_t connectionSize = connectionData ? connectionData->getDataSize() : 0;
+    size_t pauseAttemptSize = pauseAttemptData ? pauseAttemptData->getDataSize() : 0;
+    size_t totalTimeseriesSize = movementSize + runoutSize + connectionSize + pauseAttemptSize;
+
+    jsonDoc["timeseries"]["movement_kb"] = movementSize / 1024;
+    jsonDoc["timeseries"]["runout_kb"] = runoutSize / 1024;
+    jsonDoc["timeseries"]["connection_kb"] = connectionSize / 1024;
+    jsonDoc["timeseries"]["pause_attempts_kb"] = pauseAttemptSize / 1024;
+    jsonDoc["timeseries"]["total_kb"] = totalTimeseriesSize / 1024;
+    jsonDoc["timeseries"]["limit_kb"] = 500; // 150KB * 3 + 50KB for pause attempts
+    jsonDoc["timeseries"]["usage_percent"] = (totalTimeseriesSize * 100) / (500 * 1024);
+
+    jsonDoc["timeseries"]["movement_points"] = movementData ? movementData->getPointCount() : 0;
+    jsonDoc["timeseries"]["runout_points"] = runoutData ? runoutData->getPointCount() : 0;
+    jsonDoc["timeseries"]["connection_points"] = connectionData ? connectionData->getPointCount() : 0;
+    jsonDoc["timeseries"]["pause_attempt_points"] = pauseAttemptData ? pauseAttemptData->getPointCount() : 0;
+
+    storageManager.reportFiles(jsonDoc.createNestedObject("files"));
+}
+
+#define STORAGE_VIEW_LOG_LIMIT_BYTES (200 * 1024)
+
+// Figures behind /storage/view, taken once per request so every chunk of the page agrees
+typedef struct
+{
+    size_t totalBytes;
+    size_t usedBytes;
+    size_t logBytes;
+} storage_snapshot_t;
+
+static storage_snapshot_t storageSnapshot()
+{
+    storage_fs_stats_t fsStats = storageManager.getFsStats();
+    return {fsStats.totalBytes, fsStats.usedBytes, logger.getLogFileUsage()};
+}
+
+// Value of one %NAME% in STORAGE_VIEW_HTML
+static String storageViewPlaceholder(const storage_snapshot_t &snapshot, const String &name)
+{
+    size_t totalBytes = snapshot.totalBytes;
+    size_t usedBytes  = snapshot.usedBytes;
+    size_t freeBytes  = totalBytes - usedBytes;
+    size_t logBytes   = snapshot.logBytes;
+    size_t logFree =
+        logBytes < STORAGE_VIEW_LOG_LIMIT_BYTES ? STORAGE_VIEW_LOG_LIMIT_BYTES - logBytes : 0;
+
+    if (name == "TOTAL_KB") return String(totalBytes / 1024);
+    if (name == "TOTAL_BYTES") return String(totalBytes);
+    if (name == "USED_KB") return String(usedBytes / 1024);
+    if (name == "USED_BYTES") return String(usedBytes);
+    if (name == "FREE_KB") return String(freeBytes / 1024);
+    if (name == "FREE_BYTES") return String(freeBytes);
+    if (name == "USAGE_PERCENT") return String(totalBytes > 0 ? usedBytes * 100 / totalBytes : 0);
+    if (name == "LOG_KB") return String(logBytes / 1024);
+    if (name == "LOG_BYTES") return String(logBytes);
+    if (name == "LOG_AVAILABLE_KB") return String(logFree / 1024);
+    if (name == "LOG_PERCENT") return String(logBytes * 100 / STORAGE_VIEW_LOG_LIMIT_BYTES);
+    if (name == "OTHER_KB") return String((usedBytes > logBytes ? usedBytes - logBytes : 0) / 1024);
+    return String();
+}
+
+// Hashed chunk names change whenever their content does, so browsers keep them for good;
+// anything else (index.html) is revalidated and usually comes back as a bodiless 304
+static void sendEmbeddedAsset(AsyncWebServerRequest *request, const embedded_asset_t *asset)
+{
+    const char *cacheControl =
+        asset->immutable ? "public, max-age=31536000, immutable" : "no-cache";
+
+    if (request->hasHeader("If-None-Match") &&
+        request->header("If-None-Match").indexOf(asset->etag) >= 0)
+    {
+        AsyncWebServerResponse *response = request->beginResponse(304);
+        response->addHeader("ETag", asset->etag);
+        response->addHeader("Cache-Control", cacheControl);
+        request->send(response);
+        return;
+    }
+
+    AsyncWebServerResponse *response =
+        request->beginResponse(200, asset->mimeType, asset->data, asset->length);
+    if (asset->gzipped)
+    {
+        response->addHeader("Content-Encoding", "gzip");
+    }
+    response->addHeader("ETag", asset->etag);
+    response->addHeader("Cache-Control", cacheControl);
+    request->send(response);
+}
+
+// True if name is one of the comma-separated entries in sections
+static bool hasSection(const String &sections, const char *name)
+{
+    return ("," + sections + ",").indexOf("," + String(name) + ",") >= 0;
+}
+
+// Body of /api/dashboard: the requested sections as one JSON object, each serialized
+// straight into the response stream. Series only carry points newer than the client's
+// cursor, so a steady-state refresh is a few points rather than the whole window.
+static void writeDashboard(Print &out, const String &sections, unsigned long since,
+                           size_t maxPoints)
+{
+    bool first = true;
+    auto beginSection = [&out, &first](const char *name)
+    {
+        out.print(first ? "{\"" : ",\"");
+        out.print(name);
+        out.print("\":");
+        first = false;
+    };
+
+    if (hasSection(sections, "status"))
+    {
+        beginSection("status");
+        PooledJsonDocument jsonDoc(SENSOR_STATUS_JSON_SIZE);
+        fillSensorStatus(*jsonDoc);
+        serializeJson(*jsonDoc, out);
+    }
+
+    if (hasSection(sections, "settings"))
+    {
+        // The client refetches /get_settings only when this changes
+        beginSection("settings");
+        StaticJsonDocument<JSON_OBJECT_SIZE(1)> jsonDoc;
+        jsonDoc["version"] = settingsManager.getVersion();
+        serializeJson(jsonDoc, out);
+    }
+
+    if (hasSection(sections, "series"))
+    {
+        beginSection("series");
+        const char     *names[]  = {"movement", "runout", "connection"};
+        TimeSeriesData *series[] = {movementData, runoutData, connectionData};
+        PooledJsonDocument jsonDoc(JSON_OBJECT_SIZE(4) +
+                                   3 * (JSON_ARRAY_SIZE(maxPoints) + maxPoints * JSON_OBJECT_SIZE(2)));
+        unsigned long cursor = since;
+        for (int i = 0; i < 3; i++)
+        {
+            JsonArray points = jsonDoc->createNestedArray(names[i]);
+            if (series[i])
+            {
+                unsigned long newest = series[i]->getSince(points, since, maxPoints);
+                cursor               = max(cursor, newest);
+            }
+        }
+        (*jsonDoc)["cursor"] = cursor;
+        serializeJson(*jsonDoc, out);
+    }
+
+    if (hasSection(sections, "pause") && pauseAttemptData)
+    {
+        beginSection("pause");
+        PooledJsonDocument jsonDoc(JSON_OBJECT_SIZE(2) + pauseAttemptData->getDataJsonCapacity(100) +
+                                   PAUSE_STATISTICS_JSON_SIZE);
+        pauseAttemptData->writeDataJson(jsonDoc->createNestedObject("attempts"), 100);
+        pauseAttemptData->writeStatistics(jsonDoc->createNestedObject("stats"));
+        serializeJson(*jsonDoc, out);
+    }
+
+    if (hasSection(sections, "health"))
+    {
+        beginSection("health");
+        StaticJsonDocument<JSON_OBJECT_SIZE(6)> jsonDoc;
+        jsonDoc["free_heap"]          = ESP.getFreeHeap();
+        jsonDoc["min_free_heap"]      = ESP.getMinFreeHeap();
+        jsonDoc["largest_free_block"] = ESP.getMaxAllocHeap();
+        jsonDoc["uptime_ms"]          = millis();
+        jsonDoc["rssi"]               = WiFi.RSSI();
+        jsonDoc["push_clients"]       = pushChannel.getClientCount();
+        serializeJson(jsonDoc, out);
+    }
+
+    out.print(first ? "{}" : "}");
+}
+
 WebServer::WebServer(int port) : server(port) {}
 
 void WebServer::begin()
 {
     server.begin();
 
+    // Allocate the document pool now rather than inside the first request
+    JsonDocumentPool::getInstance();
+    metricsExporter.begin();
+
+    // Live status, log and sample events on /events
+    pushChannel.begin(server);
+
     // Get settings endpoint
     server.on("/get_settings", HTTP_GET,
               [](AsyncWebServerRequest *request)
               {
-                  String jsonResponse = settingsManager.toJson(false);
-                  request->send(200, "application/json", jsonResponse);
+                  EndpointProbe probe("/get_settings");
+                  responseCache.send(request, CACHED_SETTINGS, settingsManager.getVersion(),
+                                     SETTINGS_JSON_SIZE,
+                                     [](JsonDocument &doc)
+                                     { settingsManager.writeJson(doc.to<JsonObject>(), false); });
               });
 
     server.addHandler(new AsyncCallbackJsonWebHandler(
         "/update_settings",
         [this](AsyncWebServerRequest *request, JsonVariant &json)
         {
+            TRACE_SPAN("/update_settings");
             JsonObject jsonObj = json.as<JsonObject>();
-            settingsManager.setElegooIP(jsonObj["elegooip"].as<String>());
-            settingsManager.setSSID(jsonObj["ssid"].as<String>());
-            settingsManager.setElegooIP(jsonObj["elegooip"].as<String>());
-            settingsManager.setSSID(jsonObj["ssid"].as<String>());
-            if (jsonObj.containsKey("passwd") && jsonObj["passwd"].as<String>().length() > 0)
+
+            // All or nothing: one bad value and none of the others are applied either
+            String rejectedKeys;
+            if (settingsManager.validateJson(jsonObj, rejectedKeys) > 0)
             {
-                settingsManager.setPassword(jsonObj["passwd"].as<String>());
-            }
-            settingsManager.setAPMode(jsonObj["ap_mode"].as<bool>());
-            settingsManager.setTimeout(jsonObj["timeout"].as<int>());
-            settingsManager.setFirstLayerTimeout(jsonObj["first_layer_timeout"].as<int>());
-            settingsManager.setPauseOnRunout(jsonObj["pause_on_runout"].as<bool>());
-            settingsManager.setEnabled(jsonObj["enabled"].as<bool>());
-            settingsManager.setStartPrintTimeout(jsonObj["start_print_timeout"].as<int>());
-            if (jsonObj.containsKey("pause_verification_timeout_ms")) {
-                settingsManager.setPauseVerificationTimeoutMs(jsonObj["pause_verification_timeout_ms"].as<int>());
-            }
-            if (jsonObj.containsKey("max_pause_retries")) {
-                settingsManager.setMaxPauseRetries(jsonObj["max_pause_retries"].as<int>());
+                jsonObj.clear();
+                request->send(400, "text/plain",
+                              "Invalid settings, nothing was changed: " + rejectedKeys);
+                return;
             }
+            settingsManager.importJson(jsonObj);
             settingsManager.save();
-            
-            // Log all saved settings for verification
-            logger.log("Settings saved - SSID: " + settingsManager.getSSID() + 
-                      ", ElegooIP: " + settingsManager.getElegooIP() +
-                      ", Timeout: " + String(settingsManager.getTimeout()) + "ms" +
-                      ", FirstLayerTimeout: " + String(settingsManager.getFirstLayerTimeout()) + "ms" +
-                      ", StartPrintTimeout: " + String(settingsManager.getStartPrintTimeout()) + "ms" +
-                      ", PauseOnRunout: " + String(settingsManager.getPauseOnRunout()) +
-                      ", Enabled: " + String(settingsManager.getEnabled()) +
-                      ", PauseVerificationTimeout: " + String(settingsManager.getPauseVerificationTimeoutMs()) + "ms" +
-                      ", MaxPauseRetries: " + String(settingsManager.getMaxPauseRetries()));
-            
+            logger.log("Settings saved: " + settingsManager.toJson(false));
+
             jsonObj.clear();
             request->send(200, "text/plain", "ok");
         }));
 
     // Setup ElegantOTA
     ElegantOTA.begin(&server);
+    // Get pending history and logs onto flash before the update takes the flash bandwidth
+    ElegantOTA.onStart([]() { flushScheduler.flushAll("OTA update"); });
+
+    // Prometheus scrape target
+    server.on("/metrics", HTTP_GET,
+              [](AsyncWebServerRequest *request)
+              {
+                  EndpointProbe probe("/metrics");
+                  metricsExporter.handle(request);
+              });
 
     // System health endpoint
     server.on("/system_health", HTTP_GET,
               [this](AsyncWebServerRequest *request)
               {
-                  DynamicJsonDocument doc(1024);
+                  EndpointProbe      probe("/system_health");
+                  PooledJsonDocument pooled(SYSTEM_HEALTH_JSON_SIZE);
+                  JsonDocument      &doc = *pooled;
                   
                   // Memory information
                   size_t totalHeap = ESP.getHeapSize();
@@ -102,12 +369,29 @@ void WebServer::begin()
                   doc["memory"]["used_kb"] = usedHeap / 1024;
                   doc["memory"]["usage_percent"] = (int)((float)usedHeap / totalHeap * 100);
                   doc["memory"]["largest_free_block_kb"] = ESP.getMaxAllocHeap() / 1024;
+                  // Internal vs PSRAM breakdown and where the large buffers were placed
+                  memoryPolicy.reportUsage(doc["memory"].as<JsonObject>());
+                  responseCache.reportStats(doc.createNestedObject("response_cache"));
+                  jsonDocumentPool.reportStats(doc.createNestedObject("json_pool"));
+                  // Heap held while building each response
+                  endpointStats.reportStats(doc.createNestedObject("endpoints"));
+                  // Pending flash writes per store
+                  flushScheduler.reportStats(doc.createNestedObject("flush_scheduler"));
+                  // Run time, lateness and overruns of each main-loop job
+                  jobScheduler.reportStats(doc.createNestedObject("job_scheduler"));
+                  // Reset reason and when each boot phase was reached
+                  bootTimeline.report(doc.createNestedObject("boot"));
                   
                   // CPU information
                   doc["cpu"]["frequency_mhz"] = ESP.getCpuFreqMHz();
                   doc["cpu"]["cores"] = ESP.getChipCores();
-                  // Note: ESP32 doesn't provide real-time CPU usage, but we can show task count
-                  doc["cpu"]["usage_note"] = "Real-time CPU usage not available on ESP32";
+                  // Per-core and per-task usage, loop timing and heap history, as of the
+                  // last background sample
+                  systemMetrics.reportCpu(doc["cpu"].as<JsonObject>());
+                  systemMetrics.reportLoop(doc.createNestedObject("loop"));
+                  // Time per loop phase and the most recent stalls, naming the phase or job
+                  loopWatchdog.reportStats(doc.createNestedObject("loop_watchdog"));
+                  systemMetrics.reportHeap(doc["memory"].createNestedObject("history"));
                   
                   // Flash information
                   size_t totalFlash = ESP.getFlashChipSize();
@@ -153,56 +437,77 @@ void WebServer::begin()
                   else if (rssi > -80) signalStrength = "Weak";
                   else signalStrength = "Very Weak";
                   doc["wifi"]["signal_strength"] = signalStrength;
+                  // Connection state machine, reconnects and NTP syncs
+                  connectivityManager.reportStats(doc["wifi"].as<JsonObject>());
                   
-                  String response;
-                  serializeJson(doc, response);
-                  request->send(200, "application/json", response);
+                  sendJson(request, doc);
               });
 
     // Sensor status endpoint
     server.on("/sensor_status", HTTP_GET,
               [this](AsyncWebServerRequest *request)
               {
-                  // Add elegoo status information using singleton
-                  printer_info_t elegooStatus = elegooCC.getCurrentInformation();
-
-                  DynamicJsonDocument jsonDoc(512);
-                  jsonDoc["stopped"]        = elegooStatus.filamentStopped;
-                  jsonDoc["filamentRunout"] = elegooStatus.filamentRunout;
-
-                  jsonDoc["elegoo"]["mainboardID"]          = elegooStatus.mainboardID;
-                  jsonDoc["elegoo"]["printStatus"]          = (int) elegooStatus.printStatus;
-                  jsonDoc["elegoo"]["isPrinting"]           = elegooStatus.isPrinting;
-                  jsonDoc["elegoo"]["currentLayer"]         = elegooStatus.currentLayer;
-                  jsonDoc["elegoo"]["totalLayer"]           = elegooStatus.totalLayer;
-                  jsonDoc["elegoo"]["progress"]             = elegooStatus.progress;
-                  jsonDoc["elegoo"]["currentTicks"]         = elegooStatus.currentTicks;
-                  jsonDoc["elegoo"]["totalTicks"]           = elegooStatus.totalTicks;
-                  jsonDoc["elegoo"]["PrintSpeedPct"]        = elegooStatus.PrintSpeedPct;
-                  jsonDoc["elegoo"]["isWebsocketConnected"] = elegooStatus.isWebsocketConnected;
-                  jsonDoc["elegoo"]["currentZ"]             = elegooStatus.currentZ;
-                  
-                  // Add uptime information
-                  jsonDoc["uptime"]["seconds"] = getUptimeSeconds();
-                  jsonDoc["uptime"]["formatted"] = getUptimeFormatted();
+                  EndpointProbe probe("/sensor_status");
+                  uint32_t uptimeBucket =
+                      uptimeStarted ? getUptimeSeconds() / SENSOR_STATUS_UPTIME_RESOLUTION_S + 1 : 0;
+                  uint32_t version =
+                      ResponseCache::combine(elegooCC.getStatusVersion(), uptimeBucket);
+                  responseCache.send(request, CACHED_SENSOR_STATUS, version,
+                                     SENSOR_STATUS_JSON_SIZE, fillSensorStatus);
+              });
 
-                  String jsonResponse;
-                  serializeJson(jsonDoc, jsonResponse);
-                  request->send(200, "application/json", jsonResponse);
+    // Aggregated dashboard: every section the Status tab needs in one round trip.
+    // ?sections=status,settings,series,pause,health (default all), ?since=<cursor from the
+    // previous response's series.cursor>, ?points=<max points per series>
+    server.on("/api/dashboard", HTTP_GET,
+              [](AsyncWebServerRequest *request)
+              {
+                  EndpointProbe probe("/api/dashboard");
+                  String sections = "status,settings,series,pause,health";
+                  if (request->hasParam("sections"))
+                  {
+                      sections = request->getParam("sections")->value();
+                  }
+                  unsigned long since = 0;
+                  if (request->hasParam("since"))
+                  {
+                      since = strtoul(request->getParam("since")->value().c_str(), nullptr, 10);
+                  }
+                  size_t points = 100;
+                  if (request->hasParam("points"))
+                  {
+                      points = constrain(request->getParam("points")->value().toInt(), 1, 500);
+                  }
+
+                  AsyncResponseStream *response = request->beginResponseStream("application/json");
+                  writeDashboard(*response, sections, since, points);
+                  EndpointProbe::sampleCurrent();
+                  request->send(response);
               });
 
-    // Logs endpoint (recent logs as JSON)
+    // Logs endpoint (recent logs as JSON, or columnar MessagePack when accepted)
     server.on("/api/logs", HTTP_GET,
               [](AsyncWebServerRequest *request)
               {
-                  String jsonResponse = logger.getLogsAsJson();
-                  request->send(200, "application/json", jsonResponse);
+                  EndpointProbe probe("/api/logs");
+                  // The PSRAM ring can hold hundreds of entries, so only the newest are
+                  // returned unless a larger limit is asked for
+                  int limit = 100;
+                  if (request->hasParam("limit"))
+                  {
+                      limit = request->getParam("limit")->value().toInt();
+                  }
+                  // Entries are copied into the document, so log() can carry on meanwhile
+                  PooledJsonDocument doc(logger.getLogsJsonCapacity(limit));
+                  logger.writeLogsJson(doc->to<JsonObject>(), limit);
+                  sendNegotiated(request, *doc, negotiateFormat(request));
               });
 
     // Historical logs endpoint (all stored logs as text)
     server.on("/logs/history", HTTP_GET,
               [](AsyncWebServerRequest *request)
               {
+                  TRACE_SPAN("/logs/history");
                   String logContents = logger.getLogFileContents();
                   if (logContents.length() == 0)
                   {
@@ -215,6 +520,7 @@ void WebServer::begin()
     server.on("/logs/download", HTTP_GET,
               [](AsyncWebServerRequest *request)
               {
+                  TRACE_SPAN("/logs/download");
                   String logContents = logger.getLogFileContents();
                   
                   // Debug information if no logs found
@@ -226,7 +532,7 @@ void WebServer::begin()
                       logContents += "- Log file exists: " + String(LittleFS.exists("/system_logs.txt") ? "Yes" : "No") + "\n";
                       logContents += "- Log file size: " + String(logger.getLogFileSize()) + " bytes\n";
                       logContents += "- In-memory log count: " + String(logger.getLogCount()) + "\n";
-                      logContents += "- LittleFS mounted: " + String(LittleFS.begin() ? "Yes" : "No") + "\n";
+                      logContents += "- LittleFS mounted: " + String(storageManager.isMounted() ? "Yes" : "No") + "\n";
                       
                       // Force a test log entry to see if logging works
                       logger.log("Test log entry created during download request");
@@ -262,6 +568,7 @@ void WebServer::begin()
     server.on("/logs/clear", HTTP_POST,
               [](AsyncWebServerRequest *request)
               {
+                  TRACE_SPAN("/logs/clear");
                   logger.clearLogs();
                   logger.clearLogFile();
                   request->send(200, "text/plain", "All logs cleared");
@@ -271,17 +578,18 @@ void WebServer::begin()
     server.on("/storage/clear_all", HTTP_POST,
               [](AsyncWebServerRequest *request)
               {
+                  TRACE_SPAN("/storage/clear_all");
                   // Clear logs
                   logger.clearLogs();
                   logger.clearLogFile();
                   
                   // Clear all timeseries data files
-                  if (LittleFS.begin()) {
-                      LittleFS.remove("/movement_data.json");
-                      LittleFS.remove("/runout_data.json");
-                      LittleFS.remove("/connection_data.json");
-                      LittleFS.remove("/pause_attempt_data.json");
-                  }
+                  storageManager.removeFile("/movement_data.json");
+                  storageManager.removeFile("/runout_data.json");
+                  storageManager.removeFile("/connection_data.json");
+                  // The pause journal also holds running totals in memory, so clear through it
+                  if (pauseAttemptData) pauseAttemptData->clearData();
+                  printJobIndex.clearJobs();
                   
                   request->send(200, "text/plain", "All storage cleared (logs + timeseries data)");
               });
@@ -290,177 +598,58 @@ void WebServer::begin()
     server.on("/version", HTTP_GET,
               [](AsyncWebServerRequest *request)
               {
-                  DynamicJsonDocument jsonDoc(256);
-                  jsonDoc["firmware_version"] = firmwareVersion;
-                  jsonDoc["chip_family"]      = chipFamily;
-                  jsonDoc["build_date"]       = __DATE__;
-                  jsonDoc["build_time"]       = __TIME__;
-
-                  String jsonResponse;
-                  serializeJson(jsonDoc, jsonResponse);
-                  request->send(200, "application/json", jsonResponse);
+                  EndpointProbe probe("/version");
+                  // Fixed for the life of the firmware image
+                  responseCache.send(request, CACHED_VERSION, 0, JSON_OBJECT_SIZE(4),
+                                     [](JsonDocument &jsonDoc)
+                                     {
+                                         jsonDoc["firmware_version"] = firmwareVersion;
+                                         jsonDoc["chip_family"]      = chipFamily;
+                                         jsonDoc["build_date"]       = __DATE__;
+                                         jsonDoc["build_time"]       = __TIME__;
+                                     });
               });
 
     // System health storage info endpoint
     server.on("/api/storage", HTTP_GET,
               [](AsyncWebServerRequest *request)
               {
-                  DynamicJsonDocument jsonDoc(512);
-                  // Basic filesystem info
-                  size_t totalBytes = LittleFS.totalBytes();
-                  size_t usedBytes = LittleFS.usedBytes();
-                  size_t freeBytes = totalBytes - usedBytes;
-                  
-                  // Add filesystem size info for debugging
-                  logger.logf("LittleFS filesystem - Total: %d bytes (%.2f MB), Used: %d bytes (%.2f MB), Free: %d bytes (%.2f MB)", 
-                             totalBytes, totalBytes / (1024.0 * 1024.0), 
-                             usedBytes, usedBytes / (1024.0 * 1024.0),
-                             freeBytes, freeBytes / (1024.0 * 1024.0));
-                  size_t logUsage = logger.getLogFileUsage();
-                  
-                  jsonDoc["total_bytes"] = totalBytes;
-                  jsonDoc["used_bytes"] = usedBytes;
-                  jsonDoc["free_bytes"] = freeBytes;
-                  jsonDoc["total_kb"] = totalBytes / 1024;
-                  jsonDoc["used_kb"] = usedBytes / 1024;
-                  jsonDoc["free_kb"] = freeBytes / 1024;
-                  jsonDoc["total_mb"] = totalBytes / (1024 * 1024);
-                  jsonDoc["usage_percent"] = (usedBytes * 100) / totalBytes;
-                  
-                  // Log file specific info
-                  jsonDoc["log_usage_bytes"] = logUsage;
-                  jsonDoc["log_usage_kb"] = logUsage / 1024;
-                  jsonDoc["log_limit_kb"] = 1536; // 1.5MB
-                  jsonDoc["log_usage_percent"] = (logUsage * 100) / (1536 * 1024); // 1.5MB
-                  
-                  // Timeseries data info
-                  size_t movementSize = movementData ? movementData->getDataSize() : 0;
-                  size_t runoutSize = runoutData ? runoutData->getDataSize() : 0;
-                  size_t connectionSize = connectionData ? connectionData->getDataSize() : 0;
-                  size_t pauseAttemptSize = pauseAttemptData ? pauseAttemptData->getDataSize() : 0;
-                  size_t totalTimeseriesSize = movementSize + runoutSize + connectionSize + pauseAttemptSize;
-                  
-                  jsonDoc["timeseries"]["movement_kb"] = movementSize / 1024;
-                  jsonDoc["timeseries"]["runout_kb"] = runoutSize / 1024;
-                  jsonDoc["timeseries"]["connection_kb"] = connectionSize / 1024;
-                  jsonDoc["timeseries"]["pause_attempts_kb"] = pauseAttemptSize / 1024;
-                  jsonDoc["timeseries"]["total_kb"] = totalTimeseriesSize / 1024;
-                  jsonDoc["timeseries"]["limit_kb"] = 500; // 150KB * 3 + 50KB for pause attempts
-                  jsonDoc["timeseries"]["usage_percent"] = (totalTimeseriesSize * 100) / (500 * 1024);
-                  
-                  jsonDoc["timeseries"]["movement_points"] = movementData ? movementData->getPointCount() : 0;
-                  jsonDoc["timeseries"]["runout_points"] = runoutData ? runoutData->getPointCount() : 0;
-                  jsonDoc["timeseries"]["connection_points"] = connectionData ? connectionData->getPointCount() : 0;
-                  jsonDoc["timeseries"]["pause_attempt_points"] = pauseAttemptData ? pauseAttemptData->getPointCount() : 0;
-
-                  String jsonResponse;
-                  serializeJson(jsonDoc, jsonResponse);
-                  request->send(200, "application/json", jsonResponse);
+                  EndpointProbe probe("/api/storage");
+                  // Everything reported changes only through logging, series appends,
+                  // settings saves or the storage manager's view of the filesystem
+                  uint32_t version = ResponseCache::combine(logger.getVersion(),
+                                                            settingsManager.getVersion());
+                  version = ResponseCache::combine(version, storageManager.getVersion());
+                  TimeSeriesData *series[] = {movementData, runoutData, connectionData};
+                  for (TimeSeriesData *data : series)
+                  {
+                      if (data) version = ResponseCache::combine(version, data->getVersion());
+                  }
+                  if (pauseAttemptData)
+                  {
+                      version = ResponseCache::combine(version, pauseAttemptData->getVersion());
+                  }
+                  responseCache.send(request, CACHED_STORAGE, version, STORAGE_INFO_JSON_SIZE,
+                                     fillStorageInfo);
               });
 
     // Human-readable storage page
     server.on("/storage/view", HTTP_GET,
               [](AsyncWebServerRequest *request)
               {
-                  size_t totalBytes = LittleFS.totalBytes();
-                  size_t usedBytes = LittleFS.usedBytes();
-                  size_t freeBytes = totalBytes - usedBytes;
-                  size_t logUsage = logger.getLogFileUsage();
-                  
-                  String html = "<!DOCTYPE html><html><head>";
-                  html += "<title>System Health - Storage Information</title>";
-                  html += "<style>";
-                  html += "body { font-family: Arial, sans-serif; margin: 20px; background: #f5f5f5; }";
-                  html += ".container { max-width: 600px; margin: 0 auto; background: white; padding: 20px; border-radius: 8px; box-shadow: 0 2px 4px rgba(0,0,0,0.1); }";
-                  html += "h1 { color: #333; text-align: center; }";
-                  html += ".storage-item { margin: 15px 0; padding: 10px; background: #f8f9fa; border-radius: 4px; }";
-                  html += ".storage-label { font-weight: bold; color: #555; }";
-                  html += ".storage-value { color: #007bff; font-size: 1.1em; }";
-                  html += ".progress-bar { width: 100%; height: 20px; background: #e9ecef; border-radius: 10px; overflow: hidden; margin: 5px 0; }";
-                  html += ".progress-fill { height: 100%; background: linear-gradient(90deg, #28a745, #ffc107, #dc3545); transition: width 0.3s; }";
-                  html += ".log-progress { background: linear-gradient(90deg, #17a2b8, #6f42c1); }";
-                  html += ".nav-link { display: inline-block; margin: 10px 5px; padding: 8px 15px; background: #007bff; color: white; text-decoration: none; border-radius: 4px; }";
-                  html += ".nav-link:hover { background: #0056b3; }";
-                  html += "</style></head><body>";
-                  
-                  html += "<div class='container'>";
-                  html += "<h1>🖥️ System Health - Storage Information</h1>";
-                  
-                  // Navigation
-                  html += "<div style='text-align: center; margin-bottom: 20px;'>";
-                  html += "<a href='/' class='nav-link'>🏠 Home</a>";
-                  html += "<a href='/logs/history' class='nav-link'>📋 View Logs</a>";
-                  html += "<a href='/storage' class='nav-link'>📊 JSON Data</a>";
-                  html += "</div>";
-                  
-                  // Filesystem Storage
-                  html += "<div class='storage-item'>";
-                  html += "<div class='storage-label'>💾 Filesystem Storage</div>";
-                  html += "<div class='storage-value'>Total: " + String(totalBytes / 1024) + " KB (" + String(totalBytes) + " bytes)</div>";
-                  html += "<div class='storage-value'>Used: " + String(usedBytes / 1024) + " KB (" + String(usedBytes) + " bytes)</div>";
-                  html += "<div class='storage-value'>Free: " + String(freeBytes / 1024) + " KB (" + String(freeBytes) + " bytes)</div>";
-                  
-                  int usagePercent = (usedBytes * 100) / totalBytes;
-                  html += "<div class='progress-bar'>";
-                  html += "<div class='progress-fill' style='width: " + String(usagePercent) + "%'></div>";
-                  html += "</div>";
-                  html += "<div>Usage: " + String(usagePercent) + "%</div>";
-                  html += "</div>";
-                  
-                  // Log Storage
-                  html += "<div class='storage-item'>";
-                  html += "<div class='storage-label'>📝 Log Storage</div>";
-                  html += "<div class='storage-value'>Used: " + String(logUsage / 1024) + " KB (" + String(logUsage) + " bytes)</div>";
-                  html += "<div class='storage-value'>Limit: 200 KB (204,800 bytes)</div>";
-                  html += "<div class='storage-value'>Available: " + String((200 * 1024 - logUsage) / 1024) + " KB</div>";
-                  
-                  int logPercent = (logUsage * 100) / (200 * 1024);
-                  html += "<div class='progress-bar'>";
-                  html += "<div class='progress-fill log-progress' style='width: " + String(logPercent) + "%'></div>";
-                  html += "</div>";
-                  html += "<div>Log Usage: " + String(logPercent) + "%</div>";
-                  html += "</div>";
-                  
-                  // Storage Breakdown
-                  html += "<div class='storage-item'>";
-                  html += "<div class='storage-label'>📁 Storage Breakdown</div>";
-                  html += "<div>• Settings: ~1 KB</div>";
-                  html += "<div>• WebUI Assets: Embedded in firmware</div>";
-                  html += "<div>• Log Files: " + String(logUsage / 1024) + " KB</div>";
-                  html += "<div>• Other Files: " + String((usedBytes - logUsage) / 1024) + " KB</div>";
-                  html += "<p style='margin-top: 10px; font-size: 0.9em; color: #666;'>• Logs are automatically rotated when they exceed 200KB</p>";
-                  html += "</div>";
-                  
-                  // Actions
-                  html += "<div class='storage-item' style='text-align: center;'>";
-                  html += "<div class='storage-label'>🔧 Actions</div>";
-                  html += "<button onclick='clearLogs()' style='margin: 5px; padding: 8px 15px; background: #dc3545; color: white; border: none; border-radius: 4px; cursor: pointer;'>Clear All Logs</button>";
-                  html += "<button onclick='location.reload()' style='margin: 5px; padding: 8px 15px; background: #28a745; color: white; border: none; border-radius: 4px; cursor: pointer;'>Refresh</button>";
-                  html += "</div>";
-                  
-                  html += "</div>";
-                  
-                  // JavaScript
-                  html += "<script>";
-                  html += "function clearLogs() {";
-                  html += "  if (confirm('Are you sure you want to clear all logs?')) {";
-                  html += "    fetch('/logs/clear', { method: 'POST' })";
-                  html += "      .then(response => response.text())";
-                  html += "      .then(data => { alert(data); location.reload(); })";
-                  html += "      .catch(error => alert('Error: ' + error));";
-                  html += "  }";
-                  html += "}";
-                  html += "</script>";
-                  
-                  html += "</body></html>";
-                  
-                  request->send(200, "text/html", html);
+                  EndpointProbe probe("/storage/view");
+                  storage_snapshot_t snapshot = storageSnapshot();
+                  request->send(200, "text/html", (const uint8_t *) STORAGE_VIEW_HTML,
+                                strlen_P(STORAGE_VIEW_HTML),
+                                [snapshot](const String &name)
+                                { return storageViewPlaceholder(snapshot, name); });
               });
 
     // Restart endpoint
     server.on("/restart", HTTP_POST,
               [](AsyncWebServerRequest *request)
               {
+                  TRACE_SPAN("/restart");
                   logger.log("Restart requested via WebUI");
                   request->send(200, "text/plain", "Restarting device...");
                   // Delay restart to allow response to be sent
@@ -472,6 +661,7 @@ void WebServer::begin()
     server.on("/test_pause", HTTP_POST,
               [this](AsyncWebServerRequest *request)
               {
+                  TRACE_SPAN("/test_pause");
                   logger.log("Test pause requested via WebUI");
                   elegooCC.pausePrint();
                   request->send(200, "text/plain", "Test pause command sent");
@@ -480,18 +670,25 @@ void WebServer::begin()
     server.on("/test_movement_stop", HTTP_POST,
               [this](AsyncWebServerRequest *request)
               {
+                  TRACE_SPAN("/test_movement_stop");
                   logger.log("Test movement stop requested via WebUI - simulating filament stopped for 10 minutes");
                   elegooCC.triggerTestMovementStop();
                   request->send(200, "text/plain", "Test movement stop triggered - filament will appear stopped for 10 minutes");
               });
 
-    // Timeseries data endpoints
+    // Timeseries data endpoints. Each also answers Accept: application/msgpack with the
+    // points as columns.
     server.on("/api/timeseries/movement", HTTP_GET,
               [](AsyncWebServerRequest *request)
               {
+                  EndpointProbe probe("/api/timeseries/movement");
                   if (movementData) {
-                      String data = movementData->getDataAsJSON(100);
-                      request->send(200, "application/json", data);
+                      uint32_t version = ResponseCache::combine(movementData->getVersion(), timeBase.getSyncCount());
+                      responseCache.send(request, CACHED_MOVEMENT, version,
+                                         movementData->getDataJsonCapacity(100),
+                                         [](JsonDocument &doc)
+                                         { movementData->writeDataJson(doc.to<JsonObject>(), 100); },
+                                         true);
                   } else {
                       request->send(500, "application/json", "{\"error\":\"Movement data not initialized\"}");
                   }
@@ -500,9 +697,14 @@ void WebServer::begin()
     server.on("/api/timeseries/runout", HTTP_GET,
               [](AsyncWebServerRequest *request)
               {
+                  EndpointProbe probe("/api/timeseries/runout");
                   if (runoutData) {
-                      String data = runoutData->getDataAsJSON(100);
-                      request->send(200, "application/json", data);
+                      uint32_t version = ResponseCache::combine(runoutData->getVersion(), timeBase.getSyncCount());
+                      responseCache.send(request, CACHED_RUNOUT, version,
+                                         runoutData->getDataJsonCapacity(100),
+                                         [](JsonDocument &doc)
+                                         { runoutData->writeDataJson(doc.to<JsonObject>(), 100); },
+                                         true);
                   } else {
                       request->send(500, "application/json", "{\"error\":\"Runout data not initialized\"}");
                   }
@@ -511,9 +713,14 @@ void WebServer::begin()
     server.on("/api/timeseries/connection", HTTP_GET,
               [](AsyncWebServerRequest *request)
               {
+                  EndpointProbe probe("/api/timeseries/connection");
                   if (connectionData) {
-                      String data = connectionData->getDataAsJSON(100);
-                      request->send(200, "application/json", data);
+                      uint32_t version = ResponseCache::combine(connectionData->getVersion(), timeBase.getSyncCount());
+                      responseCache.send(request, CACHED_CONNECTION, version,
+                                         connectionData->getDataJsonCapacity(100),
+                                         [](JsonDocument &doc)
+                                         { connectionData->writeDataJson(doc.to<JsonObject>(), 100); },
+                                         true);
                   } else {
                       request->send(500, "application/json", "{\"error\":\"Connection data not initialized\"}");
                   }
@@ -522,9 +729,14 @@ void WebServer::begin()
     server.on("/api/timeseries/pause_attempts", HTTP_GET,
               [](AsyncWebServerRequest *request)
               {
+                  EndpointProbe probe("/api/timeseries/pause_attempts");
                   if (pauseAttemptData) {
-                      String data = pauseAttemptData->getDataAsJSON(100);
-                      request->send(200, "application/json", data);
+                      uint32_t version = ResponseCache::combine(pauseAttemptData->getVersion(), timeBase.getSyncCount());
+                      responseCache.send(request, CACHED_PAUSE_ATTEMPTS, version,
+                                         pauseAttemptData->getDataJsonCapacity(100),
+                                         [](JsonDocument &doc)
+                                         { pauseAttemptData->writeDataJson(doc.to<JsonObject>(), 100); },
+                                         true);
                   } else {
                       request->send(500, "application/json", "{\"error\":\"Pause attempt data not initialized\"}");
                   }
@@ -533,18 +745,55 @@ void WebServer::begin()
     server.on("/api/timeseries/pause_attempts/stats", HTTP_GET,
               [](AsyncWebServerRequest *request)
               {
+                  EndpointProbe probe("/api/timeseries/pause_attempts/stats");
                   if (pauseAttemptData) {
-                      String stats = pauseAttemptData->getStatistics();
-                      request->send(200, "application/json", stats);
+                      responseCache.send(request, CACHED_PAUSE_STATS, pauseAttemptData->getVersion(),
+                                         PAUSE_STATISTICS_JSON_SIZE,
+                                         [](JsonDocument &doc)
+                                         { pauseAttemptData->writeStatistics(doc.to<JsonObject>()); });
                   } else {
                       request->send(500, "application/json", "{\"error\":\"Pause attempt data not initialized\"}");
                   }
               });
 
+    // Print job index: recent jobs, or one job with its series slice when ?id= is given
+    server.on("/api/jobs", HTTP_GET,
+              [](AsyncWebServerRequest *request)
+              {
+                  EndpointProbe probe("/api/jobs");
+                  if (request->hasParam("id"))
+                  {
+                      uint32_t id     = request->getParam("id")->value().toInt();
+                      size_t   points = 200;
+                      if (request->hasParam("points"))
+                      {
+                          points = constrain(request->getParam("points")->value().toInt(), 1, 500);
+                      }
+                      PooledJsonDocument doc(printJobIndex.getJobJsonCapacity(points));
+                      if (!printJobIndex.writeJobJson(doc->to<JsonObject>(), id, points))
+                      {
+                          request->send(404, "application/json", "{\"error\":\"Job not found\"}");
+                          return;
+                      }
+                      sendJson(request, *doc);
+                      return;
+                  }
+
+                  int limit = 20;
+                  if (request->hasParam("limit"))
+                  {
+                      limit = request->getParam("limit")->value().toInt();
+                  }
+                  PooledJsonDocument doc(printJobIndex.getJobsJsonCapacity(limit));
+                  printJobIndex.writeJobsJson(doc->to<JsonObject>(), limit);
+                  sendJson(request, *doc);
+              });
+
     // Clear timeseries data endpoints
     server.on("/api/timeseries/clear", HTTP_POST,
               [](AsyncWebServerRequest *request)
               {
+                  TRACE_SPAN("/api/timeseries/clear");
                   if (movementData) movementData->clearData();
                   if (runoutData) runoutData->clearData();
                   if (connectionData) connectionData->clearData();
@@ -552,11 +801,26 @@ void WebServer::begin()
                   request->send(200, "text/plain", "All timeseries data cleared");
               });
 
-    // Favicon not embedded - browsers will handle gracefully without it
-    
+#ifdef ENABLE_TRACING
+    // Recorded spans as Chrome trace_event JSON, for chrome://tracing or ui.perfetto.dev
+    server.on("/api/trace", HTTP_GET,
+              [](AsyncWebServerRequest *request) { tracer.handle(request); });
+#endif
+
+#ifdef ENABLE_PROFILER
+    // Sampling CPU profiler; symbolize the export with profile_symbolize.py
+    server.on("/api/profile/start", HTTP_POST,
+              [](AsyncWebServerRequest *request) { profiler.handleStart(request); });
+    server.on("/api/profile/stop", HTTP_POST,
+              [](AsyncWebServerRequest *request) { profiler.handleStop(request); });
+    server.on("/api/profile", HTTP_GET,
+              [](AsyncWebServerRequest *request) { profiler.handleExport(request); });
+#endif
+
     // SPA fallback and asset serving
     server.onNotFound([](AsyncWebServerRequest *request) {
-        String path = request->url();
+        TRACE_SPAN("web_ui");
+        const String &path = request->url();
         
         // Check if it's an API endpoint
         if (path.startsWith("/get_") || path.startsWith("/update_") || 
@@ -566,30 +830,25 @@ void WebServer::begin()
             request->send(404, "text/plain", "Not Found");
             return;
         }
-        
-        // Handle CSS files
-        if (path.startsWith("/assets/") && path.endsWith(".css")) {
-            AsyncWebServerResponse *response = request->beginResponse(200, webui_css_mime, webui_css_gz, webui_css_gz_len);
-            if (webui_css_compressed) response->addHeader("Content-Encoding", "gzip");
-            response->addHeader("Cache-Control", "max-age=31536000");
-            request->send(response);
-            return;
-        }
-        
-        // Handle JS files
-        if (path.startsWith("/assets/") && path.endsWith(".js")) {
-            AsyncWebServerResponse *response = request->beginResponse(200, webui_js_mime, webui_js_gz, webui_js_gz_len);
-            if (webui_js_compressed) response->addHeader("Content-Encoding", "gzip");
-            response->addHeader("Cache-Control", "max-age=31536000");
-            request->send(response);
-            return;
+
+        const embedded_asset_t *asset = findEmbeddedAsset(path.c_str(), path.length());
+        if (asset == nullptr)
+        {
+            // A chunk from another build must fail to load rather than get index.html
+            if (path.startsWith("/assets/"))
+            {
+                request->send(404, "text/plain", "Not Found");
+                return;
+            }
+            // Client-side route
+            asset = getEmbeddedIndex();
+            if (asset == nullptr)
+            {
+                request->send(404, "text/plain", "Web UI not embedded");
+                return;
+            }
         }
-        
-        // Serve embedded WebUI index file for all other routes (SPA fallback)
-        AsyncWebServerResponse *response = request->beginResponse(200, webui_index_html_mime, webui_index_html_gz, webui_index_html_gz_len);
-        if (webui_index_html_compressed) response->addHeader("Content-Encoding", "gzip");
-        response->addHeader("Cache-Control", "no-cache, no-store, must-revalidate");
-        request->send(response);
+        sendEmbeddedAsset(request, asset);
     });
 }
 
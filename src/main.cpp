@@ -1,16 +1,26 @@
 #include <Arduino.h>
-#include <ESPmDNS.h>
 #include <WiFi.h>
 
+#include "BootTimeline.h"
+#include "ConnectivityManager.h"
 #include "ElegooCC.h"
+#include "FlushScheduler.h"
+#include "ImprovSerial.h"
+#include "JobScheduler.h"
 #include "LittleFS.h"
 #include "Logger.h"
+#include "LoopWatchdog.h"
 #include "SettingsManager.h"
+#include "StorageManager.h"
 #include "WebServer.h"
-#include "improv.h"
 #include "time.h"
 #include "TimeSeriesData.h"
 #include "PauseAttemptData.h"
+#include "PrintJobIndex.h"
+#include "PushChannel.h"
+#include "SystemMetrics.h"
+#include "TimeBase.h"
+#include "Trace.h"
 
 #define SPIFFS LittleFS
 
@@ -31,27 +41,17 @@
 const char* firmwareVersion = GET_VERSION_STRING(FIRMWARE_VERSION_RAW, "dev");
 const char* chipFamily      = GET_VERSION_STRING(CHIP_FAMILY_RAW, "Unknown");
 
-#define WIFI_CHECK_INTERVAL 30000     // Check WiFi every 30 seconds
-#define WIFI_RECONNECT_TIMEOUT 10000  // Wait 10 seconds for reconnection
-#define NTP_SYNC_INTERVAL 3600000     // Re-sync with NTP every hour (3600000 ms)
-
-// NTP server to request epoch time
-const char* ntpServer = "pool.ntp.org";
+#define SAMPLE_INTERVAL_MS 2000  // Time series sampling
+#define LOOP_MAX_IDLE_MS 5       // Sensor pins and the websocket are still polled
+#define BOOT_DEFER_TIMEOUT_MS 15000  // Deferred boot work starts by then even without a printer
 
 WebServer webServer(80);
 
-// Variables to track WiFi connection monitoring
-unsigned long lastWifiCheck      = 0;
-unsigned long wifiReconnectStart = 0;
-bool          isReconnecting     = false;
-
-// These things get setup in the loop, not setup, so we need to track if they've happened
-bool isWifiSetup      = false;
+// The printer connection needs WiFi first, so it's set up from the loop
 bool isElegooSetup    = false;
-bool isWebServerSetup = false;
-bool isNtpSetup       = false;
+bool isDeferredBootStarted = false;
 
-// Uptime tracking (starts after NTP sync)
+// Uptime tracking (starts after NTP setup)
 unsigned long uptimeStartMillis = 0;
 bool uptimeStarted = false;
 
@@ -64,10 +64,6 @@ PauseAttemptData* pauseAttemptData = nullptr;
 // Forward declaration
 unsigned long getTime();
 
-// Used by improv-wifi to parse serial data
-uint8_t x_buffer[16];
-uint8_t x_position = 0;
-
 // Function to get uptime in seconds since NTP sync
 unsigned long getUptimeSeconds() {
     if (!uptimeStarted) {
@@ -103,191 +99,84 @@ String getUptimeFormatted() {
     return result;
 }
 
-// Variables to track NTP synchronization
-unsigned long lastNTPSyncAttempt = 0;
-
-// If wifi fails, revert to AP mode and restart (only if never connected before);
-void failWifi()
+// Deferred boot phase, one history store per run so the loop keeps polling the sensors
+// in between
+static void loadNextHistoryStore()
 {
-    // Only revert to AP mode if WiFi has never successfully connected
-    if (!settingsManager.getHasConnected())
+    static int next = 0;
+    switch (next++)
     {
-        settingsManager.setAPMode(true);
-        if (settingsManager.save())
-        {
-            logger.log("Failed to connect to wifi, reverted to AP mode (first connection attempt)");
-        }
-        else
-        {
-            logger.log("Failed to update settings");
-        }
-
-        delay(1000);  // Give time for serial output
-        ESP.restart();
+        case 0:
+            movementData->load();
+            break;
+        case 1:
+            runoutData->load();
+            break;
+        case 2:
+            connectionData->load();
+            break;
+        case 3:
+            pauseAttemptData->load();
+            break;
     }
-    else
+    if (next < 4)
     {
-        logger.log("WiFi connection failed, retrying in 30 seconds");
-        // Don't restart, just continue trying to reconnect in checkWifiConnection()
+        jobScheduler.scheduleOnce("history_load", 0, JOB_PRIORITY_LOW, loadNextHistoryStore);
+        return;
     }
+    bootTimeline.mark(BOOT_PHASE_HISTORY_LOADED);
+    logger.logf("History loaded %lu ms after reset",
+                (unsigned long) (bootTimeline.getPhaseUs(BOOT_PHASE_HISTORY_LOADED) / 1000));
 }
 
-void startAPMode()
+// Everything detection doesn't need: the web UI, push channel, metrics exporter and history
+// files. Runs once detection is up, or after BOOT_DEFER_TIMEOUT_MS (no printer, AP mode).
+static void startDeferredBoot()
 {
-    logger.log("Starting AP mode");
-    WiFi.softAP("ElegooXBTTSFS20", "elegooccsfs20");
-    // Stop mDNS as it's not needed in AP mode
-    MDNS.end();
-}
-
-void handleSuccessfulWifiConnection()
-{
-    logger.log("WiFi Connected");
-
-    // Mark that WiFi has successfully connected at least once
-    if (!settingsManager.getHasConnected())
+    if (isDeferredBootStarted)
     {
-        settingsManager.setHasConnected(true);
-        settingsManager.save();
-        logger.log("First successful WiFi connection recorded");
+        return;
     }
+    isDeferredBootStarted = true;
 
-    // Reset any reconnection state
-    isReconnecting = false;
+    webServer.begin();
+    bootTimeline.mark(BOOT_PHASE_WEB_SERVER);
+    logger.log("Webserver setup complete");
 
-    // Start/restart mDNS for station mode
-    MDNS.end();
-    if (!MDNS.begin("ccxsfs20"))
-    {
-        logger.log("Error setting up MDNS responder!");
-    }
+    jobScheduler.scheduleOnce("history_load", 0, JOB_PRIORITY_LOW, loadNextHistoryStore);
 }
 
-bool connectToWifiStation(bool isReconnect = false)
+// Timeseries sample, every SAMPLE_INTERVAL_MS while connected to WiFi
+void collectSample()
 {
-    const char* action = isReconnect ? "Reconnecting to" : "Connecting to";
-    logger.logf("%s WiFi: %s", action, settingsManager.getSSID().c_str());
-
-    WiFi.begin(settingsManager.getSSID().c_str(), settingsManager.getPassword().c_str());
-
-    int attempts = 0;
-    while (WiFi.status() != WL_CONNECTED && attempts < 30)
-    {
-        Serial.print('.');
-        delay(1000);
-        attempts++;
-    }
-
-    Serial.println();
-
-    if (WiFi.status() == WL_CONNECTED)
+    if (!isElegooSetup || settingsManager.isAPMode() || !connectivityManager.isConnected())
     {
-        handleSuccessfulWifiConnection();
-        return true;
-    }
-    else
-    {
-        if (isReconnect)
-        {
-            logger.log("Failed to connect with new WiFi credentials");
-        }
-        else
-        {
-            failWifi();
-        }
-        return false;
-    }
-}
-
-void cleanupWifiConnections()
-{
-    // Stop AP mode if it was running
-    WiFi.softAPdisconnect(true);
-    // Disconnect from any existing station connection
-    WiFi.disconnect(true);
-    delay(1000);
-}
-
-bool wifiSetup()
-{
-    if (settingsManager.isAPMode())
-    {
-        startAPMode();
-        logger.log("Wifi setup in AP mode");
-        return false;
+        return;
     }
-    else
+    if (!movementData || !runoutData || !connectionData)
     {
-        return connectToWifiStation(false);
+        return;
     }
-}
-
-bool reconnectWifiWithNewCredentials()
-{
-    logger.log("Applying new WiFi credentials...");
-
-    // Clean up any existing connections first
-    cleanupWifiConnections();
-
-    // Check if we're switching to AP mode
-    if (settingsManager.isAPMode())
+    // addDataPoint() would load a store on the spot; leave that to loadNextHistoryStore
+    if (!bootTimeline.isMarked(BOOT_PHASE_HISTORY_LOADED))
     {
-        logger.log("Switching to AP mode");
-        startAPMode();
-        return false;
+        return;
     }
+    printer_info_t info = elegooCC.getCurrentInformation();
 
-    // We're switching to or staying in station mode
-    logger.log("Connecting to WiFi station mode with new credentials...");
-    return connectToWifiStation(true);
-}
+    // Movement detection (1 = movement detected, 0 = no movement)
+    bool movementDetected = digitalRead(MOVEMENT_SENSOR_PIN) == LOW;
+    movementData->addDataPoint(movementDetected ? 1.0 : 0.0);
 
-void checkWifiConnection()
-{
-    logger.log("Checking WiFi connection");
+    // Runout detection (1 = runout detected, 0 = filament present)
+    runoutData->addDataPoint(info.filamentRunout ? 1.0 : 0.0);
 
-    // Skip check if already in AP mode
-    if (settingsManager.isAPMode())
-    {
-        logger.log("Skipping WiFi check in AP mode");
-        return;
-    }
+    // Connection status (1 = connected, 0 = disconnected)
+    connectionData->addDataPoint(info.isWebsocketConnected ? 1.0 : 0.0);
 
-    // Check if WiFi is connected
-    if (WiFi.status() != WL_CONNECTED)
-    {
-        if (!isReconnecting)
-        {
-            logger.log("WiFi disconnected, attempting to reconnect...");
-            WiFi.begin(settingsManager.getSSID().c_str(), settingsManager.getPassword().c_str());
-            wifiReconnectStart = millis();
-            isReconnecting     = true;
-        }
-        else
-        {
-            // Check if reconnection timeout has elapsed
-            if (millis() - wifiReconnectStart >= WIFI_RECONNECT_TIMEOUT)
-            {
-                failWifi();
-            }
-        }
-    }
-    else
-    {
-        // WiFi is connected, reset reconnection state
-        if (isReconnecting)
-        {
-            logger.log("WiFi reconnected successfully");
-            isReconnecting = false;
-
-            // Mark that WiFi has successfully connected at least once
-            if (!settingsManager.getHasConnected())
-            {
-                settingsManager.setHasConnected(true);
-                settingsManager.save();
-            }
-        }
-    }
+    pushChannel.publishSample(getTime(), movementDetected ? 1.0 : 0.0,
+                              info.filamentRunout ? 1.0 : 0.0,
+                              info.isWebsocketConnected ? 1.0 : 0.0);
 }
 
 void setup()
@@ -297,233 +186,94 @@ void setup()
     pinMode(MOVEMENT_SENSOR_PIN, INPUT_PULLUP);
     Serial.begin(115200);
 
+    bootTimeline.mark(BOOT_PHASE_SETUP);
+#ifdef ENABLE_TRACING
+    tracer.begin();
+#endif
+
     // Initialize logging system
     logger.log("ESP SFS System starting up...");
     logger.logf("Firmware version: %s", firmwareVersion);
     logger.logf("Chip family: %s", chipFamily);
+    logger.logf("Reset reason: %s", BootTimeline::getResetReasonName());
 
-    // Initialize LittleFS with auto-format if corrupted
-    if (!SPIFFS.begin(true)) {  // true = format if mount fails
-        logger.log("LittleFS mount failed, formatting...");
-        if (SPIFFS.format()) {
-            logger.log("LittleFS formatted successfully");
-            if (SPIFFS.begin()) {
-                logger.log("LittleFS mounted after format");
-            } else {
-                logger.log("LittleFS mount failed even after format!");
-            }
-        } else {
-            logger.log("LittleFS format failed!");
-        }
-    } else {
-        logger.log("LittleFS mounted successfully");
-    }
+    // Only what detection needs runs here; the rest waits for startDeferredBoot()
+
+    // CPU, task, loop timing and heap sampling in the background; cheap, and covers boot too
+    systemMetrics.begin();
+
+    // Mount LittleFS (formatting it if corrupted) and pick up the sizes of tracked files
+    storageManager.begin();
+    bootTimeline.mark(BOOT_PHASE_STORAGE);
+    // Coalesced flash writes, with a final flush hooked into esp_restart()
+    flushScheduler.begin();
 
     // Load settings early
     settingsManager.load();
+    bootTimeline.mark(BOOT_PHASE_SETTINGS);
     logger.log("Settings Manager Loaded");
+
+    // Starts connecting (or the AP) without waiting; connectivityManager.loop() follows up
+    connectivityManager.begin();
+    bootTimeline.mark(BOOT_PHASE_NETWORK);
+    logger.log("Wifi setup complete");
     
-    // Initialize timeseries data storage
+    // Initialize timeseries data storage; the files are read in the deferred boot phase
     movementData = new TimeSeriesData("/movement_data.json");
     runoutData = new TimeSeriesData("/runout_data.json");
     connectionData = new TimeSeriesData("/connection_data.json");
-    pauseAttemptData = new PauseAttemptData("/pause_attempt_data.json");
+    pauseAttemptData = new PauseAttemptData("/pause_attempts.bin");
+    // Pause attempts used to be a JSON snapshot that was never actually written; drop any leftover
+    SPIFFS.remove("/pause_attempt_data.json");
     logger.log("Timeseries data storage initialized");
-}
-
-void syncTimeWithNTP(unsigned long currentTime)
-{
-    struct tm timeinfo;
-    lastNTPSyncAttempt = currentTime;
-    if (getLocalTime(&timeinfo))
-    {
-        logger.log("NTP time synchronization successful");
-    }
-    else
-    {
-        logger.log("NTP time synchronization failed");
-    }
-}
-
-unsigned long getTime()
-{
-    time_t now;
-    time(&now);
-    return now;
-}
-
-void onImprovErrorCallback(improv::Error err)
-{
-    logger.logf("Improv error: %d", err);
-}
-
-std::vector<std::string> getLocalUrl()
-{
-    return {// URL where user can finish onboarding or use device
-            // Recommended to use website hosted by device
-            String("http://" + WiFi.localIP().toString()).c_str()};
-}
 
-void getAvailableWifiNetworks()
-{
-    int networkNum = WiFi.scanNetworks();
-
-    for (int id = 0; id < networkNum; ++id)
-    {
-        std::vector<uint8_t> data =
-            improv::build_rpc_response(improv::GET_WIFI_NETWORKS,
-                                       {WiFi.SSID(id), String(WiFi.RSSI(id)),
-                                        (WiFi.encryptionType(id) == WIFI_AUTH_OPEN ? "NO" : "YES")},
-                                       false);
-        improv::send_response(data);
-        delay(1);
-    }
-    // final response
-    std::vector<uint8_t> data =
-        improv::build_rpc_response(improv::GET_WIFI_NETWORKS, std::vector<std::string>{}, false);
-    improv::send_response(data);
-}
-
-bool onImprovCommandCallback(improv::ImprovCommand cmd)
-{
-    switch (cmd.command)
-    {
-        case improv::Command::GET_CURRENT_STATE:
-        {
-            if ((WiFi.status() == WL_CONNECTED))
-            {
-                improv::set_state(improv::State::STATE_PROVISIONED);
-                std::vector<uint8_t> data =
-                    improv::build_rpc_response(improv::GET_CURRENT_STATE, getLocalUrl(), false);
-                improv::send_response(data);
-            }
-            else
-            {
-                improv::set_state(improv::State::STATE_AUTHORIZED);
-            }
-
-            break;
-        }
-
-        case improv::Command::WIFI_SETTINGS:
-        {
-            if (cmd.ssid.length() == 0)
-            {
-                improv::set_error(improv::Error::ERROR_INVALID_RPC);
-                break;
-            }
-
-            improv::set_state(improv::STATE_PROVISIONING);
-
-            settingsManager.setSSID(cmd.ssid.c_str());
-            settingsManager.setPassword(cmd.password.c_str());
-            settingsManager.setAPMode(false);
-            settingsManager.save(true);  // skip wifi check, we're about to try connecting
-
-            if (reconnectWifiWithNewCredentials())  // connectWifi(cmd.ssid, cmd.password)
-            {
-                improv::set_state(improv::STATE_PROVISIONED);
-                std::vector<uint8_t> data =
-                    improv::build_rpc_response(improv::WIFI_SETTINGS, getLocalUrl(), false);
-                improv::send_response(data);
-            }
-            else
-            {
-                improv::set_state(improv::STATE_STOPPED);
-                improv::set_error(improv::Error::ERROR_UNABLE_TO_CONNECT);
-            }
-
-            break;
-        }
+    // Small, and the pause path updates it, so it stays on the critical path
+    printJobIndex.load();
 
-        case improv::Command::GET_DEVICE_INFO:
-        {
-            std::vector<std::string> infos = {// Firmware name
-                                              "CC_SFS",
-                                              // Firmware version
-                                              firmwareVersion,
-                                              // Hardware chip/variant
-                                              chipFamily,
-                                              // Device name
-                                              "CC_SFS"};
-            std::vector<uint8_t>     data =
-                improv::build_rpc_response(improv::GET_DEVICE_INFO, infos, false);
-            improv::send_response(data);
-            break;
-        }
+    // Improv WiFi provisioning reads the serial port from its own task
+    improvSerial.begin();
 
-        case improv::Command::GET_WIFI_NETWORKS:
-        {
-            getAvailableWifiNetworks();
-            break;
-        }
+    jobScheduler.schedulePeriodic("sample", SAMPLE_INTERVAL_MS, JOB_PRIORITY_NORMAL,
+                                  collectSample, SAMPLE_INTERVAL_MS);
+    // There's no printer to wait for in AP mode, the web UI is what's needed there
+    jobScheduler.scheduleOnce("boot_deferred",
+                              settingsManager.isAPMode() ? 0 : BOOT_DEFER_TIMEOUT_MS,
+                              JOB_PRIORITY_LOW, startDeferredBoot);
 
-        default:
-        {
-            improv::set_error(improv::ERROR_UNKNOWN_RPC);
-            return false;
-        }
-    }
+    // Per-phase loop timing, and the task watchdog from here on
+    loopWatchdog.begin();
 
-    return true;
+    bootTimeline.mark(BOOT_PHASE_SETUP_DONE);
 }
 
-bool handleImprovWifi()
+// Seconds on the shared timebase: epoch once NTP has synced, time since boot before
+unsigned long getTime()
 {
-    if (Serial.available() > 0)
-    {
-        uint8_t b = Serial.read();
-
-        if (parse_improv_serial_byte(x_position, b, x_buffer, onImprovCommandCallback,
-                                     onImprovErrorCallback))
-        {
-            x_buffer[x_position++] = b;
-        }
-        else
-        {
-            x_position = 0;
-        }
-        return true;
-    }
-    return false;
+    return timeBase.toSeconds(timeBase.now());
 }
 
 void loop()
 {
-    // handling immprovWifi should be the first thing we do
-    if (handleImprovWifi())
-    {
-        // if we handled serial data, don't return so we don't bother with the rest of the setup
-        return;
-    }
-    unsigned long currentTime     = millis();
-    bool          isWifiConnected = !settingsManager.isAPMode() && WiFi.status() == WL_CONNECTED;
-
-    if (!isWifiSetup)
-    {
-        isWifiSetup = wifiSetup();
-        isWifiSetup = true;
-        logger.log("Wifi setup complete");
-        return;  //
-    }
-    if (!isWebServerSetup)
-    {
-        webServer.begin();
-        isWebServerSetup = true;
-        logger.log("Webserver setup complete");
-        return;  //
-    }
+    loopWatchdog.feed();
+    systemMetrics.recordLoopIteration();
 
     // Check if WiFi reconnection is requested
-
     if (settingsManager.requestWifiReconnect)
     {
         settingsManager.requestWifiReconnect = false;
-        reconnectWifiWithNewCredentials();
+        connectivityManager.applyCredentials();
     }
 
+    loopWatchdog.enterPhase(LOOP_PHASE_CONNECTIVITY);
+    connectivityManager.loop();
+    loopWatchdog.enterPhase(LOOP_PHASE_OTHER);
+    settings_snapshot_t settings;
+    settingsManager.getSnapshot(settings);
+    bool isWifiConnected = !settings.ap_mode && connectivityManager.isConnected();
+
     if (isWifiConnected)
     {
+        loopWatchdog.enterPhase(LOOP_PHASE_ELEGOO);
         if (!isElegooSetup)
         {
             elegooCC.setup();
@@ -531,50 +281,26 @@ void loop()
             isElegooSetup = true;
         }
         elegooCC.loop();
-        
-        // Collect timeseries data every 2 seconds
-        static unsigned long lastDataCollection = 0;
-        if (currentTime - lastDataCollection >= 2000) {
-            lastDataCollection = currentTime;
-            
-            if (movementData && runoutData && connectionData) {
-                printer_info_t info = elegooCC.getCurrentInformation();
-                
-                // Movement detection (1 = movement detected, 0 = no movement)
-                bool movementDetected = digitalRead(MOVEMENT_SENSOR_PIN) == LOW;
-                movementData->addDataPoint(movementDetected ? 1.0 : 0.0);
-                
-                // Runout detection (1 = runout detected, 0 = filament present)
-                runoutData->addDataPoint(info.filamentRunout ? 1.0 : 0.0);
-                
-                // Connection status (1 = connected, 0 = disconnected)
-                connectionData->addDataPoint(info.isWebsocketConnected ? 1.0 : 0.0);
-            }
-        }
-
-        if (!isNtpSetup)
+        loopWatchdog.enterPhase(LOOP_PHASE_OTHER);
+        if (!isDeferredBootStarted && bootTimeline.isMarked(BOOT_PHASE_DETECTION))
         {
-            configTime(0, 0, ntpServer);
-            syncTimeWithNTP(currentTime);
-            logger.log("NTP setup complete");
-            isNtpSetup = true;
-            
-            // Start uptime tracking after NTP sync
-            if (!uptimeStarted) {
-                uptimeStartMillis = millis();
-                uptimeStarted = true;
-                logger.log("Uptime tracking started");
-            }
+            startDeferredBoot();
         }
-        else if (currentTime - lastNTPSyncAttempt >= NTP_SYNC_INTERVAL)
-        {
-            syncTimeWithNTP(currentTime);
+        
+        // Start uptime tracking once NTP is set up
+        if (!uptimeStarted && connectivityManager.isNtpStarted()) {
+            uptimeStartMillis = millis();
+            uptimeStarted = true;
+            logger.log("Uptime tracking started");
         }
     }
-    else if (currentTime - lastWifiCheck >= WIFI_CHECK_INTERVAL)
-    {
-        checkWifiConnection();
-    }
 
+    // Periodic work (sampling, status push, printer ping, flushes) runs from the job scheduler
+    loopWatchdog.enterPhase(LOOP_PHASE_JOBS);
+    jobScheduler.tick();
+    loopWatchdog.enterPhase(LOOP_PHASE_WEB);
     webServer.loop();
+
+    // Sleep until the next job is due instead of spinning
+    jobScheduler.idle(LOOP_MAX_IDLE_MS);
 }
@@ -306,6 +306,37 @@ async function createServer() {
     return;
   });
 
+  app.use("/api/dashboard", async (req, res) => {
+    const sections = (req.query.sections || "status,settings,series,pause,health").split(",");
+    const since = Number(req.query.since) || 0;
+    const now = Math.floor(Date.now() / 1000);
+    const result = {};
+    if (sections.includes("status")) result.status = mockSensorStatus;
+    if (sections.includes("settings")) result.settings = { version: 1 };
+    if (sections.includes("series")) {
+      // One point every 2 s over the last 10 minutes, newer than the cursor
+      const points = [];
+      for (let t = now - 600; t <= now; t += 2) {
+        if (t > since) points.push(t);
+      }
+      result.series = {
+        movement: points.map((t) => ({ t, v: Math.random() > 0.2 ? 1 : 0 })),
+        runout: points.map((t) => ({ t, v: 0 })),
+        connection: points.map((t) => ({ t, v: 1 })),
+        cursor: points.length > 0 ? points[points.length - 1] : since,
+      };
+    }
+    if (sections.includes("pause")) {
+      result.pause = { attempts: { data: [] }, stats: { totalAttempts: 0 } };
+    }
+    if (sections.includes("health")) {
+      result.health = { free_heap: 180000, min_free_heap: 150000, uptime_ms: 60000 };
+    }
+    res.setHeader("Content-Type", "application/json");
+    res.end(JSON.stringify(result));
+    return;
+  });
+
   app.use("/logs", async (req, res) => {
     res.setHeader("Content-Type", "application/json");
     res.end(JSON.stringify(mockLogs));
@@ -1,4 +1,6 @@
 import { createSignal, onMount, onCleanup, createEffect } from 'solid-js'
+import { subscribe, pushConnected } from './pushChannel'
+import { fetchTelemetry } from './msgpack'
 
 interface LogEntry {
   uuid: string
@@ -25,11 +27,7 @@ function Logs() {
 
   const fetchLogs = async () => {
     try {
-      const response = await fetch('/api/logs')
-      if (!response.ok) {
-        throw new Error(`Failed to fetch logs: ${response.status} ${response.statusText}`)
-      }
-      const logData = await response.json() as {
+      const logData = await fetchTelemetry('/api/logs') as {
         logs: LogEntry[]
       }
 
@@ -62,7 +60,10 @@ function Logs() {
 
   const startAutoRefresh = () => {
     if (intervalId) clearInterval(intervalId)
-    intervalId = setInterval(fetchLogs, 5000) // Refresh every 5 seconds
+    // Refresh every 5 seconds while the push channel is down
+    intervalId = setInterval(() => {
+      if (!pushConnected()) fetchLogs()
+    }, 5000)
   }
 
   const stopAutoRefresh = () => {
@@ -103,6 +104,22 @@ function Logs() {
     setLoading(true)
     await fetchLogs()
     startAutoRefresh()
+
+    // New entries are pushed as they are logged
+    const unsubscribeLog = subscribe('log', (entry) => {
+      if (entry.truncated) {
+        fetchLogs()
+        return
+      }
+      if (!logs().some(log => log.uuid === entry.uuid)) {
+        setLogs([...logs(), entry as LogEntry])
+      }
+    })
+    const unsubscribeResync = subscribe('resync', fetchLogs)
+    onCleanup(() => {
+      unsubscribeLog()
+      unsubscribeResync()
+    })
     // Ensure we start at the bottom
     setTimeout(() => {
       scrollToBottom()
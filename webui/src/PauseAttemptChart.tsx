@@ -1,4 +1,5 @@
-import { createSignal, onMount, onCleanup } from 'solid-js'
+import { createSignal, createEffect, onMount, onCleanup } from 'solid-js'
+import { fetchTelemetry } from './msgpack'
 
 interface PauseAttemptPoint {
   timestamp: number
@@ -16,6 +17,12 @@ interface PauseAttemptStats {
   alreadyPaused: number
   dataSize: number
   maxDataSize: number
+  latency?: {
+    count: number
+    avgMs: number
+    maxMs: number
+    buckets: { le: number | string; count: number }[]
+  }
 }
 
 const PAUSE_ATTEMPT_TYPES = {
@@ -36,8 +43,10 @@ const PAUSE_ATTEMPT_COLORS = {
 
 interface Props {
   title: string
-  endpoint: string
-  statsEndpoint: string
+  // Either endpoints the chart polls itself, or a source it reads attempts and stats from
+  endpoint?: string
+  statsEndpoint?: string
+  source?: () => { attempts: { data: PauseAttemptPoint[] }; stats: PauseAttemptStats } | null
 }
 
 function PauseAttemptChart(props: Props) {
@@ -47,15 +56,13 @@ function PauseAttemptChart(props: Props) {
   const [error, setError] = createSignal<string | null>(null)
 
   const fetchData = async () => {
+    if (!props.endpoint || !props.statsEndpoint) return
     try {
       setError(null)
 
       // Fetch chart data
-      const dataResponse = await fetch(props.endpoint)
-      if (dataResponse.ok) {
-        const result = await dataResponse.json()
-        setData(result.data || [])
-      }
+      const result = await fetchTelemetry(props.endpoint)
+      setData(result.data || [])
 
       // Fetch statistics
       const statsResponse = await fetch(props.statsEndpoint)
@@ -72,6 +79,19 @@ function PauseAttemptChart(props: Props) {
   }
 
   onMount(() => {
+    if (props.source) {
+      const source = props.source
+      createEffect(() => {
+        const current = source()
+        if (current) {
+          setData(current.attempts.data || [])
+          setStats(current.stats)
+        }
+      })
+      setLoading(false)
+      return
+    }
+
     fetchData()
     const interval = setInterval(fetchData, 30000) // Refresh every 30 seconds
 
@@ -130,6 +150,18 @@ function PauseAttemptChart(props: Props) {
                   <div class="stat-title text-xs">Size</div>
                   <div class="stat-value text-sm">{Math.round(stats()!.dataSize / 1024)}KB</div>
                 </div>
+                {stats()!.latency && stats()!.latency!.count > 0 && (
+                  <>
+                    <div class="stat stat-compact">
+                      <div class="stat-title text-xs">Avg Pause Latency</div>
+                      <div class="stat-value text-sm">{stats()!.latency!.avgMs}ms</div>
+                    </div>
+                    <div class="stat stat-compact">
+                      <div class="stat-title text-xs">Max Pause Latency</div>
+                      <div class="stat-value text-sm">{stats()!.latency!.maxMs}ms</div>
+                    </div>
+                  </>
+                )}
               </div>
             )}
 
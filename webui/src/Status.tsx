@@ -1,6 +1,14 @@
 import { createSignal, onMount, onCleanup } from 'solid-js'
 import TimeSeriesChart from './TimeSeriesChart'
 import PauseAttemptChart from './PauseAttemptChart'
+import { subscribe, pushConnected } from './pushChannel'
+import {
+  fetchDashboard,
+  resetDashboardSeries,
+  followPushedSamples,
+  dashboardSeries,
+  dashboardPause,
+} from './dashboard'
 
 
 
@@ -66,11 +74,27 @@ function Status() {
     ap_mode: false
   })
 
-  const refreshSensorStatus = async () => {
-    const response = await fetch('/sensor_status')
-    const data = await response.json()
-    setSensorStatus(data)
-    setLoading(false)
+  let settingsVersion: number | null = null
+
+  // Status, settings version, new series points and pause data in one request
+  const refreshDashboard = async () => {
+    try {
+      const result = await fetchDashboard(['status', 'settings', 'series', 'pause'])
+      if (result.status) setSensorStatus(result.status)
+      if (result.settings && result.settings.version !== settingsVersion) {
+        settingsVersion = result.settings.version
+        await refreshSettings()
+      }
+    } catch (error) {
+      console.error('Failed to fetch dashboard:', error)
+    } finally {
+      setLoading(false)
+    }
+  }
+
+  const resync = () => {
+    resetDashboardSeries()
+    refreshDashboard()
   }
 
   const refreshSettings = async () => {
@@ -131,14 +155,34 @@ function Status() {
 
   onMount(async () => {
     setLoading(true)
-    await Promise.all([refreshSensorStatus(), refreshSettings()])
-    const intervalId = setInterval(refreshSensorStatus, 2500)
-    // Refresh settings less frequently
-    const settingsIntervalId = setInterval(refreshSettings, 10000)
+    resetDashboardSeries()
+    await refreshDashboard()
+
+    // Status deltas arrive over the push channel; only changed fields are sent
+    const unsubscribeStatus = subscribe('status', (delta) => {
+      const current = sensorStatus()
+      setSensorStatus({
+        ...current,
+        ...delta,
+        elegoo: { ...current.elegoo, ...(delta.elegoo || {}) },
+      })
+    })
+    const unsubscribeSamples = followPushedSamples()
+    const unsubscribeResync = subscribe('resync', resync)
+
+    // Poll only while the push channel is down, plus a slow refresh for uptime, settings
+    // and pause attempts
+    let ticks = 0
+    const intervalId = setInterval(() => {
+      ticks++
+      if (!pushConnected() || ticks % 12 === 0) refreshDashboard()
+    }, 2500)
 
     onCleanup(() => {
+      unsubscribeStatus()
+      unsubscribeSamples()
+      unsubscribeResync()
       clearInterval(intervalId)
-      clearInterval(settingsIntervalId)
     })
   })
 
@@ -222,14 +266,14 @@ function Status() {
             <div class="grid grid-cols-1 lg:grid-cols-2 gap-6">
               <TimeSeriesChart
                 title="🔄 Movement Detection"
-                endpoint="/api/timeseries/movement"
+                source={dashboardSeries('movement')}
                 color="#10b981"
                 yLabel="Movement"
               />
               
               <TimeSeriesChart
                 title="⚠️ Filament Runout"
-                endpoint="/api/timeseries/runout"
+                source={dashboardSeries('runout')}
                 color="#f59e0b"
                 yLabel="Runout Status"
               />
@@ -238,15 +282,14 @@ function Status() {
             <div class="grid grid-cols-1 lg:grid-cols-2 gap-6">
               <TimeSeriesChart
                 title="🔗 Printer Connection"
-                endpoint="/api/timeseries/connection"
+                source={dashboardSeries('connection')}
                 color="#3b82f6"
                 yLabel="Connected"
               />
               
               <PauseAttemptChart
                 title="⏸️ Pause Attempts"
-                endpoint="/api/timeseries/pause_attempts"
-                statsEndpoint="/api/timeseries/pause_attempts/stats"
+                source={dashboardPause}
               />
             </div>
           </div>
@@ -315,7 +358,7 @@ function Status() {
 
                 </div>
                 <div class="mt-4 text-xs text-base-content/70 text-center">
-                  Settings are refreshed every 10 seconds
+                  Settings are refreshed when they change on the device
                 </div>
               </div>
             </div>
@@ -31,10 +31,38 @@ interface SystemHealth {
     used_kb: number
     usage_percent: number
     largest_free_block_kb: number
+    psram?: {
+      available: boolean
+      total_bytes: number
+      free_bytes: number
+      largest_free_block: number
+    }
+    history?: {
+      fragmentation_percent: number
+      interval_s: number
+      free_kb: number[]
+      largest_free_block_kb: number[]
+    }
   }
   cpu: {
     frequency_mhz: number
     cores: number
+    usage_source?: 'runtime_stats' | 'idle_hook'
+    core_usage_percent?: (number | null)[]
+    tasks?: {
+      name: string
+      priority: number
+      core: number
+      stack_free_bytes: number
+      cpu_percent?: number
+    }[]
+  }
+  loop?: {
+    p50_us: number
+    p99_us: number
+    max_us: number
+    iterations_per_s: number
+    max_since_boot_us: number
   }
   flash: {
     total_kb: number
@@ -53,6 +81,15 @@ interface SystemHealth {
     seconds: number
     formatted: string
   }
+  endpoints?: Record<
+    string,
+    {
+      requests: number
+      peak_heap_bytes: number
+      last_heap_bytes: number
+      min_largest_free_block: number
+    }
+  >
 }
 
 function SystemHealth() {
@@ -219,6 +256,24 @@ function SystemHealth() {
                   <div class="text-sm text-gray-600">
                     Usage: {systemHealth()!.memory.usage_percent}%
                   </div>
+                  {systemHealth()!.memory.history && systemHealth()!.memory.history!.free_kb.length > 0 && (
+                    <div class="flex justify-between">
+                      <span>Fragmentation:</span>
+                      <span>
+                        {systemHealth()!.memory.history!.fragmentation_percent}% (largest block
+                        low {Math.min(...systemHealth()!.memory.history!.largest_free_block_kb)} KB)
+                      </span>
+                    </div>
+                  )}
+                  {systemHealth()!.memory.psram?.available && (
+                    <div class="flex justify-between">
+                      <span>PSRAM Free:</span>
+                      <span>
+                        {Math.round(systemHealth()!.memory.psram!.free_bytes / 1024)} /{' '}
+                        {Math.round(systemHealth()!.memory.psram!.total_bytes / 1024)} KB
+                      </span>
+                    </div>
+                  )}
                 </div>
               </div>
             </div>
@@ -236,9 +291,46 @@ function SystemHealth() {
                     <span>Cores:</span>
                     <span>{systemHealth()!.cpu.cores}</span>
                   </div>
-                  <div class="text-xs text-gray-500 mt-2">
-                    Note: Real-time CPU usage monitoring not available on ESP32
-                  </div>
+                  {systemHealth()!.cpu.core_usage_percent?.map((usage, core) => (
+                    <div>
+                      <div class="flex justify-between">
+                        <span>Core {core}:</span>
+                        <span>{usage === null ? 'Measuring…' : `${usage}%`}</span>
+                      </div>
+                      <div class="w-full bg-gray-200 rounded-full h-2.5">
+                        <div
+                          class="bg-orange-500 h-2.5 rounded-full"
+                          style={`width: ${usage || 0}%`}
+                        ></div>
+                      </div>
+                    </div>
+                  ))}
+                  {systemHealth()!.loop && (
+                    <div class="text-sm space-y-1 mt-2">
+                      <div class="flex justify-between">
+                        <span>Loop p50 / p99:</span>
+                        <span>
+                          {systemHealth()!.loop!.p50_us} / {systemHealth()!.loop!.p99_us} µs
+                        </span>
+                      </div>
+                      <div class="flex justify-between">
+                        <span>Loop max:</span>
+                        <span>
+                          {(systemHealth()!.loop!.max_us / 1000).toFixed(1)} ms (boot{' '}
+                          {(systemHealth()!.loop!.max_since_boot_us / 1000).toFixed(1)} ms)
+                        </span>
+                      </div>
+                      <div class="flex justify-between">
+                        <span>Loop rate:</span>
+                        <span>{systemHealth()!.loop!.iterations_per_s}/s</span>
+                      </div>
+                    </div>
+                  )}
+                  {systemHealth()!.cpu.usage_source === 'idle_hook' && (
+                    <div class="text-xs text-gray-500 mt-2">
+                      Core usage estimated from idle time; per-task shares need FreeRTOS run-time stats
+                    </div>
+                  )}
                 </div>
               </div>
             </div>
@@ -329,6 +421,70 @@ function SystemHealth() {
               </div>
             </div>
           </div>
+
+          {systemHealth()!.cpu.tasks && systemHealth()!.cpu.tasks!.length > 0 && (
+            <div class="card bg-base-100 shadow-xl mt-6">
+              <div class="card-body">
+                <h3 class="card-title text-lg">🧵 Tasks</h3>
+                <div class="overflow-x-auto">
+                  <table class="table table-sm">
+                    <thead>
+                      <tr>
+                        <th>Task</th>
+                        <th>Core</th>
+                        <th>Priority</th>
+                        <th>CPU</th>
+                        <th>Stack Free (min)</th>
+                      </tr>
+                    </thead>
+                    <tbody>
+                      {systemHealth()!.cpu.tasks!.map((task) => (
+                        <tr>
+                          <td class="font-mono text-sm">{task.name}</td>
+                          <td>{task.core < 0 ? 'any' : task.core}</td>
+                          <td>{task.priority}</td>
+                          <td>{task.cpu_percent === undefined ? '–' : `${task.cpu_percent}%`}</td>
+                          <td>{task.stack_free_bytes} B</td>
+                        </tr>
+                      ))}
+                    </tbody>
+                  </table>
+                </div>
+              </div>
+            </div>
+          )}
+
+          {systemHealth()!.endpoints && Object.keys(systemHealth()!.endpoints!).length > 0 && (
+            <div class="card bg-base-100 shadow-xl mt-6">
+              <div class="card-body">
+                <h3 class="card-title text-lg">🧮 Heap per Endpoint</h3>
+                <div class="overflow-x-auto">
+                  <table class="table table-sm">
+                    <thead>
+                      <tr>
+                        <th>Endpoint</th>
+                        <th>Requests</th>
+                        <th>Peak</th>
+                        <th>Last</th>
+                        <th>Min Largest Block</th>
+                      </tr>
+                    </thead>
+                    <tbody>
+                      {Object.entries(systemHealth()!.endpoints!).map(([name, stats]) => (
+                        <tr>
+                          <td class="font-mono text-sm">{name}</td>
+                          <td>{stats.requests}</td>
+                          <td>{(stats.peak_heap_bytes / 1024).toFixed(1)} KB</td>
+                          <td>{(stats.last_heap_bytes / 1024).toFixed(1)} KB</td>
+                          <td>{Math.round(stats.min_largest_free_block / 1024)} KB</td>
+                        </tr>
+                      ))}
+                    </tbody>
+                  </table>
+                </div>
+              </div>
+            </div>
+          )}
         </div>
       )}
 
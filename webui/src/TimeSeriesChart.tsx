@@ -1,4 +1,6 @@
-import { createSignal, createEffect, onMount } from 'solid-js'
+import { createSignal, createEffect, onMount, onCleanup } from 'solid-js'
+import { subscribe, pushConnected } from './pushChannel'
+import { fetchTelemetry } from './msgpack'
 
 interface DataPoint {
   t: number
@@ -7,12 +9,19 @@ interface DataPoint {
 
 interface TimeSeriesChartProps {
   title: string
-  endpoint: string
+  // Either an endpoint the chart polls itself, or a source it reads points from
+  endpoint?: string
+  source?: () => DataPoint[]
   color?: string
   yLabel?: string
   height?: number
+  // Key of this series in pushed 'sample' events
+  liveSeries?: 'movement' | 'runout' | 'connection'
 }
 
+// Cap on points kept client-side when appending pushed samples
+const MAX_LIVE_POINTS = 2000
+
 interface ChartState {
   zoomLevel: number
   timeRange: number // in minutes
@@ -31,8 +40,8 @@ export default function TimeSeriesChart(props: TimeSeriesChartProps) {
 
   const fetchData = async () => {
     try {
-      const response = await fetch(props.endpoint)
-      const result = await response.json()
+      if (!props.endpoint) return
+      const result = await fetchTelemetry(props.endpoint)
       if (result.data) {
         setData(result.data)
       }
@@ -244,10 +253,34 @@ export default function TimeSeriesChart(props: TimeSeriesChartProps) {
   }
 
   onMount(() => {
+    if (props.source) {
+      // Fetching and live updates are handled by whoever owns the source
+      const source = props.source
+      createEffect(() => setData(source()))
+      setLoading(false)
+      return
+    }
+
     fetchData()
-    // Refresh data every 2 seconds
-    const interval = setInterval(fetchData, 2000)
-    return () => clearInterval(interval)
+
+    if (props.liveSeries) {
+      const series = props.liveSeries
+      const unsubscribeSample = subscribe('sample', (sample) => {
+        const points = [...data(), { t: sample.t, v: sample[series] }]
+        setData(points.length > MAX_LIVE_POINTS ? points.slice(-MAX_LIVE_POINTS) : points)
+      })
+      const unsubscribeResync = subscribe('resync', fetchData)
+      onCleanup(() => {
+        unsubscribeSample()
+        unsubscribeResync()
+      })
+    }
+
+    // Refresh data every 2 seconds, unless samples are being pushed
+    const interval = setInterval(() => {
+      if (!props.liveSeries || !pushConnected()) fetchData()
+    }, 2000)
+    onCleanup(() => clearInterval(interval))
   })
 
   createEffect(() => {
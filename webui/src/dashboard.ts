@@ -0,0 +1,81 @@
+import { createSignal } from 'solid-js'
+import { subscribe } from './pushChannel'
+
+// Client side of /api/dashboard. The Status tab makes one request per refresh instead of
+// one per widget; the charts read the series and pause data from here. Series are kept
+// client-side and only the points newer than the last cursor are fetched.
+
+export type DashboardSection = 'status' | 'settings' | 'series' | 'pause' | 'health'
+export type SeriesName = 'movement' | 'runout' | 'connection'
+
+interface DataPoint {
+  t: number
+  v: number
+}
+
+interface PauseSection {
+  attempts: { data: any[] }
+  stats: any
+}
+
+// Cap on points kept per series
+const MAX_SERIES_POINTS = 2000
+const SERIES_NAMES: SeriesName[] = ['movement', 'runout', 'connection']
+
+const emptySeries = (): Record<SeriesName, DataPoint[]> => ({
+  movement: [],
+  runout: [],
+  connection: [],
+})
+
+const [series, setSeries] = createSignal(emptySeries())
+const [pause, setPause] = createSignal<PauseSection | null>(null)
+
+let cursor = 0
+
+const appendPoints = (incoming: Partial<Record<SeriesName, DataPoint[]>>, nextCursor: number) => {
+  const current = series()
+  const next = emptySeries()
+  SERIES_NAMES.forEach((name) => {
+    const added = (incoming[name] || []).filter((point) => point.t > cursor)
+    next[name] = [...current[name], ...added].slice(-MAX_SERIES_POINTS)
+  })
+  cursor = Math.max(cursor, nextCursor)
+  setSeries(next)
+}
+
+// Fetch the given sections in one request. Returns the parsed response so the caller can
+// use the sections it owns (status, settings, health).
+export const fetchDashboard = async (sections: DashboardSection[]) => {
+  const response = await fetch(`/api/dashboard?sections=${sections.join(',')}&since=${cursor}`)
+  if (!response.ok) {
+    throw new Error(`Dashboard request failed: ${response.status} ${response.statusText}`)
+  }
+  const result = await response.json()
+  if (result.series) {
+    appendPoints(result.series, result.series.cursor || 0)
+  }
+  if (result.pause) {
+    setPause(result.pause)
+  }
+  return result
+}
+
+// Forget the cached series so the next fetch reloads the whole window
+export const resetDashboardSeries = () => {
+  cursor = 0
+  setSeries(emptySeries())
+}
+
+// Pushed samples advance the same cursor, so a later fetch doesn't return them again
+export const followPushedSamples = () =>
+  subscribe('sample', (sample) => {
+    const points: Partial<Record<SeriesName, DataPoint[]>> = {}
+    SERIES_NAMES.forEach((name) => {
+      points[name] = [{ t: sample.t, v: sample[name] }]
+    })
+    appendPoints(points, sample.t)
+  })
+
+export const dashboardSeries = (name: SeriesName) => () => series()[name]
+export const dashboardPause = pause
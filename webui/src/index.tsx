@@ -1,14 +1,17 @@
 /* @refresh reload */
 import { render } from 'solid-js/web'
 import { Router, Route } from '@solidjs/router'
+import { lazy } from 'solid-js'
 import './index.css'
 import App from './App.tsx'
-import Settings from './Settings'
 import Status from './Status'
-import Logs from './Logs'
-import SystemHealth from './SystemHealth'
-import Update from './Update'
-import About from './About'
+
+// Everything but the landing tab is its own chunk, fetched the first time it's opened
+const Settings = lazy(() => import('./Settings'))
+const Logs = lazy(() => import('./Logs'))
+const SystemHealth = lazy(() => import('./SystemHealth'))
+const Update = lazy(() => import('./Update'))
+const About = lazy(() => import('./About'))
 
 const root = document.getElementById('root')
 
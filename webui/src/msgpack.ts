@@ -0,0 +1,118 @@
+// Client side of the MessagePack encoding the telemetry endpoints offer. Asking with
+// Accept: application/msgpack gets the same body as the JSON, except that arrays of
+// objects directly under the root (series points, pause attempts, log entries) arrive as
+// columns: { t: [...], v: [...] } instead of [{ t, v }, ...]. fetchTelemetry turns them
+// back into rows, so callers see the JSON shape either way.
+
+// Decode one MessagePack value. Covers what ArduinoJson and the firmware's columnar
+// writer produce: nil, booleans, integers, floats, strings, arrays and maps.
+export const decodeMsgPack = (buffer: ArrayBuffer): any => {
+  const view = new DataView(buffer)
+  const bytes = new Uint8Array(buffer)
+  const text = new TextDecoder()
+  let offset = 0
+
+  const readString = (length: number) => {
+    const value = text.decode(bytes.subarray(offset, offset + length))
+    offset += length
+    return value
+  }
+
+  const readArray = (length: number): any[] => {
+    const value = new Array(length)
+    for (let i = 0; i < length; i++) value[i] = read()
+    return value
+  }
+
+  const readMap = (length: number): Record<string, any> => {
+    const value: Record<string, any> = {}
+    for (let i = 0; i < length; i++) {
+      const key = read()
+      value[key] = read()
+    }
+    return value
+  }
+
+  const read = (): any => {
+    const code = view.getUint8(offset++)
+    if (code <= 0x7f) return code
+    if (code >= 0xe0) return code - 0x100
+    if ((code & 0xf0) === 0x80) return readMap(code & 0x0f)
+    if ((code & 0xf0) === 0x90) return readArray(code & 0x0f)
+    if ((code & 0xe0) === 0xa0) return readString(code & 0x1f)
+
+    let value: any
+    switch (code) {
+      case 0xc0: return null
+      case 0xc2: return false
+      case 0xc3: return true
+      case 0xca: value = view.getFloat32(offset); offset += 4; return value
+      case 0xcb: value = view.getFloat64(offset); offset += 8; return value
+      case 0xcc: value = view.getUint8(offset); offset += 1; return value
+      case 0xcd: value = view.getUint16(offset); offset += 2; return value
+      case 0xce: value = view.getUint32(offset); offset += 4; return value
+      case 0xcf: value = Number(view.getBigUint64(offset)); offset += 8; return value
+      case 0xd0: value = view.getInt8(offset); offset += 1; return value
+      case 0xd1: value = view.getInt16(offset); offset += 2; return value
+      case 0xd2: value = view.getInt32(offset); offset += 4; return value
+      case 0xd3: value = Number(view.getBigInt64(offset)); offset += 8; return value
+      case 0xd9: value = view.getUint8(offset); offset += 1; return readString(value)
+      case 0xda: value = view.getUint16(offset); offset += 2; return readString(value)
+      case 0xdb: value = view.getUint32(offset); offset += 4; return readString(value)
+      case 0xdc: value = view.getUint16(offset); offset += 2; return readArray(value)
+      case 0xdd: value = view.getUint32(offset); offset += 4; return readArray(value)
+      case 0xde: value = view.getUint16(offset); offset += 2; return readMap(value)
+      case 0xdf: value = view.getUint32(offset); offset += 4; return readMap(value)
+    }
+    throw new Error(`Unsupported MessagePack type 0x${code.toString(16)} at ${offset - 1}`)
+  }
+
+  return read()
+}
+
+const isColumns = (value: any) =>
+  value !== null &&
+  typeof value === 'object' &&
+  !Array.isArray(value) &&
+  Object.values(value).every(Array.isArray)
+
+// Rebuild arrays of row objects from the root's column sets. The firmware only sends
+// columns for root members, so any root member that is an object of arrays is one (an
+// empty object is an empty array of rows).
+export const expandColumns = (body: any) => {
+  if (body === null || typeof body !== 'object' || Array.isArray(body)) return body
+  const result: Record<string, any> = {}
+  Object.entries(body).forEach(([key, value]) => {
+    if (!isColumns(value)) {
+      result[key] = value
+      return
+    }
+    const columns = Object.entries(value as Record<string, any[]>)
+    const count = columns.length > 0 ? columns[0][1].length : 0
+    const rows = new Array(count)
+    for (let i = 0; i < count; i++) {
+      const row: Record<string, any> = {}
+      columns.forEach(([field, values]) => {
+        row[field] = values[i]
+      })
+      rows[i] = row
+    }
+    result[key] = rows
+  })
+  return result
+}
+
+// GET a telemetry endpoint, preferring MessagePack. Falls back to JSON when the server
+// answers with it (older firmware, the dev server), and returns the JSON shape either way.
+export const fetchTelemetry = async (url: string) => {
+  const response = await fetch(url, {
+    headers: { Accept: 'application/msgpack, application/json;q=0.9' },
+  })
+  if (!response.ok) {
+    throw new Error(`Request to ${url} failed: ${response.status} ${response.statusText}`)
+  }
+  if ((response.headers.get('Content-Type') || '').includes('application/msgpack')) {
+    return expandColumns(decodeMsgPack(await response.arrayBuffer()))
+  }
+  return response.json()
+}
@@ -0,0 +1,78 @@
+import { createSignal } from 'solid-js'
+
+// One EventSource on /events shared by every component. Events carry sequential ids;
+// a gap means this tab missed something (slow client, dropped message), so listeners
+// get a 'resync' and refetch over REST. While the channel is down, components fall
+// back to their own polling.
+
+export type PushEvent = 'status' | 'log' | 'sample' | 'resync'
+
+type Listener = (data: any) => void
+
+const listeners: Record<PushEvent, Set<Listener>> = {
+  status: new Set(),
+  log: new Set(),
+  sample: new Set(),
+  resync: new Set(),
+}
+
+const [connected, setConnected] = createSignal(false)
+
+let source: EventSource | null = null
+let lastId = 0
+let subscriberCount = 0
+
+const emit = (event: PushEvent, data: any) => {
+  listeners[event].forEach((listener) => listener(data))
+}
+
+const handleMessage = (event: PushEvent) => (message: MessageEvent) => {
+  const id = Number(message.lastEventId) || 0
+  if (id !== 0 && id <= lastId && event !== 'resync') {
+    // Already seen (replayed after a reconnect)
+    return
+  }
+  const missed = lastId !== 0 && id > lastId + 1
+  if (id !== 0) lastId = id
+
+  if (event === 'resync' || missed) {
+    emit('resync', null)
+    if (event === 'resync') return
+  }
+  emit(event, JSON.parse(message.data))
+}
+
+const open = () => {
+  if (source || typeof EventSource === 'undefined') return
+  source = new EventSource('/events')
+  source.onopen = () => setConnected(true)
+  source.onerror = () => {
+    // The browser reconnects on its own and sends Last-Event-ID; poll meanwhile
+    setConnected(false)
+  }
+  ;(['status', 'log', 'sample', 'resync'] as PushEvent[]).forEach((event) =>
+    source!.addEventListener(event, handleMessage(event) as EventListener)
+  )
+}
+
+const close = () => {
+  source?.close()
+  source = null
+  lastId = 0
+  setConnected(false)
+}
+
+// Subscribe to one event type; returns the unsubscribe function
+export const subscribe = (event: PushEvent, listener: Listener) => {
+  listeners[event].add(listener)
+  subscriberCount++
+  open()
+  return () => {
+    listeners[event].delete(listener)
+    subscriberCount--
+    if (subscriberCount === 0) close()
+  }
+}
+
+// True while events are flowing; components poll only when this is false
+export const pushConnected = connected